@@ -0,0 +1,12 @@
+#Check for io_uring support (no liburing required)
+AC_MSG_CHECKING(whether to enable io_uring engine)
+io_uring_default="yes"
+AC_ARG_ENABLE(io-uring,
+	AS_HELP_STRING([--disable-io-uring], [Disable io_uring engine for reactor threads [default=no]])
+		, , enable_io_uring=$io_uring_default)
+AC_MSG_RESULT($enable_io_uring)
+
+if test "$enable_io_uring" = "yes"; then
+	AC_CHECK_HEADER([linux/io_uring.h],
+		[AC_DEFINE([ROFL_HAVE_IO_URING], [1], [io_uring engine available])], [])
+fi
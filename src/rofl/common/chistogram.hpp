@@ -0,0 +1,169 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/*
+ * chistogram.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef SRC_ROFL_COMMON_CHISTOGRAM_HPP_
+#define SRC_ROFL_COMMON_CHISTOGRAM_HPP_
+
+#include <inttypes.h>
+#include <string.h>
+
+#include <iostream>
+
+namespace rofl {
+
+/**
+ * @brief	Log-linear histogram of 64bit values
+ *
+ * Values below 16 are counted exactly, larger values are counted in
+ * buckets of 8 linear sub-buckets per power of two, i.e., with a relative
+ * error below 12.5% over the full value range (like HdrHistogram with one
+ * significant digit). Recording is a few shifts and an increment.
+ */
+class chistogram {
+public:
+  static const unsigned int SUB_BUCKET_BITS = 3;
+  static const unsigned int SUB_BUCKETS = (1 << SUB_BUCKET_BITS);
+  static const unsigned int LINEAR = 2 * SUB_BUCKETS;
+  static const unsigned int BUCKETS =
+      LINEAR + (64 - SUB_BUCKET_BITS - 1) * SUB_BUCKETS;
+
+public:
+  /**
+   *
+   */
+  chistogram() { clear(); };
+
+public:
+  /**
+   * @brief	Resets all counters
+   */
+  void clear() {
+    count = 0;
+    sum = 0;
+    min = UINT64_MAX;
+    max = 0;
+    memset(buckets, 0, sizeof(buckets));
+  };
+
+  /**
+   * @brief	Records a value
+   */
+  void add(uint64_t value) {
+    count++;
+    sum += value;
+    if (value < min)
+      min = value;
+    if (value > max)
+      max = value;
+    buckets[index(value)]++;
+  };
+
+  /**
+   * @brief	Merges counters from another instance
+   */
+  chistogram &operator+=(const chistogram &h) {
+    count += h.count;
+    sum += h.sum;
+    if (h.min < min)
+      min = h.min;
+    if (h.max > max)
+      max = h.max;
+    for (unsigned int i = 0; i < BUCKETS; i++)
+      buckets[i] += h.buckets[i];
+    return *this;
+  };
+
+public:
+  /**
+   * @brief	Returns number of recorded values
+   */
+  uint64_t get_count() const { return count; };
+
+  /**
+   * @brief	Returns smallest recorded value, 0: none recorded
+   */
+  uint64_t get_min() const { return (count) ? min : 0; };
+
+  /**
+   * @brief	Returns largest recorded value
+   */
+  uint64_t get_max() const { return max; };
+
+  /**
+   * @brief	Returns average of recorded values
+   */
+  uint64_t get_mean() const { return (count) ? sum / count : 0; };
+
+  /**
+   * @brief	Returns upper bound of the value at percentile (0.0 ... 100.0)
+   */
+  uint64_t get_percentile(double percentile) const {
+    if (0 == count)
+      return 0;
+    uint64_t rank = (uint64_t)((percentile / 100.0) * count + 0.5);
+    if (rank < 1)
+      rank = 1;
+    if (rank > count)
+      rank = count;
+    uint64_t seen = 0;
+    for (unsigned int i = 0; i < BUCKETS; i++) {
+      seen += buckets[i];
+      if (seen >= rank) {
+        uint64_t value = upper(i);
+        return (value < max) ? value : max;
+      }
+    }
+    return max;
+  };
+
+public:
+  /**
+   * @brief	Returns bucket index of value
+   */
+  static unsigned int index(uint64_t value) {
+    if (value < LINEAR)
+      return value;
+    unsigned int msb = 63 - __builtin_clzll(value);
+    unsigned int shift = msb - SUB_BUCKET_BITS;
+    return LINEAR + (msb - SUB_BUCKET_BITS - 1) * SUB_BUCKETS +
+           ((value >> shift) - SUB_BUCKETS);
+  };
+
+  /**
+   * @brief	Returns largest value counted in bucket
+   */
+  static uint64_t upper(unsigned int index) {
+    if (index < LINEAR)
+      return index;
+    unsigned int shift = (index - LINEAR) / SUB_BUCKETS + 1;
+    uint64_t sub = SUB_BUCKETS + (index - LINEAR) % SUB_BUCKETS;
+    return ((sub + 1) << shift) - 1;
+  };
+
+public:
+  friend std::ostream &operator<<(std::ostream &os, const chistogram &h) {
+    os << "count: " << h.count << " min: " << h.get_min()
+       << " mean: " << h.get_mean() << " p50: " << h.get_percentile(50.0)
+       << " p99: " << h.get_percentile(99.0)
+       << " p99.9: " << h.get_percentile(99.9) << " max: " << h.max;
+    return os;
+  };
+
+private:
+  uint64_t count;
+  uint64_t sum;
+  uint64_t min;
+  uint64_t max;
+  uint64_t buckets[BUCKETS];
+};
+
+}; // end of namespace rofl
+
+#endif /* SRC_ROFL_COMMON_CHISTOGRAM_HPP_ */
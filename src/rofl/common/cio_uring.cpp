@@ -0,0 +1,391 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/*
+ * cio_uring.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "cio_uring.hpp"
+
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <atomic>
+
+#ifdef ROFL_HAVE_IO_URING
+#include <linux/io_uring.h>
+#endif
+
+using namespace rofl;
+
+#ifdef ROFL_HAVE_IO_URING
+
+cio_uring::~cio_uring() { release(); }
+
+cio_uring::cio_uring(unsigned int entries)
+    : fd(-1), sq_ring(MAP_FAILED), sq_ring_size(0), sq_head(nullptr),
+      sq_tail(nullptr), sq_mask(0), sq_entries(0), sqes(MAP_FAILED),
+      sqes_size(0), cq_ring(MAP_FAILED), cq_ring_size(0), cq_head(nullptr),
+      cq_tail(nullptr), cq_mask(0), cqes(nullptr),
+      buf_ring(nullptr), buf_ring_size(0), buf_base(nullptr), buf_size(0),
+      buf_num(0), buf_tail(0) {
+  struct io_uring_params params;
+  memset(&params, 0, sizeof(params));
+
+  if ((fd = syscall(__NR_io_uring_setup, entries, &params)) < 0) {
+    throw eSysCall("eSysCall", "io_uring_setup", __FILE__, __FUNCTION__,
+                   __LINE__);
+  }
+
+  /* waiting with a timeout in a single io_uring_enter() call */
+  if (not(params.features & IORING_FEAT_EXT_ARG)) {
+    ::close(fd);
+    errno = ENOSYS;
+    throw eSysCall("eSysCall", "io_uring_setup (IORING_FEAT_EXT_ARG)",
+                   __FILE__, __FUNCTION__, __LINE__);
+  }
+
+  sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+  cq_ring_size =
+      params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+  if (params.features & IORING_FEAT_SINGLE_MMAP) {
+    sq_ring_size = cq_ring_size =
+        (sq_ring_size > cq_ring_size) ? sq_ring_size : cq_ring_size;
+  }
+
+  sq_ring = mmap(nullptr, sq_ring_size, PROT_READ | PROT_WRITE,
+                 MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+  if (MAP_FAILED == sq_ring) {
+    release();
+    throw eSysCall("eSysCall", "mmap (IORING_OFF_SQ_RING)", __FILE__,
+                   __FUNCTION__, __LINE__);
+  }
+
+  if (params.features & IORING_FEAT_SINGLE_MMAP) {
+    cq_ring = sq_ring;
+  } else {
+    cq_ring = mmap(nullptr, cq_ring_size, PROT_READ | PROT_WRITE,
+                   MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+    if (MAP_FAILED == cq_ring) {
+      release();
+      throw eSysCall("eSysCall", "mmap (IORING_OFF_CQ_RING)", __FILE__,
+                     __FUNCTION__, __LINE__);
+    }
+  }
+
+  sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+  sqes = mmap(nullptr, sqes_size, PROT_READ | PROT_WRITE,
+              MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+  if (MAP_FAILED == sqes) {
+    release();
+    throw eSysCall("eSysCall", "mmap (IORING_OFF_SQES)", __FILE__,
+                   __FUNCTION__, __LINE__);
+  }
+
+  uint8_t *sq = (uint8_t *)sq_ring;
+  sq_head = (uint32_t *)(sq + params.sq_off.head);
+  sq_tail = (uint32_t *)(sq + params.sq_off.tail);
+  sq_mask = *(uint32_t *)(sq + params.sq_off.ring_mask);
+  sq_entries = params.sq_entries;
+
+  /* entries are always used in ring order */
+  uint32_t *array = (uint32_t *)(sq + params.sq_off.array);
+  for (uint32_t i = 0; i < sq_entries; i++) {
+    array[i] = i;
+  }
+
+  uint8_t *cq = (uint8_t *)cq_ring;
+  cq_head = (uint32_t *)(cq + params.cq_off.head);
+  cq_tail = (uint32_t *)(cq + params.cq_off.tail);
+  cq_mask = *(uint32_t *)(cq + params.cq_off.ring_mask);
+  cqes = cq + params.cq_off.cqes;
+}
+
+void cio_uring::release() {
+  if (MAP_FAILED != sqes)
+    munmap(sqes, sqes_size);
+  if ((MAP_FAILED != cq_ring) && (cq_ring != sq_ring))
+    munmap(cq_ring, cq_ring_size);
+  if (MAP_FAILED != sq_ring)
+    munmap(sq_ring, sq_ring_size);
+  sqes = cq_ring = sq_ring = MAP_FAILED;
+  if (fd >= 0)
+    ::close(fd);
+  fd = -1;
+  /* buffers are unregistered by closing the io_uring fd */
+  if (nullptr != buf_ring)
+    munmap(buf_ring, buf_ring_size);
+  if (nullptr != buf_base)
+    munmap(buf_base, (size_t)buf_num * buf_size);
+  buf_ring = nullptr;
+  buf_base = nullptr;
+}
+
+/*static*/
+bool cio_uring::is_supported() {
+  /* 0: unknown, 1: supported, 2: not supported */
+  static std::atomic_int supported(0);
+  if (0 == supported) {
+    try {
+      cio_uring ring(4);
+      supported = 1;
+    } catch (eSysCall &e) {
+      supported = 2;
+    }
+  }
+  return (1 == supported);
+}
+
+void cio_uring::push(const void *sqe) {
+  uint32_t tail = *sq_tail;
+  if (tail - __atomic_load_n(sq_head, __ATOMIC_ACQUIRE) >= sq_entries) {
+    /* submission queue is full */
+    if ((wait(0, 0, nullptr) < 0) ||
+        (tail - __atomic_load_n(sq_head, __ATOMIC_ACQUIRE) >= sq_entries)) {
+      throw eSysCall("eSysCall", "io_uring_enter (submission queue full)",
+                     __FILE__, __FUNCTION__, __LINE__);
+    }
+  }
+  memcpy((struct io_uring_sqe *)sqes + (tail & sq_mask), sqe,
+         sizeof(struct io_uring_sqe));
+  __atomic_store_n(sq_tail, tail + 1, __ATOMIC_RELEASE);
+}
+
+void cio_uring::reserve(unsigned int num) {
+  if (*sq_tail - __atomic_load_n(sq_head, __ATOMIC_ACQUIRE) + num <=
+      sq_entries)
+    return;
+  if ((wait(0, 0, nullptr) < 0) ||
+      (*sq_tail - __atomic_load_n(sq_head, __ATOMIC_ACQUIRE) + num >
+       sq_entries)) {
+    throw eSysCall("eSysCall", "io_uring_enter (submission queue full)",
+                   __FILE__, __FUNCTION__, __LINE__);
+  }
+}
+
+void cio_uring::poll_add(int fd, uint32_t events, bool multishot,
+                         uint64_t user_data) {
+  struct io_uring_sqe sqe;
+  memset(&sqe, 0, sizeof(sqe));
+  sqe.opcode = IORING_OP_POLL_ADD;
+  sqe.fd = fd;
+  sqe.poll32_events = events;
+  sqe.len = multishot ? IORING_POLL_ADD_MULTI : 0;
+  sqe.user_data = user_data;
+  push(&sqe);
+}
+
+void cio_uring::poll_remove(uint64_t user_data) {
+  struct io_uring_sqe sqe;
+  memset(&sqe, 0, sizeof(sqe));
+  sqe.opcode = IORING_OP_POLL_REMOVE;
+  sqe.fd = -1;
+  sqe.addr = user_data;
+  sqe.user_data = UINT64_MAX;
+  push(&sqe);
+}
+
+bool cio_uring::add_buffers(unsigned int num, size_t size) {
+  if ((nullptr != buf_ring) || (0 == num) || (num & (num - 1)) ||
+      (num > 32768))
+    return false;
+
+  /* ring and buffers must be page aligned */
+  buf_ring_size = num * sizeof(struct io_uring_buf);
+  buf_ring = mmap(nullptr, buf_ring_size, PROT_READ | PROT_WRITE,
+                  MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (MAP_FAILED == buf_ring) {
+    buf_ring = nullptr;
+    return false;
+  }
+  void *base = mmap(nullptr, (size_t)num * size, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (MAP_FAILED == base) {
+    munmap(buf_ring, buf_ring_size);
+    buf_ring = nullptr;
+    return false;
+  }
+
+  struct io_uring_buf_reg reg;
+  memset(&reg, 0, sizeof(reg));
+  reg.ring_addr = (uint64_t)(uintptr_t)buf_ring;
+  reg.ring_entries = num;
+  reg.bgid = 0;
+  if (syscall(__NR_io_uring_register, fd, IORING_REGISTER_PBUF_RING, &reg,
+              1) < 0) {
+    munmap(base, (size_t)num * size);
+    munmap(buf_ring, buf_ring_size);
+    buf_ring = nullptr;
+    return false;
+  }
+
+  buf_base = (uint8_t *)base;
+  buf_size = size;
+  buf_num = num;
+  buf_tail = 0;
+  for (unsigned int bid = 0; bid < num; bid++) {
+    recycle_buffer(bid);
+  }
+  return true;
+}
+
+void cio_uring::recycle_buffer(uint16_t bid) {
+  /* the tail overlays the first entry, io_uring_buf_ring::bufs is not
+   * located at offset 0 when compiled as C++ */
+  struct io_uring_buf &buf =
+      ((struct io_uring_buf *)buf_ring)[buf_tail & (buf_num - 1)];
+  buf.addr = (uint64_t)(uintptr_t)(buf_base + (size_t)bid * buf_size);
+  buf.len = buf_size;
+  buf.bid = bid;
+  uint16_t *tail = (uint16_t *)((uint8_t *)buf_ring +
+                                offsetof(struct io_uring_buf_ring, tail));
+  __atomic_store_n(tail, ++buf_tail, __ATOMIC_RELEASE);
+}
+
+void cio_uring::recv(int fd, bool multishot, uint64_t user_data) {
+  struct io_uring_sqe sqe;
+  memset(&sqe, 0, sizeof(sqe));
+  sqe.opcode = IORING_OP_RECV;
+  sqe.fd = fd;
+  sqe.flags = IOSQE_BUFFER_SELECT;
+  sqe.buf_group = 0;
+  sqe.ioprio = multishot ? IORING_RECV_MULTISHOT : 0;
+  sqe.user_data = user_data;
+  push(&sqe);
+}
+
+void cio_uring::send(int fd, const struct iovec *segs, unsigned int num,
+                     uint64_t user_data) {
+  /* a chain split across two submissions is not ordered */
+  reserve(num);
+  for (unsigned int i = 0; i < num; i++) {
+    struct io_uring_sqe sqe;
+    memset(&sqe, 0, sizeof(sqe));
+    sqe.opcode = IORING_OP_SEND;
+    sqe.fd = fd;
+    sqe.addr = (uint64_t)(uintptr_t)segs[i].iov_base;
+    sqe.len = segs[i].iov_len;
+    /* MSG_WAITALL: partial sends are retried by the kernel */
+    sqe.msg_flags = MSG_NOSIGNAL | MSG_WAITALL;
+    if (i + 1 < num) {
+      sqe.flags = IOSQE_IO_LINK;
+      sqe.msg_flags |= MSG_MORE;
+    }
+    sqe.user_data = user_data;
+    push(&sqe);
+  }
+}
+
+void cio_uring::cancel(uint64_t user_data) {
+  struct io_uring_sqe sqe;
+  memset(&sqe, 0, sizeof(sqe));
+  sqe.opcode = IORING_OP_ASYNC_CANCEL;
+  sqe.fd = -1;
+  sqe.addr = user_data;
+  /* all segments of a send() chain share their user_data */
+  sqe.cancel_flags = IORING_ASYNC_CANCEL_ALL;
+  sqe.user_data = UINT64_MAX;
+  push(&sqe);
+}
+
+int cio_uring::wait(unsigned int wait_nr, int timeout_ms,
+                    const sigset_t *sigmask) {
+  struct __kernel_timespec ts;
+  struct io_uring_getevents_arg arg;
+  memset(&arg, 0, sizeof(arg));
+  arg.sigmask = (uint64_t)(uintptr_t)sigmask;
+  arg.sigmask_sz = _NSIG / 8;
+  if (timeout_ms >= 0) {
+    ts.tv_sec = timeout_ms / 1000;
+    ts.tv_nsec = (timeout_ms % 1000) * 1000000;
+    arg.ts = (uint64_t)(uintptr_t)&ts;
+  }
+
+  unsigned int flags = IORING_ENTER_EXT_ARG;
+  if (wait_nr > 0)
+    flags |= IORING_ENTER_GETEVENTS;
+
+  /* requests may be queued concurrently under the caller's lock */
+  unsigned int to_submit = __atomic_load_n(sq_tail, __ATOMIC_ACQUIRE) -
+                           __atomic_load_n(sq_head, __ATOMIC_ACQUIRE);
+
+  return syscall(__NR_io_uring_enter, fd, to_submit, wait_nr, flags, &arg,
+                 sizeof(arg));
+}
+
+bool cio_uring::pop(uint64_t &user_data, int32_t &res, bool &more,
+                    int &bid) {
+  uint32_t head = *cq_head;
+  if (head == __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE))
+    return false;
+  const struct io_uring_cqe &cqe =
+      ((const struct io_uring_cqe *)cqes)[head & cq_mask];
+  user_data = cqe.user_data;
+  res = cqe.res;
+  more = (cqe.flags & IORING_CQE_F_MORE);
+  bid = (cqe.flags & IORING_CQE_F_BUFFER)
+            ? (int)(cqe.flags >> IORING_CQE_BUFFER_SHIFT)
+            : -1;
+  __atomic_store_n(cq_head, head + 1, __ATOMIC_RELEASE);
+  return true;
+}
+
+#else
+
+cio_uring::~cio_uring() {}
+
+cio_uring::cio_uring(unsigned int entries)
+    : fd(-1), sq_ring(nullptr), sq_ring_size(0), sq_head(nullptr),
+      sq_tail(nullptr), sq_mask(0), sq_entries(0), sqes(nullptr),
+      sqes_size(0), cq_ring(nullptr), cq_ring_size(0), cq_head(nullptr),
+      cq_tail(nullptr), cq_mask(0), cqes(nullptr),
+      buf_ring(nullptr), buf_ring_size(0), buf_base(nullptr), buf_size(0),
+      buf_num(0), buf_tail(0) {
+  errno = ENOSYS;
+  throw eSysCall("eSysCall", "io_uring_setup (not compiled in)", __FILE__,
+                 __FUNCTION__, __LINE__);
+}
+
+void cio_uring::release() {}
+
+/*static*/
+bool cio_uring::is_supported() { return false; }
+
+void cio_uring::push(const void *sqe) {}
+
+void cio_uring::poll_add(int fd, uint32_t events, bool multishot,
+                         uint64_t user_data) {}
+
+void cio_uring::poll_remove(uint64_t user_data) {}
+
+bool cio_uring::add_buffers(unsigned int num, size_t size) { return false; }
+
+void cio_uring::recycle_buffer(uint16_t bid) {}
+
+void cio_uring::recv(int fd, bool multishot, uint64_t user_data) {}
+
+void cio_uring::send(int fd, const struct iovec *segs, unsigned int num,
+                     uint64_t user_data) {}
+
+void cio_uring::cancel(uint64_t user_data) {}
+
+void cio_uring::reserve(unsigned int num) {}
+
+int cio_uring::wait(unsigned int wait_nr, int timeout_ms,
+                    const sigset_t *sigmask) {
+  errno = ENOSYS;
+  return -1;
+}
+
+bool cio_uring::pop(uint64_t &user_data, int32_t &res, bool &more,
+                    int &bid) {
+  return false;
+}
+
+#endif
@@ -0,0 +1,193 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/*
+ * cio_uring.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef SRC_ROFL_COMMON_CIO_URING_HPP_
+#define SRC_ROFL_COMMON_CIO_URING_HPP_
+
+#include <inttypes.h>
+#include <signal.h>
+#include <stddef.h>
+#include <sys/uio.h>
+
+#include "rofl/common/exception.hpp"
+
+namespace rofl {
+
+/**
+ * @brief	Minimal io_uring instance for polling and stream socket I/O
+ *
+ * Talks to the kernel via raw system calls, liburing is not required.
+ * Submission queue entries are published immediately and submitted to the
+ * kernel by the next call to wait(), so a batch of requests and the wait
+ * for completions cost a single system call. Received data is placed by
+ * the kernel in a ring of provided buffers, see add_buffers(). All methods
+ * except is_supported() must be serialized by the caller, wait() may run
+ * concurrently with queueing of requests.
+ */
+class cio_uring {
+public:
+  /**
+   *
+   */
+  ~cio_uring();
+
+  /**
+   * @brief	cio_uring constructor
+   *
+   * Throws eSysCall when io_uring is not available.
+   */
+  cio_uring(unsigned int entries = 256);
+
+private:
+  cio_uring(const cio_uring &ring);
+
+  cio_uring &operator=(const cio_uring &ring);
+
+public:
+  /**
+   * @brief	Returns true when kernel and build support io_uring polling
+   */
+  static bool is_supported();
+
+  /**
+   * @brief	Queues a poll request for events (EPOLLIN, EPOLLOUT, ...) on fd
+   *
+   * A multishot request stays armed after posting a completion.
+   */
+  void poll_add(int fd, uint32_t events, bool multishot, uint64_t user_data);
+
+  /**
+   * @brief	Queues removal of the poll request identified by user_data
+   */
+  void poll_remove(uint64_t user_data);
+
+  /**
+   * @brief	Registers a ring of num provided buffers of size bytes each
+   *
+   * Buffers are selected by the kernel for recv() requests, num must be a
+   * power of two. Returns false when the kernel does not support provided
+   * buffer rings.
+   */
+  bool add_buffers(unsigned int num, size_t size);
+
+  /**
+   * @brief	Returns true when provided buffers are registered
+   */
+  bool has_buffers() const { return (nullptr != buf_ring); };
+
+  /**
+   * @brief	Returns provided buffer bid filled by a recv() completion
+   */
+  const uint8_t *get_buffer(uint16_t bid) const {
+    return buf_base + (size_t)bid * buf_size;
+  };
+
+  /**
+   * @brief	Hands provided buffer bid back to the kernel
+   */
+  void recycle_buffer(uint16_t bid);
+
+  /**
+   * @brief	Queues a receive request on stream socket fd
+   *
+   * Data is received into provided buffers, a multishot request stays
+   * armed until an error, end of stream or exhaustion of buffers (ENOBUFS).
+   */
+  void recv(int fd, bool multishot, uint64_t user_data);
+
+  /**
+   * @brief	Queues sending of num segments on stream socket fd
+   *
+   * Segments are sent in order by a chain of linked requests, a failed or
+   * short send cancels the remaining segments (ECANCELED). Each segment
+   * posts a completion, buffers must stay valid until then.
+   */
+  void send(int fd, const struct iovec *segs, unsigned int num,
+            uint64_t user_data);
+
+  /**
+   * @brief	Queues cancellation of all requests identified by user_data
+   */
+  void cancel(uint64_t user_data);
+
+  /**
+   * @brief	Returns maximum number of segments per send()
+   */
+  unsigned int get_max_segs() const { return sq_entries / 2; };
+
+  /**
+   * @brief	Submits queued requests and waits for completions
+   *
+   * @param wait_nr minimum number of completions to wait for, 0: no wait
+   * @param timeout_ms maximum time to wait, -1: infinite
+   * @param sigmask signal mask applied while waiting or nullptr
+   * @return -1 and errno on error, ETIME signals an expired timeout
+   */
+  int wait(unsigned int wait_nr, int timeout_ms, const sigset_t *sigmask);
+
+  /**
+   * @brief	Removes next completion, returns false if none available
+   *
+   * @param more true: request stays armed and posts further completions
+   * @param bid provided buffer holding received data or -1
+   */
+  bool pop(uint64_t &user_data, int32_t &res, bool &more, int &bid);
+
+private:
+  /**
+   * @brief	Publishes submission queue entry, submits when queue is full
+   */
+  void push(const void *sqe);
+
+  /**
+   * @brief	Submits queued requests until num entries are available
+   */
+  void reserve(unsigned int num);
+
+  /**
+   * @brief	Unmaps rings and closes io_uring fd
+   */
+  void release();
+
+private:
+  int fd; // io_uring fd
+
+  // submission queue ring
+  void *sq_ring;
+  size_t sq_ring_size;
+  uint32_t *sq_head;
+  uint32_t *sq_tail;
+  uint32_t sq_mask;
+  uint32_t sq_entries;
+
+  // submission queue entries
+  void *sqes;
+  size_t sqes_size;
+
+  // completion queue ring, may share mapping with submission queue ring
+  void *cq_ring;
+  size_t cq_ring_size;
+  uint32_t *cq_head;
+  uint32_t *cq_tail;
+  uint32_t cq_mask;
+  void *cqes;
+
+  // provided buffer ring and buffers
+  void *buf_ring;
+  size_t buf_ring_size;
+  uint8_t *buf_base;
+  size_t buf_size;
+  uint32_t buf_num;
+  uint16_t buf_tail;
+};
+
+}; // end of namespace rofl
+
+#endif /* SRC_ROFL_COMMON_CIO_URING_HPP_ */
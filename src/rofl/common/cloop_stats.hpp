@@ -0,0 +1,118 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/*
+ * cloop_stats.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef SRC_ROFL_COMMON_CLOOP_STATS_HPP_
+#define SRC_ROFL_COMMON_CLOOP_STATS_HPP_
+
+#include <iostream>
+
+#include "rofl/common/chistogram.hpp"
+
+namespace rofl {
+
+/**
+ * @brief	Event loop metrics of a reactor thread
+ *
+ * All durations are given in nsecs. The loop iteration time spans from
+ * the return of epoll_pwait() (or io_uring wait) to the next call, i.e., it
+ * is the lag added to events arriving while the loop is busy.
+ */
+class cloop_stats {
+public:
+  enum callback_t {
+    CALLBACK_READ = 0,    // handle_read_event()
+    CALLBACK_WRITE = 1,   // handle_write_event()
+    CALLBACK_TIMEOUT = 2, // handle_timeout()
+    CALLBACK_WAKEUP = 3,  // handle_wakeup()
+    CALLBACK_TASK = 4,    // tasks posted via cthread::post()
+    CALLBACK_MAX = 5,
+  };
+
+public:
+  /**
+   * @brief	Resets all histograms
+   */
+  void clear() {
+    iteration.clear();
+    for (unsigned int i = 0; i < CALLBACK_MAX; i++)
+      callbacks[i].clear();
+    lateness.clear();
+    events.clear();
+  };
+
+  /**
+   * @brief	Merges histograms from another instance
+   */
+  cloop_stats &operator+=(const cloop_stats &stats) {
+    iteration += stats.iteration;
+    for (unsigned int i = 0; i < CALLBACK_MAX; i++)
+      callbacks[i] += stats.callbacks[i];
+    lateness += stats.lateness;
+    events += stats.events;
+    return *this;
+  };
+
+public:
+  /**
+   * @brief	Returns histogram of loop iteration times
+   */
+  const chistogram &get_iteration() const { return iteration; };
+
+  /**
+   * @brief	Returns histogram of wall times of callback type
+   */
+  const chistogram &get_callback(callback_t cb) const {
+    return callbacks[cb];
+  };
+
+  /**
+   * @brief	Returns histogram of timer lateness
+   */
+  const chistogram &get_lateness() const { return lateness; };
+
+  /**
+   * @brief	Returns histogram of file descriptor events per wakeup
+   */
+  const chistogram &get_events() const { return events; };
+
+public:
+  void add_iteration(uint64_t nsecs) { iteration.add(nsecs); };
+
+  void add_callback(callback_t cb, uint64_t nsecs) {
+    callbacks[cb].add(nsecs);
+  };
+
+  void add_lateness(uint64_t nsecs) { lateness.add(nsecs); };
+
+  void add_events(uint64_t num) { events.add(num); };
+
+public:
+  friend std::ostream &operator<<(std::ostream &os, const cloop_stats &stats) {
+    static const char *names[CALLBACK_MAX] = {"read", "write", "timeout",
+                                              "wakeup", "task"};
+    os << "<cloop_stats >" << std::endl;
+    os << "  iteration (ns): " << stats.iteration << std::endl;
+    for (unsigned int i = 0; i < CALLBACK_MAX; i++)
+      os << "  " << names[i] << " (ns): " << stats.callbacks[i] << std::endl;
+    os << "  lateness (ns): " << stats.lateness << std::endl;
+    os << "  events/wakeup: " << stats.events << std::endl;
+    return os;
+  };
+
+private:
+  chistogram iteration;
+  chistogram callbacks[CALLBACK_MAX];
+  chistogram lateness;
+  chistogram events;
+};
+
+}; // end of namespace rofl
+
+#endif /* SRC_ROFL_COMMON_CLOOP_STATS_HPP_ */
@@ -4,8 +4,64 @@
 
 #include "cmemory.h"
 
+#include <new>
+
+#include "rofl/common/cmempool.hpp"
+
 using namespace rofl;
 
+namespace {
+
+/* size classes for memory areas, larger areas bypass the pools */
+cmempool *buffer_pool(size_t len) {
+  static cmempool pools[] = {{"cmemory_128", 128, 1024},
+                             {"cmemory_512", 512, 512},
+                             {"cmemory_2048", 2048, 256},
+                             {"cmemory_8192", 8192, 64}};
+  for (auto &pool : pools) {
+    if (len <= pool.get_block_size())
+      return &pool;
+  }
+  return nullptr;
+}
+
+uint8_t *buffer_allocate(size_t len) {
+  cmempool *pool = buffer_pool(len);
+  try {
+    return (uint8_t *)(pool ? pool->allocate(len) : ::operator new(len));
+  } catch (std::bad_alloc &e) {
+    throw eSysCall("memory allocation failed")
+        .set_func(__FUNCTION__)
+        .set_line(__LINE__);
+  }
+}
+
+void buffer_release(uint8_t *mem, size_t len) {
+  cmempool *pool = buffer_pool(len);
+  if (pool) {
+    pool->release(mem, len);
+  } else {
+    ::operator delete(mem);
+  }
+}
+
+/* moves the area to another block if len leaves its size class */
+uint8_t *buffer_resize(uint8_t *mem, size_t len, size_t newlen) {
+  if (nullptr == mem) {
+    return buffer_allocate(newlen);
+  }
+  cmempool *pool = buffer_pool(len);
+  if (pool && (pool == buffer_pool(newlen))) {
+    return mem;
+  }
+  uint8_t *newmem = buffer_allocate(newlen);
+  memcpy(newmem, mem, (len < newlen) ? len : newlen);
+  buffer_release(mem, len);
+  return newmem;
+}
+
+}; // end of anonymous namespace
+
 /*static*/ std::set<cmemory *> cmemory::cmemory_list;
 /*static*/ pthread_mutex_t cmemory::memlock;
 /*static*/ int cmemory::memlockcnt = 0;
@@ -182,21 +238,13 @@ uint8_t *cmemory::resize(size_t len) {
   if (0 == len) {
     mfree();
   } else if (len <= data.second) {
-    if ((data.first = (uint8_t *)realloc(data.first, len)) == 0) {
-      throw eSysCall("realloc syscall failed")
-          .set_func(__FUNCTION__)
-          .set_line(__LINE__);
-    }
+    data.first = buffer_resize(data.first, data.second, len);
     // memset(data.first + len, 0x00, data.second);
 
     // adjust data
     data.second = len;
   } else {
-    if ((data.first = (uint8_t *)realloc(data.first, len)) == 0) {
-      throw eSysCall("realloc syscall failed")
-          .set_func(__FUNCTION__)
-          .set_line(__LINE__);
-    }
+    data.first = buffer_resize(data.first, data.second, len);
     memset(data.first + data.second, 0x00, len - data.second);
 
     // adjust data
@@ -227,21 +275,16 @@ void cmemory::mallocate(size_t len) {
   if (data.first) {
     mfree();
   }
+  data.first = buffer_allocate(len);
   data.second = len;
 
-  if ((data.first = (uint8_t *)calloc(1, data.second)) == 0) {
-    throw eSysCall("calloc syscall failed")
-        .set_func(__FUNCTION__)
-        .set_line(__LINE__);
-  }
-
   memset(data.first, 0, data.second);
 }
 
 void cmemory::mfree() {
   if (data.first) {
     memset(data.first, 0, data.second);
-    free(data.first);
+    buffer_release(data.first, data.second);
   }
   data = std::make_pair<uint8_t *, size_t>(NULL, 0);
 }
@@ -271,17 +314,13 @@ uint8_t *cmemory::insert(unsigned int offset, size_t len) {
   uint8_t *p_ptr = (uint8_t *)0;
   size_t p_len = data.second + len;
 
-  if ((p_ptr = (uint8_t *)calloc(1, p_len)) == 0) {
-    throw eSysCall("calloc syscall failed")
-        .set_func(__FUNCTION__)
-        .set_line(__LINE__);
-  }
+  p_ptr = buffer_allocate(p_len);
 
   memcpy(p_ptr, data.first, offset);
   memset(p_ptr + offset, 0x00, len);
   memcpy(p_ptr + offset + len, data.first + offset, data.second - offset);
 
-  free(data.first);
+  buffer_release(data.first, data.second);
 
   data.first = p_ptr;
   data.second = p_len;
@@ -30,10 +30,12 @@ public:
 
 /**
  * @class 	cmemory
- * @brief	C++ abstraction for malloc'ed memory areas.
+ * @brief	C++ abstraction for heap allocated memory areas.
  *
  * This class provides a set of convenience methods for dealing with
- * memory areas managed by the C-functions malloc/realloc/free.
+ * memory areas on the heap. Memory areas up to 8192 bytes are taken
+ * from per-thread cmempool size classes "cmemory_<size>", larger ones
+ * are allocated via operator new.
  * It is not hiding or preventing access from the memory area.
  * The user can get access to the memory addresses via somem()
  * and calculate offsets. However, when resizing the memory area,
@@ -58,7 +60,7 @@ public:
    * @brief	Constructor. Allocates a new memory area with specified size
    * (default: 1024 bytes).
    *
-   * @param len length of new memory area to be allocated via malloc.
+   * @param len length of new memory area to be allocated
    */
   cmemory(size_t len = CMEMORY_DEFAULT_SIZE);
 
@@ -79,7 +81,8 @@ public:
   cmemory(const cmemory &m);
 
   /**
-   * @brief	Destructor. Calls C-function free() for allocated memory area.
+   * @brief	Destructor. Returns allocated memory area to its cmempool size
+   * class or releases it via operator delete.
    *
    */
   virtual ~cmemory();
@@ -185,14 +188,15 @@ public:
   virtual size_t length() const { return data.second; };
 
   /**
-   * @brief	Resizes allocated memory area by calling C-function realloc().
+   * @brief	Resizes allocated memory area, moving it when it leaves its
+   * size class.
    *
    * This method resizes the internal memory area and adjusts all internal
    * parameters accordingly, so that any subsequent calls to @see somem()
    * will yield valid results.
    *
    * @param len new length of allocated memory area after resize operation
-   * @exception eMemAllocFailed is thrown when the C-function realloc() fails
+   * @exception eSysCall is thrown when the allocation fails
    */
   virtual uint8_t *resize(size_t len);
 
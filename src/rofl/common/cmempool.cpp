@@ -0,0 +1,222 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/*
+ * cmempool.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "cmempool.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <set>
+
+using namespace rofl;
+
+namespace {
+
+/* freelist of a single pool in a single thread, the counters are written
+ * by the owning thread only and read by get_stats() */
+struct cfreelist {
+  cfreelist()
+      : head(nullptr), count(0), hits(0), misses(0), oversized(0), releases(0),
+        drops(0){};
+  void *head;
+  std::atomic<uint64_t> count;
+  std::atomic<uint64_t> hits;
+  std::atomic<uint64_t> misses;
+  std::atomic<uint64_t> oversized;
+  std::atomic<uint64_t> releases;
+  std::atomic<uint64_t> drops;
+};
+
+inline void increment(std::atomic<uint64_t> &counter) {
+  counter.store(counter.load(std::memory_order_relaxed) + 1,
+                std::memory_order_relaxed);
+}
+
+inline void decrement(std::atomic<uint64_t> &counter) {
+  counter.store(counter.load(std::memory_order_relaxed) - 1,
+                std::memory_order_relaxed);
+}
+
+}; // end of anonymous namespace
+
+namespace rofl {
+
+/* per-thread freelists of all pools */
+class cmempool_cache {
+public:
+  ~cmempool_cache();
+  cmempool_cache();
+  static cmempool_cache *local();
+  static void fold_stats(cmempool_stats &stats, const cfreelist &list);
+  cfreelist lists[cmempool::MAX_POOLS];
+};
+
+}; // end of namespace rofl
+
+namespace {
+
+/* all live thread caches and the counters of exited threads */
+struct cregistry {
+  cregistry() : num_pools(0){};
+  std::mutex lock;
+  std::set<cmempool_cache *> caches;
+  cmempool_stats retired[cmempool::MAX_POOLS];
+  const cmempool *pools[cmempool::MAX_POOLS];
+  unsigned int num_pools;
+};
+
+cregistry &registry() {
+  static cregistry *reg = new cregistry();
+  return *reg;
+}
+
+/* cache of this thread, null before first use and after thread exit */
+thread_local cmempool_cache *thread_cache = nullptr;
+thread_local bool cache_destroyed = false;
+
+}; // end of anonymous namespace
+
+cmempool_cache::~cmempool_cache() {
+  std::lock_guard<std::mutex> guard(registry().lock);
+  registry().caches.erase(this);
+  for (unsigned int i = 0; i < cmempool::MAX_POOLS; i++) {
+    cfreelist &list = lists[i];
+    while (list.head) {
+      void *mem = list.head;
+      list.head = *(void **)mem;
+      ::operator delete(mem);
+      decrement(list.count);
+      increment(list.drops);
+    }
+    fold_stats(registry().retired[i], list);
+  }
+  thread_cache = nullptr;
+  cache_destroyed = true;
+}
+
+cmempool_cache::cmempool_cache() {
+  std::lock_guard<std::mutex> guard(registry().lock);
+  registry().caches.insert(this);
+}
+
+/*static*/ cmempool_cache *cmempool_cache::local() {
+  if (thread_cache)
+    return thread_cache;
+  if (cache_destroyed)
+    return nullptr;
+  static thread_local cmempool_cache cache;
+  return (thread_cache = &cache);
+}
+
+/*static*/ void cmempool_cache::fold_stats(cmempool_stats &stats,
+                                           const cfreelist &list) {
+  stats.hits += list.hits.load(std::memory_order_relaxed);
+  stats.misses += list.misses.load(std::memory_order_relaxed);
+  stats.oversized += list.oversized.load(std::memory_order_relaxed);
+  stats.releases += list.releases.load(std::memory_order_relaxed);
+  stats.drops += list.drops.load(std::memory_order_relaxed);
+  stats.cached += list.count.load(std::memory_order_relaxed);
+}
+
+cmempool::~cmempool() {
+  std::lock_guard<std::mutex> guard(registry().lock);
+  if (index < MAX_POOLS) {
+    registry().pools[index] = nullptr;
+  }
+}
+
+cmempool::cmempool(const std::string &name, size_t block_size,
+                   size_t max_cached)
+    : name(name), max_cached(max_cached), index(MAX_POOLS) {
+  /* keep blocks aligned and large enough for the freelist link */
+  const size_t align = alignof(max_align_t);
+  this->block_size = ((block_size + align - 1) / align) * align;
+
+  /* slots are never reused, freelists of other threads may still hold
+   * blocks of a destroyed pool; pools beyond MAX_POOLS bypass caching */
+  std::lock_guard<std::mutex> guard(registry().lock);
+  if (registry().num_pools < MAX_POOLS) {
+    index = registry().num_pools++;
+    registry().pools[index] = this;
+  }
+}
+
+void *cmempool::allocate(size_t size) {
+  cmempool_cache *cache = cmempool_cache::local();
+  if ((index >= MAX_POOLS) || (nullptr == cache)) {
+    return ::operator new(size);
+  }
+  cfreelist &list = cache->lists[index];
+  if (size > block_size) {
+    increment(list.oversized);
+    return ::operator new(size);
+  }
+  if (list.head) {
+    void *mem = list.head;
+    list.head = *(void **)mem;
+    decrement(list.count);
+    increment(list.hits);
+    return mem;
+  }
+  increment(list.misses);
+  return ::operator new(block_size);
+}
+
+void cmempool::release(void *mem, size_t size) {
+  if (nullptr == mem) {
+    return;
+  }
+  cmempool_cache *cache = cmempool_cache::local();
+  if ((index >= MAX_POOLS) || (nullptr == cache) || (size > block_size)) {
+    ::operator delete(mem);
+    return;
+  }
+  cfreelist &list = cache->lists[index];
+  if (list.count.load(std::memory_order_relaxed) >= max_cached) {
+    increment(list.drops);
+    ::operator delete(mem);
+    return;
+  }
+  *(void **)mem = list.head;
+  list.head = mem;
+  increment(list.count);
+  increment(list.releases);
+}
+
+cmempool_stats cmempool::get_stats() const {
+  cmempool_stats stats;
+  stats.block_size = block_size;
+  if (index >= MAX_POOLS) {
+    return stats;
+  }
+  std::lock_guard<std::mutex> guard(registry().lock);
+  stats += registry().retired[index];
+  for (auto cache : registry().caches) {
+    cmempool_cache::fold_stats(stats, cache->lists[index]);
+  }
+  return stats;
+}
+
+/*static*/ std::map<std::string, cmempool_stats> cmempool::get_all_stats() {
+  std::map<std::string, cmempool_stats> all;
+  std::lock_guard<std::mutex> guard(registry().lock);
+  for (unsigned int i = 0; i < registry().num_pools; i++) {
+    const cmempool *pool = registry().pools[i];
+    if (nullptr == pool)
+      continue;
+    cmempool_stats &stats = all[pool->name];
+    stats.block_size = pool->block_size;
+    stats += registry().retired[i];
+    for (auto cache : registry().caches) {
+      cmempool_cache::fold_stats(stats, cache->lists[i]);
+    }
+  }
+  return all;
+}
@@ -0,0 +1,197 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/*
+ * cmempool.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef SRC_ROFL_COMMON_CMEMPOOL_HPP_
+#define SRC_ROFL_COMMON_CMEMPOOL_HPP_
+
+#include <inttypes.h>
+#include <stddef.h>
+
+#include <iostream>
+#include <map>
+#include <string>
+
+namespace rofl {
+
+class cmempool_cache;
+
+/**
+ * @brief	Counters of a cmempool instance summed over all threads
+ */
+class cmempool_stats {
+  friend class cmempool;
+  friend class cmempool_cache;
+
+public:
+  cmempool_stats()
+      : block_size(0), hits(0), misses(0), oversized(0), releases(0),
+        drops(0), cached(0){};
+
+  /**
+   * @brief	Merges counters from another instance
+   */
+  cmempool_stats &operator+=(const cmempool_stats &stats) {
+    hits += stats.hits;
+    misses += stats.misses;
+    oversized += stats.oversized;
+    releases += stats.releases;
+    drops += stats.drops;
+    cached += stats.cached;
+    return *this;
+  };
+
+public:
+  /**
+   * @brief	Returns size of a pool block in bytes
+   */
+  size_t get_block_size() const { return block_size; };
+
+  /**
+   * @brief	Returns number of allocations served from a freelist
+   */
+  uint64_t get_hits() const { return hits; };
+
+  /**
+   * @brief	Returns number of allocations served by operator new
+   */
+  uint64_t get_misses() const { return misses; };
+
+  /**
+   * @brief	Returns number of allocations exceeding the block size
+   */
+  uint64_t get_oversized() const { return oversized; };
+
+  /**
+   * @brief	Returns number of blocks returned to a freelist
+   */
+  uint64_t get_releases() const { return releases; };
+
+  /**
+   * @brief	Returns number of blocks handed back to operator delete
+   */
+  uint64_t get_drops() const { return drops; };
+
+  /**
+   * @brief	Returns number of blocks currently held in freelists
+   */
+  uint64_t get_cached() const { return cached; };
+
+  /**
+   * @brief	Returns ratio of allocations served from a freelist
+   */
+  double get_hit_rate() const {
+    uint64_t total = hits + misses;
+    return (0 == total) ? 0.0 : (double)hits / total;
+  };
+
+  /**
+   * @brief	Returns bytes held by the pool, in use or cached
+   */
+  size_t get_footprint() const {
+    return (drops > misses) ? 0 : (misses - drops) * block_size;
+  };
+
+public:
+  friend std::ostream &operator<<(std::ostream &os,
+                                  const cmempool_stats &stats) {
+    os << "<cmempool_stats block_size: " << stats.block_size
+       << " hits: " << stats.hits << " misses: " << stats.misses
+       << " oversized: " << stats.oversized << " releases: " << stats.releases
+       << " drops: " << stats.drops << " cached: " << stats.cached
+       << " hit_rate: " << stats.get_hit_rate()
+       << " footprint: " << stats.get_footprint() << " >";
+    return os;
+  };
+
+private:
+  size_t block_size;
+  uint64_t hits;
+  uint64_t misses;
+  uint64_t oversized;
+  uint64_t releases;
+  uint64_t drops;
+  uint64_t cached;
+};
+
+/**
+ * @brief	Slab pool of fixed size blocks with per-thread freelists
+ *
+ * Blocks are obtained from operator new and kept on a freelist of the
+ * releasing thread, which may differ from the allocating one. Each freelist
+ * holds up to max_cached blocks, surplus blocks are handed back to operator
+ * delete. Requests larger than the block size bypass the pool. A released
+ * block is never shared with another thread, so no locking is required on
+ * the allocation path.
+ */
+class cmempool {
+public:
+  /**
+   * @brief	Maximum number of pools per process
+   */
+  static const unsigned int MAX_POOLS = 64;
+
+public:
+  /**
+   *
+   */
+  ~cmempool();
+
+  /**
+   *
+   */
+  cmempool(const std::string &name, size_t block_size,
+           size_t max_cached = 1024);
+
+private:
+  cmempool(const cmempool &pool);
+
+  cmempool &operator=(const cmempool &pool);
+
+public:
+  /**
+   * @brief	Returns a block of at least size bytes
+   */
+  void *allocate(size_t size);
+
+  /**
+   * @brief	Returns a block obtained via allocate(size) to the pool
+   */
+  void release(void *mem, size_t size);
+
+  /**
+   * @brief	Returns counters summed over all threads
+   */
+  cmempool_stats get_stats() const;
+
+  /**
+   * @brief	Returns name of this pool
+   */
+  const std::string &get_name() const { return name; };
+
+  /**
+   * @brief	Returns size of a pool block in bytes
+   */
+  size_t get_block_size() const { return block_size; };
+
+  /**
+   * @brief	Returns counters of all pools in this process by name
+   */
+  static std::map<std::string, cmempool_stats> get_all_stats();
+
+private:
+  std::string name;
+  size_t block_size;
+  size_t max_cached;
+  unsigned int index;
+};
+
+}; // end of namespace rofl
+
+#endif /* SRC_ROFL_COMMON_CMEMPOOL_HPP_ */
@@ -0,0 +1,89 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/*
+ * cmpsc_queue.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef SRC_ROFL_COMMON_CMPSC_QUEUE_HPP_
+#define SRC_ROFL_COMMON_CMPSC_QUEUE_HPP_
+
+#include <atomic>
+#include <utility>
+
+namespace rofl {
+
+/**
+ * @brief	Unbounded lock-free multi-producer single-consumer queue
+ *
+ * Any thread may call push(), only a single thread at a time may call pop().
+ * A push() in progress may hide elements pushed afterwards from pop() until
+ * it has completed, so consumers must not treat a failing pop() as a
+ * guarantee that the queue is empty.
+ */
+template <typename T> class cmpsc_queue {
+  struct cnode {
+    cnode() : next(nullptr){};
+    cnode(T &&value) : next(nullptr), value(std::move(value)){};
+    std::atomic<cnode *> next;
+    T value;
+  };
+
+public:
+  /**
+   *
+   */
+  ~cmpsc_queue() {
+    T value;
+    while (pop(value)) {
+    }
+    delete tail;
+  };
+
+  /**
+   *
+   */
+  cmpsc_queue() : head(new cnode()) { tail = head.load(); };
+
+private:
+  cmpsc_queue(const cmpsc_queue &queue);
+
+  cmpsc_queue &operator=(const cmpsc_queue &queue);
+
+public:
+  /**
+   * @brief	Appends value to queue, may be called from any thread
+   */
+  void push(T value) {
+    cnode *node = new cnode(std::move(value));
+    cnode *prev = head.exchange(node, std::memory_order_acq_rel);
+    prev->next.store(node, std::memory_order_release);
+  };
+
+  /**
+   * @brief	Removes first value from queue, returns false if none available
+   */
+  bool pop(T &value) {
+    cnode *next = tail->next.load(std::memory_order_acquire);
+    if (nullptr == next)
+      return false;
+    value = std::move(next->value);
+    delete tail;
+    tail = next;
+    return true;
+  };
+
+private:
+  // last node, producers append here
+  std::atomic<cnode *> head;
+
+  // dummy node preceding the first value, owned by consumer
+  cnode *tail;
+};
+
+}; // end of namespace rofl
+
+#endif /* SRC_ROFL_COMMON_CMPSC_QUEUE_HPP_ */
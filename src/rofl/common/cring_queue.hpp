@@ -0,0 +1,151 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/*
+ * cring_queue.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef SRC_ROFL_COMMON_CRING_QUEUE_HPP_
+#define SRC_ROFL_COMMON_CRING_QUEUE_HPP_
+
+#include <inttypes.h>
+#include <stddef.h>
+
+#include <atomic>
+
+namespace rofl {
+
+/**
+ * @brief	Bounded lock-free ring of fixed capacity
+ *
+ * Any number of threads may call push() and pop() concurrently. Each cell
+ * carries a sequence number, so producers and consumers only contend on the
+ * respective position counter and no memory is allocated after
+ * construction. A push() or pop() in progress may hide subsequent cells
+ * from other threads until it has completed.
+ */
+template <typename T> class cring_queue {
+  struct ccell {
+    std::atomic<size_t> sequence;
+    T value;
+  };
+
+public:
+  /**
+   *
+   */
+  ~cring_queue() { delete[] cells; };
+
+  /**
+   * @param size capacity, rounded up to the next power of two
+   */
+  cring_queue(size_t size) : mask(1), cells(nullptr) {
+    while (mask < size)
+      mask <<= 1;
+    cells = new ccell[mask];
+    for (size_t i = 0; i < mask; i++)
+      cells[i].sequence.store(i, std::memory_order_relaxed);
+    mask -= 1;
+    enqueue_pos.store(0, std::memory_order_relaxed);
+    dequeue_pos.store(0, std::memory_order_relaxed);
+  };
+
+private:
+  cring_queue(const cring_queue &ring);
+
+  cring_queue &operator=(const cring_queue &ring);
+
+public:
+  /**
+   * @brief	Appends value, returns false if the ring is full
+   */
+  bool push(const T &value) {
+    size_t pos = enqueue_pos.load(std::memory_order_relaxed);
+    ccell *cell;
+    while (true) {
+      cell = &cells[pos & mask];
+      size_t seq = cell->sequence.load(std::memory_order_acquire);
+      intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+      if (0 == diff) {
+        if (enqueue_pos.compare_exchange_weak(pos, pos + 1,
+                                              std::memory_order_relaxed))
+          break;
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = enqueue_pos.load(std::memory_order_relaxed);
+      }
+    }
+    cell->value = value;
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  };
+
+  /**
+   * @brief	Removes first value, returns false if none available
+   */
+  bool pop(T &value) {
+    size_t pos = dequeue_pos.load(std::memory_order_relaxed);
+    ccell *cell;
+    while (true) {
+      cell = &cells[pos & mask];
+      size_t seq = cell->sequence.load(std::memory_order_acquire);
+      intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+      if (0 == diff) {
+        if (dequeue_pos.compare_exchange_weak(pos, pos + 1,
+                                              std::memory_order_relaxed))
+          break;
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = dequeue_pos.load(std::memory_order_relaxed);
+      }
+    }
+    value = cell->value;
+    cell->sequence.store(pos + mask + 1, std::memory_order_release);
+    return true;
+  };
+
+  /**
+   * @brief	Copies first value without removing it
+   *
+   * Only meaningful while no other thread calls pop().
+   */
+  bool peek(T &value) const {
+    size_t pos = dequeue_pos.load(std::memory_order_relaxed);
+    const ccell *cell = &cells[pos & mask];
+    if (cell->sequence.load(std::memory_order_acquire) != pos + 1)
+      return false;
+    value = cell->value;
+    return true;
+  };
+
+  /**
+   * @brief	Returns true if no cell is occupied or claimed by a producer
+   */
+  bool empty() const {
+    return (enqueue_pos.load(std::memory_order_acquire) ==
+            dequeue_pos.load(std::memory_order_acquire));
+  };
+
+  /**
+   * @brief	Returns number of cells
+   */
+  size_t capacity() const { return mask + 1; };
+
+private:
+  size_t mask;
+  ccell *cells;
+  char pad0[64];
+  std::atomic<size_t> enqueue_pos;
+  char pad1[64 - sizeof(std::atomic<size_t>)];
+  std::atomic<size_t> dequeue_pos;
+  char pad2[64 - sizeof(std::atomic<size_t>)];
+};
+
+}; // end of namespace rofl
+
+#endif /* SRC_ROFL_COMMON_CRING_QUEUE_HPP_ */
@@ -39,8 +39,10 @@ crofbase::~crofbase() {
   }
 }
 
-crofbase::crofbase()
-    : thread(this), generation_is_defined(false),
+crofbase::crofbase(unsigned int num_threads, cthread_engine_t engine,
+                   const cthread_affinity &affinity)
+    : thread_pool(num_threads, "crofbase", engine, affinity),
+      thread(this, &thread_pool), generation_is_defined(false),
       cached_generation_id((uint64_t)((int64_t)-1)), enforce_tls(false) {
   AcquireReadWriteLock rwlock(rofbases_rwlock);
   if (crofbase::rofbases.empty()) {
@@ -277,25 +279,39 @@ void crofbase::handle_wakeup(cthread &thread) {}
 void crofbase::handle_timeout(cthread &thread, uint32_t timer_id) {
   switch (timer_id) {
   case TIMER_ID_ROFCTL_DESTROY: {
-    AcquireReadWriteLock rwlock(rofctls_rwlock);
-    /* iterate over all crofctl pointers on the heap marked for destruction */
-    for (auto ctl : rofctls_deletion) {
-      delete ctl;
-    }
+    /* destroy all crofctl instances marked for destruction */
     rofctls_deletion.clear();
   } break;
   case TIMER_ID_ROFDPT_DESTROY: {
-    AcquireReadWriteLock rwlock(rofdpts_rwlock);
-    /* iterate over all crofdpt pointers on the heap marked for destruction */
-    for (auto dpt : rofdpts_deletion) {
-      delete dpt;
-    }
+    /* destroy all crofdpt instances marked for destruction */
     rofdpts_deletion.clear();
   } break;
   default: {};
   }
 }
 
+void crofbase::schedule_dpt_deletion(crofdpt *dpt) {
+  /* instances still owned by a discarded task are destroyed along with it */
+  std::shared_ptr<crofdpt> ptr(dpt);
+  thread.post([this, ptr]() {
+    rofdpts_deletion.push_back(ptr);
+    if (not thread.has_timer(TIMER_ID_ROFDPT_DESTROY)) {
+      thread.add_timer(TIMER_ID_ROFDPT_DESTROY, ctimespec().expire_in(8));
+    }
+  });
+}
+
+void crofbase::schedule_ctl_deletion(crofctl *ctl) {
+  /* instances still owned by a discarded task are destroyed along with it */
+  std::shared_ptr<crofctl> ptr(ctl);
+  thread.post([this, ptr]() {
+    rofctls_deletion.push_back(ptr);
+    if (not thread.has_timer(TIMER_ID_ROFCTL_DESTROY)) {
+      thread.add_timer(TIMER_ID_ROFCTL_DESTROY, ctimespec().expire_in(8));
+    }
+  });
+}
+
 void crofbase::handle_read_event(cthread &thread, int fd) {
   std::map<csockaddr, int>::iterator it;
 
@@ -324,7 +340,8 @@ void crofbase::handle_read_event(cthread &thread, int fd) {
         }
 
         if (enforce_tls) {
-          (new crofconn(this))
+          (new crofconn(this, &thread_pool,
+                        thread_pool.select_reactor(sockfd)))
               ->set_tls_capath(capath)
               .set_tls_cafile(cafile)
               .set_tls_certfile(certfile)
@@ -335,7 +352,8 @@ void crofbase::handle_read_event(cthread &thread, int fd) {
               .set_tls_ciphers(ciphers)
               .tls_accept(sockfd, versionbitmap, crofconn::MODE_CONTROLLER);
         } else {
-          (new crofconn(this))
+          (new crofconn(this, &thread_pool,
+                        thread_pool.select_reactor(sockfd)))
               ->tcp_accept(sockfd, versionbitmap, crofconn::MODE_CONTROLLER);
         }
       }
@@ -367,7 +385,8 @@ void crofbase::handle_read_event(cthread &thread, int fd) {
         }
 
         if (enforce_tls) {
-          (new crofconn(this))
+          (new crofconn(this, &thread_pool,
+                        thread_pool.select_reactor(sockfd)))
               ->set_tls_capath(capath)
               .set_tls_cafile(cafile)
               .set_tls_certfile(certfile)
@@ -378,7 +397,8 @@ void crofbase::handle_read_event(cthread &thread, int fd) {
               .set_tls_ciphers(ciphers)
               .tls_accept(sockfd, versionbitmap, crofconn::MODE_DATAPATH);
         } else {
-          (new crofconn(this))
+          (new crofconn(this, &thread_pool,
+                        thread_pool.select_reactor(sockfd)))
               ->tcp_accept(sockfd, versionbitmap, crofconn::MODE_DATAPATH);
         }
       }
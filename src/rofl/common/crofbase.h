@@ -14,6 +14,8 @@
 #define CROFBASE_H 1
 
 #include <glog/logging.h>
+#include <list>
+#include <memory>
 #include <vector>
 
 #include "rofl/common/exception.hpp"
@@ -23,6 +25,7 @@
 #include "rofl/common/crofctl.h"
 #include "rofl/common/crofdpt.h"
 #include "rofl/common/cthread.hpp"
+#include "rofl/common/cthread_pool.hpp"
 #include "rofl/common/openflow/cofhelloelemversionbitmap.h"
 #include "rofl/common/openflow/openflow.h"
 
@@ -60,8 +63,38 @@ public:
 
   /**
    * @brief	crofbase constructor
+   *
+   * All crofdpt and crofctl instances and their connections are served
+   * by a shared pool of reactor threads.
+   *
+   * @param num_threads number of reactor threads, 0: number of online cores
+   * @param engine I/O engine of reactor threads, ENGINE_IO_URING falls back
+   * to ENGINE_EPOLL when io_uring is not available
+   * @param affinity cpu placement of reactor threads, AFFINITY_RX_QUEUE
+   * places accepted connections on the reactor thread next to their RX queue
+   */
+  crofbase(unsigned int num_threads = 0,
+           cthread_engine_t engine = ENGINE_EPOLL,
+           const cthread_affinity &affinity = cthread_affinity());
+
+public:
+  /**
+   * @brief	Returns reactor thread pool of this crofbase instance
+   */
+  cthread_pool &get_thread_pool() { return thread_pool; };
+
+  /**
+   * @brief	Enables or disables event loop metrics on all reactor threads
+   */
+  crofbase &set_instrumentation(bool enable) {
+    thread_pool.set_instrumentation(enable);
+    return *this;
+  };
+
+  /**
+   * @brief	Returns event loop metrics aggregated over all reactor threads
    */
-  crofbase();
+  cloop_stats get_loop_stats() const { return thread_pool.get_loop_stats(); };
 
 public:
   /**
@@ -354,12 +387,9 @@ public:
       it.second->clear();
       VLOG(2) << __FUNCTION__
               << " datapath detached dptid=" << it.second->get_dptid();
-      rofdpts_deletion.insert(it.second);
+      schedule_dpt_deletion(it.second);
     }
     rofdpts.clear();
-    if (not thread.has_timer(TIMER_ID_ROFDPT_DESTROY)) {
-      thread.add_timer(TIMER_ID_ROFDPT_DESTROY, ctimespec().expire_in(8));
-    }
   };
 
   /**
@@ -389,7 +419,7 @@ public:
     while (rofdpts.find(id) != rofdpts.end()) {
       id++;
     }
-    rofdpts[id] = new crofdpt(this, id);
+    rofdpts[id] = new crofdpt(this, id, &thread_pool);
     return *(rofdpts[id]);
   };
 
@@ -420,7 +450,7 @@ public:
       delete rofdpts[dptid];
       rofdpts.erase(dptid);
     }
-    rofdpts[dptid] = new crofdpt(this, dptid);
+    rofdpts[dptid] = new crofdpt(this, dptid, &thread_pool);
     return *(rofdpts[dptid]);
   };
 
@@ -443,7 +473,7 @@ public:
     if (rofdpts.find(dptid) == rofdpts.end()) {
       if (raise)
         throw eRofBaseNotFound("rofl::crofbase::set_dpt() dptid not found");
-      rofdpts[dptid] = new crofdpt(this, dptid);
+      rofdpts[dptid] = new crofdpt(this, dptid, &thread_pool);
     }
     return *(rofdpts[dptid]);
   };
@@ -482,14 +512,10 @@ public:
     rofdpts[dptid]->set_env(nullptr);
     /* close control channel */
     rofdpts[dptid]->clear();
-    /* add pointer to crofdpt instance on heap to rofdpts_deletion */
-    rofdpts_deletion.insert(rofdpts[dptid]);
+    /* hand over crofdpt instance to management thread for clean-up */
+    schedule_dpt_deletion(rofdpts[dptid]);
     /* mark its dptid as free */
     rofdpts.erase(dptid);
-    /* trigger management thread for doing the clean-up work */
-    if (not thread.has_timer(TIMER_ID_ROFDPT_DESTROY)) {
-      thread.add_timer(TIMER_ID_ROFDPT_DESTROY, ctimespec().expire_in(8));
-    }
     return true;
   };
 
@@ -536,7 +562,7 @@ public:
     while (rofdpts.find(id) != rofdpts.end()) {
       id++;
     }
-    rofdpts[id] = new crofdpt(this, id);
+    rofdpts[id] = new crofdpt(this, id, &thread_pool);
     return *(rofdpts[id]);
   };
 
@@ -590,12 +616,9 @@ public:
       it.second->clear();
       VLOG(2) << __FUNCTION__
               << " controller detached ctlid=" << it.second->get_ctlid().str();
-      rofctls_deletion.insert(it.second);
+      schedule_ctl_deletion(it.second);
     }
     rofctls.clear();
-    if (not thread.has_timer(TIMER_ID_ROFCTL_DESTROY)) {
-      thread.add_timer(TIMER_ID_ROFCTL_DESTROY, ctimespec().expire_in(8));
-    }
   };
 
   /**
@@ -624,7 +647,7 @@ public:
     while (rofctls.find(cctlid(id)) != rofctls.end()) {
       id++;
     }
-    rofctls[cctlid(id)] = new crofctl(this, cctlid(id));
+    rofctls[cctlid(id)] = new crofctl(this, cctlid(id), &thread_pool);
     return *(rofctls[cctlid(id)]);
   };
 
@@ -655,7 +678,7 @@ public:
       delete rofctls[ctlid];
       rofctls.erase(ctlid);
     }
-    rofctls[ctlid] = new crofctl(this, ctlid);
+    rofctls[ctlid] = new crofctl(this, ctlid, &thread_pool);
     return *(rofctls[ctlid]);
   };
 
@@ -678,7 +701,7 @@ public:
     if (rofctls.find(ctlid) == rofctls.end()) {
       if (raise)
         throw eRofBaseNotFound("rofl::crofbase::set_ctl() ctlid not found");
-      rofctls[ctlid] = new crofctl(this, ctlid);
+      rofctls[ctlid] = new crofctl(this, ctlid, &thread_pool);
     }
     return *(rofctls[ctlid]);
   };
@@ -717,14 +740,10 @@ public:
     rofctls[ctlid]->set_env(nullptr);
     /* close control channel */
     rofctls[ctlid]->clear();
-    /* add pointer to crofctl instance on heap to rofctls_deletion */
-    rofctls_deletion.insert(rofctls[ctlid]);
+    /* hand over crofctl instance to management thread for clean-up */
+    schedule_ctl_deletion(rofctls[ctlid]);
     /* mark its ctlid as free */
     rofctls.erase(ctlid);
-    /* trigger management thread for doing the clean-up work */
-    if (not thread.has_timer(TIMER_ID_ROFCTL_DESTROY)) {
-      thread.add_timer(TIMER_ID_ROFCTL_DESTROY, ctimespec().expire_in(8));
-    }
     return true;
   };
 
@@ -1589,6 +1608,21 @@ public:
   virtual void handle_packet_in(rofl::crofdpt &dpt, const rofl::cauxid &auxid,
                                 rofl::openflow::cofmsg_packet_in &msg){};
 
+  /**
+   * @brief	OpenFlow message received as view, see crofdpt::set_rx_view().
+   *
+   * The view may be copied for use beyond this call.
+   *
+   * @param dpt datapath instance
+   * @param auxid control connection identifier
+   * @param view view of OpenFlow message in receive buffer
+   * @return false for receiving the message via its specific handler
+   */
+  virtual bool handle_recv_view(rofl::crofdpt &dpt, const rofl::cauxid &auxid,
+                                const rofl::openflow::cofmsg_view &view) {
+    return false;
+  };
+
   /**
    * @brief	OpenFlow Barrier-Reply message received.
    *
@@ -1974,6 +2008,21 @@ public:
   virtual void handle_packet_out(rofl::crofctl &ctl, const rofl::cauxid &auxid,
                                  rofl::openflow::cofmsg_packet_out &msg){};
 
+  /**
+   * @brief	OpenFlow message received as view, see crofctl::set_rx_view().
+   *
+   * The view may be copied for use beyond this call.
+   *
+   * @param ctl controller instance
+   * @param auxid control connection identifier
+   * @param view view of OpenFlow message in receive buffer
+   * @return false for receiving the message via its specific handler
+   */
+  virtual bool handle_recv_view(rofl::crofctl &ctl, const rofl::cauxid &auxid,
+                                const rofl::openflow::cofmsg_view &view) {
+    return false;
+  };
+
   /**
    * @brief	OpenFlow Barrier-Request message received.
    *
@@ -2262,12 +2311,31 @@ private:
     rofctls.clear();
   };
 
+  /**
+   * @brief	Hands a detached rofl::crofdpt instance over to management thread
+   *
+   * The instance is destroyed after a grace period for callbacks still in
+   * progress.
+   */
+  void schedule_dpt_deletion(crofdpt *dpt);
+
+  /**
+   * @brief	Hands a detached rofl::crofctl instance over to management thread
+   *
+   * The instance is destroyed after a grace period for callbacks still in
+   * progress.
+   */
+  void schedule_ctl_deletion(crofctl *ctl);
+
 private:
   enum crofbase_timer_t {
     TIMER_ID_ROFCTL_DESTROY = 1,
     TIMER_ID_ROFDPT_DESTROY = 2,
   };
 
+  // reactor threads shared by all connections
+  cthread_pool thread_pool;
+
   // management thread
   cthread thread;
 
@@ -2287,11 +2355,11 @@ private:
    *
    */
 
-  // set of crofctl ids scheduled for deletion
-  std::set<crofctl *> rofctls_deletion;
+  // crofctl instances scheduled for deletion, owned by management thread
+  std::list<std::shared_ptr<crofctl>> rofctls_deletion;
 
-  // set of crofdpt ids scheduled for deletion
-  std::set<crofdpt *> rofdpts_deletion;
+  // crofdpt instances scheduled for deletion, owned by management thread
+  std::list<std::shared_ptr<crofdpt>> rofdpts_deletion;
 
   /*
    *
@@ -0,0 +1,338 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/*
+ * crofbuilder.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "rofl/common/crofbuilder.hpp"
+
+#include <glog/logging.h>
+
+using namespace rofl;
+
+crofbuilder::crofbuilder(rofl::crofchan *chan, const rofl::cauxid &auxid,
+                         uint8_t version, uint8_t type, uint32_t xid,
+                         size_t msglen)
+    : chan(chan), auxid(auxid), version(version), xid(xid),
+      frame(new crofframe()), has_timeout(false), ignored(false) {
+  frame->append(msglen);
+  struct rofl::openflow::ofp_header *hdr =
+      (struct rofl::openflow::ofp_header *)frame->at(0);
+  hdr->version = version;
+  hdr->type = type;
+  hdr->xid = htobe32(xid);
+}
+
+crofbuilder::crofbuilder(rofl::crofchan *chan, const rofl::cauxid &auxid,
+                         uint32_t xid, const uint8_t *buf, size_t buflen)
+    : chan(chan), auxid(auxid), version(buf[0]), xid(xid),
+      frame(new crofframe()), has_timeout(false), ignored(false) {
+  frame->append(buf, buflen);
+  ((struct rofl::openflow::ofp_header *)frame->at(0))->xid = htobe32(xid);
+}
+
+crofbuilder::crofbuilder(crofbuilder &&builder)
+    : chan(builder.chan), auxid(builder.auxid), version(builder.version),
+      xid(builder.xid), frame(builder.frame),
+      has_timeout(builder.has_timeout), timeout(builder.timeout),
+      ignored(builder.ignored) {
+  builder.frame = nullptr;
+}
+
+rofl::crofframe *crofbuilder::release() {
+  finalize();
+  crofframe *frame = &get_frame();
+  struct rofl::openflow::ofp_header *hdr =
+      (struct rofl::openflow::ofp_header *)frame->at(0);
+  hdr->length = htobe16(frame->length());
+  this->frame = nullptr;
+  return frame;
+}
+
+rofl::crofsock::msg_result_t crofbuilder::commit() {
+  crofframe *frame = release();
+
+  if (ignored) {
+    delete frame;
+    return rofl::crofsock::MSG_IGNORED;
+  }
+
+  try {
+    if (nullptr == chan) {
+      throw eRofConnNotConnected("crofbuilder::commit() no channel");
+    }
+    if (has_timeout) {
+      return chan->send_frame(auxid, frame, timeout);
+    }
+    return chan->send_frame(auxid, frame);
+
+  } catch (eRofConnNotConnected &e) {
+    VLOG(1) << __FUNCTION__ << " dropping message " << e.what();
+    delete frame;
+    throw;
+  }
+}
+
+void crofbuilder::append_output(uint32_t port_no, uint16_t max_len) {
+  size_t offset =
+      get_frame().append(sizeof(struct rofl::openflow13::ofp_action_output));
+  struct rofl::openflow13::ofp_action_output *action =
+      get<rofl::openflow13::ofp_action_output>(offset);
+  action->type = htobe16(rofl::openflow13::OFPAT_OUTPUT);
+  action->len = htobe16(sizeof(struct rofl::openflow13::ofp_action_output));
+  action->port = htobe32(port_no);
+  action->max_len = htobe16(max_len);
+}
+
+void crofbuilder::append_group(uint32_t group_id) {
+  size_t offset =
+      get_frame().append(sizeof(struct rofl::openflow13::ofp_action_group));
+  struct rofl::openflow13::ofp_action_group *action =
+      get<rofl::openflow13::ofp_action_group>(offset);
+  action->type = htobe16(rofl::openflow13::OFPAT_GROUP);
+  action->len = htobe16(sizeof(struct rofl::openflow13::ofp_action_group));
+  action->group_id = htobe32(group_id);
+}
+
+void crofbuilder::append_set_queue(uint32_t queue_id) {
+  size_t offset =
+      get_frame().append(sizeof(struct rofl::openflow13::ofp_action_set_queue));
+  struct rofl::openflow13::ofp_action_set_queue *action =
+      get<rofl::openflow13::ofp_action_set_queue>(offset);
+  action->type = htobe16(rofl::openflow13::OFPAT_SET_QUEUE);
+  action->len = htobe16(sizeof(struct rofl::openflow13::ofp_action_set_queue));
+  action->queue_id = htobe32(queue_id);
+}
+
+void crofbuilder::append_push_vlan(uint16_t eth_type) {
+  size_t offset =
+      get_frame().append(sizeof(struct rofl::openflow13::ofp_action_push));
+  struct rofl::openflow13::ofp_action_push *action =
+      get<rofl::openflow13::ofp_action_push>(offset);
+  action->type = htobe16(rofl::openflow13::OFPAT_PUSH_VLAN);
+  action->len = htobe16(sizeof(struct rofl::openflow13::ofp_action_push));
+  action->ethertype = htobe16(eth_type);
+}
+
+void crofbuilder::append_pop_vlan() {
+  size_t offset =
+      get_frame().append(sizeof(struct rofl::openflow13::ofp_action_header));
+  struct rofl::openflow13::ofp_action_header *action =
+      get<rofl::openflow13::ofp_action_header>(offset);
+  action->type = htobe16(rofl::openflow13::OFPAT_POP_VLAN);
+  action->len = htobe16(sizeof(struct rofl::openflow13::ofp_action_header));
+}
+
+void crofbuilder::append_action(const rofl::openflow::cofaction &action) {
+  size_t actionlen = action.length();
+  size_t offset = get_frame().append(actionlen);
+  // pack() does not modify the action, it just lacks a const qualifier
+  const_cast<rofl::openflow::cofaction &>(action).pack(get<uint8_t>(offset),
+                                                       actionlen);
+}
+
+crofbuilder_flow_mod::crofbuilder_flow_mod(rofl::crofchan *chan,
+                                           const rofl::cauxid &auxid,
+                                           uint8_t version, uint32_t xid)
+    : crofbuilder_match<crofbuilder_flow_mod>(
+          chan, auxid, version, rofl::openflow13::OFPT_FLOW_MOD, xid,
+          sizeof(struct rofl::openflow13::ofp_flow_mod) -
+              sizeof(struct rofl::openflow13::ofp_match)),
+      inst_offset(0), inst_type(0) {
+  switch (version) {
+  case rofl::openflow12::OFP_VERSION:
+  case rofl::openflow13::OFP_VERSION: {
+    struct rofl::openflow13::ofp_flow_mod *hdr =
+        get<rofl::openflow13::ofp_flow_mod>(0);
+    hdr->buffer_id = htobe32(rofl::openflow13::OFP_NO_BUFFER);
+    hdr->out_port = htobe32(rofl::openflow13::OFPP_ANY);
+    hdr->out_group = htobe32(rofl::openflow13::OFPG_ANY);
+  } break;
+  default: {
+    throw eBadVersion("crofbuilder_flow_mod() unsupported version", __FILE__,
+                      __FUNCTION__, __LINE__);
+  };
+  }
+}
+
+crofbuilder_flow_mod &crofbuilder_flow_mod::clear_actions() {
+  close_actions();
+  size_t offset = get_frame().append(
+      sizeof(struct rofl::openflow13::ofp_instruction_actions));
+  struct rofl::openflow13::ofp_instruction_actions *inst =
+      get<rofl::openflow13::ofp_instruction_actions>(offset);
+  inst->type = htobe16(rofl::openflow13::OFPIT_CLEAR_ACTIONS);
+  inst->len = htobe16(sizeof(struct rofl::openflow13::ofp_instruction_actions));
+  return *this;
+}
+
+crofbuilder_flow_mod &crofbuilder_flow_mod::goto_table(uint8_t table_id) {
+  close_actions();
+  size_t offset = get_frame().append(
+      sizeof(struct rofl::openflow13::ofp_instruction_goto_table));
+  struct rofl::openflow13::ofp_instruction_goto_table *inst =
+      get<rofl::openflow13::ofp_instruction_goto_table>(offset);
+  inst->type = htobe16(rofl::openflow13::OFPIT_GOTO_TABLE);
+  inst->len =
+      htobe16(sizeof(struct rofl::openflow13::ofp_instruction_goto_table));
+  inst->table_id = table_id;
+  return *this;
+}
+
+crofbuilder_flow_mod &
+crofbuilder_flow_mod::write_metadata(uint64_t metadata,
+                                     uint64_t metadata_mask) {
+  close_actions();
+  size_t offset = get_frame().append(
+      sizeof(struct rofl::openflow13::ofp_instruction_write_metadata));
+  struct rofl::openflow13::ofp_instruction_write_metadata *inst =
+      get<rofl::openflow13::ofp_instruction_write_metadata>(offset);
+  inst->type = htobe16(rofl::openflow13::OFPIT_WRITE_METADATA);
+  inst->len =
+      htobe16(sizeof(struct rofl::openflow13::ofp_instruction_write_metadata));
+  inst->metadata = htobe64(metadata);
+  inst->metadata_mask = htobe64(metadata_mask);
+  return *this;
+}
+
+crofbuilder_flow_mod &crofbuilder_flow_mod::meter(uint32_t meter_id) {
+  if (get_version() < rofl::openflow13::OFP_VERSION) {
+    throw eBadVersion("crofbuilder_flow_mod::meter() unsupported version",
+                      __FILE__, __FUNCTION__, __LINE__);
+  }
+  close_actions();
+  size_t offset = get_frame().append(
+      sizeof(struct rofl::openflow13::ofp_instruction_meter));
+  struct rofl::openflow13::ofp_instruction_meter *inst =
+      get<rofl::openflow13::ofp_instruction_meter>(offset);
+  inst->type = htobe16(rofl::openflow13::OFPIT_METER);
+  inst->len = htobe16(sizeof(struct rofl::openflow13::ofp_instruction_meter));
+  inst->meter_id = htobe32(meter_id);
+  return *this;
+}
+
+void crofbuilder_flow_mod::finalize() { close_actions(); }
+
+void crofbuilder_flow_mod::open_actions(uint16_t type) {
+  if ((inst_offset > 0) && (inst_type == type))
+    return;
+  close_actions();
+  inst_offset = get_frame().append(
+      sizeof(struct rofl::openflow13::ofp_instruction_actions));
+  inst_type = type;
+  get<rofl::openflow13::ofp_instruction_actions>(inst_offset)->type =
+      htobe16(type);
+}
+
+void crofbuilder_flow_mod::close_actions() {
+  close_match();
+  if (0 == inst_offset)
+    return;
+  get<rofl::openflow13::ofp_instruction_actions>(inst_offset)->len =
+      htobe16(get_frame().length() - inst_offset);
+  inst_offset = 0;
+}
+
+crofbuilder_packet_out::crofbuilder_packet_out(rofl::crofchan *chan,
+                                               const rofl::cauxid &auxid,
+                                               uint8_t version, uint32_t xid)
+    : crofbuilder(chan, auxid, version, rofl::openflow13::OFPT_PACKET_OUT, xid,
+                  sizeof(struct rofl::openflow13::ofp_packet_out)),
+      actions_closed(false) {
+  switch (version) {
+  case rofl::openflow12::OFP_VERSION:
+  case rofl::openflow13::OFP_VERSION: {
+    struct rofl::openflow13::ofp_packet_out *hdr =
+        get<rofl::openflow13::ofp_packet_out>(0);
+    hdr->buffer_id = htobe32(rofl::openflow13::OFP_NO_BUFFER);
+    hdr->in_port = htobe32(rofl::openflow13::OFPP_CONTROLLER);
+  } break;
+  default: {
+    throw eBadVersion("crofbuilder_packet_out() unsupported version", __FILE__,
+                      __FUNCTION__, __LINE__);
+  };
+  }
+}
+
+crofbuilder_packet_out &crofbuilder_packet_out::data(const uint8_t *data,
+                                                     size_t datalen) {
+  close_actions();
+  get_frame().append(data, datalen);
+  return *this;
+}
+
+void crofbuilder_packet_out::close_actions() {
+  if (actions_closed)
+    return;
+  get<rofl::openflow13::ofp_packet_out>(0)->actions_len =
+      htobe16(get_frame().length() -
+              sizeof(struct rofl::openflow13::ofp_packet_out));
+  actions_closed = true;
+}
+
+static size_t packet_in_match_offset(uint8_t version) {
+  switch (version) {
+  case rofl::openflow12::OFP_VERSION: {
+    return sizeof(struct rofl::openflow12::ofp_packet_in) -
+           sizeof(struct rofl::openflow12::ofp_match);
+  } break;
+  case rofl::openflow13::OFP_VERSION: {
+    return sizeof(struct rofl::openflow13::ofp_packet_in) -
+           sizeof(struct rofl::openflow13::ofp_match);
+  } break;
+  default: {
+    throw eBadVersion("crofbuilder_packet_in() unsupported version", __FILE__,
+                      __FUNCTION__, __LINE__);
+  };
+  }
+}
+
+crofbuilder_packet_in::crofbuilder_packet_in(rofl::crofchan *chan,
+                                             const rofl::cauxid &auxid,
+                                             uint8_t version, uint32_t xid)
+    : crofbuilder_match<crofbuilder_packet_in>(
+          chan, auxid, version, rofl::openflow13::OFPT_PACKET_IN, xid,
+          packet_in_match_offset(version)) {
+  get<rofl::openflow13::ofp_packet_in>(0)->buffer_id =
+      htobe32(rofl::openflow13::OFP_NO_BUFFER);
+}
+
+crofbuilder_packet_in &crofbuilder_packet_in::data(const uint8_t *data,
+                                                   size_t datalen) {
+  close_match();
+  get_frame().append(2); // align IP header to 32 bits
+  get_frame().append(data, datalen);
+  return *this;
+}
+
+static uint8_t barrier_type(uint8_t version, bool request) {
+  switch (version) {
+  case rofl::openflow10::OFP_VERSION: {
+    return request ? rofl::openflow10::OFPT_BARRIER_REQUEST
+                   : rofl::openflow10::OFPT_BARRIER_REPLY;
+  } break;
+  default: {
+    return request ? rofl::openflow13::OFPT_BARRIER_REQUEST
+                   : rofl::openflow13::OFPT_BARRIER_REPLY;
+  };
+  }
+}
+
+crofbuilder_barrier_request::crofbuilder_barrier_request(
+    rofl::crofchan *chan, const rofl::cauxid &auxid, uint8_t version,
+    uint32_t xid, const rofl::ctimespec &ts)
+    : crofbuilder(chan, auxid, version, barrier_type(version, true), xid,
+                  sizeof(struct rofl::openflow::ofp_header)) {
+  set_timeout(ts);
+}
+
+crofbuilder_barrier_reply::crofbuilder_barrier_reply(rofl::crofchan *chan,
+                                                     const rofl::cauxid &auxid,
+                                                     uint8_t version,
+                                                     uint32_t xid)
+    : crofbuilder(chan, auxid, version, barrier_type(version, false), xid,
+                  sizeof(struct rofl::openflow::ofp_header)) {}
@@ -0,0 +1,680 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/*
+ * crofbuilder.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef SRC_ROFL_COMMON_CROFBUILDER_HPP_
+#define SRC_ROFL_COMMON_CROFBUILDER_HPP_
+
+#include <endian.h>
+#include <string.h>
+
+#include "rofl/common/caddress.h"
+#include "rofl/common/cauxid.h"
+#include "rofl/common/crofchan.h"
+#include "rofl/common/crofframe.hpp"
+#include "rofl/common/ctimespec.hpp"
+#include "rofl/common/exception.hpp"
+#include "rofl/common/openflow/cofaction.h"
+#include "rofl/common/openflow/coxmatch.h"
+#include "rofl/common/openflow/openflow_rofl_exceptions.h"
+
+namespace rofl {
+
+class eRofBuilderBase : public exception {
+public:
+  eRofBuilderBase(const std::string &__arg,
+                  const std::string &__file = std::string(""),
+                  const std::string &__func = std::string(""), int __line = 0)
+      : exception(__arg, __file, __func, __line){};
+};
+class eRofBuilderInvalid : public eRofBuilderBase {
+public:
+  eRofBuilderInvalid(const std::string &__arg,
+                     const std::string &__file = std::string(""),
+                     const std::string &__func = std::string(""),
+                     int __line = 0)
+      : eRofBuilderBase(__arg, __file, __func, __line){};
+};
+
+/**
+ * @brief	Writes an OpenFlow message directly in wire format
+ *
+ * A builder fills a crofframe field by field, no cofmsg instance is
+ * allocated. Calling commit() hands the frame over to the channel, where
+ * it is queued in the same per-class tx queue as the equivalent cofmsg,
+ * so ordering, scheduling and congestion results are unchanged. Builders
+ * are obtained from crofdpt::build_*() or crofctl::build_*() and are used
+ * once, an uncommitted frame is dropped on destruction.
+ */
+class crofbuilder {
+public:
+  /**
+   *
+   */
+  virtual ~crofbuilder() { delete frame; };
+
+  /**
+   *
+   */
+  crofbuilder(crofbuilder &&builder);
+
+public:
+  /**
+   * @brief	Sends the frame via the channel
+   *
+   * @throws eRofConnNotConnected connection not established
+   */
+  rofl::crofsock::msg_result_t commit();
+
+  /**
+   * @brief	Finalizes and returns the frame without sending it, owned by
+   * caller
+   */
+  rofl::crofframe *release();
+
+  /**
+   *
+   */
+  uint32_t get_xid() const { return xid; };
+
+  /**
+   *
+   */
+  uint8_t get_version() const { return version; };
+
+  /**
+   * @brief	commit() drops the frame and returns MSG_IGNORED
+   */
+  void set_ignored() { ignored = true; };
+
+protected:
+  /**
+   * @brief	Creates a frame with an OpenFlow header and msglen bytes total
+   *
+   * @param chan channel for commit() or nullptr
+   */
+  crofbuilder(rofl::crofchan *chan, const rofl::cauxid &auxid,
+              uint8_t version, uint8_t type, uint32_t xid, size_t msglen);
+
+  /**
+   * @brief	Creates a frame as copy of a packed message and sets its xid
+   */
+  crofbuilder(rofl::crofchan *chan, const rofl::cauxid &auxid, uint32_t xid,
+              const uint8_t *buf, size_t buflen);
+
+  /**
+   * @brief	Closes open variable-length parts, called once before sending
+   */
+  virtual void finalize(){};
+
+  /**
+   * @throws eRofBuilderInvalid frame was already committed or released
+   */
+  rofl::crofframe &get_frame() {
+    if (nullptr == frame) {
+      throw eRofBuilderInvalid("crofbuilder::get_frame() frame already sent",
+                               __FILE__, __FUNCTION__, __LINE__);
+    }
+    return *frame;
+  };
+
+  /**
+   * @brief	Returns pointer into frame, invalidated by subsequent appends
+   */
+  template <typename T> T *get(size_t offset) {
+    return (T *)get_frame().at(offset);
+  };
+
+  /**
+   * @brief	Registers a transaction timeout for request messages
+   */
+  void set_timeout(const rofl::ctimespec &ts) {
+    has_timeout = true;
+    timeout = ts;
+  };
+
+protected:
+  void append_output(uint32_t port_no, uint16_t max_len);
+
+  void append_group(uint32_t group_id);
+
+  void append_set_queue(uint32_t queue_id);
+
+  void append_push_vlan(uint16_t eth_type);
+
+  void append_pop_vlan();
+
+  void append_action(const rofl::openflow::cofaction &action);
+
+private:
+  crofbuilder(const crofbuilder &builder);
+
+  crofbuilder &operator=(const crofbuilder &builder);
+
+private:
+  rofl::crofchan *chan;
+  rofl::cauxid auxid;
+  uint8_t version;
+  uint32_t xid;
+  rofl::crofframe *frame;
+  bool has_timeout;
+  rofl::ctimespec timeout;
+  bool ignored;
+};
+
+/**
+ * @brief	OXM match list at a fixed offset, shared by Flow-Mod and Packet-In
+ *
+ * Match fields must be added before any part following the match, the
+ * list is closed and padded to 64 bits by the derived builder.
+ */
+template <class T> class crofbuilder_match : public crofbuilder {
+public:
+  /**
+   *
+   */
+  T &match_in_port(uint32_t port_no) {
+    *get<uint32_t>(append_oxm(rofl::openflow::OXM_TLV_BASIC_IN_PORT)) =
+        htobe32(port_no);
+    return self();
+  };
+
+  /**
+   *
+   */
+  T &match_eth_dst(const rofl::caddress_ll &addr) {
+    memcpy(get<uint8_t>(append_oxm(rofl::openflow::OXM_TLV_BASIC_ETH_DST)),
+           addr.somem(), addr.length());
+    return self();
+  };
+
+  /**
+   *
+   */
+  T &match_eth_src(const rofl::caddress_ll &addr) {
+    memcpy(get<uint8_t>(append_oxm(rofl::openflow::OXM_TLV_BASIC_ETH_SRC)),
+           addr.somem(), addr.length());
+    return self();
+  };
+
+  /**
+   *
+   */
+  T &match_eth_type(uint16_t eth_type) {
+    *get<uint16_t>(append_oxm(rofl::openflow::OXM_TLV_BASIC_ETH_TYPE)) =
+        htobe16(eth_type);
+    return self();
+  };
+
+  /**
+   * @brief	Matches VLAN id, vid must include OFPVID_PRESENT if required
+   */
+  T &match_vlan_vid(uint16_t vid) {
+    *get<uint16_t>(append_oxm(rofl::openflow::OXM_TLV_BASIC_VLAN_VID)) =
+        htobe16(vid);
+    return self();
+  };
+
+  /**
+   *
+   */
+  T &match_ip_proto(uint8_t ip_proto) {
+    *get<uint8_t>(append_oxm(rofl::openflow::OXM_TLV_BASIC_IP_PROTO)) =
+        ip_proto;
+    return self();
+  };
+
+  /**
+   *
+   */
+  T &match_ipv4_src(const rofl::caddress_in4 &addr) {
+    *get<uint32_t>(append_oxm(rofl::openflow::OXM_TLV_BASIC_IPV4_SRC)) =
+        addr.get_addr_nbo();
+    return self();
+  };
+
+  /**
+   *
+   */
+  T &match_ipv4_dst(const rofl::caddress_in4 &addr) {
+    *get<uint32_t>(append_oxm(rofl::openflow::OXM_TLV_BASIC_IPV4_DST)) =
+        addr.get_addr_nbo();
+    return self();
+  };
+
+  /**
+   * @brief	Adds an arbitrary OXM, packed by the coxmatch instance
+   */
+  T &match(const rofl::openflow::coxmatch &oxm) {
+    size_t oxmlen = oxm.length();
+    size_t offset = append_match(oxmlen);
+    // pack() does not modify the OXM, it just lacks a const qualifier
+    const_cast<rofl::openflow::coxmatch &>(oxm).pack(get<uint8_t>(offset),
+                                                    oxmlen);
+    return self();
+  };
+
+protected:
+  /**
+   *
+   */
+  crofbuilder_match(rofl::crofchan *chan, const rofl::cauxid &auxid,
+                    uint8_t version, uint8_t type, uint32_t xid,
+                    size_t match_offset)
+      : crofbuilder(chan, auxid, version, type, xid,
+                    match_offset + 2 * sizeof(uint16_t)),
+        match_offset(match_offset), match_closed(false) {
+    *get<uint16_t>(match_offset) = htobe16(rofl::openflow13::OFPMT_OXM);
+  };
+
+  /**
+   * @brief	Sets ofp_match length and pads the list to 64 bits
+   */
+  void close_match() {
+    if (match_closed)
+      return;
+    size_t matchlen = get_frame().length() - match_offset;
+    *get<uint16_t>(match_offset + sizeof(uint16_t)) = htobe16(matchlen);
+    get_frame().append(((matchlen + 7) / 8) * 8 - matchlen);
+    match_closed = true;
+  };
+
+private:
+  T &self() { return static_cast<T &>(*this); };
+
+  size_t append_match(size_t oxmlen) {
+    if (match_closed) {
+      throw eRofBuilderInvalid("crofbuilder_match::match() match closed",
+                               __FILE__, __FUNCTION__, __LINE__);
+    }
+    return get_frame().append(oxmlen);
+  };
+
+  // returns offset of the OXM value
+  size_t append_oxm(uint32_t oxm_id) {
+    size_t offset = append_match(sizeof(uint32_t) + (oxm_id & 0xff));
+    *get<uint32_t>(offset) = htobe32(oxm_id);
+    return offset + sizeof(uint32_t);
+  };
+
+private:
+  size_t match_offset;
+  bool match_closed;
+};
+
+/**
+ * @brief	Flow-Mod builder (OFP 1.2 and beyond)
+ *
+ * Header fields may be set at any time. Match fields come first, the
+ * first instruction closes the match. Subsequent apply_*() or write_*()
+ * actions are appended to the same Apply-Actions or Write-Actions
+ * instruction as long as no other instruction is added in between.
+ */
+class crofbuilder_flow_mod : public crofbuilder_match<crofbuilder_flow_mod> {
+public:
+  /**
+   * @throws eBadVersion OFP 1.0 is not supported
+   */
+  crofbuilder_flow_mod(rofl::crofchan *chan, const rofl::cauxid &auxid,
+                       uint8_t version, uint32_t xid);
+
+public:
+  /**
+   *
+   */
+  crofbuilder_flow_mod &command(uint8_t command) {
+    get<rofl::openflow13::ofp_flow_mod>(0)->command = command;
+    return *this;
+  };
+
+  /**
+   *
+   */
+  crofbuilder_flow_mod &table(uint8_t table_id) {
+    get<rofl::openflow13::ofp_flow_mod>(0)->table_id = table_id;
+    return *this;
+  };
+
+  /**
+   *
+   */
+  crofbuilder_flow_mod &cookie(uint64_t cookie) {
+    get<rofl::openflow13::ofp_flow_mod>(0)->cookie = htobe64(cookie);
+    return *this;
+  };
+
+  /**
+   *
+   */
+  crofbuilder_flow_mod &cookie_mask(uint64_t cookie_mask) {
+    get<rofl::openflow13::ofp_flow_mod>(0)->cookie_mask = htobe64(cookie_mask);
+    return *this;
+  };
+
+  /**
+   *
+   */
+  crofbuilder_flow_mod &idle_timeout(uint16_t idle_timeout) {
+    get<rofl::openflow13::ofp_flow_mod>(0)->idle_timeout =
+        htobe16(idle_timeout);
+    return *this;
+  };
+
+  /**
+   *
+   */
+  crofbuilder_flow_mod &hard_timeout(uint16_t hard_timeout) {
+    get<rofl::openflow13::ofp_flow_mod>(0)->hard_timeout =
+        htobe16(hard_timeout);
+    return *this;
+  };
+
+  /**
+   *
+   */
+  crofbuilder_flow_mod &priority(uint16_t priority) {
+    get<rofl::openflow13::ofp_flow_mod>(0)->priority = htobe16(priority);
+    return *this;
+  };
+
+  /**
+   *
+   */
+  crofbuilder_flow_mod &buffer_id(uint32_t buffer_id) {
+    get<rofl::openflow13::ofp_flow_mod>(0)->buffer_id = htobe32(buffer_id);
+    return *this;
+  };
+
+  /**
+   *
+   */
+  crofbuilder_flow_mod &out_port(uint32_t out_port) {
+    get<rofl::openflow13::ofp_flow_mod>(0)->out_port = htobe32(out_port);
+    return *this;
+  };
+
+  /**
+   *
+   */
+  crofbuilder_flow_mod &out_group(uint32_t out_group) {
+    get<rofl::openflow13::ofp_flow_mod>(0)->out_group = htobe32(out_group);
+    return *this;
+  };
+
+  /**
+   *
+   */
+  crofbuilder_flow_mod &flags(uint16_t flags) {
+    get<rofl::openflow13::ofp_flow_mod>(0)->flags = htobe16(flags);
+    return *this;
+  };
+
+public:
+  /**
+   *
+   */
+  crofbuilder_flow_mod &apply_output(uint32_t port_no, uint16_t max_len = 128) {
+    open_actions(rofl::openflow13::OFPIT_APPLY_ACTIONS);
+    append_output(port_no, max_len);
+    return *this;
+  };
+
+  /**
+   *
+   */
+  crofbuilder_flow_mod &apply_group(uint32_t group_id) {
+    open_actions(rofl::openflow13::OFPIT_APPLY_ACTIONS);
+    append_group(group_id);
+    return *this;
+  };
+
+  /**
+   *
+   */
+  crofbuilder_flow_mod &apply_set_queue(uint32_t queue_id) {
+    open_actions(rofl::openflow13::OFPIT_APPLY_ACTIONS);
+    append_set_queue(queue_id);
+    return *this;
+  };
+
+  /**
+   *
+   */
+  crofbuilder_flow_mod &apply_push_vlan(uint16_t eth_type) {
+    open_actions(rofl::openflow13::OFPIT_APPLY_ACTIONS);
+    append_push_vlan(eth_type);
+    return *this;
+  };
+
+  /**
+   *
+   */
+  crofbuilder_flow_mod &apply_pop_vlan() {
+    open_actions(rofl::openflow13::OFPIT_APPLY_ACTIONS);
+    append_pop_vlan();
+    return *this;
+  };
+
+  /**
+   * @brief	Adds an arbitrary action to the Apply-Actions instruction
+   */
+  crofbuilder_flow_mod &apply_action(const rofl::openflow::cofaction &action) {
+    open_actions(rofl::openflow13::OFPIT_APPLY_ACTIONS);
+    append_action(action);
+    return *this;
+  };
+
+  /**
+   * @brief	Adds an arbitrary action to the Write-Actions instruction
+   */
+  crofbuilder_flow_mod &write_action(const rofl::openflow::cofaction &action) {
+    open_actions(rofl::openflow13::OFPIT_WRITE_ACTIONS);
+    append_action(action);
+    return *this;
+  };
+
+  /**
+   *
+   */
+  crofbuilder_flow_mod &clear_actions();
+
+  /**
+   *
+   */
+  crofbuilder_flow_mod &goto_table(uint8_t table_id);
+
+  /**
+   *
+   */
+  crofbuilder_flow_mod &write_metadata(uint64_t metadata,
+                                       uint64_t metadata_mask);
+
+  /**
+   * @throws eBadVersion meters require OFP 1.3
+   */
+  crofbuilder_flow_mod &meter(uint32_t meter_id);
+
+protected:
+  virtual void finalize();
+
+private:
+  // opens an actions instruction unless the last one is of this type
+  void open_actions(uint16_t type);
+
+  // closes match and any open actions instruction
+  void close_actions();
+
+private:
+  // offset of open actions instruction or 0
+  size_t inst_offset;
+  uint16_t inst_type;
+};
+
+/**
+ * @brief	Packet-Out builder (OFP 1.2 and beyond)
+ *
+ * Actions come first, data() closes the action list.
+ */
+class crofbuilder_packet_out : public crofbuilder {
+public:
+  /**
+   * @throws eBadVersion OFP 1.0 is not supported
+   */
+  crofbuilder_packet_out(rofl::crofchan *chan, const rofl::cauxid &auxid,
+                         uint8_t version, uint32_t xid);
+
+public:
+  /**
+   *
+   */
+  crofbuilder_packet_out &buffer_id(uint32_t buffer_id) {
+    get<rofl::openflow13::ofp_packet_out>(0)->buffer_id = htobe32(buffer_id);
+    return *this;
+  };
+
+  /**
+   *
+   */
+  crofbuilder_packet_out &in_port(uint32_t in_port) {
+    get<rofl::openflow13::ofp_packet_out>(0)->in_port = htobe32(in_port);
+    return *this;
+  };
+
+  /**
+   *
+   */
+  crofbuilder_packet_out &output(uint32_t port_no, uint16_t max_len = 128) {
+    check_actions();
+    append_output(port_no, max_len);
+    return *this;
+  };
+
+  /**
+   *
+   */
+  crofbuilder_packet_out &action(const rofl::openflow::cofaction &action) {
+    check_actions();
+    append_action(action);
+    return *this;
+  };
+
+  /**
+   * @brief	Appends packet data, no actions may follow
+   */
+  crofbuilder_packet_out &data(const uint8_t *data, size_t datalen);
+
+protected:
+  virtual void finalize() { close_actions(); };
+
+private:
+  void check_actions() {
+    if (actions_closed) {
+      throw eRofBuilderInvalid("crofbuilder_packet_out::action() data added",
+                               __FILE__, __FUNCTION__, __LINE__);
+    }
+  };
+
+  void close_actions();
+
+private:
+  bool actions_closed;
+};
+
+/**
+ * @brief	Packet-In builder (OFP 1.2 and beyond)
+ *
+ * Match fields come first, data() closes the match.
+ */
+class crofbuilder_packet_in : public crofbuilder_match<crofbuilder_packet_in> {
+public:
+  /**
+   * @throws eBadVersion OFP 1.0 is not supported
+   */
+  crofbuilder_packet_in(rofl::crofchan *chan, const rofl::cauxid &auxid,
+                        uint8_t version, uint32_t xid);
+
+public:
+  /**
+   *
+   */
+  crofbuilder_packet_in &buffer_id(uint32_t buffer_id) {
+    get<rofl::openflow13::ofp_packet_in>(0)->buffer_id = htobe32(buffer_id);
+    return *this;
+  };
+
+  /**
+   *
+   */
+  crofbuilder_packet_in &total_len(uint16_t total_len) {
+    get<rofl::openflow13::ofp_packet_in>(0)->total_len = htobe16(total_len);
+    return *this;
+  };
+
+  /**
+   *
+   */
+  crofbuilder_packet_in &reason(uint8_t reason) {
+    get<rofl::openflow13::ofp_packet_in>(0)->reason = reason;
+    return *this;
+  };
+
+  /**
+   *
+   */
+  crofbuilder_packet_in &table(uint8_t table_id) {
+    get<rofl::openflow13::ofp_packet_in>(0)->table_id = table_id;
+    return *this;
+  };
+
+  /**
+   * @brief	Sets cookie, ignored for OFP 1.2
+   */
+  crofbuilder_packet_in &cookie(uint64_t cookie) {
+    if (get_version() >= rofl::openflow13::OFP_VERSION)
+      get<rofl::openflow13::ofp_packet_in>(0)->cookie = htobe64(cookie);
+    return *this;
+  };
+
+  /**
+   * @brief	Appends packet data, no match fields may follow
+   */
+  crofbuilder_packet_in &data(const uint8_t *data, size_t datalen);
+
+protected:
+  virtual void finalize() { close_match(); };
+};
+
+/**
+ * @brief	Barrier-Request builder
+ */
+class crofbuilder_barrier_request : public crofbuilder {
+public:
+  /**
+   *
+   */
+  crofbuilder_barrier_request(rofl::crofchan *chan, const rofl::cauxid &auxid,
+                              uint8_t version, uint32_t xid,
+                              const rofl::ctimespec &ts);
+};
+
+/**
+ * @brief	Barrier-Reply builder
+ */
+class crofbuilder_barrier_reply : public crofbuilder {
+public:
+  /**
+   *
+   */
+  crofbuilder_barrier_reply(rofl::crofchan *chan, const rofl::cauxid &auxid,
+                            uint8_t version, uint32_t xid);
+};
+
+}; // end of namespace rofl
+
+#endif /* SRC_ROFL_COMMON_CROFBUILDER_HPP_ */
@@ -28,32 +28,30 @@ bool crofchan::is_established() const {
 rofl::crofsock::msg_result_t
 crofchan::send_message(const cauxid &auxid, rofl::openflow::cofmsg *msg) {
   AcquireReadLock rwlock(conns_rwlock);
-  if (not is_established()) {
-    throw eRofConnNotConnected(
-        "crofchan::send_message() channel not established")
-        .set_func(__FUNCTION__)
-        .set_line(__LINE__);
-  }
-  if (conns.find(auxid) == conns.end()) {
-    throw eRofConnNotConnected("crofchan::send_message() connection not found")
-        .set_func(__FUNCTION__)
-        .set_line(__LINE__)
-        .set_key("auxid", auxid.str());
-  }
-  if (not conns[auxid]->is_established()) {
-    throw eRofConnNotConnected(
-        "crofchan::send_message() connection not established")
-        .set_func(__FUNCTION__)
-        .set_line(__LINE__)
-        .set_key("auxid", auxid.str());
-  }
-  return conns[auxid]->send_message(msg);
+  return established_conn(auxid).send_message(msg);
 }
 
 rofl::crofsock::msg_result_t crofchan::send_message(const cauxid &auxid,
                                                     rofl::openflow::cofmsg *msg,
                                                     const ctimespec &ts) {
   AcquireReadLock rwlock(conns_rwlock);
+  return established_conn(auxid).send_message(msg, ts);
+}
+
+rofl::crofsock::msg_result_t crofchan::send_frame(const cauxid &auxid,
+                                                  rofl::crofframe *frame) {
+  AcquireReadLock rwlock(conns_rwlock);
+  return established_conn(auxid).send_frame(frame);
+}
+
+rofl::crofsock::msg_result_t crofchan::send_frame(const cauxid &auxid,
+                                                  rofl::crofframe *frame,
+                                                  const ctimespec &ts) {
+  AcquireReadLock rwlock(conns_rwlock);
+  return established_conn(auxid).send_frame(frame, ts);
+}
+
+crofconn &crofchan::established_conn(const cauxid &auxid) {
   if (not is_established()) {
     throw eRofConnNotConnected(
         "crofchan::send_message() channel not established")
@@ -73,5 +71,5 @@ rofl::crofsock::msg_result_t crofchan::send_message(const cauxid &auxid,
         .set_line(__LINE__)
         .set_key("auxid", auxid.str());
   }
-  return conns[auxid]->send_message(msg, ts);
+  return *(conns[auxid]);
 }
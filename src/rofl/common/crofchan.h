@@ -23,6 +23,7 @@
 #include "rofl/common/crandom.h"
 #include "rofl/common/crofconn.h"
 #include "rofl/common/cthread.hpp"
+#include "rofl/common/cthread_pool.hpp"
 #include "rofl/common/exception.hpp"
 #include "rofl/common/openflow/cofhelloelemversionbitmap.h"
 #include "rofl/common/openflow/messages/cofmsg.h"
@@ -109,6 +110,16 @@ protected:
   virtual void handle_recv(crofchan &chan, crofconn &conn,
                            rofl::openflow::cofmsg *msg) = 0;
 
+  /**
+   * @brief	Called for message types enabled by crofchan::set_rx_view()
+   *
+   * Return false for receiving the message via handle_recv() instead.
+   */
+  virtual bool handle_recv_view(crofchan &chan, crofconn &conn,
+                                const rofl::openflow::cofmsg_view &view) {
+    return false;
+  };
+
   virtual void congestion_occurred_indication(crofchan &chan,
                                               crofconn &conn) = 0;
 
@@ -147,11 +158,15 @@ public:
   };
 
   /**
+   * @brief	crofchan constructor
    *
+   * @param env crofchan environment
+   * @param pool when set, run management thread and all connections on
+   * reactor threads of this pool
    */
-  crofchan(crofchan_env *env)
-      : env(env), thread(this), last_auxid(0),
-        ofp_version(rofl::openflow::OFP_VERSION_UNKNOWN) {
+  crofchan(crofchan_env *env, cthread_pool *pool = nullptr)
+      : env(env), pool(pool), thread(this, pool), last_auxid(0),
+        ofp_version(rofl::openflow::OFP_VERSION_UNKNOWN), rx_views(0) {
     thread.start("crofchan");
   };
 
@@ -169,6 +184,19 @@ public:
                                             rofl::openflow::cofmsg *msg,
                                             const ctimespec &ts);
 
+  /**
+   * @brief	Sends a wire-format frame, ownership is transferred
+   */
+  rofl::crofsock::msg_result_t send_frame(const cauxid &auxid,
+                                          rofl::crofframe *frame);
+
+  /**
+   * @brief	Sends a wire-format request frame with transaction timeout
+   */
+  rofl::crofsock::msg_result_t send_frame(const cauxid &auxid,
+                                          rofl::crofframe *frame,
+                                          const ctimespec &ts);
+
 public:
   /**
    *
@@ -245,8 +273,9 @@ public:
           .set_file(__FILE__)
           .set_line(__LINE__);
     }
-    (conns[last_auxid] = new crofconn(this))->set_auxid(cauxid(last_auxid));
-    return *(conns[last_auxid]);
+    (conns[last_auxid] = new crofconn(this, pool))
+        ->set_auxid(cauxid(last_auxid));
+    return set_rx_views(*(conns[last_auxid]));
   };
 
   /**
@@ -257,8 +286,8 @@ public:
     if (conns.find(auxid) != conns.end()) {
       delete conns[auxid];
     }
-    (conns[auxid] = new crofconn(this))->set_auxid(auxid);
-    return *(conns[auxid]);
+    (conns[auxid] = new crofconn(this, pool))->set_auxid(auxid);
+    return set_rx_views(*(conns[auxid]));
   };
 
   /**
@@ -288,7 +317,7 @@ public:
     if (auxid == cauxid(0)) {
       ofp_version = conn->get_version();
     }
-    return *(conns[auxid]);
+    return set_rx_views(*(conns[auxid]));
   };
 
   /**
@@ -297,7 +326,8 @@ public:
   crofconn &set_conn(const cauxid &auxid) {
     AcquireReadWriteLock rwlock(conns_rwlock);
     if (conns.find(auxid) == conns.end()) {
-      (conns[auxid] = new crofconn(this))->set_auxid(auxid);
+      (conns[auxid] = new crofconn(this, pool))->set_auxid(auxid);
+      set_rx_views(*(conns[auxid]));
     }
     return *(conns[auxid]);
   };
@@ -367,7 +397,46 @@ public:
     return (not(conns.find(auxid) == conns.end()));
   };
 
+public:
+  /**
+   * @brief	Returns true, when messages of type are received as views
+   */
+  bool get_rx_view(uint8_t type) const {
+    return (type < 64) && (rx_views & ((uint64_t)1 << type));
+  };
+
+  /**
+   * @brief	Hands over messages of type as cofmsg_view without parsing
+   *
+   * Applies to all connections including those added later on, see
+   * crofconn::set_rx_view() for details.
+   */
+  crofchan &set_rx_view(uint8_t type, bool enable = true) {
+    if (type >= 64)
+      return *this;
+    AcquireReadWriteLock rwlock(conns_rwlock);
+    if (enable)
+      rx_views |= ((uint64_t)1 << type);
+    else
+      rx_views &= ~((uint64_t)1 << type);
+    for (auto it : conns) {
+      it.second->set_rx_view(type, enable);
+    }
+    return *this;
+  };
+
 private:
+  /**
+   * @brief	Enables channel's view types on conn, requires conns_rwlock
+   */
+  crofconn &set_rx_views(crofconn &conn) {
+    for (uint8_t type = 0; type < 64; type++) {
+      if (get_rx_view(type))
+        conn.set_rx_view(type);
+    }
+    return conn;
+  };
+
   /**
    *
    */
@@ -527,6 +596,11 @@ private:
     crofchan_env::call_env(env).handle_recv(*this, conn, msg);
   };
 
+  virtual bool handle_recv_view(crofconn &conn,
+                                const rofl::openflow::cofmsg_view &view) {
+    return crofchan_env::call_env(env).handle_recv_view(*this, conn, view);
+  };
+
   virtual void congestion_occurred_indication(crofconn &conn) {
     crofchan_env::call_env(env).congestion_occurred_indication(*this, conn);
   };
@@ -541,6 +615,10 @@ private:
                                                            type, sub_type);
   };
 
+private:
+  // requires conns_rwlock, throws eRofConnNotConnected
+  crofconn &established_conn(const cauxid &auxid);
+
 private:
   virtual void handle_wakeup(cthread &thread){};
 
@@ -561,6 +639,9 @@ private:
   // owner of this crofchan instance
   crofchan_env *env;
 
+  // reactor pool or nullptr
+  cthread_pool *pool;
+
   // management thread
   cthread thread;
 
@@ -576,6 +657,9 @@ private:
   // OFP version negotiated
   std::atomic_uint_fast8_t ofp_version;
 
+  // message types received as views (bit per type)
+  std::atomic<uint64_t> rx_views;
+
   // state related flags
   std::bitset<32> flags;
 
@@ -18,6 +18,8 @@ using namespace rofl;
 /*static*/ std::set<crofconn_env *> crofconn_env::connection_envs;
 /*static*/ crwlock crofconn_env::connection_envs_lock;
 /*static*/ const int crofconn::RXQUEUE_MAX_SIZE_DEFAULT = 128;
+/*static*/ const size_t crofconn::RXQUEUE_HIGH_WATERMARK_DEFAULT = 1048576;
+/*static*/ const size_t crofconn::RXQUEUE_LOW_WATERMARK_DEFAULT = 262144;
 /*static*/ const unsigned int crofconn::DEFAULT_SEGMENTATION_THRESHOLD = 65535;
 /*static*/ const time_t crofconn::DEFAULT_HELLO_TIMEOUT = 3;
 /*static*/ const time_t crofconn::DEFAULT_FEATURES_TIMEOUT = 5;
@@ -32,12 +34,14 @@ crofconn::~crofconn() {
   thread.stop();
 }
 
-crofconn::crofconn(crofconn_env *env)
-    : env(env), thread(this), rofsock(this), dpid(0), auxid(0),
+crofconn::crofconn(crofconn_env *env, cthread_pool *pool, int reactor)
+    : env(env), thread(this, pool, reactor),
+      rofsock(this, pool, thread.get_reactor()), dpid(0), auxid(0),
       ofp_version(rofl::openflow::OFP_VERSION_UNKNOWN), mode(MODE_UNKNOWN),
       state(STATE_DISCONNECTED), flag_hello_sent(false), flag_hello_rcvd(false),
       rxweights(QUEUE_MAX), rxqueues(QUEUE_MAX), rx_thread_working(false),
-      rx_thread_scheduled(false), rxqueue_max_size(RXQUEUE_MAX_SIZE_DEFAULT),
+      rx_thread_scheduled(false), rx_post_pending(false),
+      rxqueue_max_size(RXQUEUE_MAX_SIZE_DEFAULT), rx_throttle_episodes(0),
       segmentation_threshold(DEFAULT_SEGMENTATION_THRESHOLD),
       timeout_hello(DEFAULT_HELLO_TIMEOUT),
       timeout_features(DEFAULT_FEATURES_TIMEOUT),
@@ -56,6 +60,8 @@ crofconn::crofconn(crofconn_env *env)
   /* set maximum queue size */
   for (unsigned int queue_id = 0; queue_id < QUEUE_MAX; queue_id++) {
     rxqueues[queue_id].set_queue_max_size(rxqueue_max_size);
+    rxqueues[queue_id].set_watermarks(RXQUEUE_HIGH_WATERMARK_DEFAULT,
+                                      RXQUEUE_LOW_WATERMARK_DEFAULT);
   }
   /* start worker thread */
   thread.start("crofconn");
@@ -100,6 +106,24 @@ void crofconn::tls_connect(
   rofsock.tls_connect(reconnect);
 };
 
+void crofconn::shm_accept(
+    int sd, const rofl::openflow::cofhello_elem_versionbitmap &versionbitmap,
+    enum crofconn_mode_t mode) {
+  set_versionbitmap(versionbitmap);
+  set_mode(mode);
+  set_state(STATE_ACCEPT_PENDING);
+  rofsock.shm_accept(sd);
+};
+
+void crofconn::shm_connect(
+    const rofl::openflow::cofhello_elem_versionbitmap &versionbitmap,
+    enum crofconn_mode_t mode, bool reconnect) {
+  set_versionbitmap(versionbitmap);
+  set_mode(mode);
+  set_state(STATE_CONNECT_PENDING);
+  rofsock.shm_connect(reconnect);
+};
+
 void crofconn::handle_timeout(cthread &thread, uint32_t timer_id) {
   switch (timer_id) {
   case TIMER_ID_NEED_LIFE_CHECK: {
@@ -120,6 +144,9 @@ void crofconn::handle_timeout(cthread &thread, uint32_t timer_id) {
   case TIMER_ID_PENDING_SEGMENTS: {
     check_pending_segments();
   } break;
+  case TIMER_ID_NEGOTIATION_FAILED: {
+    set_state(STATE_NEGOTIATION_FAILED);
+  } break;
   default: {
     VLOG(1) << __FUNCTION__ << " unknown timer type: " << (unsigned int)timer_id
             << " laddr=" << rofsock.get_laddr().str()
@@ -154,6 +181,7 @@ void crofconn::set_state(enum crofconn_state_t new_state) {
 
       /* stop periodic checks for connection state (OAM) */
       thread.drop_timer(TIMER_ID_NEED_LIFE_CHECK);
+      thread.drop_timer(TIMER_ID_NEGOTIATION_FAILED);
 
       clear_pending_requests();
       clear_pending_segments();
@@ -171,7 +199,7 @@ void crofconn::set_state(enum crofconn_state_t new_state) {
       versionbitmap_peer.clear();
       set_version(rofl::openflow::OFP_VERSION_UNKNOWN);
 
-      for (auto rxqueue : rxqueues) {
+      for (auto &rxqueue : rxqueues) {
         rxqueue.clear();
       }
 
@@ -183,7 +211,7 @@ void crofconn::set_state(enum crofconn_state_t new_state) {
       versionbitmap_peer.clear();
       set_version(rofl::openflow::OFP_VERSION_UNKNOWN);
 
-      for (auto rxqueue : rxqueues) {
+      for (auto &rxqueue : rxqueues) {
         rxqueue.clear();
       }
 
@@ -232,7 +260,7 @@ void crofconn::set_state(enum crofconn_state_t new_state) {
 
 void crofconn::error_rcvd(rofl::openflow::cofmsg *pmsg) {
   rofl::openflow::cofmsg_error *msg =
-      dynamic_cast<rofl::openflow::cofmsg_error *>(pmsg);
+      rofl::openflow::cofmsg_cast<rofl::openflow::cofmsg_error>(pmsg);
 
   if (nullptr == msg) {
     VLOG(1) << __FUNCTION__ << " msg is not of type cofmsg_error laddr="
@@ -339,7 +367,7 @@ void crofconn::send_hello_message() {
 
 void crofconn::hello_rcvd(rofl::openflow::cofmsg *pmsg) {
   rofl::openflow::cofmsg_hello *msg =
-      dynamic_cast<rofl::openflow::cofmsg_hello *>(pmsg);
+      rofl::openflow::cofmsg_cast<rofl::openflow::cofmsg_hello>(pmsg);
 
   if (nullptr == msg) {
     VLOG(1) << __FUNCTION__ << " msg is not of type cofmsg_hello laddr="
@@ -457,9 +485,10 @@ void crofconn::hello_rcvd(rofl::openflow::cofmsg *pmsg) {
         new rofl::openflow::cofmsg_error_hello_failed_incompatible(
             msg->get_version(), msg->get_xid(), mem.somem(), len));
 
-    sleep(1);
-
-    set_state(STATE_NEGOTIATION_FAILED);
+    /* give peer a chance to receive the error message without blocking
+     * a reactor thread shared with other connections */
+    rofsock.rx_disable();
+    thread.add_timer(TIMER_ID_NEGOTIATION_FAILED, ctimespec().expire_in(1));
 
   } catch (eHelloEperm &e) {
 
@@ -474,9 +503,10 @@ void crofconn::hello_rcvd(rofl::openflow::cofmsg *pmsg) {
     rofsock.send_message(new rofl::openflow::cofmsg_error_hello_failed_eperm(
         msg->get_version(), msg->get_xid(), mem.somem(), len));
 
-    sleep(1);
-
-    set_state(STATE_NEGOTIATION_FAILED);
+    /* give peer a chance to receive the error message without blocking
+     * a reactor thread shared with other connections */
+    rofsock.rx_disable();
+    thread.add_timer(TIMER_ID_NEGOTIATION_FAILED, ctimespec().expire_in(1));
 
   } catch (std::runtime_error &e) {
 
@@ -493,9 +523,10 @@ void crofconn::hello_rcvd(rofl::openflow::cofmsg *pmsg) {
         new rofl::openflow::cofmsg_error_hello_failed_incompatible(
             msg->get_version(), msg->get_xid(), mem.somem(), len));
 
-    sleep(1);
-
-    set_state(STATE_NEGOTIATION_FAILED);
+    /* give peer a chance to receive the error message without blocking
+     * a reactor thread shared with other connections */
+    rofsock.rx_disable();
+    thread.add_timer(TIMER_ID_NEGOTIATION_FAILED, ctimespec().expire_in(1));
   }
 
   delete msg;
@@ -552,7 +583,7 @@ void crofconn::send_features_request() {
 
 void crofconn::features_reply_rcvd(rofl::openflow::cofmsg *pmsg) {
   rofl::openflow::cofmsg_features_reply *msg =
-      dynamic_cast<rofl::openflow::cofmsg_features_reply *>(pmsg);
+      rofl::openflow::cofmsg_cast<rofl::openflow::cofmsg_features_reply>(pmsg);
 
   if (nullptr == msg) {
     VLOG(1) << __FUNCTION__
@@ -616,7 +647,7 @@ void crofconn::send_echo_request() {
 
 void crofconn::echo_reply_rcvd(rofl::openflow::cofmsg *pmsg) {
   rofl::openflow::cofmsg_echo_reply *msg =
-      dynamic_cast<rofl::openflow::cofmsg_echo_reply *>(pmsg);
+      rofl::openflow::cofmsg_cast<rofl::openflow::cofmsg_echo_reply>(pmsg);
 
   assert(nullptr != msg);
 
@@ -646,7 +677,7 @@ void crofconn::echo_request_expired() {
 
 void crofconn::echo_request_rcvd(rofl::openflow::cofmsg *pmsg) {
   rofl::openflow::cofmsg_echo_request *msg =
-      dynamic_cast<rofl::openflow::cofmsg_echo_request *>(pmsg);
+      rofl::openflow::cofmsg_cast<rofl::openflow::cofmsg_echo_request>(pmsg);
 
   if (nullptr == msg) {
     VLOG(1) << __FUNCTION__ << " msg is not of type cofmsg_echo_request laddr="
@@ -808,11 +839,20 @@ void crofconn::handle_closed(crofsock &rofsock) {
     VLOG(2) << __FUNCTION__ << " socket indicates close";
 
     /* work on packets in reception queue first, then signal shutdown */
-    unsigned int waiting = 60 /*seconds*/;
-    while ((--waiting > 0) && (rx_thread_scheduled || rx_thread_working)) {
-      VLOG(2) << __FUNCTION__
-              << " socket indicates close, waiting for pending rx packets";
-      sleep(1);
+    if (thread.get_thread_id() == pthread_self()) {
+      /* socket and connection share a reactor thread, so waiting for the
+       * worker would block it: handle pending packets directly */
+      if (STATE_ESTABLISHED == state) {
+        handle_rx_messages();
+      }
+    } else {
+      unsigned int waiting = 60 /*seconds*/;
+      while ((--waiting > 0) &&
+             (rx_thread_scheduled || rx_thread_working || rx_post_pending)) {
+        VLOG(2) << __FUNCTION__
+                << " socket indicates close, waiting for pending rx packets";
+        sleep(1);
+      }
     }
 
     set_state(STATE_DISCONNECTED);
@@ -835,6 +875,13 @@ void crofconn::congestion_occurred_indication(crofsock &rofsock) {
   crofconn_env::call_env(env).congestion_occurred_indication(*this);
 };
 
+void crofconn::handle_expired(crofsock &socket, unsigned int txclass,
+                              unsigned int count) {
+  VLOG(2) << __FUNCTION__ << " " << count
+          << " expired messages dropped, txclass: " << txclass;
+  crofconn_env::call_env(env).handle_expired(*this, txclass, count);
+};
+
 void crofconn::handle_recv(crofsock &socket, rofl::openflow::cofmsg *msg) {
   /* This method is executed in crofsock's (not crofconn's!) rxthread context.
    * It deals with messages during connection establishment and negotiation
@@ -968,204 +1015,225 @@ void crofconn::handle_recv(crofsock &socket, rofl::openflow::cofmsg *msg) {
      * Strategy: we enforce queueing of successful received messages
      * in rxqueues in any case and never drop messages. However, we
      * disable reception of further messages from our peer, if we
-     * exceed the rxqueues capacity threshold. Once, the application
-     * starts reading message from the rxqueues, we reenable the
+     * exceed the rxqueues capacity or high watermark. Once the application
+     * has drained all rxqueues below their low watermarks, we reenable the
      * socket. See method crofconn::handle_rx_messages() for details. */
-    switch (ofp_version.load()) {
-    case rofl::openflow10::OFP_VERSION: {
-      switch (msg->get_type()) {
-      case rofl::openflow10::OFPT_PACKET_IN:
-      case rofl::openflow10::OFPT_PACKET_OUT: {
-        rxqueues[QUEUE_PKT].store(msg, true);
-        if (rxqueues[QUEUE_PKT].capacity() == 0) {
-          if (not rofsock.is_rx_disabled()) {
-            VLOG(2) << __FUNCTION__ << " rxqueues[QUEUE_PKT] capacity "
-                                       "exhausted; action: disabling "
-                                       "reception of messages";
-          }
-          rofsock.rx_disable();
-        }
-      } break;
-      case rofl::openflow10::OFPT_FLOW_MOD:
-      case rofl::openflow10::OFPT_FLOW_REMOVED:
-      case rofl::openflow10::OFPT_STATS_REQUEST:
-      case rofl::openflow10::OFPT_STATS_REPLY:
-      case rofl::openflow10::OFPT_BARRIER_REQUEST:
-      case rofl::openflow10::OFPT_BARRIER_REPLY: {
-        rxqueues[QUEUE_FLOW].store(msg, true);
-        if (rxqueues[QUEUE_FLOW].capacity() == 0) {
-          if (not rofsock.is_rx_disabled()) {
-            VLOG(2) << __FUNCTION__ << " rxqueues[QUEUE_FLOW] capacity "
-                                       "exhausted; action: disabling "
-                                       "reception of messages";
-          }
-          rofsock.rx_disable();
-        }
-      } break;
-      case rofl::openflow10::OFPT_HELLO:
-      case rofl::openflow10::OFPT_ECHO_REQUEST:
-      case rofl::openflow10::OFPT_ECHO_REPLY: {
-        rxqueues[QUEUE_OAM].store(msg, true);
-        if (rxqueues[QUEUE_OAM].capacity() == 0) {
-          if (not rofsock.is_rx_disabled()) {
-            VLOG(2) << __FUNCTION__ << " rxqueues[QUEUE_OAM] capacity "
-                                       "exhausted; action: disabling "
-                                       "reception of messages";
-          }
-          rofsock.rx_disable();
-        }
-      } break;
-      default: {
-        rxqueues[QUEUE_MGMT].store(msg, true);
-
-        if (rxqueues[QUEUE_MGMT].capacity() == 0) {
-          if (not rofsock.is_rx_disabled()) {
-            VLOG(2) << __FUNCTION__ << " rxqueues[QUEUE_MGMT] capacity "
-                                       "exhausted; action: disabling "
-                                       "reception of messages";
-          }
-          rofsock.rx_disable();
-        }
-      };
-      }
-    } break;
-    case rofl::openflow12::OFP_VERSION: {
-      switch (msg->get_type()) {
-      case rofl::openflow12::OFPT_PACKET_IN:
-      case rofl::openflow12::OFPT_PACKET_OUT: {
-        rxqueues[QUEUE_PKT].store(msg, true);
-        if (rxqueues[QUEUE_PKT].capacity() == 0) {
-          if (not rofsock.is_rx_disabled()) {
-            VLOG(2) << __FUNCTION__ << " rxqueues[QUEUE_PKT] capacity "
-                                       "exhausted; action: disabling "
-                                       "reception of messages";
-          }
-          rofsock.rx_disable();
-        }
-      } break;
-      case rofl::openflow12::OFPT_FLOW_MOD:
-      case rofl::openflow12::OFPT_FLOW_REMOVED:
-      case rofl::openflow12::OFPT_GROUP_MOD:
-      case rofl::openflow12::OFPT_PORT_MOD:
-      case rofl::openflow12::OFPT_TABLE_MOD:
-      case rofl::openflow12::OFPT_STATS_REQUEST:
-      case rofl::openflow12::OFPT_STATS_REPLY:
-      case rofl::openflow12::OFPT_BARRIER_REQUEST:
-      case rofl::openflow12::OFPT_BARRIER_REPLY: {
-        rxqueues[QUEUE_FLOW].store(msg, true);
-        if (rxqueues[QUEUE_FLOW].capacity() == 0) {
-          if (not rofsock.is_rx_disabled()) {
-            VLOG(2) << __FUNCTION__ << " rxqueues[QUEUE_FLOW] capacity "
-                                       "exhausted; action: disabling "
-                                       "reception of messages";
-          }
-          rofsock.rx_disable();
-        }
-      } break;
-      case rofl::openflow12::OFPT_HELLO:
-      case rofl::openflow12::OFPT_ECHO_REQUEST:
-      case rofl::openflow12::OFPT_ECHO_REPLY: {
-        rxqueues[QUEUE_OAM].store(msg, true);
-        if (rxqueues[QUEUE_OAM].capacity() == 0) {
-          if (not rofsock.is_rx_disabled()) {
-            VLOG(2) << __FUNCTION__ << " rxqueues[QUEUE_OAM] capacity "
-                                       "exhausted; action: disabling "
-                                       "reception of messages";
-          }
-          rofsock.rx_disable();
-        }
-      } break;
-      default: {
-        rxqueues[QUEUE_MGMT].store(msg, true);
-        if (rxqueues[QUEUE_MGMT].capacity() == 0) {
-          if (not rofsock.is_rx_disabled()) {
-            VLOG(2) << __FUNCTION__ << " rxqueues[QUEUE_MGMT] capacity "
-                                       "exhausted; action: disabling "
-                                       "reception of messages";
-          }
-          rofsock.rx_disable();
-        }
-      };
-      }
-    } break;
-    case rofl::openflow13::OFP_VERSION: {
-      switch (msg->get_type()) {
-      case rofl::openflow13::OFPT_PACKET_IN:
-      case rofl::openflow13::OFPT_PACKET_OUT: {
-        rxqueues[QUEUE_PKT].store(msg, true);
-        if (rxqueues[QUEUE_PKT].capacity() == 0) {
-          if (not rofsock.is_rx_disabled()) {
-            VLOG(2) << __FUNCTION__ << " rxqueues[QUEUE_PKT] capacity "
-                                       "exhausted; action: disabling "
-                                       "reception of messages";
-          }
-          rofsock.rx_disable();
-        }
-      } break;
-      case rofl::openflow13::OFPT_FLOW_MOD:
-      case rofl::openflow13::OFPT_FLOW_REMOVED:
-      case rofl::openflow13::OFPT_GROUP_MOD:
-      case rofl::openflow13::OFPT_PORT_MOD:
-      case rofl::openflow13::OFPT_TABLE_MOD:
-      case rofl::openflow13::OFPT_MULTIPART_REQUEST:
-      case rofl::openflow13::OFPT_MULTIPART_REPLY:
-      case rofl::openflow13::OFPT_BARRIER_REQUEST:
-      case rofl::openflow13::OFPT_BARRIER_REPLY: {
-        rxqueues[QUEUE_FLOW].store(msg, true);
-        if (rxqueues[QUEUE_FLOW].capacity() == 0) {
-          if (not rofsock.is_rx_disabled()) {
-            VLOG(2) << __FUNCTION__ << " rxqueues[QUEUE_FLOW] capacity "
-                                       "exhausted; action: disabling "
-                                       "reception of messages";
-          }
-          rofsock.rx_disable();
-        }
-      } break;
-      case rofl::openflow13::OFPT_HELLO:
-      case rofl::openflow13::OFPT_ECHO_REQUEST:
-      case rofl::openflow13::OFPT_ECHO_REPLY: {
-        rxqueues[QUEUE_OAM].store(msg, true);
-        if (rxqueues[QUEUE_OAM].capacity() == 0) {
-          if (not rofsock.is_rx_disabled()) {
-            VLOG(2) << __FUNCTION__ << " rxqueues[QUEUE_OAM] capacity "
-                                       "exhausted; action: disabling "
-                                       "reception of messages";
-          }
-          rofsock.rx_disable();
-        }
-      } break;
-      default: {
-        rxqueues[QUEUE_MGMT].store(msg, true);
-        if (rxqueues[QUEUE_MGMT].capacity() == 0) {
-          VLOG(2) << __FUNCTION__ << " rxqueues[QUEUE_MGMT] capacity "
-                                     "exhausted; action: disabling "
-                                     "reception of messages";
-          rofsock.rx_disable();
-        }
-      };
-      }
-    } break;
-    default: {
+    unsigned int queue_id = rxqueue_id(msg->get_type());
+    if (QUEUE_MAX == queue_id) {
       delete msg;
       return;
-    };
     }
+    store_rx_message(queue_id, msg);
 
   } catch (eRofQueueFull &e) {
     VLOG(1) << __FUNCTION__ << " error: " << e.what();
     /* throttle reception of further messages */
+    if (not rofsock.is_rx_disabled()) {
+      rx_throttle_episodes++;
+    }
     rofsock.rx_disable();
   }
 
   /* wakeup working thread in state ESTABLISHED; otherwise keep sleeping
    * and enqueue message until state ESTABLISHED is reached */
   if ((STATE_ESTABLISHED == state) && (not rx_thread_working)) {
-    thread.wakeup();
+    schedule_rx_messages();
+  }
+}
+
+bool crofconn::handle_recv_view(crofsock &socket,
+                                const rofl::openflow::cofmsg_view &view) {
+  /* This method is executed in crofsock's rxthread context. Messages
+   * handled by crofconn itself and messages received outside of state
+   * STATE_ESTABLISHED are parsed and take the default path. All other
+   * views are stored in the rxqueues like parsed messages, so they keep
+   * their order and count against the rxqueues' watermarks. */
+
+  if ((STATE_ESTABLISHED != get_state()) ||
+      (view.get_version() != ofp_version)) {
+    return false;
+  }
+
+  switch (view.get_type()) {
+  case OFPT_HELLO:
+  case OFPT_ERROR:
+  case OFPT_ECHO_REQUEST:
+  case OFPT_ECHO_REPLY:
+  case OFPT_MULTIPART_REQUEST:
+  case OFPT_MULTIPART_REPLY:
+    return false;
+  default:;
+  }
+
+  unsigned int queue_id = rxqueue_id(view.get_type());
+  if (QUEUE_MAX == queue_id) {
+    return false;
+  }
+
+  /* check pending xids */
+  if (has_pending_request(view.get_xid())) {
+    drop_pending_request(view.get_xid());
+  }
+
+  store_rx_message(queue_id, new rofl::openflow::cofmsg_view(view));
+
+  if (not rx_thread_working) {
+    schedule_rx_messages();
+  }
+
+  return true;
+}
+
+void crofconn::recv_view(rofl::openflow::cofmsg_view *view) {
+  std::unique_ptr<rofl::openflow::cofmsg_view> guard(view);
+
+  if (crofconn_env::call_env(env).handle_recv_view(*this, *view)) {
+    return;
+  }
+
+  /* declined by application, parse and hand over message */
+  rofl::openflow::cofmsg *msg = rofsock.parse_view(*view);
+  if (nullptr == msg) {
+    return;
+  }
+  VLOG(3) << __FUNCTION__ << " call application: " << msg->str().c_str();
+  crofconn_env::call_env(env).handle_recv(*this, msg);
+}
+
+unsigned int crofconn::rxqueue_id(uint8_t type) const {
+  switch (ofp_version.load()) {
+  case rofl::openflow10::OFP_VERSION: {
+    switch (type) {
+    case rofl::openflow10::OFPT_PACKET_IN:
+    case rofl::openflow10::OFPT_PACKET_OUT: {
+      return QUEUE_PKT;
+    }
+    case rofl::openflow10::OFPT_FLOW_MOD:
+    case rofl::openflow10::OFPT_FLOW_REMOVED:
+    case rofl::openflow10::OFPT_STATS_REQUEST:
+    case rofl::openflow10::OFPT_STATS_REPLY:
+    case rofl::openflow10::OFPT_BARRIER_REQUEST:
+    case rofl::openflow10::OFPT_BARRIER_REPLY: {
+      return QUEUE_FLOW;
+    }
+    case rofl::openflow10::OFPT_HELLO:
+    case rofl::openflow10::OFPT_ECHO_REQUEST:
+    case rofl::openflow10::OFPT_ECHO_REPLY: {
+      return QUEUE_OAM;
+    }
+    default: {
+      return QUEUE_MGMT;
+    };
+    }
+  }
+  case rofl::openflow12::OFP_VERSION: {
+    switch (type) {
+    case rofl::openflow12::OFPT_PACKET_IN:
+    case rofl::openflow12::OFPT_PACKET_OUT: {
+      return QUEUE_PKT;
+    }
+    case rofl::openflow12::OFPT_FLOW_MOD:
+    case rofl::openflow12::OFPT_FLOW_REMOVED:
+    case rofl::openflow12::OFPT_GROUP_MOD:
+    case rofl::openflow12::OFPT_PORT_MOD:
+    case rofl::openflow12::OFPT_TABLE_MOD:
+    case rofl::openflow12::OFPT_STATS_REQUEST:
+    case rofl::openflow12::OFPT_STATS_REPLY:
+    case rofl::openflow12::OFPT_BARRIER_REQUEST:
+    case rofl::openflow12::OFPT_BARRIER_REPLY: {
+      return QUEUE_FLOW;
+    }
+    case rofl::openflow12::OFPT_HELLO:
+    case rofl::openflow12::OFPT_ECHO_REQUEST:
+    case rofl::openflow12::OFPT_ECHO_REPLY: {
+      return QUEUE_OAM;
+    }
+    default: {
+      return QUEUE_MGMT;
+    };
+    }
+  }
+  case rofl::openflow13::OFP_VERSION: {
+    switch (type) {
+    case rofl::openflow13::OFPT_PACKET_IN:
+    case rofl::openflow13::OFPT_PACKET_OUT: {
+      return QUEUE_PKT;
+    }
+    case rofl::openflow13::OFPT_FLOW_MOD:
+    case rofl::openflow13::OFPT_FLOW_REMOVED:
+    case rofl::openflow13::OFPT_GROUP_MOD:
+    case rofl::openflow13::OFPT_PORT_MOD:
+    case rofl::openflow13::OFPT_TABLE_MOD:
+    case rofl::openflow13::OFPT_MULTIPART_REQUEST:
+    case rofl::openflow13::OFPT_MULTIPART_REPLY:
+    case rofl::openflow13::OFPT_BARRIER_REQUEST:
+    case rofl::openflow13::OFPT_BARRIER_REPLY: {
+      return QUEUE_FLOW;
+    }
+    case rofl::openflow13::OFPT_HELLO:
+    case rofl::openflow13::OFPT_ECHO_REQUEST:
+    case rofl::openflow13::OFPT_ECHO_REPLY: {
+      return QUEUE_OAM;
+    }
+    default: {
+      return QUEUE_MGMT;
+    };
+    }
+  }
+  default: {
+    return QUEUE_MAX;
+  };
+  }
+}
+
+void crofconn::store_rx_message(unsigned int queue_id,
+                                rofl::openflow::cofmsg *msg) {
+  rxqueues[queue_id].store(msg, true);
+  throttle_rx(queue_id);
+}
+
+void crofconn::store_rx_message(unsigned int queue_id,
+                                rofl::openflow::cofmsg_view *view) {
+  rxqueues[queue_id].store(view, true);
+  throttle_rx(queue_id);
+}
+
+void crofconn::throttle_rx(unsigned int queue_id) {
+  crofqueue &rxqueue = rxqueues[queue_id];
+  if ((rxqueue.capacity() > 0) && (not rxqueue.is_above_high_watermark())) {
+    return;
+  }
+  if (not rofsock.is_rx_disabled()) {
+    VLOG(2) << __FUNCTION__ << " rxqueues[" << queue_id << "] exhausted"
+            << " size=" << rxqueue.size() << " bytes=" << rxqueue.bytes()
+            << "; action: disabling reception of messages";
+    rx_throttle_episodes++;
+  }
+  rofsock.rx_disable();
+}
+
+bool crofconn::rxqueues_drained() const {
+  for (auto &rxqueue : rxqueues) {
+    if ((rxqueue.size() > rxqueue.get_queue_max_size() / 2) ||
+        (not rxqueue.is_below_low_watermark())) {
+      return false;
+    }
   }
+  return true;
 }
 
 void crofconn::handle_wakeup(cthread &thread) { handle_rx_messages(); }
 
+void crofconn::schedule_rx_messages() {
+  /* a single task handles all messages received in the meantime */
+  if (rx_post_pending.exchange(true))
+    return;
+  thread.post([this]() {
+    rx_post_pending = false;
+    handle_rx_messages();
+  });
+}
+
 void crofconn::handle_rx_messages() {
   /* we start with handling incoming messages */
   rx_thread_working = true;
@@ -1194,16 +1262,22 @@ void crofconn::handle_rx_messages() {
         for (unsigned int num = 0; num < rxweights[queue_id]; ++num) {
 
           rofl::openflow::cofmsg *msg = (rofl::openflow::cofmsg *)0;
+          rofl::openflow::cofmsg_view *view = nullptr;
 
           if (STATE_ESTABLISHED != state) {
             rx_thread_working = false;
             return;
           }
 
-          if ((msg = rxqueues[queue_id].retrieve()) == NULL) {
+          if (not rxqueues[queue_id].retrieve(msg, view)) {
             break; // no further messages in this queue
           }
 
+          if (nullptr != view) {
+            recv_view(view);
+            continue;
+          }
+
           /* segmentation and reassembly */
           switch (ofp_version.load()) {
           case rofl::openflow10::OFP_VERSION:
@@ -1232,7 +1306,7 @@ void crofconn::handle_rx_messages() {
 
         /* reschedule this method */
         if (not rxqueues[queue_id].empty()) {
-          thread.wakeup();
+          schedule_rx_messages();
         }
       }
 
@@ -1259,8 +1333,9 @@ void crofconn::handle_rx_messages() {
   thread.add_timer(TIMER_ID_NEED_LIFE_CHECK,
                    ctimespec().expire_in(timeout_lifecheck));
 
-  /* reenable reception of messages on socket */
-  if (rofsock.is_rx_disabled()) {
+  /* reenable reception of messages on socket, once the rxqueues have
+   * drained sufficiently, otherwise we are rescheduled above */
+  if (rofsock.is_rx_disabled() && rxqueues_drained()) {
     VLOG(2) << __FUNCTION__
             << " re-enabling reception of messages on underlying socket";
     rofsock.rx_enable();
@@ -1274,7 +1349,7 @@ void crofconn::handle_rx_multipart_message(rofl::openflow::cofmsg *msg) {
      * add multipart support here for receiving messages
      */
     rofl::openflow::cofmsg_stats_request *stats =
-        dynamic_cast<rofl::openflow::cofmsg_stats_request *>(msg);
+        rofl::openflow::cofmsg_cast<rofl::openflow::cofmsg_stats_request>(msg);
 
     if (NULL == stats) {
       VLOG(1) << __FUNCTION__
@@ -1321,7 +1396,7 @@ void crofconn::handle_rx_multipart_message(rofl::openflow::cofmsg *msg) {
      * add multipart support here for receiving messages
      */
     rofl::openflow::cofmsg_stats_reply *stats =
-        dynamic_cast<rofl::openflow::cofmsg_stats_reply *>(msg);
+        rofl::openflow::cofmsg_cast<rofl::openflow::cofmsg_stats_reply>(msg);
 
     if (NULL == stats) {
       VLOG(1) << __FUNCTION__
@@ -1370,47 +1445,14 @@ void crofconn::handle_rx_multipart_message(rofl::openflow::cofmsg *msg) {
 rofl::crofsock::msg_result_t crofconn::send_message(rofl::openflow::cofmsg *msg,
                                                     const ctimespec &ts) {
 
-  switch (msg->get_version()) {
-  case rofl::openflow10::OFP_VERSION: {
-
-    switch (msg->get_type()) {
-    case rofl::openflow10::OFPT_STATS_REQUEST: {
+  if (rofl::openflow::OFP_VERSION_UNKNOWN != msg->get_version()) {
+    if (rofl::openflow::cofmsg_dispatch::is_stats_request(msg->get_tag())) {
       add_pending_request(
           msg->get_xid(), ts, msg->get_type(),
-          dynamic_cast<rofl::openflow::cofmsg_stats_request *>(msg)
-              ->get_stats_type());
-    } break;
-    default: { add_pending_request(msg->get_xid(), ts, msg->get_type()); };
-    }
-
-  } break;
-  case rofl::openflow12::OFP_VERSION: {
-
-    switch (msg->get_type()) {
-    case rofl::openflow12::OFPT_STATS_REQUEST: {
-      add_pending_request(
-          msg->get_xid(), ts, msg->get_type(),
-          dynamic_cast<rofl::openflow::cofmsg_stats_request *>(msg)
-              ->get_stats_type());
-    } break;
-    default: { add_pending_request(msg->get_xid(), ts, msg->get_type()); };
-    }
-
-  } break;
-  case rofl::openflow13::OFP_VERSION: {
-
-    switch (msg->get_type()) {
-    case rofl::openflow13::OFPT_MULTIPART_REQUEST: {
-      add_pending_request(
-          msg->get_xid(), ts, msg->get_type(),
-          dynamic_cast<rofl::openflow::cofmsg_stats_request *>(msg)
-              ->get_stats_type());
-    } break;
-    default: { add_pending_request(msg->get_xid(), ts, msg->get_type()); };
+          rofl::openflow::cofmsg_dispatch::get_stats_type(*msg));
+    } else {
+      add_pending_request(msg->get_xid(), ts, msg->get_type());
     }
-
-  } break;
-  default: {};
   }
 
   return segment_and_send_message(msg);
@@ -1429,115 +1471,64 @@ crofconn::segment_and_send_message(rofl::openflow::cofmsg *msg) {
 
   } else {
 
-    // segment the packet
-    switch (msg->get_version()) {
-    case rofl::openflow12::OFP_VERSION: {
-
-      switch (msg->get_type()) {
-      case rofl::openflow12::OFPT_STATS_REPLY: {
+    // segment the packet, no multipart messages in OFP 1.0
+    if (msg->get_version() < rofl::openflow12::OFP_VERSION)
+      return msg_result;
 
-        switch (dynamic_cast<rofl::openflow::cofmsg_stats_reply *>(msg)
-                    ->get_stats_type()) {
-        case rofl::openflow12::OFPST_FLOW: {
-          msg_result = segment_flow_stats_reply(
-              dynamic_cast<rofl::openflow::cofmsg_flow_stats_reply *>(msg));
-        } break;
-        case rofl::openflow12::OFPST_TABLE: {
-          msg_result = segment_table_stats_reply(
-              dynamic_cast<rofl::openflow::cofmsg_table_stats_reply *>(msg));
-        } break;
-        case rofl::openflow12::OFPST_QUEUE: {
-          msg_result = segment_queue_stats_reply(
-              dynamic_cast<rofl::openflow::cofmsg_queue_stats_reply *>(msg));
-        } break;
-        case rofl::openflow12::OFPST_GROUP: {
-          msg_result = segment_group_stats_reply(
-              dynamic_cast<rofl::openflow::cofmsg_group_stats_reply *>(msg));
-        } break;
-        case rofl::openflow12::OFPST_GROUP_DESC: {
-          msg_result = segment_group_desc_stats_reply(
-              dynamic_cast<rofl::openflow::cofmsg_group_desc_stats_reply *>(
-                  msg));
-        } break;
-        }
-
-      } break;
-      }
+    switch (msg->get_tag()) {
+    case rofl::openflow::cofmsg::MSG_TAG_TABLE_FEATURES_STATS_REQUEST: {
+      msg_result = segment_table_features_stats_request(
+          static_cast<rofl::openflow::cofmsg_table_features_stats_request *>(
+              msg));
     } break;
-    case rofl::openflow13::OFP_VERSION: {
-
-      switch (msg->get_type()) {
-      case rofl::openflow13::OFPT_MULTIPART_REQUEST: {
-
-        switch (dynamic_cast<rofl::openflow::cofmsg_stats_request *>(msg)
-                    ->get_stats_type()) {
-        case rofl::openflow13::OFPMP_TABLE_FEATURES: {
-          msg_result = segment_table_features_stats_request(
-              dynamic_cast<
-                  rofl::openflow::cofmsg_table_features_stats_request *>(msg));
-        } break;
-        }
-
-      } break;
-      case rofl::openflow13::OFPT_MULTIPART_REPLY: {
-
-        switch (dynamic_cast<rofl::openflow::cofmsg_stats_reply *>(msg)
-                    ->get_stats_type()) {
-        case rofl::openflow13::OFPMP_FLOW: {
-          msg_result = segment_flow_stats_reply(
-              dynamic_cast<rofl::openflow::cofmsg_flow_stats_reply *>(msg));
-        } break;
-        case rofl::openflow13::OFPMP_TABLE: {
-          msg_result = segment_table_stats_reply(
-              dynamic_cast<rofl::openflow::cofmsg_table_stats_reply *>(msg));
-        } break;
-        case rofl::openflow13::OFPMP_PORT_STATS: {
-          msg_result = segment_port_stats_reply(
-              dynamic_cast<rofl::openflow::cofmsg_port_stats_reply *>(msg));
-        } break;
-        case rofl::openflow13::OFPMP_QUEUE: {
-          msg_result = segment_queue_stats_reply(
-              dynamic_cast<rofl::openflow::cofmsg_queue_stats_reply *>(msg));
-        } break;
-        case rofl::openflow13::OFPMP_GROUP: {
-          msg_result = segment_group_stats_reply(
-              dynamic_cast<rofl::openflow::cofmsg_group_stats_reply *>(msg));
-        } break;
-        case rofl::openflow13::OFPMP_GROUP_DESC: {
-          msg_result = segment_group_desc_stats_reply(
-              dynamic_cast<rofl::openflow::cofmsg_group_desc_stats_reply *>(
-                  msg));
-        } break;
-        case rofl::openflow13::OFPMP_TABLE_FEATURES: {
-          msg_result = segment_table_features_stats_reply(
-              dynamic_cast<rofl::openflow::cofmsg_table_features_stats_reply *>(
-                  msg));
-        } break;
-        case rofl::openflow13::OFPMP_PORT_DESC: {
-          msg_result = segment_port_desc_stats_reply(
-              dynamic_cast<rofl::openflow::cofmsg_port_desc_stats_reply *>(
-                  msg));
-        } break;
-        case rofl::openflow13::OFPMP_METER: {
-          msg_result = segment_meter_stats_reply(
-              dynamic_cast<rofl::openflow::cofmsg_meter_stats_reply *>(msg));
-        } break;
-        case rofl::openflow13::OFPMP_METER_CONFIG: {
-          msg_result = segment_meter_config_stats_reply(
-              dynamic_cast<rofl::openflow::cofmsg_meter_config_stats_reply *>(
-                  msg));
-        } break;
-        case rofl::openflow13::OFPMP_METER_FEATURES: {
-          // no array in meter-features, so no need to segment
-          msg_result = rofsock.send_message(
-              msg); // default behaviour for now: send message
-                    // directly to rofsock
-        } break;
-        }
-
-      } break;
-      }
+    case rofl::openflow::cofmsg::MSG_TAG_FLOW_STATS_REPLY: {
+      msg_result = segment_flow_stats_reply(
+          static_cast<rofl::openflow::cofmsg_flow_stats_reply *>(msg));
+    } break;
+    case rofl::openflow::cofmsg::MSG_TAG_TABLE_STATS_REPLY: {
+      msg_result = segment_table_stats_reply(
+          static_cast<rofl::openflow::cofmsg_table_stats_reply *>(msg));
+    } break;
+    case rofl::openflow::cofmsg::MSG_TAG_PORT_STATS_REPLY: {
+      msg_result = segment_port_stats_reply(
+          static_cast<rofl::openflow::cofmsg_port_stats_reply *>(msg));
+    } break;
+    case rofl::openflow::cofmsg::MSG_TAG_QUEUE_STATS_REPLY: {
+      msg_result = segment_queue_stats_reply(
+          static_cast<rofl::openflow::cofmsg_queue_stats_reply *>(msg));
+    } break;
+    case rofl::openflow::cofmsg::MSG_TAG_GROUP_STATS_REPLY: {
+      msg_result = segment_group_stats_reply(
+          static_cast<rofl::openflow::cofmsg_group_stats_reply *>(msg));
+    } break;
+    case rofl::openflow::cofmsg::MSG_TAG_GROUP_DESC_STATS_REPLY: {
+      msg_result = segment_group_desc_stats_reply(
+          static_cast<rofl::openflow::cofmsg_group_desc_stats_reply *>(msg));
     } break;
+    case rofl::openflow::cofmsg::MSG_TAG_TABLE_FEATURES_STATS_REPLY: {
+      msg_result = segment_table_features_stats_reply(
+          static_cast<rofl::openflow::cofmsg_table_features_stats_reply *>(
+              msg));
+    } break;
+    case rofl::openflow::cofmsg::MSG_TAG_PORT_DESC_STATS_REPLY: {
+      msg_result = segment_port_desc_stats_reply(
+          static_cast<rofl::openflow::cofmsg_port_desc_stats_reply *>(msg));
+    } break;
+    case rofl::openflow::cofmsg::MSG_TAG_METER_STATS_REPLY: {
+      msg_result = segment_meter_stats_reply(
+          static_cast<rofl::openflow::cofmsg_meter_stats_reply *>(msg));
+    } break;
+    case rofl::openflow::cofmsg::MSG_TAG_METER_CONFIG_STATS_REPLY: {
+      msg_result = segment_meter_config_stats_reply(
+          static_cast<rofl::openflow::cofmsg_meter_config_stats_reply *>(msg));
+    } break;
+    case rofl::openflow::cofmsg::MSG_TAG_METER_FEATURES_STATS_REPLY: {
+      // no array in meter-features, so no need to segment
+      msg_result = rofsock.send_message(
+          msg); // default behaviour for now: send message
+                // directly to rofsock
+    } break;
+    default: {};
     }
   }
 
@@ -1555,10 +1546,12 @@ rofl::crofsock::msg_result_t crofconn::segment_table_features_stats_request(
   while (not tableids.empty()) {
     rofl::openflow::coftables array(msg->get_version());
 
-    while ((not tableids.empty()) && (array.length() < MAX_LENGTH)) {
+    size_t seglen = 0;
+    while ((not tableids.empty()) && (seglen < MAX_LENGTH)) {
       uint8_t tableid = tableids.front();
       tableids.pop_front();
       array.add_table(tableid) = msg->get_tables().get_table(tableid);
+      seglen += array.get_table(tableid).length();
     }
 
     segments.push_back(new rofl::openflow::cofmsg_table_features_stats_request(
@@ -1597,10 +1590,12 @@ rofl::crofsock::msg_result_t crofconn::segment_table_features_stats_reply(
   while (not tableids.empty()) {
     rofl::openflow::coftables array(msg->get_version());
 
-    while ((not tableids.empty()) && (array.length() < MAX_LENGTH)) {
+    size_t seglen = 0;
+    while ((not tableids.empty()) && (seglen < MAX_LENGTH)) {
       uint8_t tableid = tableids.front();
       tableids.pop_front();
       array.add_table(tableid) = msg->get_tables().get_table(tableid);
+      seglen += array.get_table(tableid).length();
     }
 
     segments.push_back(new rofl::openflow::cofmsg_table_features_stats_reply(
@@ -1639,11 +1634,13 @@ rofl::crofsock::msg_result_t crofconn::segment_flow_stats_reply(
   while (not flowids.empty()) {
     rofl::openflow::cofflowstatsarray array(msg->get_version());
 
-    while ((not flowids.empty()) && (array.length() < MAX_LENGTH)) {
+    size_t seglen = 0;
+    while ((not flowids.empty()) && (seglen < MAX_LENGTH)) {
       uint32_t flowid = flowids.front();
       flowids.pop_front();
       array.add_flow_stats(flowid) =
           msg->get_flow_stats_array().get_flow_stats(flowid);
+      seglen += array.get_flow_stats(flowid).length();
     }
 
     segments.push_back(new rofl::openflow::cofmsg_flow_stats_reply(
@@ -1682,11 +1679,13 @@ rofl::crofsock::msg_result_t crofconn::segment_group_desc_stats_reply(
   while (not groupids.empty()) {
     rofl::openflow::cofgroupdescstatsarray array(msg->get_version());
 
-    while ((not groupids.empty()) && (array.length() < MAX_LENGTH)) {
+    size_t seglen = 0;
+    while ((not groupids.empty()) && (seglen < MAX_LENGTH)) {
       uint32_t groupid = groupids.front();
       groupids.pop_front();
       array.add_group_desc_stats(groupid) =
           msg->get_group_desc_stats_array().get_group_desc_stats(groupid);
+      seglen += array.get_group_desc_stats(groupid).length();
     }
 
     segments.push_back(new rofl::openflow::cofmsg_group_desc_stats_reply(
@@ -1725,11 +1724,13 @@ rofl::crofsock::msg_result_t crofconn::segment_group_stats_reply(
   while (not groupids.empty()) {
     rofl::openflow::cofgroupstatsarray array(msg->get_version());
 
-    while ((not groupids.empty()) && (array.length() < MAX_LENGTH)) {
+    size_t seglen = 0;
+    while ((not groupids.empty()) && (seglen < MAX_LENGTH)) {
       uint32_t groupid = groupids.front();
       groupids.pop_front();
       array.add_group_stats(groupid) =
           msg->get_group_stats_array().get_group_stats(groupid);
+      seglen += array.get_group_stats(groupid).length();
     }
 
     segments.push_back(new rofl::openflow::cofmsg_group_stats_reply(
@@ -1768,11 +1769,13 @@ rofl::crofsock::msg_result_t crofconn::segment_table_stats_reply(
   while (not tableids.empty()) {
     rofl::openflow::coftablestatsarray array(msg->get_version());
 
-    while ((not tableids.empty()) && (array.length() < MAX_LENGTH)) {
+    size_t seglen = 0;
+    while ((not tableids.empty()) && (seglen < MAX_LENGTH)) {
       uint32_t tableid = tableids.front();
       tableids.pop_front();
       array.add_table_stats(tableid) =
           msg->get_table_stats_array().get_table_stats(tableid);
+      seglen += array.get_table_stats(tableid).length();
     }
 
     segments.push_back(new rofl::openflow::cofmsg_table_stats_reply(
@@ -1811,11 +1814,13 @@ rofl::crofsock::msg_result_t crofconn::segment_port_stats_reply(
   while (not portids.empty()) {
     rofl::openflow::cofportstatsarray array(msg->get_version());
 
-    while ((not portids.empty()) && (array.length() < MAX_LENGTH)) {
+    size_t seglen = 0;
+    while ((not portids.empty()) && (seglen < MAX_LENGTH)) {
       uint32_t portid = portids.front();
       portids.pop_front();
       array.add_port_stats(portid) =
           msg->get_port_stats_array().get_port_stats(portid);
+      seglen += array.get_port_stats(portid).length();
     }
 
     segments.push_back(new rofl::openflow::cofmsg_port_stats_reply(
@@ -1854,13 +1859,15 @@ rofl::crofsock::msg_result_t crofconn::segment_queue_stats_reply(
   while (not portids.empty()) {
     rofl::openflow::cofqueuestatsarray array(msg->get_version());
 
-    while ((not portids.empty()) && (array.length() < MAX_LENGTH)) {
+    size_t seglen = 0;
+    while ((not portids.empty()) && (seglen < MAX_LENGTH)) {
       uint32_t portid = portids.front();
       portids.pop_front();
 
       for (auto queueid : msg->get_queue_stats_array().keys(portid)) {
         array.add_queue_stats(portid, queueid) =
             msg->get_queue_stats_array().get_queue_stats(portid, queueid);
+        seglen += array.get_queue_stats(portid, queueid).length();
       }
     }
 
@@ -1900,10 +1907,12 @@ rofl::crofsock::msg_result_t crofconn::segment_port_desc_stats_reply(
   while (not portids.empty()) {
     rofl::openflow::cofports ports(msg->get_version());
 
-    while ((not portids.empty()) && (ports.length() < MAX_LENGTH)) {
+    size_t seglen = 0;
+    while ((not portids.empty()) && (seglen < MAX_LENGTH)) {
       uint32_t portid = portids.front();
       portids.pop_front();
       ports.add_port(portid) = msg->get_ports().get_port(portid);
+      seglen += ports.get_port(portid).length();
     }
 
     segments.push_back(new rofl::openflow::cofmsg_port_desc_stats_reply(
@@ -1942,11 +1951,13 @@ rofl::crofsock::msg_result_t crofconn::segment_meter_stats_reply(
   while (not meterids.empty()) {
     rofl::openflow::cofmeterstatsarray array(msg->get_version());
 
-    while ((not meterids.empty()) && (array.length() < MAX_LENGTH)) {
+    size_t seglen = 0;
+    while ((not meterids.empty()) && (seglen < MAX_LENGTH)) {
       uint32_t meterid = meterids.front();
       meterids.pop_front();
       array.add_meter_stats(meterid) =
           msg->get_meter_stats_array().get_meter_stats(meterid);
+      seglen += array.get_meter_stats(meterid).length();
     }
 
     segments.push_back(new rofl::openflow::cofmsg_meter_stats_reply(
@@ -1985,11 +1996,13 @@ rofl::crofsock::msg_result_t crofconn::segment_meter_config_stats_reply(
   while (not meterids.empty()) {
     rofl::openflow::cofmeterconfigarray array(msg->get_version());
 
-    while ((not meterids.empty()) && (array.length() < MAX_LENGTH)) {
+    size_t seglen = 0;
+    while ((not meterids.empty()) && (seglen < MAX_LENGTH)) {
       uint32_t meterid = meterids.front();
       meterids.pop_front();
       array.add_meter_config(meterid) =
           msg->get_meter_config_array().get_meter_config(meterid);
+      seglen += array.get_meter_config(meterid).length();
     }
 
     segments.push_back(new rofl::openflow::cofmsg_meter_config_stats_reply(
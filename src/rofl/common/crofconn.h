@@ -16,6 +16,7 @@
 #include <atomic>
 #include <bitset>
 #include <inttypes.h>
+#include <memory>
 #include <set>
 
 #include "rofl/common/cauxid.h"
@@ -100,6 +101,18 @@ protected:
 
   virtual void handle_recv(crofconn &conn, rofl::openflow::cofmsg *msg) = 0;
 
+  /**
+   * @brief	Called for message types enabled by crofconn::set_rx_view()
+   *
+   * Views pass crofconn's rxqueues and are handed over in crofconn's
+   * thread in order with all other received messages. Return false for
+   * receiving the message via handle_recv() instead.
+   */
+  virtual bool handle_recv_view(crofconn &conn,
+                                const rofl::openflow::cofmsg_view &view) {
+    return false;
+  };
+
   virtual void congestion_occurred_indication(crofconn &conn) = 0;
 
   virtual void congestion_solved_indication(crofconn &conn) = 0;
@@ -108,6 +121,14 @@ protected:
                                           uint8_t type,
                                           uint16_t sub_type = 0) = 0;
 
+  /**
+   * @brief	Called after queued messages exceeded their time-to-live
+   *
+   * Executed in crofsock's txthread context, see crofsock_env.
+   */
+  virtual void handle_expired(crofconn &conn, unsigned int txclass,
+                              unsigned int count){};
+
 private:
   static std::set<crofconn_env *> connection_envs;
   static crwlock connection_envs_lock;
@@ -148,6 +169,7 @@ class crofconn : public cthread_env, public crofsock_env {
     TIMER_ID_RX_THREAD = 5,
     TIMER_ID_PENDING_REQUESTS = 6,
     TIMER_ID_PENDING_SEGMENTS = 7,
+    TIMER_ID_NEGOTIATION_FAILED = 8,
   };
 
 public:
@@ -172,9 +194,15 @@ public:
   virtual ~crofconn();
 
   /**
+   * @brief	crofconn constructor
    *
+   * @param env crofconn environment
+   * @param pool when set, pin this connection and its socket to a
+   * reactor thread of this pool
+   * @param reactor index of reactor thread within pool, -1: select least
+   * loaded reactor thread
    */
-  crofconn(crofconn_env *env);
+  crofconn(crofconn_env *env, cthread_pool *pool = nullptr, int reactor = -1);
 
 public:
   /**
@@ -212,6 +240,21 @@ public:
   tls_connect(const rofl::openflow::cofhello_elem_versionbitmap &versionbitmap,
               enum crofconn_mode_t mode, bool reconnect = true);
 
+  /**
+   * @brief	Accepts a shared memory connection, see crofsock::shm_accept()
+   */
+  virtual void
+  shm_accept(int sd,
+             const rofl::openflow::cofhello_elem_versionbitmap &versionbitmap,
+             enum crofconn_mode_t mode);
+
+  /**
+   * @brief	Connects via shared memory, see crofsock::shm_connect()
+   */
+  virtual void
+  shm_connect(const rofl::openflow::cofhello_elem_versionbitmap &versionbitmap,
+              enum crofconn_mode_t mode, bool reconnect = true);
+
 public:
   /**
    *
@@ -271,6 +314,22 @@ public:
   rofl::crofsock::msg_result_t send_message(rofl::openflow::cofmsg *msg,
                                             const ctimespec &ts);
 
+  /**
+   * @brief	Send wire-format frame via socket, frames are never segmented
+   */
+  rofl::crofsock::msg_result_t send_frame(rofl::crofframe *frame) {
+    return rofsock.send_frame(frame);
+  };
+
+  /**
+   * @brief	Send wire-format request frame via socket with expiration timer
+   */
+  rofl::crofsock::msg_result_t send_frame(rofl::crofframe *frame,
+                                          const ctimespec &ts) {
+    add_pending_request(frame->get_xid(), ts, frame->get_type());
+    return rofsock.send_frame(frame);
+  };
+
 public:
   /**
    * @brief	Returns a reference to the versionbitmap announced by this
@@ -337,6 +396,114 @@ public:
     return *this;
   };
 
+  /**
+   * @brief	Returns high watermark of a reception queue in bytes
+   */
+  size_t get_rxqueue_high_watermark(outqueue_type_t queue_id) const {
+    if (rxqueues.size() <= queue_id) {
+      throw eRofConnInvalid(
+          "crofconn::get_rxqueue_high_watermark() invalid queue_id")
+          .set_func(__FUNCTION__)
+          .set_file(__FILE__)
+          .set_line(__LINE__);
+    }
+    return rxqueues[queue_id].get_high_watermark();
+  };
+
+  /**
+   * @brief	Returns low watermark of a reception queue in bytes
+   */
+  size_t get_rxqueue_low_watermark(outqueue_type_t queue_id) const {
+    if (rxqueues.size() <= queue_id) {
+      throw eRofConnInvalid(
+          "crofconn::get_rxqueue_low_watermark() invalid queue_id")
+          .set_func(__FUNCTION__)
+          .set_file(__FILE__)
+          .set_line(__LINE__);
+    }
+    return rxqueues[queue_id].get_low_watermark();
+  };
+
+  /**
+   * @brief	Sets watermarks of a reception queue in bytes
+   *
+   * Reception on the socket is disabled once a queue reaches its high
+   * watermark or its max size in messages and reenabled after all queues
+   * fell to their low watermark and half of their max size. A high
+   * watermark of 0 throttles on the number of messages only.
+   */
+  crofconn &set_rxqueue_watermarks(outqueue_type_t queue_id,
+                                   size_t high_watermark,
+                                   size_t low_watermark) {
+    if (rxqueues.size() <= queue_id) {
+      throw eRofConnInvalid(
+          "crofconn::set_rxqueue_watermarks() invalid queue_id")
+          .set_func(__FUNCTION__)
+          .set_file(__FILE__)
+          .set_line(__LINE__);
+    }
+    rxqueues[queue_id].set_watermarks(high_watermark, low_watermark);
+    return *this;
+  };
+
+  /**
+   * @brief	Returns number of bytes held in a reception queue
+   */
+  size_t get_rxqueue_bytes(outqueue_type_t queue_id) const {
+    if (rxqueues.size() <= queue_id) {
+      throw eRofConnInvalid("crofconn::get_rxqueue_bytes() invalid queue_id")
+          .set_func(__FUNCTION__)
+          .set_file(__FILE__)
+          .set_line(__LINE__);
+    }
+    return rxqueues[queue_id].bytes();
+  };
+
+  /**
+   * @brief	Returns number of times reception was throttled
+   */
+  uint64_t get_rx_throttle_episodes() const { return rx_throttle_episodes; };
+
+public:
+  /**
+   * @brief	Configures a traffic class for transmission, see crofsock
+   */
+  crofconn &set_txclass(unsigned int txclass, size_t quantum,
+                        bool strict = false) {
+    rofsock.set_txclass(txclass, quantum, strict);
+    return *this;
+  };
+
+  /**
+   * @brief	Enables or disables per class transmission statistics
+   */
+  crofconn &set_txclass_stats(bool enable) {
+    rofsock.set_txclass_stats(enable);
+    return *this;
+  };
+
+  /**
+   * @brief	Returns transmission statistics of txclass
+   */
+  ctxclass_stats get_txclass_stats(unsigned int txclass) const {
+    return rofsock.get_txclass_stats(txclass);
+  };
+
+  /**
+   * @brief	Sets time-to-live of messages in txclass in usecs, see crofsock
+   */
+  crofconn &set_txclass_ttl(unsigned int txclass, unsigned int ttl) {
+    rofsock.set_txclass_ttl(txclass, ttl);
+    return *this;
+  };
+
+  /**
+   * @brief	Returns number of expired messages dropped from txclass
+   */
+  uint64_t get_txclass_expired(unsigned int txclass) const {
+    return rofsock.get_txclass_expired(txclass);
+  };
+
 public:
   /**
    *
@@ -362,6 +529,36 @@ public:
     return *this;
   };
 
+  /**
+   * @brief	Returns SO_BUSY_POLL budget in microseconds, 0: disabled
+   */
+  unsigned int get_busy_poll() const { return rofsock.get_busy_poll(); };
+
+  /**
+   * @brief	Sets SO_BUSY_POLL budget in microseconds for new connections
+   */
+  crofconn &set_busy_poll(unsigned int usecs) {
+    rofsock.set_busy_poll(usecs);
+    return *this;
+  };
+
+  /**
+   * @brief	Returns true, when messages of type are received as views
+   */
+  bool get_rx_view(uint8_t type) const { return rofsock.get_rx_view(type); };
+
+  /**
+   * @brief	Hands over messages of type as cofmsg_view without parsing
+   *
+   * Views are handed over in state established only. Hello, Error, Echo
+   * and Multipart messages are always parsed by crofconn. Queued views keep
+   * crofsock's receive buffer alive.
+   */
+  crofconn &set_rx_view(uint8_t type, bool enable = true) {
+    rofsock.set_rx_view(type, enable);
+    return *this;
+  };
+
 public:
   /**
    *
@@ -694,10 +891,16 @@ private:
 
   virtual void handle_recv(crofsock &socket, rofl::openflow::cofmsg *msg);
 
+  virtual bool handle_recv_view(crofsock &socket,
+                                const rofl::openflow::cofmsg_view &view);
+
   virtual void congestion_occurred_indication(crofsock &socket);
 
   virtual void congestion_solved_indication(crofsock &rofsock);
 
+  virtual void handle_expired(crofsock &socket, unsigned int txclass,
+                              unsigned int count);
+
 private:
   virtual void handle_wakeup(cthread &thread);
 
@@ -710,6 +913,42 @@ private:
 private:
   void handle_rx_messages();
 
+  /**
+   * @brief	Stores a received message and throttles reception if necessary
+   */
+  void store_rx_message(unsigned int queue_id, rofl::openflow::cofmsg *msg);
+
+  /**
+   * @brief	Stores a received view and throttles reception if necessary
+   */
+  void store_rx_message(unsigned int queue_id,
+                        rofl::openflow::cofmsg_view *view);
+
+  /**
+   * @brief	Disables reception while rxqueue is exhausted
+   */
+  void throttle_rx(unsigned int queue_id);
+
+  /**
+   * @brief	Returns rxqueue for message type, QUEUE_MAX: unknown version
+   */
+  unsigned int rxqueue_id(uint8_t type) const;
+
+  /**
+   * @brief	Hands over a queued view, parses it when declined
+   */
+  void recv_view(rofl::openflow::cofmsg_view *view);
+
+  /**
+   * @brief	Returns true, when all rxqueues drained below their low marks
+   */
+  bool rxqueues_drained() const;
+
+  /**
+   * @brief	Posts handle_rx_messages() to internal thread unless pending
+   */
+  void schedule_rx_messages();
+
   void handle_rx_multipart_message(rofl::openflow::cofmsg *msg);
 
 private:
@@ -1151,10 +1390,20 @@ private:
   // internal thread is scheduled for working on pending messages
   bool rx_thread_scheduled;
 
+  // task for handling pending messages is posted to internal thread
+  std::atomic_bool rx_post_pending;
+
   // max size of rx queue
   size_t rxqueue_max_size;
   static const int RXQUEUE_MAX_SIZE_DEFAULT;
 
+  // default watermarks of rx queues in bytes
+  static const size_t RXQUEUE_HIGH_WATERMARK_DEFAULT;
+  static const size_t RXQUEUE_LOW_WATERMARK_DEFAULT;
+
+  // number of times reception was disabled due to full rxqueues
+  std::atomic<uint64_t> rx_throttle_episodes;
+
   // maximum number of bytes for a multipart message before being segmented
   size_t segmentation_threshold;
 
@@ -20,8 +20,8 @@ using namespace rofl;
 
 crofctl::~crofctl(){};
 
-crofctl::crofctl(crofctl_env *env, const cctlid &ctlid)
-    : env(env), ctlid(ctlid), rofchan(this), xid_last(random.uint32()),
+crofctl::crofctl(crofctl_env *env, const cctlid &ctlid, cthread_pool *pool)
+    : env(env), ctlid(ctlid), rofchan(this, pool), xid_last(random.uint32()),
       async_config_role_default_template(rofl::openflow13::OFP_VERSION),
       async_config(rofl::openflow13::OFP_VERSION) {
   init_async_config_role_default_template();
@@ -39,112 +39,122 @@ void crofctl::handle_recv(crofchan &chan, crofconn &conn,
 
         crofctl_env::call_env(env).handle_experimenter_message(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_experimenter &>(*msg));
+            rofl::openflow::cofmsg_cast<
+                rofl::openflow::cofmsg_experimenter>(*msg));
 
       } break;
       case rofl::openflow10::OFPT_ERROR: {
 
         crofctl_env::call_env(env).handle_error_message(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_error &>(*msg));
+            rofl::openflow::cofmsg_cast<rofl::openflow::cofmsg_error>(*msg));
 
       } break;
       case rofl::openflow10::OFPT_FEATURES_REQUEST: {
 
         crofctl_env::call_env(env).handle_features_request(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_features_request &>(*msg));
+            rofl::openflow::cofmsg_cast<
+                rofl::openflow::cofmsg_features_request>(*msg));
 
       } break;
       case rofl::openflow10::OFPT_GET_CONFIG_REQUEST: {
 
         crofctl_env::call_env(env).handle_get_config_request(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_get_config_request &>(*msg));
+            rofl::openflow::cofmsg_cast<
+                rofl::openflow::cofmsg_get_config_request>(*msg));
 
       } break;
       case rofl::openflow10::OFPT_SET_CONFIG: {
 
         crofctl_env::call_env(env).handle_set_config(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_set_config &>(*msg));
+            rofl::openflow::cofmsg_cast<
+                rofl::openflow::cofmsg_set_config>(*msg));
 
       } break;
       case rofl::openflow10::OFPT_PACKET_OUT: {
 
         crofctl_env::call_env(env).handle_packet_out(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_packet_out &>(*msg));
+            rofl::openflow::cofmsg_cast<
+                rofl::openflow::cofmsg_packet_out>(*msg));
 
       } break;
       case rofl::openflow10::OFPT_FLOW_MOD: {
 
-        dynamic_cast<rofl::openflow::cofmsg_flow_mod &>(*msg)
+        rofl::openflow::cofmsg_cast<rofl::openflow::cofmsg_flow_mod>(*msg)
             .check_prerequisites();
         crofctl_env::call_env(env).handle_flow_mod(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_flow_mod &>(*msg));
+            rofl::openflow::cofmsg_cast<rofl::openflow::cofmsg_flow_mod>(*msg));
 
       } break;
       case rofl::openflow10::OFPT_PORT_MOD: {
 
         crofctl_env::call_env(env).handle_port_mod(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_port_mod &>(*msg));
+            rofl::openflow::cofmsg_cast<rofl::openflow::cofmsg_port_mod>(*msg));
 
       } break;
       case rofl::openflow10::OFPT_STATS_REQUEST: {
 
-        switch (dynamic_cast<rofl::openflow::cofmsg_stats_request &>(*msg)
-                    .get_stats_type()) {
+        switch (rofl::openflow::cofmsg_dispatch::get_stats_type(*msg)) {
         case rofl::openflow10::OFPST_DESC: {
 
           crofctl_env::call_env(env).handle_desc_stats_request(
               *this, conn.get_auxid(),
-              dynamic_cast<rofl::openflow::cofmsg_desc_stats_request &>(*msg));
+              rofl::openflow::cofmsg_cast<
+                  rofl::openflow::cofmsg_desc_stats_request>(*msg));
 
         } break;
         case rofl::openflow10::OFPST_FLOW: {
 
           crofctl_env::call_env(env).handle_flow_stats_request(
               *this, conn.get_auxid(),
-              dynamic_cast<rofl::openflow::cofmsg_flow_stats_request &>(*msg));
+              rofl::openflow::cofmsg_cast<
+                  rofl::openflow::cofmsg_flow_stats_request>(*msg));
 
         } break;
         case rofl::openflow10::OFPST_AGGREGATE: {
 
           crofctl_env::call_env(env).handle_aggregate_stats_request(
               *this, conn.get_auxid(),
-              dynamic_cast<rofl::openflow::cofmsg_aggr_stats_request &>(*msg));
+              rofl::openflow::cofmsg_cast<
+                  rofl::openflow::cofmsg_aggr_stats_request>(*msg));
 
         } break;
         case rofl::openflow10::OFPST_TABLE: {
 
           crofctl_env::call_env(env).handle_table_stats_request(
               *this, conn.get_auxid(),
-              dynamic_cast<rofl::openflow::cofmsg_table_stats_request &>(*msg));
+              rofl::openflow::cofmsg_cast<
+                  rofl::openflow::cofmsg_table_stats_request>(*msg));
 
         } break;
         case rofl::openflow10::OFPST_PORT: {
 
           crofctl_env::call_env(env).handle_port_stats_request(
               *this, conn.get_auxid(),
-              dynamic_cast<rofl::openflow::cofmsg_port_stats_request &>(*msg));
+              rofl::openflow::cofmsg_cast<
+                  rofl::openflow::cofmsg_port_stats_request>(*msg));
 
         } break;
         case rofl::openflow10::OFPST_QUEUE: {
 
           crofctl_env::call_env(env).handle_queue_stats_request(
               *this, conn.get_auxid(),
-              dynamic_cast<rofl::openflow::cofmsg_queue_stats_request &>(*msg));
+              rofl::openflow::cofmsg_cast<
+                  rofl::openflow::cofmsg_queue_stats_request>(*msg));
 
         } break;
         case rofl::openflow10::OFPST_VENDOR: {
 
           crofctl_env::call_env(env).handle_experimenter_stats_request(
               *this, conn.get_auxid(),
-              dynamic_cast<rofl::openflow::cofmsg_experimenter_stats_request &>(
-                  *msg));
+              rofl::openflow::cofmsg_cast<
+                  rofl::openflow::cofmsg_experimenter_stats_request>(*msg));
 
         } break;
         default: { } break; }
@@ -154,15 +164,16 @@ void crofctl::handle_recv(crofchan &chan, crofconn &conn,
 
         crofctl_env::call_env(env).handle_barrier_request(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_barrier_request &>(*msg));
+            rofl::openflow::cofmsg_cast<
+                rofl::openflow::cofmsg_barrier_request>(*msg));
 
       } break;
       case rofl::openflow10::OFPT_QUEUE_GET_CONFIG_REQUEST: {
 
         crofctl_env::call_env(env).handle_queue_get_config_request(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_queue_get_config_request &>(
-                *msg));
+            rofl::openflow::cofmsg_cast<
+                rofl::openflow::cofmsg_queue_get_config_request>(*msg));
 
       } break;
       default: {};
@@ -175,21 +186,23 @@ void crofctl::handle_recv(crofchan &chan, crofconn &conn,
 
         crofctl_env::call_env(env).handle_experimenter_message(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_experimenter &>(*msg));
+            rofl::openflow::cofmsg_cast<
+                rofl::openflow::cofmsg_experimenter>(*msg));
 
       } break;
       case rofl::openflow12::OFPT_ERROR: {
 
         crofctl_env::call_env(env).handle_error_message(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_error &>(*msg));
+            rofl::openflow::cofmsg_cast<rofl::openflow::cofmsg_error>(*msg));
 
       } break;
       case rofl::openflow12::OFPT_FEATURES_REQUEST: {
 
         crofctl_env::call_env(env).handle_features_request(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_features_request &>(*msg));
+            rofl::openflow::cofmsg_cast<
+                rofl::openflow::cofmsg_features_request>(*msg));
 
       } break;
       case rofl::openflow12::OFPT_GET_CONFIG_REQUEST: {
@@ -197,7 +210,8 @@ void crofctl::handle_recv(crofchan &chan, crofconn &conn,
         check_role();
         crofctl_env::call_env(env).handle_get_config_request(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_get_config_request &>(*msg));
+            rofl::openflow::cofmsg_cast<
+                rofl::openflow::cofmsg_get_config_request>(*msg));
 
       } break;
       case rofl::openflow12::OFPT_SET_CONFIG: {
@@ -205,7 +219,8 @@ void crofctl::handle_recv(crofchan &chan, crofconn &conn,
         check_role();
         crofctl_env::call_env(env).handle_set_config(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_set_config &>(*msg));
+            rofl::openflow::cofmsg_cast<
+                rofl::openflow::cofmsg_set_config>(*msg));
 
       } break;
       case rofl::openflow12::OFPT_PACKET_OUT: {
@@ -213,35 +228,37 @@ void crofctl::handle_recv(crofchan &chan, crofconn &conn,
         check_role();
         crofctl_env::call_env(env).handle_packet_out(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_packet_out &>(*msg));
+            rofl::openflow::cofmsg_cast<
+                rofl::openflow::cofmsg_packet_out>(*msg));
 
       } break;
       case rofl::openflow12::OFPT_FLOW_MOD: {
 
         check_role();
-        dynamic_cast<rofl::openflow::cofmsg_flow_mod &>(*msg)
+        rofl::openflow::cofmsg_cast<rofl::openflow::cofmsg_flow_mod>(*msg)
             .check_prerequisites();
         crofctl_env::call_env(env).handle_flow_mod(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_flow_mod &>(*msg));
+            rofl::openflow::cofmsg_cast<rofl::openflow::cofmsg_flow_mod>(*msg));
 
       } break;
       case rofl::openflow12::OFPT_GROUP_MOD: {
 
         check_role();
-        dynamic_cast<rofl::openflow::cofmsg_group_mod &>(*msg)
+        rofl::openflow::cofmsg_cast<rofl::openflow::cofmsg_group_mod>(*msg)
             .check_prerequisites();
 
         crofctl_env::call_env(env).handle_group_mod(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_group_mod &>(*msg));
+            rofl::openflow::cofmsg_cast<
+                rofl::openflow::cofmsg_group_mod>(*msg));
       } break;
       case rofl::openflow12::OFPT_PORT_MOD: {
 
         check_role();
         crofctl_env::call_env(env).handle_port_mod(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_port_mod &>(*msg));
+            rofl::openflow::cofmsg_cast<rofl::openflow::cofmsg_port_mod>(*msg));
 
       } break;
       case rofl::openflow12::OFPT_TABLE_MOD: {
@@ -249,84 +266,91 @@ void crofctl::handle_recv(crofchan &chan, crofconn &conn,
         check_role();
         crofctl_env::call_env(env).handle_table_mod(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_table_mod &>(*msg));
+            rofl::openflow::cofmsg_cast<
+                rofl::openflow::cofmsg_table_mod>(*msg));
 
       } break;
       case rofl::openflow12::OFPT_STATS_REQUEST: {
 
-        switch (dynamic_cast<rofl::openflow::cofmsg_stats_request &>(*msg)
-                    .get_stats_type()) {
+        switch (rofl::openflow::cofmsg_dispatch::get_stats_type(*msg)) {
         case rofl::openflow12::OFPST_DESC: {
 
           crofctl_env::call_env(env).handle_desc_stats_request(
               *this, conn.get_auxid(),
-              dynamic_cast<rofl::openflow::cofmsg_desc_stats_request &>(*msg));
+              rofl::openflow::cofmsg_cast<
+                  rofl::openflow::cofmsg_desc_stats_request>(*msg));
 
         } break;
         case rofl::openflow12::OFPST_FLOW: {
 
           crofctl_env::call_env(env).handle_flow_stats_request(
               *this, conn.get_auxid(),
-              dynamic_cast<rofl::openflow::cofmsg_flow_stats_request &>(*msg));
+              rofl::openflow::cofmsg_cast<
+                  rofl::openflow::cofmsg_flow_stats_request>(*msg));
 
         } break;
         case rofl::openflow12::OFPST_AGGREGATE: {
 
           crofctl_env::call_env(env).handle_aggregate_stats_request(
               *this, conn.get_auxid(),
-              dynamic_cast<rofl::openflow::cofmsg_aggr_stats_request &>(*msg));
+              rofl::openflow::cofmsg_cast<
+                  rofl::openflow::cofmsg_aggr_stats_request>(*msg));
 
         } break;
         case rofl::openflow12::OFPST_TABLE: {
 
           crofctl_env::call_env(env).handle_table_stats_request(
               *this, conn.get_auxid(),
-              dynamic_cast<rofl::openflow::cofmsg_table_stats_request &>(*msg));
+              rofl::openflow::cofmsg_cast<
+                  rofl::openflow::cofmsg_table_stats_request>(*msg));
 
         } break;
         case rofl::openflow12::OFPST_PORT: {
 
           crofctl_env::call_env(env).handle_port_stats_request(
               *this, conn.get_auxid(),
-              dynamic_cast<rofl::openflow::cofmsg_port_stats_request &>(*msg));
+              rofl::openflow::cofmsg_cast<
+                  rofl::openflow::cofmsg_port_stats_request>(*msg));
 
         } break;
         case rofl::openflow12::OFPST_QUEUE: {
 
           crofctl_env::call_env(env).handle_queue_stats_request(
               *this, conn.get_auxid(),
-              dynamic_cast<rofl::openflow::cofmsg_queue_stats_request &>(*msg));
+              rofl::openflow::cofmsg_cast<
+                  rofl::openflow::cofmsg_queue_stats_request>(*msg));
 
         } break;
         case rofl::openflow12::OFPST_GROUP: {
 
           crofctl_env::call_env(env).handle_group_stats_request(
               *this, conn.get_auxid(),
-              dynamic_cast<rofl::openflow::cofmsg_group_stats_request &>(*msg));
+              rofl::openflow::cofmsg_cast<
+                  rofl::openflow::cofmsg_group_stats_request>(*msg));
 
         } break;
         case rofl::openflow12::OFPST_GROUP_DESC: {
 
           crofctl_env::call_env(env).handle_group_desc_stats_request(
               *this, conn.get_auxid(),
-              dynamic_cast<rofl::openflow::cofmsg_group_desc_stats_request &>(
-                  *msg));
+              rofl::openflow::cofmsg_cast<
+                  rofl::openflow::cofmsg_group_desc_stats_request>(*msg));
 
         } break;
         case rofl::openflow12::OFPST_GROUP_FEATURES: {
 
           crofctl_env::call_env(env).handle_group_features_stats_request(
               *this, conn.get_auxid(),
-              dynamic_cast<
-                  rofl::openflow::cofmsg_group_features_stats_request &>(*msg));
+              rofl::openflow::cofmsg_cast<
+                  rofl::openflow::cofmsg_group_features_stats_request>(*msg));
 
         } break;
         case rofl::openflow12::OFPST_EXPERIMENTER: {
 
           crofctl_env::call_env(env).handle_experimenter_stats_request(
               *this, conn.get_auxid(),
-              dynamic_cast<rofl::openflow::cofmsg_experimenter_stats_request &>(
-                  *msg));
+              rofl::openflow::cofmsg_cast<
+                  rofl::openflow::cofmsg_experimenter_stats_request>(*msg));
 
         } break;
         default: { } break; }
@@ -336,21 +360,23 @@ void crofctl::handle_recv(crofchan &chan, crofconn &conn,
 
         crofctl_env::call_env(env).handle_barrier_request(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_barrier_request &>(*msg));
+            rofl::openflow::cofmsg_cast<
+                rofl::openflow::cofmsg_barrier_request>(*msg));
 
       } break;
       case rofl::openflow12::OFPT_QUEUE_GET_CONFIG_REQUEST: {
 
         crofctl_env::call_env(env).handle_queue_get_config_request(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_queue_get_config_request &>(
-                *msg));
+            rofl::openflow::cofmsg_cast<
+                rofl::openflow::cofmsg_queue_get_config_request>(*msg));
 
       } break;
       case rofl::openflow12::OFPT_ROLE_REQUEST: {
 
         rofl::openflow::cofmsg_role_request &rmsg =
-            dynamic_cast<rofl::openflow::cofmsg_role_request &>(*msg);
+            rofl::openflow::cofmsg_cast<
+                rofl::openflow::cofmsg_role_request>(*msg);
         if (not rmsg.get_role().is_valid_role()) {
           throw eRoleRequestBadRole();
         }
@@ -360,7 +386,8 @@ void crofctl::handle_recv(crofchan &chan, crofconn &conn,
         // necessary for proxy implementations
         crofctl_env::call_env(env).handle_role_request(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_role_request &>(*msg));
+            rofl::openflow::cofmsg_cast<
+                rofl::openflow::cofmsg_role_request>(*msg));
         send_role_reply(conn.get_auxid(), msg->get_xid(), role);
 
       } break;
@@ -374,21 +401,23 @@ void crofctl::handle_recv(crofchan &chan, crofconn &conn,
 
         crofctl_env::call_env(env).handle_experimenter_message(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_experimenter &>(*msg));
+            rofl::openflow::cofmsg_cast<
+                rofl::openflow::cofmsg_experimenter>(*msg));
 
       } break;
       case rofl::openflow13::OFPT_ERROR: {
 
         crofctl_env::call_env(env).handle_error_message(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_error &>(*msg));
+            rofl::openflow::cofmsg_cast<rofl::openflow::cofmsg_error>(*msg));
 
       } break;
       case rofl::openflow13::OFPT_FEATURES_REQUEST: {
 
         crofctl_env::call_env(env).handle_features_request(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_features_request &>(*msg));
+            rofl::openflow::cofmsg_cast<
+                rofl::openflow::cofmsg_features_request>(*msg));
 
       } break;
       case rofl::openflow13::OFPT_GET_CONFIG_REQUEST: {
@@ -396,7 +425,8 @@ void crofctl::handle_recv(crofchan &chan, crofconn &conn,
         check_role();
         crofctl_env::call_env(env).handle_get_config_request(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_get_config_request &>(*msg));
+            rofl::openflow::cofmsg_cast<
+                rofl::openflow::cofmsg_get_config_request>(*msg));
 
       } break;
       case rofl::openflow13::OFPT_SET_CONFIG: {
@@ -404,7 +434,8 @@ void crofctl::handle_recv(crofchan &chan, crofconn &conn,
         check_role();
         crofctl_env::call_env(env).handle_set_config(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_set_config &>(*msg));
+            rofl::openflow::cofmsg_cast<
+                rofl::openflow::cofmsg_set_config>(*msg));
 
       } break;
       case rofl::openflow13::OFPT_PACKET_OUT: {
@@ -412,27 +443,29 @@ void crofctl::handle_recv(crofchan &chan, crofconn &conn,
         check_role();
         crofctl_env::call_env(env).handle_packet_out(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_packet_out &>(*msg));
+            rofl::openflow::cofmsg_cast<
+                rofl::openflow::cofmsg_packet_out>(*msg));
 
       } break;
       case rofl::openflow13::OFPT_FLOW_MOD: {
 
         check_role();
-        dynamic_cast<rofl::openflow::cofmsg_flow_mod &>(*msg)
+        rofl::openflow::cofmsg_cast<rofl::openflow::cofmsg_flow_mod>(*msg)
             .check_prerequisites();
         crofctl_env::call_env(env).handle_flow_mod(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_flow_mod &>(*msg));
+            rofl::openflow::cofmsg_cast<rofl::openflow::cofmsg_flow_mod>(*msg));
 
       } break;
       case rofl::openflow13::OFPT_GROUP_MOD: {
 
         check_role();
-        dynamic_cast<rofl::openflow::cofmsg_group_mod &>(*msg)
+        rofl::openflow::cofmsg_cast<rofl::openflow::cofmsg_group_mod>(*msg)
             .check_prerequisites();
         crofctl_env::call_env(env).handle_group_mod(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_group_mod &>(*msg));
+            rofl::openflow::cofmsg_cast<
+                rofl::openflow::cofmsg_group_mod>(*msg));
 
       } break;
       case rofl::openflow13::OFPT_PORT_MOD: {
@@ -440,7 +473,7 @@ void crofctl::handle_recv(crofchan &chan, crofconn &conn,
         check_role();
         crofctl_env::call_env(env).handle_port_mod(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_port_mod &>(*msg));
+            rofl::openflow::cofmsg_cast<rofl::openflow::cofmsg_port_mod>(*msg));
 
       } break;
       case rofl::openflow13::OFPT_TABLE_MOD: {
@@ -448,123 +481,131 @@ void crofctl::handle_recv(crofchan &chan, crofconn &conn,
         check_role();
         crofctl_env::call_env(env).handle_table_mod(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_table_mod &>(*msg));
+            rofl::openflow::cofmsg_cast<
+                rofl::openflow::cofmsg_table_mod>(*msg));
 
       } break;
       case rofl::openflow13::OFPT_MULTIPART_REQUEST: {
 
-        switch (dynamic_cast<rofl::openflow::cofmsg_stats_request &>(*msg)
-                    .get_stats_type()) {
+        switch (rofl::openflow::cofmsg_dispatch::get_stats_type(*msg)) {
         case rofl::openflow13::OFPMP_DESC: {
 
           crofctl_env::call_env(env).handle_desc_stats_request(
               *this, conn.get_auxid(),
-              dynamic_cast<rofl::openflow::cofmsg_desc_stats_request &>(*msg));
+              rofl::openflow::cofmsg_cast<
+                  rofl::openflow::cofmsg_desc_stats_request>(*msg));
 
         } break;
         case rofl::openflow13::OFPMP_FLOW: {
 
           crofctl_env::call_env(env).handle_flow_stats_request(
               *this, conn.get_auxid(),
-              dynamic_cast<rofl::openflow::cofmsg_flow_stats_request &>(*msg));
+              rofl::openflow::cofmsg_cast<
+                  rofl::openflow::cofmsg_flow_stats_request>(*msg));
 
         } break;
         case rofl::openflow13::OFPMP_AGGREGATE: {
 
           crofctl_env::call_env(env).handle_aggregate_stats_request(
               *this, conn.get_auxid(),
-              dynamic_cast<rofl::openflow::cofmsg_aggr_stats_request &>(*msg));
+              rofl::openflow::cofmsg_cast<
+                  rofl::openflow::cofmsg_aggr_stats_request>(*msg));
 
         } break;
         case rofl::openflow13::OFPMP_TABLE: {
 
           crofctl_env::call_env(env).handle_table_stats_request(
               *this, conn.get_auxid(),
-              dynamic_cast<rofl::openflow::cofmsg_table_stats_request &>(*msg));
+              rofl::openflow::cofmsg_cast<
+                  rofl::openflow::cofmsg_table_stats_request>(*msg));
 
         } break;
         case rofl::openflow13::OFPMP_PORT_STATS: {
 
           crofctl_env::call_env(env).handle_port_stats_request(
               *this, conn.get_auxid(),
-              dynamic_cast<rofl::openflow::cofmsg_port_stats_request &>(*msg));
+              rofl::openflow::cofmsg_cast<
+                  rofl::openflow::cofmsg_port_stats_request>(*msg));
 
         } break;
         case rofl::openflow13::OFPMP_QUEUE: {
 
           crofctl_env::call_env(env).handle_queue_stats_request(
               *this, conn.get_auxid(),
-              dynamic_cast<rofl::openflow::cofmsg_queue_stats_request &>(*msg));
+              rofl::openflow::cofmsg_cast<
+                  rofl::openflow::cofmsg_queue_stats_request>(*msg));
 
         } break;
         case rofl::openflow13::OFPMP_GROUP: {
 
           crofctl_env::call_env(env).handle_group_stats_request(
               *this, conn.get_auxid(),
-              dynamic_cast<rofl::openflow::cofmsg_group_stats_request &>(*msg));
+              rofl::openflow::cofmsg_cast<
+                  rofl::openflow::cofmsg_group_stats_request>(*msg));
 
         } break;
         case rofl::openflow13::OFPMP_GROUP_DESC: {
 
           crofctl_env::call_env(env).handle_group_desc_stats_request(
               *this, conn.get_auxid(),
-              dynamic_cast<rofl::openflow::cofmsg_group_desc_stats_request &>(
-                  *msg));
+              rofl::openflow::cofmsg_cast<
+                  rofl::openflow::cofmsg_group_desc_stats_request>(*msg));
 
         } break;
         case rofl::openflow13::OFPMP_GROUP_FEATURES: {
 
           crofctl_env::call_env(env).handle_group_features_stats_request(
               *this, conn.get_auxid(),
-              dynamic_cast<
-                  rofl::openflow::cofmsg_group_features_stats_request &>(*msg));
+              rofl::openflow::cofmsg_cast<
+                  rofl::openflow::cofmsg_group_features_stats_request>(*msg));
 
         } break;
         case rofl::openflow13::OFPMP_METER: {
 
           crofctl_env::call_env(env).handle_meter_stats_request(
               *this, conn.get_auxid(),
-              dynamic_cast<rofl::openflow::cofmsg_meter_stats_request &>(*msg));
+              rofl::openflow::cofmsg_cast<
+                  rofl::openflow::cofmsg_meter_stats_request>(*msg));
 
         } break;
         case rofl::openflow13::OFPMP_METER_CONFIG: {
 
           crofctl_env::call_env(env).handle_meter_config_stats_request(
               *this, conn.get_auxid(),
-              dynamic_cast<rofl::openflow::cofmsg_meter_config_stats_request &>(
-                  *msg));
+              rofl::openflow::cofmsg_cast<
+                  rofl::openflow::cofmsg_meter_config_stats_request>(*msg));
 
         } break;
         case rofl::openflow13::OFPMP_METER_FEATURES: {
 
           crofctl_env::call_env(env).handle_meter_features_stats_request(
               *this, conn.get_auxid(),
-              dynamic_cast<
-                  rofl::openflow::cofmsg_meter_features_stats_request &>(*msg));
+              rofl::openflow::cofmsg_cast<
+                  rofl::openflow::cofmsg_meter_features_stats_request>(*msg));
 
         } break;
         case rofl::openflow13::OFPMP_TABLE_FEATURES: {
 
           crofctl_env::call_env(env).handle_table_features_stats_request(
               *this, conn.get_auxid(),
-              dynamic_cast<
-                  rofl::openflow::cofmsg_table_features_stats_request &>(*msg));
+              rofl::openflow::cofmsg_cast<
+                  rofl::openflow::cofmsg_table_features_stats_request>(*msg));
 
         } break;
         case rofl::openflow13::OFPMP_PORT_DESC: {
 
           crofctl_env::call_env(env).handle_port_desc_stats_request(
               *this, conn.get_auxid(),
-              dynamic_cast<rofl::openflow::cofmsg_port_desc_stats_request &>(
-                  *msg));
+              rofl::openflow::cofmsg_cast<
+                  rofl::openflow::cofmsg_port_desc_stats_request>(*msg));
 
         } break;
         case rofl::openflow13::OFPMP_EXPERIMENTER: {
 
           crofctl_env::call_env(env).handle_experimenter_stats_request(
               *this, conn.get_auxid(),
-              dynamic_cast<rofl::openflow::cofmsg_experimenter_stats_request &>(
-                  *msg));
+              rofl::openflow::cofmsg_cast<
+                  rofl::openflow::cofmsg_experimenter_stats_request>(*msg));
 
         } break;
         default: { } break; }
@@ -573,17 +614,19 @@ void crofctl::handle_recv(crofchan &chan, crofconn &conn,
       case rofl::openflow13::OFPT_BARRIER_REQUEST: {
         crofctl_env::call_env(env).handle_barrier_request(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_barrier_request &>(*msg));
+            rofl::openflow::cofmsg_cast<
+                rofl::openflow::cofmsg_barrier_request>(*msg));
       } break;
       case rofl::openflow13::OFPT_QUEUE_GET_CONFIG_REQUEST: {
         crofctl_env::call_env(env).handle_queue_get_config_request(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_queue_get_config_request &>(
-                *msg));
+            rofl::openflow::cofmsg_cast<
+                rofl::openflow::cofmsg_queue_get_config_request>(*msg));
       } break;
       case rofl::openflow13::OFPT_ROLE_REQUEST: {
         rofl::openflow::cofmsg_role_request &rmsg =
-            dynamic_cast<rofl::openflow::cofmsg_role_request &>(*msg);
+            rofl::openflow::cofmsg_cast<
+                rofl::openflow::cofmsg_role_request>(*msg);
         if (not rmsg.get_role().is_valid_role()) {
           throw eRoleRequestBadRole();
         }
@@ -593,7 +636,8 @@ void crofctl::handle_recv(crofchan &chan, crofconn &conn,
         // necessary for proxy implementations
         crofctl_env::call_env(env).handle_role_request(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_role_request &>(*msg));
+            rofl::openflow::cofmsg_cast<
+                rofl::openflow::cofmsg_role_request>(*msg));
         send_role_reply(conn.get_auxid(), msg->get_xid(), role);
       } break;
       case rofl::openflow13::OFPT_GET_ASYNC_REQUEST: {
@@ -602,17 +646,20 @@ void crofctl::handle_recv(crofchan &chan, crofconn &conn,
       } break;
       case rofl::openflow13::OFPT_SET_ASYNC: {
         async_config =
-            dynamic_cast<rofl::openflow::cofmsg_set_async_config &>(*msg)
+            rofl::openflow::cofmsg_cast<
+                rofl::openflow::cofmsg_set_async_config>(*msg)
                 .get_async_config();
         crofctl_env::call_env(env).handle_set_async_config(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_set_async_config &>(*msg));
+            rofl::openflow::cofmsg_cast<
+                rofl::openflow::cofmsg_set_async_config>(*msg));
       } break;
       case rofl::openflow13::OFPT_METER_MOD: {
         check_role();
         crofctl_env::call_env(env).handle_meter_mod(
             *this, conn.get_auxid(),
-            dynamic_cast<rofl::openflow::cofmsg_meter_mod &>(*msg));
+            rofl::openflow::cofmsg_cast<
+                rofl::openflow::cofmsg_meter_mod>(*msg));
       } break;
       default: {};
       }
@@ -2130,6 +2177,17 @@ void crofctl::handle_recv(crofchan &chan, crofconn &conn,
   delete msg;
 }
 
+bool crofctl::handle_recv_view(crofchan &chan, crofconn &conn,
+                               const rofl::openflow::cofmsg_view &view) {
+  /* a slave's requests are rejected on the parsed path */
+  if (is_slave()) {
+    return false;
+  }
+
+  return crofctl_env::call_env(env).handle_recv_view(*this, conn.get_auxid(),
+                                                     view);
+}
+
 void crofctl::handle_transaction_timeout(crofchan &chan, crofconn &conn,
                                          uint32_t xid, uint8_t type,
                                          uint16_t sub_type) {
@@ -2552,33 +2610,8 @@ rofl::crofsock::msg_result_t crofctl::send_packet_in_message(
     const rofl::openflow::cofmatch &match, uint8_t *data, size_t datalen) {
   rofl::openflow::cofmsg *msg = nullptr;
   try {
-    switch (rofchan.get_version()) {
-    case rofl::openflow12::OFP_VERSION: {
-      if (is_slave()) {
-        return rofl::crofsock::MSG_IGNORED;
-      }
-    } break;
-    case rofl::openflow13::OFP_VERSION: {
-      switch (role.get_role()) {
-      case rofl::openflow13::OFPCR_ROLE_EQUAL:
-      case rofl::openflow13::OFPCR_ROLE_MASTER: {
-        if (not(async_config.get_packet_in_mask_master() & (1 << reason))) {
-          return rofl::crofsock::MSG_IGNORED;
-        }
-      } break;
-      case rofl::openflow13::OFPCR_ROLE_SLAVE: {
-        if (not(async_config.get_packet_in_mask_slave() & (1 << reason))) {
-          return rofl::crofsock::MSG_IGNORED;
-        }
-      } break;
-      default: {
-        // unknown role: send packet-in to controller
-      };
-      }
-    } break;
-    default: {
-      // send packet-in
-    };
+    if (packet_in_filtered(reason)) {
+      return rofl::crofsock::MSG_IGNORED;
     }
 
     msg = new rofl::openflow::cofmsg_packet_in(
@@ -2599,6 +2632,49 @@ rofl::crofsock::msg_result_t crofctl::send_packet_in_message(
   }
 }
 
+rofl::crofbuilder_packet_in crofctl::build_packet_in(const cauxid &auxid,
+                                                     uint8_t reason) {
+  rofl::crofbuilder_packet_in builder(&rofchan, auxid, rofchan.get_version(),
+                                      ++xid_last);
+  builder.reason(reason);
+  if (packet_in_filtered(reason)) {
+    builder.set_ignored();
+  }
+  return builder;
+}
+
+bool crofctl::packet_in_filtered(uint8_t reason) const {
+  switch (rofchan.get_version()) {
+  case rofl::openflow12::OFP_VERSION: {
+    if (is_slave()) {
+      return true;
+    }
+  } break;
+  case rofl::openflow13::OFP_VERSION: {
+    switch (role.get_role()) {
+    case rofl::openflow13::OFPCR_ROLE_EQUAL:
+    case rofl::openflow13::OFPCR_ROLE_MASTER: {
+      if (not(async_config.get_packet_in_mask_master() & (1 << reason))) {
+        return true;
+      }
+    } break;
+    case rofl::openflow13::OFPCR_ROLE_SLAVE: {
+      if (not(async_config.get_packet_in_mask_slave() & (1 << reason))) {
+        return true;
+      }
+    } break;
+    default: {
+      // unknown role: send packet-in to controller
+    };
+    }
+  } break;
+  default: {
+    // send packet-in
+  };
+  }
+  return false;
+}
+
 rofl::crofsock::msg_result_t crofctl::send_barrier_reply(const cauxid &auxid,
                                                          uint32_t xid) {
   rofl::openflow::cofmsg *msg = nullptr;
@@ -20,6 +20,7 @@
 #include "rofl/common/cauxid.h"
 #include "rofl/common/cctlid.h"
 #include "rofl/common/cmemory.h"
+#include "rofl/common/crofbuilder.hpp"
 #include "rofl/common/crofchan.h"
 #include "rofl/common/exception.hpp"
 #include "rofl/common/locking.hpp"
@@ -482,6 +483,21 @@ protected:
   virtual void handle_packet_out(rofl::crofctl &ctl, const rofl::cauxid &auxid,
                                  rofl::openflow::cofmsg_packet_out &msg){};
 
+  /**
+   * @brief	OpenFlow message received as view, see crofctl::set_rx_view().
+   *
+   * The view may be copied for use beyond this call.
+   *
+   * @param ctl controller instance
+   * @param auxid control connection identifier
+   * @param view view of OpenFlow message in receive buffer
+   * @return false for receiving the message via its specific handler
+   */
+  virtual bool handle_recv_view(rofl::crofctl &ctl, const rofl::cauxid &auxid,
+                                const rofl::openflow::cofmsg_view &view) {
+    return false;
+  };
+
   /**
    * @brief	OpenFlow Barrier-Request message received.
    *
@@ -666,8 +682,9 @@ public:
    * @param env pointer to rofl::crofctl_env instance defining the environment
    * for this object
    * @param ctlid rofl-common's internal identifier for this instance
+   * @param pool reactor pool for all control connections or nullptr
    */
-  crofctl(crofctl_env *env, const cctlid &ctlid);
+  crofctl(crofctl_env *env, const cctlid &ctlid, cthread_pool *pool = nullptr);
 
 public:
   /**
@@ -829,6 +846,24 @@ public:
    */
   bool has_conn(const cauxid &auxid) const { return rofchan.has_conn(auxid); };
 
+public:
+  /**
+   * @brief	Returns true, when messages of type are received as views
+   */
+  bool get_rx_view(uint8_t type) const { return rofchan.get_rx_view(type); };
+
+  /**
+   * @brief	Hands over messages of type as cofmsg_view without parsing
+   *
+   * Views are delivered via crofctl_env::handle_recv_view(). Messages
+   * from a controller in slave role are always parsed for rejecting
+   * state changes.
+   */
+  crofctl &set_rx_view(uint8_t type, bool enable = true) {
+    rofchan.set_rx_view(type, enable);
+    return *this;
+  };
+
 public:
   /**
    * @name	Methods for sending OpenFlow messages
@@ -1207,6 +1242,42 @@ public:
 
   /**@}*/
 
+public:
+  /**
+   * @name	Methods for building OpenFlow messages in wire format
+   *
+   * The returned builder writes the message directly into a frame and
+   * sends it on commit(), bypassing the cofmsg object model.
+   */
+
+  /**@{*/
+
+  /**
+   * @brief	Returns a Packet-In builder for the attached controller entity.
+   *
+   * The reason is checked against role and asynchronous configuration
+   * upfront, commit() returns MSG_IGNORED for filtered Packet-Ins.
+   *
+   * @param reason reason packet is being sent (one of OFPR_* flags)
+   * @exception rofl::eBadVersion OpenFlow 1.0 is not supported
+   */
+  rofl::crofbuilder_packet_in build_packet_in(const rofl::cauxid &auxid,
+                                              uint8_t reason);
+
+  /**
+   * @brief	Returns a Barrier-Reply builder for the attached controller
+   * entity.
+   *
+   * @param xid OpenFlow transaction identifier
+   */
+  rofl::crofbuilder_barrier_reply build_barrier_reply(const rofl::cauxid &auxid,
+                                                      uint32_t xid) {
+    return rofl::crofbuilder_barrier_reply(&rofchan, auxid,
+                                           rofchan.get_version(), xid);
+  };
+
+  /**@}*/
+
 public:
   /**
    *
@@ -1299,9 +1370,14 @@ private:
   virtual void handle_recv(rofl::crofchan &chan, rofl::crofconn &conn,
                            rofl::openflow::cofmsg *msg);
 
+  virtual bool handle_recv_view(rofl::crofchan &chan, rofl::crofconn &conn,
+                                const rofl::openflow::cofmsg_view &view);
+
 private:
   void init_async_config_role_default_template();
 
+  bool packet_in_filtered(uint8_t reason) const;
+
 private:
   // environment
   rofl::crofctl_env *env;
@@ -20,8 +20,9 @@ using namespace rofl;
 
 crofdpt::~crofdpt(){};
 
-crofdpt::crofdpt(rofl::crofdpt_env *env, const rofl::cdptid &dptid)
-    : env(env), dptid(dptid), snoop(true), rofchan(this),
+crofdpt::crofdpt(rofl::crofdpt_env *env, const rofl::cdptid &dptid,
+                 rofl::cthread_pool *pool)
+    : env(env), dptid(dptid), snoop(true), rofchan(this, pool),
       xid_last(random.uint32()), n_buffers(0), n_tables(0), capabilities(0),
       miss_send_len(0), flags(0){};
 
@@ -159,6 +160,21 @@ void crofdpt::handle_recv(rofl::crofchan &chan, rofl::crofconn &conn,
   delete msg;
 }
 
+bool crofdpt::handle_recv_view(rofl::crofchan &chan, rofl::crofconn &conn,
+                               const rofl::openflow::cofmsg_view &view) {
+  /* messages updating the datapath's state take the parsed path */
+  switch (view.get_type()) {
+  case rofl::openflow::OFPT_FEATURES_REPLY:
+  case rofl::openflow::OFPT_GET_CONFIG_REPLY:
+  case rofl::openflow::OFPT_PORT_STATUS:
+    return false;
+  default:;
+  }
+
+  return crofdpt_env::call_env(env).handle_recv_view(*this, conn.get_auxid(),
+                                                     view);
+}
+
 void crofdpt::handle_transaction_timeout(crofchan &chan, crofconn &conn,
                                          uint32_t xid, uint8_t type,
                                          uint16_t sub_type) {
@@ -412,7 +428,7 @@ void crofdpt::handle_transaction_timeout(crofchan &chan, crofconn &conn,
 void crofdpt::features_reply_rcvd(const rofl::cauxid &auxid,
                                   rofl::openflow::cofmsg *msg) {
   rofl::openflow::cofmsg_features_reply &reply =
-      dynamic_cast<rofl::openflow::cofmsg_features_reply &>(*msg);
+      rofl::openflow::cofmsg_cast<rofl::openflow::cofmsg_features_reply>(*msg);
 
   if (snoop) {
     dpid = rofl::cdpid(reply.get_dpid());
@@ -446,7 +462,8 @@ void crofdpt::features_reply_rcvd(const rofl::cauxid &auxid,
 void crofdpt::get_config_reply_rcvd(const rofl::cauxid &auxid,
                                     rofl::openflow::cofmsg *msg) {
   rofl::openflow::cofmsg_get_config_reply &reply =
-      dynamic_cast<rofl::openflow::cofmsg_get_config_reply &>(*msg);
+      rofl::openflow::cofmsg_cast<
+          rofl::openflow::cofmsg_get_config_reply>(*msg);
 
   if (snoop) {
     flags = reply.get_flags();
@@ -459,7 +476,7 @@ void crofdpt::get_config_reply_rcvd(const rofl::cauxid &auxid,
 void crofdpt::multipart_reply_rcvd(const rofl::cauxid &auxid,
                                    rofl::openflow::cofmsg *msg) {
   rofl::openflow::cofmsg_stats_reply *reply =
-      dynamic_cast<rofl::openflow::cofmsg_stats_reply *>(msg);
+      rofl::openflow::cofmsg_cast<rofl::openflow::cofmsg_stats_reply>(msg);
   assert(reply != NULL);
 
   switch (reply->get_stats_type()) {
@@ -515,7 +532,8 @@ void crofdpt::multipart_reply_rcvd(const rofl::cauxid &auxid,
 void crofdpt::desc_stats_reply_rcvd(const rofl::cauxid &auxid,
                                     rofl::openflow::cofmsg *msg) {
   rofl::openflow::cofmsg_desc_stats_reply &reply =
-      dynamic_cast<rofl::openflow::cofmsg_desc_stats_reply &>(*msg);
+      rofl::openflow::cofmsg_cast<
+          rofl::openflow::cofmsg_desc_stats_reply>(*msg);
 
   crofdpt_env::call_env(env).handle_desc_stats_reply(*this, auxid, reply);
 }
@@ -523,7 +541,8 @@ void crofdpt::desc_stats_reply_rcvd(const rofl::cauxid &auxid,
 void crofdpt::table_stats_reply_rcvd(const rofl::cauxid &auxid,
                                      rofl::openflow::cofmsg *msg) {
   rofl::openflow::cofmsg_table_stats_reply &reply =
-      dynamic_cast<rofl::openflow::cofmsg_table_stats_reply &>(*msg);
+      rofl::openflow::cofmsg_cast<
+          rofl::openflow::cofmsg_table_stats_reply>(*msg);
 
   crofdpt_env::call_env(env).handle_table_stats_reply(*this, auxid, reply);
 }
@@ -531,7 +550,8 @@ void crofdpt::table_stats_reply_rcvd(const rofl::cauxid &auxid,
 void crofdpt::port_stats_reply_rcvd(const rofl::cauxid &auxid,
                                     rofl::openflow::cofmsg *msg) {
   rofl::openflow::cofmsg_port_stats_reply &reply =
-      dynamic_cast<rofl::openflow::cofmsg_port_stats_reply &>(*msg);
+      rofl::openflow::cofmsg_cast<
+          rofl::openflow::cofmsg_port_stats_reply>(*msg);
 
   crofdpt_env::call_env(env).handle_port_stats_reply(*this, auxid, reply);
 }
@@ -539,7 +559,8 @@ void crofdpt::port_stats_reply_rcvd(const rofl::cauxid &auxid,
 void crofdpt::flow_stats_reply_rcvd(const rofl::cauxid &auxid,
                                     rofl::openflow::cofmsg *msg) {
   rofl::openflow::cofmsg_flow_stats_reply &reply =
-      dynamic_cast<rofl::openflow::cofmsg_flow_stats_reply &>(*msg);
+      rofl::openflow::cofmsg_cast<
+          rofl::openflow::cofmsg_flow_stats_reply>(*msg);
 
   crofdpt_env::call_env(env).handle_flow_stats_reply(*this, auxid, reply);
 }
@@ -547,7 +568,8 @@ void crofdpt::flow_stats_reply_rcvd(const rofl::cauxid &auxid,
 void crofdpt::aggregate_stats_reply_rcvd(const rofl::cauxid &auxid,
                                          rofl::openflow::cofmsg *msg) {
   rofl::openflow::cofmsg_aggr_stats_reply &reply =
-      dynamic_cast<rofl::openflow::cofmsg_aggr_stats_reply &>(*msg);
+      rofl::openflow::cofmsg_cast<
+          rofl::openflow::cofmsg_aggr_stats_reply>(*msg);
 
   crofdpt_env::call_env(env).handle_aggregate_stats_reply(*this, auxid, reply);
 }
@@ -555,7 +577,8 @@ void crofdpt::aggregate_stats_reply_rcvd(const rofl::cauxid &auxid,
 void crofdpt::queue_stats_reply_rcvd(const rofl::cauxid &auxid,
                                      rofl::openflow::cofmsg *msg) {
   rofl::openflow::cofmsg_queue_stats_reply &reply =
-      dynamic_cast<rofl::openflow::cofmsg_queue_stats_reply &>(*msg);
+      rofl::openflow::cofmsg_cast<
+          rofl::openflow::cofmsg_queue_stats_reply>(*msg);
 
   crofdpt_env::call_env(env).handle_queue_stats_reply(*this, auxid, reply);
 }
@@ -563,7 +586,8 @@ void crofdpt::queue_stats_reply_rcvd(const rofl::cauxid &auxid,
 void crofdpt::group_stats_reply_rcvd(const rofl::cauxid &auxid,
                                      rofl::openflow::cofmsg *msg) {
   rofl::openflow::cofmsg_group_stats_reply &reply =
-      dynamic_cast<rofl::openflow::cofmsg_group_stats_reply &>(*msg);
+      rofl::openflow::cofmsg_cast<
+          rofl::openflow::cofmsg_group_stats_reply>(*msg);
 
   crofdpt_env::call_env(env).handle_group_stats_reply(*this, auxid, reply);
 }
@@ -571,7 +595,8 @@ void crofdpt::group_stats_reply_rcvd(const rofl::cauxid &auxid,
 void crofdpt::group_desc_stats_reply_rcvd(const rofl::cauxid &auxid,
                                           rofl::openflow::cofmsg *msg) {
   rofl::openflow::cofmsg_group_desc_stats_reply &reply =
-      dynamic_cast<rofl::openflow::cofmsg_group_desc_stats_reply &>(*msg);
+      rofl::openflow::cofmsg_cast<
+          rofl::openflow::cofmsg_group_desc_stats_reply>(*msg);
 
   crofdpt_env::call_env(env).handle_group_desc_stats_reply(*this, auxid, reply);
 }
@@ -579,7 +604,8 @@ void crofdpt::group_desc_stats_reply_rcvd(const rofl::cauxid &auxid,
 void crofdpt::group_features_stats_reply_rcvd(const rofl::cauxid &auxid,
                                               rofl::openflow::cofmsg *msg) {
   rofl::openflow::cofmsg_group_features_stats_reply &reply =
-      dynamic_cast<rofl::openflow::cofmsg_group_features_stats_reply &>(*msg);
+      rofl::openflow::cofmsg_cast<
+          rofl::openflow::cofmsg_group_features_stats_reply>(*msg);
 
   if (snoop) {
     switch (get_version()) {
@@ -597,7 +623,8 @@ void crofdpt::group_features_stats_reply_rcvd(const rofl::cauxid &auxid,
 void crofdpt::meter_stats_reply_rcvd(const rofl::cauxid &auxid,
                                      rofl::openflow::cofmsg *msg) {
   rofl::openflow::cofmsg_meter_stats_reply &reply =
-      dynamic_cast<rofl::openflow::cofmsg_meter_stats_reply &>(*msg);
+      rofl::openflow::cofmsg_cast<
+          rofl::openflow::cofmsg_meter_stats_reply>(*msg);
 
   crofdpt_env::call_env(env).handle_meter_stats_reply(*this, auxid, reply);
 }
@@ -605,7 +632,8 @@ void crofdpt::meter_stats_reply_rcvd(const rofl::cauxid &auxid,
 void crofdpt::meter_config_stats_reply_rcvd(const rofl::cauxid &auxid,
                                             rofl::openflow::cofmsg *msg) {
   rofl::openflow::cofmsg_meter_config_stats_reply &reply =
-      dynamic_cast<rofl::openflow::cofmsg_meter_config_stats_reply &>(*msg);
+      rofl::openflow::cofmsg_cast<
+          rofl::openflow::cofmsg_meter_config_stats_reply>(*msg);
 
   crofdpt_env::call_env(env).handle_meter_config_stats_reply(*this, auxid,
                                                              reply);
@@ -614,7 +642,8 @@ void crofdpt::meter_config_stats_reply_rcvd(const rofl::cauxid &auxid,
 void crofdpt::meter_features_stats_reply_rcvd(const rofl::cauxid &auxid,
                                               rofl::openflow::cofmsg *msg) {
   rofl::openflow::cofmsg_meter_features_stats_reply &reply =
-      dynamic_cast<rofl::openflow::cofmsg_meter_features_stats_reply &>(*msg);
+      rofl::openflow::cofmsg_cast<
+          rofl::openflow::cofmsg_meter_features_stats_reply>(*msg);
 
   crofdpt_env::call_env(env).handle_meter_features_stats_reply(*this, auxid,
                                                                reply);
@@ -623,7 +652,8 @@ void crofdpt::meter_features_stats_reply_rcvd(const rofl::cauxid &auxid,
 void crofdpt::table_features_stats_reply_rcvd(const rofl::cauxid &auxid,
                                               rofl::openflow::cofmsg *msg) {
   rofl::openflow::cofmsg_table_features_stats_reply &reply =
-      dynamic_cast<rofl::openflow::cofmsg_table_features_stats_reply &>(*msg);
+      rofl::openflow::cofmsg_cast<
+          rofl::openflow::cofmsg_table_features_stats_reply>(*msg);
 
   if (snoop) {
     switch (get_version()) {
@@ -642,7 +672,8 @@ void crofdpt::table_features_stats_reply_rcvd(const rofl::cauxid &auxid,
 void crofdpt::port_desc_stats_reply_rcvd(const rofl::cauxid &auxid,
                                          rofl::openflow::cofmsg *msg) {
   rofl::openflow::cofmsg_port_desc_stats_reply &reply =
-      dynamic_cast<rofl::openflow::cofmsg_port_desc_stats_reply &>(*msg);
+      rofl::openflow::cofmsg_cast<
+          rofl::openflow::cofmsg_port_desc_stats_reply>(*msg);
 
   if (snoop) {
     switch (get_version()) {
@@ -660,7 +691,8 @@ void crofdpt::port_desc_stats_reply_rcvd(const rofl::cauxid &auxid,
 void crofdpt::experimenter_stats_reply_rcvd(const rofl::cauxid &auxid,
                                             rofl::openflow::cofmsg *msg) {
   rofl::openflow::cofmsg_experimenter_stats_reply &reply =
-      dynamic_cast<rofl::openflow::cofmsg_experimenter_stats_reply &>(*msg);
+      rofl::openflow::cofmsg_cast<
+          rofl::openflow::cofmsg_experimenter_stats_reply>(*msg);
 
   crofdpt_env::call_env(env).handle_experimenter_stats_reply(*this, auxid,
                                                              reply);
@@ -669,7 +701,7 @@ void crofdpt::experimenter_stats_reply_rcvd(const rofl::cauxid &auxid,
 void crofdpt::barrier_reply_rcvd(const rofl::cauxid &auxid,
                                  rofl::openflow::cofmsg *msg) {
   rofl::openflow::cofmsg_barrier_reply &reply =
-      dynamic_cast<rofl::openflow::cofmsg_barrier_reply &>(*msg);
+      rofl::openflow::cofmsg_cast<rofl::openflow::cofmsg_barrier_reply>(*msg);
 
   crofdpt_env::call_env(env).handle_barrier_reply(*this, auxid, reply);
 }
@@ -677,7 +709,7 @@ void crofdpt::barrier_reply_rcvd(const rofl::cauxid &auxid,
 void crofdpt::flow_removed_rcvd(const rofl::cauxid &auxid,
                                 rofl::openflow::cofmsg *msg) {
   rofl::openflow::cofmsg_flow_removed &flow_removed =
-      dynamic_cast<rofl::openflow::cofmsg_flow_removed &>(*msg);
+      rofl::openflow::cofmsg_cast<rofl::openflow::cofmsg_flow_removed>(*msg);
 
   crofdpt_env::call_env(env).handle_flow_removed(*this, auxid, flow_removed);
 }
@@ -685,7 +717,7 @@ void crofdpt::flow_removed_rcvd(const rofl::cauxid &auxid,
 void crofdpt::packet_in_rcvd(const rofl::cauxid &auxid,
                              rofl::openflow::cofmsg *msg) {
   rofl::openflow::cofmsg_packet_in &packet_in =
-      dynamic_cast<rofl::openflow::cofmsg_packet_in &>(*msg);
+      rofl::openflow::cofmsg_cast<rofl::openflow::cofmsg_packet_in>(*msg);
 
   crofdpt_env::call_env(env).handle_packet_in(*this, auxid, packet_in);
 }
@@ -693,7 +725,7 @@ void crofdpt::packet_in_rcvd(const rofl::cauxid &auxid,
 void crofdpt::port_status_rcvd(const rofl::cauxid &auxid,
                                rofl::openflow::cofmsg *msg) {
   rofl::openflow::cofmsg_port_status &port_status =
-      dynamic_cast<rofl::openflow::cofmsg_port_status &>(*msg);
+      rofl::openflow::cofmsg_cast<rofl::openflow::cofmsg_port_status>(*msg);
 
   if (snoop) {
     ports.set_version(rofchan.get_version());
@@ -719,7 +751,7 @@ void crofdpt::port_status_rcvd(const rofl::cauxid &auxid,
 void crofdpt::experimenter_rcvd(const rofl::cauxid &auxid,
                                 rofl::openflow::cofmsg *msg) {
   rofl::openflow::cofmsg_experimenter &exp =
-      dynamic_cast<rofl::openflow::cofmsg_experimenter &>(*msg);
+      rofl::openflow::cofmsg_cast<rofl::openflow::cofmsg_experimenter>(*msg);
 
   crofdpt_env::call_env(env).handle_experimenter_message(*this, auxid, exp);
 }
@@ -727,7 +759,7 @@ void crofdpt::experimenter_rcvd(const rofl::cauxid &auxid,
 void crofdpt::error_rcvd(const rofl::cauxid &auxid,
                          rofl::openflow::cofmsg *msg) {
   rofl::openflow::cofmsg_error &error =
-      dynamic_cast<rofl::openflow::cofmsg_error &>(*msg);
+      rofl::openflow::cofmsg_cast<rofl::openflow::cofmsg_error>(*msg);
 
   crofdpt_env::call_env(env).handle_error_message(*this, auxid, error);
 }
@@ -735,7 +767,7 @@ void crofdpt::error_rcvd(const rofl::cauxid &auxid,
 void crofdpt::role_reply_rcvd(const rofl::cauxid &auxid,
                               rofl::openflow::cofmsg *msg) {
   rofl::openflow::cofmsg_role_reply &reply =
-      dynamic_cast<rofl::openflow::cofmsg_role_reply &>(*msg);
+      rofl::openflow::cofmsg_cast<rofl::openflow::cofmsg_role_reply>(*msg);
 
   crofdpt_env::call_env(env).handle_role_reply(*this, auxid, reply);
 }
@@ -743,7 +775,8 @@ void crofdpt::role_reply_rcvd(const rofl::cauxid &auxid,
 void crofdpt::queue_get_config_reply_rcvd(const rofl::cauxid &auxid,
                                           rofl::openflow::cofmsg *msg) {
   rofl::openflow::cofmsg_queue_get_config_reply &reply =
-      dynamic_cast<rofl::openflow::cofmsg_queue_get_config_reply &>(*msg);
+      rofl::openflow::cofmsg_cast<
+          rofl::openflow::cofmsg_queue_get_config_reply>(*msg);
 
   crofdpt_env::call_env(env).handle_queue_get_config_reply(*this, auxid, reply);
 }
@@ -751,7 +784,8 @@ void crofdpt::queue_get_config_reply_rcvd(const rofl::cauxid &auxid,
 void crofdpt::get_async_config_reply_rcvd(const rofl::cauxid &auxid,
                                           rofl::openflow::cofmsg *msg) {
   rofl::openflow::cofmsg_get_async_config_reply &reply =
-      dynamic_cast<rofl::openflow::cofmsg_get_async_config_reply &>(*msg);
+      rofl::openflow::cofmsg_cast<
+          rofl::openflow::cofmsg_get_async_config_reply>(*msg);
 
   crofdpt_env::call_env(env).handle_get_async_config_reply(*this, auxid, reply);
 }
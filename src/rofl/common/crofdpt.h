@@ -28,8 +28,10 @@
 #include "rofl/common/cdpid.h"
 #include "rofl/common/cdptid.h"
 #include "rofl/common/crandom.h"
+#include "rofl/common/crofbuilder.hpp"
 #include "rofl/common/crofchan.h"
 #include "rofl/common/crofqueue.h"
+#include "rofl/common/croftemplate.hpp"
 #include "rofl/common/exception.hpp"
 
 #include "rofl/common/openflow/cofasyncconfig.h"
@@ -707,6 +709,21 @@ protected:
   virtual void handle_packet_in(rofl::crofdpt &dpt, const rofl::cauxid &auxid,
                                 rofl::openflow::cofmsg_packet_in &msg){};
 
+  /**
+   * @brief	OpenFlow message received as view, see crofdpt::set_rx_view().
+   *
+   * The view may be copied for use beyond this call.
+   *
+   * @param dpt datapath instance
+   * @param auxid control connection identifier
+   * @param view view of OpenFlow message in receive buffer
+   * @return false for receiving the message via its specific handler
+   */
+  virtual bool handle_recv_view(rofl::crofdpt &dpt, const rofl::cauxid &auxid,
+                                const rofl::openflow::cofmsg_view &view) {
+    return false;
+  };
+
   /**
    * @brief	OpenFlow Barrier-Reply message received.
    *
@@ -893,8 +910,10 @@ public:
    * @param env pointer to rofl::crofdpt_env instance defining the environment
    * for this object
    * @param dptid rofl-common's internal identifier for this instance
+   * @param pool reactor pool for all control connections or nullptr
    */
-  crofdpt(rofl::crofdpt_env *env, const rofl::cdptid &dptid);
+  crofdpt(rofl::crofdpt_env *env, const rofl::cdptid &dptid,
+          rofl::cthread_pool *pool = nullptr);
 
 public:
   /**
@@ -1111,6 +1130,24 @@ public:
    */
   bool has_conn(const cauxid &auxid) const { return rofchan.has_conn(auxid); };
 
+public:
+  /**
+   * @brief	Returns true, when messages of type are received as views
+   */
+  bool get_rx_view(uint8_t type) const { return rofchan.get_rx_view(type); };
+
+  /**
+   * @brief	Hands over messages of type as cofmsg_view without parsing
+   *
+   * Views are delivered via crofdpt_env::handle_recv_view().
+   * Features-Reply, Get-Config-Reply and Port-Status messages are always
+   * parsed by crofdpt for keeping its state.
+   */
+  crofdpt &set_rx_view(uint8_t type, bool enable = true) {
+    rofchan.set_rx_view(type, enable);
+    return *this;
+  };
+
 public:
   /**
    * @name	Methods for sending OpenFlow messages
@@ -1623,6 +1660,71 @@ public:
 
   /**@}*/
 
+public:
+  /**
+   * @name	Methods for building OpenFlow messages in wire format
+   *
+   * The returned builder writes the message directly into a frame and
+   * sends it on commit(), bypassing the cofmsg object model.
+   */
+
+  /**@{*/
+
+  /**
+   * @brief	Returns a Flow-Mod builder for the attached datapath element.
+   *
+   * @param auxid controller connection identifier
+   * @exception rofl::eBadVersion OpenFlow 1.0 is not supported
+   */
+  rofl::crofbuilder_flow_mod build_flow_mod(const rofl::cauxid &auxid) {
+    return rofl::crofbuilder_flow_mod(&rofchan, auxid, rofchan.get_version(),
+                                      ++xid_last);
+  };
+
+  /**
+   * @brief	Returns a Packet-Out builder for the attached datapath element.
+   *
+   * @param auxid controller connection identifier
+   * @exception rofl::eBadVersion OpenFlow 1.0 is not supported
+   */
+  rofl::crofbuilder_packet_out build_packet_out(const rofl::cauxid &auxid) {
+    return rofl::crofbuilder_packet_out(&rofchan, auxid, rofchan.get_version(),
+                                        ++xid_last);
+  };
+
+  /**
+   * @brief	Returns a builder for a copy of a Flow-Mod or Packet-Out
+   * template, the template counterpart of send_flow_mod_message() and
+   * send_packet_out_message().
+   *
+   * @param auxid controller connection identifier
+   * @param tmpl template packed for the negotiated OpenFlow version
+   * @exception rofl::eBadVersion template version mismatch
+   */
+  rofl::crofbuilder_template
+  build_from_template(const rofl::cauxid &auxid,
+                      const rofl::croftemplate &tmpl) {
+    return rofl::crofbuilder_template(&rofchan, auxid, rofchan.get_version(),
+                                      ++xid_last, tmpl);
+  };
+
+  /**
+   * @brief	Returns a Barrier-Request builder for the attached datapath
+   * element.
+   *
+   * @param auxid controller connection identifier
+   * @param timeout until this request expires
+   */
+  rofl::crofbuilder_barrier_request
+  build_barrier_request(const rofl::cauxid &auxid,
+                        int timeout_in_secs = DEFAULT_REQUEST_TIMEOUT) {
+    return rofl::crofbuilder_barrier_request(
+        &rofchan, auxid, rofchan.get_version(), ++xid_last,
+        ctimespec().expire_in(timeout_in_secs));
+  };
+
+  /**@}*/
+
 public:
   /**
    * @brief 	Predicate for finding a rofl::crofdpt instance by its
@@ -1720,6 +1822,9 @@ private:
   virtual void handle_recv(rofl::crofchan &chan, rofl::crofconn &conn,
                            rofl::openflow::cofmsg *msg);
 
+  virtual bool handle_recv_view(rofl::crofchan &chan, rofl::crofconn &conn,
+                                const rofl::openflow::cofmsg_view &view);
+
 private:
   void experimenter_rcvd(const rofl::cauxid &auxid,
                          rofl::openflow::cofmsg *msg);
@@ -0,0 +1,181 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/*
+ * crofframe.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef SRC_ROFL_COMMON_CROFFRAME_HPP_
+#define SRC_ROFL_COMMON_CROFFRAME_HPP_
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <new>
+#include <ostream>
+#include <sstream>
+
+#include "rofl/common/exception.hpp"
+#include "rofl/common/openflow/openflow.h"
+
+namespace rofl {
+
+class eRofFrameBase : public exception {
+public:
+  eRofFrameBase(const std::string &__arg,
+                const std::string &__file = std::string(""),
+                const std::string &__func = std::string(""), int __line = 0)
+      : exception(__arg, __file, __func, __line){};
+};
+class eRofFrameTooLong : public eRofFrameBase {
+public:
+  eRofFrameTooLong(const std::string &__arg,
+                   const std::string &__file = std::string(""),
+                   const std::string &__func = std::string(""), int __line = 0)
+      : eRofFrameBase(__arg, __file, __func, __line){};
+};
+
+/**
+ * @brief	OpenFlow message in wire format
+ *
+ * Frames are written in place by the crofbuilder classes and queued by
+ * crofsock alongside cofmsg instances. On transmission a frame is copied
+ * verbatim into the socket's tx buffer, no object graph is involved.
+ */
+class crofframe {
+public:
+  /**
+   *
+   */
+  ~crofframe() {
+    if (buf != inline_buf)
+      ::free(buf);
+  };
+
+  /**
+   *
+   */
+  crofframe() : buf(inline_buf), len(0), cap(sizeof(inline_buf)){};
+
+private:
+  crofframe(const crofframe &frame);
+
+  crofframe &operator=(const crofframe &frame);
+
+public:
+  /**
+   * @brief	Appends buflen zeroed bytes and returns their offset
+   *
+   * Pointers into the frame are invalidated by append().
+   *
+   * @throws eRofFrameTooLong frame exceeds maximum OpenFlow message length
+   */
+  size_t append(size_t buflen) {
+    if (len + buflen > FRAME_MAX_LENGTH) {
+      throw eRofFrameTooLong("crofframe::append() frame too long", __FILE__,
+                             __FUNCTION__, __LINE__);
+    }
+    if (len + buflen > cap) {
+      size_t size = 2 * cap;
+      while (size < len + buflen)
+        size *= 2;
+      uint8_t *mem = (uint8_t *)::malloc(size);
+      if (nullptr == mem)
+        throw std::bad_alloc();
+      memcpy(mem, buf, len);
+      if (buf != inline_buf)
+        ::free(buf);
+      buf = mem;
+      cap = size;
+    }
+    size_t offset = len;
+    memset(buf + len, 0, buflen);
+    len += buflen;
+    return offset;
+  };
+
+  /**
+   * @brief	Appends a copy of data and returns its offset
+   */
+  size_t append(const void *data, size_t datalen) {
+    size_t offset = append(datalen);
+    if (datalen > 0)
+      memcpy(buf + offset, data, datalen);
+    return offset;
+  };
+
+  /**
+   * @brief	Returns pointer to byte at offset
+   */
+  uint8_t *at(size_t offset) { return buf + offset; };
+
+  /**
+   *
+   */
+  const uint8_t *somem() const { return buf; };
+
+  /**
+   *
+   */
+  size_t length() const { return len; };
+
+public:
+  /**
+   *
+   */
+  uint8_t get_version() const { return header()->version; };
+
+  /**
+   *
+   */
+  uint8_t get_type() const { return header()->type; };
+
+  /**
+   *
+   */
+  uint32_t get_xid() const { return be32toh(header()->xid); };
+
+public:
+  friend std::ostream &operator<<(std::ostream &os, const crofframe &frame) {
+    os << "<crofframe version: " << (int)frame.get_version()
+       << " type: " << (int)frame.get_type() << " length: " << frame.length()
+       << " xid: 0x" << std::hex << frame.get_xid() << std::dec << " >"
+       << std::endl;
+    return os;
+  };
+
+  /**
+   *
+   */
+  std::string str() const {
+    std::stringstream ss;
+    ss << "FRAME:{version: " << (int)get_version()
+       << ", type: " << (int)get_type() << ", len: " << length()
+       << ", xid: 0x" << std::hex << get_xid() << std::dec << "} ";
+    return ss.str();
+  };
+
+private:
+  const struct rofl::openflow::ofp_header *header() const {
+    return (const struct rofl::openflow::ofp_header *)buf;
+  };
+
+private:
+  // frames up to this size are stored inline, fits typical flow-mods
+  static const size_t FRAME_INLINE_SIZE = 256;
+
+  // length field of ofp_header is 16 bits wide
+  static const size_t FRAME_MAX_LENGTH = 65535;
+
+  uint8_t *buf;
+  size_t len;
+  size_t cap;
+  uint8_t inline_buf[FRAME_INLINE_SIZE];
+};
+
+}; // end of namespace rofl
+
+#endif /* SRC_ROFL_COMMON_CROFFRAME_HPP_ */
@@ -8,11 +8,16 @@
 #ifndef CROFQUEUE_H_
 #define CROFQUEUE_H_
 
+#include <atomic>
 #include <list>
 #include <ostream>
+#include <time.h>
 
+#include "rofl/common/cring_queue.hpp"
+#include "rofl/common/crofframe.hpp"
 #include "rofl/common/locking.hpp"
 #include "rofl/common/openflow/messages/cofmsg.h"
+#include "rofl/common/openflow/messages/cofmsg_view.h"
 
 #include "rofl/common/exception.hpp"
 
@@ -47,111 +52,247 @@ public:
       : eRofQueueBase(__arg, __file, __func, __line){};
 };
 
+/**
+ * @brief	FIFO of OpenFlow messages
+ *
+ * A queue holds cofmsg instances and frames in wire format (crofframe) in
+ * a single order. Queues used for reception hold messages and views of
+ * unparsed messages (cofmsg_view), which keep their receive buffer alive
+ * while queued.
+ *
+ * Entries are kept in a lock-free ring (cring_queue), any number of threads
+ * may store and retrieve concurrently and entries stored by a single thread
+ * are retrieved in order. Entries exceeding the capacity of the ring (with
+ * enforce or a queue max size larger than the ring) spill into an overflow
+ * list protected by a lock, which is drained once the ring has run empty.
+ *
+ * Besides the number of entries the queue accounts for the bytes held in
+ * wire format. An optional byte budget limits store() like the queue max
+ * size does, high and low watermarks in bytes let the owner throttle its
+ * producer with hysteresis.
+ *
+ * With timestamps enabled, each entry records the time it was stored
+ * (CLOCK_MONOTONIC in nsecs) for measuring queueing delays. Entries may
+ * carry a deadline on the same clock, which is handed back on retrieval.
+ */
 class crofqueue {
 public:
   /**
-   *
+   * @param ring_size number of entries held without locking
    */
-  crofqueue() : queue_max_size(QUEUE_MAX_SIZE_DEFAULT){};
+  crofqueue(size_t ring_size = RING_SIZE_DEFAULT)
+      : ring(ring_size), queue_size(0), overflow_size(0), queue_bytes(0),
+        queue_max_size(QUEUE_MAX_SIZE_DEFAULT), queue_max_bytes(0),
+        high_watermark(0), low_watermark(0), timestamps(false){};
 
   /**
    *
    */
   ~crofqueue() { clear(); };
 
+private:
+  crofqueue(const crofqueue &queue);
+
+  crofqueue &operator=(const crofqueue &queue);
+
 public:
   /**
    *
    */
-  bool empty() const {
-    AcquireReadLock rwlock(queue_lock);
-    return queue.empty();
+  bool empty() const { return (0 == size()); };
+
+  /**
+   *
+   */
+  size_t size() const { return queue_size.load(std::memory_order_relaxed); };
+
+  /**
+   * @brief	Returns number of bytes of all queued entries in wire format
+   */
+  size_t bytes() const { return queue_bytes.load(std::memory_order_relaxed); };
+
+  /**
+   *
+   */
+  void clear() {
+    centry entry;
+    while (retrieve_entry(entry)) {
+      delete entry.msg;
+      delete entry.frame;
+      delete entry.view;
+    }
+  };
+
+  /**
+   *
+   */
+  size_t store(rofl::openflow::cofmsg *msg, bool enforce = false,
+               uint64_t deadline = 0) {
+    return store_entry(centry(msg, nullptr, deadline), enforce);
+  };
+
+  /**
+   * @brief	Stores a frame, the queue takes ownership
+   */
+  size_t store(rofl::crofframe *frame, bool enforce = false,
+               uint64_t deadline = 0) {
+    return store_entry(centry(nullptr, frame, deadline), enforce);
+  };
+
+  /**
+   * @brief	Stores a view, the queue takes ownership
+   */
+  size_t store(rofl::openflow::cofmsg_view *view, bool enforce = false) {
+    return store_entry(centry(nullptr, nullptr, 0, view), enforce);
+  };
+
+  /**
+   * @brief	Returns next message
+   *
+   * @throws eRofQueueInvalid next entry is a frame or view, use
+   * retrieve(msg, frame) or retrieve(msg, view)
+   */
+  rofl::openflow::cofmsg *retrieve() {
+    centry entry;
+    if (not peek_entry(entry)) {
+      return (rofl::openflow::cofmsg *)0;
+    }
+    if ((nullptr != entry.frame) || (nullptr != entry.view)) {
+      throw eRofQueueInvalid("crofqueue::retrieve() next entry is no message",
+                             __FILE__, __FUNCTION__, __LINE__);
+    }
+    retrieve_entry(entry);
+    return entry.msg;
   };
 
   /**
+   * @brief	Returns next entry, either msg or frame is set
    *
+   * @return false if queue is empty
    */
-  size_t size() const {
-    AcquireReadLock rwlock(queue_lock);
-    return queue.size();
+  bool retrieve(rofl::openflow::cofmsg *&msg, rofl::crofframe *&frame) {
+    centry entry;
+    if (not retrieve_entry(entry)) {
+      return false;
+    }
+    msg = entry.msg;
+    frame = entry.frame;
+    return true;
   };
 
   /**
+   * @brief	Returns next entry of a reception queue, either msg or view is set
    *
+   * @return false if queue is empty
    */
-  void clear() {
-    while (true) {
-      rofl::openflow::cofmsg *msg = nullptr;
-      {
-        AcquireReadWriteLock rwlock(queue_lock);
-        if (queue.empty()) {
-          return;
-        }
-        msg = queue.front();
-        queue.pop_front();
-      }
-      delete msg;
+  bool retrieve(rofl::openflow::cofmsg *&msg,
+                rofl::openflow::cofmsg_view *&view) {
+    centry entry;
+    if (not retrieve_entry(entry)) {
+      return false;
     }
+    msg = entry.msg;
+    view = entry.view;
+    return true;
   };
 
   /**
+   * @brief	Returns next entry and the time it was stored in nsecs
+   *
+   * The timestamp is 0 unless timestamps are enabled.
    *
+   * @return false if queue is empty
    */
-  size_t store(rofl::openflow::cofmsg *msg, bool enforce = false) {
-    AcquireReadWriteLock rwlock(queue_lock);
-    if ((not enforce) && (queue.size() >= queue_max_size)) {
-      throw eRofQueueFull("crofqueue::store() queue max size exceeded",
-                          __FILE__, __FUNCTION__, __LINE__);
+  bool retrieve(rofl::openflow::cofmsg *&msg, rofl::crofframe *&frame,
+                uint64_t &stamp) {
+    centry entry;
+    if (not retrieve_entry(entry)) {
+      return false;
     }
-    queue.push_back(msg);
-    return queue.size();
+    msg = entry.msg;
+    frame = entry.frame;
+    stamp = entry.stamp;
+    return true;
   };
 
   /**
+   * @brief	Returns next entry, the time it was stored and its deadline
    *
+   * The deadline is 0 for entries stored without one.
+   *
+   * @return false if queue is empty
    */
-  rofl::openflow::cofmsg *retrieve() {
-    rofl::openflow::cofmsg *msg = (rofl::openflow::cofmsg *)0;
-    AcquireReadWriteLock rwlock(queue_lock);
-    if (queue.empty()) {
-      return msg;
+  bool retrieve(rofl::openflow::cofmsg *&msg, rofl::crofframe *&frame,
+                uint64_t &stamp, uint64_t &deadline) {
+    centry entry;
+    if (not retrieve_entry(entry)) {
+      return false;
     }
-    msg = queue.front();
-    queue.pop_front();
-    return msg;
+    msg = entry.msg;
+    frame = entry.frame;
+    stamp = entry.stamp;
+    deadline = entry.deadline;
+    return true;
   };
 
   /**
+   * @brief	Returns length in bytes of the next entry, 0: queue is empty
    *
+   * Only meaningful while no other thread retrieves entries.
+   */
+  size_t front_bytes() {
+    centry entry;
+    if (not peek_entry(entry)) {
+      return 0;
+    }
+    return entry.len;
+  };
+
+  /**
+   * @throws eRofQueueInvalid next entry is a frame or view
    */
   rofl::openflow::cofmsg *front() {
-    rofl::openflow::cofmsg *msg = (rofl::openflow::cofmsg *)0;
-    AcquireReadWriteLock rwlock(queue_lock);
-    if (queue.empty()) {
-      return msg;
+    centry entry;
+    if (not peek_entry(entry)) {
+      return (rofl::openflow::cofmsg *)0;
+    }
+    if ((nullptr != entry.frame) || (nullptr != entry.view)) {
+      throw eRofQueueInvalid("crofqueue::front() next entry is no message",
+                             __FILE__, __FUNCTION__, __LINE__);
     }
-    msg = queue.front();
-    return msg;
+    return entry.msg;
   };
 
   /**
    *
    */
   void pop() {
-    AcquireReadWriteLock rwlock(queue_lock);
-    if (queue.empty()) {
-      return;
-    }
-    queue.pop_front();
+    centry entry;
+    retrieve_entry(entry);
   };
 
   /**
    *
    */
   size_t capacity() const {
-    AcquireReadLock rwlock(queue_lock);
-    return (queue.size() < queue_max_size) ? (queue_max_size - queue.size())
-                                           : 0;
+    size_t size = queue_size.load(std::memory_order_relaxed);
+    return (size < queue_max_size) ? (queue_max_size - size) : 0;
+  };
+
+  /**
+   * @brief	Returns true, when the queued bytes reached the high watermark
+   */
+  bool is_above_high_watermark() const {
+    return (0 != high_watermark) && (bytes() >= high_watermark);
+  };
+
+  /**
+   * @brief	Returns true, when the queued bytes fell to the low watermark
+   *
+   * Always true for queues without watermarks.
+   */
+  bool is_below_low_watermark() const {
+    return (0 == high_watermark) || (bytes() <= low_watermark);
   };
 
 public:
@@ -168,24 +309,170 @@ public:
     return *this;
   };
 
+  /**
+   * @brief	Returns byte budget of this queue, 0: unlimited
+   */
+  size_t get_queue_max_bytes() const { return queue_max_bytes; };
+
+  /**
+   * @brief	Sets byte budget of this queue, 0: unlimited
+   *
+   * A store() exceeding the budget fails unless enforced. A single entry
+   * larger than the budget is accepted by an empty queue.
+   */
+  crofqueue &set_queue_max_bytes(size_t queue_max_bytes) {
+    this->queue_max_bytes = queue_max_bytes;
+    return *this;
+  };
+
+  /**
+   * @brief	Returns high watermark in bytes, 0: no watermarks
+   */
+  size_t get_high_watermark() const { return high_watermark; };
+
+  /**
+   * @brief	Returns low watermark in bytes
+   */
+  size_t get_low_watermark() const { return low_watermark; };
+
+  /**
+   * @brief	Sets high and low watermarks in bytes, high 0 disables both
+   */
+  crofqueue &set_watermarks(size_t high_watermark, size_t low_watermark) {
+    if (low_watermark > high_watermark) {
+      throw eRofQueueInvalid("crofqueue::set_watermarks() low watermark "
+                             "exceeds high watermark",
+                             __FILE__, __FUNCTION__, __LINE__);
+    }
+    this->high_watermark = high_watermark;
+    this->low_watermark = low_watermark;
+    return *this;
+  };
+
+  /**
+   * @brief	Returns true, when entries record the time they were stored
+   */
+  bool get_timestamps() const { return timestamps; };
+
+  /**
+   * @brief	Enables or disables timestamps of stored entries
+   */
+  crofqueue &set_timestamps(bool timestamps) {
+    this->timestamps = timestamps;
+    return *this;
+  };
+
 public:
   friend std::ostream &operator<<(std::ostream &os, const crofqueue &queue) {
-    AcquireReadLock rwlock(queue.queue_lock);
-    os << "<crofqueue size #" << queue.queue.size() << " >" << std::endl;
+    os << "<crofqueue size #" << queue.size() << " bytes #" << queue.bytes()
+       << " overflow #" << queue.overflow_size.load() << " >" << std::endl;
+    return os;
+  };
 
-    for (std::list<rofl::openflow::cofmsg *>::const_iterator it =
-             queue.queue.begin();
-         it != queue.queue.end(); ++it) {
-      os << *(*it);
+private:
+  struct centry {
+    centry(rofl::openflow::cofmsg *msg = nullptr,
+           rofl::crofframe *frame = nullptr, uint64_t deadline = 0,
+           rofl::openflow::cofmsg_view *view = nullptr)
+        : msg(msg), frame(frame), view(view),
+          len((nullptr != frame)
+                  ? frame->length()
+                  : ((nullptr != msg) ? msg->length()
+                                      : ((nullptr != view) ? view->length()
+                                                           : 0))),
+          stamp(0), deadline(deadline){};
+    rofl::openflow::cofmsg *msg;
+    rofl::crofframe *frame;
+    rofl::openflow::cofmsg_view *view;
+    size_t len;
+    uint64_t stamp;
+    uint64_t deadline;
+  };
+
+  size_t store_entry(centry entry, bool enforce) {
+    if (timestamps) {
+      struct timespec ts;
+      clock_gettime(CLOCK_MONOTONIC, &ts);
+      entry.stamp = (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
     }
-    return os;
+    size_t size = queue_size.fetch_add(1, std::memory_order_relaxed);
+    if ((not enforce) && (size >= queue_max_size)) {
+      queue_size.fetch_sub(1, std::memory_order_relaxed);
+      throw eRofQueueFull("crofqueue::store() queue max size exceeded",
+                          __FILE__, __FUNCTION__, __LINE__);
+    }
+    size_t bytes = queue_bytes.fetch_add(entry.len, std::memory_order_relaxed);
+    if ((not enforce) && (0 != queue_max_bytes) && (0 != bytes) &&
+        (bytes + entry.len > queue_max_bytes)) {
+      queue_bytes.fetch_sub(entry.len, std::memory_order_relaxed);
+      queue_size.fetch_sub(1, std::memory_order_relaxed);
+      throw eRofQueueFull("crofqueue::store() queue max bytes exceeded",
+                          __FILE__, __FUNCTION__, __LINE__);
+    }
+    /* keep order: once spilled, store in overflow list until drained */
+    if ((0 == overflow_size.load(std::memory_order_acquire)) &&
+        ring.push(entry)) {
+      return size + 1;
+    }
+    AcquireReadWriteLock rwlock(overflow_lock);
+    if (overflow.empty() && ring.push(entry)) {
+      return size + 1;
+    }
+    overflow.push_back(entry);
+    overflow_size.fetch_add(1, std::memory_order_release);
+    return size + 1;
+  };
+
+  bool retrieve_entry(centry &entry) {
+    if (not ring.pop(entry)) {
+      /* overflow entries are younger than all entries in the ring */
+      if ((0 == overflow_size.load(std::memory_order_acquire)) ||
+          (not ring.empty())) {
+        return false;
+      }
+      AcquireReadWriteLock rwlock(overflow_lock);
+      if (overflow.empty() || (not ring.empty())) {
+        return false;
+      }
+      entry = overflow.front();
+      overflow.pop_front();
+      overflow_size.fetch_sub(1, std::memory_order_release);
+    }
+    queue_size.fetch_sub(1, std::memory_order_relaxed);
+    queue_bytes.fetch_sub(entry.len, std::memory_order_relaxed);
+    return true;
+  };
+
+  bool peek_entry(centry &entry) {
+    if (ring.peek(entry)) {
+      return true;
+    }
+    if ((0 == overflow_size.load(std::memory_order_acquire)) ||
+        (not ring.empty())) {
+      return false;
+    }
+    AcquireReadLock rwlock(overflow_lock);
+    if (overflow.empty() || (not ring.empty())) {
+      return false;
+    }
+    entry = overflow.front();
+    return true;
   };
 
 private:
-  std::list<rofl::openflow::cofmsg *> queue;
-  mutable crwlock queue_lock;
+  cring_queue<centry> ring;
+  std::list<centry> overflow;
+  mutable crwlock overflow_lock;
+  std::atomic<size_t> queue_size;
+  std::atomic<size_t> overflow_size;
+  std::atomic<size_t> queue_bytes;
   size_t queue_max_size;
+  size_t queue_max_bytes;
+  size_t high_watermark;
+  size_t low_watermark;
+  std::atomic<bool> timestamps;
   static const size_t QUEUE_MAX_SIZE_DEFAULT = 128;
+  static const size_t RING_SIZE_DEFAULT = 256;
 };
 
 }; // end of namespace rofl
@@ -20,39 +20,73 @@ using namespace rofl;
 /*static*/ crwlock crofsock_env::socket_envs_lock;
 /*static*/ crwlock crofsock::rwlock;
 /*static*/ bool crofsock::tls_initialized = false;
+/*static*/ unsigned int const crofsock::TXCLASS_MAX;
+/*static*/ size_t const crofsock::TXCLASS_RING_SIZE;
 
 crofsock::~crofsock() {
   txthread.stop();
   rxthread.stop();
   close();
+  if (tx_msg)
+    delete tx_msg;
+  if (tx_frame)
+    delete tx_frame;
 }
 
-crofsock::crofsock(crofsock_env *env)
-    : env(env), state(STATE_IDLE), mode(MODE_UNKNOWN), rxthread(this),
-      txthread(this), reconnect_backoff_max(60 /*secs*/),
-      reconnect_backoff_start(1 /*secs*/),
+crofsock::crofsock(crofsock_env *env, cthread_pool *pool, int reactor)
+    : env(env), state(STATE_IDLE), mode(MODE_UNKNOWN),
+      rxthread(this, pool, reactor),
+      txthread(this, pool, rxthread.get_reactor()),
+      reconnect_backoff_max(60 /*secs*/), reconnect_backoff_start(1 /*secs*/),
       reconnect_backoff_current(1 /*secs*/), reconnect_counter(0), sd(-1),
       domain(AF_INET), type(SOCK_STREAM), protocol(IPPROTO_TCP), backlog(64),
-      ctx(NULL), ssl(NULL), bio(NULL), capath("."), cafile("ca.pem"),
-      certfile("crt.pem"), keyfile("key.pem"), password(""),
+      busy_poll(0), ctx(NULL), ssl(NULL), bio(NULL), capath("."),
+      cafile("ca.pem"), certfile("crt.pem"), keyfile("key.pem"), password(""),
       verify_mode("PEER"), verify_depth("1"),
       ciphers("EECDH+ECDSA+AESGCM EECDH+aRSA+AESGCM EECDH+ECDSA+SHA256 "
               "EECDH+aRSA+RC4 EDH+aRSA EECDH RC4 !aNULL !eNULL !LOW !3DES !MD5 "
               "!EXP !PSK !SRP !DSS"),
-      rx_fragment_pending(false), rxbuffer((size_t)65536), msg_bytes_read(0),
-      max_pkts_rcvd_per_round(0), rx_disabled(false), tx_disabled(false),
+      shm_ring_size(cshmring::RING_SIZE_DEFAULT),
+      rxbuffer(new cmemory(RXBUFFER_SIZE)), rxlen(0), rx_offset(0),
+      rx_uring_closed(false), rx_uring_errno(0), rx_views(0),
+      max_pkts_rcvd_per_round(DEFAULT_MAX_PKTS_RVCD_PER_ROUND),
+      rx_disabled(false), tx_disabled(false),
       txqueue_pending_pkts(0), txqueue_size_congestion_occurred(0),
-      txqueue_size_tx_threshold(0), txqueues(QUEUE_MAX), txweights(QUEUE_MAX),
-      tx_is_running(false), tx_fragment_pending(false), txbuffer((size_t)65536),
-      msg_bytes_sent(0), txlen(0) {
-  /* scheduler weights for transmission */
-  txweights[QUEUE_OAM] = 16;
-  txweights[QUEUE_MGMT] = 32;
-  txweights[QUEUE_FLOW] = 16;
-  txweights[QUEUE_PKT] = 8;
+      txqueue_bytes_congestion_occurred(0), txqueue_bytes_tx_threshold(0),
+      tx_drain_target(DEFAULT_TX_DRAIN_TARGET), tx_drain_rate(0),
+      tx_drain_bytes(0), tx_congestion_episodes(0), txqueues(QUEUE_MAX),
+      txsched(new ctxsched_drr(TXCLASS_MAX)), tx_class(QUEUE_MGMT), tx_stamp(0),
+      tx_expired_round(TXCLASS_MAX, 0), txstats_enabled(false), txstats(TXCLASS_MAX),
+      tx_is_running(false), tx_post_pending(false), tx_fragment_pending(false),
+      txbuffer((size_t)65536), msg_bytes_sent(0), txlen(0), tx_msg(nullptr),
+      tx_frame(nullptr), tx_msgs_sent(0), tx_corked(false),
+      tx_uring_pending(0) {
+  for (unsigned int txclass = 0; txclass < TXCLASS_MAX; txclass++) {
+    tx_ttl[txclass] = 0;
+    tx_expired[txclass] = 0;
+  }
+
+  /* txqueues for application-defined traffic classes */
+  while (txqueues.size() < TXCLASS_MAX) {
+    txqueues.emplace_back(TXCLASS_RING_SIZE);
+  }
+
+  /* scheduler quanta for transmission */
+  txsched->set_class(QUEUE_OAM, 0, true);
+  txsched->set_class(QUEUE_MGMT, 16384, false);
+  txsched->set_class(QUEUE_FLOW, 8192, false);
+  txsched->set_class(QUEUE_PKT, 4096, false);
+
+  /* worst case: minimal messages filling txbuffer */
+  tx_msg_ends.reserve(txbuffer.length() / sizeof(struct openflow::ofp_header));
 
   rxthread.start("crofsock_rx");
   txthread.start("crofsock_tx");
+
+  /* keep buffers on the NUMA node of the owning reactor thread */
+  int node = rxthread.get_numa_node();
+  cthread_affinity::bind_memory(rxbuffer->somem(), rxbuffer->length(), node);
+  cthread_affinity::bind_memory(txbuffer.somem(), txbuffer.length(), node);
 }
 
 void crofsock::close() {
@@ -109,6 +143,7 @@ void crofsock::close() {
       ::close(sd);
       sd = -1;
     }
+    shm_release();
 
     state = STATE_CLOSED;
 
@@ -130,6 +165,7 @@ void crofsock::close() {
       ::close(sd);
       sd = -1;
     }
+    shm_release();
 
     state = STATE_CLOSED;
 
@@ -159,6 +195,8 @@ void crofsock::close() {
       ::close(sd);
     }
     sd = -1;
+    shm_release();
+    flag_set(FLAG_URING_IN_USE, false);
 
     state = STATE_CLOSED;
 
@@ -233,9 +271,11 @@ void crofsock::listen() {
   }
 
   /* remove all pending messages from tx queues */
-  for (auto queue : txqueues) {
+  for (auto &queue : txqueues) {
     queue.clear();
   }
+  reset_txbuffer();
+  reset_rxbuffer();
 
   /* cancel potentially pending reconnect timer */
   rxthread.drop_timer(TIMER_ID_RECONNECT);
@@ -246,8 +286,21 @@ void crofsock::listen() {
   /* reconnect does not make sense for listening sockets */
   flag_set(FLAG_RECONNECT_ON_FAILURE, false);
 
+  /* unix domain sockets accept shared memory connections, see shm_accept() */
+  int sprotocol = protocol;
+  if (AF_UNIX == baddr.get_family()) {
+    sprotocol = 0;
+
+    /* remove a stale socket left behind by a previous listener */
+    struct stat st;
+    if ((::stat(baddr.ca_sunaddr->sun_path, &st) == 0) &&
+        S_ISSOCK(st.st_mode)) {
+      ::unlink(baddr.ca_sunaddr->sun_path);
+    }
+  }
+
   /* open socket */
-  if ((sd = ::socket(baddr.get_family(), type, protocol)) < 0) {
+  if ((sd = ::socket(baddr.get_family(), type, sprotocol)) < 0) {
     throw eSysCall("eSysCall", "socket", __FILE__, __FUNCTION__, __LINE__);
   }
 
@@ -263,7 +316,7 @@ void crofsock::listen() {
                    __LINE__);
   }
 
-  if ((SOCK_STREAM == type) && (IPPROTO_TCP == protocol)) {
+  if ((SOCK_STREAM == type) && (IPPROTO_TCP == sprotocol)) {
     int optval = 1;
 
     // set SO_REUSEADDR option on TCP sockets
@@ -355,9 +408,11 @@ void crofsock::tcp_accept(int sd) {
   this->sd = sd;
 
   /* remove all pending messages from tx queues */
-  for (auto queue : txqueues) {
+  for (auto &queue : txqueues) {
     queue.clear();
   }
+  reset_txbuffer();
+  reset_rxbuffer();
 
   /* cancel potentially pending reconnect timer */
   rxthread.drop_timer(TIMER_ID_RECONNECT);
@@ -454,6 +509,15 @@ void crofsock::tcp_accept(int sd) {
                    __LINE__);
   }
 
+  set_sockopt_busy_poll(sd);
+
+  if (flag_test(FLAG_SHM_IN_USE)) {
+    /* stay in STATE_TCP_ACCEPTING until the peer handed over its rings */
+    rxthread.add_fd(sd);
+    rxthread.add_read_fd(sd);
+    return;
+  }
+
   state = STATE_TCP_ESTABLISHED;
 
   VLOG(2) << __FUNCTION__ << " STATE_TCP_ESTABLISHED laddr=" << laddr.str()
@@ -466,12 +530,26 @@ void crofsock::tcp_accept(int sd) {
   }
 
   /* instruct rxthread to read from socket descriptor */
-  rxthread.add_fd(sd);
-  rxthread.add_read_fd(sd);
+  rx_start();
 
   rxthread.wakeup();
 }
 
+void crofsock::set_sockopt_busy_poll(int sd) {
+  if (0 == busy_poll)
+    return;
+#ifdef SO_BUSY_POLL
+  /* raising the value above net.core.busy_poll requires CAP_NET_ADMIN */
+  int optval = busy_poll;
+  if (::setsockopt(sd, SOL_SOCKET, SO_BUSY_POLL, &optval, sizeof(optval)) <
+      0) {
+    VLOG(2) << __FUNCTION__ << " setsockopt (SO_BUSY_POLL) failed, errno="
+            << errno << " (" << strerror(errno) << ") laddr=" << laddr.str()
+            << " raddr=" << raddr.str();
+  }
+#endif
+}
+
 void crofsock::tcp_connect(bool reconnect) {
   int rc;
 
@@ -480,9 +558,11 @@ void crofsock::tcp_connect(bool reconnect) {
   }
 
   /* remove all pending messages from tx queues */
-  for (auto queue : txqueues) {
+  for (auto &queue : txqueues) {
     queue.clear();
   }
+  reset_txbuffer();
+  reset_rxbuffer();
 
   /* cancel potentially pending reconnect timer */
   rxthread.drop_timer(TIMER_ID_RECONNECT);
@@ -490,6 +570,12 @@ void crofsock::tcp_connect(bool reconnect) {
   /* we do an active connect */
   mode = MODE_CLIENT;
 
+  /* fresh rings for each connection attempt, handed over once connected */
+  if (flag_test(FLAG_SHM_IN_USE)) {
+    shm_release();
+    shmring.reset(new cshmring(shm_ring_size));
+  }
+
   /* reconnect in case of an error? */
   flag_set(FLAG_RECONNECT_ON_FAILURE, reconnect);
 
@@ -499,8 +585,9 @@ void crofsock::tcp_connect(bool reconnect) {
   VLOG(2) << __FUNCTION__ << " STATE_TCP_CONNECTING laddr=" << laddr.str()
           << " raddr=" << raddr.str();
 
-  /* open socket */
-  if ((sd = ::socket(raddr.get_family(), type, protocol)) < 0) {
+  /* open socket, unix domain sockets have no protocol */
+  int sprotocol = (AF_UNIX == raddr.get_family()) ? 0 : protocol;
+  if ((sd = ::socket(raddr.get_family(), type, sprotocol)) < 0) {
     throw eSysCall("eSysCall", "socket", __FILE__, __FUNCTION__, __LINE__);
   }
 
@@ -517,7 +604,7 @@ void crofsock::tcp_connect(bool reconnect) {
   }
 
   /* set REUSEADDR and TCP_NODELAY options (for TCP sockets only) */
-  if ((SOCK_STREAM == type) && (IPPROTO_TCP == protocol)) {
+  if ((SOCK_STREAM == type) && (IPPROTO_TCP == sprotocol)) {
     int optval = 1;
 
     /* set SO_REUSEADDR option */
@@ -551,6 +638,8 @@ void crofsock::tcp_connect(bool reconnect) {
                    __LINE__);
   }
 
+  set_sockopt_busy_poll(sd);
+
   /* bind to local address */
   if (laddr.get_family() != AF_UNSPEC) {
     if ((rc = ::bind(sd, laddr.ca_saddr, (socklen_t)(laddr.salen))) < 0) {
@@ -609,11 +698,14 @@ void crofsock::tcp_connect(bool reconnect) {
             << " raddr=" << raddr.str();
 
     /* register socket descriptor for read operations */
-    rxthread.add_fd(sd);
-    rxthread.add_read_fd(sd);
+    rx_start();
 
     rxthread.wakeup();
 
+    if (flag_test(FLAG_SHM_IN_USE)) {
+      shm_established();
+    }
+
     if (flag_test(FLAG_TLS_IN_USE)) {
       crofsock::tls_connect(flag_test(FLAG_RECONNECT_ON_FAILURE));
     } else {
@@ -738,6 +830,7 @@ void crofsock::tls_accept(int sockfd) {
   case STATE_CLOSED:
   case STATE_TCP_ACCEPTING: {
 
+    flag_set(FLAG_SHM_IN_USE, false);
     flag_set(FLAG_TLS_IN_USE, true);
 
     crofsock::tcp_accept(sockfd);
@@ -859,6 +952,7 @@ void crofsock::tls_connect(bool reconnect) {
   case STATE_CLOSED:
   case STATE_TCP_CONNECTING: {
 
+    flag_set(FLAG_SHM_IN_USE, false);
     flag_set(FLAG_TLS_IN_USE, true);
 
     crofsock::tcp_connect(reconnect);
@@ -1191,6 +1285,133 @@ void crofsock::tls_log_errors() {
   BIO_free(ebio);
 }
 
+void crofsock::shm_accept(int sd) {
+  flag_set(FLAG_TLS_IN_USE, false);
+  flag_set(FLAG_SHM_IN_USE, true);
+
+  crofsock::tcp_accept(sd);
+}
+
+void crofsock::shm_connect(bool reconnect) {
+  if (AF_UNIX != raddr.get_family()) {
+    throw eRofSockInvalid("crofsock::shm_connect() raddr is not AF_UNIX",
+                          __FILE__, __FUNCTION__, __LINE__);
+  }
+
+  flag_set(FLAG_TLS_IN_USE, false);
+  flag_set(FLAG_SHM_IN_USE, true);
+
+  crofsock::tcp_connect(reconnect);
+}
+
+void crofsock::shm_accepting() {
+  cshmring *ring = nullptr;
+  try {
+    ring = cshmring::attach(sd);
+  } catch (rofl::exception &e) {
+    VLOG(2) << __FUNCTION__ << " SHM: attaching rings failed: " << e.what()
+            << " laddr=" << laddr.str() << " raddr=" << raddr.str();
+    close();
+
+    crofsock_env::call_env(env).handle_tcp_accept_failed(*this);
+    return;
+  }
+
+  /* rings not received yet */
+  if (nullptr == ring)
+    return;
+
+  shmring.reset(ring);
+
+  state = STATE_TCP_ESTABLISHED;
+
+  VLOG(2) << __FUNCTION__ << " STATE_TCP_ESTABLISHED (shm) laddr="
+          << laddr.str() << " raddr=" << raddr.str();
+
+  shm_established();
+
+  crofsock_env::call_env(env).handle_tcp_accepted(*this);
+
+  rxthread.wakeup();
+}
+
+void crofsock::shm_established() {
+  /* the client creates the rings and hands them over */
+  if (MODE_CLIENT == mode) {
+    shmring->send_fds(sd);
+  }
+
+  rxthread.add_fd(shmring->get_rx_fd());
+  rxthread.add_read_fd(shmring->get_rx_fd());
+  txthread.add_fd(shmring->get_tx_fd());
+  txthread.add_read_fd(shmring->get_tx_fd());
+}
+
+void crofsock::shm_release() {
+  if (not shmring)
+    return;
+
+  rxthread.drop_read_fd(shmring->get_rx_fd(), false);
+  rxthread.drop_fd(shmring->get_rx_fd());
+  txthread.drop_read_fd(shmring->get_tx_fd(), false);
+  txthread.drop_fd(shmring->get_tx_fd());
+  shmring.reset();
+}
+
+int crofsock::shm_recv() {
+  size_t nbytes = shmring->read(rxbuffer->somem() + rxlen,
+                                rxbuffer->length() - rxlen);
+  if (nbytes > 0)
+    return nbytes;
+
+  /* ring drained, the unix domain socket signals the peer's shutdown */
+  char c;
+  int rc = ::recv(sd, &c, sizeof(c), MSG_DONTWAIT | MSG_PEEK);
+  if (rc > 0) {
+    /* nothing but the rings is expected after connection establishment */
+    errno = EPROTO;
+    return -1;
+  }
+  return rc;
+}
+
+void crofsock::rx_start() {
+  rxthread.add_fd(sd);
+
+  /* TLS and shared memory connections read via their own paths */
+  bool uring = (not flag_test(FLAG_TLS_IN_USE)) &&
+               (not flag_test(FLAG_SHM_IN_USE)) && rxthread.add_recv_fd(sd);
+  flag_set(FLAG_URING_IN_USE, uring);
+  if (not uring) {
+    rxthread.add_read_fd(sd);
+  }
+}
+
+int crofsock::uring_recv() {
+  if (not rx_backlog.empty()) {
+    size_t nbytes = rxbuffer->length() - rxlen;
+    if (nbytes > rx_backlog.size())
+      nbytes = rx_backlog.size();
+    memcpy(rxbuffer->somem() + rxlen, rx_backlog.data(), nbytes);
+    rx_backlog.erase(rx_backlog.begin(), rx_backlog.begin() + nbytes);
+
+    /* backlog drained, resume reception */
+    if (rx_backlog.empty() && (not rx_uring_closed) && (not rx_disabled)) {
+      rxthread.add_recv_fd(sd);
+    }
+    return nbytes;
+  }
+
+  if (rx_uring_closed) {
+    errno = rx_uring_errno;
+    return (0 == rx_uring_errno) ? 0 : -1;
+  }
+
+  /* handle_recv() continues, once more data is available */
+  errno = EAGAIN;
+  return -1;
+}
+
 void crofsock::backoff_reconnect(bool reset_timeout) {
   if (rxthread.has_timer(TIMER_ID_RECONNECT)) {
     return;
@@ -1237,7 +1458,11 @@ void crofsock::rx_disable() {
   switch (state) {
   case STATE_TCP_ESTABLISHED:
   case STATE_TLS_ESTABLISHED: {
-    rxthread.drop_read_fd(sd, false);
+    if (flag_test(FLAG_URING_IN_USE)) {
+      rxthread.drop_recv_fd(sd);
+    } else {
+      rxthread.drop_read_fd(sd, false);
+    }
     VLOG(2) << __FUNCTION__ << " disable reception laddr=" << laddr.str()
             << " raddr=" << raddr.str();
   } break;
@@ -1250,7 +1475,13 @@ void crofsock::rx_enable() {
   switch (state) {
   case STATE_TCP_ESTABLISHED:
   case STATE_TLS_ESTABLISHED: {
-    rxthread.add_read_fd(sd, false);
+    /* data received meanwhile is drained first */
+    if (flag_test(FLAG_URING_IN_USE)) {
+      if (rx_backlog.empty())
+        rxthread.add_recv_fd(sd);
+    } else {
+      rxthread.add_read_fd(sd, false);
+    }
     VLOG(2) << __FUNCTION__ << " enable reception"
             << " laddr=" << laddr.str() << " raddr=" << raddr.str();
     rxthread.wakeup();
@@ -1289,15 +1520,117 @@ void crofsock::handle_timeout(cthread &thread, uint32_t timer_id) {
 }
 
 crofsock::msg_result_t crofsock::send_message(rofl::openflow::cofmsg *msg,
-                                              bool enforce_queueing) {
+                                              bool enforce_queueing,
+                                              unsigned int ttl) {
 
   VLOG(3) << __FUNCTION__ << " msg=" << msg
           << " txqueue_pending_pkts=" << txqueue_pending_pkts
           << " tx_disabled=" << tx_disabled
           << " tx_is_running=" << tx_is_running;
 
+  return enqueue(msg, nullptr, msg->get_version(), msg->get_type(),
+                 enforce_queueing, ttl);
+}
+
+crofsock::msg_result_t crofsock::send_frame(rofl::crofframe *frame,
+                                            bool enforce_queueing,
+                                            unsigned int ttl) {
+
+  VLOG(3) << __FUNCTION__ << " frame=" << frame
+          << " txqueue_pending_pkts=" << txqueue_pending_pkts
+          << " tx_disabled=" << tx_disabled
+          << " tx_is_running=" << tx_is_running;
+
+  return enqueue(nullptr, frame, frame->get_version(), frame->get_type(),
+                 enforce_queueing, ttl);
+}
+
+/*static*/ thread_local int crofsock::txclass_scope::current = -1;
+
+/*static*/ uint64_t crofsock::now_nsecs() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/*static*/ unsigned int crofsock::txqueue_id(uint8_t version, uint8_t type) {
+  switch (version) {
+  case rofl::openflow10::OFP_VERSION: {
+    switch (type) {
+    case rofl::openflow10::OFPT_PACKET_IN:
+    case rofl::openflow10::OFPT_PACKET_OUT: {
+      return QUEUE_PKT;
+    } break;
+    case rofl::openflow10::OFPT_FLOW_MOD:
+    case rofl::openflow10::OFPT_FLOW_REMOVED:
+    case rofl::openflow10::OFPT_BARRIER_REPLY:
+    case rofl::openflow10::OFPT_BARRIER_REQUEST: {
+      return QUEUE_FLOW;
+    } break;
+    case rofl::openflow10::OFPT_ECHO_REQUEST:
+    case rofl::openflow10::OFPT_ECHO_REPLY: {
+      return QUEUE_OAM;
+    } break;
+    default: { return QUEUE_MGMT; };
+    }
+  } break;
+  case rofl::openflow12::OFP_VERSION: {
+    switch (type) {
+    case rofl::openflow12::OFPT_PACKET_IN:
+    case rofl::openflow12::OFPT_PACKET_OUT: {
+      return QUEUE_PKT;
+    } break;
+    case rofl::openflow12::OFPT_FLOW_MOD:
+    case rofl::openflow12::OFPT_FLOW_REMOVED:
+    case rofl::openflow12::OFPT_GROUP_MOD:
+    case rofl::openflow12::OFPT_PORT_MOD:
+    case rofl::openflow12::OFPT_TABLE_MOD:
+    case rofl::openflow12::OFPT_BARRIER_REPLY:
+    case rofl::openflow12::OFPT_BARRIER_REQUEST: {
+      return QUEUE_FLOW;
+    } break;
+    case rofl::openflow12::OFPT_ECHO_REQUEST:
+    case rofl::openflow12::OFPT_ECHO_REPLY: {
+      return QUEUE_OAM;
+    } break;
+    default: { return QUEUE_MGMT; };
+    }
+  } break;
+  case rofl::openflow13::OFP_VERSION:
+  default: {
+    switch (type) {
+    case rofl::openflow13::OFPT_PACKET_IN:
+    case rofl::openflow13::OFPT_PACKET_OUT: {
+      return QUEUE_PKT;
+    } break;
+    case rofl::openflow13::OFPT_FLOW_MOD:
+    case rofl::openflow13::OFPT_FLOW_REMOVED:
+    case rofl::openflow13::OFPT_GROUP_MOD:
+    case rofl::openflow13::OFPT_PORT_MOD:
+    case rofl::openflow13::OFPT_TABLE_MOD:
+    case rofl::openflow13::OFPT_BARRIER_REPLY:
+    case rofl::openflow13::OFPT_BARRIER_REQUEST: {
+      return QUEUE_FLOW;
+    } break;
+    case rofl::openflow13::OFPT_ECHO_REQUEST:
+    case rofl::openflow13::OFPT_ECHO_REPLY: {
+      return QUEUE_OAM;
+    } break;
+    default: { return QUEUE_MGMT; };
+    }
+  };
+  }
+  return QUEUE_MGMT;
+}
+
+crofsock::msg_result_t crofsock::enqueue(rofl::openflow::cofmsg *msg,
+                                         rofl::crofframe *frame,
+                                         uint8_t version, uint8_t type,
+                                         bool enforce_queueing,
+                                         unsigned int ttl) {
   if (tx_disabled) {
     delete msg;
+    delete frame;
     /* connection shutdown in progress, a very specific form of congestion ...,
      * message is deleted */
     return MSG_QUEUEING_FAILED_SHUTDOWN_IN_PROGRESS;
@@ -1306,13 +1639,14 @@ crofsock::msg_result_t crofsock::send_message(rofl::openflow::cofmsg *msg,
   if ((state != STATE_TCP_ESTABLISHED) && (state != STATE_TLS_ESTABLISHED)) {
 
     delete msg;
+    delete frame;
 
     /* connection is not established: message is deleted */
     return MSG_QUEUEING_FAILED_NOT_ESTABLISHED;
   }
 
-  if ((msg->get_type() == rofl::openflow::OFPT_ECHO_REQUEST) ||
-      (msg->get_type() == rofl::openflow::OFPT_ECHO_REPLY)) {
+  if ((type == rofl::openflow::OFPT_ECHO_REQUEST) ||
+      (type == rofl::openflow::OFPT_ECHO_REPLY)) {
     enforce_queueing = true;
   }
 
@@ -1320,77 +1654,41 @@ crofsock::msg_result_t crofsock::send_message(rofl::openflow::cofmsg *msg,
 
     /* enqueue the message in rofl's internal queue, as long
      * as these are not exhausted */
-    switch (msg->get_version()) {
-    case rofl::openflow10::OFP_VERSION: {
-      switch (msg->get_type()) {
-      case rofl::openflow10::OFPT_PACKET_IN:
-      case rofl::openflow10::OFPT_PACKET_OUT: {
-        txqueues[QUEUE_PKT].store(msg, enforce_queueing);
-      } break;
-      case rofl::openflow10::OFPT_FLOW_MOD:
-      case rofl::openflow10::OFPT_FLOW_REMOVED:
-      case rofl::openflow10::OFPT_BARRIER_REPLY:
-      case rofl::openflow10::OFPT_BARRIER_REQUEST: {
-        txqueues[QUEUE_FLOW].store(msg, enforce_queueing);
-      } break;
-      case rofl::openflow10::OFPT_ECHO_REQUEST:
-      case rofl::openflow10::OFPT_ECHO_REPLY: {
-        txqueues[QUEUE_OAM].store(msg, enforce_queueing);
-      } break;
-      default: { txqueues[QUEUE_MGMT].store(msg, enforce_queueing); };
-      }
-    } break;
-    case rofl::openflow12::OFP_VERSION: {
-      switch (msg->get_type()) {
-      case rofl::openflow12::OFPT_PACKET_IN:
-      case rofl::openflow12::OFPT_PACKET_OUT: {
-        txqueues[QUEUE_PKT].store(msg, enforce_queueing);
-      } break;
-      case rofl::openflow12::OFPT_FLOW_MOD:
-      case rofl::openflow12::OFPT_FLOW_REMOVED:
-      case rofl::openflow12::OFPT_GROUP_MOD:
-      case rofl::openflow12::OFPT_PORT_MOD:
-      case rofl::openflow12::OFPT_TABLE_MOD:
-      case rofl::openflow12::OFPT_BARRIER_REPLY:
-      case rofl::openflow12::OFPT_BARRIER_REQUEST: {
-        txqueues[QUEUE_FLOW].store(msg, enforce_queueing);
-      } break;
-      case rofl::openflow12::OFPT_ECHO_REQUEST:
-      case rofl::openflow12::OFPT_ECHO_REPLY: {
-        txqueues[QUEUE_OAM].store(msg, enforce_queueing);
-      } break;
-      default: { txqueues[QUEUE_MGMT].store(msg, enforce_queueing); };
-      }
-    } break;
-    case rofl::openflow13::OFP_VERSION:
-    default: {
-      switch (msg->get_type()) {
-      case rofl::openflow13::OFPT_PACKET_IN:
-      case rofl::openflow13::OFPT_PACKET_OUT: {
-        txqueues[QUEUE_PKT].store(msg, enforce_queueing);
-      } break;
-      case rofl::openflow13::OFPT_FLOW_MOD:
-      case rofl::openflow13::OFPT_FLOW_REMOVED:
-      case rofl::openflow13::OFPT_GROUP_MOD:
-      case rofl::openflow13::OFPT_PORT_MOD:
-      case rofl::openflow13::OFPT_TABLE_MOD:
-      case rofl::openflow13::OFPT_BARRIER_REPLY:
-      case rofl::openflow13::OFPT_BARRIER_REQUEST: {
-        txqueues[QUEUE_FLOW].store(msg, enforce_queueing);
-      } break;
-      case rofl::openflow13::OFPT_ECHO_REQUEST:
-      case rofl::openflow13::OFPT_ECHO_REPLY: {
-        txqueues[QUEUE_OAM].store(msg, enforce_queueing);
-      } break;
-      default: { txqueues[QUEUE_MGMT].store(msg, enforce_queueing); };
-      }
-    };
+    unsigned int txclass = txqueue_id(version, type);
+    int scope = txclass_scope::get_txclass();
+    if ((QUEUE_OAM != txclass) && (scope >= 0) && (scope < (int)TXCLASS_MAX)) {
+      txclass = scope;
+    }
+    crofqueue &txqueue = txqueues[txclass];
+
+    /* messages still queued after their time-to-live are dropped */
+    uint64_t deadline = 0;
+    if (0 == ttl) {
+      ttl = tx_ttl[txclass];
+    }
+    if (0 != ttl) {
+      deadline = now_nsecs() + (uint64_t)ttl * 1000;
+    }
+
+    if (nullptr != frame) {
+      txqueue.store(frame, enforce_queueing, deadline);
+    } else {
+      txqueue.store(msg, enforce_queueing, deadline);
     }
 
     txqueue_pending_pkts++;
 
-    if (not tx_is_running) {
-      txthread.wakeup();
+    /* queue filled up to its high watermark while socket still accepts */
+    if (txqueue.is_above_high_watermark()) {
+      tx_congestion_occurred(false);
+    }
+
+    /* a single task sends all messages queued in the meantime */
+    if ((not tx_is_running) && (not tx_post_pending.exchange(true))) {
+      txthread.post([this]() {
+        tx_post_pending = false;
+        send_from_queue();
+      });
     }
 
     if (flag_test(FLAG_TX_BLOCK_QUEUEING)) {
@@ -1403,11 +1701,12 @@ crofsock::msg_result_t crofsock::send_message(rofl::openflow::cofmsg *msg,
 
   } catch (eRofQueueFull &e) {
     VLOG(3) << __FUNCTION__ << " txqueue exhausted, "
-            << " msg=" << msg
+            << " msg=" << msg << " frame=" << frame
             << " txqueue_pending_pkts=" << txqueue_pending_pkts
             << " tx_disabled=" << tx_disabled
             << " tx_is_running=" << tx_is_running;
     delete msg;
+    delete frame;
     /* message was not stored in txqueue and deleted here */
     return MSG_QUEUEING_FAILED_QUEUE_FULL;
   }
@@ -1437,6 +1736,83 @@ void crofsock::handle_write_event(cthread &thread, int fd) {
   }
 }
 
+void crofsock::handle_recv(cthread &thread, int fd, const uint8_t *buf,
+                           ssize_t len) {
+  if ((&thread != &rxthread) || (fd != sd) || (state <= STATE_CLOSED))
+    return;
+
+  if (len <= 0) {
+    /* reported by recv_message() after parsing all data received before */
+    rx_uring_closed = true;
+    rx_uring_errno = -len;
+  } else {
+    if (rx_backlog.empty() && (rx_offset > 0) &&
+        (rxbuffer->length() - rxlen < (size_t)len)) {
+      compact_rxbuffer();
+    }
+    if (rx_backlog.empty() && (rxbuffer->length() - rxlen >= (size_t)len)) {
+      memcpy(rxbuffer->somem() + rxlen, buf, len);
+      rxlen += len;
+    } else {
+      /* rxbuffer is full while reception is throttled or disabled */
+      rx_backlog.insert(rx_backlog.end(), buf, buf + len);
+      rxthread.drop_recv_fd(sd);
+    }
+  }
+
+  recv_message();
+}
+
+void crofsock::handle_send(cthread &thread, int fd, ssize_t res) {
+  if ((&thread != &txthread) || (fd != sd) || (0 == tx_uring_pending))
+    return;
+  tx_uring_pending--;
+
+  if (res < 0) {
+    /* segments following a failed one are cancelled */
+    if (-ECANCELED != res) {
+      VLOG(1) << __FUNCTION__ << " io_uring send failed, error: " << -res
+              << ": " << strerror(-res) << " laddr=" << laddr.str()
+              << " raddr=" << raddr.str();
+    }
+  } else {
+    msg_bytes_sent += res;
+    update_tx_drain_rate(res);
+
+    /* messages sent completely */
+    while ((tx_msgs_sent < tx_msg_ends.size()) &&
+           (tx_msg_ends[tx_msgs_sent] <= msg_bytes_sent)) {
+      tx_msgs_sent++;
+      txqueue_pending_pkts--;
+    }
+
+    VLOG(3) << __FUNCTION__ << ": sent " << res
+            << " bytes msg_bytes_sent=" << msg_bytes_sent << " txlen=" << txlen
+            << " txqueue_pending_pkts=" << txqueue_pending_pkts;
+  }
+
+  if (tx_uring_pending > 0)
+    return;
+
+  /* chain failed, the connection is broken and reception reports its
+   * shutdown */
+  if (res < 0)
+    return;
+
+  /* txbuffer drained, otherwise the next chain sends the remaining bytes */
+  if (msg_bytes_sent == txlen) {
+    tx_fragment_pending = false;
+    msg_bytes_sent = 0;
+    txlen = 0;
+    tx_msg_ends.clear();
+    tx_msgs_sent = 0;
+
+    tx_congestion_check();
+  }
+
+  send_from_queue();
+}
+
 void crofsock::send_from_queue() {
   if (state <= STATE_CLOSED) {
     VLOG(3) << __FUNCTION__
@@ -1448,200 +1824,534 @@ void crofsock::send_from_queue() {
 
   tx_is_running = true;
 
+  /* bytes left over from a short write */
+  if ((msg_bytes_sent < txlen) &&
+      (not flush_txbuffer((tx_msg != nullptr) || (tx_frame != nullptr))))
+    return;
+
+  /* message retrieved in a previous round not fitting into txbuffer */
+  bool pending = (nullptr != tx_msg) || (nullptr != tx_frame);
+
   bool reschedule;
   do {
     reschedule = false;
-    for (unsigned int queue_id = 0; queue_id < QUEUE_MAX; ++queue_id) {
+    uint64_t now = 0;
+    while (true) {
 
-      for (unsigned int num = 0; num < txweights[queue_id]; ++num) {
+      if ((tx_disabled) || (state < STATE_TCP_ESTABLISHED)) {
+        uncork();
+        tx_is_running = false;
+        return;
+      }
 
-        if ((tx_disabled) || (state < STATE_TCP_ESTABLISHED)) {
-          tx_is_running = false;
-          return;
+      /* fetch a new message or frame for transmission from tx queue */
+      if (not pending) {
+        int txclass = txsched->select(txqueues);
+        if (txclass < 0)
+          break;
+        uint64_t deadline = 0;
+        if (not txqueues[txclass].retrieve(tx_msg, tx_frame, tx_stamp,
+                                           deadline))
+          continue;
+        tx_class = txclass;
+
+        /* drop expired messages without packing them */
+        if ((0 != deadline) && (0 == now)) {
+          now = now_nsecs();
+        }
+        if ((0 != deadline) && (deadline <= now)) {
+          delete tx_msg;
+          tx_msg = nullptr;
+          delete tx_frame;
+          tx_frame = nullptr;
+          txqueue_pending_pkts--;
+          tx_expired[tx_class]++;
+          tx_expired_round[tx_class]++;
+          continue;
         }
 
-        /* no pending fragment */
-        if (not tx_fragment_pending) {
-          rofl::openflow::cofmsg *msg = nullptr;
+        txsched->charge(tx_class, (nullptr != tx_frame) ? tx_frame->length()
+                                                        : tx_msg->length());
+      }
+      pending = false;
 
-          /* fetch a new message for transmission from tx queue */
-          if ((msg = txqueues[queue_id].retrieve()) == NULL)
-            break;
-          // txqueues[queue_id].pop();
+      size_t msglen =
+          (nullptr != tx_frame) ? tx_frame->length() : tx_msg->length();
 
-          /* bytes of this message sent so far */
-          msg_bytes_sent = 0;
+      /* txbuffer is full, send it and continue with an empty one */
+      if ((txlen + msglen > txbuffer.length()) && (not flush_txbuffer(true)))
+        return;
 
-          /* overall length of this message */
-          txlen = msg->length();
+      if (nullptr != tx_frame) {
+        /* frames are in wire format already */
+        memcpy(txbuffer.somem() + txlen, tx_frame->somem(), msglen);
 
-          memset(txbuffer.somem(), 0, txlen);
+        VLOG(3) << __FUNCTION__ << " frame sent: " << tx_frame->str()
+                << " laddr=" << laddr.str() << " raddr=" << raddr.str();
 
-          /* pack message into txbuffer */
-          msg->pack(txbuffer.somem(), txlen);
+        delete tx_frame;
+        tx_frame = nullptr;
+      } else {
+        /* padding bytes must be zero */
+        memset(txbuffer.somem() + txlen, 0, msglen);
+
+        /* pack message into txbuffer behind preceding messages, a message
+         * grown after its length was taken is dropped */
+        try {
+          tx_msg->pack(txbuffer.somem() + txlen, msglen);
+        } catch (rofl::exception &e) {
+          VLOG(1) << __FUNCTION__ << " dropping message, pack failed: "
+                  << e.what() << " laddr=" << laddr.str()
+                  << " raddr=" << raddr.str();
+          delete tx_msg;
+          tx_msg = nullptr;
+          txqueue_pending_pkts--;
+          continue;
+        }
 
-          VLOG(3) << __FUNCTION__ << " message sent: " << msg->str().c_str()
-                  << " laddr=" << laddr.str() << " raddr=" << raddr.str();
+        VLOG(3) << __FUNCTION__ << " message sent: " << tx_msg->str().c_str()
+                << " laddr=" << laddr.str() << " raddr=" << raddr.str();
 
-          /* remove C++ message object from heap */
-          delete msg;
-        }
+        /* remove C++ message object from heap */
+        delete tx_msg;
+        tx_msg = nullptr;
+      }
+      txlen += msglen;
+      tx_msg_ends.push_back(txlen);
 
-        /* send memory block via socket in non-blocking mode */
-        int nbytes =
-            ::send(sd, txbuffer.somem() + msg_bytes_sent,
-                   txlen - msg_bytes_sent, MSG_DONTWAIT | MSG_NOSIGNAL);
-
-        /* error occurred */
-        if (nbytes < 0) {
-          switch (errno) {
-          case EAGAIN: /* socket would block */ {
-            tx_is_running = false;
-            tx_fragment_pending = true;
-            flag_set(FLAG_CONGESTED, true);
-            txthread.add_write_fd(sd);
-
-            if (not flag_test(FLAG_TX_BLOCK_QUEUEING)) {
-              /* block transmission of further packets */
-              flag_set(FLAG_TX_BLOCK_QUEUEING, true);
-              /* remember queue size, when congestion occurred */
-              txqueue_size_congestion_occurred = txqueue_pending_pkts;
-              /* threshold for re-enabling acceptance of packets */
-              txqueue_size_tx_threshold = txqueue_pending_pkts / 2;
-
-              VLOG(3) << __FUNCTION__ << " congestion occurred"
-                      << " txqueue_pending_pkts: " << txqueue_pending_pkts
-                      << " txqueue_size_congestion_occurred: "
-                      << txqueue_size_congestion_occurred
-                      << " txqueue_size_tx_threshold: "
-                      << txqueue_size_tx_threshold << " laddr=" << laddr.str()
-                      << " raddr=" << raddr.str();
-
-              crofsock_env::call_env(env).congestion_occurred_indication(*this);
-            }
-          }
-            return;
-          case SIGPIPE:
-          default: {
-            VLOG(1) << __FUNCTION__
-                    << " ::send() syscall failed, error: " << errno << ": "
-                    << strerror(errno);
-            tx_is_running = false;
-          }
-            return;
-          }
-
-          /* at least some bytes were sent successfully */
-        } else {
-          msg_bytes_sent += nbytes;
-          flag_set(FLAG_CONGESTED, false);
-
-          /* short write */
-          if (msg_bytes_sent < txlen) {
-            tx_fragment_pending = true;
-
-            /* packet successfully sent */
-          } else {
-            tx_fragment_pending = false;
-            txqueue_pending_pkts--;
-          }
-
-          VLOG(3) << __FUNCTION__ << ": sent " << nbytes
-                  << " bytes msg_bytes_sent=" << msg_bytes_sent
-                  << " tx_fragment_pending=" << tx_fragment_pending
-                  << " txqueue_pending_pkts=" << txqueue_pending_pkts;
-        }
+      if (0 != tx_stamp) {
+        record_txclass_stats(tx_class, msglen, tx_stamp);
       }
+    }
 
-      if (not txqueues[queue_id].empty()) {
+    for (auto &txqueue : txqueues) {
+      if (not txqueue.empty()) {
         reschedule = true;
+        break;
       }
     }
 
-    if ((not flag_test(FLAG_CONGESTED)) && flag_test(FLAG_TX_BLOCK_QUEUEING)) {
-      if (txqueue_pending_pkts <= txqueue_size_tx_threshold) {
-        flag_set(FLAG_TX_BLOCK_QUEUEING, false);
-        VLOG(3) << __FUNCTION__ << " congestion solved"
-                << " txqueue_pending_pkts" << txqueue_pending_pkts
-                << " txqueue_size_congestion_occurred"
-                << txqueue_size_congestion_occurred
-                << " txqueue_size_tx_threshold" << txqueue_size_tx_threshold
-                << " laddr=" << laddr.str() << " raddr=" << raddr.str();
-
-        crofsock_env::call_env(env).congestion_solved_indication(*this);
-      }
+    /* report messages expired in this round */
+    for (unsigned int txclass = 0; txclass < TXCLASS_MAX; txclass++) {
+      if (0 == tx_expired_round[txclass])
+        continue;
+      VLOG(2) << __FUNCTION__ << " dropped " << tx_expired_round[txclass]
+              << " expired messages txclass=" << txclass
+              << " laddr=" << laddr.str() << " raddr=" << raddr.str();
+      unsigned int count = tx_expired_round[txclass];
+      tx_expired_round[txclass] = 0;
+      crofsock_env::call_env(env).handle_expired(*this, txclass, count);
     }
 
+    /* a single send() per round of all txqueues */
+    if (not flush_txbuffer(reschedule))
+      return;
+
+    tx_congestion_check();
+
   } while (reschedule);
 
-  tx_is_running = false;
+  uncork();
 
-  if ((txqueue_pending_pkts > 0) && (not flag_test(FLAG_TX_BLOCK_QUEUEING))) {
-    txthread.wakeup();
-  }
-}
+  tx_is_running = false;
 
-void crofsock::handle_read_event(cthread &thread, int fd) {
-  if (&thread == &rxthread) {
-    handle_read_event_rxthread(thread, fd);
+  /* producers storing messages during the final flush saw tx_is_running
+   * and did not post a task; only a congested socket resumes on its write
+   * event, the high watermark alone does not */
+  if ((txqueue_pending_pkts > 0) && (not flag_test(FLAG_CONGESTED))) {
+    for (auto &txqueue : txqueues) {
+      if (not txqueue.empty()) {
+        txthread.wakeup();
+        break;
+      }
+    }
   }
 }
 
-void crofsock::handle_read_event_rxthread(cthread &thread, int fd) {
-  try {
-    switch (state) {
-    case STATE_LISTENING: {
-
-      VLOG(2) << __FUNCTION__
-              << " STATE_LISTENING, new incoming connection(s) on sd=" << sd
-              << " laddr=" << laddr.str() << " raddr=" << raddr.str();
-
-      crofsock_env::call_env(env).handle_listen(*this);
+bool crofsock::flush_txbuffer(bool more) {
+  if (flag_test(FLAG_URING_IN_USE) && (msg_bytes_sent < txlen))
+    return uring_send();
+
+  while (msg_bytes_sent < txlen) {
+    int flags = MSG_DONTWAIT | MSG_NOSIGNAL;
+    if (more)
+      flags |= MSG_MORE;
+
+    /* send memory block via socket in non-blocking mode */
+    int nbytes;
+    if (shmring) {
+      nbytes = shmring->write(txbuffer.somem() + msg_bytes_sent,
+                              txlen - msg_bytes_sent);
+      if (0 == nbytes) {
+        /* ring full, the space doorbell signals progress */
+        nbytes = -1;
+        errno = EAGAIN;
+      }
+    } else {
+      nbytes = ::send(sd, txbuffer.somem() + msg_bytes_sent,
+                      txlen - msg_bytes_sent, flags);
+    }
 
-    } break;
-    case STATE_TCP_CONNECTING: {
+    /* error occurred */
+    if (nbytes < 0) {
+      switch (errno) {
+      case EAGAIN: /* socket would block */ {
+        tx_is_running = false;
+        tx_fragment_pending = true;
+        flag_set(FLAG_CONGESTED, true);
+        if (not shmring) {
+          txthread.add_write_fd(sd);
+        }
 
-      int rc;
-      int optval = 0;
-      int optlen = sizeof(optval);
-      if ((rc = getsockopt(sd, SOL_SOCKET, SO_ERROR, (void *)&optval,
-                           (socklen_t *)&optlen)) < 0) {
-        throw eSysCall("eSysCall", "getsockopt (SO_ERROR)", __FILE__,
-                       __FUNCTION__, __LINE__);
+        /* block transmission of further packets */
+        tx_congestion_occurred(true);
       }
+        return false;
+      case SIGPIPE:
+      default: {
+        VLOG(1) << __FUNCTION__ << " ::send() syscall failed, error: " << errno
+                << ": " << strerror(errno);
+        tx_is_running = false;
+      }
+        return false;
+      }
+    }
 
-      switch (optval) {
-      case 0:
-      case EISCONN: {
-        rxthread.drop_write_fd(sd);
+    /* at least some bytes were sent successfully */
+    msg_bytes_sent += nbytes;
+    update_tx_drain_rate(nbytes);
+    flag_set(FLAG_CONGESTED, false);
+    tx_corked = more && (not shmring);
 
-        if ((getsockname(sd, laddr.ca_saddr, &(laddr.salen))) < 0) {
-          throw eSysCall("eSysCall", "getsockname", __FILE__, __FUNCTION__,
-                         __LINE__);
-        }
+    /* messages sent completely */
+    while ((tx_msgs_sent < tx_msg_ends.size()) &&
+           (tx_msg_ends[tx_msgs_sent] <= msg_bytes_sent)) {
+      tx_msgs_sent++;
+      txqueue_pending_pkts--;
+    }
 
-        if ((getpeername(sd, raddr.ca_saddr, &(raddr.salen))) < 0) {
-          throw eSysCall("eSysCall", "getpeername", __FILE__, __FUNCTION__,
-                         __LINE__);
-        }
+    VLOG(3) << __FUNCTION__ << ": sent " << nbytes
+            << " bytes msg_bytes_sent=" << msg_bytes_sent << " txlen=" << txlen
+            << " txqueue_pending_pkts=" << txqueue_pending_pkts;
+  }
 
-        state = STATE_TCP_ESTABLISHED;
+  /* txbuffer drained */
+  tx_fragment_pending = false;
+  msg_bytes_sent = 0;
+  txlen = 0;
+  tx_msg_ends.clear();
+  tx_msgs_sent = 0;
+  return true;
+}
 
-        VLOG(2) << __FUNCTION__
-                << " STATE_TCP_ESTABLISHED laddr=" << laddr.str()
-                << " raddr=" << raddr.str();
+bool crofsock::uring_send() {
+  tx_is_running = false;
+  tx_fragment_pending = true;
+
+  /* segments in flight, txbuffer is not modified until they completed */
+  if (tx_uring_pending > 0)
+    return false;
+
+  /* segments end on message boundaries, so each completion retires whole
+   * messages, the chain of linked sends keeps them in order, bytes beyond
+   * max_segs segments follow with the next chain */
+  std::vector<struct iovec> segs;
+  unsigned int max_segs = txthread.get_max_send_segs();
+  size_t offset = msg_bytes_sent;
+  size_t i = tx_msgs_sent;
+  while ((offset < txlen) && (segs.size() < max_segs)) {
+    size_t end = offset;
+    while ((i < tx_msg_ends.size()) &&
+           ((end == offset) || (tx_msg_ends[i] - offset <= TX_SEGMENT_SIZE))) {
+      end = tx_msg_ends[i++];
+    }
+    if (end <= offset)
+      end = txlen;
+    struct iovec seg;
+    seg.iov_base = txbuffer.somem() + offset;
+    seg.iov_len = end - offset;
+    segs.push_back(seg);
+    offset = end;
+  }
+
+  if (not txthread.send(sd, segs.data(), segs.size())) {
+    /* event loop without io_uring support */
+    flag_set(FLAG_URING_IN_USE, false);
+    tx_is_running = true;
+    return flush_txbuffer(false);
+  }
+  tx_uring_pending = segs.size();
+  tx_corked = false;
+  return false;
+}
 
-        /* register socket descriptor for read operations */
-        rxthread.add_fd(sd);
-        rxthread.add_read_fd(sd);
+crofsock &crofsock::set_txclass(unsigned int txclass, size_t quantum,
+                                bool strict) {
+  if (txclass >= TXCLASS_MAX) {
+    throw eRofSockInvalid("crofsock::set_txclass() invalid txclass", __FILE__,
+                          __FUNCTION__, __LINE__);
+  }
+  /* the scheduler is owned by txthread */
+  txthread.post([this, txclass, quantum, strict]() {
+    txsched->set_class(txclass, quantum, strict);
+  });
+  return *this;
+}
 
-        if (flag_test(FLAG_TLS_IN_USE)) {
-          crofsock::tls_connect(flag_test(FLAG_RECONNECT_ON_FAILURE));
-        } else {
-          crofsock_env::call_env(env).handle_tcp_connected(*this);
-        }
+crofsock &crofsock::set_txsched(ctxsched *sched) {
+  if (nullptr == sched) {
+    throw eRofSockInvalid("crofsock::set_txsched() invalid scheduler",
+                          __FILE__, __FUNCTION__, __LINE__);
+  }
+  txthread.post([this, sched]() { txsched.reset(sched); });
+  return *this;
+}
 
-        rxthread.wakeup();
+crofsock &crofsock::set_txclass_stats(bool enable) {
+  txstats_enabled = enable;
+  for (auto &txqueue : txqueues) {
+    txqueue.set_timestamps(enable);
+  }
+  return *this;
+}
+
+ctxclass_stats crofsock::get_txclass_stats(unsigned int txclass) const {
+  if (txclass >= TXCLASS_MAX) {
+    throw eRofSockInvalid("crofsock::get_txclass_stats() invalid txclass",
+                          __FILE__, __FUNCTION__, __LINE__);
+  }
+  std::lock_guard<std::mutex> lock(txstats_mutex);
+  return txstats[txclass];
+}
+
+void crofsock::clear_txclass_stats() {
+  std::lock_guard<std::mutex> lock(txstats_mutex);
+  for (auto &stats : txstats) {
+    stats.clear();
+  }
+}
+
+void crofsock::record_txclass_stats(unsigned int txclass, size_t len,
+                                    uint64_t stamp) {
+  uint64_t now = now_nsecs();
+  std::lock_guard<std::mutex> lock(txstats_mutex);
+  txstats[txclass].add(len, (now > stamp) ? now - stamp : 0);
+}
+
+void crofsock::tx_congestion_occurred(bool half_rule) {
+  if (not flag_test_and_set(FLAG_TX_BLOCK_QUEUEING))
+    return;
+
+  /* remember queued bytes, when congestion occurred */
+  size_t bytes = get_txqueue_bytes();
+  txqueue_bytes_congestion_occurred = bytes;
+  /* threshold for re-enabling acceptance of packets, watermarks only */
+  txqueue_bytes_tx_threshold = half_rule ? bytes / 2 : bytes;
+  tx_congestion_episodes++;
+
+  VLOG(3) << __FUNCTION__ << " congestion occurred"
+          << " txqueue_pending_pkts: " << txqueue_pending_pkts
+          << " txqueue_bytes_congestion_occurred: "
+          << txqueue_bytes_congestion_occurred
+          << " txqueue_bytes_tx_threshold: " << txqueue_bytes_tx_threshold
+          << " laddr=" << laddr.str() << " raddr=" << raddr.str();
+
+  /* indications are sent from txthread */
+  if (txthread.get_thread_id() == pthread_self()) {
+    crofsock_env::call_env(env).congestion_occurred_indication(*this);
+  } else {
+    txthread.post([this]() {
+      crofsock_env::call_env(env).congestion_occurred_indication(*this);
+    });
+  }
+}
+
+bool crofsock::tx_congestion_solved() const {
+  for (auto &txqueue : txqueues) {
+    if (not txqueue.is_below_low_watermark())
+      return false;
+  }
+  size_t bytes = get_txqueue_bytes();
+  if (bytes <= txqueue_bytes_tx_threshold)
+    return true;
+  /* remaining bytes are sent within the drain target */
+  return (bytes <= tx_drain_rate * tx_drain_target / 1000);
+}
+
+void crofsock::update_tx_drain_rate(size_t nbytes) {
+  ctimespec now = ctimespec::now();
+  if (0 == tx_drain_bytes) {
+    tx_drain_stamp = now;
+  }
+  tx_drain_bytes += nbytes;
+
+  const struct timespec &delta = (now - tx_drain_stamp).get_tspec();
+  uint64_t nsecs = delta.tv_sec * 1000000000ULL + delta.tv_nsec;
+  if (nsecs < TX_DRAIN_SAMPLE_NSECS)
+    return;
+
+  /* socket was idle, the sample says nothing about the drain rate */
+  if (nsecs > 4 * TX_DRAIN_SAMPLE_NSECS) {
+    tx_drain_stamp = now;
+    tx_drain_bytes = nbytes;
+    return;
+  }
+
+  /* exponentially weighted moving average over samples */
+  uint64_t rate = tx_drain_bytes * 1000000000ULL / nsecs;
+  tx_drain_rate = (0 == tx_drain_rate) ? rate : (3 * tx_drain_rate + rate) / 4;
+  tx_drain_bytes = 0;
+}
+
+void crofsock::tx_congestion_check() {
+  if ((not flag_test(FLAG_CONGESTED)) && flag_test(FLAG_TX_BLOCK_QUEUEING)) {
+    if (tx_congestion_solved()) {
+      flag_set(FLAG_TX_BLOCK_QUEUEING, false);
+      VLOG(3) << __FUNCTION__ << " congestion solved"
+              << " txqueue_pending_pkts=" << txqueue_pending_pkts
+              << " txqueue_bytes=" << get_txqueue_bytes()
+              << " txqueue_bytes_congestion_occurred="
+              << txqueue_bytes_congestion_occurred
+              << " txqueue_bytes_tx_threshold=" << txqueue_bytes_tx_threshold
+              << " tx_drain_rate=" << tx_drain_rate
+              << " laddr=" << laddr.str() << " raddr=" << raddr.str();
+
+      crofsock_env::call_env(env).congestion_solved_indication(*this);
+    }
+  }
+}
+
+void crofsock::uncork() {
+  if (not tx_corked)
+    return;
+  tx_corked = false;
+  /* setting TCP_NODELAY pushes out pending segments */
+  int optval = 1;
+  ::setsockopt(sd, IPPROTO_TCP, TCP_NODELAY, &optval, sizeof(optval));
+}
+
+void crofsock::reset_txbuffer() {
+  /* messages packed but not sent completely are lost */
+  txqueue_pending_pkts -= (tx_msg_ends.size() - tx_msgs_sent);
+  /* as is a message retrieved but not packed yet */
+  if (nullptr != tx_msg) {
+    delete tx_msg;
+    tx_msg = nullptr;
+    txqueue_pending_pkts--;
+  }
+  if (nullptr != tx_frame) {
+    delete tx_frame;
+    tx_frame = nullptr;
+    txqueue_pending_pkts--;
+  }
+  tx_fragment_pending = false;
+  msg_bytes_sent = 0;
+  txlen = 0;
+  tx_msg_ends.clear();
+  tx_msgs_sent = 0;
+  tx_corked = false;
+  tx_uring_pending = 0;
+}
+
+void crofsock::reset_rxbuffer() {
+  /* message fragments of a previous connection are useless */
+  rx_offset = rxlen;
+  compact_rxbuffer();
+  rx_backlog.clear();
+  rx_uring_closed = false;
+  rx_uring_errno = 0;
+}
+
+void crofsock::compact_rxbuffer() {
+  size_t fraglen = rxlen - rx_offset;
+  if (rxbuffer.use_count() > 1) {
+    /* views still refer to parsed messages, continue in a new buffer */
+    std::shared_ptr<cmemory> mem(new cmemory(RXBUFFER_SIZE));
+    cthread_affinity::bind_memory(mem->somem(), mem->length(),
+                                  rxthread.get_numa_node());
+    memcpy(mem->somem(), rxbuffer->somem() + rx_offset, fraglen);
+    rxbuffer = mem;
+  } else {
+    memmove(rxbuffer->somem(), rxbuffer->somem() + rx_offset, fraglen);
+  }
+  rxlen = fraglen;
+  rx_offset = 0;
+}
+
+void crofsock::handle_read_event(cthread &thread, int fd) {
+  if (&thread == &rxthread) {
+    handle_read_event_rxthread(thread, fd);
+  } else if (&thread == &txthread) {
+    /* peer consumed data from a full ring */
+    if ((state <= STATE_CLOSED) || (not shmring) ||
+        (fd != shmring->get_tx_fd()))
+      return;
+    cshmring::clear_fd(fd);
+    if (flag_test(FLAG_CONGESTED)) {
+      flag_set(FLAG_CONGESTED, false);
+      send_from_queue();
+    }
+  }
+}
+
+void crofsock::handle_read_event_rxthread(cthread &thread, int fd) {
+  try {
+    switch (state) {
+    case STATE_LISTENING: {
+
+      VLOG(2) << __FUNCTION__
+              << " STATE_LISTENING, new incoming connection(s) on sd=" << sd
+              << " laddr=" << laddr.str() << " raddr=" << raddr.str();
+
+      crofsock_env::call_env(env).handle_listen(*this);
+
+    } break;
+    case STATE_TCP_CONNECTING: {
+
+      int rc;
+      int optval = 0;
+      int optlen = sizeof(optval);
+      if ((rc = getsockopt(sd, SOL_SOCKET, SO_ERROR, (void *)&optval,
+                           (socklen_t *)&optlen)) < 0) {
+        throw eSysCall("eSysCall", "getsockopt (SO_ERROR)", __FILE__,
+                       __FUNCTION__, __LINE__);
+      }
+
+      switch (optval) {
+      case 0:
+      case EISCONN: {
+        rxthread.drop_write_fd(sd);
+
+        if ((getsockname(sd, laddr.ca_saddr, &(laddr.salen))) < 0) {
+          throw eSysCall("eSysCall", "getsockname", __FILE__, __FUNCTION__,
+                         __LINE__);
+        }
+
+        if ((getpeername(sd, raddr.ca_saddr, &(raddr.salen))) < 0) {
+          throw eSysCall("eSysCall", "getpeername", __FILE__, __FUNCTION__,
+                         __LINE__);
+        }
+
+        state = STATE_TCP_ESTABLISHED;
+
+        VLOG(2) << __FUNCTION__
+                << " STATE_TCP_ESTABLISHED laddr=" << laddr.str()
+                << " raddr=" << raddr.str();
+
+        /* register socket descriptor for read operations */
+        rx_start();
+
+        if (flag_test(FLAG_SHM_IN_USE)) {
+          shm_established();
+        }
+
+        if (flag_test(FLAG_TLS_IN_USE)) {
+          crofsock::tls_connect(flag_test(FLAG_RECONNECT_ON_FAILURE));
+        } else {
+          crofsock_env::call_env(env).handle_tcp_connected(*this);
+        }
+
+        rxthread.wakeup();
 
       } break;
       case EINPROGRESS: {
@@ -1677,6 +2387,10 @@ void crofsock::handle_read_event_rxthread(cthread &thread, int fd) {
     } break;
     case STATE_TCP_ACCEPTING: {
 
+      if (flag_test(FLAG_SHM_IN_USE)) {
+        shm_accepting();
+      }
+
     } break;
     case STATE_TLS_CONNECTING: {
 
@@ -1698,6 +2412,9 @@ void crofsock::handle_read_event_rxthread(cthread &thread, int fd) {
 
       if (flag_test(FLAG_TLS_IN_USE))
         return;
+      if (shmring && (fd == shmring->get_rx_fd())) {
+        cshmring::clear_fd(fd);
+      }
       recv_message();
 
     } break;
@@ -1722,6 +2439,8 @@ void crofsock::handle_read_event_rxthread(cthread &thread, int fd) {
 }
 
 void crofsock::recv_message() {
+  unsigned int num_pkts = 0;
+
   while (not rx_disabled) {
 
     if (state <= STATE_CLOSED) {
@@ -1730,33 +2449,52 @@ void crofsock::recv_message() {
       return;
     }
 
-    if (not rx_fragment_pending) {
-      msg_bytes_read = 0;
-    }
+    /* parse all complete messages received so far */
+    while (rxlen - rx_offset >= sizeof(struct openflow::ofp_header)) {
+      struct openflow::ofp_header *header =
+          (struct openflow::ofp_header *)(rxbuffer->somem() + rx_offset);
+      uint16_t msg_len = be16toh(header->length);
+
+      /* sanity check: 8 <= msg_len <= 2^16 */
+      if (msg_len < sizeof(struct openflow::ofp_header)) {
+        /* out-of-sync => enforce reconnect in client mode */
+        VLOG(2) << __FUNCTION__
+                << " TCP: openflow out-of-sync laddr=" << laddr.str()
+                << " raddr=" << raddr.str();
+        goto on_error;
+      }
 
-    uint16_t msg_len = 0;
+      /* message fragment, wait for more bytes */
+      if (rxlen - rx_offset < msg_len)
+        break;
 
-    /* how many bytes do we have to read? */
-    if (msg_bytes_read < sizeof(struct openflow::ofp_header)) {
-      msg_len = sizeof(struct openflow::ofp_header);
-    } else {
-      struct openflow::ofp_header *header =
-          (struct openflow::ofp_header *)(rxbuffer.somem());
-      msg_len = be16toh(header->length);
+      rx_offset += msg_len;
+      if ((not get_rx_view(header->type)) ||
+          (not recv_view(rx_offset - msg_len, msg_len))) {
+        recv_parsed(rxbuffer->somem() + rx_offset - msg_len, msg_len);
+      }
+
+      if ((rx_disabled) || (state <= STATE_CLOSED))
+        return;
+
+      /* give other sockets on this thread a chance */
+      if (++num_pkts >= max_pkts_rcvd_per_round) {
+        rxthread.wakeup();
+        return;
+      }
     }
 
-    /* sanity check: 8 <= msg_len <= 2^16 */
-    if (msg_len < sizeof(struct openflow::ofp_header)) {
-      /* out-of-sync => enforce reconnect in client mode */
-      VLOG(2) << __FUNCTION__
-              << " TCP: openflow out-of-sync laddr=" << laddr.str()
-              << " raddr=" << raddr.str();
-      goto on_error;
+    /* move message fragment to start of rxbuffer */
+    if (rx_offset > 0) {
+      compact_rxbuffer();
     }
 
-    /* read from socket more bytes, at most "msg_len - msg_bytes_read" */
-    int rc = ::recv(sd, (void *)(rxbuffer.somem() + msg_bytes_read),
-                    msg_len - msg_bytes_read, MSG_DONTWAIT);
+    /* read from socket as many bytes as fit into rxbuffer */
+    int rc = shmring ? shm_recv()
+             : flag_test(FLAG_URING_IN_USE)
+                 ? uring_recv()
+                 : ::recv(sd, (void *)(rxbuffer->somem() + rxlen),
+                          rxbuffer->length() - rxlen, MSG_DONTWAIT);
 
     if (rc < 0) {
       switch (errno) {
@@ -1780,23 +2518,7 @@ void crofsock::recv_message() {
       goto on_error;
     }
 
-    msg_bytes_read += rc;
-
-    /* minimum message length received, check completeness of message */
-    if (msg_bytes_read >= sizeof(struct openflow::ofp_header)) {
-      struct openflow::ofp_header *header =
-          (struct openflow::ofp_header *)(rxbuffer.somem());
-      uint16_t msg_len = be16toh(header->length);
-
-      /* ok, message was received completely */
-      if (msg_len == msg_bytes_read) {
-        rx_fragment_pending = false;
-        parse_message();
-        msg_bytes_read = 0;
-      } else {
-        rx_fragment_pending = true;
-      }
-    }
+    rxlen += rc;
   }
 
   return;
@@ -1825,42 +2547,77 @@ on_error:
   }
 }
 
-void crofsock::parse_message() {
+bool crofsock::recv_view(size_t offset, size_t buflen) {
+  try {
+    rofl::openflow::cofmsg_view view(rxbuffer, offset, buflen);
+
+    VLOG(3) << __FUNCTION__ << " message rcvd: " << view
+            << " laddr=" << laddr.str() << " raddr=" << raddr.str();
+
+    return crofsock_env::call_env(env).handle_recv_view(*this, view);
+
+  } catch (eBadRequestBase &e) {
+
+    /* malformed message, recv_parsed() sends the error reply */
+    return false;
+
+  } catch (rofl::exception &e) {
+
+    VLOG(1) << __FUNCTION__ << " dropping message, error: " << e.what()
+            << " laddr=" << laddr.str() << " raddr=" << raddr.str();
+  }
+  return true;
+}
+
+rofl::openflow::cofmsg *
+crofsock::parse_view(const rofl::openflow::cofmsg_view &view) {
+  /* cofmsg_dispatch::parse() does not modify the buffer */
+  return parse_message((uint8_t *)view.somem(), view.length());
+}
+
+void crofsock::recv_parsed(uint8_t *buf, size_t buflen) {
+  rofl::openflow::cofmsg *msg = parse_message(buf, buflen);
+  if (nullptr == msg) {
+    return;
+  }
+
+  if (state <= STATE_CLOSED) {
+    delete msg;
+    return;
+  }
+
+  VLOG(3) << __FUNCTION__ << " message rcvd: " << msg->str().c_str()
+          << " laddr=" << laddr.str() << " raddr=" << raddr.str();
+
+  try {
+    crofsock_env::call_env(env).handle_recv(*this, msg);
+
+  } catch (rofl::exception &e) {
+
+    VLOG(1) << __FUNCTION__ << " error: " << e.what()
+            << " laddr=" << laddr.str() << " raddr=" << raddr.str();
+
+  } catch (std::runtime_error &e) {
+    VLOG(1) << __FUNCTION__ << " std::runtime_error: %s" << e.what()
+            << " laddr=" << laddr.str() << " raddr=" << raddr.str();
+  }
+}
+
+rofl::openflow::cofmsg *crofsock::parse_message(uint8_t *buf, size_t buflen) {
   struct rofl::openflow::ofp_header *hdr =
-      (struct rofl::openflow::ofp_header *)rxbuffer.somem();
+      (struct rofl::openflow::ofp_header *)buf;
 
   rofl::openflow::cofmsg *msg = (rofl::openflow::cofmsg *)0;
   try {
-    if (rxbuffer.length() < sizeof(struct rofl::openflow::ofp_header)) {
+    if (buflen < sizeof(struct rofl::openflow::ofp_header)) {
       throw eBadRequestBadLen("eBadRequestBadLen", __FILE__, __FUNCTION__,
                               __LINE__);
     }
 
     /* make sure to have a valid cofmsg* msg object after parsing */
-    switch (hdr->version) {
-    case rofl::openflow10::OFP_VERSION: {
-      parse_of10_message(&msg);
-    } break;
-    case rofl::openflow12::OFP_VERSION: {
-      parse_of12_message(&msg);
-    } break;
-    case rofl::openflow13::OFP_VERSION: {
-      parse_of13_message(&msg);
-    } break;
-    default: {
-      throw eBadRequestBadVersion("eBadRequestBadVersion", __FILE__,
-                                  __FUNCTION__, __LINE__);
-    };
-    }
+    msg = rofl::openflow::cofmsg_dispatch::parse(buf, buflen);
 
-    if (state <= STATE_CLOSED) {
-      return;
-    }
-
-    VLOG(3) << __FUNCTION__ << " message rcvd: " << msg->str().c_str()
-            << " laddr=" << laddr.str() << " raddr=" << raddr.str();
-
-    crofsock_env::call_env(env).handle_recv(*this, msg);
+    return msg;
 
   } catch (eBadRequestBadType &e) {
 
@@ -1868,8 +2625,7 @@ void crofsock::parse_message() {
             << " laddr=" << laddr.str() << " raddr=" << raddr.str();
 
     send_message(new rofl::openflow::cofmsg_error_bad_request_bad_type(
-        hdr->version, be32toh(hdr->xid), rxbuffer.somem(),
-        (rxbuffer.length() > 64) ? 64 : msg_bytes_read));
+        hdr->version, be32toh(hdr->xid), buf, (buflen > 64) ? 64 : buflen));
 
   } catch (eBadRequestBadStat &e) {
 
@@ -1877,8 +2633,7 @@ void crofsock::parse_message() {
             << " laddr=" << laddr.str() << " raddr=" << raddr.str();
 
     send_message(new rofl::openflow::cofmsg_error_bad_request_bad_stat(
-        hdr->version, be32toh(hdr->xid), rxbuffer.somem(),
-        (rxbuffer.length() > 64) ? 64 : msg_bytes_read));
+        hdr->version, be32toh(hdr->xid), buf, (buflen > 64) ? 64 : buflen));
 
   } catch (eBadRequestBadVersion &e) {
 
@@ -1889,8 +2644,7 @@ void crofsock::parse_message() {
       delete msg;
 
     send_message(new rofl::openflow::cofmsg_error_bad_request_bad_version(
-        hdr->version, be32toh(hdr->xid), rxbuffer.somem(),
-        (rxbuffer.length() > 64) ? 64 : msg_bytes_read));
+        hdr->version, be32toh(hdr->xid), buf, (buflen > 64) ? 64 : buflen));
 
   } catch (eBadRequestBadLen &e) {
 
@@ -1901,8 +2655,7 @@ void crofsock::parse_message() {
       delete msg;
 
     send_message(new rofl::openflow::cofmsg_error_bad_request_bad_len(
-        hdr->version, be32toh(hdr->xid), rxbuffer.somem(),
-        (rxbuffer.length() > 64) ? 64 : msg_bytes_read));
+        hdr->version, be32toh(hdr->xid), buf, (buflen > 64) ? 64 : buflen));
 
   } catch (rofl::exception &e) {
 
@@ -1915,553 +2668,6 @@ void crofsock::parse_message() {
     VLOG(1) << __FUNCTION__ << " std::runtime_error: %s" << e.what()
             << " laddr=" << laddr.str() << " raddr=" << raddr.str();
   }
+  return (rofl::openflow::cofmsg *)0;
 }
 
-void crofsock::parse_of10_message(rofl::openflow::cofmsg **pmsg) {
-  struct openflow::ofp_header *header =
-      (struct openflow::ofp_header *)rxbuffer.somem();
-
-  switch (header->type) {
-  case rofl::openflow10::OFPT_HELLO: {
-    *pmsg = new rofl::openflow::cofmsg_hello();
-  } break;
-  case rofl::openflow10::OFPT_ERROR: {
-    *pmsg = new rofl::openflow::cofmsg_error();
-  } break;
-  case rofl::openflow10::OFPT_ECHO_REQUEST: {
-    *pmsg = new rofl::openflow::cofmsg_echo_request();
-  } break;
-  case rofl::openflow10::OFPT_ECHO_REPLY: {
-    *pmsg = new rofl::openflow::cofmsg_echo_reply();
-  } break;
-  case rofl::openflow10::OFPT_VENDOR: {
-    *pmsg = new rofl::openflow::cofmsg_experimenter();
-  } break;
-  case rofl::openflow10::OFPT_FEATURES_REQUEST: {
-    *pmsg = new rofl::openflow::cofmsg_features_request();
-  } break;
-  case rofl::openflow10::OFPT_FEATURES_REPLY: {
-    *pmsg = new rofl::openflow::cofmsg_features_reply();
-  } break;
-  case rofl::openflow10::OFPT_GET_CONFIG_REQUEST: {
-    *pmsg = new rofl::openflow::cofmsg_get_config_request();
-  } break;
-  case rofl::openflow10::OFPT_GET_CONFIG_REPLY: {
-    *pmsg = new rofl::openflow::cofmsg_get_config_reply();
-  } break;
-  case rofl::openflow10::OFPT_SET_CONFIG: {
-    *pmsg = new rofl::openflow::cofmsg_set_config();
-  } break;
-  case rofl::openflow10::OFPT_PACKET_OUT: {
-    *pmsg = new rofl::openflow::cofmsg_packet_out();
-  } break;
-  case rofl::openflow10::OFPT_PACKET_IN: {
-    *pmsg = new rofl::openflow::cofmsg_packet_in();
-  } break;
-  case rofl::openflow10::OFPT_FLOW_MOD: {
-    *pmsg = new rofl::openflow::cofmsg_flow_mod();
-  } break;
-  case rofl::openflow10::OFPT_FLOW_REMOVED: {
-    *pmsg = new rofl::openflow::cofmsg_flow_removed();
-  } break;
-  case rofl::openflow10::OFPT_PORT_MOD: {
-    *pmsg = new rofl::openflow::cofmsg_port_mod();
-  } break;
-  case rofl::openflow10::OFPT_PORT_STATUS: {
-    *pmsg = new rofl::openflow::cofmsg_port_status();
-  } break;
-  case rofl::openflow10::OFPT_STATS_REQUEST: {
-    if (rxbuffer.length() <
-        sizeof(struct rofl::openflow10::ofp_stats_request)) {
-      throw eBadRequestBadLen("eBadRequestBadLen", __FILE__, __FUNCTION__,
-                              __LINE__);
-    }
-    uint16_t stats_type = be16toh(
-        ((struct rofl::openflow10::ofp_stats_request *)rxbuffer.somem())->type);
-    switch (stats_type) {
-    case rofl::openflow10::OFPST_DESC: {
-      *pmsg = new rofl::openflow::cofmsg_desc_stats_request();
-    } break;
-    case rofl::openflow10::OFPST_FLOW: {
-      *pmsg = new rofl::openflow::cofmsg_flow_stats_request();
-    } break;
-    case rofl::openflow10::OFPST_AGGREGATE: {
-      *pmsg = new rofl::openflow::cofmsg_aggr_stats_request();
-    } break;
-    case rofl::openflow10::OFPST_TABLE: {
-      *pmsg = new rofl::openflow::cofmsg_table_stats_request();
-    } break;
-    case rofl::openflow10::OFPST_PORT: {
-      *pmsg = new rofl::openflow::cofmsg_port_stats_request();
-    } break;
-    case rofl::openflow10::OFPST_QUEUE: {
-      *pmsg = new rofl::openflow::cofmsg_queue_stats_request();
-    } break;
-    case rofl::openflow10::OFPST_VENDOR: {
-      *pmsg = new rofl::openflow::cofmsg_experimenter_stats_request();
-    } break;
-    default: {
-      throw eBadRequestBadStat("eBadRequestBadStat", __FILE__, __FUNCTION__,
-                               __LINE__);
-    };
-    }
-  } break;
-  case rofl::openflow10::OFPT_STATS_REPLY: {
-    if (rxbuffer.length() < sizeof(struct rofl::openflow10::ofp_stats_reply)) {
-      throw eBadRequestBadLen("eBadRequestBadLen", __FILE__, __FUNCTION__,
-                              __LINE__);
-    }
-    uint16_t stats_type = be16toh(
-        ((struct rofl::openflow10::ofp_stats_reply *)rxbuffer.somem())->type);
-    switch (stats_type) {
-    case rofl::openflow10::OFPST_DESC: {
-      *pmsg = new rofl::openflow::cofmsg_desc_stats_reply();
-    } break;
-    case rofl::openflow10::OFPST_FLOW: {
-      *pmsg = new rofl::openflow::cofmsg_flow_stats_reply();
-    } break;
-    case rofl::openflow10::OFPST_AGGREGATE: {
-      *pmsg = new rofl::openflow::cofmsg_aggr_stats_reply();
-    } break;
-    case rofl::openflow10::OFPST_TABLE: {
-      *pmsg = new rofl::openflow::cofmsg_table_stats_reply();
-    } break;
-    case rofl::openflow10::OFPST_PORT: {
-      *pmsg = new rofl::openflow::cofmsg_port_stats_reply();
-    } break;
-    case rofl::openflow10::OFPST_QUEUE: {
-      *pmsg = new rofl::openflow::cofmsg_queue_stats_reply();
-    } break;
-    case rofl::openflow10::OFPST_VENDOR: {
-      *pmsg = new rofl::openflow::cofmsg_experimenter_stats_reply();
-    } break;
-    default: {
-      throw eBadRequestBadStat("eBadRequestBadStat", __FILE__, __FUNCTION__,
-                               __LINE__);
-    };
-    }
-  } break;
-  case rofl::openflow10::OFPT_BARRIER_REQUEST: {
-    *pmsg = new rofl::openflow::cofmsg_barrier_request();
-  } break;
-  case rofl::openflow10::OFPT_BARRIER_REPLY: {
-    *pmsg = new rofl::openflow::cofmsg_barrier_reply();
-  } break;
-  case rofl::openflow10::OFPT_QUEUE_GET_CONFIG_REQUEST: {
-    *pmsg = new rofl::openflow::cofmsg_queue_get_config_request();
-  } break;
-  case rofl::openflow10::OFPT_QUEUE_GET_CONFIG_REPLY: {
-    *pmsg = new rofl::openflow::cofmsg_queue_get_config_reply();
-  } break;
-  default: {
-    throw eBadRequestBadType("eBadRequestBadType", __FILE__, __FUNCTION__,
-                             __LINE__);
-  };
-  }
-
-  (*(*pmsg)).unpack(rxbuffer.somem(), msg_bytes_read);
-}
-
-void crofsock::parse_of12_message(rofl::openflow::cofmsg **pmsg) {
-  struct openflow::ofp_header *header =
-      (struct openflow::ofp_header *)rxbuffer.somem();
-
-  switch (header->type) {
-  case rofl::openflow12::OFPT_HELLO: {
-    *pmsg = new rofl::openflow::cofmsg_hello();
-  } break;
-  case rofl::openflow12::OFPT_ERROR: {
-    *pmsg = new rofl::openflow::cofmsg_error();
-  } break;
-  case rofl::openflow12::OFPT_ECHO_REQUEST: {
-    *pmsg = new rofl::openflow::cofmsg_echo_request();
-  } break;
-  case rofl::openflow12::OFPT_ECHO_REPLY: {
-    *pmsg = new rofl::openflow::cofmsg_echo_reply();
-  } break;
-  case rofl::openflow12::OFPT_EXPERIMENTER: {
-    *pmsg = new rofl::openflow::cofmsg_experimenter();
-  } break;
-  case rofl::openflow12::OFPT_FEATURES_REQUEST: {
-    *pmsg = new rofl::openflow::cofmsg_features_request();
-  } break;
-  case rofl::openflow12::OFPT_FEATURES_REPLY: {
-    *pmsg = new rofl::openflow::cofmsg_features_reply();
-  } break;
-  case rofl::openflow12::OFPT_GET_CONFIG_REQUEST: {
-    *pmsg = new rofl::openflow::cofmsg_get_config_request();
-  } break;
-  case rofl::openflow12::OFPT_GET_CONFIG_REPLY: {
-    *pmsg = new rofl::openflow::cofmsg_get_config_reply();
-  } break;
-  case rofl::openflow12::OFPT_SET_CONFIG: {
-    *pmsg = new rofl::openflow::cofmsg_set_config();
-  } break;
-  case rofl::openflow12::OFPT_PACKET_OUT: {
-    *pmsg = new rofl::openflow::cofmsg_packet_out();
-  } break;
-  case rofl::openflow12::OFPT_PACKET_IN: {
-    *pmsg = new rofl::openflow::cofmsg_packet_in();
-  } break;
-  case rofl::openflow12::OFPT_FLOW_MOD: {
-    *pmsg = new rofl::openflow::cofmsg_flow_mod();
-  } break;
-  case rofl::openflow12::OFPT_FLOW_REMOVED: {
-    *pmsg = new rofl::openflow::cofmsg_flow_removed();
-  } break;
-  case rofl::openflow12::OFPT_GROUP_MOD: {
-    *pmsg = new rofl::openflow::cofmsg_group_mod();
-  } break;
-  case rofl::openflow12::OFPT_PORT_MOD: {
-    *pmsg = new rofl::openflow::cofmsg_port_mod();
-  } break;
-  case rofl::openflow12::OFPT_PORT_STATUS: {
-    *pmsg = new rofl::openflow::cofmsg_port_status();
-  } break;
-  case rofl::openflow12::OFPT_TABLE_MOD: {
-    *pmsg = new rofl::openflow::cofmsg_table_mod();
-  } break;
-  case rofl::openflow12::OFPT_STATS_REQUEST: {
-    if (rxbuffer.length() <
-        sizeof(struct rofl::openflow12::ofp_stats_request)) {
-      throw eBadRequestBadLen("eBadRequestBadLen", __FILE__, __FUNCTION__,
-                              __LINE__);
-    }
-    uint16_t stats_type = be16toh(
-        ((struct rofl::openflow12::ofp_stats_request *)rxbuffer.somem())->type);
-    switch (stats_type) {
-    case rofl::openflow12::OFPST_DESC: {
-      *pmsg = new rofl::openflow::cofmsg_desc_stats_request();
-    } break;
-    case rofl::openflow12::OFPST_FLOW: {
-      *pmsg = new rofl::openflow::cofmsg_flow_stats_request();
-    } break;
-    case rofl::openflow12::OFPST_AGGREGATE: {
-      *pmsg = new rofl::openflow::cofmsg_aggr_stats_request();
-    } break;
-    case rofl::openflow12::OFPST_TABLE: {
-      *pmsg = new rofl::openflow::cofmsg_table_stats_request();
-    } break;
-    case rofl::openflow12::OFPST_PORT: {
-      *pmsg = new rofl::openflow::cofmsg_port_stats_request();
-    } break;
-    case rofl::openflow12::OFPST_QUEUE: {
-      *pmsg = new rofl::openflow::cofmsg_queue_stats_request();
-    } break;
-    case rofl::openflow12::OFPST_GROUP: {
-      *pmsg = new rofl::openflow::cofmsg_group_stats_request();
-    } break;
-    case rofl::openflow12::OFPST_GROUP_DESC: {
-      *pmsg = new rofl::openflow::cofmsg_group_desc_stats_request();
-    } break;
-    case rofl::openflow12::OFPST_GROUP_FEATURES: {
-      *pmsg = new rofl::openflow::cofmsg_group_features_stats_request();
-    } break;
-    case rofl::openflow12::OFPST_EXPERIMENTER: {
-      *pmsg = new rofl::openflow::cofmsg_experimenter_stats_request();
-    } break;
-    default: {
-      throw eBadRequestBadStat("eBadRequestBadStat", __FILE__, __FUNCTION__,
-                               __LINE__);
-    };
-    }
-  } break;
-  case rofl::openflow12::OFPT_STATS_REPLY: {
-    if (rxbuffer.length() < sizeof(struct rofl::openflow12::ofp_stats_reply)) {
-      throw eBadRequestBadLen("eBadRequestBadLen", __FILE__, __FUNCTION__,
-                              __LINE__);
-    }
-    uint16_t stats_type = be16toh(
-        ((struct rofl::openflow12::ofp_stats_reply *)rxbuffer.somem())->type);
-    switch (stats_type) {
-    case rofl::openflow12::OFPST_DESC: {
-      *pmsg = new rofl::openflow::cofmsg_desc_stats_reply();
-    } break;
-    case rofl::openflow12::OFPST_FLOW: {
-      *pmsg = new rofl::openflow::cofmsg_flow_stats_reply();
-    } break;
-    case rofl::openflow12::OFPST_AGGREGATE: {
-      *pmsg = new rofl::openflow::cofmsg_aggr_stats_reply();
-    } break;
-    case rofl::openflow12::OFPST_TABLE: {
-      *pmsg = new rofl::openflow::cofmsg_table_stats_reply();
-    } break;
-    case rofl::openflow12::OFPST_PORT: {
-      *pmsg = new rofl::openflow::cofmsg_port_stats_reply();
-    } break;
-    case rofl::openflow12::OFPST_QUEUE: {
-      *pmsg = new rofl::openflow::cofmsg_queue_stats_reply();
-    } break;
-    case rofl::openflow12::OFPST_GROUP: {
-      *pmsg = new rofl::openflow::cofmsg_group_stats_reply();
-    } break;
-    case rofl::openflow12::OFPST_GROUP_DESC: {
-      *pmsg = new rofl::openflow::cofmsg_group_desc_stats_reply();
-    } break;
-    case rofl::openflow12::OFPST_GROUP_FEATURES: {
-      *pmsg = new rofl::openflow::cofmsg_group_features_stats_reply();
-    } break;
-    case rofl::openflow12::OFPST_EXPERIMENTER: {
-      *pmsg = new rofl::openflow::cofmsg_experimenter_stats_reply();
-    } break;
-    default: {
-      throw eBadRequestBadStat("eBadRequestBadStat", __FILE__, __FUNCTION__,
-                               __LINE__);
-    };
-    }
-  } break;
-  case rofl::openflow12::OFPT_BARRIER_REQUEST: {
-    *pmsg = new rofl::openflow::cofmsg_barrier_request();
-  } break;
-  case rofl::openflow12::OFPT_BARRIER_REPLY: {
-    *pmsg = new rofl::openflow::cofmsg_barrier_reply();
-  } break;
-  case rofl::openflow12::OFPT_QUEUE_GET_CONFIG_REQUEST: {
-    *pmsg = new rofl::openflow::cofmsg_queue_get_config_request();
-  } break;
-  case rofl::openflow12::OFPT_QUEUE_GET_CONFIG_REPLY: {
-    *pmsg = new rofl::openflow::cofmsg_queue_get_config_reply();
-  } break;
-  case rofl::openflow12::OFPT_ROLE_REQUEST: {
-    *pmsg = new rofl::openflow::cofmsg_role_request();
-  } break;
-  case rofl::openflow12::OFPT_ROLE_REPLY: {
-    *pmsg = new rofl::openflow::cofmsg_role_reply();
-  } break;
-  case rofl::openflow12::OFPT_GET_ASYNC_REQUEST: {
-    *pmsg = new rofl::openflow::cofmsg_get_async_config_request();
-  } break;
-  case rofl::openflow12::OFPT_GET_ASYNC_REPLY: {
-    *pmsg = new rofl::openflow::cofmsg_get_async_config_reply();
-  } break;
-  case rofl::openflow12::OFPT_SET_ASYNC: {
-    *pmsg = new rofl::openflow::cofmsg_set_async_config();
-  } break;
-  default: {
-    throw eBadRequestBadType("eBadRequestBadType", __FILE__, __FUNCTION__,
-                             __LINE__);
-  };
-  }
-
-  (*(*pmsg)).unpack(rxbuffer.somem(), msg_bytes_read);
-}
-
-void crofsock::parse_of13_message(rofl::openflow::cofmsg **pmsg) {
-  struct openflow::ofp_header *header =
-      (struct openflow::ofp_header *)rxbuffer.somem();
-
-  switch (header->type) {
-  case rofl::openflow13::OFPT_HELLO: {
-    *pmsg = new rofl::openflow::cofmsg_hello();
-  } break;
-  case rofl::openflow13::OFPT_ERROR: {
-    *pmsg = new rofl::openflow::cofmsg_error();
-  } break;
-  case rofl::openflow13::OFPT_ECHO_REQUEST: {
-    *pmsg = new rofl::openflow::cofmsg_echo_request();
-  } break;
-  case rofl::openflow13::OFPT_ECHO_REPLY: {
-    *pmsg = new rofl::openflow::cofmsg_echo_reply();
-  } break;
-  case rofl::openflow13::OFPT_EXPERIMENTER: {
-    *pmsg = new rofl::openflow::cofmsg_experimenter();
-  } break;
-  case rofl::openflow13::OFPT_FEATURES_REQUEST: {
-    *pmsg = new rofl::openflow::cofmsg_features_request();
-  } break;
-  case rofl::openflow13::OFPT_FEATURES_REPLY: {
-    *pmsg = new rofl::openflow::cofmsg_features_reply();
-  } break;
-  case rofl::openflow13::OFPT_GET_CONFIG_REQUEST: {
-    *pmsg = new rofl::openflow::cofmsg_get_config_request();
-  } break;
-  case rofl::openflow13::OFPT_GET_CONFIG_REPLY: {
-    *pmsg = new rofl::openflow::cofmsg_get_config_reply();
-  } break;
-  case rofl::openflow13::OFPT_SET_CONFIG: {
-    *pmsg = new rofl::openflow::cofmsg_set_config();
-  } break;
-  case rofl::openflow13::OFPT_PACKET_OUT: {
-    *pmsg = new rofl::openflow::cofmsg_packet_out();
-  } break;
-  case rofl::openflow13::OFPT_PACKET_IN: {
-    *pmsg = new rofl::openflow::cofmsg_packet_in();
-  } break;
-  case rofl::openflow13::OFPT_FLOW_MOD: {
-    *pmsg = new rofl::openflow::cofmsg_flow_mod();
-  } break;
-  case rofl::openflow13::OFPT_FLOW_REMOVED: {
-    *pmsg = new rofl::openflow::cofmsg_flow_removed();
-  } break;
-  case rofl::openflow13::OFPT_GROUP_MOD: {
-    *pmsg = new rofl::openflow::cofmsg_group_mod();
-  } break;
-  case rofl::openflow13::OFPT_PORT_MOD: {
-    *pmsg = new rofl::openflow::cofmsg_port_mod();
-  } break;
-  case rofl::openflow13::OFPT_PORT_STATUS: {
-    *pmsg = new rofl::openflow::cofmsg_port_status();
-  } break;
-  case rofl::openflow13::OFPT_TABLE_MOD: {
-    *pmsg = new rofl::openflow::cofmsg_table_mod();
-  } break;
-  case rofl::openflow13::OFPT_MULTIPART_REQUEST: {
-    if (rxbuffer.memlen() <
-        sizeof(struct rofl::openflow13::ofp_multipart_request)) {
-      throw eBadRequestBadLen("eBadRequestBadLen", __FILE__, __FUNCTION__,
-                              __LINE__);
-    }
-    uint16_t stats_type = be16toh(
-        ((struct rofl::openflow13::ofp_multipart_request *)rxbuffer.somem())
-            ->type);
-    switch (stats_type) {
-    case rofl::openflow13::OFPMP_DESC: {
-      *pmsg = new rofl::openflow::cofmsg_desc_stats_request();
-    } break;
-    case rofl::openflow13::OFPMP_FLOW: {
-      *pmsg = new rofl::openflow::cofmsg_flow_stats_request();
-    } break;
-    case rofl::openflow13::OFPMP_AGGREGATE: {
-      *pmsg = new rofl::openflow::cofmsg_aggr_stats_request();
-    } break;
-    case rofl::openflow13::OFPMP_TABLE: {
-      *pmsg = new rofl::openflow::cofmsg_table_stats_request();
-    } break;
-    case rofl::openflow13::OFPMP_PORT_STATS: {
-      *pmsg = new rofl::openflow::cofmsg_port_stats_request();
-    } break;
-    case rofl::openflow13::OFPMP_QUEUE: {
-      *pmsg = new rofl::openflow::cofmsg_queue_stats_request();
-    } break;
-    case rofl::openflow13::OFPMP_GROUP: {
-      *pmsg = new rofl::openflow::cofmsg_group_stats_request();
-    } break;
-    case rofl::openflow13::OFPMP_GROUP_DESC: {
-      *pmsg = new rofl::openflow::cofmsg_group_desc_stats_request();
-    } break;
-    case rofl::openflow13::OFPMP_GROUP_FEATURES: {
-      *pmsg = new rofl::openflow::cofmsg_group_features_stats_request();
-    } break;
-    case rofl::openflow13::OFPMP_METER: {
-      *pmsg = new rofl::openflow::cofmsg_meter_stats_request();
-    } break;
-    case rofl::openflow13::OFPMP_METER_CONFIG: {
-      *pmsg = new rofl::openflow::cofmsg_meter_config_stats_request();
-    } break;
-    case rofl::openflow13::OFPMP_METER_FEATURES: {
-      *pmsg = new rofl::openflow::cofmsg_meter_features_stats_request();
-    } break;
-    case rofl::openflow13::OFPMP_TABLE_FEATURES: {
-      *pmsg = new rofl::openflow::cofmsg_table_features_stats_request();
-    } break;
-    case rofl::openflow13::OFPMP_PORT_DESC: {
-      *pmsg = new rofl::openflow::cofmsg_port_desc_stats_request();
-    } break;
-    case rofl::openflow13::OFPMP_EXPERIMENTER: {
-      *pmsg = new rofl::openflow::cofmsg_experimenter_stats_request();
-    } break;
-    default: {
-      throw eBadRequestBadStat("eBadRequestBadStat", __FILE__, __FUNCTION__,
-                               __LINE__);
-    };
-    }
-  } break;
-  case rofl::openflow13::OFPT_MULTIPART_REPLY: {
-    if (rxbuffer.memlen() <
-        sizeof(struct rofl::openflow13::ofp_multipart_reply)) {
-      throw eBadRequestBadLen("eBadRequestBadLen", __FILE__, __FUNCTION__,
-                              __LINE__);
-    }
-    uint16_t stats_type = be16toh(
-        ((struct rofl::openflow13::ofp_multipart_reply *)rxbuffer.somem())
-            ->type);
-    switch (stats_type) {
-    case rofl::openflow13::OFPMP_DESC: {
-      *pmsg = new rofl::openflow::cofmsg_desc_stats_reply();
-    } break;
-    case rofl::openflow13::OFPMP_FLOW: {
-      *pmsg = new rofl::openflow::cofmsg_flow_stats_reply();
-    } break;
-    case rofl::openflow13::OFPMP_AGGREGATE: {
-      *pmsg = new rofl::openflow::cofmsg_aggr_stats_reply();
-    } break;
-    case rofl::openflow13::OFPMP_TABLE: {
-      *pmsg = new rofl::openflow::cofmsg_table_stats_reply();
-    } break;
-    case rofl::openflow13::OFPMP_PORT_STATS: {
-      *pmsg = new rofl::openflow::cofmsg_port_stats_reply();
-    } break;
-    case rofl::openflow13::OFPMP_QUEUE: {
-      *pmsg = new rofl::openflow::cofmsg_queue_stats_reply();
-    } break;
-    case rofl::openflow13::OFPMP_GROUP: {
-      *pmsg = new rofl::openflow::cofmsg_group_stats_reply();
-    } break;
-    case rofl::openflow13::OFPMP_GROUP_DESC: {
-      *pmsg = new rofl::openflow::cofmsg_group_desc_stats_reply();
-    } break;
-    case rofl::openflow13::OFPMP_GROUP_FEATURES: {
-      *pmsg = new rofl::openflow::cofmsg_group_features_stats_reply();
-    } break;
-    case rofl::openflow13::OFPMP_METER: {
-      *pmsg = new rofl::openflow::cofmsg_meter_stats_reply();
-    } break;
-    case rofl::openflow13::OFPMP_METER_CONFIG: {
-      *pmsg = new rofl::openflow::cofmsg_meter_config_stats_reply();
-    } break;
-    case rofl::openflow13::OFPMP_METER_FEATURES: {
-      *pmsg = new rofl::openflow::cofmsg_meter_features_stats_reply();
-    } break;
-    case rofl::openflow13::OFPMP_TABLE_FEATURES: {
-      *pmsg = new rofl::openflow::cofmsg_table_features_stats_reply();
-    } break;
-    case rofl::openflow13::OFPMP_PORT_DESC: {
-      *pmsg = new rofl::openflow::cofmsg_port_desc_stats_reply();
-    } break;
-    case rofl::openflow13::OFPMP_EXPERIMENTER: {
-      *pmsg = new rofl::openflow::cofmsg_experimenter_stats_reply();
-    } break;
-    default: {
-      throw eBadRequestBadStat("eBadRequestBadStat", __FILE__, __FUNCTION__,
-                               __LINE__);
-    };
-    }
-  } break;
-  case rofl::openflow13::OFPT_BARRIER_REQUEST: {
-    *pmsg = new rofl::openflow::cofmsg_barrier_request();
-  } break;
-  case rofl::openflow13::OFPT_BARRIER_REPLY: {
-    *pmsg = new rofl::openflow::cofmsg_barrier_reply();
-  } break;
-  case rofl::openflow13::OFPT_QUEUE_GET_CONFIG_REQUEST: {
-    *pmsg = new rofl::openflow::cofmsg_queue_get_config_request();
-  } break;
-  case rofl::openflow13::OFPT_QUEUE_GET_CONFIG_REPLY: {
-    *pmsg = new rofl::openflow::cofmsg_queue_get_config_reply();
-  } break;
-  case rofl::openflow13::OFPT_ROLE_REQUEST: {
-    *pmsg = new rofl::openflow::cofmsg_role_request();
-  } break;
-  case rofl::openflow13::OFPT_ROLE_REPLY: {
-    *pmsg = new rofl::openflow::cofmsg_role_reply();
-  } break;
-  case rofl::openflow13::OFPT_GET_ASYNC_REQUEST: {
-    *pmsg = new rofl::openflow::cofmsg_get_async_config_request();
-  } break;
-  case rofl::openflow13::OFPT_GET_ASYNC_REPLY: {
-    *pmsg = new rofl::openflow::cofmsg_get_async_config_reply();
-  } break;
-  case rofl::openflow13::OFPT_SET_ASYNC: {
-    *pmsg = new rofl::openflow::cofmsg_set_async_config();
-  } break;
-  case rofl::openflow13::OFPT_METER_MOD: {
-    *pmsg = new rofl::openflow::cofmsg_meter_mod();
-  } break;
-  default: {
-    throw eBadRequestBadType("eBadRequestBadType", __FILE__, __FUNCTION__,
-                             __LINE__);
-  };
-  }
-
-  (*(*pmsg)).unpack(rxbuffer.somem(), msg_bytes_read);
-}
@@ -24,6 +24,8 @@
 #include <iostream>
 #include <list>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 #include <set>
@@ -32,6 +34,7 @@
 #include <strings.h>
 #include <sys/ioctl.h>
 #include <sys/socket.h>
+#include <sys/stat.h>
 #include <sys/uio.h>
 #include <sys/un.h>
 #include <unistd.h>
@@ -44,8 +47,12 @@
 
 #include "rofl/common/crandom.h"
 #include "rofl/common/crofqueue.h"
+#include "rofl/common/cshmring.hpp"
 #include "rofl/common/csockaddr.h"
 #include "rofl/common/cthread.hpp"
+#include "rofl/common/cthread_pool.hpp"
+#include "rofl/common/ctimespec.hpp"
+#include "rofl/common/ctxsched.hpp"
 #include "rofl/common/exception.hpp"
 
 #include "rofl/common/openflow/messages/cofmsg.h"
@@ -54,6 +61,7 @@
 #include "rofl/common/openflow/messages/cofmsg_barrier.h"
 #include "rofl/common/openflow/messages/cofmsg_config.h"
 #include "rofl/common/openflow/messages/cofmsg_desc_stats.h"
+#include "rofl/common/openflow/messages/cofmsg_dispatch.h"
 #include "rofl/common/openflow/messages/cofmsg_echo.h"
 #include "rofl/common/openflow/messages/cofmsg_error.h"
 #include "rofl/common/openflow/messages/cofmsg_experimenter.h"
@@ -85,6 +93,7 @@
 #include "rofl/common/openflow/messages/cofmsg_table_features_stats.h"
 #include "rofl/common/openflow/messages/cofmsg_table_mod.h"
 #include "rofl/common/openflow/messages/cofmsg_table_stats.h"
+#include "rofl/common/openflow/messages/cofmsg_view.h"
 
 namespace rofl {
 
@@ -205,10 +214,32 @@ protected:
 
   virtual void handle_recv(crofsock &socket, rofl::openflow::cofmsg *msg) = 0;
 
+  /**
+   * @brief	Called for message types enabled by crofsock::set_rx_view()
+   *
+   * The view refers to the socket's receive buffer and may be copied for
+   * later use. Return false for receiving the message as parsed cofmsg via
+   * handle_recv() instead.
+   */
+  virtual bool handle_recv_view(crofsock &socket,
+                                const rofl::openflow::cofmsg_view &view) {
+    return false;
+  };
+
   virtual void congestion_occurred_indication(crofsock &socket) = 0;
 
   virtual void congestion_solved_indication(crofsock &socket) = 0;
 
+  /**
+   * @brief	Called after queued messages exceeded their time-to-live
+   *
+   * Expired messages are dropped without being sent. Called from the
+   * socket's txthread with the number of messages of traffic class txclass
+   * dropped in the last scheduling round.
+   */
+  virtual void handle_expired(crofsock &socket, unsigned int txclass,
+                              unsigned int count){};
+
 private:
   static std::set<crofsock_env *> socket_envs;
   static crwlock socket_envs_lock;
@@ -219,6 +250,9 @@ private:
  * @brief	A socket capable of talking OpenFlow via TCP and vice versa
  */
 class crofsock : public cthread_env {
+public:
+  /* traffic classes for transmission, classes from QUEUE_MAX up to
+   * TXCLASS_MAX are defined by the application */
   enum outqueue_type_t {
     QUEUE_OAM = 0,  // Echo.request/Echo.reply
     QUEUE_MGMT = 1, // all remaining packets, except ...
@@ -227,11 +261,41 @@ class crofsock : public cthread_env {
     QUEUE_MAX,      // do not use
   };
 
+  static unsigned int const TXCLASS_MAX = 8;
+
+  /**
+   * @brief	Selects the traffic class for messages sent by this thread
+   *
+   * While an instance exists, messages sent by the constructing thread via
+   * any crofsock are queued in traffic class txclass instead of the class
+   * derived from their type. Echo messages always use QUEUE_OAM.
+   */
+  class txclass_scope {
+  public:
+    txclass_scope(unsigned int txclass) : prev(current) { current = txclass; };
+    ~txclass_scope() { current = prev; };
+
+    /**
+     * @brief	Returns traffic class selected by this thread, -1: none
+     */
+    static int get_txclass() { return current; };
+
+  private:
+    txclass_scope(const txclass_scope &scope);
+    txclass_scope &operator=(const txclass_scope &scope);
+
+    int prev;
+    static thread_local int current;
+  };
+
+private:
   enum crofsock_flag_t {
     FLAG_CONGESTED = 1,
     FLAG_TX_BLOCK_QUEUEING = 2,
     FLAG_RECONNECT_ON_FAILURE = 3,
     FLAG_TLS_IN_USE = 4,
+    FLAG_SHM_IN_USE = 5,
+    FLAG_URING_IN_USE = 6,
   };
 
   enum socket_mode_t {
@@ -276,9 +340,15 @@ public:
   virtual ~crofsock();
 
   /**
+   * @brief	crofsock constructor
    *
+   * @param env crofsock environment
+   * @param pool when set, run rx and tx threads on a reactor thread of
+   * this pool
+   * @param reactor index of reactor thread within pool, -1: select least
+   * loaded reactor thread
    */
-  crofsock(crofsock_env *env);
+  crofsock(crofsock_env *env, cthread_pool *pool = nullptr, int reactor = -1);
 
 public:
   /**
@@ -308,17 +378,56 @@ public:
    */
   virtual void tls_accept(int sd);
 
+  /**
+   * @brief	Applies SO_BUSY_POLL option on socket sd, if enabled
+   */
+  void set_sockopt_busy_poll(int sd);
+
   /**
    *
    */
   virtual void tls_connect(bool reconnect = true);
 
+  /**
+   * @brief	Accepts a shared memory connection on unix domain socket sd
+   *
+   * Listen on an AF_UNIX baddr for shared memory connections. The socket
+   * stays in accepting state until the peer handed over its rings,
+   * followed by crofsock_env::handle_tcp_accepted().
+   */
+  virtual void shm_accept(int sd);
+
+  /**
+   * @brief	Connects via shared memory to the AF_UNIX raddr
+   *
+   * For co-located peers: the OpenFlow byte stream is carried by a pair of
+   * cshmring byte rings handed over via the unix domain socket, which
+   * remains open for detecting the peer's shutdown. Messages take the same
+   * txqueues, scheduler and congestion handling as on TCP, the environment
+   * is notified via crofsock_env::handle_tcp_connected().
+   */
+  virtual void shm_connect(bool reconnect = true);
+
 public:
   /**
+   * @brief	Queues a message for transmission
    *
+   * @param ttl time-to-live in usecs, a message still queued afterwards is
+   * dropped, 0: use time-to-live of the message's traffic class
    */
   rofl::crofsock::msg_result_t send_message(rofl::openflow::cofmsg *msg,
-                                            bool enforce_queueing = false);
+                                            bool enforce_queueing = false,
+                                            unsigned int ttl = 0);
+
+  /**
+   * @brief	Queues a message in wire format, see crofbuilder
+   *
+   * Frames share the txqueues with cofmsg instances, ownership of frame is
+   * transferred to this crofsock instance in any case.
+   */
+  rofl::crofsock::msg_result_t send_frame(rofl::crofframe *frame,
+                                          bool enforce_queueing = false,
+                                          unsigned int ttl = 0);
 
   /**
    *
@@ -330,6 +439,31 @@ public:
    */
   bool is_tls_encrypted() const;
 
+  /**
+   * @brief	Returns true, when messages are carried by shared memory
+   */
+  bool is_shm() const { return flag_test(FLAG_SHM_IN_USE); };
+
+  /**
+   * @brief	Returns true, when messages are received and sent via io_uring
+   */
+  bool is_uring() const { return flag_test(FLAG_URING_IN_USE); };
+
+  /**
+   * @brief	Returns size of each shared memory ring in bytes
+   */
+  size_t get_shm_ring_size() const { return shm_ring_size; };
+
+  /**
+   * @brief	Sets size of each shared memory ring created by shm_connect()
+   *
+   * @param ring_size power of two, at least one page
+   */
+  crofsock &set_shm_ring_size(size_t ring_size) {
+    shm_ring_size = ring_size;
+    return *this;
+  };
+
   /**
    *
    */
@@ -378,6 +512,22 @@ public:
     return *this;
   };
 
+  /**
+   * @brief	Return SO_BUSY_POLL budget in microseconds, 0: disabled
+   */
+  unsigned int get_busy_poll() const { return busy_poll; };
+
+  /**
+   * @brief	Set SO_BUSY_POLL budget in microseconds for new connections
+   *
+   * Lets the kernel poll the device queue on blocking receive calls and
+   * from the reactor's busy poll loop, see cthread::set_busy_poll().
+   */
+  crofsock &set_busy_poll(unsigned int usecs) {
+    this->busy_poll = usecs;
+    return *this;
+  };
+
 public:
   /**
    * @brief	Returns capacity of transmission queues in messages
@@ -391,12 +541,173 @@ public:
    */
   crofsock &set_txqueue_max_size(size_t txqueue_max_size) {
     this->txqueue_size_congestion_occurred = txqueue_max_size;
-    for (unsigned int queue_id = 0; queue_id < QUEUE_MAX; queue_id++) {
-      txqueues[queue_id].set_queue_max_size(txqueue_max_size);
+    for (auto &txqueue : txqueues) {
+      txqueue.set_queue_max_size(txqueue_max_size);
     }
     return *this;
   };
 
+  /**
+   * @brief	Sets byte budget of a transmission queue, 0: unlimited
+   */
+  crofsock &set_txqueue_max_bytes(unsigned int queue_id, size_t max_bytes) {
+    if (queue_id < TXCLASS_MAX) {
+      txqueues[queue_id].set_queue_max_bytes(max_bytes);
+    }
+    return *this;
+  };
+
+  /**
+   * @brief	Sets watermarks of a transmission queue in bytes
+   *
+   * Reaching the high watermark indicates congestion even though the
+   * socket still accepts data. Congestion is solved after all queues fell
+   * to their low watermark. A high watermark of 0 disables both.
+   */
+  crofsock &set_txqueue_watermarks(unsigned int queue_id,
+                                   size_t high_watermark,
+                                   size_t low_watermark) {
+    if (queue_id < TXCLASS_MAX) {
+      txqueues[queue_id].set_watermarks(high_watermark, low_watermark);
+    }
+    return *this;
+  };
+
+  /**
+   * @brief	Returns number of bytes waiting in all transmission queues
+   */
+  size_t get_txqueue_bytes() const {
+    size_t bytes = 0;
+    for (auto &txqueue : txqueues) {
+      bytes += txqueue.bytes();
+    }
+    return bytes;
+  };
+
+  /**
+   * @brief	Returns drain target in milliseconds
+   */
+  unsigned int get_tx_drain_target() const { return tx_drain_target; };
+
+  /**
+   * @brief	Sets drain target in milliseconds, 0: disabled
+   *
+   * Congestion is solved once the transmission queues have drained to half
+   * of their size when congestion occurred, or as soon as the remaining
+   * bytes can be sent within the drain target at the measured drain rate.
+   */
+  crofsock &set_tx_drain_target(unsigned int msecs) {
+    this->tx_drain_target = msecs;
+    return *this;
+  };
+
+  /**
+   * @brief	Returns measured transmission rate in bytes per second
+   */
+  uint64_t get_tx_drain_rate() const { return tx_drain_rate; };
+
+  /**
+   * @brief	Returns number of congestion indications
+   */
+  uint64_t get_tx_congestion_episodes() const {
+    return tx_congestion_episodes;
+  };
+
+public:
+  /**
+   * @brief	Configures a traffic class of the transmission scheduler
+   *
+   * By default QUEUE_OAM is a strict priority class and all other classes
+   * share the bandwidth in proportion to their quantum, see ctxsched_drr.
+   * Applies to the current and all subsequent connections.
+   *
+   * @param quantum bytes credited per scheduling round
+   * @param strict served before all non-strict classes
+   */
+  crofsock &set_txclass(unsigned int txclass, size_t quantum,
+                        bool strict = false);
+
+  /**
+   * @brief	Replaces the transmission scheduler, takes ownership of sched
+   */
+  crofsock &set_txsched(ctxsched *sched);
+
+  /**
+   * @brief	Enables or disables per class transmission statistics
+   */
+  crofsock &set_txclass_stats(bool enable);
+
+  /**
+   * @brief	Returns transmission statistics of txclass
+   */
+  ctxclass_stats get_txclass_stats(unsigned int txclass) const;
+
+  /**
+   * @brief	Resets transmission statistics of all classes
+   */
+  void clear_txclass_stats();
+
+  /**
+   * @brief	Returns time-to-live of messages in txclass in usecs, 0: none
+   */
+  unsigned int get_txclass_ttl(unsigned int txclass) const {
+    return (txclass < TXCLASS_MAX) ? tx_ttl[txclass].load() : 0;
+  };
+
+  /**
+   * @brief	Sets time-to-live of messages in txclass in usecs, 0: none
+   *
+   * Applies to messages queued afterwards without a time-to-live of their
+   * own. Expired messages are dropped when they reach the head of their
+   * txqueue, see crofsock_env::handle_expired().
+   */
+  crofsock &set_txclass_ttl(unsigned int txclass, unsigned int ttl) {
+    if (txclass < TXCLASS_MAX) {
+      tx_ttl[txclass] = ttl;
+    }
+    return *this;
+  };
+
+  /**
+   * @brief	Returns number of expired messages dropped from txclass
+   */
+  uint64_t get_txclass_expired(unsigned int txclass) const {
+    return (txclass < TXCLASS_MAX) ? tx_expired[txclass].load() : 0;
+  };
+
+public:
+  /**
+   * @brief	Returns true, when messages of type are received as views
+   */
+  bool get_rx_view(uint8_t type) const {
+    return (type < 64) && (rx_views & ((uint64_t)1 << type));
+  };
+
+  /**
+   * @brief	Hands over messages of type as cofmsg_view without parsing
+   *
+   * Views are delivered via crofsock_env::handle_recv_view(). Supported
+   * for all message types below 64.
+   */
+  crofsock &set_rx_view(uint8_t type, bool enable = true) {
+    if (type >= 64)
+      return *this;
+    if (enable)
+      rx_views |= ((uint64_t)1 << type);
+    else
+      rx_views &= ~((uint64_t)1 << type);
+    return *this;
+  };
+
+  /**
+   * @brief	Parses a view declined by the environment
+   *
+   * Malformed messages are rejected towards the peer like on reception.
+   *
+   * @return parsed message owned by caller or nullptr
+   */
+  rofl::openflow::cofmsg *parse_view(const rofl::openflow::cofmsg_view &view);
+
 public:
   /**
    *
@@ -612,6 +923,17 @@ private:
     return flags.test(__flag);
   };
 
+  /**
+   * @brief	Sets __flag, returns false if it was set already
+   */
+  bool flag_test_and_set(crofsock_flag_t __flag) {
+    AcquireReadWriteLock lock(flags_lock);
+    if (flags.test(__flag))
+      return false;
+    flags.set(__flag, true);
+    return true;
+  };
+
 private:
   virtual void handle_wakeup(cthread &thread);
 
@@ -621,6 +943,11 @@ private:
 
   virtual void handle_write_event(cthread &thread, int fd);
 
+  virtual void handle_recv(cthread &thread, int fd, const uint8_t *buf,
+                           ssize_t len);
+
+  virtual void handle_send(cthread &thread, int fd, ssize_t res);
+
 private:
   void tls_init();
 
@@ -636,19 +963,145 @@ private:
 
   void tls_log_errors();
 
+  /**
+   * @brief	Attaches the rings handed over by a shared memory client
+   */
+  void shm_accepting();
+
+  /**
+   * @brief	Registers doorbells of shmring, hands rings over in client mode
+   */
+  void shm_established();
+
+  /**
+   * @brief	Deregisters doorbells and unmaps shmring
+   */
+  void shm_release();
+
+  /**
+   * @brief	Reads from shmring into rxbuffer, returns like ::recv()
+   */
+  int shm_recv();
+
+  /**
+   * @brief	Registers established socket for reception on rxthread
+   *
+   * Plain TCP sockets on an io_uring event loop receive via multishot
+   * receive requests, all others via read events.
+   */
+  void rx_start();
+
+  /**
+   * @brief	Moves data received via io_uring into rxbuffer, returns like
+   * ::recv()
+   */
+  int uring_recv();
+
+  /**
+   * @brief	Queues pending bytes from txbuffer as linked io_uring sends
+   *
+   * Returns false, handle_send() continues once all segments completed.
+   */
+  bool uring_send();
+
 private:
+  /**
+   * @brief	Reads chunks from the socket into rxbuffer and parses all
+   * complete messages, at most max_pkts_rcvd_per_round per call
+   */
   void recv_message();
 
-  void parse_message();
+  /**
+   * @brief	Hands over message to environment as view, false: not consumed
+   */
+  bool recv_view(size_t offset, size_t buflen);
 
-  void parse_of10_message(rofl::openflow::cofmsg **pmsg);
+  /**
+   * @brief	Parses message and hands it over to environment
+   */
+  void recv_parsed(uint8_t *buf, size_t buflen);
 
-  void parse_of12_message(rofl::openflow::cofmsg **pmsg);
+  /**
+   * @brief	Parses message, malformed messages are rejected towards peer
+   *
+   * @return parsed message owned by caller or nullptr
+   */
+  rofl::openflow::cofmsg *parse_message(uint8_t *buf, size_t buflen);
 
-  void parse_of13_message(rofl::openflow::cofmsg **pmsg);
+  /**
+   * @brief	Drops unparsed bytes from rxbuffer, e.g., on a new connection
+   */
+  void reset_rxbuffer();
+
+  /**
+   * @brief	Moves message fragment to start of rxbuffer
+   */
+  void compact_rxbuffer();
 
   void send_from_queue();
 
+  /**
+   * @brief	Returns txqueue for messages of given version and type
+   */
+  static unsigned int txqueue_id(uint8_t version, uint8_t type);
+
+  /**
+   * @brief	Stores either msg or frame in its txqueue
+   */
+  rofl::crofsock::msg_result_t enqueue(rofl::openflow::cofmsg *msg,
+                                       rofl::crofframe *frame, uint8_t version,
+                                       uint8_t type, bool enforce_queueing,
+                                       unsigned int ttl);
+
+  /**
+   * @brief	Sends pending bytes from txbuffer, returns true when drained
+   *
+   * @param more true: more data follows immediately (MSG_MORE)
+   */
+  bool flush_txbuffer(bool more);
+
+  /**
+   * @brief	Blocks queueing and indicates congestion, if not blocked yet
+   *
+   * @param half_rule reallow transmissions at half the bytes queued now
+   */
+  void tx_congestion_occurred(bool half_rule);
+
+  /**
+   * @brief	Returns true, if congestion is solved
+   */
+  bool tx_congestion_solved() const;
+
+  /**
+   * @brief	Reallows queueing and indicates it, once congestion is solved
+   */
+  void tx_congestion_check();
+
+  /**
+   * @brief	Returns CLOCK_MONOTONIC in nsecs
+   */
+  static uint64_t now_nsecs();
+
+  /**
+   * @brief	Records a message of len bytes stored at stamp (nsecs)
+   */
+  void record_txclass_stats(unsigned int txclass, size_t len, uint64_t stamp);
+
+  /**
+   * @brief	Updates tx_drain_rate with nbytes just sent
+   */
+  void update_tx_drain_rate(size_t nbytes);
+
+  /**
+   * @brief	Pushes out data held back by a preceding MSG_MORE send
+   */
+  void uncork();
+
+  /**
+   * @brief	Drops unsent bytes from txbuffer, e.g., on a new connection
+   */
+  void reset_txbuffer();
+
 private:
   void backoff_reconnect(bool reset_timeout = false);
 
@@ -703,6 +1156,9 @@ private:
   // socket backlog
   int backlog;
 
+  // SO_BUSY_POLL budget in microseconds, 0: disabled
+  unsigned int busy_poll;
+
   /* binding addrees */
   csockaddr baddr;
 
@@ -740,18 +1196,44 @@ private:
   std::string verify_depth;
   std::string ciphers;
 
+  /*
+   * shared memory transport
+   */
+
+  // rings of a shared memory connection
+  std::unique_ptr<cshmring> shmring;
+
+  // size of rings created by shm_connect()
+  size_t shm_ring_size;
+
   /*
    * receiving messages
    */
 
-  // fragment pending
-  bool rx_fragment_pending;
+  // size of rxbuffer, a maximum sized message carried over still leaves
+  // room for reading 64 KiB at once
+  static size_t const RXBUFFER_SIZE = 131072;
+
+  // bytes received from socket, messages are parsed in place, shared with
+  // views handed over to the environment
+  std::shared_ptr<cmemory> rxbuffer;
+
+  // number of bytes stored in rxbuffer
+  size_t rxlen;
 
-  // incomplete fragment message fragment received in last round
-  cmemory rxbuffer;
+  // offset of first unparsed message in rxbuffer
+  size_t rx_offset;
 
-  // number of bytes already received for current message fragment
-  unsigned int msg_bytes_read;
+  // data received via io_uring not fitting into rxbuffer, reception is
+  // paused until it is drained
+  std::vector<uint8_t> rx_backlog;
+
+  // io_uring reception ended, rx_uring_errno: 0 end of stream or error
+  bool rx_uring_closed;
+  int rx_uring_errno;
+
+  // message types received as views (bit per type)
+  std::atomic<uint64_t> rx_views;
 
   // read not more than this number of packets per round before rescheduling
   unsigned int max_pkts_rcvd_per_round;
@@ -772,17 +1254,61 @@ private:
   // number of packets waiting for transmission
   std::atomic_uint txqueue_pending_pkts;
 
-  // size of tx queue when congestion occurred
+  // max size of tx queues in messages
   unsigned int txqueue_size_congestion_occurred;
 
-  // size of tx queue for reallowing transmissions
-  unsigned int txqueue_size_tx_threshold;
+  // bytes in tx queues when congestion occurred
+  std::atomic<size_t> txqueue_bytes_congestion_occurred;
+
+  // bytes in tx queues for reallowing transmissions
+  std::atomic<size_t> txqueue_bytes_tx_threshold;
+
+  // time in milliseconds for draining tx queues before reallowing
+  // transmissions
+  unsigned int tx_drain_target;
+  static unsigned int const DEFAULT_TX_DRAIN_TARGET = 10;
+
+  // measured transmission rate in bytes per second
+  std::atomic<uint64_t> tx_drain_rate;
+
+  // start of current drain rate sample and bytes sent since
+  ctimespec tx_drain_stamp;
+  size_t tx_drain_bytes;
+
+  // minimum duration of a drain rate sample: 100ms
+  static uint64_t const TX_DRAIN_SAMPLE_NSECS = 100000000;
+
+  // number of congestion indications
+  std::atomic<uint64_t> tx_congestion_episodes;
 
-  // QUEUE_MAX txqueues
-  std::vector<crofqueue> txqueues;
+  // TXCLASS_MAX txqueues, one per traffic class
+  std::deque<crofqueue> txqueues;
 
-  // relative scheduling weights for txqueues
-  std::vector<unsigned int> txweights;
+  // ring size of txqueues for application-defined traffic classes
+  static size_t const TXCLASS_RING_SIZE = 64;
+
+  // scheduler selecting the txqueue to send from, used by txthread only
+  std::unique_ptr<ctxsched> txsched;
+
+  // traffic class of tx_msg/tx_frame
+  unsigned int tx_class;
+
+  // time tx_msg/tx_frame was stored in its txqueue, 0: unknown
+  uint64_t tx_stamp;
+
+  // time-to-live of messages per traffic class in usecs, 0: none
+  std::atomic<unsigned int> tx_ttl[TXCLASS_MAX];
+
+  // number of expired messages dropped per traffic class
+  std::atomic<uint64_t> tx_expired[TXCLASS_MAX];
+
+  // expired messages dropped per traffic class in the current round
+  std::vector<unsigned int> tx_expired_round;
+
+  // per class transmission statistics, when enabled
+  std::atomic_bool txstats_enabled;
+  std::vector<ctxclass_stats> txstats;
+  mutable std::mutex txstats_mutex;
 
   /*
    * sending messages
@@ -791,17 +1317,42 @@ private:
   // txthread is actively sending messages
   std::atomic_bool tx_is_running;
 
+  // task for sending messages is posted to txthread
+  std::atomic_bool tx_post_pending;
+
   // fragment pending
   bool tx_fragment_pending;
 
-  // transmission buffer for packing cofmsg instances
+  // transmission buffer, cofmsg instances are packed back-to-back
   cmemory txbuffer;
 
-  // number of bytes already sent for current message fragment
+  // number of bytes of txbuffer already sent
   unsigned int msg_bytes_sent;
 
-  // message length of current tx-fragment
+  // number of bytes packed into txbuffer
   size_t txlen;
+
+  // message retrieved from txqueues not fitting into txbuffer
+  rofl::openflow::cofmsg *tx_msg;
+
+  // frame retrieved from txqueues not fitting into txbuffer
+  rofl::crofframe *tx_frame;
+
+  // end offsets of messages packed into txbuffer
+  std::vector<size_t> tx_msg_ends;
+
+  // number of messages in txbuffer sent completely
+  size_t tx_msgs_sent;
+
+  // true: last send() used MSG_MORE
+  bool tx_corked;
+
+  // maximum length of a segment sent via io_uring, segments end on message
+  // boundaries unless a single message is longer
+  static size_t const TX_SEGMENT_SIZE = 16384;
+
+  // number of segments of txbuffer in flight via io_uring
+  unsigned int tx_uring_pending;
 };
 
 } /* namespace rofl */
@@ -0,0 +1,236 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/*
+ * croftemplate.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "rofl/common/croftemplate.hpp"
+
+#include <stddef.h>
+
+#include "rofl/common/openflow/messages/cofmsg_flow_mod.h"
+#include "rofl/common/openflow/messages/cofmsg_packet_out.h"
+
+using namespace rofl;
+
+static void check_version(uint8_t version, const char *func) {
+  switch (version) {
+  case rofl::openflow12::OFP_VERSION:
+  case rofl::openflow13::OFP_VERSION:
+    return;
+  default: {
+    throw eBadVersion(std::string(func) + "() unsupported version", __FILE__,
+                      __FUNCTION__, __LINE__);
+  };
+  }
+}
+
+croftemplate::croftemplate(uint8_t version,
+                           const rofl::openflow::cofflowmod &flowmod)
+    : version(version), type(rofl::openflow13::OFPT_FLOW_MOD), mem(0) {
+  check_version(version, "croftemplate");
+  rofl::openflow::cofmsg_flow_mod msg(version, 0, flowmod);
+  mem.resize(msg.length());
+  msg.pack(mem.somem(), mem.length());
+}
+
+croftemplate::croftemplate(uint8_t version, uint32_t buffer_id,
+                           uint32_t in_port,
+                           const rofl::openflow::cofactions &actions)
+    : version(version), type(rofl::openflow13::OFPT_PACKET_OUT), mem(0) {
+  check_version(version, "croftemplate");
+  rofl::openflow::cofmsg_packet_out msg(version, 0, buffer_id, in_port,
+                                        actions);
+  mem.resize(msg.length());
+  msg.pack(mem.somem(), mem.length());
+}
+
+void croftemplate::check_type(uint8_t type, const char *func) const {
+  if (this->type != type) {
+    throw eRofTemplateNotFound(std::string("croftemplate::") + func +
+                                   "() field not available for message type",
+                               __FILE__, __FUNCTION__, __LINE__);
+  }
+}
+
+croftemplate::field croftemplate::header_field(uint8_t type, size_t offset,
+                                               size_t width,
+                                               const char *func) const {
+  check_type(type, func);
+  field f;
+  f.offset = offset;
+  f.width = width;
+  return f;
+}
+
+croftemplate::field croftemplate::field_cookie() const {
+  return header_field(rofl::openflow13::OFPT_FLOW_MOD,
+                      offsetof(struct rofl::openflow13::ofp_flow_mod, cookie),
+                      sizeof(uint64_t), __FUNCTION__);
+}
+
+croftemplate::field croftemplate::field_priority() const {
+  return header_field(rofl::openflow13::OFPT_FLOW_MOD,
+                      offsetof(struct rofl::openflow13::ofp_flow_mod, priority),
+                      sizeof(uint16_t), __FUNCTION__);
+}
+
+croftemplate::field croftemplate::field_idle_timeout() const {
+  return header_field(
+      rofl::openflow13::OFPT_FLOW_MOD,
+      offsetof(struct rofl::openflow13::ofp_flow_mod, idle_timeout),
+      sizeof(uint16_t), __FUNCTION__);
+}
+
+croftemplate::field croftemplate::field_hard_timeout() const {
+  return header_field(
+      rofl::openflow13::OFPT_FLOW_MOD,
+      offsetof(struct rofl::openflow13::ofp_flow_mod, hard_timeout),
+      sizeof(uint16_t), __FUNCTION__);
+}
+
+croftemplate::field croftemplate::field_buffer_id() const {
+  if (type == rofl::openflow13::OFPT_PACKET_OUT) {
+    return header_field(
+        type, offsetof(struct rofl::openflow13::ofp_packet_out, buffer_id),
+        sizeof(uint32_t), __FUNCTION__);
+  }
+  return header_field(
+      rofl::openflow13::OFPT_FLOW_MOD,
+      offsetof(struct rofl::openflow13::ofp_flow_mod, buffer_id),
+      sizeof(uint32_t), __FUNCTION__);
+}
+
+croftemplate::field croftemplate::field_in_port() const {
+  return header_field(
+      rofl::openflow13::OFPT_PACKET_OUT,
+      offsetof(struct rofl::openflow13::ofp_packet_out, in_port),
+      sizeof(uint32_t), __FUNCTION__);
+}
+
+croftemplate::field croftemplate::field_oxm(uint32_t oxm_id) const {
+  const size_t match_offset = sizeof(struct rofl::openflow13::ofp_flow_mod) -
+                              sizeof(struct rofl::openflow13::ofp_match);
+  check_type(rofl::openflow13::OFPT_FLOW_MOD, __FUNCTION__);
+
+  const uint8_t *buf = mem.somem();
+  size_t end = match_offset + be16toh(*(uint16_t *)(buf + match_offset +
+                                                    sizeof(uint16_t)));
+  size_t offset = match_offset + 2 * sizeof(uint16_t);
+
+  while (offset + sizeof(uint32_t) <= end) {
+    uint32_t oxm_hdr = be32toh(*(uint32_t *)(buf + offset));
+    size_t oxm_len = oxm_hdr & 0xff;
+    // class and field, hasmask and length are ignored
+    if ((oxm_hdr >> 9) == (oxm_id >> 9)) {
+      field f;
+      f.offset = offset + sizeof(uint32_t);
+      f.width = (oxm_hdr & 0x100) ? oxm_len / 2 : oxm_len;
+      return f;
+    }
+    offset += sizeof(uint32_t) + oxm_len;
+  }
+
+  throw eRofTemplateNotFound("croftemplate::field_oxm() OXM not found",
+                             __FILE__, __FUNCTION__, __LINE__);
+}
+
+croftemplate::field croftemplate::field_output_port(unsigned int index) const {
+  field port;
+  const uint8_t *buf = mem.somem();
+
+  switch (type) {
+  case rofl::openflow13::OFPT_PACKET_OUT: {
+    struct rofl::openflow13::ofp_packet_out *hdr =
+        (struct rofl::openflow13::ofp_packet_out *)buf;
+    size_t begin = sizeof(struct rofl::openflow13::ofp_packet_out);
+    size_t end = begin + be16toh(hdr->actions_len);
+    if (find_output(begin, end, index, port))
+      return port;
+  } break;
+  case rofl::openflow13::OFPT_FLOW_MOD: {
+    const size_t match_offset = sizeof(struct rofl::openflow13::ofp_flow_mod) -
+                                sizeof(struct rofl::openflow13::ofp_match);
+    size_t matchlen =
+        be16toh(*(uint16_t *)(buf + match_offset + sizeof(uint16_t)));
+    size_t offset = match_offset + ((matchlen + 7) / 8) * 8;
+
+    while (offset + sizeof(struct rofl::openflow13::ofp_instruction) <=
+           mem.length()) {
+      struct rofl::openflow13::ofp_instruction *inst =
+          (struct rofl::openflow13::ofp_instruction *)(buf + offset);
+      size_t instlen = be16toh(inst->len);
+      if (instlen < sizeof(struct rofl::openflow13::ofp_instruction))
+        break;
+      switch (be16toh(inst->type)) {
+      case rofl::openflow13::OFPIT_APPLY_ACTIONS:
+      case rofl::openflow13::OFPIT_WRITE_ACTIONS: {
+        size_t begin =
+            offset + sizeof(struct rofl::openflow13::ofp_instruction_actions);
+        if (find_output(begin, offset + instlen, index, port))
+          return port;
+      } break;
+      default: {};
+      }
+      offset += instlen;
+    }
+  } break;
+  default: {};
+  }
+
+  throw eRofTemplateNotFound(
+      "croftemplate::field_output_port() action not found", __FILE__,
+      __FUNCTION__, __LINE__);
+}
+
+bool croftemplate::find_output(size_t begin, size_t end, unsigned int &index,
+                               field &port) const {
+  const uint8_t *buf = mem.somem();
+  size_t offset = begin;
+
+  while (offset + sizeof(struct rofl::openflow13::ofp_action_header) <= end) {
+    struct rofl::openflow13::ofp_action_header *action =
+        (struct rofl::openflow13::ofp_action_header *)(buf + offset);
+    size_t actionlen = be16toh(action->len);
+    if (actionlen < sizeof(struct rofl::openflow13::ofp_action_header))
+      return false;
+    if (be16toh(action->type) == rofl::openflow13::OFPAT_OUTPUT) {
+      if (0 == index) {
+        port.offset =
+            offset + offsetof(struct rofl::openflow13::ofp_action_output, port);
+        port.width = sizeof(uint32_t);
+        return true;
+      }
+      index--;
+    }
+    offset += actionlen;
+  }
+  return false;
+}
+
+crofbuilder_template::crofbuilder_template(rofl::crofchan *chan,
+                                           const rofl::cauxid &auxid,
+                                           uint8_t version, uint32_t xid,
+                                           const croftemplate &tmpl)
+    : crofbuilder(chan, auxid, xid, tmpl.get_mem().somem(),
+                  tmpl.get_mem().length()),
+      type(tmpl.get_type()) {
+  if (tmpl.get_version() != version) {
+    throw eBadVersion("crofbuilder_template() template version mismatch",
+                      __FILE__, __FUNCTION__, __LINE__);
+  }
+}
+
+crofbuilder_template &crofbuilder_template::data(const uint8_t *data,
+                                                 size_t datalen) {
+  if (type != rofl::openflow13::OFPT_PACKET_OUT) {
+    throw eRofBuilderInvalid("crofbuilder_template::data() no Packet-Out",
+                             __FILE__, __FUNCTION__, __LINE__);
+  }
+  get_frame().append(data, datalen);
+  return *this;
+}
@@ -0,0 +1,226 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/*
+ * croftemplate.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef SRC_ROFL_COMMON_CROFTEMPLATE_HPP_
+#define SRC_ROFL_COMMON_CROFTEMPLATE_HPP_
+
+#include <inttypes.h>
+
+#include "rofl/common/caddress.h"
+#include "rofl/common/cmemory.h"
+#include "rofl/common/crofbuilder.hpp"
+#include "rofl/common/openflow/cofactions.h"
+#include "rofl/common/openflow/cofflowmod.h"
+
+namespace rofl {
+
+class eRofTemplateNotFound : public eRofBuilderBase {
+public:
+  eRofTemplateNotFound(const std::string &__arg,
+                       const std::string &__file = std::string(""),
+                       const std::string &__func = std::string(""),
+                       int __line = 0)
+      : eRofBuilderBase(__arg, __file, __func, __line){};
+};
+
+/**
+ * @brief	Pre-packed OpenFlow message with patchable fields
+ *
+ * A template is packed once from a cofflowmod or a Packet-Out action
+ * list. The field_*() methods return the location of a variable field
+ * within the packed message, crofbuilder_template copies the message and
+ * patches these fields for each instance. Packet data is not part of a
+ * Packet-Out template, it is appended per instance.
+ */
+class croftemplate {
+public:
+  /**
+   * @brief	Location of a patchable field in network byte order
+   */
+  struct field {
+    uint16_t offset;
+    uint16_t width;
+  };
+
+public:
+  /**
+   *
+   */
+  ~croftemplate(){};
+
+  /**
+   * @brief	Flow-Mod template
+   *
+   * @throws eBadVersion OFP 1.0 is not supported
+   */
+  croftemplate(uint8_t version, const rofl::openflow::cofflowmod &flowmod);
+
+  /**
+   * @brief	Packet-Out template
+   *
+   * @throws eBadVersion OFP 1.0 is not supported
+   */
+  croftemplate(uint8_t version, uint32_t buffer_id, uint32_t in_port,
+               const rofl::openflow::cofactions &actions);
+
+public:
+  /**
+   *
+   */
+  uint8_t get_version() const { return version; };
+
+  /**
+   *
+   */
+  uint8_t get_type() const { return type; };
+
+  /**
+   *
+   */
+  const rofl::cmemory &get_mem() const { return mem; };
+
+public:
+  /**
+   *
+   */
+  field field_cookie() const;
+
+  /**
+   *
+   */
+  field field_priority() const;
+
+  /**
+   *
+   */
+  field field_idle_timeout() const;
+
+  /**
+   *
+   */
+  field field_hard_timeout() const;
+
+  /**
+   * @brief	Buffer id of a Flow-Mod or Packet-Out
+   */
+  field field_buffer_id() const;
+
+  /**
+   * @brief	In-port of a Packet-Out
+   */
+  field field_in_port() const;
+
+  /**
+   * @brief	Value of an OXM in the Flow-Mod match, excluding its mask
+   *
+   * The OXM is identified by class and field, the template must contain
+   * it already.
+   *
+   * @throws eRofTemplateNotFound OXM not found in match
+   */
+  field field_oxm(uint32_t oxm_id) const;
+
+  /**
+   * @brief	Port of the index-th Output action
+   *
+   * Flow-Mod actions are counted across all Apply-Actions and
+   * Write-Actions instructions in the order they were packed.
+   *
+   * @throws eRofTemplateNotFound no such Output action
+   */
+  field field_output_port(unsigned int index = 0) const;
+
+private:
+  void check_type(uint8_t type, const char *func) const;
+
+  field header_field(uint8_t type, size_t offset, size_t width,
+                     const char *func) const;
+
+  bool find_output(size_t begin, size_t end, unsigned int &index,
+                   field &port) const;
+
+private:
+  uint8_t version;
+  uint8_t type;
+  rofl::cmemory mem;
+};
+
+/**
+ * @brief	Sends a copy of a croftemplate with patched fields
+ *
+ * Obtained from crofdpt::build_from_template(). The transaction id is
+ * assigned on construction, all other fields keep their template value
+ * unless set().
+ */
+class crofbuilder_template : public crofbuilder {
+public:
+  /**
+   * @throws eBadVersion template version differs from channel version
+   */
+  crofbuilder_template(rofl::crofchan *chan, const rofl::cauxid &auxid,
+                       uint8_t version, uint32_t xid,
+                       const croftemplate &tmpl);
+
+public:
+  /**
+   * @brief	Patches an integer field of width 1, 2, 4, 6 or 8 bytes
+   */
+  crofbuilder_template &set(const croftemplate::field &field, uint64_t value) {
+    uint8_t *ptr = get<uint8_t>(field.offset);
+    switch (field.width) {
+    case sizeof(uint8_t): {
+      *ptr = value;
+    } break;
+    case sizeof(uint16_t): {
+      *(uint16_t *)ptr = htobe16(value);
+    } break;
+    case sizeof(uint32_t): {
+      *(uint32_t *)ptr = htobe32(value);
+    } break;
+    case sizeof(uint64_t): {
+      *(uint64_t *)ptr = htobe64(value);
+    } break;
+    case 6: {
+      uint64_t nbo = htobe64(value << 16);
+      memcpy(ptr, &nbo, 6);
+    } break;
+    default: {
+      throw eRofBuilderInvalid("crofbuilder_template::set() invalid width",
+                               __FILE__, __FUNCTION__, __LINE__);
+    };
+    }
+    return *this;
+  };
+
+  /**
+   * @brief	Patches a hardware address field
+   */
+  crofbuilder_template &set(const croftemplate::field &field,
+                            const rofl::caddress_ll &addr) {
+    if (field.width != addr.length()) {
+      throw eRofBuilderInvalid("crofbuilder_template::set() invalid width",
+                               __FILE__, __FUNCTION__, __LINE__);
+    }
+    memcpy(get<uint8_t>(field.offset), addr.somem(), field.width);
+    return *this;
+  };
+
+  /**
+   * @brief	Appends packet data to a Packet-Out
+   */
+  crofbuilder_template &data(const uint8_t *data, size_t datalen);
+
+private:
+  uint8_t type;
+};
+
+}; // end of namespace rofl
+
+#endif /* SRC_ROFL_COMMON_CROFTEMPLATE_HPP_ */
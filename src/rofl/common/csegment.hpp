@@ -20,6 +20,7 @@
 #include "rofl/common/exception.hpp"
 #include "rofl/common/openflow/messages/cofmsg_aggr_stats.h"
 #include "rofl/common/openflow/messages/cofmsg_desc_stats.h"
+#include "rofl/common/openflow/messages/cofmsg_dispatch.h"
 #include "rofl/common/openflow/messages/cofmsg_flow_stats.h"
 #include "rofl/common/openflow/messages/cofmsg_group_desc_stats.h"
 #include "rofl/common/openflow/messages/cofmsg_group_features_stats.h"
@@ -160,17 +161,8 @@ public:
     os << "<xid: 0x" << std::hex << (int)msg.xid << std::dec << " >"
        << std::endl;
 
-    uint16_t stats_type = 0;
-    if (dynamic_cast<const rofl::openflow::cofmsg_stats_request *>((msg.msg))) {
-      stats_type =
-          dynamic_cast<const rofl::openflow::cofmsg_stats_request &>(*(msg.msg))
-              .get_stats_type();
-    } else if (dynamic_cast<const rofl::openflow::cofmsg_stats_reply *>(
-                   (msg.msg))) {
-      stats_type =
-          dynamic_cast<const rofl::openflow::cofmsg_stats_reply &>(*(msg.msg))
-              .get_stats_type();
-    }
+    uint16_t stats_type =
+        rofl::openflow::cofmsg_dispatch::get_stats_type(*(msg.msg));
 
     switch (msg.msg->get_version()) {
     case rofl::openflow13::OFP_VERSION: {
@@ -180,53 +172,49 @@ public:
 
         switch (stats_type) {
         case rofl::openflow13::OFPMP_DESC: {
-          os << dynamic_cast<rofl::openflow::cofmsg_desc_stats_request const &>(
-              *(msg.msg));
+          os << rofl::openflow::cofmsg_cast<
+              rofl::openflow::cofmsg_desc_stats_request>(*(msg.msg));
         } break;
         case rofl::openflow13::OFPMP_FLOW: {
-          os << dynamic_cast<rofl::openflow::cofmsg_flow_stats_request const &>(
-              *(msg.msg));
+          os << rofl::openflow::cofmsg_cast<
+              rofl::openflow::cofmsg_flow_stats_request>(*(msg.msg));
         } break;
         case rofl::openflow13::OFPMP_AGGREGATE: {
-          os << dynamic_cast<rofl::openflow::cofmsg_aggr_stats_request const &>(
-              *(msg.msg));
+          os << rofl::openflow::cofmsg_cast<
+              rofl::openflow::cofmsg_aggr_stats_request>(*(msg.msg));
         } break;
         case rofl::openflow13::OFPMP_TABLE: {
-          os << dynamic_cast<
-              rofl::openflow::cofmsg_table_stats_request const &>(*(msg.msg));
+          os << rofl::openflow::cofmsg_cast<
+              rofl::openflow::cofmsg_table_stats_request>(*(msg.msg));
         } break;
         case rofl::openflow13::OFPMP_PORT_STATS: {
-          os << dynamic_cast<rofl::openflow::cofmsg_port_stats_request const &>(
-              *(msg.msg));
+          os << rofl::openflow::cofmsg_cast<
+              rofl::openflow::cofmsg_port_stats_request>(*(msg.msg));
         } break;
         case rofl::openflow13::OFPMP_QUEUE: {
-          os << dynamic_cast<
-              rofl::openflow::cofmsg_queue_stats_request const &>(*(msg.msg));
+          os << rofl::openflow::cofmsg_cast<
+              rofl::openflow::cofmsg_queue_stats_request>(*(msg.msg));
         } break;
         case rofl::openflow13::OFPMP_GROUP: {
-          os << dynamic_cast<
-              rofl::openflow::cofmsg_group_stats_request const &>(*(msg.msg));
+          os << rofl::openflow::cofmsg_cast<
+              rofl::openflow::cofmsg_group_stats_request>(*(msg.msg));
         } break;
         case rofl::openflow13::OFPMP_GROUP_DESC: {
-          os << dynamic_cast<
-              rofl::openflow::cofmsg_group_desc_stats_request const &>(
-              *(msg.msg));
+          os << rofl::openflow::cofmsg_cast<
+              rofl::openflow::cofmsg_group_desc_stats_request>(*(msg.msg));
         } break;
         case rofl::openflow13::OFPMP_GROUP_FEATURES: {
-          os << dynamic_cast<
-              rofl::openflow::cofmsg_group_features_stats_request const &>(
-              *(msg.msg));
+          os << rofl::openflow::cofmsg_cast<
+              rofl::openflow::cofmsg_group_features_stats_request>(*(msg.msg));
         } break;
         // TODO: meters
         case rofl::openflow13::OFPMP_TABLE_FEATURES: {
-          os << dynamic_cast<
-              rofl::openflow::cofmsg_table_features_stats_request const &>(
-              *(msg.msg));
+          os << rofl::openflow::cofmsg_cast<
+              rofl::openflow::cofmsg_table_features_stats_request>(*(msg.msg));
         } break;
         case rofl::openflow13::OFPMP_PORT_DESC: {
-          os << dynamic_cast<
-              rofl::openflow::cofmsg_port_desc_stats_request const &>(
-              *(msg.msg));
+          os << rofl::openflow::cofmsg_cast<
+              rofl::openflow::cofmsg_port_desc_stats_request>(*(msg.msg));
         } break;
         default: { os << *(msg.msg); };
         }
@@ -236,52 +224,49 @@ public:
 
         switch (stats_type) {
         case rofl::openflow13::OFPMP_DESC: {
-          os << dynamic_cast<rofl::openflow::cofmsg_desc_stats_reply const &>(
-              *(msg.msg));
+          os << rofl::openflow::cofmsg_cast<
+              rofl::openflow::cofmsg_desc_stats_reply>(*(msg.msg));
         } break;
         case rofl::openflow13::OFPMP_FLOW: {
-          os << dynamic_cast<rofl::openflow::cofmsg_flow_stats_reply const &>(
-              *(msg.msg));
+          os << rofl::openflow::cofmsg_cast<
+              rofl::openflow::cofmsg_flow_stats_reply>(*(msg.msg));
         } break;
         case rofl::openflow13::OFPMP_AGGREGATE: {
-          os << dynamic_cast<rofl::openflow::cofmsg_aggr_stats_reply const &>(
-              *(msg.msg));
+          os << rofl::openflow::cofmsg_cast<
+              rofl::openflow::cofmsg_aggr_stats_reply>(*(msg.msg));
         } break;
         case rofl::openflow13::OFPMP_TABLE: {
-          os << dynamic_cast<rofl::openflow::cofmsg_table_stats_reply const &>(
-              *(msg.msg));
+          os << rofl::openflow::cofmsg_cast<
+              rofl::openflow::cofmsg_table_stats_reply>(*(msg.msg));
         } break;
         case rofl::openflow13::OFPMP_PORT_STATS: {
-          os << dynamic_cast<rofl::openflow::cofmsg_port_stats_reply const &>(
-              *(msg.msg));
+          os << rofl::openflow::cofmsg_cast<
+              rofl::openflow::cofmsg_port_stats_reply>(*(msg.msg));
         } break;
         case rofl::openflow13::OFPMP_QUEUE: {
-          os << dynamic_cast<rofl::openflow::cofmsg_queue_stats_reply const &>(
-              *(msg.msg));
+          os << rofl::openflow::cofmsg_cast<
+              rofl::openflow::cofmsg_queue_stats_reply>(*(msg.msg));
         } break;
         case rofl::openflow13::OFPMP_GROUP: {
-          os << dynamic_cast<rofl::openflow::cofmsg_group_stats_reply const &>(
-              *(msg.msg));
+          os << rofl::openflow::cofmsg_cast<
+              rofl::openflow::cofmsg_group_stats_reply>(*(msg.msg));
         } break;
         case rofl::openflow13::OFPMP_GROUP_DESC: {
-          os << dynamic_cast<
-              rofl::openflow::cofmsg_group_desc_stats_reply const &>(
-              *(msg.msg));
+          os << rofl::openflow::cofmsg_cast<
+              rofl::openflow::cofmsg_group_desc_stats_reply>(*(msg.msg));
         } break;
         case rofl::openflow13::OFPMP_GROUP_FEATURES: {
-          os << dynamic_cast<
-              rofl::openflow::cofmsg_group_features_stats_reply const &>(
-              *(msg.msg));
+          os << rofl::openflow::cofmsg_cast<
+              rofl::openflow::cofmsg_group_features_stats_reply>(*(msg.msg));
         } break;
         // TODO: meters
         case rofl::openflow13::OFPMP_TABLE_FEATURES: {
-          os << dynamic_cast<
-              rofl::openflow::cofmsg_table_features_stats_reply const &>(
-              *(msg.msg));
+          os << rofl::openflow::cofmsg_cast<
+              rofl::openflow::cofmsg_table_features_stats_reply>(*(msg.msg));
         } break;
         case rofl::openflow13::OFPMP_PORT_DESC: {
-          os << dynamic_cast<
-              rofl::openflow::cofmsg_port_desc_stats_reply const &>(*(msg.msg));
+          os << rofl::openflow::cofmsg_cast<
+              rofl::openflow::cofmsg_port_desc_stats_reply>(*(msg.msg));
         } break;
         default: { os << *(msg.msg); };
         }
@@ -0,0 +1,345 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/*
+ * cshmring.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "cshmring.hpp"
+
+#include <string.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#ifndef MFD_CLOEXEC
+#define MFD_CLOEXEC 0x0001U
+#endif
+
+using namespace rofl;
+
+/*static*/ const size_t cshmring::RING_SIZE_DEFAULT;
+/*static*/ const uint32_t cshmring::MAGIC;
+/*static*/ const uint32_t cshmring::RING_VERSION;
+
+namespace {
+
+/* payload accompanying memfd and doorbells on the unix domain socket */
+struct cshmring_hello {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t ring_size;
+};
+
+}; // namespace
+
+cshmring::~cshmring() { release(); }
+
+cshmring::cshmring(size_t ring_size)
+    : memfd(-1), ring_size(ring_size), region_size(0), region(MAP_FAILED),
+      txring(nullptr), rxring(nullptr), txdata(nullptr), rxdata(nullptr),
+      tx_data_fd(-1), tx_space_fd(-1), rx_data_fd(-1), rx_space_fd(-1) {
+  for (unsigned int i = 0; i < 4; i++) {
+    efds[i] = -1;
+  }
+
+  if ((ring_size < (size_t)sysconf(_SC_PAGESIZE)) ||
+      (ring_size & (ring_size - 1))) {
+    throw eInvalid("cshmring::cshmring() invalid ring size", __FILE__,
+                   __FUNCTION__, __LINE__);
+  }
+
+  if ((memfd = syscall(__NR_memfd_create, "rofl_shmring", MFD_CLOEXEC)) < 0) {
+    throw eSysCall("eSysCall", "memfd_create", __FILE__, __FUNCTION__,
+                   __LINE__);
+  }
+
+  for (unsigned int i = 0; i < 4; i++) {
+    if ((efds[i] = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) < 0) {
+      release();
+      throw eSysCall("eSysCall", "eventfd", __FILE__, __FUNCTION__, __LINE__);
+    }
+  }
+
+  map(true);
+}
+
+cshmring::cshmring(int memfd, const int *efds, size_t ring_size)
+    : memfd(memfd), ring_size(ring_size), region_size(0), region(MAP_FAILED),
+      txring(nullptr), rxring(nullptr), txdata(nullptr), rxdata(nullptr),
+      tx_data_fd(-1), tx_space_fd(-1), rx_data_fd(-1), rx_space_fd(-1) {
+  for (unsigned int i = 0; i < 4; i++) {
+    this->efds[i] = efds[i];
+  }
+
+  if ((ring_size < (size_t)sysconf(_SC_PAGESIZE)) ||
+      (ring_size & (ring_size - 1))) {
+    release();
+    throw eInvalid("cshmring::cshmring() invalid ring size", __FILE__,
+                   __FUNCTION__, __LINE__);
+  }
+
+  map(false);
+}
+
+void cshmring::map(bool init) {
+  size_t page_size = sysconf(_SC_PAGESIZE);
+  size_t header_size = (sizeof(cregion) + page_size - 1) & ~(page_size - 1);
+  region_size = header_size + 2 * ring_size;
+
+  if (init) {
+    if (::ftruncate(memfd, region_size) < 0) {
+      release();
+      throw eSysCall("eSysCall", "ftruncate", __FILE__, __FUNCTION__,
+                     __LINE__);
+    }
+  } else {
+    struct stat st;
+    if (::fstat(memfd, &st) < 0) {
+      release();
+      throw eSysCall("eSysCall", "fstat", __FILE__, __FUNCTION__, __LINE__);
+    }
+    if ((size_t)st.st_size < region_size) {
+      release();
+      throw eInvalid("cshmring::map() region too small", __FILE__,
+                     __FUNCTION__, __LINE__);
+    }
+  }
+
+  region = ::mmap(nullptr, region_size, PROT_READ | PROT_WRITE,
+                  MAP_SHARED | MAP_POPULATE, memfd, 0);
+  if (MAP_FAILED == region) {
+    release();
+    throw eSysCall("eSysCall", "mmap", __FILE__, __FUNCTION__, __LINE__);
+  }
+
+  /* a fresh memfd is zero filled, so all indices and flags start at 0 */
+  cregion *hdr = (cregion *)region;
+  if (init) {
+    hdr->magic = MAGIC;
+    hdr->version = RING_VERSION;
+    hdr->ring_size = ring_size;
+  } else if ((MAGIC != hdr->magic) || (RING_VERSION != hdr->version) ||
+             (ring_size != hdr->ring_size)) {
+    release();
+    throw eInvalid("cshmring::map() invalid region", __FILE__, __FUNCTION__,
+                   __LINE__);
+  }
+
+  unsigned int tx = init ? 0 : 1;
+  unsigned int rx = init ? 1 : 0;
+  uint8_t *data = (uint8_t *)region + header_size;
+
+  txring = &(hdr->rings[tx]);
+  rxring = &(hdr->rings[rx]);
+  txdata = data + tx * ring_size;
+  rxdata = data + rx * ring_size;
+  tx_data_fd = efds[2 * tx];
+  tx_space_fd = efds[2 * tx + 1];
+  rx_data_fd = efds[2 * rx];
+  rx_space_fd = efds[2 * rx + 1];
+}
+
+void cshmring::release() {
+  if (MAP_FAILED != region) {
+    ::munmap(region, region_size);
+    region = MAP_FAILED;
+  }
+  for (unsigned int i = 0; i < 4; i++) {
+    if (efds[i] >= 0) {
+      ::close(efds[i]);
+      efds[i] = -1;
+    }
+  }
+  if (memfd >= 0) {
+    ::close(memfd);
+    memfd = -1;
+  }
+}
+
+void cshmring::send_fds(int sd) const {
+  struct cshmring_hello hello;
+  memset(&hello, 0, sizeof(hello));
+  hello.magic = MAGIC;
+  hello.version = RING_VERSION;
+  hello.ring_size = ring_size;
+
+  int fds[5] = {memfd, efds[0], efds[1], efds[2], efds[3]};
+  union {
+    struct cmsghdr align;
+    uint8_t buf[CMSG_SPACE(sizeof(fds))];
+  } control;
+  memset(&control, 0, sizeof(control));
+
+  struct iovec iov;
+  iov.iov_base = &hello;
+  iov.iov_len = sizeof(hello);
+
+  struct msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control.buf;
+  msg.msg_controllen = sizeof(control.buf);
+
+  struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+  cmsg->cmsg_level = SOL_SOCKET;
+  cmsg->cmsg_type = SCM_RIGHTS;
+  cmsg->cmsg_len = CMSG_LEN(sizeof(fds));
+  memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+
+  if (::sendmsg(sd, &msg, MSG_NOSIGNAL) != (ssize_t)sizeof(hello)) {
+    throw eSysCall("eSysCall", "sendmsg (SCM_RIGHTS)", __FILE__, __FUNCTION__,
+                   __LINE__);
+  }
+}
+
+/*static*/ cshmring *cshmring::attach(int sd) {
+  struct cshmring_hello hello;
+  int fds[5];
+  union {
+    struct cmsghdr align;
+    uint8_t buf[CMSG_SPACE(sizeof(fds))];
+  } control;
+  memset(&control, 0, sizeof(control));
+
+  struct iovec iov;
+  iov.iov_base = &hello;
+  iov.iov_len = sizeof(hello);
+
+  struct msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control.buf;
+  msg.msg_controllen = sizeof(control.buf);
+
+  ssize_t rc = ::recvmsg(sd, &msg, MSG_DONTWAIT | MSG_CMSG_CLOEXEC);
+  if (rc < 0) {
+    if (EAGAIN == errno)
+      return nullptr;
+    throw eSysCall("eSysCall", "recvmsg (SCM_RIGHTS)", __FILE__, __FUNCTION__,
+                   __LINE__);
+  } else if (0 == rc) {
+    throw eInvalid("cshmring::attach() peer closed socket", __FILE__,
+                   __FUNCTION__, __LINE__);
+  }
+
+  /* take ownership of all descriptors received, even on errors */
+  unsigned int num_fds = 0;
+  struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+  if ((nullptr != cmsg) && (SOL_SOCKET == cmsg->cmsg_level) &&
+      (SCM_RIGHTS == cmsg->cmsg_type)) {
+    num_fds = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+    if (num_fds > 5)
+      num_fds = 5;
+    memcpy(fds, CMSG_DATA(cmsg), num_fds * sizeof(int));
+  }
+
+  if ((rc != (ssize_t)sizeof(hello)) || (5 != num_fds) ||
+      (msg.msg_flags & MSG_CTRUNC) || (MAGIC != hello.magic) ||
+      (RING_VERSION != hello.version)) {
+    for (unsigned int i = 0; i < num_fds; i++) {
+      ::close(fds[i]);
+    }
+    throw eInvalid("cshmring::attach() invalid hello", __FILE__, __FUNCTION__,
+                   __LINE__);
+  }
+
+  return new cshmring(fds[0], &fds[1], hello.ring_size);
+}
+
+size_t cshmring::write(const uint8_t *buf, size_t len) {
+  uint64_t head = txring->head.load(std::memory_order_relaxed);
+  uint64_t tail = txring->tail.load(std::memory_order_acquire);
+  size_t space = ring_size - (head - tail);
+
+  if (0 == space) {
+    /* announce waiting before checking again, see read() */
+    txring->producer_waiting.store(1);
+    tail = txring->tail.load();
+    space = ring_size - (head - tail);
+    if (0 == space)
+      return 0;
+  }
+
+  size_t n = (len < space) ? len : space;
+  size_t offset = head & (ring_size - 1);
+  size_t first = (n < ring_size - offset) ? n : ring_size - offset;
+  memcpy(txdata + offset, buf, first);
+  memcpy(txdata, buf + first, n - first);
+  txring->head.store(head + n, std::memory_order_release);
+
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (txring->consumer_waiting.load(std::memory_order_relaxed) &&
+      txring->consumer_waiting.exchange(0)) {
+    ring_fd(tx_data_fd);
+  }
+
+  return n;
+}
+
+size_t cshmring::read(uint8_t *buf, size_t len) {
+  uint64_t tail = rxring->tail.load(std::memory_order_relaxed);
+  uint64_t head = rxring->head.load(std::memory_order_acquire);
+  size_t avail = head - tail;
+
+  if (0 == avail) {
+    /* announce waiting before checking again, so the producer either sees
+     * the flag or we see its data */
+    rxring->consumer_waiting.store(1);
+    head = rxring->head.load();
+    avail = head - tail;
+    if (0 == avail)
+      return 0;
+  }
+
+  if (avail > ring_size) {
+    throw eInvalid("cshmring::read() ring corrupted", __FILE__, __FUNCTION__,
+                   __LINE__);
+  }
+
+  size_t n = (len < avail) ? len : avail;
+  size_t offset = tail & (ring_size - 1);
+  size_t first = (n < ring_size - offset) ? n : ring_size - offset;
+  memcpy(buf, rxdata + offset, first);
+  memcpy(buf + first, rxdata, n - first);
+  rxring->tail.store(tail + n, std::memory_order_release);
+
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (rxring->producer_waiting.load(std::memory_order_relaxed) &&
+      rxring->producer_waiting.exchange(0)) {
+    ring_fd(rx_space_fd);
+  }
+
+  return n;
+}
+
+size_t cshmring::rx_bytes() const {
+  return rxring->head.load(std::memory_order_acquire) -
+         rxring->tail.load(std::memory_order_relaxed);
+}
+
+size_t cshmring::tx_space() const {
+  return ring_size - (txring->head.load(std::memory_order_relaxed) -
+                      txring->tail.load(std::memory_order_acquire));
+}
+
+/*static*/ void cshmring::ring_fd(int fd) {
+  uint64_t one = 1;
+  /* EAGAIN: counter saturated, the peer is signalled anyway */
+  if (::write(fd, &one, sizeof(one)) < 0) {
+  }
+}
+
+/*static*/ void cshmring::clear_fd(int fd) {
+  uint64_t value;
+  if (::read(fd, &value, sizeof(value)) < 0) {
+  }
+}
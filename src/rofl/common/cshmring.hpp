@@ -0,0 +1,178 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/*
+ * cshmring.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef SRC_ROFL_COMMON_CSHMRING_HPP_
+#define SRC_ROFL_COMMON_CSHMRING_HPP_
+
+#include <inttypes.h>
+#include <stddef.h>
+
+#include <atomic>
+
+#include "rofl/common/exception.hpp"
+
+namespace rofl {
+
+/**
+ * @brief	Shared memory byte stream between two co-located processes
+ *
+ * A memfd backed region holds two single-producer single-consumer byte
+ * rings, one per direction. The creating side writes into ring 0 and reads
+ * from ring 1, the attaching side vice versa. Each ring has two eventfd
+ * doorbells: the producer rings the data doorbell when the consumer waits
+ * for data and the consumer rings the space doorbell when the producer
+ * waits for space. Doorbells are rung only after the other side announced
+ * waiting, so a busy stream costs no system calls at all.
+ *
+ * The creating side hands over memfd and doorbells via send_fds() on a
+ * unix domain socket, the peer calls attach() on its end of that socket.
+ * read() and write() must be called by a single thread each.
+ */
+class cshmring {
+public:
+  /**
+   *
+   */
+  ~cshmring();
+
+  /**
+   * @brief	Creates a new region with two rings of ring_size bytes
+   *
+   * @param ring_size power of two, at least one page
+   */
+  cshmring(size_t ring_size = RING_SIZE_DEFAULT);
+
+  /**
+   * @brief	Attaches to a region received via unix domain socket sd
+   *
+   * @return nullptr when no region was received yet (EAGAIN), throws
+   * eSysCall on errors and eInvalid when the peer closed sd or sent
+   * anything else
+   */
+  static cshmring *attach(int sd);
+
+private:
+  cshmring(int memfd, const int *efds, size_t ring_size);
+
+  cshmring(const cshmring &ring);
+
+  cshmring &operator=(const cshmring &ring);
+
+public:
+  /**
+   * @brief	Hands over memfd and doorbells via unix domain socket sd
+   */
+  void send_fds(int sd) const;
+
+  /**
+   * @brief	Copies up to len bytes into the tx ring
+   *
+   * @return number of bytes written, 0: ring full, get_tx_fd() becomes
+   * readable once the peer consumed data
+   */
+  size_t write(const uint8_t *buf, size_t len);
+
+  /**
+   * @brief	Copies up to len bytes from the rx ring
+   *
+   * @return number of bytes read, 0: ring empty, get_rx_fd() becomes
+   * readable once the peer wrote data
+   */
+  size_t read(uint8_t *buf, size_t len);
+
+  /**
+   * @brief	Returns number of bytes available in the rx ring
+   */
+  size_t rx_bytes() const;
+
+  /**
+   * @brief	Returns number of bytes free in the tx ring
+   */
+  size_t tx_space() const;
+
+  /**
+   * @brief	Returns data doorbell of the rx ring
+   */
+  int get_rx_fd() const { return rx_data_fd; };
+
+  /**
+   * @brief	Returns space doorbell of the tx ring
+   */
+  int get_tx_fd() const { return tx_space_fd; };
+
+  /**
+   * @brief	Resets a doorbell after it became readable
+   */
+  static void clear_fd(int fd);
+
+  /**
+   * @brief	Returns size of each ring in bytes
+   */
+  size_t get_ring_size() const { return ring_size; };
+
+public:
+  static const size_t RING_SIZE_DEFAULT = 1 << 20;
+
+private:
+  /* indices are free running byte counters, head and tail live on separate
+   * cache lines as they are written by different processes */
+  struct cring {
+    alignas(64) std::atomic<uint64_t> head;
+    std::atomic<uint32_t> consumer_waiting;
+    alignas(64) std::atomic<uint64_t> tail;
+    std::atomic<uint32_t> producer_waiting;
+  };
+
+  struct cregion {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t ring_size;
+    cring rings[2];
+  };
+
+  static const uint32_t MAGIC = 0x726f666c; // "rofl"
+  static const uint32_t RING_VERSION = 1;
+
+  void map(bool init);
+
+  void release();
+
+  static void ring_fd(int fd);
+
+private:
+  // memfd backing the region
+  int memfd;
+
+  // doorbells: data and space of ring 0, data and space of ring 1
+  int efds[4];
+
+  // size of each ring in bytes
+  size_t ring_size;
+
+  // mapped region, control block followed by the data of both rings
+  size_t region_size;
+  void *region;
+
+  // rings used by this side
+  cring *txring;
+  cring *rxring;
+  uint8_t *txdata;
+  uint8_t *rxdata;
+
+  // doorbells used by this side
+  int tx_data_fd;
+  int tx_space_fd;
+  int rx_data_fd;
+  int rx_space_fd;
+};
+
+}; // end of namespace rofl
+
+#endif /* SRC_ROFL_COMMON_CSHMRING_HPP_ */
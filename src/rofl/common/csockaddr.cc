@@ -7,6 +7,8 @@
 
 #include "rofl/common/csockaddr.h"
 
+#include <stddef.h>
+
 using namespace rofl;
 
 csockaddr::csockaddr(int family, const std::string &addr, uint16_t portno) {
@@ -25,6 +27,15 @@ csockaddr::csockaddr(int family, const std::string &addr, uint16_t portno) {
     memcpy(ca_s6addr->sin6_addr.s6_addr, saddr.somem(), 16);
     ca_s6addr->sin6_port = htobe16(portno);
   } break;
+  case AF_UNIX: {
+    if (addr.length() >= sizeof(ca_sunaddr->sun_path))
+      throw eInvalid("csockaddr::csockaddr() path too long");
+    ca_mem = cmemory::resize(sizeof(struct sockaddr_un));
+    memset(ca_mem, 0, sizeof(struct sockaddr_un));
+    ca_sunaddr->sun_family = AF_UNIX;
+    memcpy(ca_sunaddr->sun_path, addr.c_str(), addr.length());
+    salen = offsetof(struct sockaddr_un, sun_path) + addr.length() + 1;
+  } break;
   default:
     throw eInvalid("csockaddr::csockaddr() unsupported family");
   }
@@ -56,6 +67,9 @@ size_t csockaddr::length() const {
   case AF_INET6: {
     return sizeof(struct sockaddr_in6);
   } break;
+  case AF_UNIX: {
+    return sizeof(struct sockaddr_un);
+  } break;
   default:
     throw eInvalid("csockaddr::length() unsupported family");
   }
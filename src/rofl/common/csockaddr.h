@@ -39,18 +39,20 @@ public:
     struct sockaddr *addru_saddr;
     struct sockaddr_in *addru_s4addr;
     struct sockaddr_in6 *addru_s6addr;
+    struct sockaddr_un *addru_sunaddr;
   } addr_addru;
 
 #define ca_mem addr_addru.addru_mem
-#define ca_saddr addr_addru.addru_saddr   // generic sockaddr
-#define ca_s4addr addr_addru.addru_s4addr // sockaddr_in
-#define ca_s6addr addr_addru.addru_s6addr // sockaddr_in6
+#define ca_saddr addr_addru.addru_saddr     // generic sockaddr
+#define ca_s4addr addr_addru.addru_s4addr   // sockaddr_in
+#define ca_s6addr addr_addru.addru_s6addr   // sockaddr_in6
+#define ca_sunaddr addr_addru.addru_sunaddr // sockaddr_un
 
   socklen_t salen;
 
 public:
   /**
-   *
+   * @brief	For AF_UNIX, addr is the socket's path and port_no is ignored
    */
   csockaddr(int family, const std::string &addr, uint16_t port_no);
 
@@ -137,6 +139,9 @@ public:
       os << "<portno: " << (unsigned int)be16toh(sockaddr.ca_s6addr->sin6_port)
          << " >" << std::endl;
     } break;
+    case AF_UNIX: {
+      os << "<path: " << sockaddr.ca_sunaddr->sun_path << " >" << std::endl;
+    } break;
     }
     return os;
   };
@@ -156,6 +161,9 @@ public:
       sstr << "inet6:" << addr.str() << ":"
            << (unsigned int)be16toh(ca_s6addr->sin6_port);
     } break;
+    case AF_UNIX: {
+      sstr << "unix:" << ca_sunaddr->sun_path;
+    } break;
     }
     return sstr.str();
   };
@@ -10,18 +10,25 @@
  */
 
 #include "cthread.hpp"
+#include "cthread_pool.hpp"
+#include <algorithm>
 #include <glog/logging.h>
 #include <iostream>
 #include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <vector>
 
 using namespace rofl;
 
-/*static*/ const int cthread::PIPE_READ_FD = 0;
-/*static*/ const int cthread::PIPE_WRITE_FD = 1;
-
-void cthread::initialize() {
-  running = false;
-  tid = 0;
+cthread_loop::cthread_loop(cthread_engine_t engine)
+    : running(false), tid(0), retval(0), timer_fd(-1), cpu(-1), numa_node(-1),
+      engine(ENGINE_EPOLL),
+      multishot(true), multishot_recv(true), generation(0), num_threads(0), deadline(UINT64_MAX),
+      high_resolution(false), armed(UINT64_MAX), instrumented(false),
+      busy_poll(0), active(false),
+      num_busy_polls(0), num_busy_poll_hits(0), posted(false),
+      current(nullptr), state(STATE_IDLE) {
+  timers.advance(timers.now(clock));
 
   // worker thread
   if ((epfd = epoll_create(1)) < 0) {
@@ -32,10 +39,26 @@ void cthread::initialize() {
   // eventfd
   event_fd = eventfd(0, EFD_NONBLOCK);
   if (event_fd < 0) {
+    ::close(epfd);
     throw eSysCall("eSysCall", "eventfd", __FILE__, __FUNCTION__, __LINE__);
   }
 
+  // io_uring, falls back to epoll if not supported
+  if ((ENGINE_IO_URING == engine) && cio_uring::is_supported()) {
+    try {
+      ring.reset(new cio_uring());
+      this->engine = ENGINE_IO_URING;
+    } catch (eSysCall &e) {
+      VLOG(1) << __FUNCTION__ << " io_uring not available, using epoll";
+    }
+  }
+
   // register event_fd to kernel
+  if (ring) {
+    ring_update_fd(event_fd, EPOLLIN); // level-triggered
+    return;
+  }
+
   struct epoll_event epev;
   memset((uint8_t *)&epev, 0, sizeof(struct epoll_event));
   epev.events = EPOLLIN; // level-triggered
@@ -47,6 +70,8 @@ void cthread::initialize() {
       /* do nothing */
     } break;
     default: {
+      ::close(epfd);
+      ::close(event_fd);
       throw eSysCall("eSysCall", "epoll_ctl (EPOLL_CTL_ADD)", __FILE__,
                      __FUNCTION__, __LINE__);
     };
@@ -54,343 +79,652 @@ void cthread::initialize() {
   }
 }
 
-void cthread::release() {
-  clear_timers();
+cthread_loop::~cthread_loop() {
+  try {
+    stop();
+  } catch (std::exception &e) {
+    std::cerr << __FUNCTION__ << "(): failed with " << e.what() << std::endl;
+  }
 
-  stop();
+  ::close(epfd);
+  ::close(event_fd);
+  if (timer_fd >= 0)
+    ::close(timer_fd);
+}
 
-  {
-    AcquireReadWriteLock lock(tlock);
-    for (auto it : fds) {
-      struct epoll_event epev;
-      memset((uint8_t *)&epev, 0, sizeof(struct epoll_event));
-      epev.events = 0;
-      epev.data.fd = it.first;
-      epoll_ctl(epfd, EPOLL_CTL_DEL, it.first, &epev);
+void cthread_loop::start(const std::string &thread_name, int cpu) {
+  switch (state) {
+  case STATE_IDLE: {
+
+    /* pin worker thread before it runs, so its allocations are node local */
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    if (cpu >= 0) {
+      cpu_set_t cpuset;
+      CPU_ZERO(&cpuset);
+      CPU_SET(cpu, &cpuset);
+      if (pthread_attr_setaffinity_np(&attr, sizeof(cpuset), &cpuset) != 0) {
+        pthread_attr_destroy(&attr);
+        throw eSysCall("eSysCall", "pthread_attr_setaffinity_np", __FILE__,
+                       __FUNCTION__, __LINE__);
+      }
+    }
+    this->cpu = cpu;
+    numa_node = cthread_affinity::get_numa_node(cpu);
+
+    running = true;
+    self = shared_from_this();
+    if (pthread_create(&tid, &attr, &(cthread_loop::start_loop), this) != 0) {
+      pthread_attr_destroy(&attr);
+      running = false;
+      self.reset();
+      throw eSysCall("eSysCall", "pthread_create", __FILE__, __FUNCTION__,
+                     __LINE__);
     }
-    fds.clear();
+    pthread_attr_destroy(&attr);
+
+    if (thread_name.length() && thread_name.length() < 16)
+      pthread_setname_np(tid, thread_name.c_str());
+
+    state = STATE_RUNNING;
+
+  } break;
+  default: {};
   }
+}
 
-  // deregister event_fd from kernel
-  struct epoll_event epev;
-  memset((uint8_t *)&epev, 0, sizeof(struct epoll_event));
-  epev.events = 0;
-  epev.data.fd = event_fd;
+void cthread_loop::stop() {
+  switch (state) {
+  case STATE_RUNNING: {
+
+    running = false;
+
+    notify();
+
+    state = STATE_IDLE;
+
+    /* deletion of thread not initiated within this thread */
+    if (pthread_self() == tid) {
+      pthread_detach(tid);
+      return;
+    }
+
+    int rv = pthread_join(tid, NULL);
+    if (rv != 0) {
+      pthread_cancel(tid);
+    }
+
+  } break;
+  default: {};
+  }
+}
 
-  if (epoll_ctl(epfd, EPOLL_CTL_DEL, event_fd, &epev) < 0) {
+void cthread_loop::notify() {
+  uint64_t c = 1;
+  if (write(event_fd, &c, sizeof(c)) < 0) {
     switch (errno) {
-    case ENOENT: {
-      /* do nothing */
+    case EAGAIN: {
+      // do nothing
+    } break;
+    case EINTR: {
+      // signal received
     } break;
     default: {
-      throw eSysCall("eSysCall", "epoll_ctl (EPOLL_CTL_DEL)", __FILE__,
-                     __FUNCTION__, __LINE__);
+      throw eSysCall("eSysCall", "write to event_fd", __FILE__, __FUNCTION__,
+                     __LINE__);
     };
     }
   }
-
-  ::close(epfd);
-  ::close(event_fd);
 }
 
-void cthread::add_fd(int fd, bool exception, bool edge_triggered) {
-  AcquireReadWriteLock lock(tlock);
-  if (fds.find(fd) != fds.end())
-    return;
+void cthread_loop::signal() {
+  if (not posted.exchange(true))
+    notify();
+}
 
-  uint32_t events = edge_triggered ? EPOLLET : 0;
-  struct epoll_event epev;
-  memset((uint8_t *)&epev, 0, sizeof(struct epoll_event));
-  epev.events = events;
-  epev.data.fd = fd;
+void cthread_loop::set_high_resolution(bool enable) {
+  {
+    AcquireReadWriteLock lock(tlock);
+    if (enable == high_resolution)
+      return;
 
-  VLOG(3) << __FUNCTION__ << " fd=" << fd
-          << " edge_triggered=" << edge_triggered << " thread=" << this;
+    if (enable && (timer_fd < 0)) {
+      if ((timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK)) < 0) {
+        throw eSysCall("eSysCall", "timerfd_create", __FILE__, __FUNCTION__,
+                       __LINE__);
+      }
 
-  if (epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &epev) < 0) {
-    switch (errno) {
-    case EEXIST: {
-      /* do nothing */
-    } break;
-    default: {
-      if (exception)
+      struct epoll_event epev;
+      memset((uint8_t *)&epev, 0, sizeof(struct epoll_event));
+      epev.events = EPOLLIN; // level-triggered
+      epev.data.fd = timer_fd;
+
+      if (ring) {
+        ring_update_fd(timer_fd, EPOLLIN);
+      } else if (epoll_ctl(epfd, EPOLL_CTL_ADD, timer_fd, &epev) < 0) {
+        ::close(timer_fd);
+        timer_fd = -1;
         throw eSysCall("eSysCall", "epoll_ctl (EPOLL_CTL_ADD)", __FILE__,
                        __FUNCTION__, __LINE__);
-    };
+      }
     }
+
+    /* disarm timerfd, worker thread recalculates its deadline */
+    arm_timer_fd(UINT64_MAX);
+    if (enable) {
+      timers.set_resolution(RESOLUTION_HIGH);
+    } else {
+      timers.set_resolution(ctimer_wheel::RESOLUTION_DEFAULT);
+    }
+    deadline = 0;
+    high_resolution = enable;
   }
+  notify();
+}
 
-  fds[fd] = events;
+ctimer_stats cthread_loop::get_timer_stats() const {
+  AcquireReadLock lock(tlock);
+  return stats;
 }
 
-void cthread::drop_fd(int fd, bool exception) {
+void cthread_loop::clear_timer_stats() {
   AcquireReadWriteLock lock(tlock);
-  if (fds.find(fd) == fds.end())
-    return;
+  stats.clear();
+}
 
-  struct epoll_event epev;
-  memset((uint8_t *)&epev, 0, sizeof(struct epoll_event));
-  epev.data.fd = fd;
+cloop_stats cthread_loop::get_loop_stats() const {
+  std::lock_guard<std::mutex> lock(metrics_mutex);
+  return metrics;
+}
 
-  VLOG(3) << __FUNCTION__ << " fd=" << fd << " thread=" << this;
+void cthread_loop::clear_loop_stats() {
+  std::lock_guard<std::mutex> lock(metrics_mutex);
+  metrics.clear();
+}
 
-  if (epoll_ctl(epfd, EPOLL_CTL_DEL, fd, &epev) < 0) {
-    switch (errno) {
-    case ENOENT: {
-      /* do nothing */
-    } break;
-    default: {
-      if (exception)
-        throw eSysCall("eSysCall", "epoll_ctl (EPOLL_CTL_DEL)", __FILE__,
-                       __FUNCTION__, __LINE__);
-    };
-    }
-  }
+uint64_t cthread_loop::metrics_start() const {
+  if (not instrumented)
+    return 0;
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
 
-  fds.erase(fd);
+void cthread_loop::metrics_callback(cloop_stats::callback_t cb,
+                                    uint64_t start) {
+  if (0 == start)
+    return;
+  uint64_t end = metrics_start();
+  if (end < start)
+    return;
+  std::lock_guard<std::mutex> lock(metrics_mutex);
+  metrics.add_callback(cb, end - start);
 }
 
-void cthread::add_read_fd(int fd, bool exception, bool edge_triggered) {
-  add_fd(fd, exception, edge_triggered);
+void cthread_loop::arm_timer_fd(uint64_t tick) {
+  if ((timer_fd < 0) || (tick == armed))
+    return;
 
-  AcquireReadWriteLock lock(tlock);
+  struct itimerspec its;
+  memset(&its, 0, sizeof(its));
+  if (tick != UINT64_MAX) {
+    uint64_t nsecs = timers.to_nsecs(tick);
+    its.it_value.tv_sec = nsecs / 1000000000;
+    its.it_value.tv_nsec = nsecs % 1000000000;
+  }
 
-  fds[fd] |= EPOLLIN;
+  if (timerfd_settime(timer_fd, TFD_TIMER_ABSTIME, &its, NULL) < 0) {
+    throw eSysCall("eSysCall", "timerfd_settime", __FILE__, __FUNCTION__,
+                   __LINE__);
+  }
+  armed = tick;
+}
 
-  struct epoll_event epev;
-  memset((uint8_t *)&epev, 0, sizeof(struct epoll_event));
-  epev.events = fds[fd];
-  epev.data.fd = fd;
+uint64_t cthread_loop::lateness(const ctimespec &tspec) const {
+  const struct timespec &now = clock.get_tspec();
+  const struct timespec &ts = tspec.get_tspec();
+  int64_t nsecs = (int64_t)(now.tv_sec - ts.tv_sec) * 1000000000 +
+                  (now.tv_nsec - ts.tv_nsec);
+  return (nsecs > 0) ? nsecs : 0;
+}
 
-  if (epoll_ctl(epfd, EPOLL_CTL_MOD, fd, &epev) < 0) {
-    switch (errno) {
-    case ENOENT: {
-      epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &epev);
-    } break;
-    default: {
-      if (exception)
-        throw eSysCall("eSysCall", "epoll_ctl (EPOLL_CTL_MOD)", __FILE__,
-                       __FUNCTION__, __LINE__);
-    };
+void cthread_loop::update_fd(int fd, bool exception) {
+  uint32_t events = 0;
+  auto it = fds.find(fd);
+  if (it != fds.end()) {
+    for (auto thread : it->second) {
+      events |= thread->fds[fd];
     }
   }
-}
 
-void cthread::drop_read_fd(int fd, bool exception) {
-  AcquireReadWriteLock lock(tlock);
-  if (fds.find(fd) == fds.end())
+  if (ring) {
+    ring_update_fd(fd, (it == fds.end()) ? 0 : events);
     return;
-
-  fds[fd] &= ~EPOLLIN;
+  }
 
   struct epoll_event epev;
   memset((uint8_t *)&epev, 0, sizeof(struct epoll_event));
-  epev.events = fds[fd];
+  epev.events = events;
   epev.data.fd = fd;
 
-  VLOG(3) << __FUNCTION__ << " fd=" << fd << " thread=" << this;
-
-  if (epoll_ctl(epfd, EPOLL_CTL_MOD, fd, &epev) < 0) {
-    switch (errno) {
-    case ENOENT: {
-      epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &epev);
-    } break;
-    default: {
-      if (exception)
-        throw eSysCall("eSysCall", "epoll_ctl (EPOLL_CTL_MOD)", __FILE__,
-                       __FUNCTION__, __LINE__);
-    };
+  if (it == fds.end()) {
+    if (epoll_ctl(epfd, EPOLL_CTL_DEL, fd, &epev) < 0) {
+      switch (errno) {
+      case ENOENT: {
+        /* do nothing */
+      } break;
+      default: {
+        if (exception)
+          throw eSysCall("eSysCall", "epoll_ctl (EPOLL_CTL_DEL)", __FILE__,
+                         __FUNCTION__, __LINE__);
+      };
+      }
+    }
+  } else {
+    if (epoll_ctl(epfd, EPOLL_CTL_MOD, fd, &epev) < 0) {
+      switch (errno) {
+      case ENOENT: {
+        epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &epev);
+      } break;
+      default: {
+        if (exception)
+          throw eSysCall("eSysCall", "epoll_ctl (EPOLL_CTL_MOD)", __FILE__,
+                         __FUNCTION__, __LINE__);
+      };
+      }
     }
   }
 }
 
-void cthread::add_write_fd(int fd, bool exception, bool edge_triggered) {
-  add_fd(fd, exception, edge_triggered);
+void cthread_loop::ring_update_fd(int fd, uint32_t events) {
+  auto it = polls.find(fd);
+  if (0 == (events & ~EPOLLET)) {
+    if (it == polls.end())
+      return;
+    if (it->second.armed)
+      ring->poll_remove(((uint64_t)it->second.generation << 32) |
+                        (uint32_t)fd);
+    polls.erase(it);
+  } else {
+    cpoll &poll = polls[fd];
+    if (poll.armed && (poll.events == events))
+      return;
+    if (poll.armed)
+      ring->poll_remove(((uint64_t)poll.generation << 32) | (uint32_t)fd);
+    poll.events = events;
+    ring_arm_poll(fd, poll);
+  }
 
-  AcquireReadWriteLock lock(tlock);
+  /* submit request with next io_uring_enter() call */
+  if (pthread_self() != tid)
+    notify();
+}
 
-  fds[fd] |= EPOLLOUT;
+void cthread_loop::ring_arm_poll(int fd, cpoll &poll) {
+  /* edge-triggered: multishot request, level-triggered: re-armed after
+   * each completion */
+  poll.generation = ++generation;
+  poll.armed = true;
+  ring->poll_add(fd, poll.events & ~EPOLLET,
+                 multishot && (poll.events & EPOLLET),
+                 ((uint64_t)poll.generation << 32) | (uint32_t)fd);
+}
 
-  struct epoll_event epev;
-  memset((uint8_t *)&epev, 0, sizeof(struct epoll_event));
-  epev.events = fds[fd];
-  epev.data.fd = fd;
+void cthread_loop::ring_arm_recv(int fd, crecv &recv) {
+  recv.generation = ++generation;
+  recv.armed = true;
+  ring->recv(fd, multishot_recv,
+             ((uint64_t)recv.generation << 32) | (uint32_t)fd);
+}
 
-  if (epoll_ctl(epfd, EPOLL_CTL_MOD, fd, &epev) < 0) {
-    switch (errno) {
-    case ENOENT: {
-      epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &epev);
-    } break;
-    default: {
-      if (exception)
-        throw eSysCall("eSysCall", "epoll_ctl (EPOLL_CTL_MOD)", __FILE__,
-                       __FUNCTION__, __LINE__);
-    };
+void cthread_loop::ring_cancel_io(const cthread *thread, int fd) {
+  bool cancelled = false;
+  auto rt = recvs.find(fd);
+  if ((rt != recvs.end()) && (rt->second.thread == thread)) {
+    if (rt->second.armed) {
+      ring->cancel(((uint64_t)rt->second.generation << 32) | (uint32_t)fd);
+      cancelled = true;
     }
+    recvs.erase(rt);
+  }
+  auto st = sends.find(fd);
+  if ((st != sends.end()) && (st->second.thread == thread)) {
+    if (st->second.pending > 0) {
+      ring->cancel(((uint64_t)st->second.generation << 32) | (uint32_t)fd);
+      cancelled = true;
+    }
+    sends.erase(st);
   }
-}
-
-void cthread::drop_write_fd(int fd, bool exception) {
-  AcquireReadWriteLock lock(tlock);
-  if (fds.find(fd) == fds.end())
-    return;
-
-  fds[fd] &= ~EPOLLOUT;
 
-  struct epoll_event epev;
-  memset((uint8_t *)&epev, 0, sizeof(struct epoll_event));
-  epev.events = fds[fd];
-  epev.data.fd = fd;
+  /* submit request with next io_uring_enter() call */
+  if (cancelled && (pthread_self() != tid))
+    notify();
+}
 
-  VLOG(3) << __FUNCTION__ << " fd=" << fd << " thread=" << this;
+int cthread_loop::wait_events(struct epoll_event *events, int maxevents,
+                              int timeout, const sigset_t *sigmask) {
+  if (not ring)
+    return epoll_pwait(epfd, events, maxevents, timeout, sigmask);
 
-  if (epoll_ctl(epfd, EPOLL_CTL_MOD, fd, &epev) < 0) {
+  if (ring->wait(1, timeout, sigmask) < 0) {
     switch (errno) {
-    case ENOENT: {
-      epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &epev);
+    case ETIME:
+    case EINTR:
+    case EBUSY:
+    case EAGAIN: {
+      /* handle completions available so far */
     } break;
-    default: {
-      if (exception)
-        throw eSysCall("eSysCall", "epoll_ctl (EPOLL_CTL_MOD)", __FILE__,
-                       __FUNCTION__, __LINE__);
-    };
+    default: { return -1; };
     }
   }
-}
 
-void cthread::clear_timers() {
+  int n = 0;
+  uint64_t user_data = 0;
+  int32_t res = 0;
+  bool more = false;
+  int bid = -1;
   AcquireReadWriteLock lock(tlock);
-  ordered_timers.clear();
-};
+  while ((n < maxevents) && ring->pop(user_data, res, more, bid)) {
+    int fd = (int)(user_data & 0xffffffff);
+    uint32_t gen = (uint32_t)(user_data >> 32);
+    auto it = polls.find(fd);
+    if ((it == polls.end()) || (it->second.generation != gen)) {
+      /* receive and send completions are handed over after fd events */
+      auto rt = recvs.find(fd);
+      auto st = sends.find(fd);
+      if (((rt != recvs.end()) && (rt->second.generation == gen)) ||
+          ((st != sends.end()) && (st->second.generation == gen))) {
+        ccompletion c = {fd, gen, res, bid, more};
+        completions.push_back(c);
+      } else if (bid >= 0) {
+        /* ignore completions of cancelled requests */
+        ring->recycle_buffer(bid);
+      }
+      continue;
+    }
+    cpoll &poll = it->second;
+    if (not more)
+      poll.armed = false;
+
+    if (res < 0) {
+      if ((-EINVAL == res) && multishot && (poll.events & EPOLLET)) {
+        /* multishot poll not supported by kernel */
+        multishot = false;
+        ring_arm_poll(fd, poll);
+      } else {
+        VLOG(1) << __FUNCTION__ << " poll failed fd=" << fd
+                << " error=" << strerror(-res);
+      }
+      continue;
+    }
 
-bool cthread::add_timer(uint32_t timer_id, const ctimespec &tspec) {
-  std::pair<std::set<ctimer>::iterator, bool> rv;
-  bool do_wakeup = false;
-  {
-    AcquireReadWriteLock lock(tlock);
+    events[n].events = res;
+    events[n].data.fd = fd;
+    n++;
 
-    if (ordered_timers.empty() || tspec < ordered_timers.begin()->get_tspec())
-      do_wakeup = true;
+    if (not poll.armed)
+      ring_arm_poll(fd, poll);
+  }
+  return n;
+}
 
-    auto timer_it = find_if(ordered_timers.begin(), ordered_timers.end(),
-                            ctimer_find_by_timer_id(timer_id));
-    if (timer_it != ordered_timers.end()) {
-      ordered_timers.erase(timer_it);
-      rv = ordered_timers.emplace(timer_id, tspec);
-    } else {
-      rv = ordered_timers.emplace(timer_id, tspec);
+int cthread_loop::spin_events(struct epoll_event *events, int maxevents,
+                              int timeout, const sigset_t *sigmask) {
+  uint64_t budget = (uint64_t)busy_poll * 1000;
+  if ((timeout >= 0) && ((uint64_t)timeout * 1000000 < budget))
+    budget = (uint64_t)timeout * 1000000;
+
+  num_busy_polls++;
+  ctimespec start(ctimespec::now());
+  while (running && (not posted)) {
+    int rc = wait_events(events, maxevents, 0, sigmask);
+    if ((rc != 0) || (not completions.empty())) {
+      if ((rc > 0) || (not completions.empty()))
+        num_busy_poll_hits++;
+      return rc;
     }
+    ctimespec elapsed(ctimespec::now() - start);
+    const struct timespec &ts = elapsed.get_tspec();
+    if ((uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec >= budget)
+      return 0;
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#endif
   }
+  if (posted)
+    num_busy_poll_hits++;
+  return 0;
+}
 
-  if ((do_wakeup) && (tid != pthread_self())) {
-    wakeup();
-  }
+void cthread_loop::set_busy_poll(unsigned int usecs) {
+  busy_poll = usecs;
+  notify();
+}
 
-  return rv.second;
+void cthread_loop::wait_for_dispatch(const cthread *thread) {
+  if (pthread_self() == tid)
+    return;
+
+  std::unique_lock<std::mutex> lock(dispatch_mutex);
+  dispatch_cond.wait(lock, [this, thread] { return current != thread; });
 }
 
-const ctimer &cthread::get_timer(uint32_t timer_id) const {
-  AcquireReadLock lock(tlock);
-  auto timer_it = find_if(ordered_timers.begin(), ordered_timers.end(),
-                          ctimer_find_by_timer_id(timer_id));
-  if (timer_it == ordered_timers.end()) {
-    throw eThreadNotFound("cthread::get_timer() timer_id not found");
+cthread_loop::cdispatch_guard::~cdispatch_guard() {
+  {
+    std::lock_guard<std::mutex> lock(loop.dispatch_mutex);
+    loop.current = nullptr;
   }
-  return *timer_it;
+  loop.dispatch_cond.notify_all();
 }
 
-bool cthread::drop_timer(uint32_t timer_id) {
-  AcquireReadWriteLock lock(tlock);
-  auto timer_it = find_if(ordered_timers.begin(), ordered_timers.end(),
-                          ctimer_find_by_timer_id(timer_id));
-  if (timer_it == ordered_timers.end()) {
-    return false;
-  }
-  ordered_timers.erase(timer_it);
+/*static*/
+void *cthread_loop::start_loop(void *arg) {
+  cthread_loop *loop = static_cast<cthread_loop *>(arg);
+  /* keep loop alive until worker thread terminates */
+  std::shared_ptr<cthread_loop> self;
+  self.swap(loop->self);
+  loop->run_loop();
+  return NULL;
+}
 
-  if (tid != pthread_self()) {
-    wakeup();
+void cthread_loop::handle_wakeups() {
+  size_t n = 0;
+  {
+    AcquireReadLock lock(tlock);
+    n = wakeups.size();
   }
+  /* wakeups scheduled from within callbacks are handled in next round */
+  for (; n > 0; n--) {
+    if (not running)
+      return;
 
-  return true;
+    cthread *thread = nullptr;
+    {
+      AcquireReadWriteLock lock(tlock);
+      if (wakeups.empty())
+        return;
+      thread = wakeups.front();
+      wakeups.pop_front();
+      thread->wakeup_pending = false;
+      current = thread;
+    }
+    cdispatch_guard guard(*this);
+    uint64_t start = metrics_start();
+    thread->env->handle_wakeup(*thread);
+    metrics_callback(cloop_stats::CALLBACK_WAKEUP, start);
+  }
 }
 
-bool cthread::has_timer(uint32_t timer_id) const {
-  AcquireReadLock lock(tlock);
-  auto timer_it = find_if(ordered_timers.begin(), ordered_timers.end(),
-                          ctimer_find_by_timer_id(timer_id));
-  return (not(timer_it == ordered_timers.end()));
-}
+void cthread_loop::handle_posts() {
+  if (not posted.exchange(false))
+    return;
 
-void cthread::start(const std::string &thread_name) {
-  switch (state) {
-  case STATE_IDLE: {
+  /* cthreads scheduled from within tasks are handled in next round */
+  std::shared_ptr<std::atomic<cthread *>> ref;
+  while (posts.pop(ref)) {
+    posts_round.push_back(std::move(ref));
+  }
 
-    running = true;
-    if (pthread_create(&tid, NULL, &(cthread::start_loop), this) < 0) {
-      throw eSysCall("eSysCall", "pthread_create", __FILE__, __FUNCTION__,
-                     __LINE__);
+  for (size_t n = 0; n < posts_round.size(); n++) {
+    if (not running) {
+      /* keep remaining cthreads for restart */
+      for (; n < posts_round.size(); n++) {
+        posts.push(std::move(posts_round[n]));
+      }
+      posted = true;
+      break;
     }
 
-    if (thread_name.length() && thread_name.length() < 16)
-      pthread_setname_np(tid, thread_name.c_str());
-
-    state = STATE_RUNNING;
+    /* released cthreads leave a cleared handle behind */
+    cthread *thread = posts_round[n]->load();
+    if (nullptr == thread)
+      continue;
+    current = thread;
+    cdispatch_guard guard(*this);
+    if (posts_round[n]->load() != thread)
+      continue;
+
+    thread->post_queued = false;
+    if (thread->state != cthread::STATE_RUNNING) {
+      /* stopped meanwhile, unless restarted start() schedules it again */
+      if (thread->post_pending && thread->schedule_posts())
+        posted = true;
+      continue;
+    }
 
-  } break;
-  default: {};
+    /* tasks posted from now on schedule this cthread again */
+    thread->post_pending = false;
+    std::function<void()> task;
+    unsigned int i = 0;
+    for (; (i < POSTS_PER_ROUND) && thread->tasks.pop(task); i++) {
+      uint64_t start = metrics_start();
+      task();
+      metrics_callback(cloop_stats::CALLBACK_TASK, start);
+    }
+    /* continue in next round */
+    if ((i == POSTS_PER_ROUND) && (not thread->post_pending.exchange(true))) {
+      if (thread->schedule_posts())
+        posted = true;
+    }
   }
+  posts_round.clear();
 }
 
-void cthread::stop() {
-  switch (state) {
-  case STATE_RUNNING: {
-
-    running = false;
-
-    wakeup();
+void cthread_loop::handle_event(int fd, uint32_t event) {
+  std::vector<cthread *> threads;
+  {
+    AcquireReadLock lock(tlock);
+    auto it = fds.find(fd);
+    if (it == fds.end())
+      return;
+    threads.assign(it->second.begin(), it->second.end());
+  }
 
-    /* deletion of thread not initiated within this thread */
-    if (pthread_self() == tid) {
+  for (auto thread : threads) {
+    if (not running)
       return;
-    }
 
-    int rv = pthread_join(tid, NULL);
-    if (rv != 0) {
-      pthread_cancel(tid);
+    {
+      AcquireReadLock lock(tlock);
+      auto it = fds.find(fd);
+      if (it == fds.end())
+        return;
+      if (std::find(it->second.begin(), it->second.end(), thread) ==
+          it->second.end())
+        continue;
+      if (thread->state != cthread::STATE_RUNNING)
+        continue;
+      if (not(thread->fds[fd] & event))
+        continue;
+      current = thread;
+    }
+    cdispatch_guard guard(*this);
+    uint64_t start = metrics_start();
+    if (event == EPOLLIN) {
+      thread->env->handle_read_event(*thread, fd);
+      metrics_callback(cloop_stats::CALLBACK_READ, start);
+    } else {
+      thread->env->handle_write_event(*thread, fd);
+      metrics_callback(cloop_stats::CALLBACK_WRITE, start);
     }
-
-    state = STATE_IDLE;
-
-  } break;
-  default: {};
   }
 }
 
-void cthread::wakeup() {
-  switch (state) {
-  case STATE_RUNNING: {
-    uint64_t c = 1;
-    if (write(event_fd, &c, sizeof(c)) < 0) {
-      switch (errno) {
-      case EAGAIN: {
-        // do nothing
-      } break;
-      case EINTR: {
-        // signal received
-      } break;
-      default: {
-        throw eSysCall("eSysCall", "write to event_fd", __FILE__, __FUNCTION__,
-                       __LINE__);
-      };
+void cthread_loop::handle_completions() {
+  for (auto &c : completions) {
+    cthread *thread = nullptr;
+    bool recv = false;
+    {
+      AcquireReadWriteLock lock(tlock);
+      auto rt = recvs.find(c.fd);
+      auto st = sends.find(c.fd);
+      if ((rt != recvs.end()) && (rt->second.generation == c.generation)) {
+        recv = true;
+        thread = rt->second.thread;
+        if (not c.more)
+          rt->second.armed = false;
+      } else if ((st != sends.end()) &&
+                 (st->second.generation == c.generation)) {
+        thread = st->second.thread;
+        if (st->second.pending > 0)
+          st->second.pending--;
       }
+      if ((nullptr == thread) || (not running) ||
+          (thread->state != cthread::STATE_RUNNING)) {
+        if (c.bid >= 0)
+          ring->recycle_buffer(c.bid);
+        continue;
+      }
+      current = thread;
     }
-  } break;
-  default: {};
+    cdispatch_guard guard(*this);
+    uint64_t start = metrics_start();
+
+    /* buffers exhausted or request cancelled: nothing received */
+    bool rearm = (c.res > 0);
+    if (recv && ((-ENOBUFS == c.res) || (-ECANCELED == c.res))) {
+      rearm = true;
+    } else if (recv && (-EINVAL == c.res) && multishot_recv) {
+      /* multishot receive not supported by kernel */
+      multishot_recv = false;
+      rearm = true;
+    } else {
+      /* a completion must be handed over once only, the buffer is
+       * recycled and the request re-armed in any case */
+      try {
+        if (recv) {
+          thread->env->handle_recv(
+              *thread, c.fd,
+              (c.bid >= 0) ? ring->get_buffer(c.bid) : nullptr, c.res);
+          metrics_callback(cloop_stats::CALLBACK_READ, start);
+        } else {
+          thread->env->handle_send(*thread, c.fd, c.res);
+          metrics_callback(cloop_stats::CALLBACK_WRITE, start);
+        }
+      } catch (std::exception &e) {
+        std::cerr << __FUNCTION__ << ": ERROR, caught exception: " << e.what()
+                  << std::endl;
+      }
+    }
+    if (not recv)
+      continue;
+
+    AcquireReadWriteLock lock(tlock);
+    if (c.bid >= 0)
+      ring->recycle_buffer(c.bid);
+    auto rt = recvs.find(c.fd);
+    if ((rt == recvs.end()) || (rt->second.generation != c.generation))
+      continue;
+    /* end of stream or error, no further requests */
+    if (not rearm)
+      rt->second.enabled = false;
+    if ((not c.more) && rt->second.enabled)
+      ring_arm_recv(c.fd, rt->second);
   }
+  completions.clear();
 }
 
-void *cthread::run_loop() {
+void *cthread_loop::run_loop() {
   retval = 0;
   sigset_t signal_set;
   sigfillset(&signal_set); // ignore all signals
@@ -405,37 +739,95 @@ void *cthread::run_loop() {
       int timeout = 3600000; // in milliseconds: 1hour
 
       {
-        AcquireReadLock lock(tlock);
-        if (not ordered_timers.empty()) {
-          timeout = ordered_timers.begin()->get_relative_timeout();
+        AcquireReadWriteLock lock(tlock);
+        clock.get_time();
+        uint64_t now = timers.now(clock);
+        timers.advance(now);
+        if (timers.next_tick(deadline)) {
+          if (deadline <= now) {
+            timeout = 0;
+          } else if (high_resolution) {
+            arm_timer_fd(deadline);
+          } else if (deadline - now < (uint64_t)timeout) {
+            timeout = deadline - now;
+          }
+        } else {
+          deadline = UINT64_MAX;
+        }
+        /* tasks were posted after the event fd was consumed or completions
+         * were left over by a stopped loop */
+        if (posted || (not completions.empty()))
+          timeout = 0;
+      }
+
+      /* spin for a while after handling events, block when idle */
+      if (busy_poll && active && (timeout != 0)) {
+        rc = spin_events(events, 64, timeout, &signal_set);
+        if ((0 == rc) && completions.empty()) {
+          if (posted)
+            timeout = 0;
+          rc = wait_events(events, 64, timeout, &signal_set);
         }
+      } else {
+        rc = wait_events(events, 64, timeout, &signal_set);
       }
+      active = (rc > 0) || (not completions.empty());
 
-      rc = epoll_pwait(epfd, events, 64, timeout, &signal_set);
+      /* loop iteration starts with return from waiting */
+      uint64_t woken = metrics_start();
+      if (woken && (rc >= 0)) {
+        std::lock_guard<std::mutex> lock(metrics_mutex);
+        metrics.add_events(rc);
+      }
 
       if (not running)
         goto out;
 
+      {
+        AcquireReadWriteLock lock(tlock);
+        clock.get_time();
+        timers.advance(timers.now(clock));
+      }
+
       while (true) {
         /* handle expired timers */
-        ctimer timer;
+        cthread *thread = nullptr;
+        uint32_t timer_id = 0;
+        uint64_t late = 0;
         {
           AcquireReadWriteLock lock(tlock);
-          if (ordered_timers.empty()) {
-            break;
-          }
-          timer = *(ordered_timers.begin());
-          if (not timer.get_tspec().is_expired()) {
+          cthread::ctimer_entry *entry =
+              static_cast<cthread::ctimer_entry *>(timers.pop());
+          if (nullptr == entry) {
             break;
           }
-          ordered_timers.erase(ordered_timers.begin());
+          entry->pending = false;
+          late = lateness(entry->timer.get_tspec());
+          stats.add(late);
+          thread = entry->thread;
+          timer_id = entry->timer.get_timer_id();
+          current = thread;
         } // release lock here
+        cdispatch_guard guard(*this);
         if (not running)
           goto out;
 
-        env->handle_timeout(*this, timer.get_timer_id());
+        active = true;
+        uint64_t start = metrics_start();
+        if (start) {
+          std::lock_guard<std::mutex> lock(metrics_mutex);
+          metrics.add_lateness(late);
+        }
+        thread->env->handle_timeout(*thread, timer_id);
+        metrics_callback(cloop_stats::CALLBACK_TIMEOUT, start);
       }
 
+      if (not running)
+        goto out;
+
+      /* handle posted tasks */
+      handle_posts();
+
       if (not running)
         goto out;
 
@@ -448,25 +840,36 @@ void *cthread::run_loop() {
 
           if (events[i].data.fd == event_fd) {
 
-            if (not running) {
-              return &retval;
+            if (events[i].events & EPOLLIN) {
+              uint64_t c;
+              int rcode = read(event_fd, &c, sizeof(c));
+              (void)rcode;
+              handle_wakeups();
             }
 
+          } else if (events[i].data.fd == timer_fd) {
+
             if (events[i].events & EPOLLIN) {
               uint64_t c;
-              int rcode = read(event_fd, &c, sizeof(c));
+              int rcode = read(timer_fd, &c, sizeof(c));
               (void)rcode;
-              env->handle_wakeup(*this);
+              AcquireReadWriteLock lock(tlock);
+              armed = UINT64_MAX;
             }
 
           } else {
             if (events[i].events & EPOLLIN)
-              env->handle_read_event(*this, events[i].data.fd);
+              handle_event(events[i].data.fd, EPOLLIN);
             if (events[i].events & EPOLLOUT)
-              env->handle_write_event(*this, events[i].data.fd);
+              handle_event(events[i].data.fd, EPOLLOUT);
           }
         }
-      } else if (rc < 0) {
+      }
+
+      /* handle receive and send completions */
+      handle_completions();
+
+      if (rc < 0) {
 
         switch (errno) {
         case EINTR: {
@@ -479,6 +882,14 @@ void *cthread::run_loop() {
         }
       }
 
+      if (woken) {
+        uint64_t now = metrics_start();
+        if (now >= woken) {
+          std::lock_guard<std::mutex> lock(metrics_mutex);
+          metrics.add_iteration(now - woken);
+        }
+      }
+
     } catch (eThreadNotFound &e) {
       std::cerr << __FUNCTION__
                 << ": ERROR, caught eThreadNotFound: " << e.what() << std::endl;
@@ -497,3 +908,367 @@ out:
 
   return &retval;
 }
+
+void cthread::initialize() {
+  if (pool == nullptr) {
+    reactor = -1;
+    loop = std::make_shared<cthread_loop>();
+  } else {
+    if (reactor < 0)
+      reactor = pool->select_reactor();
+    loop = pool->get_loop(reactor);
+  }
+  loop->num_threads++;
+}
+
+void cthread::release() {
+  clear_timers();
+
+  stop();
+
+  {
+    AcquireReadWriteLock lock(loop->tlock);
+    detach();
+  }
+
+  /* a handle still queued must not reach this cthread anymore */
+  post_ref->store(nullptr);
+  loop->wait_for_dispatch(this);
+
+  loop->num_threads--;
+}
+
+void cthread::detach() {
+  if (loop->ring) {
+    std::vector<int> ring_fds;
+    for (auto &it : loop->recvs) {
+      if (it.second.thread == this)
+        ring_fds.push_back(it.first);
+    }
+    for (auto &it : loop->sends) {
+      if (it.second.thread == this)
+        ring_fds.push_back(it.first);
+    }
+    for (auto fd : ring_fds) {
+      loop->ring_cancel_io(this, fd);
+    }
+  }
+
+  for (auto it : fds) {
+    auto jt = loop->fds.find(it.first);
+    if (jt == loop->fds.end())
+      continue;
+    jt->second.remove(this);
+    if (jt->second.empty())
+      loop->fds.erase(jt);
+    loop->update_fd(it.first, false);
+  }
+  fds.clear();
+
+  if (wakeup_pending) {
+    loop->wakeups.remove(this);
+    wakeup_pending = false;
+  }
+}
+
+void cthread::add_fd(int fd, bool exception, bool edge_triggered) {
+  AcquireReadWriteLock lock(loop->tlock);
+  if (fds.find(fd) != fds.end())
+    return;
+
+  VLOG(3) << __FUNCTION__ << " fd=" << fd
+          << " edge_triggered=" << edge_triggered << " thread=" << this;
+
+  fds[fd] = edge_triggered ? EPOLLET : 0;
+  loop->fds[fd].push_back(this);
+  loop->update_fd(fd, exception);
+}
+
+void cthread::drop_fd(int fd, bool exception) {
+  AcquireReadWriteLock lock(loop->tlock);
+  if (loop->ring)
+    loop->ring_cancel_io(this, fd);
+  if (fds.find(fd) == fds.end())
+    return;
+
+  VLOG(3) << __FUNCTION__ << " fd=" << fd << " thread=" << this;
+
+  fds.erase(fd);
+  auto it = loop->fds.find(fd);
+  if (it != loop->fds.end()) {
+    it->second.remove(this);
+    if (it->second.empty())
+      loop->fds.erase(it);
+  }
+  loop->update_fd(fd, exception);
+}
+
+void cthread::add_read_fd(int fd, bool exception, bool edge_triggered) {
+  add_fd(fd, exception, edge_triggered);
+
+  AcquireReadWriteLock lock(loop->tlock);
+
+  fds[fd] |= EPOLLIN;
+
+  loop->update_fd(fd, exception);
+}
+
+void cthread::drop_read_fd(int fd, bool exception) {
+  AcquireReadWriteLock lock(loop->tlock);
+  if (fds.find(fd) == fds.end())
+    return;
+
+  fds[fd] &= ~EPOLLIN;
+
+  VLOG(3) << __FUNCTION__ << " fd=" << fd << " thread=" << this;
+
+  loop->update_fd(fd, exception);
+}
+
+void cthread::add_write_fd(int fd, bool exception, bool edge_triggered) {
+  add_fd(fd, exception, edge_triggered);
+
+  AcquireReadWriteLock lock(loop->tlock);
+
+  fds[fd] |= EPOLLOUT;
+
+  loop->update_fd(fd, exception);
+}
+
+void cthread::drop_write_fd(int fd, bool exception) {
+  AcquireReadWriteLock lock(loop->tlock);
+  if (fds.find(fd) == fds.end())
+    return;
+
+  fds[fd] &= ~EPOLLOUT;
+
+  VLOG(3) << __FUNCTION__ << " fd=" << fd << " thread=" << this;
+
+  loop->update_fd(fd, exception);
+}
+
+bool cthread::add_recv_fd(int fd) {
+  AcquireReadWriteLock lock(loop->tlock);
+  if (not loop->ring)
+    return false;
+
+  /* buffers are shared by all receive requests of this loop */
+  if ((not loop->ring->has_buffers()) &&
+      (not loop->ring->add_buffers(cthread_loop::RECV_BUFFERS,
+                                   cthread_loop::RECV_BUFFER_SIZE))) {
+    VLOG(1) << __FUNCTION__ << " io_uring provided buffers not available";
+    return false;
+  }
+
+  auto it = loop->recvs.find(fd);
+  if ((it != loop->recvs.end()) && (it->second.thread != this))
+    return false;
+
+  VLOG(3) << __FUNCTION__ << " fd=" << fd << " thread=" << this;
+
+  cthread_loop::crecv &recv = loop->recvs[fd];
+  recv.thread = this;
+  recv.enabled = true;
+  /* a cancelled request is re-armed on its final completion */
+  if (not recv.armed) {
+    loop->ring_arm_recv(fd, recv);
+    if (loop->get_thread_id() != pthread_self())
+      loop->notify();
+  }
+  return true;
+}
+
+void cthread::drop_recv_fd(int fd) {
+  AcquireReadWriteLock lock(loop->tlock);
+  auto it = loop->recvs.find(fd);
+  if ((it == loop->recvs.end()) || (it->second.thread != this) ||
+      (not it->second.enabled))
+    return;
+
+  VLOG(3) << __FUNCTION__ << " fd=" << fd << " thread=" << this;
+
+  it->second.enabled = false;
+  if (it->second.armed) {
+    loop->ring->cancel(((uint64_t)it->second.generation << 32) |
+                       (uint32_t)fd);
+    if (loop->get_thread_id() != pthread_self())
+      loop->notify();
+  }
+}
+
+bool cthread::send(int fd, const struct iovec *segs, unsigned int num) {
+  AcquireReadWriteLock lock(loop->tlock);
+  if ((not loop->ring) || (0 == num) ||
+      (num > loop->ring->get_max_segs()))
+    return false;
+
+  auto it = loop->sends.find(fd);
+  if ((it != loop->sends.end()) && (it->second.thread != this))
+    return false;
+
+  cthread_loop::csend &send = loop->sends[fd];
+  if (nullptr == send.thread) {
+    send.thread = this;
+    send.generation = ++loop->generation;
+  }
+  loop->ring->send(fd, segs, num,
+                   ((uint64_t)send.generation << 32) | (uint32_t)fd);
+  send.pending += num;
+  if (loop->get_thread_id() != pthread_self())
+    loop->notify();
+  return true;
+}
+
+unsigned int cthread::get_max_send_segs() const {
+  return loop->ring ? loop->ring->get_max_segs() : 0;
+}
+
+void cthread::clear_timers() {
+  AcquireReadWriteLock lock(loop->tlock);
+  for (auto &it : timers) {
+    loop->timers.del(&(it.second));
+  }
+  timers.clear();
+};
+
+bool cthread::add_timer(uint32_t timer_id, const ctimespec &tspec) {
+  bool do_wakeup = false;
+  {
+    AcquireReadWriteLock lock(loop->tlock);
+
+    ctimer_entry &entry = timers[timer_id];
+    entry.thread = this;
+    entry.timer = ctimer(timer_id, tspec);
+    entry.pending = true;
+
+    if (state == STATE_RUNNING) {
+      uint64_t tick = loop->timers.deadline(tspec);
+      loop->timers.add(&entry, tick);
+      if (tick < loop->deadline)
+        do_wakeup = true;
+    }
+  }
+
+  if ((do_wakeup) && (loop->get_thread_id() != pthread_self())) {
+    loop->notify();
+  }
+
+  return true;
+}
+
+const ctimer &cthread::get_timer(uint32_t timer_id) const {
+  AcquireReadLock lock(loop->tlock);
+  auto timer_it = timers.find(timer_id);
+  if ((timer_it == timers.end()) || (not timer_it->second.pending)) {
+    throw eThreadNotFound("cthread::get_timer() timer_id not found");
+  }
+  return timer_it->second.timer;
+}
+
+bool cthread::drop_timer(uint32_t timer_id) {
+  AcquireReadWriteLock lock(loop->tlock);
+  auto timer_it = timers.find(timer_id);
+  if ((timer_it == timers.end()) || (not timer_it->second.pending)) {
+    return false;
+  }
+
+  /* keep entry for re-arming this timer without reallocation */
+  timer_it->second.pending = false;
+  loop->timers.del(&(timer_it->second));
+
+  return true;
+}
+
+bool cthread::has_timer(uint32_t timer_id) const {
+  AcquireReadLock lock(loop->tlock);
+  auto timer_it = timers.find(timer_id);
+  return ((timer_it != timers.end()) && timer_it->second.pending);
+}
+
+void cthread::start(const std::string &thread_name) {
+  switch (state) {
+  case STATE_IDLE: {
+
+    {
+      AcquireReadWriteLock lock(loop->tlock);
+      state = STATE_RUNNING;
+      for (auto &it : timers) {
+        if (it.second.pending)
+          loop->timers.add(
+              &(it.second), loop->timers.deadline(it.second.timer.get_tspec()));
+      }
+      /* tasks posted while stopped */
+      if (post_pending && schedule_posts())
+        loop->posted = true;
+    }
+
+    if (pool == nullptr) {
+      loop->start(thread_name);
+    } else {
+      loop->notify();
+    }
+
+  } break;
+  default: {};
+  }
+}
+
+void cthread::stop() {
+  switch (state) {
+  case STATE_RUNNING: {
+
+    {
+      AcquireReadWriteLock lock(loop->tlock);
+      for (auto &it : timers) {
+        loop->timers.del(&(it.second));
+      }
+      state = STATE_IDLE;
+      if (pool != nullptr) {
+        detach();
+      } else {
+        if (wakeup_pending) {
+          loop->wakeups.remove(this);
+          wakeup_pending = false;
+        }
+      }
+    }
+
+    if (pool == nullptr) {
+      loop->stop();
+    } else {
+      loop->wait_for_dispatch(this);
+    }
+
+  } break;
+  default: {};
+  }
+}
+
+void cthread::post(std::function<void()> task) {
+  tasks.push(std::move(task));
+  /* worker thread has not started handling earlier tasks yet */
+  if (post_pending.exchange(true))
+    return;
+  if (schedule_posts())
+    loop->signal();
+}
+
+bool cthread::schedule_posts() {
+  if ((state != STATE_RUNNING) || post_queued.exchange(true))
+    return false;
+  loop->posts.push(post_ref);
+  return true;
+}
+
+void cthread::wakeup() {
+  {
+    AcquireReadWriteLock lock(loop->tlock);
+    if (state != STATE_RUNNING)
+      return;
+    if (not wakeup_pending) {
+      wakeup_pending = true;
+      loop->wakeups.push_back(this);
+    }
+  }
+  loop->notify();
+}
@@ -27,11 +27,23 @@
 #include <cassert>
 #include <inttypes.h>
 #include <iostream>
+#include <condition_variable>
+#include <functional>
 #include <list>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
+#include <unordered_map>
+#include <vector>
 
+#include "rofl/common/cio_uring.hpp"
+#include "rofl/common/cloop_stats.hpp"
+#include "rofl/common/cmpsc_queue.hpp"
+#include "rofl/common/cthread_affinity.hpp"
 #include "rofl/common/ctimer.hpp"
+#include "rofl/common/ctimer_stats.hpp"
+#include "rofl/common/ctimer_wheel.hpp"
 #include "rofl/common/exception.hpp"
 #include "rofl/common/locking.hpp"
 
@@ -47,10 +59,21 @@ public:
   eThreadNotFound(const std::string &__arg) : eThreadBase(__arg){};
 };
 
-class cthread; // forward declaration
+class cthread;      // forward declaration
+class cthread_loop; // forward declaration
+class cthread_pool; // forward declaration
+
+/**
+ * @brief	I/O engines for waiting on file descriptor events
+ */
+enum cthread_engine_t {
+  ENGINE_EPOLL = 0,    // epoll_pwait() and epoll_ctl()
+  ENGINE_IO_URING = 1, // io_uring poll, recv and send, falls back to epoll
+};
 
 class cthread_env {
   friend class cthread;
+  friend class cthread_loop;
 
 public:
   cthread_env() {}
@@ -61,9 +84,465 @@ protected:
   virtual void handle_timeout(cthread &thread, uint32_t timer_id) = 0;
   virtual void handle_read_event(cthread &thread, int fd) = 0;
   virtual void handle_write_event(cthread &thread, int fd) = 0;
+
+  /**
+   * @brief	Data received on fd registered via cthread::add_recv_fd()
+   *
+   * len 0: end of stream, len < 0: negative errno. buf is valid during
+   * this call only.
+   */
+  virtual void handle_recv(cthread &thread, int fd, const uint8_t *buf,
+                           ssize_t len){};
+
+  /**
+   * @brief	Segment queued via cthread::send() completed
+   *
+   * res: number of bytes sent or negative errno
+   */
+  virtual void handle_send(cthread &thread, int fd, ssize_t res){};
+};
+
+/**
+ * @brief	Event loop driving one or more cthread instances
+ *
+ * A cthread_loop owns a worker thread, an epoll and an event fd and
+ * dispatches timers, wakeups and file descriptor events to all cthread
+ * instances bound to it. A standalone cthread owns a private loop, cthread
+ * instances created on a cthread_pool share the loops of the pool.
+ */
+class cthread_loop : public std::enable_shared_from_this<cthread_loop> {
+  friend class cthread;
+  friend class cthread_pool;
+
+public:
+  /**
+   *
+   */
+  ~cthread_loop();
+
+  /**
+   * @brief	cthread_loop constructor
+   *
+   * @param engine requested I/O engine, ENGINE_IO_URING falls back to
+   * ENGINE_EPOLL when io_uring is not supported by build or kernel
+   */
+  cthread_loop(cthread_engine_t engine = ENGINE_EPOLL);
+
+public:
+  /**
+   * @brief	Returns pthread_t of worker thread
+   */
+  pthread_t get_thread_id() const { return tid; };
+
+  /**
+   * @brief	Returns cpu the worker thread is pinned to, -1: not pinned
+   */
+  int get_cpu() const { return cpu; };
+
+  /**
+   * @brief	Returns NUMA node of the worker thread's cpu, -1: unknown
+   */
+  int get_numa_node() const { return numa_node; };
+
+  /**
+   * @brief	Returns I/O engine in use
+   */
+  cthread_engine_t get_engine() const { return engine; };
+
+  /**
+   * @brief	Returns number of cthread instances bound to this loop
+   */
+  unsigned int get_num_threads() const { return num_threads; };
+
+  /**
+   * @brief	Starts worker thread
+   *
+   * @param thread_name name of worker thread
+   * @param cpu pin worker thread to this cpu, -1: not pinned
+   */
+  void start(const std::string &thread_name = std::string(""), int cpu = -1);
+
+  /**
+   * @brief	Stops worker thread
+   *
+   * Waits for termination of the worker thread via pthread_join(), unless
+   * called from within the worker thread itself.
+   */
+  void stop();
+
+  /**
+   * @brief	Wake up worker thread via event fd
+   */
+  void notify();
+
+  /**
+   * @brief	Wake up worker thread for handling posted tasks
+   *
+   * Writes to the event fd only once until the worker thread has started
+   * handling posted tasks.
+   */
+  void signal();
+
+  /**
+   * @brief	Enables or disables high resolution timers
+   *
+   * In high resolution mode, timers are stored with microsecond ticks and
+   * the worker thread sleeps on a timerfd instead of the millisecond
+   * timeout of epoll_pwait().
+   */
+  void set_high_resolution(bool enable);
+
+  /**
+   * @brief	Returns true when high resolution timers are enabled
+   */
+  bool get_high_resolution() const { return high_resolution; };
+
+  /**
+   * @brief	Returns lateness statistics of expired timers
+   */
+  ctimer_stats get_timer_stats() const;
+
+  /**
+   * @brief	Sets busy poll budget in microseconds, 0: disabled
+   *
+   * After handling events, the worker thread polls for further events
+   * without blocking until the budget is exhausted. An idle worker thread
+   * blocks immediately, so idle cost is bounded by one budget per event.
+   */
+  void set_busy_poll(unsigned int usecs);
+
+  /**
+   * @brief	Returns busy poll budget in microseconds
+   */
+  unsigned int get_busy_poll() const { return busy_poll; };
+
+  /**
+   * @brief	Returns number of busy poll periods started
+   */
+  uint64_t get_num_busy_polls() const { return num_busy_polls; };
+
+  /**
+   * @brief	Returns number of busy poll periods ended by an event
+   */
+  uint64_t get_num_busy_poll_hits() const { return num_busy_poll_hits; };
+
+  /**
+   * @brief	Resets lateness statistics of expired timers
+   */
+  void clear_timer_stats();
+
+  /**
+   * @brief	Enables or disables recording of event loop metrics
+   *
+   * Disabled by default, recording costs two clock reads per callback.
+   */
+  void set_instrumentation(bool enable) { instrumented = enable; };
+
+  /**
+   * @brief	Returns true when event loop metrics are recorded
+   */
+  bool get_instrumentation() const { return instrumented; };
+
+  /**
+   * @brief	Returns event loop metrics
+   */
+  cloop_stats get_loop_stats() const;
+
+  /**
+   * @brief	Resets event loop metrics
+   */
+  void clear_loop_stats();
+
+private:
+  /**
+   * @brief	Waits until the worker thread has left any callback of thread
+   *
+   * Returns immediately when called from within the worker thread.
+   */
+  void wait_for_dispatch(const cthread *thread);
+
+  /**
+   * @brief	Updates epoll registration of fd for all owning cthreads
+   *
+   * Must be called with loop lock held.
+   */
+  void update_fd(int fd, bool exception);
+
+  /**
+   * @brief	Poll request of io_uring engine for a file descriptor
+   */
+  struct cpoll {
+    cpoll() : events(0), generation(0), armed(false){};
+    uint32_t events;     // epoll events including EPOLLET
+    uint32_t generation; // identifies current request in completions
+    bool armed;          // true: request is pending in kernel
+  };
+
+  /**
+   * @brief	Updates io_uring poll request for fd, events 0: remove
+   *
+   * Must be called with loop lock held.
+   */
+  void ring_update_fd(int fd, uint32_t events);
+
+  /**
+   * @brief	Queues a new io_uring poll request for fd
+   *
+   * Must be called with loop lock held.
+   */
+  void ring_arm_poll(int fd, cpoll &poll);
+
+  /**
+   * @brief	io_uring receive request of a cthread on a stream socket
+   */
+  struct crecv {
+    crecv() : thread(nullptr), generation(0), armed(false), enabled(false){};
+    cthread *thread;     // cthread receiving completions
+    uint32_t generation; // identifies current request in completions
+    bool armed;          // true: request is pending in kernel
+    bool enabled;        // false: request is cancelled or not re-armed
+  };
+
+  /**
+   * @brief	io_uring send requests of a cthread on a stream socket
+   */
+  struct csend {
+    csend() : thread(nullptr), generation(0), pending(0){};
+    cthread *thread;      // cthread receiving completions
+    uint32_t generation;  // identifies requests in completions
+    unsigned int pending; // number of segments in flight
+  };
+
+  /**
+   * @brief	Completion of a receive or send request
+   */
+  struct ccompletion {
+    int fd;
+    uint32_t generation;
+    int32_t res;
+    int bid; // provided buffer or -1
+    bool more;
+  };
+
+  /**
+   * @brief	Queues a new io_uring receive request for fd
+   *
+   * Must be called with loop lock held.
+   */
+  void ring_arm_recv(int fd, crecv &recv);
+
+  /**
+   * @brief	Cancels receive and send requests of thread on fd
+   *
+   * No further completions are handed over. Must be called with loop lock
+   * held.
+   */
+  void ring_cancel_io(const cthread *thread, int fd);
+
+  /**
+   * @brief	Calls recv or send handler for completions of last wait
+   */
+  void handle_completions();
+
+  /**
+   * @brief	Polls for file descriptor events without blocking
+   *
+   * Returns after an event, after posting of tasks or when the busy poll
+   * budget or timeout (in milliseconds) is exhausted.
+   */
+  int spin_events(struct epoll_event *events, int maxevents, int timeout,
+                  const sigset_t *sigmask);
+
+  /**
+   * @brief	Waits for file descriptor events like epoll_pwait()
+   */
+  int wait_events(struct epoll_event *events, int maxevents, int timeout,
+                  const sigset_t *sigmask);
+
+  /**
+   * @brief	Arms timerfd for the given tick, unless already armed
+   *
+   * Must be called with loop lock held.
+   */
+  void arm_timer_fd(uint64_t tick);
+
+  /**
+   * @brief	Returns nsecs elapsed between tspec and last clock update
+   */
+  uint64_t lateness(const ctimespec &tspec) const;
+
+  /**
+   * @brief	Returns monotonic time in nsecs when instrumented, 0 otherwise
+   */
+  uint64_t metrics_start() const;
+
+  /**
+   * @brief	Records wall time of a callback started at metrics_start()
+   */
+  void metrics_callback(cloop_stats::callback_t cb, uint64_t start);
+
+  /**
+   * @brief	Calls handle_wakeup() for all pending wakeup requests
+   */
+  void handle_wakeups();
+
+  /**
+   * @brief	Executes tasks posted to cthread instances
+   */
+  void handle_posts();
+
+  /**
+   * @brief	Calls read or write handler of all cthreads observing fd
+   */
+  void handle_event(int fd, uint32_t event);
+
+  /**
+   * @brief	Static function for starting worker thread
+   */
+  static void *start_loop(void *arg);
+
+  /**
+   * @brief	Main loop for worker thread
+   */
+  void *run_loop();
+
+  /**
+   * @brief	Marks end of a callback for cthread instance set in current
+   */
+  class cdispatch_guard {
+  public:
+    cdispatch_guard(cthread_loop &loop) : loop(loop){};
+    ~cdispatch_guard();
+
+  private:
+    cthread_loop &loop;
+  };
+
+private:
+  // tick length in nsecs for high resolution timers
+  static const uint64_t RESOLUTION_HIGH = 1000;
+
+  // maximum number of posted tasks executed per cthread and round
+  static const unsigned int POSTS_PER_ROUND = 256;
+
+  // provided buffers shared by all io_uring receive requests of a loop
+  static const unsigned int RECV_BUFFERS = 128;
+  static const size_t RECV_BUFFER_SIZE = 16384;
+
+  // true: continue to run worker thread
+  std::atomic_bool running;
+
+  int event_fd;  // event fd for worker thread
+  pthread_t tid; // pthread_t for worker thread
+  int retval;    // worker thread return value
+  int epfd;      // worker thread epoll fd
+  int timer_fd;  // timerfd for high resolution timers or -1
+  int cpu;       // cpu the worker thread is pinned to or -1
+  int numa_node; // NUMA node of cpu or -1
+
+  // I/O engine in use
+  cthread_engine_t engine;
+
+  // io_uring instance for ENGINE_IO_URING
+  std::unique_ptr<cio_uring> ring;
+
+  // io_uring poll requests indexed by fd
+  std::map<int, cpoll> polls;
+
+  // false: kernel does not support multishot poll requests
+  bool multishot;
+
+  // io_uring receive requests indexed by fd
+  std::map<int, crecv> recvs;
+
+  // io_uring send requests indexed by fd
+  std::map<int, csend> sends;
+
+  // false: kernel does not support multishot receive requests
+  bool multishot_recv;
+
+  // receive and send completions of last wait, worker thread only
+  std::vector<ccompletion> completions;
+
+  // last generation assigned to a poll, receive or send request
+  uint32_t generation;
+
+  // worker thread's reference on this loop while running
+  std::shared_ptr<cthread_loop> self;
+
+  crwlock tlock; // loop lock, protects also bound cthread instances
+
+  // number of cthread instances bound to this loop
+  std::atomic_uint num_threads;
+
+  // owners of registered file descriptors
+  std::map<int, std::list<cthread *>> fds;
+
+  // monotonic clock, updated once per loop iteration
+  ctimespec clock;
+
+  // timers of all bound cthread instances
+  ctimer_wheel timers;
+
+  // tick the worker thread is sleeping until
+  uint64_t deadline;
+
+  // true: timers use microsecond ticks and timer_fd
+  std::atomic_bool high_resolution;
+
+  // tick timer_fd is armed for
+  uint64_t armed;
+
+  // lateness of expired timers
+  ctimer_stats stats;
+
+  // true: record event loop metrics
+  std::atomic_bool instrumented;
+
+  // event loop metrics, written by worker thread only
+  mutable std::mutex metrics_mutex;
+  cloop_stats metrics;
+
+  // busy poll budget in microseconds, 0: disabled
+  std::atomic_uint busy_poll;
+
+  // true: last loop iteration handled events
+  bool active;
+
+  // busy poll periods started and ended by an event
+  std::atomic<uint64_t> num_busy_polls;
+  std::atomic<uint64_t> num_busy_poll_hits;
+
+  // cthread instances with pending wakeup requests
+  std::list<cthread *> wakeups;
+
+  // handles of cthread instances with posted tasks, pushed without locking
+  cmpsc_queue<std::shared_ptr<std::atomic<cthread *>>> posts;
+
+  // handles taken from posts in current round, worker thread only
+  std::vector<std::shared_ptr<std::atomic<cthread *>>> posts_round;
+
+  // true: event fd was written for posted tasks
+  std::atomic_bool posted;
+
+  // cthread instance whose callback is currently executed
+  std::atomic<const cthread *> current;
+
+  // signals end of a callback
+  std::mutex dispatch_mutex;
+  std::condition_variable dispatch_cond;
+
+  enum loop_state_t {
+    STATE_IDLE = 0,
+    STATE_RUNNING = 1,
+  };
+
+  enum loop_state_t state;
 };
 
 class cthread {
+  friend class cthread_loop;
+
 public:
   /**
    *
@@ -77,21 +556,93 @@ public:
   };
 
   /**
+   * @brief	cthread constructor
    *
+   * @param env cthread environment receiving all events
+   * @param pool when set, bind to a reactor thread of this pool instead of
+   * running a dedicated worker thread
+   * @param reactor index of reactor thread within pool, -1: select least
+   * loaded reactor thread
    */
-  cthread(cthread_env *env) : env(env), state(STATE_IDLE) { initialize(); };
+  cthread(cthread_env *env, cthread_pool *pool = nullptr, int reactor = -1)
+      : env(env), pool(pool), reactor(reactor), wakeup_pending(false),
+        post_pending(false),
+        post_ref(std::make_shared<std::atomic<cthread *>>(this)),
+        post_queued(false), state(STATE_IDLE) {
+    initialize();
+  };
 
 public:
   /**
    *
    */
-  pthread_t get_thread_id() const { return tid; };
+  pthread_t get_thread_id() const { return loop->get_thread_id(); };
+
+  /**
+   * @brief	Returns NUMA node of the event loop's cpu, -1: unknown
+   *
+   * Buffers used by this cthread's callbacks should be bound to this node.
+   */
+  int get_numa_node() const { return loop->get_numa_node(); };
+
+  /**
+   * @brief	Returns cthread_pool this cthread is bound to or nullptr
+   */
+  cthread_pool *get_pool() const { return pool; };
+
+  /**
+   * @brief	Returns index of reactor thread within pool or -1
+   */
+  int get_reactor() const { return reactor; };
+
+  /**
+   * @brief	Enables or disables high resolution timers
+   *
+   * Affects all cthread instances bound to the same event loop.
+   */
+  void set_high_resolution(bool enable) {
+    loop->set_high_resolution(enable);
+  };
+
+  /**
+   * @brief	Returns lateness statistics of the event loop's timers
+   */
+  ctimer_stats get_timer_stats() const { return loop->get_timer_stats(); };
+
+  /**
+   * @brief	Enables or disables recording of event loop metrics
+   *
+   * Affects all cthread instances bound to the same event loop.
+   */
+  void set_instrumentation(bool enable) { loop->set_instrumentation(enable); };
+
+  /**
+   * @brief	Returns metrics of the event loop
+   */
+  cloop_stats get_loop_stats() const { return loop->get_loop_stats(); };
+
+  /**
+   * @brief	Sets busy poll budget in microseconds, 0: disabled
+   *
+   * Affects all cthread instances bound to the same event loop.
+   */
+  void set_busy_poll(unsigned int usecs) { loop->set_busy_poll(usecs); };
 
   /**
    * @brief	Wake up RX thread via rx pipe
    */
   void wakeup();
 
+  /**
+   * @brief	Executes task within this cthread's worker thread
+   *
+   * May be called from any thread without locking. Tasks are executed in
+   * order of posting before any file descriptor events are handled, a burst
+   * of posted tasks wakes up the worker thread only once. Tasks still
+   * pending are discarded when this cthread is destroyed.
+   */
+  void post(std::function<void()> task);
+
   /**
    * @brief	Register file descriptor
    */
@@ -122,6 +673,37 @@ public:
    */
   void drop_write_fd(int fd, bool exception = true);
 
+  /**
+   * @brief	Receive from stream socket via io_uring
+   *
+   * Received data is handed over to handle_recv(). Returns false when the
+   * event loop does not support io_uring reception, use add_read_fd()
+   * instead. drop_fd() cancels reception.
+   */
+  bool add_recv_fd(int fd);
+
+  /**
+   * @brief	Pause reception from stream socket
+   *
+   * Data received until the request is cancelled is still handed over to
+   * handle_recv().
+   */
+  void drop_recv_fd(int fd);
+
+  /**
+   * @brief	Send segments in order on stream socket via io_uring
+   *
+   * Completion of each segment is handed over to handle_send(), segments
+   * must stay valid until then. Returns false when the event loop does not
+   * use io_uring, drop_fd() cancels pending segments.
+   */
+  bool send(int fd, const struct iovec *segs, unsigned int num);
+
+  /**
+   * @brief	Returns maximum number of segments per send(), 0: no io_uring
+   */
+  unsigned int get_max_send_segs() const;
+
 public:
   /**
    *
@@ -154,6 +736,8 @@ public:
    *
    * Sets run flag run_rx_thread to true and calls
    * syscall pthread_create() for starting worker thread.
+   * A cthread bound to a cthread_pool starts receiving events
+   * from its reactor thread.
    */
   void start(const std::string &thread_name = std::string(""));
 
@@ -165,19 +749,24 @@ public:
    * pthread_join().
    * If joining the thread fails, syscall pthread_cancel() destroys ultimately
    * the thread.
+   * A cthread bound to a cthread_pool deregisters all file descriptors,
+   * timers and wakeups from its reactor thread and waits for termination
+   * of a callback currently executed, the reactor thread keeps running.
    */
   void stop();
 
 public:
   friend std::ostream &operator<<(std::ostream &os, const cthread &thread) {
     os << "cthread, tid: " << &thread << std::endl;
-    if (not thread.ordered_timers.empty()) {
-      os << "next timeout: "
-         << thread.ordered_timers.begin()->get_relative_timeout() << std::endl;
-      for (auto tspec : thread.ordered_timers) {
-        os << "timer: " << tspec << std::endl;
-      }
-    } else {
+    bool empty = true;
+    for (auto &it : thread.timers) {
+      if (not it.second.pending)
+        continue;
+      os << "timer: " << it.second.timer
+         << " timeout: " << it.second.timer.get_relative_timeout() << std::endl;
+      empty = false;
+    }
+    if (empty) {
       os << "timers list is EMPTY" << std::endl;
     }
     return os;
@@ -185,65 +774,86 @@ public:
 
 private:
   /**
-   * @brief	Initialize data structures for running TX and RX threads
+   * @brief	Binds this cthread to its event loop
    *
-   * Opens an epoll socket and registers file read descriptor for wake up
-   * pipes for TX and RX thread. Does not prepare the Radius socket itself.
-   * See radius_open() for adding the Radius socket to the running event
-   * loop. Starts TX and RX loop.
+   * Creates a private event loop for a standalone cthread or selects a
+   * reactor thread from the cthread_pool.
    */
   void initialize();
 
   /**
    * @brief	Release data structures allocated for worker thread
    *
-   * Closes Radius socket and TX and RX pipe file descriptors. Stops TX and RX
-   * threads.
+   * Stops worker thread and deregisters all file descriptors and timers
+   * from the event loop.
    */
   void release();
 
   /**
-   * @brief	Static function for starting RX thread for this cradsock
-   * instance
+   * @brief	Deregisters all file descriptors, timers and pending wakeups
+   *
+   * Must be called with loop lock held.
    */
-  static void *start_loop(void *arg) {
-    return static_cast<cthread *>(arg)->run_loop();
-  };
+  void detach();
 
   /**
-   * @brief	Main loop for RX thread
+   * @brief	Queues this cthread in loop's list of posted tasks
+   *
+   * May be called without loop lock. Returns true when the worker thread
+   * must be signaled.
    */
-  void *run_loop();
+  bool schedule_posts();
 
 private:
-  // true: continue to run worker thread
-  std::atomic_bool running;
-
   // thread environment
   cthread_env *env;
 
-  // thread related variables
-  static const int PIPE_READ_FD;
-  static const int PIPE_WRITE_FD;
-  int event_fd;  // event fd for worker thread
-  pthread_t tid; // pthread_t for worker thread
-  // bool				run_thread;	// true: continue to run
-  // worker
-  // thread
-  int retval; // worker thread return value
-  int epfd;   // worker thread epoll fd
+  // reactor pool or nullptr for a standalone cthread
+  cthread_pool *pool;
+
+  // index of reactor thread within pool
+  int reactor;
+
+  // event loop driving this cthread
+  std::shared_ptr<cthread_loop> loop;
+
+  /**
+   * @brief	Timer of this cthread stored in loop's timer wheel
+   */
+  class ctimer_entry : public ctimer_node {
+  public:
+    ctimer_entry() : thread(nullptr), pending(false){};
+    cthread *thread;
+    ctimer timer;
+    bool pending; // true: timer is armed
+  };
+
+  std::map<int, uint32_t> fds; // set of registered file descriptors
+
+  // timers indexed by timer id
+  std::unordered_map<uint32_t, ctimer_entry> timers;
+
+  // true: cthread is queued in loop's wakeup list
+  bool wakeup_pending;
+
+  // tasks posted to this cthread
+  cmpsc_queue<std::function<void()>> tasks;
+
+  // true: tasks were posted since worker thread started handling them
+  std::atomic_bool post_pending;
 
-  crwlock tlock; // thread lock
+  // handle queued in loop's list of posted tasks, cleared on release()
+  std::shared_ptr<std::atomic<cthread *>> post_ref;
 
-  std::map<int, uint32_t> fds;     // set of registered file descriptors
-  std::set<ctimer> ordered_timers; // ordered set of timers
+  // true: post_ref is queued in loop's list of posted tasks
+  std::atomic_bool post_queued;
 
   enum thread_state_t {
     STATE_IDLE = 0,
     STATE_RUNNING = 1,
   };
 
-  enum thread_state_t state;
+  std::atomic<thread_state_t> state;
 };
 
 }; // end of namespace rofl
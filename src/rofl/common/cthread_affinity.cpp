@@ -0,0 +1,124 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/*
+ * cthread_affinity.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "cthread_affinity.hpp"
+
+#include <dirent.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <sstream>
+
+using namespace rofl;
+
+cthread_affinity &cthread_affinity::set_cpus(const std::string &cpulist) {
+  std::vector<unsigned int> cpuset;
+  std::istringstream ss(cpulist);
+  std::string range;
+  while (std::getline(ss, range, ',')) {
+    if (range.empty())
+      continue;
+    char *end = nullptr;
+    unsigned long first = strtoul(range.c_str(), &end, 10);
+    unsigned long last = first;
+    if (end == range.c_str())
+      throw eAffinityInval("cthread_affinity::set_cpus() invalid cpulist");
+    if ('-' == *end) {
+      const char *start = end + 1;
+      last = strtoul(start, &end, 10);
+      if (end == start)
+        throw eAffinityInval("cthread_affinity::set_cpus() invalid cpulist");
+    }
+    if ((*end != '\0') || (last < first) || (last >= CPU_SETSIZE))
+      throw eAffinityInval("cthread_affinity::set_cpus() invalid cpulist");
+    for (unsigned long cpu = first; cpu <= last; cpu++)
+      cpuset.push_back(cpu);
+  }
+  cpus = cpuset;
+  return *this;
+}
+
+int cthread_affinity::get_cpu(unsigned int index) const {
+  if (AFFINITY_NONE == policy)
+    return -1;
+
+  if (not cpus.empty())
+    return cpus[index % cpus.size()];
+
+  /* all cpus available to this process */
+  cpu_set_t cpuset;
+  CPU_ZERO(&cpuset);
+  if (sched_getaffinity(0, sizeof(cpuset), &cpuset) < 0)
+    return -1;
+  unsigned int count = CPU_COUNT(&cpuset);
+  if (0 == count)
+    return -1;
+  index %= count;
+  for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+    if (CPU_ISSET(cpu, &cpuset) && (0 == index--))
+      return cpu;
+  }
+  return -1;
+}
+
+/*static*/
+int cthread_affinity::get_numa_node(int cpu) {
+  if (cpu < 0)
+    return -1;
+
+  /* sysfs links each cpu to its node, e.g. .../cpu3/node0 */
+  std::stringstream path;
+  path << "/sys/devices/system/cpu/cpu" << cpu;
+  DIR *dir = opendir(path.str().c_str());
+  if (nullptr == dir)
+    return -1;
+  int node = -1;
+  struct dirent *entry;
+  while ((entry = readdir(dir)) != nullptr) {
+    std::string name(entry->d_name);
+    if ((name.length() > 4) && (name.compare(0, 4, "node") == 0)) {
+      node = atoi(name.c_str() + 4);
+      break;
+    }
+  }
+  closedir(dir);
+  return node;
+}
+
+/*static*/
+void cthread_affinity::bind_memory(void *addr, size_t len, int node) {
+#ifdef __NR_mbind
+  /* see linux/mempolicy.h */
+  static const int MPOL_PREFERRED_ = 1;
+  static const unsigned int MPOL_MF_MOVE_ = (1 << 1);
+  static const unsigned int NODES = 1024;
+
+  if ((node < 0) || ((unsigned int)node >= NODES) || (nullptr == addr))
+    return;
+
+  long pagesize = sysconf(_SC_PAGESIZE);
+  if (pagesize <= 0)
+    return;
+  uintptr_t start = ((uintptr_t)addr + pagesize - 1) & ~(pagesize - 1);
+  uintptr_t end = ((uintptr_t)addr + len) & ~(pagesize - 1);
+  if (end <= start)
+    return;
+
+  unsigned long nodemask[NODES / (8 * sizeof(unsigned long))] = {0};
+  nodemask[node / (8 * sizeof(unsigned long))] |=
+      (1UL << (node % (8 * sizeof(unsigned long))));
+
+  syscall(__NR_mbind, start, end - start, MPOL_PREFERRED_, nodemask,
+          (unsigned long)NODES, MPOL_MF_MOVE_);
+#endif
+}
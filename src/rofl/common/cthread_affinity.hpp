@@ -0,0 +1,147 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/*
+ * cthread_affinity.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef SRC_ROFL_COMMON_CTHREAD_AFFINITY_HPP_
+#define SRC_ROFL_COMMON_CTHREAD_AFFINITY_HPP_
+
+#include <stddef.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "rofl/common/exception.hpp"
+
+namespace rofl {
+
+class eAffinityInval : public exception {
+public:
+  eAffinityInval(const std::string &__arg) : exception(__arg){};
+};
+
+/**
+ * @brief	Placement policies for reactor threads
+ */
+enum cthread_affinity_policy_t {
+  // no pinning, the kernel scheduler places reactor threads
+  AFFINITY_NONE = 0,
+  // reactor thread i is pinned to cpu i modulo size of cpuset
+  AFFINITY_ROUND_ROBIN = 1,
+  // like AFFINITY_ROUND_ROBIN, accepted connections are served by the
+  // reactor thread pinned to the cpu handling the socket's RX queue
+  AFFINITY_RX_QUEUE = 2,
+};
+
+/**
+ * @brief	CPU affinity and NUMA placement of reactor threads
+ *
+ * A cthread_affinity instance is handed to cthread_pool (or crofbase) and
+ * applied to all reactor threads created there. Buffers owned by cthreads
+ * on a pinned reactor thread are allocated on the reactor's NUMA node.
+ */
+class cthread_affinity {
+public:
+  /**
+   * @brief	cthread_affinity constructor
+   *
+   * @param policy placement policy
+   * @param cpus cpuset, empty: all cpus available to this process
+   */
+  cthread_affinity(
+      cthread_affinity_policy_t policy = AFFINITY_NONE,
+      const std::vector<unsigned int> &cpus = std::vector<unsigned int>())
+      : policy(policy), cpus(cpus){};
+
+  /**
+   * @brief	cthread_affinity constructor
+   *
+   * @param policy placement policy
+   * @param cpulist cpuset in cpulist format, e.g., "2-5,8"
+   */
+  cthread_affinity(cthread_affinity_policy_t policy,
+                   const std::string &cpulist)
+      : policy(policy) {
+    set_cpus(cpulist);
+  };
+
+public:
+  /**
+   * @brief	Returns placement policy
+   */
+  cthread_affinity_policy_t get_policy() const { return policy; };
+
+  /**
+   * @brief	Sets placement policy
+   */
+  cthread_affinity &set_policy(cthread_affinity_policy_t policy) {
+    this->policy = policy;
+    return *this;
+  };
+
+  /**
+   * @brief	Returns cpuset, empty: all cpus available to this process
+   */
+  const std::vector<unsigned int> &get_cpus() const { return cpus; };
+
+  /**
+   * @brief	Sets cpuset
+   */
+  cthread_affinity &set_cpus(const std::vector<unsigned int> &cpus) {
+    this->cpus = cpus;
+    return *this;
+  };
+
+  /**
+   * @brief	Sets cpuset from cpulist format, e.g., "2-5,8"
+   *
+   * Throws eAffinityInval for malformed cpulists.
+   */
+  cthread_affinity &set_cpus(const std::string &cpulist);
+
+  /**
+   * @brief	Returns cpu for reactor thread with given index, -1: not pinned
+   */
+  int get_cpu(unsigned int index) const;
+
+public:
+  /**
+   * @brief	Returns NUMA node of cpu, -1: unknown
+   */
+  static int get_numa_node(int cpu);
+
+  /**
+   * @brief	Binds memory range to NUMA node, ignored when node is -1
+   *
+   * Only pages entirely covered by the range are bound, pages already
+   * faulted in are migrated. Failures are ignored, e.g., on kernels
+   * without NUMA support.
+   */
+  static void bind_memory(void *addr, size_t len, int node);
+
+public:
+  friend std::ostream &operator<<(std::ostream &os,
+                                  const cthread_affinity &affinity) {
+    os << "<cthread_affinity policy: " << affinity.policy << " cpus: ";
+    for (auto cpu : affinity.cpus)
+      os << cpu << " ";
+    os << ">";
+    return os;
+  };
+
+private:
+  cthread_affinity_policy_t policy;
+
+  // cpus used for pinning reactor threads
+  std::vector<unsigned int> cpus;
+};
+
+}; // end of namespace rofl
+
+#endif /* SRC_ROFL_COMMON_CTHREAD_AFFINITY_HPP_ */
@@ -0,0 +1,130 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/*
+ * cthread_pool.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "cthread_pool.hpp"
+#include <sstream>
+
+using namespace rofl;
+
+cthread_pool::cthread_pool(unsigned int num_threads, const std::string &name,
+                           cthread_engine_t engine,
+                           const cthread_affinity &affinity)
+    : next(0), engine(engine), affinity(affinity) {
+  if (num_threads == 0) {
+    long num_cores = sysconf(_SC_NPROCESSORS_ONLN);
+    num_threads = (num_cores > 0) ? num_cores : 1;
+  }
+
+  for (unsigned int i = 0; i < num_threads; i++) {
+    std::stringstream ss;
+    ss << name << "_" << i;
+    std::shared_ptr<cthread_loop> loop = std::make_shared<cthread_loop>(engine);
+    /* io_uring falls back to epoll on all reactors alike */
+    this->engine = loop->get_engine();
+    loop->start(ss.str().substr(0, 15), affinity.get_cpu(i));
+    loops.push_back(loop);
+  }
+}
+
+cthread_pool::~cthread_pool() {
+  for (auto loop : loops) {
+    try { // don't throw in destructor
+      loop->stop();
+    } catch (std::exception &e) {
+      std::cerr << __FUNCTION__ << "(): failed with " << e.what() << std::endl;
+    }
+  }
+  /* cthread instances still bound to a reactor keep its loop alive */
+  loops.clear();
+}
+
+int cthread_pool::select_reactor() {
+  unsigned int start = next++;
+  int reactor = start % loops.size();
+  for (unsigned int i = 1; i < loops.size(); i++) {
+    unsigned int j = (start + i) % loops.size();
+    if (loops[j]->get_num_threads() < loops[reactor]->get_num_threads())
+      reactor = j;
+  }
+  return reactor;
+}
+
+int cthread_pool::select_reactor(int sd) {
+  if (AFFINITY_RX_QUEUE != affinity.get_policy())
+    return -1;
+
+#ifdef SO_INCOMING_CPU
+  int cpu = -1;
+  socklen_t optlen = sizeof(cpu);
+  if ((getsockopt(sd, SOL_SOCKET, SO_INCOMING_CPU, &cpu, &optlen) < 0) ||
+      (cpu < 0))
+    return -1;
+
+  /* reactor on the same cpu, otherwise on the same node */
+  int node = cthread_affinity::get_numa_node(cpu);
+  int reactor = -1;
+  bool same_cpu = false;
+  for (unsigned int i = 0; i < loops.size(); i++) {
+    bool match = (loops[i]->get_cpu() == cpu);
+    if ((not match) && ((node < 0) || (loops[i]->get_numa_node() != node)))
+      continue;
+    if ((reactor < 0) || (match && (not same_cpu)) ||
+        ((match == same_cpu) &&
+         (loops[i]->get_num_threads() < loops[reactor]->get_num_threads()))) {
+      reactor = i;
+      same_cpu = match;
+    }
+  }
+  return reactor;
+#else
+  return -1;
+#endif
+}
+
+void cthread_pool::set_high_resolution(bool enable) {
+  for (auto loop : loops) {
+    loop->set_high_resolution(enable);
+  }
+}
+
+ctimer_stats cthread_pool::get_timer_stats() const {
+  ctimer_stats stats;
+  for (auto loop : loops) {
+    stats += loop->get_timer_stats();
+  }
+  return stats;
+}
+
+void cthread_pool::set_instrumentation(bool enable) {
+  for (auto loop : loops) {
+    loop->set_instrumentation(enable);
+  }
+}
+
+cloop_stats cthread_pool::get_loop_stats() const {
+  cloop_stats stats;
+  for (auto loop : loops) {
+    stats += loop->get_loop_stats();
+  }
+  return stats;
+}
+
+void cthread_pool::clear_loop_stats() {
+  for (auto loop : loops) {
+    loop->clear_loop_stats();
+  }
+}
+
+std::shared_ptr<cthread_loop> cthread_pool::get_loop(int reactor) const {
+  if ((reactor < 0) || ((unsigned int)reactor >= loops.size())) {
+    throw eThreadNotFound("cthread_pool::get_loop() reactor not found");
+  }
+  return loops[reactor];
+}
@@ -0,0 +1,221 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/*
+ * cthread_pool.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef SRC_ROFL_COMMON_CTHREAD_POOL_HPP_
+#define SRC_ROFL_COMMON_CTHREAD_POOL_HPP_
+
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "rofl/common/cthread.hpp"
+
+namespace rofl {
+
+/**
+ * @brief	Pool of reactor threads shared by cthread instances
+ *
+ * Each reactor thread runs a single event loop. A cthread created on a
+ * cthread_pool is pinned to one reactor thread for its entire lifetime, so
+ * all callbacks of this cthread are executed sequentially by the same
+ * thread.
+ */
+class cthread_pool {
+  friend class cthread;
+
+public:
+  /**
+   * @brief	cthread_pool destructor
+   *
+   * Stops all reactor threads.
+   */
+  ~cthread_pool();
+
+  /**
+   * @brief	cthread_pool constructor
+   *
+   * @param num_threads number of reactor threads, 0: number of online cores
+   * @param name prefix for reactor thread names
+   * @param engine requested I/O engine for all reactor threads
+   * @param affinity cpu placement of reactor threads
+   */
+  cthread_pool(unsigned int num_threads = 0,
+               const std::string &name = std::string("rofl_reactor"),
+               cthread_engine_t engine = ENGINE_EPOLL,
+               const cthread_affinity &affinity = cthread_affinity());
+
+private:
+  cthread_pool(const cthread_pool &pool);
+
+  cthread_pool &operator=(const cthread_pool &pool);
+
+public:
+  /**
+   * @brief	Returns number of reactor threads
+   */
+  unsigned int size() const { return loops.size(); };
+
+  /**
+   * @brief	Returns I/O engine used by reactor threads
+   */
+  cthread_engine_t get_engine() const { return engine; };
+
+  /**
+   * @brief	Returns cpu placement of reactor threads
+   */
+  const cthread_affinity &get_affinity() const { return affinity; };
+
+  /**
+   * @brief	Returns index of reactor thread serving least cthreads
+   */
+  int select_reactor();
+
+  /**
+   * @brief	Returns index of reactor thread for a connected socket
+   *
+   * For policy AFFINITY_RX_QUEUE, selects the least loaded reactor thread
+   * pinned to the cpu handling the socket's RX queue (SO_INCOMING_CPU),
+   * falling back to a reactor thread on the same NUMA node.
+   *
+   * @return reactor index or -1: no preference, see select_reactor()
+   */
+  int select_reactor(int sd);
+
+  /**
+   * @brief	Returns cpu of reactor thread, -1: not pinned
+   */
+  int get_cpu(int reactor) const { return get_loop(reactor)->get_cpu(); };
+
+  /**
+   * @brief	Returns NUMA node of reactor thread, -1: unknown
+   */
+  int get_numa_node(int reactor) const {
+    return get_loop(reactor)->get_numa_node();
+  };
+
+  /**
+   * @brief	Returns number of cthreads bound to reactor thread
+   */
+  unsigned int get_num_threads(int reactor) const {
+    return get_loop(reactor)->get_num_threads();
+  };
+
+  /**
+   * @brief	Returns pthread_t of reactor thread
+   */
+  pthread_t get_thread_id(int reactor) const {
+    return get_loop(reactor)->get_thread_id();
+  };
+
+  /**
+   * @brief	Enables or disables high resolution timers on all reactors
+   */
+  void set_high_resolution(bool enable);
+
+  /**
+   * @brief	Returns lateness statistics of timers on reactor thread
+   */
+  ctimer_stats get_timer_stats(int reactor) const {
+    return get_loop(reactor)->get_timer_stats();
+  };
+
+  /**
+   * @brief	Returns lateness statistics of timers on all reactor threads
+   */
+  ctimer_stats get_timer_stats() const;
+
+  /**
+   * @brief	Enables or disables event loop metrics on all reactor threads
+   */
+  void set_instrumentation(bool enable);
+
+  /**
+   * @brief	Returns event loop metrics of reactor thread
+   */
+  cloop_stats get_loop_stats(int reactor) const {
+    return get_loop(reactor)->get_loop_stats();
+  };
+
+  /**
+   * @brief	Returns event loop metrics of all reactor threads
+   */
+  cloop_stats get_loop_stats() const;
+
+  /**
+   * @brief	Resets event loop metrics on all reactor threads
+   */
+  void clear_loop_stats();
+
+  /**
+   * @brief	Sets busy poll budget of reactor thread in microseconds
+   *
+   * Busy polling can be enabled for a subset of reactor threads, cthreads
+   * are pinned to a reactor thread via their constructor.
+   */
+  void set_busy_poll(int reactor, unsigned int usecs) {
+    get_loop(reactor)->set_busy_poll(usecs);
+  };
+
+  /**
+   * @brief	Returns busy poll budget of reactor thread in microseconds
+   */
+  unsigned int get_busy_poll(int reactor) const {
+    return get_loop(reactor)->get_busy_poll();
+  };
+
+  /**
+   * @brief	Returns number of busy poll periods started on reactor thread
+   */
+  uint64_t get_num_busy_polls(int reactor) const {
+    return get_loop(reactor)->get_num_busy_polls();
+  };
+
+  /**
+   * @brief	Returns number of busy poll periods ended by an event
+   */
+  uint64_t get_num_busy_poll_hits(int reactor) const {
+    return get_loop(reactor)->get_num_busy_poll_hits();
+  };
+
+public:
+  friend std::ostream &operator<<(std::ostream &os, const cthread_pool &pool) {
+    os << "cthread_pool, #reactors: " << pool.size() << std::endl;
+    for (unsigned int i = 0; i < pool.size(); i++) {
+      os << "reactor: " << i
+         << " #threads: " << pool.get_num_threads(i) << std::endl;
+    }
+    return os;
+  };
+
+private:
+  /**
+   * @brief	Returns event loop of reactor thread
+   */
+  std::shared_ptr<cthread_loop> get_loop(int reactor) const;
+
+private:
+  // event loops of reactor threads
+  std::vector<std::shared_ptr<cthread_loop>> loops;
+
+  // start index for selecting next reactor thread
+  std::atomic_uint next;
+
+  // I/O engine used by reactor threads
+  cthread_engine_t engine;
+
+  // cpu placement of reactor threads
+  cthread_affinity affinity;
+};
+
+}; // end of namespace rofl
+
+#endif /* SRC_ROFL_COMMON_CTHREAD_POOL_HPP_ */
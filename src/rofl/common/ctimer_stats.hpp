@@ -0,0 +1,129 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/*
+ * ctimer_stats.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef SRC_ROFL_COMMON_CTIMER_STATS_HPP_
+#define SRC_ROFL_COMMON_CTIMER_STATS_HPP_
+
+#include <inttypes.h>
+#include <string.h>
+
+#include <iostream>
+
+namespace rofl {
+
+/**
+ * @brief	Lateness of expired timers
+ *
+ * Lateness is the time between a timer's expiration time and the wakeup
+ * of the worker thread handling it. Bucket i of the histogram counts
+ * timers with a lateness below 2^i microseconds, the last bucket counts
+ * all remaining timers.
+ */
+class ctimer_stats {
+public:
+  static const unsigned int BUCKETS = 16;
+
+public:
+  /**
+   *
+   */
+  ctimer_stats() { clear(); };
+
+public:
+  /**
+   * @brief	Resets all counters
+   */
+  void clear() {
+    num_expired = 0;
+    sum_lateness = 0;
+    max_lateness = 0;
+    memset(buckets, 0, sizeof(buckets));
+  };
+
+  /**
+   * @brief	Records expiration of a timer with lateness given in nsecs
+   */
+  void add(uint64_t lateness) {
+    num_expired++;
+    sum_lateness += lateness;
+    if (lateness > max_lateness)
+      max_lateness = lateness;
+    uint64_t usecs = lateness / 1000;
+    unsigned int bucket = (0 == usecs) ? 0 : (64 - __builtin_clzll(usecs));
+    buckets[(bucket < BUCKETS) ? bucket : BUCKETS - 1]++;
+  };
+
+  /**
+   * @brief	Merges counters from another instance
+   */
+  ctimer_stats &operator+=(const ctimer_stats &stats) {
+    num_expired += stats.num_expired;
+    sum_lateness += stats.sum_lateness;
+    if (stats.max_lateness > max_lateness)
+      max_lateness = stats.max_lateness;
+    for (unsigned int i = 0; i < BUCKETS; i++)
+      buckets[i] += stats.buckets[i];
+    return *this;
+  };
+
+public:
+  /**
+   * @brief	Returns number of expired timers
+   */
+  uint64_t get_num_expired() const { return num_expired; };
+
+  /**
+   * @brief	Returns maximum lateness in nsecs
+   */
+  uint64_t get_max_lateness() const { return max_lateness; };
+
+  /**
+   * @brief	Returns average lateness in nsecs
+   */
+  uint64_t get_avg_lateness() const {
+    return (num_expired) ? sum_lateness / num_expired : 0;
+  };
+
+  /**
+   * @brief	Returns number of timers in histogram bucket
+   */
+  uint64_t get_bucket(unsigned int bucket) const {
+    return (bucket < BUCKETS) ? buckets[bucket] : 0;
+  };
+
+public:
+  friend std::ostream &operator<<(std::ostream &os,
+                                  const ctimer_stats &stats) {
+    os << "<ctimer_stats expired: " << stats.num_expired
+       << " avg: " << stats.get_avg_lateness() << "ns"
+       << " max: " << stats.max_lateness << "ns >" << std::endl;
+    for (unsigned int i = 0; i < BUCKETS; i++) {
+      if (0 == stats.buckets[i])
+        continue;
+      if (i < BUCKETS - 1) {
+        os << "  < " << ((uint64_t)1 << i) << "us: ";
+      } else {
+        os << "  >= " << ((uint64_t)1 << (i - 1)) << "us: ";
+      }
+      os << stats.buckets[i] << std::endl;
+    }
+    return os;
+  };
+
+private:
+  uint64_t num_expired;
+  uint64_t sum_lateness; // in nsecs
+  uint64_t max_lateness; // in nsecs
+  uint64_t buckets[BUCKETS];
+};
+
+}; // end of namespace rofl
+
+#endif /* SRC_ROFL_COMMON_CTIMER_STATS_HPP_ */
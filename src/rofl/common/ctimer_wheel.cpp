@@ -0,0 +1,226 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/*
+ * ctimer_wheel.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "ctimer_wheel.hpp"
+#include <string.h>
+
+using namespace rofl;
+
+ctimer_wheel::ctimer_wheel(uint64_t tick, uint64_t resolution)
+    : tick(tick), resolution(resolution), count(0) {
+  memset(slots, 0, sizeof(slots));
+  memset(bitmap, 0, sizeof(bitmap));
+  memset(&expired, 0, sizeof(expired));
+  memset(&overflow, 0, sizeof(overflow));
+}
+
+void ctimer_wheel::set_resolution(uint64_t res) {
+  if ((0 == res) || (res == resolution))
+    return;
+
+  /* collect all timers on a single list */
+  struct clist all;
+  memset(&all, 0, sizeof(all));
+  for (unsigned int level = 0; level < LEVELS; level++) {
+    for (unsigned int slot = 0; slot < SLOTS; slot++) {
+      collect(slots[level][slot], all);
+    }
+  }
+  collect(expired, all);
+  collect(overflow, all);
+
+  tick = (tick * resolution) / res;
+  while (all.head) {
+    ctimer_node *node = all.head;
+    all.head = node->next;
+    node->tick = (node->tick * resolution + res - 1) / res;
+    insert(node);
+  }
+  resolution = res;
+}
+
+void ctimer_wheel::add(ctimer_node *node, uint64_t tick) {
+  if (node->is_linked()) {
+    unlink(node);
+  } else {
+    count++;
+  }
+  node->tick = tick;
+  insert(node);
+}
+
+void ctimer_wheel::del(ctimer_node *node) {
+  if (not node->is_linked())
+    return;
+  unlink(node);
+  count--;
+}
+
+void ctimer_wheel::insert(ctimer_node *node) {
+  if (node->tick <= tick) {
+    link(node, expired, ctimer_node::LEVEL_EXPIRED, 0);
+    return;
+  }
+
+  /* level is given by the most significant byte differing from tick */
+  unsigned int level = (63 - __builtin_clzll(node->tick ^ tick)) / SLOT_BITS;
+  if (level >= LEVELS) {
+    link(node, overflow, ctimer_node::LEVEL_OVERFLOW, 0);
+    return;
+  }
+
+  unsigned int slot = (node->tick >> (level * SLOT_BITS)) & (SLOTS - 1);
+  link(node, slots[level][slot], level, slot);
+  bitmap[level][slot / 64] |= ((uint64_t)1 << (slot % 64));
+}
+
+void ctimer_wheel::link(ctimer_node *node, struct clist &list, uint8_t level,
+                        uint8_t slot) {
+  node->level = level;
+  node->slot = slot;
+  node->next = nullptr;
+  node->prev = list.tail;
+  if (list.tail) {
+    list.tail->next = node;
+  } else {
+    list.head = node;
+  }
+  list.tail = node;
+}
+
+void ctimer_wheel::unlink(ctimer_node *node) {
+  struct clist *list = nullptr;
+  switch (node->level) {
+  case ctimer_node::LEVEL_EXPIRED: {
+    list = &expired;
+  } break;
+  case ctimer_node::LEVEL_OVERFLOW: {
+    list = &overflow;
+  } break;
+  default: { list = &slots[node->level][node->slot]; };
+  }
+
+  if (node->prev) {
+    node->prev->next = node->next;
+  } else {
+    list->head = node->next;
+  }
+  if (node->next) {
+    node->next->prev = node->prev;
+  } else {
+    list->tail = node->prev;
+  }
+
+  if ((node->level < LEVELS) && (nullptr == list->head)) {
+    bitmap[node->level][node->slot / 64] &=
+        ~((uint64_t)1 << (node->slot % 64));
+  }
+
+  node->prev = node->next = nullptr;
+  node->level = ctimer_node::LEVEL_NONE;
+}
+
+void ctimer_wheel::collect(struct clist &list, struct clist &all) {
+  while (list.head) {
+    ctimer_node *node = list.head;
+    unlink(node);
+    link(node, all, ctimer_node::LEVEL_NONE, 0);
+  }
+}
+
+void ctimer_wheel::cascade(struct clist &list) {
+  ctimer_node *node = list.head;
+  while (node) {
+    ctimer_node *next = node->next;
+    unlink(node);
+    insert(node);
+    node = next;
+  }
+}
+
+unsigned int ctimer_wheel::next_slot(unsigned int level,
+                                     unsigned int slot) const {
+  for (unsigned int i = slot + 1; i < SLOTS;) {
+    uint64_t word = bitmap[level][i / 64] >> (i % 64);
+    if (word) {
+      return i + __builtin_ctzll(word);
+    }
+    i = (i / 64 + 1) * 64;
+  }
+  return SLOTS;
+}
+
+bool ctimer_wheel::next_tick(uint64_t &next) const {
+  if (expired.head) {
+    next = tick;
+    return true;
+  }
+  return next_event(next);
+}
+
+bool ctimer_wheel::next_event(uint64_t &next) const {
+  bool found = false;
+  for (unsigned int level = 0; level < LEVELS; level++) {
+    unsigned int shift = level * SLOT_BITS;
+    unsigned int slot = next_slot(level, (tick >> shift) & (SLOTS - 1));
+    if (slot == SLOTS)
+      continue;
+    uint64_t t = ((tick >> (shift + SLOT_BITS)) << (shift + SLOT_BITS)) +
+                 ((uint64_t)slot << shift);
+    if ((not found) || (t < next)) {
+      next = t;
+      found = true;
+    }
+  }
+
+  if (overflow.head) {
+    uint64_t t = ((tick >> (LEVELS * SLOT_BITS)) + 1) << (LEVELS * SLOT_BITS);
+    if ((not found) || (t < next)) {
+      next = t;
+      found = true;
+    }
+  }
+
+  return found;
+}
+
+void ctimer_wheel::advance(uint64_t now) {
+  uint64_t next = 0;
+  /* jump directly from one tick with pending work to the next one */
+  while ((now > tick) && next_event(next) && (next <= now)) {
+    tick = next;
+
+    if (0 == (tick & (((uint64_t)1 << (LEVELS * SLOT_BITS)) - 1))) {
+      cascade(overflow);
+    }
+
+    for (unsigned int level = LEVELS - 1; level > 0; level--) {
+      unsigned int shift = level * SLOT_BITS;
+      if (0 == (tick & (((uint64_t)1 << shift) - 1))) {
+        cascade(slots[level][(tick >> shift) & (SLOTS - 1)]);
+      }
+    }
+
+    cascade(slots[0][tick & (SLOTS - 1)]);
+  }
+
+  if (now > tick) {
+    tick = now;
+  }
+}
+
+ctimer_node *ctimer_wheel::pop() {
+  ctimer_node *node = expired.head;
+  if (nullptr == node)
+    return nullptr;
+  unlink(node);
+  count--;
+  return node;
+}
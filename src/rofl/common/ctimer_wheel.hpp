@@ -0,0 +1,261 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/*
+ * ctimer_wheel.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef SRC_ROFL_COMMON_CTIMER_WHEEL_HPP_
+#define SRC_ROFL_COMMON_CTIMER_WHEEL_HPP_
+
+#include <inttypes.h>
+#include <stddef.h>
+
+#include "rofl/common/ctimespec.hpp"
+
+namespace rofl {
+
+class ctimer_wheel; // forward declaration
+
+/**
+ * @brief	Intrusive list node for timers stored in a ctimer_wheel
+ */
+class ctimer_node {
+  friend class ctimer_wheel;
+
+public:
+  /**
+   *
+   */
+  ~ctimer_node(){};
+
+  /**
+   *
+   */
+  ctimer_node()
+      : tick(0), prev(nullptr), next(nullptr), level(LEVEL_NONE), slot(0){};
+
+private:
+  ctimer_node(const ctimer_node &node);
+
+  ctimer_node &operator=(const ctimer_node &node);
+
+public:
+  /**
+   * @brief	Returns true when this node is linked into a ctimer_wheel
+   */
+  bool is_linked() const { return (LEVEL_NONE != level); };
+
+  /**
+   * @brief	Returns expiration tick
+   */
+  uint64_t get_tick() const { return tick; };
+
+private:
+  enum node_level_t {
+    LEVEL_EXPIRED = 4,
+    LEVEL_OVERFLOW = 5,
+    LEVEL_NONE = 6,
+  };
+
+  uint64_t tick;
+  ctimer_node *prev;
+  ctimer_node *next;
+  uint8_t level;
+  uint8_t slot;
+};
+
+/**
+ * @brief	Hierarchical timing wheel
+ *
+ * A tick lasts one millisecond by default, see set_resolution() for
+ * smaller ticks. Four levels of 256 slots each cover 2^32 ticks, timers
+ * beyond this range
+ * are kept on an overflow list. Adding, re-arming and removing a timer are
+ * O(1). Advancing the wheel cascades timers down to lower levels and
+ * moves expired timers to a list of expired timers.
+ */
+class ctimer_wheel {
+public:
+  /**
+   *
+   */
+  ~ctimer_wheel(){};
+
+  /**
+   *
+   */
+  ctimer_wheel(uint64_t tick = 0, uint64_t resolution = RESOLUTION_DEFAULT);
+
+private:
+  ctimer_wheel(const ctimer_wheel &wheel);
+
+  ctimer_wheel &operator=(const ctimer_wheel &wheel);
+
+public:
+  // default tick length in nanoseconds
+  static const uint64_t RESOLUTION_DEFAULT = 1000000;
+
+  /**
+   * @brief	Converts an absolute time into a tick (rounded up)
+   */
+  uint64_t deadline(const ctimespec &tspec) const {
+    return (nsecs(tspec) + resolution - 1) / resolution;
+  };
+
+  /**
+   * @brief	Converts an absolute time into a tick (rounded down)
+   */
+  uint64_t now(const ctimespec &tspec) const {
+    return nsecs(tspec) / resolution;
+  };
+
+  /**
+   * @brief	Converts a tick into nanoseconds
+   */
+  uint64_t to_nsecs(uint64_t tick) const { return tick * resolution; };
+
+  /**
+   * @brief	Returns tick length in nanoseconds
+   */
+  uint64_t get_resolution() const { return resolution; };
+
+  /**
+   * @brief	Changes tick length and converts all stored timers
+   *
+   * Expiration ticks are rounded up to the new tick length.
+   */
+  void set_resolution(uint64_t resolution);
+
+public:
+  /**
+   * @brief	Returns current tick of this wheel
+   */
+  uint64_t get_tick() const { return tick; };
+
+  /**
+   * @brief	Returns number of timers stored in this wheel
+   */
+  size_t size() const { return count; };
+
+  /**
+   * @brief	Returns true when no timers are stored in this wheel
+   */
+  bool empty() const { return (0 == count); };
+
+  /**
+   * @brief	Adds or re-arms a timer
+   */
+  void add(ctimer_node *node, uint64_t tick);
+
+  /**
+   * @brief	Removes a timer
+   */
+  void del(ctimer_node *node);
+
+  /**
+   * @brief	Returns earliest tick this wheel must be advanced to
+   *
+   * The tick returned is a lower bound for the next expiration, when
+   * advancing the wheel to this tick cascades timers from higher levels.
+   *
+   * @return false when no timers are stored in this wheel
+   */
+  bool next_tick(uint64_t &tick) const;
+
+  /**
+   * @brief	Advances this wheel and collects expired timers
+   */
+  void advance(uint64_t tick);
+
+  /**
+   * @brief	Removes and returns next expired timer or nullptr
+   */
+  ctimer_node *pop();
+
+private:
+  static const unsigned int LEVELS = 4;
+  static const unsigned int SLOT_BITS = 8;
+  static const unsigned int SLOTS = (1 << SLOT_BITS);
+  static const unsigned int WORDS = SLOTS / 64;
+
+  struct clist {
+    ctimer_node *head;
+    ctimer_node *tail;
+  };
+
+  /**
+   * @brief	Converts an absolute time into nanoseconds
+   */
+  static uint64_t nsecs(const ctimespec &tspec) {
+    const struct timespec &ts = tspec.get_tspec();
+    if (ts.tv_sec < 0)
+      return 0;
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+  };
+
+  /**
+   * @brief	Inserts node according to its tick relative to current tick
+   */
+  void insert(ctimer_node *node);
+
+  /**
+   * @brief	Appends node to list
+   */
+  void link(ctimer_node *node, struct clist &list, uint8_t level,
+            uint8_t slot);
+
+  /**
+   * @brief	Removes node from its list
+   */
+  void unlink(ctimer_node *node);
+
+  /**
+   * @brief	Re-inserts all nodes stored on list
+   */
+  void cascade(struct clist &list);
+
+  /**
+   * @brief	Moves all nodes from list to list all
+   */
+  void collect(struct clist &list, struct clist &all);
+
+  /**
+   * @brief	Returns next tick with pending cascades or expirations
+   */
+  bool next_event(uint64_t &tick) const;
+
+  /**
+   * @brief	Returns first slot with index > slot on level or SLOTS
+   */
+  unsigned int next_slot(unsigned int level, unsigned int slot) const;
+
+private:
+  // current tick
+  uint64_t tick;
+
+  // tick length in nanoseconds
+  uint64_t resolution;
+
+  // number of timers
+  size_t count;
+
+  // slots per level
+  struct clist slots[LEVELS][SLOTS];
+
+  // bitmap of non-empty slots per level
+  uint64_t bitmap[LEVELS][WORDS];
+
+  // expired timers
+  struct clist expired;
+
+  // timers beyond range of highest level
+  struct clist overflow;
+};
+
+}; // end of namespace rofl
+
+#endif /* SRC_ROFL_COMMON_CTIMER_WHEEL_HPP_ */
@@ -287,7 +287,6 @@ private:
   static const long CC_TIMER_ONE_SECOND_S = 1;
   static const long CC_TIMER_ONE_SECOND_NS = 1000000000;
 
-  crwlock tlock;
   cclockid clk_id;
   struct timespec tspec;
 };
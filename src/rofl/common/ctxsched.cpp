@@ -0,0 +1,84 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/*
+ * ctxsched.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "ctxsched.hpp"
+
+#include <algorithm>
+
+using namespace rofl;
+
+/*static*/ const size_t ctxsched_drr::QUANTUM_DEFAULT;
+
+ctxsched_drr::ctxsched_drr(unsigned int num_classes, size_t quantum)
+    : classes(num_classes), current(0), credited(false) {
+  for (auto &c : classes) {
+    c.quantum = quantum;
+  }
+}
+
+int ctxsched_drr::select(std::deque<crofqueue> &txqueues) {
+  unsigned int num_classes = std::min(classes.size(), txqueues.size());
+
+  /* strict priority classes first */
+  for (unsigned int txclass = 0; txclass < num_classes; txclass++) {
+    if (classes[txclass].strict && (txqueues[txclass].front_bytes() > 0)) {
+      return txclass;
+    }
+  }
+
+  while (current < num_classes) {
+    cclass &c = classes[current];
+    size_t len = c.strict ? 0 : txqueues[current].front_bytes();
+
+    /* an idle class does not save credit for later rounds */
+    if (0 == len) {
+      c.deficit = 0;
+      current++;
+      credited = false;
+      continue;
+    }
+
+    if (not credited) {
+      c.deficit += c.quantum;
+      credited = true;
+    }
+
+    if (len <= c.deficit) {
+      return current;
+    }
+
+    /* next message does not fit, keep deficit for next round */
+    current++;
+    credited = false;
+  }
+
+  /* end of round */
+  current = 0;
+  credited = false;
+  return -1;
+}
+
+void ctxsched_drr::charge(unsigned int txclass, size_t len) {
+  if ((txclass >= classes.size()) || classes[txclass].strict) {
+    return;
+  }
+  cclass &c = classes[txclass];
+  c.deficit = (len < c.deficit) ? c.deficit - len : 0;
+}
+
+void ctxsched_drr::set_class(unsigned int txclass, size_t quantum,
+                             bool strict) {
+  if (txclass >= classes.size()) {
+    classes.resize(txclass + 1);
+  }
+  classes[txclass].quantum = quantum;
+  classes[txclass].strict = strict;
+  classes[txclass].deficit = 0;
+}
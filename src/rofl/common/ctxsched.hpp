@@ -0,0 +1,208 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/*
+ * ctxsched.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef SRC_ROFL_COMMON_CTXSCHED_HPP_
+#define SRC_ROFL_COMMON_CTXSCHED_HPP_
+
+#include <inttypes.h>
+#include <stddef.h>
+
+#include <deque>
+#include <iostream>
+#include <vector>
+
+#include "rofl/common/chistogram.hpp"
+#include "rofl/common/crofqueue.h"
+
+namespace rofl {
+
+/**
+ * @brief	Transmission counters of a traffic class
+ *
+ * The queueing delay spans from storing a message in its txqueue to
+ * packing it into the transmission buffer, given in nsecs.
+ */
+class ctxclass_stats {
+public:
+  /**
+   *
+   */
+  ctxclass_stats() : packets(0), bytes(0){};
+
+  /**
+   * @brief	Resets all counters
+   */
+  void clear() {
+    packets = 0;
+    bytes = 0;
+    delay.clear();
+  };
+
+  /**
+   * @brief	Records a message of len bytes queued for delay nsecs
+   */
+  void add(size_t len, uint64_t delay) {
+    packets++;
+    bytes += len;
+    this->delay.add(delay);
+  };
+
+  /**
+   * @brief	Merges counters from another instance
+   */
+  ctxclass_stats &operator+=(const ctxclass_stats &stats) {
+    packets += stats.packets;
+    bytes += stats.bytes;
+    delay += stats.delay;
+    return *this;
+  };
+
+public:
+  /**
+   * @brief	Returns number of messages sent
+   */
+  uint64_t get_packets() const { return packets; };
+
+  /**
+   * @brief	Returns number of bytes sent
+   */
+  uint64_t get_bytes() const { return bytes; };
+
+  /**
+   * @brief	Returns histogram of queueing delays in nsecs
+   */
+  const chistogram &get_delay() const { return delay; };
+
+public:
+  friend std::ostream &operator<<(std::ostream &os,
+                                  const ctxclass_stats &stats) {
+    os << "<ctxclass_stats packets: " << stats.packets
+       << " bytes: " << stats.bytes << " delay: " << stats.delay << " >"
+       << std::endl;
+    return os;
+  };
+
+private:
+  uint64_t packets;
+  uint64_t bytes;
+  chistogram delay;
+};
+
+/**
+ * @brief	Transmission scheduler of crofsock
+ *
+ * crofsock keeps a txqueue per traffic class and asks its scheduler for the
+ * class to send from next. A round ends when select() returns -1, crofsock
+ * then sends the transmission buffer and starts another round as long as
+ * messages are pending. All methods are called from crofsock's txthread.
+ */
+class ctxsched {
+public:
+  /**
+   *
+   */
+  virtual ~ctxsched(){};
+
+  /**
+   * @brief	Returns traffic class to send the next message from
+   *
+   * @return class id, -1: end of round
+   */
+  virtual int select(std::deque<crofqueue> &txqueues) = 0;
+
+  /**
+   * @brief	Charges a message of len bytes retrieved from txclass
+   */
+  virtual void charge(unsigned int txclass, size_t len) = 0;
+
+  /**
+   * @brief	Configures a traffic class
+   *
+   * @param quantum bytes credited per round
+   * @param strict served before all other classes, lower class ids first
+   */
+  virtual void set_class(unsigned int txclass, size_t quantum,
+                         bool strict) = 0;
+};
+
+/**
+ * @brief	Deficit round robin with strict priority classes
+ *
+ * Strict classes are served first, lower class ids before higher ones.
+ * All other classes are visited in order of their ids, each visit credits
+ * the class's quantum to its deficit and sends messages while the next
+ * message fits into the deficit. Empty classes lose their deficit, so
+ * bandwidth is shared in proportion to the quanta of the busy classes,
+ * accurate to the byte regardless of message sizes.
+ */
+class ctxsched_drr : public ctxsched {
+public:
+  /**
+   * @param num_classes number of traffic classes, all with quantum
+   */
+  ctxsched_drr(unsigned int num_classes, size_t quantum = QUANTUM_DEFAULT);
+
+  /**
+   *
+   */
+  virtual ~ctxsched_drr(){};
+
+public:
+  virtual int select(std::deque<crofqueue> &txqueues);
+
+  virtual void charge(unsigned int txclass, size_t len);
+
+  virtual void set_class(unsigned int txclass, size_t quantum, bool strict);
+
+public:
+  /**
+   * @brief	Returns quantum of txclass in bytes
+   */
+  size_t get_quantum(unsigned int txclass) const {
+    return (txclass < classes.size()) ? classes[txclass].quantum : 0;
+  };
+
+  /**
+   * @brief	Returns true, when txclass is served with strict priority
+   */
+  bool get_strict(unsigned int txclass) const {
+    return (txclass < classes.size()) && classes[txclass].strict;
+  };
+
+  /**
+   * @brief	Returns current deficit of txclass in bytes
+   */
+  size_t get_deficit(unsigned int txclass) const {
+    return (txclass < classes.size()) ? classes[txclass].deficit : 0;
+  };
+
+public:
+  static const size_t QUANTUM_DEFAULT = 8192;
+
+private:
+  struct cclass {
+    cclass() : quantum(QUANTUM_DEFAULT), deficit(0), strict(false){};
+    size_t quantum;
+    size_t deficit;
+    bool strict;
+  };
+
+  std::vector<cclass> classes;
+
+  // class visited in the current round
+  unsigned int current;
+
+  // quantum already credited to current class in this visit
+  bool credited;
+};
+
+}; // end of namespace rofl
+
+#endif /* SRC_ROFL_COMMON_CTXSCHED_HPP_ */
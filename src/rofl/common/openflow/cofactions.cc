@@ -6,11 +6,18 @@
 
 using namespace rofl::openflow;
 
-cofactions::cofactions(uint8_t ofp_version) : ofp_version(ofp_version) {}
+cofactions::cofactions(uint8_t ofp_version)
+    : ofp_version(ofp_version), entries(inline_entries), num_entries(0),
+      max_entries(ACTION_INLINE_ENTRIES), blocks_used(0), wirelen(0) {}
 
 cofactions::~cofactions() { clear(); }
 
-cofactions::cofactions(const cofactions &actions) { *this = actions; }
+cofactions::cofactions(const cofactions &actions)
+    : ofp_version(actions.ofp_version), entries(inline_entries),
+      num_entries(0), max_entries(ACTION_INLINE_ENTRIES), blocks_used(0),
+      wirelen(0) {
+  *this = actions;
+}
 
 cofactions &cofactions::operator=(const cofactions &actions) {
   if (this == &actions)
@@ -20,114 +27,16 @@ cofactions &cofactions::operator=(const cofactions &actions) {
 
   clear();
 
-  for (std::map<cindex, unsigned int>::const_iterator it =
-           actions.actions_index.begin();
-       it != actions.actions_index.end(); ++it) {
-
-    const cindex &index = it->first;
-    const unsigned int &type = it->second;
-
-    switch (type) {
-    case rofl::openflow::OFPAT_OUTPUT: {
-      add_action_output(index) = actions.get_action_output(index);
-    } break;
-    case rofl::openflow::OFPAT_SET_VLAN_VID: {
-      add_action_set_vlan_vid(index) = actions.get_action_set_vlan_vid(index);
-    } break;
-    case rofl::openflow::OFPAT_SET_VLAN_PCP: {
-      add_action_set_vlan_pcp(index) = actions.get_action_set_vlan_pcp(index);
-    } break;
-    case rofl::openflow::OFPAT_STRIP_VLAN: {
-      add_action_strip_vlan(index) = actions.get_action_strip_vlan(index);
-    } break;
-    case rofl::openflow::OFPAT_SET_DL_SRC: {
-      add_action_set_dl_src(index) = actions.get_action_set_dl_src(index);
-    } break;
-    case rofl::openflow::OFPAT_SET_DL_DST: {
-      add_action_set_dl_dst(index) = actions.get_action_set_dl_dst(index);
-    } break;
-    case rofl::openflow::OFPAT_SET_NW_SRC: {
-      add_action_set_nw_src(index) = actions.get_action_set_nw_src(index);
-    } break;
-    case rofl::openflow::OFPAT_SET_NW_DST: {
-      add_action_set_nw_dst(index) = actions.get_action_set_nw_dst(index);
-    } break;
-    case rofl::openflow::OFPAT_SET_NW_TOS: {
-      add_action_set_nw_tos(index) = actions.get_action_set_nw_tos(index);
-    } break;
-    case rofl::openflow::OFPAT_SET_TP_SRC: {
-      add_action_set_tp_src(index) = actions.get_action_set_tp_src(index);
-    } break;
-    case rofl::openflow::OFPAT_SET_TP_DST: {
-      add_action_set_tp_dst(index) = actions.get_action_set_tp_dst(index);
-    } break;
-    case rofl::openflow::OFPAT_COPY_TTL_OUT: {
-      switch (get_version()) {
-      case rofl::openflow10::OFP_VERSION: {
-        add_action_enqueue(index) = actions.get_action_enqueue(index);
-      } break;
-      default: {
-        add_action_copy_ttl_out(index) = actions.get_action_copy_ttl_out(index);
-      }
-      }
-    } break;
-    case rofl::openflow::OFPAT_COPY_TTL_IN: {
-      add_action_copy_ttl_in(index) = actions.get_action_copy_ttl_in(index);
-    } break;
-    case rofl::openflow::OFPAT_SET_MPLS_TTL: {
-      add_action_set_mpls_ttl(index) = actions.get_action_set_mpls_ttl(index);
-    } break;
-    case rofl::openflow::OFPAT_DEC_MPLS_TTL: {
-      add_action_dec_mpls_ttl(index) = actions.get_action_dec_mpls_ttl(index);
-    } break;
-    case rofl::openflow::OFPAT_PUSH_VLAN: {
-      add_action_push_vlan(index) = actions.get_action_push_vlan(index);
-    } break;
-    case rofl::openflow::OFPAT_POP_VLAN: {
-      add_action_pop_vlan(index) = actions.get_action_pop_vlan(index);
-    } break;
-    case rofl::openflow::OFPAT_PUSH_MPLS: {
-      add_action_push_mpls(index) = actions.get_action_push_mpls(index);
-    } break;
-    case rofl::openflow::OFPAT_POP_MPLS: {
-      add_action_pop_mpls(index) = actions.get_action_pop_mpls(index);
-    } break;
-    case rofl::openflow::OFPAT_SET_QUEUE: {
-      add_action_set_queue(index) = actions.get_action_set_queue(index);
-    } break;
-    case rofl::openflow::OFPAT_GROUP: {
-      add_action_group(index) = actions.get_action_group(index);
-    } break;
-    case rofl::openflow::OFPAT_SET_NW_TTL: {
-      add_action_set_nw_ttl(index) = actions.get_action_set_nw_ttl(index);
-    } break;
-    case rofl::openflow::OFPAT_DEC_NW_TTL: {
-      add_action_dec_nw_ttl(index) = actions.get_action_dec_nw_ttl(index);
-    } break;
-    case rofl::openflow::OFPAT_SET_FIELD: {
-      add_action_set_field(index) = actions.get_action_set_field(index);
-    } break;
-    case rofl::openflow::OFPAT_PUSH_PBB: {
-      add_action_push_pbb(index) = actions.get_action_push_pbb(index);
-    } break;
-    case rofl::openflow::OFPAT_POP_PBB: {
-      add_action_pop_pbb(index) = actions.get_action_pop_pbb(index);
-    } break;
-    case rofl::openflow::OFPAT_EXPERIMENTER: {
-      switch (get_version()) {
-      case rofl::openflow10::OFP_VERSION: {
-        add_action_vendor(index) = actions.get_action_vendor(index);
-      } break;
-      default: {
-        add_action_experimenter(index) = actions.get_action_experimenter(index);
-      }
-      }
-    } break;
-    default: {
+  for (size_t i = 0; i < actions.num_entries; i++) {
+    const struct action_entry &entry = actions.entries[i];
+    reserve_action();
+    cofaction *action = clone_action(entry.type, *(entry.action));
+    if (NULL == action) {
       std::cerr << "[rofl][cofactions][unpack] unknown action type:"
-                << (unsigned int)type << std::endl;
-    }
+                << (unsigned int)entry.type << std::endl;
+      continue;
     }
+    insert_action(entry.index, entry.type, action);
   }
 
   return *this;
@@ -161,21 +70,27 @@ bool cofactions::operator==(cofactions const &actions) const {
 }
 
 void cofactions::clear() {
-  for (std::map<cindex, cofaction *>::iterator it = actions.begin();
-       it != actions.end(); ++it) {
-    delete (it->second);
+  wirelen = 0;
+  for (size_t i = 0; i < num_entries; i++) {
+    destroy_action(entries[i].action);
+  }
+  num_entries = 0;
+  if (entries != inline_entries) {
+    delete[] entries;
+    entries = inline_entries;
+    max_entries = ACTION_INLINE_ENTRIES;
   }
-  actions.clear();
-  actions_index.clear();
 }
 
 size_t cofactions::length() const {
+  if (wirelen > 0) {
+    return wirelen;
+  }
   size_t len = 0;
-  for (std::map<cindex, cofaction *>::const_iterator it = actions.begin();
-       it != actions.end(); ++it) {
-    len += it->second->length();
+  for (size_t i = 0; i < num_entries; i++) {
+    len += entries[i].action->length();
   }
-  return len;
+  return (wirelen = len);
 }
 
 void cofactions::pack(uint8_t *buf, size_t buflen) {
@@ -186,13 +101,19 @@ void cofactions::pack(uint8_t *buf, size_t buflen) {
     throw eInvalid("cofactions::pack() buflen too short", __FILE__,
                    __FUNCTION__, __LINE__);
 
-  for (std::map<cindex, cofaction *>::iterator it = actions.begin();
-       it != actions.end(); ++it) {
-    cofaction &action = *(it->second);
+  for (size_t i = 0; i < num_entries; i++) {
+    cofaction &action = *(entries[i].action);
 
-    action.pack(buf, action.length());
-    buf += action.length();
-    buflen -= action.length();
+    /* an action modified after length() was cached must not overrun buf */
+    size_t len = action.length();
+    if (len > buflen) {
+      wirelen = 0;
+      throw eInvalid("cofactions::pack() action exceeds buflen", __FILE__,
+                     __FUNCTION__, __LINE__);
+    }
+    action.pack(buf, len);
+    buf += len;
+    buflen -= len;
   }
 }
 
@@ -328,15 +249,19 @@ void cofactions::unpack(uint8_t *buf, size_t buflen) {
 }
 
 int cofactions::count_action_type(uint16_t type) const {
-  return count_if(actions.begin(), actions.end(),
-                  cofaction::cofaction_find_by_type(type));
+  int action_cnt = 0;
+  for (size_t i = 0; i < num_entries; i++) {
+    if (entries[i].action->get_type() == type) {
+      action_cnt++;
+    }
+  }
+  return action_cnt;
 }
 
 int cofactions::count_action_output(uint32_t port_no) const {
   int action_cnt = 0;
-  for (std::map<cindex, cofaction *>::const_iterator it = actions.begin();
-       it != actions.end(); ++it) {
-    const cofaction &action = *(it->second);
+  for (size_t i = 0; i < num_entries; i++) {
+    const cofaction &action = *(entries[i].action);
 
     if (rofl::openflow::OFPAT_OUTPUT != action.get_type())
       continue;
@@ -356,9 +281,8 @@ int cofactions::count_action_output(uint32_t port_no) const {
 std::list<uint32_t> cofactions::actions_output_ports() const {
   std::list<uint32_t> outports;
 
-  for (std::map<cindex, cofaction *>::const_iterator it = actions.begin();
-       it != actions.end(); ++it) {
-    const cofaction &action = *(it->second);
+  for (size_t i = 0; i < num_entries; i++) {
+    const cofaction &action = *(entries[i].action);
 
     if (rofl::openflow::OFPAT_OUTPUT != action.get_type())
       continue;
@@ -374,66 +298,217 @@ std::list<uint32_t> cofactions::actions_output_ports() const {
 }
 
 void cofactions::check_prerequisites() const {
-  for (std::map<cindex, cofaction *>::const_iterator it = actions.begin();
-       it != actions.end(); ++it) {
-    it->second->check_prerequisites();
+  for (size_t i = 0; i < num_entries; i++) {
+    entries[i].action->check_prerequisites();
   }
 }
 
 void cofactions::drop_action(const cindex &index) {
-  if (actions_index.find(index) == actions_index.end()) {
+  const struct action_entry *entry = find_action(index);
+  if (NULL == entry) {
     return;
   }
-  delete actions[index];
-  actions.erase(index);
-  actions_index.erase(index);
+  struct action_entry *it = entries + (entry - entries);
+  wirelen = 0;
+  destroy_action(it->action);
+  std::copy(it + 1, entries + num_entries, it);
+  num_entries--;
 }
 
 bool cofactions::has_action(const cindex &index) const {
-  return (not(actions_index.find(index) == actions_index.end()));
+  return (NULL != find_action(index));
 }
 
-cofaction_output &cofactions::add_action_output(const cindex &index) {
-  if (actions_index.find(index) != actions_index.end()) {
-    delete actions[index];
+std::map<rofl::cindex, unsigned int> cofactions::get_actions_index() const {
+  std::map<cindex, unsigned int> index;
+  for (size_t i = 0; i < num_entries; i++) {
+    index[entries[i].index] = entries[i].type;
+  }
+  return index;
+}
+
+std::map<rofl::cindex, cofaction *> cofactions::get_actions() const {
+  std::map<cindex, cofaction *> actions;
+  for (size_t i = 0; i < num_entries; i++) {
+    actions[entries[i].index] = entries[i].action;
+  }
+  return actions;
+}
+
+const struct cofactions::action_entry *
+cofactions::find_action(const cindex &index) const {
+  struct action_entry key;
+  key.index = index;
+  const struct action_entry *it =
+      std::lower_bound(entries, entries + num_entries, key);
+  if ((it == entries + num_entries) || (it->index != index)) {
+    return NULL;
+  }
+  return it;
+}
+
+void cofactions::drop_action(const cindex &index, unsigned int type) {
+  if (not has_action(index, type)) {
+    throw eActionInvalType();
+  }
+  drop_action(index);
+}
+
+bool cofactions::has_action(const cindex &index, unsigned int type) const {
+  const struct action_entry *entry = find_action(index);
+  return ((NULL != entry) && (type == entry->type));
+}
+
+void cofactions::insert_action(const cindex &index, unsigned int type,
+                               cofaction *action) {
+  wirelen = 0;
+  struct action_entry *it = entries + num_entries;
+  if ((num_entries > 0) && (index < entries[num_entries - 1].index)) {
+    struct action_entry key;
+    key.index = index;
+    it = std::lower_bound(entries, entries + num_entries, key);
+    std::copy_backward(it, entries + num_entries, entries + num_entries + 1);
+  }
+  it->index = index;
+  it->type = type;
+  it->action = action;
+  num_entries++;
+}
+
+void cofactions::reserve_action() {
+  if (num_entries < max_entries)
+    return;
+  struct action_entry *mem = new struct action_entry[2 * max_entries];
+  std::copy(entries, entries + num_entries, mem);
+  if (entries != inline_entries) {
+    delete[] entries;
+  }
+  entries = mem;
+  max_entries *= 2;
+}
+
+void *cofactions::alloc_action(size_t size) {
+  if (size <= ACTION_BLOCK_SIZE) {
+    for (size_t i = 0; i < ACTION_INLINE_BLOCKS; i++) {
+      if (blocks_used & (1U << i))
+        continue;
+      blocks_used |= (1U << i);
+      return &blocks[i];
+    }
+  }
+  return ::operator new(size);
+}
+
+void cofactions::free_action(void *mem) {
+  if ((mem >= (void *)&blocks[0]) &&
+      (mem < (void *)&blocks[ACTION_INLINE_BLOCKS])) {
+    blocks_used &= ~(1U << ((struct action_block *)mem - &blocks[0]));
+    return;
+  }
+  ::operator delete(mem);
+}
+
+void cofactions::destroy_action(cofaction *action) {
+  action->~cofaction();
+  free_action(action);
+}
+
+cofaction *cofactions::clone_action(unsigned int type, const cofaction &orig) {
+  switch (type) {
+  case rofl::openflow::OFPAT_OUTPUT:
+    return construct_from<cofaction_output>(orig);
+  case rofl::openflow::OFPAT_SET_VLAN_VID:
+    return construct_from<cofaction_set_vlan_vid>(orig);
+  case rofl::openflow::OFPAT_SET_VLAN_PCP:
+    return construct_from<cofaction_set_vlan_pcp>(orig);
+  case rofl::openflow::OFPAT_STRIP_VLAN:
+    return construct_from<cofaction_strip_vlan>(orig);
+  case rofl::openflow::OFPAT_SET_DL_SRC:
+    return construct_from<cofaction_set_dl_src>(orig);
+  case rofl::openflow::OFPAT_SET_DL_DST:
+    return construct_from<cofaction_set_dl_dst>(orig);
+  case rofl::openflow::OFPAT_SET_NW_SRC:
+    return construct_from<cofaction_set_nw_src>(orig);
+  case rofl::openflow::OFPAT_SET_NW_DST:
+    return construct_from<cofaction_set_nw_dst>(orig);
+  case rofl::openflow::OFPAT_SET_NW_TOS:
+    return construct_from<cofaction_set_nw_tos>(orig);
+  case rofl::openflow::OFPAT_SET_TP_SRC:
+    return construct_from<cofaction_set_tp_src>(orig);
+  case rofl::openflow::OFPAT_SET_TP_DST:
+    return construct_from<cofaction_set_tp_dst>(orig);
+  case rofl::openflow::OFPAT_COPY_TTL_OUT: {
+    switch (get_version()) {
+    case rofl::openflow10::OFP_VERSION:
+      return construct_from<cofaction_enqueue>(orig);
+    default:
+      return construct_from<cofaction_copy_ttl_out>(orig);
+    }
+  }
+  case rofl::openflow::OFPAT_COPY_TTL_IN:
+    return construct_from<cofaction_copy_ttl_in>(orig);
+  case rofl::openflow::OFPAT_SET_MPLS_TTL:
+    return construct_from<cofaction_set_mpls_ttl>(orig);
+  case rofl::openflow::OFPAT_DEC_MPLS_TTL:
+    return construct_from<cofaction_dec_mpls_ttl>(orig);
+  case rofl::openflow::OFPAT_PUSH_VLAN:
+    return construct_from<cofaction_push_vlan>(orig);
+  case rofl::openflow::OFPAT_POP_VLAN:
+    return construct_from<cofaction_pop_vlan>(orig);
+  case rofl::openflow::OFPAT_PUSH_MPLS:
+    return construct_from<cofaction_push_mpls>(orig);
+  case rofl::openflow::OFPAT_POP_MPLS:
+    return construct_from<cofaction_pop_mpls>(orig);
+  case rofl::openflow::OFPAT_GROUP:
+    return construct_from<cofaction_group>(orig);
+  case rofl::openflow::OFPAT_SET_NW_TTL:
+    return construct_from<cofaction_set_nw_ttl>(orig);
+  case rofl::openflow::OFPAT_DEC_NW_TTL:
+    return construct_from<cofaction_dec_nw_ttl>(orig);
+  case rofl::openflow::OFPAT_SET_QUEUE:
+    return construct_from<cofaction_set_queue>(orig);
+  case rofl::openflow::OFPAT_SET_FIELD:
+    return construct_from<cofaction_set_field>(orig);
+  case rofl::openflow::OFPAT_EXPERIMENTER: {
+    switch (get_version()) {
+    case rofl::openflow10::OFP_VERSION:
+      return construct_from<cofaction_vendor>(orig);
+    default:
+      return construct_from<cofaction_experimenter>(orig);
+    }
   }
-  actions[index] = new cofaction_output(ofp_version);
-  actions_index[index] = rofl::openflow::OFPAT_OUTPUT;
-  return dynamic_cast<cofaction_output &>(*(actions[index]));
+  case rofl::openflow::OFPAT_PUSH_PBB:
+    return construct_from<cofaction_push_pbb>(orig);
+  case rofl::openflow::OFPAT_POP_PBB:
+    return construct_from<cofaction_pop_pbb>(orig);
+  }
+  return NULL;
+}
+
+cofaction_output &cofactions::add_action_output(const cindex &index) {
+  return add_action<cofaction_output>(index, rofl::openflow::OFPAT_OUTPUT);
 }
 
 cofaction_output &cofactions::set_action_output(const cindex &index) {
-  if ((actions_index.find(index) != actions_index.end()) &&
-      (rofl::openflow::OFPAT_OUTPUT != actions[index]->get_type())) {
+  if (has_action(index) &&
+      (not has_action(index, rofl::openflow::OFPAT_OUTPUT))) {
     throw eInvalid("cofactions::set_action_output() invalid action type",
                    __FILE__, __FUNCTION__, __LINE__);
   }
-  if (actions_index.find(index) == actions_index.end()) {
-    actions[index] = new cofaction_output(ofp_version);
-    actions_index[index] = rofl::openflow::OFPAT_OUTPUT;
-  }
-  return dynamic_cast<cofaction_output &>(*(actions[index]));
+  return set_action<cofaction_output>(index, rofl::openflow::OFPAT_OUTPUT);
 }
 
 const cofaction_output &
 cofactions::get_action_output(const cindex &index) const {
-  if ((actions_index.find(index) == actions_index.end()) ||
-      (rofl::openflow::OFPAT_OUTPUT != actions_index.at(index))) {
-    throw eActionNotFound();
-  }
-  return dynamic_cast<const cofaction_output &>(*(actions.at(index)));
+  return get_action<cofaction_output>(index, rofl::openflow::OFPAT_OUTPUT);
 }
 
 void cofactions::drop_action_output(const cindex &index) {
-  if (rofl::openflow::OFPAT_OUTPUT != actions_index[index]) {
-    throw eActionInvalType();
-  }
-  drop_action(index);
+  drop_action(index, rofl::openflow::OFPAT_OUTPUT);
 }
 
 bool cofactions::has_action_output(const cindex &index) const {
-  return ((actions_index.find(index) != actions_index.end()) &&
-          (rofl::openflow::OFPAT_OUTPUT == actions_index.at(index)));
+  return has_action(index, rofl::openflow::OFPAT_OUTPUT);
 }
 
 cofaction_set_vlan_vid &
@@ -441,12 +516,8 @@ cofactions::add_action_set_vlan_vid(const cindex &index) {
   if (get_version() != rofl::openflow10::OFP_VERSION)
     throw eBadVersion("cofactions::add_action_set_vlan_vid() invalid version");
 
-  if (actions_index.find(index) != actions_index.end()) {
-    delete actions[index];
-  }
-  actions[index] = new cofaction_set_vlan_vid(ofp_version);
-  actions_index[index] = rofl::openflow::OFPAT_SET_VLAN_VID;
-  return dynamic_cast<cofaction_set_vlan_vid &>(*(actions[index]));
+  return add_action<cofaction_set_vlan_vid>(index,
+                                            rofl::openflow::OFPAT_SET_VLAN_VID);
 }
 
 cofaction_set_vlan_vid &
@@ -454,32 +525,22 @@ cofactions::set_action_set_vlan_vid(const cindex &index) {
   if (get_version() != rofl::openflow10::OFP_VERSION)
     throw eBadVersion("cofactions::set_action_set_vlan_vid() invalid version");
 
-  if (actions_index.find(index) == actions_index.end()) {
-    actions[index] = new cofaction_set_vlan_vid(ofp_version);
-    actions_index[index] = rofl::openflow::OFPAT_SET_VLAN_VID;
-  }
-  return dynamic_cast<cofaction_set_vlan_vid &>(*(actions[index]));
+  return set_action<cofaction_set_vlan_vid>(index,
+                                            rofl::openflow::OFPAT_SET_VLAN_VID);
 }
 
 const cofaction_set_vlan_vid &
 cofactions::get_action_set_vlan_vid(const cindex &index) const {
-  if ((actions_index.find(index) == actions_index.end()) ||
-      (rofl::openflow::OFPAT_SET_VLAN_VID != actions_index.at(index))) {
-    throw eActionNotFound();
-  }
-  return dynamic_cast<const cofaction_set_vlan_vid &>(*(actions.at(index)));
+  return get_action<cofaction_set_vlan_vid>(index,
+                                            rofl::openflow::OFPAT_SET_VLAN_VID);
 }
 
 void cofactions::drop_action_set_vlan_vid(const cindex &index) {
-  if (rofl::openflow::OFPAT_SET_VLAN_VID != actions_index[index]) {
-    throw eActionInvalType();
-  }
-  drop_action(index);
+  drop_action(index, rofl::openflow::OFPAT_SET_VLAN_VID);
 }
 
 bool cofactions::has_action_set_vlan_vid(const cindex &index) const {
-  return ((actions_index.find(index) != actions_index.end()) &&
-          (rofl::openflow::OFPAT_SET_VLAN_VID == actions_index.at(index)));
+  return has_action(index, rofl::openflow::OFPAT_SET_VLAN_VID);
 }
 
 cofaction_set_vlan_pcp &
@@ -487,12 +548,8 @@ cofactions::add_action_set_vlan_pcp(const cindex &index) {
   if (get_version() != rofl::openflow10::OFP_VERSION)
     throw eBadVersion("cofactions::add_action_set_vlan_pcp() invalid version");
 
-  if (actions_index.find(index) != actions_index.end()) {
-    delete actions[index];
-  }
-  actions[index] = new cofaction_set_vlan_pcp(ofp_version);
-  actions_index[index] = rofl::openflow::OFPAT_SET_VLAN_PCP;
-  return dynamic_cast<cofaction_set_vlan_pcp &>(*(actions[index]));
+  return add_action<cofaction_set_vlan_pcp>(index,
+                                            rofl::openflow::OFPAT_SET_VLAN_PCP);
 }
 
 cofaction_set_vlan_pcp &
@@ -500,472 +557,316 @@ cofactions::set_action_set_vlan_pcp(const cindex &index) {
   if (get_version() != rofl::openflow10::OFP_VERSION)
     throw eBadVersion("cofactions::set_action_set_vlan_pcp() invalid version");
 
-  if (actions_index.find(index) == actions_index.end()) {
-    actions[index] = new cofaction_set_vlan_pcp(ofp_version);
-    actions_index[index] = rofl::openflow::OFPAT_SET_VLAN_PCP;
-  }
-  return dynamic_cast<cofaction_set_vlan_pcp &>(*(actions[index]));
+  return set_action<cofaction_set_vlan_pcp>(index,
+                                            rofl::openflow::OFPAT_SET_VLAN_PCP);
 }
 
 const cofaction_set_vlan_pcp &
 cofactions::get_action_set_vlan_pcp(const cindex &index) const {
-  if ((actions_index.find(index) == actions_index.end()) ||
-      (rofl::openflow::OFPAT_SET_VLAN_PCP != actions_index.at(index))) {
-    throw eActionNotFound();
-  }
-  return dynamic_cast<const cofaction_set_vlan_pcp &>(*(actions.at(index)));
+  return get_action<cofaction_set_vlan_pcp>(index,
+                                            rofl::openflow::OFPAT_SET_VLAN_PCP);
 }
 
 void cofactions::drop_action_set_vlan_pcp(const cindex &index) {
-  if (rofl::openflow::OFPAT_SET_VLAN_PCP != actions_index[index]) {
-    throw eActionInvalType();
-  }
-  drop_action(index);
+  drop_action(index, rofl::openflow::OFPAT_SET_VLAN_PCP);
 }
 
 bool cofactions::has_action_set_vlan_pcp(const cindex &index) const {
-  return ((actions_index.find(index) != actions_index.end()) &&
-          (rofl::openflow::OFPAT_SET_VLAN_PCP == actions_index.at(index)));
+  return has_action(index, rofl::openflow::OFPAT_SET_VLAN_PCP);
 }
 
 cofaction_strip_vlan &cofactions::add_action_strip_vlan(const cindex &index) {
   if (get_version() != rofl::openflow10::OFP_VERSION)
     throw eBadVersion("cofactions::add_action_strip_vlan() invalid version");
 
-  if (actions_index.find(index) != actions_index.end()) {
-    delete actions[index];
-  }
-  actions[index] = new cofaction_strip_vlan(ofp_version);
-  actions_index[index] = rofl::openflow::OFPAT_STRIP_VLAN;
-  return dynamic_cast<cofaction_strip_vlan &>(*(actions[index]));
+  return add_action<cofaction_strip_vlan>(index,
+                                          rofl::openflow::OFPAT_STRIP_VLAN);
 }
 
 cofaction_strip_vlan &cofactions::set_action_strip_vlan(const cindex &index) {
   if (get_version() != rofl::openflow10::OFP_VERSION)
     throw eBadVersion("cofactions::set_action_strip_vlan() invalid version");
 
-  if (actions_index.find(index) == actions_index.end()) {
-    actions[index] = new cofaction_strip_vlan(ofp_version);
-    actions_index[index] = rofl::openflow::OFPAT_STRIP_VLAN;
-  }
-  return dynamic_cast<cofaction_strip_vlan &>(*(actions[index]));
+  return set_action<cofaction_strip_vlan>(index,
+                                          rofl::openflow::OFPAT_STRIP_VLAN);
 }
 
 const cofaction_strip_vlan &
 cofactions::get_action_strip_vlan(const cindex &index) const {
-  if ((actions_index.find(index) == actions_index.end()) ||
-      (rofl::openflow::OFPAT_STRIP_VLAN != actions_index.at(index))) {
-    throw eActionNotFound();
-  }
-  return dynamic_cast<const cofaction_strip_vlan &>(*(actions.at(index)));
+  return get_action<cofaction_strip_vlan>(index,
+                                          rofl::openflow::OFPAT_STRIP_VLAN);
 }
 
 void cofactions::drop_action_strip_vlan(const cindex &index) {
-  if (rofl::openflow::OFPAT_STRIP_VLAN != actions_index[index]) {
-    throw eActionInvalType();
-  }
-  drop_action(index);
+  drop_action(index, rofl::openflow::OFPAT_STRIP_VLAN);
 }
 
 bool cofactions::has_action_strip_vlan(const cindex &index) const {
-  return ((actions_index.find(index) != actions_index.end()) &&
-          (rofl::openflow::OFPAT_STRIP_VLAN == actions_index.at(index)));
+  return has_action(index, rofl::openflow::OFPAT_STRIP_VLAN);
 }
 
 cofaction_set_dl_src &cofactions::add_action_set_dl_src(const cindex &index) {
   if (get_version() != rofl::openflow10::OFP_VERSION)
     throw eBadVersion("cofactions::add_action_set_dl_src() invalid version");
 
-  if (actions_index.find(index) != actions_index.end()) {
-    delete actions[index];
-  }
-  actions[index] = new cofaction_set_dl_src(ofp_version);
-  actions_index[index] = rofl::openflow::OFPAT_SET_DL_SRC;
-  return dynamic_cast<cofaction_set_dl_src &>(*(actions[index]));
+  return add_action<cofaction_set_dl_src>(index,
+                                          rofl::openflow::OFPAT_SET_DL_SRC);
 }
 
 cofaction_set_dl_src &cofactions::set_action_set_dl_src(const cindex &index) {
   if (get_version() != rofl::openflow10::OFP_VERSION)
     throw eBadVersion("cofactions::set_action_set_dl_src() invalid version");
 
-  if (actions_index.find(index) == actions_index.end()) {
-    actions[index] = new cofaction_set_dl_src(ofp_version);
-    actions_index[index] = rofl::openflow::OFPAT_SET_DL_SRC;
-  }
-  return dynamic_cast<cofaction_set_dl_src &>(*(actions[index]));
+  return set_action<cofaction_set_dl_src>(index,
+                                          rofl::openflow::OFPAT_SET_DL_SRC);
 }
 
 const cofaction_set_dl_src &
 cofactions::get_action_set_dl_src(const cindex &index) const {
-  if ((actions_index.find(index) == actions_index.end()) ||
-      (rofl::openflow::OFPAT_SET_DL_SRC != actions_index.at(index))) {
-    throw eActionNotFound();
-  }
-  return dynamic_cast<const cofaction_set_dl_src &>(*(actions.at(index)));
+  return get_action<cofaction_set_dl_src>(index,
+                                          rofl::openflow::OFPAT_SET_DL_SRC);
 }
 
 void cofactions::drop_action_set_dl_src(const cindex &index) {
-  if (rofl::openflow::OFPAT_SET_DL_SRC != actions_index[index]) {
-    throw eActionInvalType();
-  }
-  drop_action(index);
+  drop_action(index, rofl::openflow::OFPAT_SET_DL_SRC);
 }
 
 bool cofactions::has_action_set_dl_src(const cindex &index) const {
-  return ((actions_index.find(index) != actions_index.end()) &&
-          (rofl::openflow::OFPAT_SET_DL_SRC == actions_index.at(index)));
+  return has_action(index, rofl::openflow::OFPAT_SET_DL_SRC);
 }
 
 cofaction_set_dl_dst &cofactions::add_action_set_dl_dst(const cindex &index) {
   if (get_version() != rofl::openflow10::OFP_VERSION)
     throw eBadVersion("cofactions::add_action_set_dl_dst() invalid version");
 
-  if (actions_index.find(index) != actions_index.end()) {
-    delete actions[index];
-  }
-  actions[index] = new cofaction_set_dl_dst(ofp_version);
-  actions_index[index] = rofl::openflow::OFPAT_SET_DL_DST;
-  return dynamic_cast<cofaction_set_dl_dst &>(*(actions[index]));
+  return add_action<cofaction_set_dl_dst>(index,
+                                          rofl::openflow::OFPAT_SET_DL_DST);
 }
 
 cofaction_set_dl_dst &cofactions::set_action_set_dl_dst(const cindex &index) {
   if (get_version() != rofl::openflow10::OFP_VERSION)
     throw eBadVersion("cofactions::set_action_set_dl_dst() invalid version");
 
-  if (actions_index.find(index) == actions_index.end()) {
-    actions[index] = new cofaction_set_dl_dst(ofp_version);
-    actions_index[index] = rofl::openflow::OFPAT_SET_DL_DST;
-  }
-  return dynamic_cast<cofaction_set_dl_dst &>(*(actions[index]));
+  return set_action<cofaction_set_dl_dst>(index,
+                                          rofl::openflow::OFPAT_SET_DL_DST);
 }
 
 const cofaction_set_dl_dst &
 cofactions::get_action_set_dl_dst(const cindex &index) const {
-  if ((actions_index.find(index) == actions_index.end()) ||
-      (rofl::openflow::OFPAT_SET_DL_DST != actions_index.at(index))) {
-    throw eActionNotFound();
-  }
-  return dynamic_cast<const cofaction_set_dl_dst &>(*(actions.at(index)));
+  return get_action<cofaction_set_dl_dst>(index,
+                                          rofl::openflow::OFPAT_SET_DL_DST);
 }
 
 void cofactions::drop_action_set_dl_dst(const cindex &index) {
-  if (rofl::openflow::OFPAT_SET_DL_DST != actions_index[index]) {
-    throw eActionInvalType();
-  }
-  drop_action(index);
+  drop_action(index, rofl::openflow::OFPAT_SET_DL_DST);
 }
 
 bool cofactions::has_action_set_dl_dst(const cindex &index) const {
-  return ((actions_index.find(index) != actions_index.end()) &&
-          (rofl::openflow::OFPAT_SET_DL_DST == actions_index.at(index)));
+  return has_action(index, rofl::openflow::OFPAT_SET_DL_DST);
 }
 
 cofaction_set_nw_src &cofactions::add_action_set_nw_src(const cindex &index) {
   if (get_version() != rofl::openflow10::OFP_VERSION)
     throw eBadVersion("cofactions::add_action_set_nw_src() invalid version");
 
-  if (actions_index.find(index) != actions_index.end()) {
-    delete actions[index];
-  }
-  actions[index] = new cofaction_set_nw_src(ofp_version);
-  actions_index[index] = rofl::openflow::OFPAT_SET_NW_SRC;
-  return dynamic_cast<cofaction_set_nw_src &>(*(actions[index]));
+  return add_action<cofaction_set_nw_src>(index,
+                                          rofl::openflow::OFPAT_SET_NW_SRC);
 }
 
 cofaction_set_nw_src &cofactions::set_action_set_nw_src(const cindex &index) {
   if (get_version() != rofl::openflow10::OFP_VERSION)
     throw eBadVersion("cofactions::set_action_set_nw_src() invalid version");
 
-  if (actions_index.find(index) == actions_index.end()) {
-    actions[index] = new cofaction_set_nw_src(ofp_version);
-    actions_index[index] = rofl::openflow::OFPAT_SET_NW_SRC;
-  }
-  return dynamic_cast<cofaction_set_nw_src &>(*(actions[index]));
+  return set_action<cofaction_set_nw_src>(index,
+                                          rofl::openflow::OFPAT_SET_NW_SRC);
 }
 
 const cofaction_set_nw_src &
 cofactions::get_action_set_nw_src(const cindex &index) const {
-  if ((actions_index.find(index) == actions_index.end()) ||
-      (rofl::openflow::OFPAT_SET_NW_SRC != actions_index.at(index))) {
-    throw eActionNotFound();
-  }
-  return dynamic_cast<const cofaction_set_nw_src &>(*(actions.at(index)));
+  return get_action<cofaction_set_nw_src>(index,
+                                          rofl::openflow::OFPAT_SET_NW_SRC);
 }
 
 void cofactions::drop_action_set_nw_src(const cindex &index) {
-  if (rofl::openflow::OFPAT_SET_NW_SRC != actions_index[index]) {
-    throw eActionInvalType();
-  }
-  drop_action(index);
+  drop_action(index, rofl::openflow::OFPAT_SET_NW_SRC);
 }
 
 bool cofactions::has_action_set_nw_src(const cindex &index) const {
-  return ((actions_index.find(index) != actions_index.end()) &&
-          (rofl::openflow::OFPAT_SET_NW_SRC == actions_index.at(index)));
+  return has_action(index, rofl::openflow::OFPAT_SET_NW_SRC);
 }
 
 cofaction_set_nw_dst &cofactions::add_action_set_nw_dst(const cindex &index) {
   if (get_version() != rofl::openflow10::OFP_VERSION)
     throw eBadVersion("cofactions::add_action_set_nw_dst() invalid version");
 
-  if (actions_index.find(index) != actions_index.end()) {
-    delete actions[index];
-  }
-  actions[index] = new cofaction_set_nw_dst(ofp_version);
-  actions_index[index] = rofl::openflow::OFPAT_SET_NW_DST;
-  return dynamic_cast<cofaction_set_nw_dst &>(*(actions[index]));
+  return add_action<cofaction_set_nw_dst>(index,
+                                          rofl::openflow::OFPAT_SET_NW_DST);
 }
 
 cofaction_set_nw_dst &cofactions::set_action_set_nw_dst(const cindex &index) {
   if (get_version() != rofl::openflow10::OFP_VERSION)
     throw eBadVersion("cofactions::set_action_set_nw_dst() invalid version");
 
-  if (actions_index.find(index) == actions_index.end()) {
-    actions[index] = new cofaction_set_nw_dst(ofp_version);
-    actions_index[index] = rofl::openflow::OFPAT_SET_NW_DST;
-  }
-  return dynamic_cast<cofaction_set_nw_dst &>(*(actions[index]));
+  return set_action<cofaction_set_nw_dst>(index,
+                                          rofl::openflow::OFPAT_SET_NW_DST);
 }
 
 const cofaction_set_nw_dst &
 cofactions::get_action_set_nw_dst(const cindex &index) const {
-  if ((actions_index.find(index) == actions_index.end()) ||
-      (rofl::openflow::OFPAT_SET_NW_DST != actions_index.at(index))) {
-    throw eActionNotFound();
-  }
-  return dynamic_cast<const cofaction_set_nw_dst &>(*(actions.at(index)));
+  return get_action<cofaction_set_nw_dst>(index,
+                                          rofl::openflow::OFPAT_SET_NW_DST);
 }
 
 void cofactions::drop_action_set_nw_dst(const cindex &index) {
-  if (rofl::openflow::OFPAT_SET_NW_DST != actions_index[index]) {
-    throw eActionInvalType();
-  }
-  drop_action(index);
+  drop_action(index, rofl::openflow::OFPAT_SET_NW_DST);
 }
 
 bool cofactions::has_action_set_nw_dst(const cindex &index) const {
-  return ((actions_index.find(index) != actions_index.end()) &&
-          (rofl::openflow::OFPAT_SET_NW_DST == actions_index.at(index)));
+  return has_action(index, rofl::openflow::OFPAT_SET_NW_DST);
 }
 
 cofaction_set_nw_tos &cofactions::add_action_set_nw_tos(const cindex &index) {
   if (get_version() != rofl::openflow10::OFP_VERSION)
     throw eBadVersion("cofactions::add_action_set_nw_tos() invalid version");
 
-  if (actions_index.find(index) != actions_index.end()) {
-    delete actions[index];
-  }
-  actions[index] = new cofaction_set_nw_tos(ofp_version);
-  actions_index[index] = rofl::openflow::OFPAT_SET_NW_TOS;
-  return dynamic_cast<cofaction_set_nw_tos &>(*(actions[index]));
+  return add_action<cofaction_set_nw_tos>(index,
+                                          rofl::openflow::OFPAT_SET_NW_TOS);
 }
 
 cofaction_set_nw_tos &cofactions::set_action_set_nw_tos(const cindex &index) {
   if (get_version() != rofl::openflow10::OFP_VERSION)
     throw eBadVersion("cofactions::set_action_set_nw_tos() invalid version");
 
-  if (actions_index.find(index) == actions_index.end()) {
-    actions[index] = new cofaction_set_nw_tos(ofp_version);
-    actions_index[index] = rofl::openflow::OFPAT_SET_NW_TOS;
-  }
-  return dynamic_cast<cofaction_set_nw_tos &>(*(actions[index]));
+  return set_action<cofaction_set_nw_tos>(index,
+                                          rofl::openflow::OFPAT_SET_NW_TOS);
 }
 
 const cofaction_set_nw_tos &
 cofactions::get_action_set_nw_tos(const cindex &index) const {
-  if ((actions_index.find(index) == actions_index.end()) ||
-      (rofl::openflow::OFPAT_SET_NW_TOS != actions_index.at(index))) {
-    throw eActionNotFound();
-  }
-  return dynamic_cast<const cofaction_set_nw_tos &>(*(actions.at(index)));
+  return get_action<cofaction_set_nw_tos>(index,
+                                          rofl::openflow::OFPAT_SET_NW_TOS);
 }
 
 void cofactions::drop_action_set_nw_tos(const cindex &index) {
-  if (rofl::openflow::OFPAT_SET_NW_TOS != actions_index[index]) {
-    throw eActionInvalType();
-  }
-  drop_action(index);
+  drop_action(index, rofl::openflow::OFPAT_SET_NW_TOS);
 }
 
 bool cofactions::has_action_set_nw_tos(const cindex &index) const {
-  return ((actions_index.find(index) != actions_index.end()) &&
-          (rofl::openflow::OFPAT_SET_NW_TOS == actions_index.at(index)));
+  return has_action(index, rofl::openflow::OFPAT_SET_NW_TOS);
 }
 
 cofaction_set_tp_src &cofactions::add_action_set_tp_src(const cindex &index) {
   if (get_version() != rofl::openflow10::OFP_VERSION)
     throw eBadVersion("cofactions::add_action_set_tp_src() invalid version");
 
-  if (actions_index.find(index) != actions_index.end()) {
-    delete actions[index];
-  }
-  actions[index] = new cofaction_set_tp_src(ofp_version);
-  actions_index[index] = rofl::openflow::OFPAT_SET_TP_SRC;
-  return dynamic_cast<cofaction_set_tp_src &>(*(actions[index]));
+  return add_action<cofaction_set_tp_src>(index,
+                                          rofl::openflow::OFPAT_SET_TP_SRC);
 }
 
 cofaction_set_tp_src &cofactions::set_action_set_tp_src(const cindex &index) {
   if (get_version() != rofl::openflow10::OFP_VERSION)
     throw eBadVersion("cofactions::set_action_set_tp_src() invalid version");
 
-  if (actions_index.find(index) == actions_index.end()) {
-    actions[index] = new cofaction_set_tp_src(ofp_version);
-    actions_index[index] = rofl::openflow::OFPAT_SET_TP_SRC;
-  }
-  return dynamic_cast<cofaction_set_tp_src &>(*(actions[index]));
+  return set_action<cofaction_set_tp_src>(index,
+                                          rofl::openflow::OFPAT_SET_TP_SRC);
 }
 
 const cofaction_set_tp_src &
 cofactions::get_action_set_tp_src(const cindex &index) const {
-  if ((actions_index.find(index) == actions_index.end()) ||
-      (rofl::openflow::OFPAT_SET_TP_SRC != actions_index.at(index))) {
-    throw eActionNotFound();
-  }
-  return dynamic_cast<const cofaction_set_tp_src &>(*(actions.at(index)));
+  return get_action<cofaction_set_tp_src>(index,
+                                          rofl::openflow::OFPAT_SET_TP_SRC);
 }
 
 void cofactions::drop_action_set_tp_src(const cindex &index) {
-  if (rofl::openflow::OFPAT_SET_TP_SRC != actions_index[index]) {
-    throw eActionInvalType();
-  }
-  drop_action(index);
+  drop_action(index, rofl::openflow::OFPAT_SET_TP_SRC);
 }
 
 bool cofactions::has_action_set_tp_src(const cindex &index) const {
-  return ((actions_index.find(index) != actions_index.end()) &&
-          (rofl::openflow::OFPAT_SET_TP_SRC == actions_index.at(index)));
+  return has_action(index, rofl::openflow::OFPAT_SET_TP_SRC);
 }
 
 cofaction_set_tp_dst &cofactions::add_action_set_tp_dst(const cindex &index) {
   if (get_version() != rofl::openflow10::OFP_VERSION)
     throw eBadVersion("cofactions::add_action_set_tp_dst() invalid version");
 
-  if (actions_index.find(index) != actions_index.end()) {
-    delete actions[index];
-  }
-  actions[index] = new cofaction_set_tp_dst(ofp_version);
-  actions_index[index] = rofl::openflow::OFPAT_SET_TP_DST;
-  return dynamic_cast<cofaction_set_tp_dst &>(*(actions[index]));
+  return add_action<cofaction_set_tp_dst>(index,
+                                          rofl::openflow::OFPAT_SET_TP_DST);
 }
 
 cofaction_set_tp_dst &cofactions::set_action_set_tp_dst(const cindex &index) {
   if (get_version() != rofl::openflow10::OFP_VERSION)
     throw eBadVersion("cofactions::set_action_set_tp_dst() invalid version");
 
-  if (actions_index.find(index) == actions_index.end()) {
-    actions[index] = new cofaction_set_tp_dst(ofp_version);
-    actions_index[index] = rofl::openflow::OFPAT_SET_TP_DST;
-  }
-  return dynamic_cast<cofaction_set_tp_dst &>(*(actions[index]));
+  return set_action<cofaction_set_tp_dst>(index,
+                                          rofl::openflow::OFPAT_SET_TP_DST);
 }
 
 const cofaction_set_tp_dst &
 cofactions::get_action_set_tp_dst(const cindex &index) const {
-  if ((actions_index.find(index) == actions_index.end()) ||
-      (rofl::openflow::OFPAT_SET_TP_DST != actions_index.at(index))) {
-    throw eActionNotFound();
-  }
-  return dynamic_cast<const cofaction_set_tp_dst &>(*(actions.at(index)));
+  return get_action<cofaction_set_tp_dst>(index,
+                                          rofl::openflow::OFPAT_SET_TP_DST);
 }
 
 void cofactions::drop_action_set_tp_dst(const cindex &index) {
-  if (rofl::openflow::OFPAT_SET_TP_DST != actions_index[index]) {
-    throw eActionInvalType();
-  }
-  drop_action(index);
+  drop_action(index, rofl::openflow::OFPAT_SET_TP_DST);
 }
 
 bool cofactions::has_action_set_tp_dst(const cindex &index) const {
-  return ((actions_index.find(index) != actions_index.end()) &&
-          (rofl::openflow::OFPAT_SET_TP_DST == actions_index.at(index)));
+  return has_action(index, rofl::openflow::OFPAT_SET_TP_DST);
 }
 
 cofaction_enqueue &cofactions::add_action_enqueue(const cindex &index) {
   if (get_version() != rofl::openflow10::OFP_VERSION)
     throw eBadVersion("cofactions::add_action_enqueue() invalid version");
 
-  if (actions_index.find(index) != actions_index.end()) {
-    delete actions[index];
-  }
-  actions[index] = new cofaction_enqueue(ofp_version);
-  actions_index[index] = rofl::openflow10::OFPAT_ENQUEUE;
-  return dynamic_cast<cofaction_enqueue &>(*(actions[index]));
+  return add_action<cofaction_enqueue>(index, rofl::openflow10::OFPAT_ENQUEUE);
 }
 
 cofaction_enqueue &cofactions::set_action_enqueue(const cindex &index) {
   if (get_version() != rofl::openflow10::OFP_VERSION)
     throw eBadVersion("cofactions::set_action_enqueue() invalid version");
 
-  if (actions_index.find(index) == actions_index.end()) {
-    actions[index] = new cofaction_enqueue(ofp_version);
-    actions_index[index] = rofl::openflow10::OFPAT_ENQUEUE;
-  }
-  return dynamic_cast<cofaction_enqueue &>(*(actions[index]));
+  return set_action<cofaction_enqueue>(index, rofl::openflow10::OFPAT_ENQUEUE);
 }
 
 const cofaction_enqueue &
 cofactions::get_action_enqueue(const cindex &index) const {
-  if ((actions_index.find(index) == actions_index.end()) ||
-      (rofl::openflow10::OFPAT_ENQUEUE != actions_index.at(index))) {
-    throw eActionNotFound();
-  }
-  return dynamic_cast<const cofaction_enqueue &>(*(actions.at(index)));
+  return get_action<cofaction_enqueue>(index, rofl::openflow10::OFPAT_ENQUEUE);
 }
 
 void cofactions::drop_action_enqueue(const cindex &index) {
-  if (rofl::openflow10::OFPAT_ENQUEUE != actions_index[index]) {
-    throw eActionInvalType();
-  }
-  drop_action(index);
+  drop_action(index, rofl::openflow10::OFPAT_ENQUEUE);
 }
 
 bool cofactions::has_action_enqueue(const cindex &index) const {
-  return ((actions_index.find(index) != actions_index.end()) &&
-          (rofl::openflow10::OFPAT_ENQUEUE == actions_index.at(index)));
+  return has_action(index, rofl::openflow10::OFPAT_ENQUEUE);
 }
 
 cofaction_vendor &cofactions::add_action_vendor(const cindex &index) {
   if (get_version() != rofl::openflow10::OFP_VERSION)
     throw eBadVersion("cofactions::add_action_vendor() invalid version");
 
-  if (actions_index.find(index) != actions_index.end()) {
-    delete actions[index];
-  }
-  actions[index] = new cofaction_vendor(ofp_version);
-  actions_index[index] = rofl::openflow10::OFPAT_VENDOR;
-  return dynamic_cast<cofaction_vendor &>(*(actions[index]));
+  return add_action<cofaction_vendor>(index, rofl::openflow10::OFPAT_VENDOR);
 }
 
 cofaction_vendor &cofactions::set_action_vendor(const cindex &index) {
   if (get_version() != rofl::openflow10::OFP_VERSION)
     throw eBadVersion("cofactions::set_action_vendor() invalid version");
 
-  if (actions_index.find(index) == actions_index.end()) {
-    actions[index] = new cofaction_vendor(ofp_version);
-    actions_index[index] = rofl::openflow10::OFPAT_VENDOR;
-  }
-  return dynamic_cast<cofaction_vendor &>(*(actions[index]));
+  return set_action<cofaction_vendor>(index, rofl::openflow10::OFPAT_VENDOR);
 }
 
 const cofaction_vendor &
 cofactions::get_action_vendor(const cindex &index) const {
-  if ((actions_index.find(index) == actions_index.end()) ||
-      (rofl::openflow10::OFPAT_VENDOR != actions_index.at(index))) {
-    throw eActionNotFound();
-  }
-  return dynamic_cast<const cofaction_vendor &>(*(actions.at(index)));
+  return get_action<cofaction_vendor>(index, rofl::openflow10::OFPAT_VENDOR);
 }
 
 void cofactions::drop_action_vendor(const cindex &index) {
-  if (rofl::openflow10::OFPAT_VENDOR != actions_index[index]) {
-    throw eActionInvalType();
-  }
-  drop_action(index);
+  drop_action(index, rofl::openflow10::OFPAT_VENDOR);
 }
 
 bool cofactions::has_action_vendor(const cindex &index) const {
-  return ((actions_index.find(index) != actions_index.end()) &&
-          (rofl::openflow10::OFPAT_VENDOR == actions_index.at(index)));
+  return has_action(index, rofl::openflow10::OFPAT_VENDOR);
 }
 
 cofaction_copy_ttl_out &
@@ -973,12 +874,8 @@ cofactions::add_action_copy_ttl_out(const cindex &index) {
   if (get_version() < rofl::openflow12::OFP_VERSION)
     throw eBadVersion("cofactions::add_action_copy_ttl_out() invalid version");
 
-  if (actions_index.find(index) != actions_index.end()) {
-    delete actions[index];
-  }
-  actions[index] = new cofaction_copy_ttl_out(ofp_version);
-  actions_index[index] = rofl::openflow::OFPAT_COPY_TTL_OUT;
-  return dynamic_cast<cofaction_copy_ttl_out &>(*(actions[index]));
+  return add_action<cofaction_copy_ttl_out>(index,
+                                            rofl::openflow::OFPAT_COPY_TTL_OUT);
 }
 
 cofaction_copy_ttl_out &
@@ -986,76 +883,52 @@ cofactions::set_action_copy_ttl_out(const cindex &index) {
   if (get_version() < rofl::openflow12::OFP_VERSION)
     throw eBadVersion("cofactions::set_action_copy_ttl_out() invalid version");
 
-  if (actions_index.find(index) == actions_index.end()) {
-    actions[index] = new cofaction_copy_ttl_out(ofp_version);
-    actions_index[index] = rofl::openflow::OFPAT_COPY_TTL_OUT;
-  }
-  return dynamic_cast<cofaction_copy_ttl_out &>(*(actions[index]));
+  return set_action<cofaction_copy_ttl_out>(index,
+                                            rofl::openflow::OFPAT_COPY_TTL_OUT);
 }
 
 const cofaction_copy_ttl_out &
 cofactions::get_action_copy_ttl_out(const cindex &index) const {
-  if ((actions_index.find(index) == actions_index.end()) ||
-      (rofl::openflow::OFPAT_COPY_TTL_OUT != actions_index.at(index))) {
-    throw eActionNotFound();
-  }
-  return dynamic_cast<const cofaction_copy_ttl_out &>(*(actions.at(index)));
+  return get_action<cofaction_copy_ttl_out>(index,
+                                            rofl::openflow::OFPAT_COPY_TTL_OUT);
 }
 
 void cofactions::drop_action_copy_ttl_out(const cindex &index) {
-  if (rofl::openflow::OFPAT_COPY_TTL_OUT != actions_index[index]) {
-    throw eActionInvalType();
-  }
-  drop_action(index);
+  drop_action(index, rofl::openflow::OFPAT_COPY_TTL_OUT);
 }
 
 bool cofactions::has_action_copy_ttl_out(const cindex &index) const {
-  return ((actions_index.find(index) != actions_index.end()) &&
-          (rofl::openflow::OFPAT_COPY_TTL_OUT == actions_index.at(index)));
+  return has_action(index, rofl::openflow::OFPAT_COPY_TTL_OUT);
 }
 
 cofaction_copy_ttl_in &cofactions::add_action_copy_ttl_in(const cindex &index) {
   if (get_version() < rofl::openflow12::OFP_VERSION)
     throw eBadVersion("cofactions::add_action_copy_ttl_in() invalid version");
 
-  if (actions_index.find(index) != actions_index.end()) {
-    delete actions[index];
-  }
-  actions[index] = new cofaction_copy_ttl_in(ofp_version);
-  actions_index[index] = rofl::openflow::OFPAT_COPY_TTL_IN;
-  return dynamic_cast<cofaction_copy_ttl_in &>(*(actions[index]));
+  return add_action<cofaction_copy_ttl_in>(index,
+                                           rofl::openflow::OFPAT_COPY_TTL_IN);
 }
 
 cofaction_copy_ttl_in &cofactions::set_action_copy_ttl_in(const cindex &index) {
   if (get_version() < rofl::openflow12::OFP_VERSION)
     throw eBadVersion("cofactions::set_action_copy_ttl_in() invalid version");
 
-  if (actions_index.find(index) == actions_index.end()) {
-    actions[index] = new cofaction_copy_ttl_in(ofp_version);
-    actions_index[index] = rofl::openflow::OFPAT_COPY_TTL_IN;
-  }
-  return dynamic_cast<cofaction_copy_ttl_in &>(*(actions[index]));
+  return set_action<cofaction_copy_ttl_in>(index,
+                                           rofl::openflow::OFPAT_COPY_TTL_IN);
 }
 
 const cofaction_copy_ttl_in &
 cofactions::get_action_copy_ttl_in(const cindex &index) const {
-  if ((actions_index.find(index) == actions_index.end()) ||
-      (rofl::openflow::OFPAT_COPY_TTL_IN != actions_index.at(index))) {
-    throw eActionNotFound();
-  }
-  return dynamic_cast<const cofaction_copy_ttl_in &>(*(actions.at(index)));
+  return get_action<cofaction_copy_ttl_in>(index,
+                                           rofl::openflow::OFPAT_COPY_TTL_IN);
 }
 
 void cofactions::drop_action_copy_ttl_in(const cindex &index) {
-  if (rofl::openflow::OFPAT_COPY_TTL_IN != actions_index[index]) {
-    throw eActionInvalType();
-  }
-  drop_action(index);
+  drop_action(index, rofl::openflow::OFPAT_COPY_TTL_IN);
 }
 
 bool cofactions::has_action_copy_ttl_in(const cindex &index) const {
-  return ((actions_index.find(index) != actions_index.end()) &&
-          (rofl::openflow::OFPAT_COPY_TTL_IN == actions_index.at(index)));
+  return has_action(index, rofl::openflow::OFPAT_COPY_TTL_IN);
 }
 
 cofaction_set_mpls_ttl &
@@ -1063,12 +936,8 @@ cofactions::add_action_set_mpls_ttl(const cindex &index) {
   if (get_version() < rofl::openflow12::OFP_VERSION)
     throw eBadVersion("cofactions::add_action_set_mpls_ttl() invalid version");
 
-  if (actions_index.find(index) != actions_index.end()) {
-    delete actions[index];
-  }
-  actions[index] = new cofaction_set_mpls_ttl(ofp_version);
-  actions_index[index] = rofl::openflow::OFPAT_SET_MPLS_TTL;
-  return dynamic_cast<cofaction_set_mpls_ttl &>(*(actions[index]));
+  return add_action<cofaction_set_mpls_ttl>(index,
+                                            rofl::openflow::OFPAT_SET_MPLS_TTL);
 }
 
 cofaction_set_mpls_ttl &
@@ -1076,32 +945,22 @@ cofactions::set_action_set_mpls_ttl(const cindex &index) {
   if (get_version() < rofl::openflow12::OFP_VERSION)
     throw eBadVersion("cofactions::set_action_set_mpls_ttl() invalid version");
 
-  if (actions_index.find(index) == actions_index.end()) {
-    actions[index] = new cofaction_set_mpls_ttl(ofp_version);
-    actions_index[index] = rofl::openflow::OFPAT_SET_MPLS_TTL;
-  }
-  return dynamic_cast<cofaction_set_mpls_ttl &>(*(actions[index]));
+  return set_action<cofaction_set_mpls_ttl>(index,
+                                            rofl::openflow::OFPAT_SET_MPLS_TTL);
 }
 
 const cofaction_set_mpls_ttl &
 cofactions::get_action_set_mpls_ttl(const cindex &index) const {
-  if ((actions_index.find(index) == actions_index.end()) ||
-      (rofl::openflow::OFPAT_SET_MPLS_TTL != actions_index.at(index))) {
-    throw eActionNotFound();
-  }
-  return dynamic_cast<const cofaction_set_mpls_ttl &>(*(actions.at(index)));
+  return get_action<cofaction_set_mpls_ttl>(index,
+                                            rofl::openflow::OFPAT_SET_MPLS_TTL);
 }
 
 void cofactions::drop_action_set_mpls_ttl(const cindex &index) {
-  if (rofl::openflow::OFPAT_SET_MPLS_TTL != actions_index[index]) {
-    throw eActionInvalType();
-  }
-  drop_action(index);
+  drop_action(index, rofl::openflow::OFPAT_SET_MPLS_TTL);
 }
 
 bool cofactions::has_action_set_mpls_ttl(const cindex &index) const {
-  return ((actions_index.find(index) != actions_index.end()) &&
-          (rofl::openflow::OFPAT_SET_MPLS_TTL == actions_index.at(index)));
+  return has_action(index, rofl::openflow::OFPAT_SET_MPLS_TTL);
 }
 
 cofaction_dec_mpls_ttl &
@@ -1109,12 +968,8 @@ cofactions::add_action_dec_mpls_ttl(const cindex &index) {
   if (get_version() < rofl::openflow12::OFP_VERSION)
     throw eBadVersion("cofactions::add_action_dec_mpls_ttl() invalid version");
 
-  if (actions_index.find(index) != actions_index.end()) {
-    delete actions[index];
-  }
-  actions[index] = new cofaction_dec_mpls_ttl(ofp_version);
-  actions_index[index] = rofl::openflow::OFPAT_DEC_MPLS_TTL;
-  return dynamic_cast<cofaction_dec_mpls_ttl &>(*(actions[index]));
+  return add_action<cofaction_dec_mpls_ttl>(index,
+                                            rofl::openflow::OFPAT_DEC_MPLS_TTL);
 }
 
 cofaction_dec_mpls_ttl &
@@ -1122,427 +977,282 @@ cofactions::set_action_dec_mpls_ttl(const cindex &index) {
   if (get_version() < rofl::openflow12::OFP_VERSION)
     throw eBadVersion("cofactions::set_action_dec_mpls_ttl() invalid version");
 
-  if (actions_index.find(index) == actions_index.end()) {
-    actions[index] = new cofaction_dec_mpls_ttl(ofp_version);
-    actions_index[index] = rofl::openflow::OFPAT_DEC_MPLS_TTL;
-  }
-  return dynamic_cast<cofaction_dec_mpls_ttl &>(*(actions[index]));
+  return set_action<cofaction_dec_mpls_ttl>(index,
+                                            rofl::openflow::OFPAT_DEC_MPLS_TTL);
 }
 
 const cofaction_dec_mpls_ttl &
 cofactions::get_action_dec_mpls_ttl(const cindex &index) const {
-  if ((actions_index.find(index) == actions_index.end()) ||
-      (rofl::openflow::OFPAT_DEC_MPLS_TTL != actions_index.at(index))) {
-    throw eActionNotFound();
-  }
-  return dynamic_cast<const cofaction_dec_mpls_ttl &>(*(actions.at(index)));
+  return get_action<cofaction_dec_mpls_ttl>(index,
+                                            rofl::openflow::OFPAT_DEC_MPLS_TTL);
 }
 
 void cofactions::drop_action_dec_mpls_ttl(const cindex &index) {
-  if (rofl::openflow::OFPAT_DEC_MPLS_TTL != actions_index[index]) {
-    throw eActionInvalType();
-  }
-  drop_action(index);
+  drop_action(index, rofl::openflow::OFPAT_DEC_MPLS_TTL);
 }
 
 bool cofactions::has_action_dec_mpls_ttl(const cindex &index) const {
-  return ((actions_index.find(index) != actions_index.end()) &&
-          (rofl::openflow::OFPAT_DEC_MPLS_TTL == actions_index.at(index)));
+  return has_action(index, rofl::openflow::OFPAT_DEC_MPLS_TTL);
 }
 
 cofaction_push_vlan &cofactions::add_action_push_vlan(const cindex &index) {
   if (get_version() < rofl::openflow12::OFP_VERSION)
     throw eBadVersion("cofactions::add_action_push_vlan() invalid version");
 
-  if (actions_index.find(index) != actions_index.end()) {
-    delete actions[index];
-  }
-  actions[index] = new cofaction_push_vlan(ofp_version);
-  actions_index[index] = rofl::openflow::OFPAT_PUSH_VLAN;
-  return dynamic_cast<cofaction_push_vlan &>(*(actions[index]));
+  return add_action<cofaction_push_vlan>(index,
+                                         rofl::openflow::OFPAT_PUSH_VLAN);
 }
 
 cofaction_push_vlan &cofactions::set_action_push_vlan(const cindex &index) {
   if (get_version() < rofl::openflow12::OFP_VERSION)
     throw eBadVersion("cofactions::set_action_push_vlan() invalid version");
 
-  if (actions_index.find(index) == actions_index.end()) {
-    actions[index] = new cofaction_push_vlan(ofp_version);
-    actions_index[index] = rofl::openflow::OFPAT_PUSH_VLAN;
-  }
-  return dynamic_cast<cofaction_push_vlan &>(*(actions[index]));
+  return set_action<cofaction_push_vlan>(index,
+                                         rofl::openflow::OFPAT_PUSH_VLAN);
 }
 
 const cofaction_push_vlan &
 cofactions::get_action_push_vlan(const cindex &index) const {
-  if ((actions_index.find(index) == actions_index.end()) ||
-      (rofl::openflow::OFPAT_PUSH_VLAN != actions_index.at(index))) {
-    throw eActionNotFound();
-  }
-  return dynamic_cast<const cofaction_push_vlan &>(*(actions.at(index)));
+  return get_action<cofaction_push_vlan>(index,
+                                         rofl::openflow::OFPAT_PUSH_VLAN);
 }
 
 void cofactions::drop_action_push_vlan(const cindex &index) {
-  if (rofl::openflow::OFPAT_PUSH_VLAN != actions_index[index]) {
-    throw eActionInvalType();
-  }
-  drop_action(index);
+  drop_action(index, rofl::openflow::OFPAT_PUSH_VLAN);
 }
 
 bool cofactions::has_action_push_vlan(const cindex &index) const {
-  return ((actions_index.find(index) != actions_index.end()) &&
-          (rofl::openflow::OFPAT_PUSH_VLAN == actions_index.at(index)));
+  return has_action(index, rofl::openflow::OFPAT_PUSH_VLAN);
 }
 
 cofaction_pop_vlan &cofactions::add_action_pop_vlan(const cindex &index) {
   if (get_version() < rofl::openflow12::OFP_VERSION)
     throw eBadVersion("cofactions::add_action_pop_vlan() invalid version");
 
-  if (actions_index.find(index) != actions_index.end()) {
-    delete actions[index];
-  }
-  actions[index] = new cofaction_pop_vlan(ofp_version);
-  actions_index[index] = rofl::openflow::OFPAT_POP_VLAN;
-  return dynamic_cast<cofaction_pop_vlan &>(*(actions[index]));
+  return add_action<cofaction_pop_vlan>(index, rofl::openflow::OFPAT_POP_VLAN);
 }
 
 cofaction_pop_vlan &cofactions::set_action_pop_vlan(const cindex &index) {
   if (get_version() < rofl::openflow12::OFP_VERSION)
     throw eBadVersion("cofactions::set_action_pop_vlan() invalid version");
 
-  if (actions_index.find(index) == actions_index.end()) {
-    actions[index] = new cofaction_pop_vlan(ofp_version);
-    actions_index[index] = rofl::openflow::OFPAT_POP_VLAN;
-  }
-  return dynamic_cast<cofaction_pop_vlan &>(*(actions[index]));
+  return set_action<cofaction_pop_vlan>(index, rofl::openflow::OFPAT_POP_VLAN);
 }
 
 const cofaction_pop_vlan &
 cofactions::get_action_pop_vlan(const cindex &index) const {
-  if ((actions_index.find(index) == actions_index.end()) ||
-      (rofl::openflow::OFPAT_POP_VLAN != actions_index.at(index))) {
-    throw eActionNotFound();
-  }
-  return dynamic_cast<const cofaction_pop_vlan &>(*(actions.at(index)));
+  return get_action<cofaction_pop_vlan>(index, rofl::openflow::OFPAT_POP_VLAN);
 }
 
 void cofactions::drop_action_pop_vlan(const cindex &index) {
-  if (rofl::openflow::OFPAT_POP_VLAN != actions_index[index]) {
-    throw eActionInvalType();
-  }
-  drop_action(index);
+  drop_action(index, rofl::openflow::OFPAT_POP_VLAN);
 }
 
 bool cofactions::has_action_pop_vlan(const cindex &index) const {
-  return ((actions_index.find(index) != actions_index.end()) &&
-          (rofl::openflow::OFPAT_POP_VLAN == actions_index.at(index)));
+  return has_action(index, rofl::openflow::OFPAT_POP_VLAN);
 }
 
 cofaction_push_mpls &cofactions::add_action_push_mpls(const cindex &index) {
   if (get_version() < rofl::openflow12::OFP_VERSION)
     throw eBadVersion("cofactions::add_action_push_mpls() invalid version");
 
-  if (actions_index.find(index) != actions_index.end()) {
-    delete actions[index];
-  }
-  actions[index] = new cofaction_push_mpls(ofp_version);
-  actions_index[index] = rofl::openflow::OFPAT_PUSH_MPLS;
-  return dynamic_cast<cofaction_push_mpls &>(*(actions[index]));
+  return add_action<cofaction_push_mpls>(index,
+                                         rofl::openflow::OFPAT_PUSH_MPLS);
 }
 
 cofaction_push_mpls &cofactions::set_action_push_mpls(const cindex &index) {
   if (get_version() < rofl::openflow12::OFP_VERSION)
     throw eBadVersion("cofactions::set_action_push_mpls() invalid version");
 
-  if (actions_index.find(index) == actions_index.end()) {
-    actions[index] = new cofaction_push_mpls(ofp_version);
-    actions_index[index] = rofl::openflow::OFPAT_PUSH_MPLS;
-  }
-  return dynamic_cast<cofaction_push_mpls &>(*(actions[index]));
+  return set_action<cofaction_push_mpls>(index,
+                                         rofl::openflow::OFPAT_PUSH_MPLS);
 }
 
 const cofaction_push_mpls &
 cofactions::get_action_push_mpls(const cindex &index) const {
-  if ((actions_index.find(index) == actions_index.end()) ||
-      (rofl::openflow::OFPAT_PUSH_MPLS != actions_index.at(index))) {
-    throw eActionNotFound();
-  }
-  return dynamic_cast<const cofaction_push_mpls &>(*(actions.at(index)));
+  return get_action<cofaction_push_mpls>(index,
+                                         rofl::openflow::OFPAT_PUSH_MPLS);
 }
 
 void cofactions::drop_action_push_mpls(const cindex &index) {
-  if (rofl::openflow::OFPAT_PUSH_MPLS != actions_index[index]) {
-    throw eActionInvalType();
-  }
-  drop_action(index);
+  drop_action(index, rofl::openflow::OFPAT_PUSH_MPLS);
 }
 
 bool cofactions::has_action_push_mpls(const cindex &index) const {
-  return ((actions_index.find(index) != actions_index.end()) &&
-          (rofl::openflow::OFPAT_PUSH_MPLS == actions_index.at(index)));
+  return has_action(index, rofl::openflow::OFPAT_PUSH_MPLS);
 }
 
 cofaction_pop_mpls &cofactions::add_action_pop_mpls(const cindex &index) {
   if (get_version() < rofl::openflow12::OFP_VERSION)
     throw eBadVersion("cofactions::add_action_pop_mpls() invalid version");
 
-  if (actions_index.find(index) != actions_index.end()) {
-    delete actions[index];
-  }
-  actions[index] = new cofaction_pop_mpls(ofp_version);
-  actions_index[index] = rofl::openflow::OFPAT_POP_MPLS;
-  return dynamic_cast<cofaction_pop_mpls &>(*(actions[index]));
+  return add_action<cofaction_pop_mpls>(index, rofl::openflow::OFPAT_POP_MPLS);
 }
 
 cofaction_pop_mpls &cofactions::set_action_pop_mpls(const cindex &index) {
   if (get_version() < rofl::openflow12::OFP_VERSION)
     throw eBadVersion("cofactions::set_action_pop_mpls() invalid version");
 
-  if (actions_index.find(index) == actions_index.end()) {
-    actions[index] = new cofaction_pop_mpls(ofp_version);
-    actions_index[index] = rofl::openflow::OFPAT_POP_MPLS;
-  }
-  return dynamic_cast<cofaction_pop_mpls &>(*(actions[index]));
+  return set_action<cofaction_pop_mpls>(index, rofl::openflow::OFPAT_POP_MPLS);
 }
 
 const cofaction_pop_mpls &
 cofactions::get_action_pop_mpls(const cindex &index) const {
-  if ((actions_index.find(index) == actions_index.end()) ||
-      (rofl::openflow::OFPAT_POP_MPLS != actions_index.at(index))) {
-    throw eActionNotFound();
-  }
-  return dynamic_cast<const cofaction_pop_mpls &>(*(actions.at(index)));
+  return get_action<cofaction_pop_mpls>(index, rofl::openflow::OFPAT_POP_MPLS);
 }
 
 void cofactions::drop_action_pop_mpls(const cindex &index) {
-  if (rofl::openflow::OFPAT_POP_MPLS != actions_index[index]) {
-    throw eActionInvalType();
-  }
-  drop_action(index);
+  drop_action(index, rofl::openflow::OFPAT_POP_MPLS);
 }
 
 bool cofactions::has_action_pop_mpls(const cindex &index) const {
-  return ((actions_index.find(index) != actions_index.end()) &&
-          (rofl::openflow::OFPAT_POP_MPLS == actions_index.at(index)));
+  return has_action(index, rofl::openflow::OFPAT_POP_MPLS);
 }
 
 cofaction_group &cofactions::add_action_group(const cindex &index) {
   if (get_version() < rofl::openflow12::OFP_VERSION)
     throw eBadVersion("cofactions::add_action_group() invalid version");
 
-  if (actions_index.find(index) != actions_index.end()) {
-    delete actions[index];
-  }
-  actions[index] = new cofaction_group(ofp_version);
-  actions_index[index] = rofl::openflow::OFPAT_GROUP;
-  return dynamic_cast<cofaction_group &>(*(actions[index]));
+  return add_action<cofaction_group>(index, rofl::openflow::OFPAT_GROUP);
 }
 
 cofaction_group &cofactions::set_action_group(const cindex &index) {
   if (get_version() < rofl::openflow12::OFP_VERSION)
     throw eBadVersion("cofactions::set_action_group() invalid version");
 
-  if (actions_index.find(index) == actions_index.end()) {
-    actions[index] = new cofaction_group(ofp_version);
-    actions_index[index] = rofl::openflow::OFPAT_GROUP;
-  }
-  return dynamic_cast<cofaction_group &>(*(actions[index]));
+  return set_action<cofaction_group>(index, rofl::openflow::OFPAT_GROUP);
 }
 
 const cofaction_group &cofactions::get_action_group(const cindex &index) const {
-  if ((actions_index.find(index) == actions_index.end()) ||
-      (rofl::openflow::OFPAT_GROUP != actions_index.at(index))) {
-    throw eActionNotFound();
-  }
-  return dynamic_cast<const cofaction_group &>(*(actions.at(index)));
+  return get_action<cofaction_group>(index, rofl::openflow::OFPAT_GROUP);
 }
 
 void cofactions::drop_action_group(const cindex &index) {
-  if (rofl::openflow::OFPAT_GROUP != actions_index[index]) {
-    throw eActionInvalType();
-  }
-  drop_action(index);
+  drop_action(index, rofl::openflow::OFPAT_GROUP);
 }
 
 bool cofactions::has_action_group(const cindex &index) const {
-  return ((actions_index.find(index) != actions_index.end()) &&
-          (rofl::openflow::OFPAT_GROUP == actions_index.at(index)));
+  return has_action(index, rofl::openflow::OFPAT_GROUP);
 }
 
 cofaction_set_nw_ttl &cofactions::add_action_set_nw_ttl(const cindex &index) {
   if (get_version() < rofl::openflow12::OFP_VERSION)
     throw eBadVersion("cofactions::add_action_set_nw_ttl() invalid version");
 
-  if (actions_index.find(index) != actions_index.end()) {
-    delete actions[index];
-  }
-  actions[index] = new cofaction_set_nw_ttl(ofp_version);
-  actions_index[index] = rofl::openflow::OFPAT_SET_NW_TTL;
-  return dynamic_cast<cofaction_set_nw_ttl &>(*(actions[index]));
+  return add_action<cofaction_set_nw_ttl>(index,
+                                          rofl::openflow::OFPAT_SET_NW_TTL);
 }
 
 cofaction_set_nw_ttl &cofactions::set_action_set_nw_ttl(const cindex &index) {
   if (get_version() < rofl::openflow12::OFP_VERSION)
     throw eBadVersion("cofactions::set_action_set_nw_ttl() invalid version");
 
-  if (actions_index.find(index) == actions_index.end()) {
-    actions[index] = new cofaction_set_nw_ttl(ofp_version);
-    actions_index[index] = rofl::openflow::OFPAT_SET_NW_TTL;
-  }
-  return dynamic_cast<cofaction_set_nw_ttl &>(*(actions[index]));
+  return set_action<cofaction_set_nw_ttl>(index,
+                                          rofl::openflow::OFPAT_SET_NW_TTL);
 }
 
 const cofaction_set_nw_ttl &
 cofactions::get_action_set_nw_ttl(const cindex &index) const {
-  if ((actions_index.find(index) == actions_index.end()) ||
-      (rofl::openflow::OFPAT_SET_NW_TTL != actions_index.at(index))) {
-    throw eActionNotFound();
-  }
-  return dynamic_cast<const cofaction_set_nw_ttl &>(*(actions.at(index)));
+  return get_action<cofaction_set_nw_ttl>(index,
+                                          rofl::openflow::OFPAT_SET_NW_TTL);
 }
 
 void cofactions::drop_action_set_nw_ttl(const cindex &index) {
-  if (rofl::openflow::OFPAT_SET_NW_TTL != actions_index[index]) {
-    throw eActionInvalType();
-  }
-  drop_action(index);
+  drop_action(index, rofl::openflow::OFPAT_SET_NW_TTL);
 }
 
 bool cofactions::has_action_set_nw_ttl(const cindex &index) const {
-  return ((actions_index.find(index) != actions_index.end()) &&
-          (rofl::openflow::OFPAT_SET_NW_TTL == actions_index.at(index)));
+  return has_action(index, rofl::openflow::OFPAT_SET_NW_TTL);
 }
 
 cofaction_dec_nw_ttl &cofactions::add_action_dec_nw_ttl(const cindex &index) {
   if (get_version() < rofl::openflow12::OFP_VERSION)
     throw eBadVersion("cofactions::add_action_dec_nw_ttl() invalid version");
 
-  if (actions_index.find(index) != actions_index.end()) {
-    delete actions[index];
-  }
-  actions[index] = new cofaction_dec_nw_ttl(ofp_version);
-  actions_index[index] = rofl::openflow::OFPAT_DEC_NW_TTL;
-  return dynamic_cast<cofaction_dec_nw_ttl &>(*(actions[index]));
+  return add_action<cofaction_dec_nw_ttl>(index,
+                                          rofl::openflow::OFPAT_DEC_NW_TTL);
 }
 
 cofaction_dec_nw_ttl &cofactions::set_action_dec_nw_ttl(const cindex &index) {
   if (get_version() < rofl::openflow12::OFP_VERSION)
     throw eBadVersion("cofactions::set_action_dec_nw_ttl() invalid version");
 
-  if (actions_index.find(index) == actions_index.end()) {
-    actions[index] = new cofaction_dec_nw_ttl(ofp_version);
-    actions_index[index] = rofl::openflow::OFPAT_DEC_NW_TTL;
-  }
-  return dynamic_cast<cofaction_dec_nw_ttl &>(*(actions[index]));
+  return set_action<cofaction_dec_nw_ttl>(index,
+                                          rofl::openflow::OFPAT_DEC_NW_TTL);
 }
 
 const cofaction_dec_nw_ttl &
 cofactions::get_action_dec_nw_ttl(const cindex &index) const {
-  if ((actions_index.find(index) == actions_index.end()) ||
-      (rofl::openflow::OFPAT_DEC_NW_TTL != actions_index.at(index))) {
-    throw eActionNotFound();
-  }
-  return dynamic_cast<const cofaction_dec_nw_ttl &>(*(actions.at(index)));
+  return get_action<cofaction_dec_nw_ttl>(index,
+                                          rofl::openflow::OFPAT_DEC_NW_TTL);
 }
 
 void cofactions::drop_action_dec_nw_ttl(const cindex &index) {
-  if (rofl::openflow::OFPAT_DEC_NW_TTL != actions_index[index]) {
-    throw eActionInvalType();
-  }
-  drop_action(index);
+  drop_action(index, rofl::openflow::OFPAT_DEC_NW_TTL);
 }
 
 bool cofactions::has_action_dec_nw_ttl(const cindex &index) const {
-  return ((actions_index.find(index) != actions_index.end()) &&
-          (rofl::openflow::OFPAT_DEC_NW_TTL == actions_index.at(index)));
+  return has_action(index, rofl::openflow::OFPAT_DEC_NW_TTL);
 }
 
 cofaction_set_queue &cofactions::add_action_set_queue(const cindex &index) {
   if (get_version() < rofl::openflow12::OFP_VERSION)
     throw eBadVersion("cofactions::add_action_set_queue() invalid version");
 
-  if (actions_index.find(index) != actions_index.end()) {
-    delete actions[index];
-  }
-  actions[index] = new cofaction_set_queue(ofp_version);
-  actions_index[index] = rofl::openflow::OFPAT_SET_QUEUE;
-  return dynamic_cast<cofaction_set_queue &>(*(actions[index]));
+  return add_action<cofaction_set_queue>(index,
+                                         rofl::openflow::OFPAT_SET_QUEUE);
 }
 
 cofaction_set_queue &cofactions::set_action_set_queue(const cindex &index) {
   if (get_version() < rofl::openflow12::OFP_VERSION)
     throw eBadVersion("cofactions::set_action_set_queue() invalid version");
 
-  if (actions_index.find(index) == actions_index.end()) {
-    actions[index] = new cofaction_set_queue(ofp_version);
-    actions_index[index] = rofl::openflow::OFPAT_SET_QUEUE;
-  }
-  return dynamic_cast<cofaction_set_queue &>(*(actions[index]));
+  return set_action<cofaction_set_queue>(index,
+                                         rofl::openflow::OFPAT_SET_QUEUE);
 }
 
 const cofaction_set_queue &
 cofactions::get_action_set_queue(const cindex &index) const {
-  if ((actions_index.find(index) == actions_index.end()) ||
-      (rofl::openflow::OFPAT_SET_QUEUE != actions_index.at(index))) {
-    throw eActionNotFound();
-  }
-  return dynamic_cast<const cofaction_set_queue &>(*(actions.at(index)));
+  return get_action<cofaction_set_queue>(index,
+                                         rofl::openflow::OFPAT_SET_QUEUE);
 }
 
 void cofactions::drop_action_set_queue(const cindex &index) {
-  if (rofl::openflow::OFPAT_SET_QUEUE != actions_index[index]) {
-    throw eActionInvalType();
-  }
-  drop_action(index);
+  drop_action(index, rofl::openflow::OFPAT_SET_QUEUE);
 }
 
 bool cofactions::has_action_set_queue(const cindex &index) const {
-  return ((actions_index.find(index) != actions_index.end()) &&
-          (rofl::openflow::OFPAT_SET_QUEUE == actions_index.at(index)));
+  return has_action(index, rofl::openflow::OFPAT_SET_QUEUE);
 }
 
 cofaction_set_field &cofactions::add_action_set_field(const cindex &index) {
   if (get_version() < rofl::openflow12::OFP_VERSION)
     throw eBadVersion("cofactions::add_action_set_field() invalid version");
 
-  if (actions_index.find(index) != actions_index.end()) {
-    delete actions[index];
-  }
-  actions[index] = new cofaction_set_field(ofp_version);
-  actions_index[index] = rofl::openflow::OFPAT_SET_FIELD;
-  return dynamic_cast<cofaction_set_field &>(*(actions[index]));
+  return add_action<cofaction_set_field>(index,
+                                         rofl::openflow::OFPAT_SET_FIELD);
 }
 
 cofaction_set_field &cofactions::set_action_set_field(const cindex &index) {
   if (get_version() < rofl::openflow12::OFP_VERSION)
     throw eBadVersion("cofactions::set_action_set_field() invalid version");
 
-  if (actions_index.find(index) == actions_index.end()) {
-    actions[index] = new cofaction_set_field(ofp_version);
-    actions_index[index] = rofl::openflow::OFPAT_SET_FIELD;
-  }
-  return dynamic_cast<cofaction_set_field &>(*(actions[index]));
+  return set_action<cofaction_set_field>(index,
+                                         rofl::openflow::OFPAT_SET_FIELD);
 }
 
 const cofaction_set_field &
 cofactions::get_action_set_field(const cindex &index) const {
-  if ((actions_index.find(index) == actions_index.end()) ||
-      (rofl::openflow::OFPAT_SET_FIELD != actions_index.at(index))) {
-    throw eActionNotFound();
-  }
-  return dynamic_cast<const cofaction_set_field &>(*(actions.at(index)));
+  return get_action<cofaction_set_field>(index,
+                                         rofl::openflow::OFPAT_SET_FIELD);
 }
 
 void cofactions::drop_action_set_field(const cindex &index) {
-  if (rofl::openflow::OFPAT_SET_FIELD != actions_index[index]) {
-    throw eActionInvalType();
-  }
-  drop_action(index);
+  drop_action(index, rofl::openflow::OFPAT_SET_FIELD);
 }
 
 bool cofactions::has_action_set_field(const cindex &index) const {
-  return ((actions_index.find(index) != actions_index.end()) &&
-          (rofl::openflow::OFPAT_SET_FIELD == actions_index.at(index)));
+  return has_action(index, rofl::openflow::OFPAT_SET_FIELD);
 }
 
 cofaction_experimenter &
@@ -1550,12 +1260,8 @@ cofactions::add_action_experimenter(const cindex &index) {
   if (get_version() < rofl::openflow12::OFP_VERSION)
     throw eBadVersion("cofactions::add_action_experimenter() invalid version");
 
-  if (actions_index.find(index) != actions_index.end()) {
-    delete actions[index];
-  }
-  actions[index] = new cofaction_experimenter(ofp_version);
-  actions_index[index] = rofl::openflow::OFPAT_EXPERIMENTER;
-  return dynamic_cast<cofaction_experimenter &>(*(actions[index]));
+  return add_action<cofaction_experimenter>(index,
+                                            rofl::openflow::OFPAT_EXPERIMENTER);
 }
 
 cofaction_experimenter &
@@ -1563,118 +1269,74 @@ cofactions::set_action_experimenter(const cindex &index) {
   if (get_version() < rofl::openflow12::OFP_VERSION)
     throw eBadVersion("cofactions::set_action_experimenter() invalid version");
 
-  if (actions_index.find(index) == actions_index.end()) {
-    actions[index] = new cofaction_experimenter(ofp_version);
-    actions_index[index] = rofl::openflow::OFPAT_EXPERIMENTER;
-  }
-  return dynamic_cast<cofaction_experimenter &>(*(actions[index]));
+  return set_action<cofaction_experimenter>(index,
+                                            rofl::openflow::OFPAT_EXPERIMENTER);
 }
 
 const cofaction_experimenter &
 cofactions::get_action_experimenter(const cindex &index) const {
-  if ((actions_index.find(index) == actions_index.end()) ||
-      (rofl::openflow::OFPAT_EXPERIMENTER != actions_index.at(index))) {
-    throw eActionNotFound();
-  }
-  return dynamic_cast<const cofaction_experimenter &>(*(actions.at(index)));
+  return get_action<cofaction_experimenter>(index,
+                                            rofl::openflow::OFPAT_EXPERIMENTER);
 }
 
 void cofactions::drop_action_experimenter(const cindex &index) {
-  if (rofl::openflow::OFPAT_EXPERIMENTER != actions_index[index]) {
-    throw eActionInvalType();
-  }
-  drop_action(index);
+  drop_action(index, rofl::openflow::OFPAT_EXPERIMENTER);
 }
 
 bool cofactions::has_action_experimenter(const cindex &index) const {
-  return ((actions_index.find(index) != actions_index.end()) &&
-          (rofl::openflow::OFPAT_EXPERIMENTER == actions_index.at(index)));
+  return has_action(index, rofl::openflow::OFPAT_EXPERIMENTER);
 }
 
 cofaction_push_pbb &cofactions::add_action_push_pbb(const cindex &index) {
   if (get_version() < rofl::openflow13::OFP_VERSION)
     throw eBadVersion("cofactions::add_action_push_pbb() invalid version");
 
-  if (actions_index.find(index) != actions_index.end()) {
-    delete actions[index];
-  }
-  actions[index] = new cofaction_push_pbb(ofp_version);
-  actions_index[index] = rofl::openflow::OFPAT_PUSH_PBB;
-  return dynamic_cast<cofaction_push_pbb &>(*(actions[index]));
+  return add_action<cofaction_push_pbb>(index, rofl::openflow::OFPAT_PUSH_PBB);
 }
 
 cofaction_push_pbb &cofactions::set_action_push_pbb(const cindex &index) {
   if (get_version() < rofl::openflow13::OFP_VERSION)
     throw eBadVersion("cofactions::set_action_push_pbb() invalid version");
 
-  if (actions_index.find(index) == actions_index.end()) {
-    actions[index] = new cofaction_push_pbb(ofp_version);
-    actions_index[index] = rofl::openflow::OFPAT_PUSH_PBB;
-  }
-  return dynamic_cast<cofaction_push_pbb &>(*(actions[index]));
+  return set_action<cofaction_push_pbb>(index, rofl::openflow::OFPAT_PUSH_PBB);
 }
 
 const cofaction_push_pbb &
 cofactions::get_action_push_pbb(const cindex &index) const {
-  if ((actions_index.find(index) == actions_index.end()) ||
-      (rofl::openflow::OFPAT_PUSH_PBB != actions_index.at(index))) {
-    throw eActionNotFound();
-  }
-  return dynamic_cast<const cofaction_push_pbb &>(*(actions.at(index)));
+  return get_action<cofaction_push_pbb>(index, rofl::openflow::OFPAT_PUSH_PBB);
 }
 
 void cofactions::drop_action_push_pbb(const cindex &index) {
-  if (rofl::openflow::OFPAT_PUSH_PBB != actions_index[index]) {
-    throw eActionInvalType();
-  }
-  drop_action(index);
+  drop_action(index, rofl::openflow::OFPAT_PUSH_PBB);
 }
 
 bool cofactions::has_action_push_pbb(const cindex &index) const {
-  return ((actions_index.find(index) != actions_index.end()) &&
-          (rofl::openflow::OFPAT_PUSH_PBB == actions_index.at(index)));
+  return has_action(index, rofl::openflow::OFPAT_PUSH_PBB);
 }
 
 cofaction_pop_pbb &cofactions::add_action_pop_pbb(const cindex &index) {
   if (get_version() < rofl::openflow13::OFP_VERSION)
     throw eBadVersion("cofactions::add_action_pop_pbb() invalid version");
 
-  if (actions_index.find(index) != actions_index.end()) {
-    delete actions[index];
-  }
-  actions[index] = new cofaction_pop_pbb(ofp_version);
-  actions_index[index] = rofl::openflow::OFPAT_POP_PBB;
-  return dynamic_cast<cofaction_pop_pbb &>(*(actions[index]));
+  return add_action<cofaction_pop_pbb>(index, rofl::openflow::OFPAT_POP_PBB);
 }
 
 cofaction_pop_pbb &cofactions::set_action_pop_pbb(const cindex &index) {
   if (get_version() < rofl::openflow13::OFP_VERSION)
     throw eBadVersion("cofactions::set_action_pop_pbb() invalid version");
 
-  if (actions_index.find(index) == actions_index.end()) {
-    actions[index] = new cofaction_pop_pbb(ofp_version);
-    actions_index[index] = rofl::openflow::OFPAT_POP_PBB;
-  }
-  return dynamic_cast<cofaction_pop_pbb &>(*(actions[index]));
+  return set_action<cofaction_pop_pbb>(index, rofl::openflow::OFPAT_POP_PBB);
 }
 
 const cofaction_pop_pbb &
 cofactions::get_action_pop_pbb(const cindex &index) const {
-  if ((actions_index.find(index) == actions_index.end()) ||
-      (rofl::openflow::OFPAT_POP_PBB != actions_index.at(index))) {
-    throw eActionNotFound();
-  }
-  return dynamic_cast<const cofaction_pop_pbb &>(*(actions.at(index)));
+  return get_action<cofaction_pop_pbb>(index, rofl::openflow::OFPAT_POP_PBB);
 }
 
 void cofactions::drop_action_pop_pbb(const cindex &index) {
-  if (rofl::openflow::OFPAT_POP_PBB != actions_index[index]) {
-    throw eActionInvalType();
-  }
-  drop_action(index);
+  drop_action(index, rofl::openflow::OFPAT_POP_PBB);
 }
 
 bool cofactions::has_action_pop_pbb(const cindex &index) const {
-  return ((actions_index.find(index) != actions_index.end()) &&
-          (rofl::openflow::OFPAT_POP_PBB == actions_index.at(index)));
+  return has_action(index, rofl::openflow::OFPAT_POP_PBB);
 }
@@ -9,6 +9,8 @@
 #include <inttypes.h>
 #include <list>
 #include <map>
+#include <new>
+#include <utility>
 
 #include "rofl/common/cindex.h"
 #include "rofl/common/exception.hpp"
@@ -93,9 +95,9 @@ public:
    */
   void set_version(uint8_t ofp_version) {
     this->ofp_version = ofp_version;
-    for (std::map<cindex, cofaction *>::iterator it = actions.begin();
-         it != actions.end(); ++it) {
-      it->second->set_version(ofp_version);
+    wirelen = 0;
+    for (size_t i = 0; i < num_entries; i++) {
+      entries[i].action->set_version(ofp_version);
     }
   };
 
@@ -105,31 +107,25 @@ public:
   uint8_t get_version() const { return ofp_version; };
 
   /**
-   *
-   */
-  const std::map<cindex, unsigned int> &get_actions_index() const {
-    return actions_index;
-  };
-
-  /**
-   *
+   * @brief	Returns map of action types by index
    */
-  std::map<cindex, cofaction *> &set_actions() { return actions; };
+  std::map<cindex, unsigned int> get_actions_index() const;
 
   /**
-   *
+   * @brief	Returns map of all actions, the actions remain owned by this
+   * instance
    */
-  const std::map<cindex, cofaction *> &get_actions() const { return actions; };
+  std::map<cindex, cofaction *> get_actions() const;
 
   /**
    *
    */
-  size_t size() const { return actions.size(); };
+  size_t size() const { return num_entries; };
 
   /**
    *
    */
-  bool empty() const { return actions.empty(); };
+  bool empty() const { return (0 == num_entries); };
 
 public:
   void drop_action(const cindex &index);
@@ -494,21 +490,165 @@ public:
 public:
   friend std::ostream &operator<<(std::ostream &os, cofactions const &actions) {
     os << "<cofactions ofp-version:" << (int)actions.get_version()
-       << " #actions:" << (int)actions.get_actions().size() << " >"
-       << std::endl;
-
-    for (std::map<cindex, cofaction *>::const_iterator it =
-             actions.actions.begin();
-         it != actions.actions.end(); ++it) {
-      cofaction::dump(os, *(it->second));
+       << " #actions:" << (int)actions.size() << " >" << std::endl;
+    for (size_t i = 0; i < actions.num_entries; i++) {
+      cofaction::dump(os, *(actions.entries[i].action));
     }
     return os;
   };
 
 private:
+  struct action_entry;
+
+  /**
+   * @brief	Returns entry for index or NULL
+   */
+  const struct action_entry *find_action(const cindex &index) const;
+
+  /**
+   * @brief	Replaces action at index by a new instance of T
+   */
+  template <class T> T &add_action(const cindex &index, unsigned int type) {
+    drop_action(index);
+    reserve_action();
+    T *action = construct<T>(ofp_version);
+    insert_action(index, type, action);
+    return *action;
+  };
+
+  /**
+   * @brief	Returns action at index, a new instance of T is added if missing
+   */
+  template <class T> T &set_action(const cindex &index, unsigned int type) {
+    const struct action_entry *entry = find_action(index);
+    if (NULL != entry) {
+      wirelen = 0;
+      return dynamic_cast<T &>(*(entry->action));
+    }
+    reserve_action();
+    T *action = construct<T>(ofp_version);
+    insert_action(index, type, action);
+    return *action;
+  };
+
+  /**
+   * @throws eActionNotFound no action of this type at index
+   */
+  template <class T>
+  const T &get_action(const cindex &index, unsigned int type) const {
+    const struct action_entry *entry = find_action(index);
+    if ((NULL == entry) || (type != entry->type)) {
+      throw eActionNotFound();
+    }
+    return dynamic_cast<const T &>(*(entry->action));
+  };
+
+  /**
+   * @throws eActionInvalType no action of this type at index
+   */
+  void drop_action(const cindex &index, unsigned int type);
+
+  /**
+   *
+   */
+  bool has_action(const cindex &index, unsigned int type) const;
+
+  /**
+   * @brief	Inserts action in sorted entries, reserve_action() must be called
+   * before and no action at index may exist
+   */
+  void insert_action(const cindex &index, unsigned int type,
+                     cofaction *action);
+
+  /**
+   * @brief	Ensures space for one more entry
+   */
+  void reserve_action();
+
+  /**
+   * @brief	Returns storage for an action object, an inline block if possible
+   */
+  void *alloc_action(size_t size);
+
+  /**
+   *
+   */
+  void free_action(void *mem);
+
+  /**
+   *
+   */
+  void destroy_action(cofaction *action);
+
+  /**
+   *
+   */
+  template <class T, class... Args> T *construct(Args &&... args) {
+    void *mem = alloc_action(sizeof(T));
+    try {
+      return new (mem) T(std::forward<Args>(args)...);
+    } catch (...) {
+      free_action(mem);
+      throw;
+    }
+  };
+
+  /**
+   *
+   */
+  template <class T> T *construct_from(const cofaction &orig) {
+    return construct<T>(dynamic_cast<const T &>(orig));
+  };
+
+  /**
+   * @brief	Returns a copy of an action stored with type
+   */
+  cofaction *clone_action(unsigned int type, const cofaction &orig);
+
+private:
+  // entries stored inline, a typical action list fits
+  static const size_t ACTION_INLINE_ENTRIES = 4;
+
+  // inline storage blocks for action objects
+  static const size_t ACTION_INLINE_BLOCKS = 4;
+
+  // block size, fits all actions except set-field
+  static const size_t ACTION_BLOCK_SIZE = 48;
+
+  struct action_entry {
+    cindex index;
+    unsigned int type;
+    cofaction *action;
+
+    bool operator<(const action_entry &entry) const {
+      return (index < entry.index);
+    };
+  };
+
+  struct action_block {
+    uint64_t data[ACTION_BLOCK_SIZE / sizeof(uint64_t)];
+  };
+
   uint8_t ofp_version;
-  std::map<cindex, cofaction *> actions;
-  std::map<cindex, unsigned int> actions_index;
+
+  // actions sorted by index, points to inline_entries or a heap array
+  struct action_entry *entries;
+
+  // number of actions
+  size_t num_entries;
+
+  // capacity of entries
+  size_t max_entries;
+
+  struct action_entry inline_entries[ACTION_INLINE_ENTRIES];
+
+  struct action_block blocks[ACTION_INLINE_BLOCKS];
+
+  // bitmap of blocks in use
+  uint32_t blocks_used;
+
+  // cached result of length(), 0 if stale, reset by all non-const methods
+  mutable size_t wirelen;
 };
 
 }; // end of namespace openflow
@@ -15,7 +15,7 @@ using namespace rofl::openflow;
 
 size_t cofgroupstatsarray::length() const {
   size_t len = 0;
-  for (auto it : array) {
+  for (const auto &it : array) {
     len += it.second.length();
   }
   return len;
@@ -8,13 +8,39 @@
 using namespace rofl::openflow;
 
 cofinstructions::cofinstructions(uint8_t ofp_version)
-    : ofp_version(ofp_version) {}
+    : ofp_version(ofp_version), goto_table(ofp_version),
+      write_metadata(ofp_version), write_actions(ofp_version),
+      apply_actions(ofp_version), clear_actions(ofp_version),
+      meter(ofp_version), experimenter(ofp_version), present(0) {}
 
-cofinstructions::cofinstructions(cofinstructions const &instructions) {
+cofinstructions::cofinstructions(cofinstructions const &instructions)
+    : present(0) {
   *this = instructions;
 }
 
 void cofinstructions::clear() {
+  if (present & slot_bit(rofl::openflow::OFPIT_GOTO_TABLE)) {
+    goto_table = cofinstruction_goto_table(ofp_version);
+  }
+  if (present & slot_bit(rofl::openflow::OFPIT_WRITE_METADATA)) {
+    write_metadata = cofinstruction_write_metadata(ofp_version);
+  }
+  if (present & slot_bit(rofl::openflow::OFPIT_WRITE_ACTIONS)) {
+    write_actions = cofinstruction_write_actions(ofp_version);
+  }
+  if (present & slot_bit(rofl::openflow::OFPIT_APPLY_ACTIONS)) {
+    apply_actions = cofinstruction_apply_actions(ofp_version);
+  }
+  if (present & slot_bit(rofl::openflow::OFPIT_CLEAR_ACTIONS)) {
+    clear_actions = cofinstruction_clear_actions(ofp_version);
+  }
+  if (present & slot_bit(rofl::openflow::OFPIT_METER)) {
+    meter = cofinstruction_meter(ofp_version);
+  }
+  if (present & slot_bit(rofl::openflow::OFPIT_EXPERIMENTER)) {
+    experimenter = cofinstruction_experimenter(ofp_version);
+  }
+  present = 0;
   for (std::map<uint16_t, cofinstruction *>::iterator it = instmap.begin();
        it != instmap.end(); ++it) {
     delete it->second;
@@ -29,55 +55,57 @@ operator=(cofinstructions const &instructions) {
 
   clear();
 
-  this->ofp_version = instructions.ofp_version;
+  set_version(instructions.ofp_version);
+
+  /* slots are copied in place, no allocation for empty action lists */
+  present = instructions.present;
+  if (present & slot_bit(rofl::openflow::OFPIT_GOTO_TABLE)) {
+    goto_table = instructions.goto_table;
+  }
+  if (present & slot_bit(rofl::openflow::OFPIT_WRITE_METADATA)) {
+    write_metadata = instructions.write_metadata;
+  }
+  if (present & slot_bit(rofl::openflow::OFPIT_WRITE_ACTIONS)) {
+    write_actions = instructions.write_actions;
+  }
+  if (present & slot_bit(rofl::openflow::OFPIT_APPLY_ACTIONS)) {
+    apply_actions = instructions.apply_actions;
+  }
+  if (present & slot_bit(rofl::openflow::OFPIT_CLEAR_ACTIONS)) {
+    clear_actions = instructions.clear_actions;
+  }
+  if (present & slot_bit(rofl::openflow::OFPIT_METER)) {
+    meter = instructions.meter;
+  }
+  if (present & slot_bit(rofl::openflow::OFPIT_EXPERIMENTER)) {
+    experimenter = instructions.experimenter;
+  }
 
   for (std::map<uint16_t, cofinstruction *>::const_iterator it =
            instructions.instmap.begin();
        it != instructions.instmap.end(); ++it) {
-    try {
-      switch (it->first) {
-      case rofl::openflow::OFPIT_GOTO_TABLE: {
-        add_inst_goto_table() = instructions.get_inst_goto_table();
-      } break;
-      case rofl::openflow::OFPIT_WRITE_METADATA: {
-        add_inst_write_metadata() = instructions.get_inst_write_metadata();
-      } break;
-      case rofl::openflow::OFPIT_WRITE_ACTIONS: {
-        add_inst_write_actions() = instructions.get_inst_write_actions();
-      } break;
-      case rofl::openflow::OFPIT_APPLY_ACTIONS: {
-        add_inst_apply_actions() = instructions.get_inst_apply_actions();
-      } break;
-      case rofl::openflow::OFPIT_CLEAR_ACTIONS: {
-        add_inst_clear_actions() = instructions.get_inst_clear_actions();
-      } break;
-      case rofl::openflow::OFPIT_METER: {
-        add_inst_meter() = instructions.get_inst_meter();
-      } break;
-      case rofl::openflow::OFPIT_EXPERIMENTER: {
-        add_inst_experimenter() = instructions.get_inst_experimenter();
-      } break;
-      default: {
-        instmap[it->first] = new cofinstruction(*(it->second));
-      } break;
-      }
-    } catch (std::out_of_range &e) {
-      instmap[it->first] = new cofinstruction(*(it->second));
-    }
+    instmap[it->first] = new cofinstruction(*(it->second));
   }
 
   return *this;
 }
 
 bool cofinstructions::operator==(cofinstructions const &instructions) const {
-  if (instmap.size() != instructions.instmap.size()) {
+  std::map<uint16_t, cofinstruction *> lhs = get_instructions();
+  std::map<uint16_t, cofinstruction *> rhs = instructions.get_instructions();
+
+  if (lhs.size() != rhs.size()) {
     return false;
   }
 
-  for (std::map<uint16_t, cofinstruction *>::const_iterator it =
-           instructions.instmap.begin();
-       it != instructions.instmap.end(); ++it) {
-    if (not(*(instmap.at(it->first)) == *(it->second))) {
+  for (std::map<uint16_t, cofinstruction *>::const_iterator it = rhs.begin();
+       it != rhs.end(); ++it) {
+    if (lhs.find(it->first) == lhs.end()) {
+      return false;
+    }
+    const cofinstruction &inst = *(lhs[it->first]);
+    if ((inst.get_version() != it->second->get_version()) ||
+        (inst.get_type() != it->second->get_type())) {
       return false;
     }
   }
@@ -86,404 +114,431 @@ bool cofinstructions::operator==(cofinstructions const &instructions) const {
 
 cofinstructions::~cofinstructions() { clear(); }
 
+std::map<uint16_t, cofinstruction *> cofinstructions::get_instructions() const {
+  std::map<uint16_t, cofinstruction *> instructions(instmap);
+  if (present & slot_bit(rofl::openflow::OFPIT_GOTO_TABLE)) {
+    instructions[rofl::openflow::OFPIT_GOTO_TABLE] =
+        const_cast<cofinstruction_goto_table *>(&goto_table);
+  }
+  if (present & slot_bit(rofl::openflow::OFPIT_WRITE_METADATA)) {
+    instructions[rofl::openflow::OFPIT_WRITE_METADATA] =
+        const_cast<cofinstruction_write_metadata *>(&write_metadata);
+  }
+  if (present & slot_bit(rofl::openflow::OFPIT_WRITE_ACTIONS)) {
+    instructions[rofl::openflow::OFPIT_WRITE_ACTIONS] =
+        const_cast<cofinstruction_write_actions *>(&write_actions);
+  }
+  if (present & slot_bit(rofl::openflow::OFPIT_APPLY_ACTIONS)) {
+    instructions[rofl::openflow::OFPIT_APPLY_ACTIONS] =
+        const_cast<cofinstruction_apply_actions *>(&apply_actions);
+  }
+  if (present & slot_bit(rofl::openflow::OFPIT_CLEAR_ACTIONS)) {
+    instructions[rofl::openflow::OFPIT_CLEAR_ACTIONS] =
+        const_cast<cofinstruction_clear_actions *>(&clear_actions);
+  }
+  if (present & slot_bit(rofl::openflow::OFPIT_METER)) {
+    instructions[rofl::openflow::OFPIT_METER] =
+        const_cast<cofinstruction_meter *>(&meter);
+  }
+  if (present & slot_bit(rofl::openflow::OFPIT_EXPERIMENTER)) {
+    instructions[rofl::openflow::OFPIT_EXPERIMENTER] =
+        const_cast<cofinstruction_experimenter *>(&experimenter);
+  }
+  return instructions;
+}
+
+cofinstruction *cofinstructions::slot(uint16_t type) {
+  switch (type) {
+  case rofl::openflow::OFPIT_GOTO_TABLE:
+    return &goto_table;
+  case rofl::openflow::OFPIT_WRITE_METADATA:
+    return &write_metadata;
+  case rofl::openflow::OFPIT_WRITE_ACTIONS:
+    return &write_actions;
+  case rofl::openflow::OFPIT_APPLY_ACTIONS:
+    return &apply_actions;
+  case rofl::openflow::OFPIT_CLEAR_ACTIONS:
+    return &clear_actions;
+  case rofl::openflow::OFPIT_METER:
+    return &meter;
+  case rofl::openflow::OFPIT_EXPERIMENTER:
+    return &experimenter;
+  default:
+    return NULL;
+  }
+}
+
 cofinstruction &cofinstructions::add_inst(uint16_t type) {
   switch (type) {
-  case rofl::openflow::OFPIT_GOTO_TABLE: {
-    add_inst_goto_table();
-  } break;
-  case rofl::openflow::OFPIT_WRITE_METADATA: {
-    add_inst_write_metadata();
-  } break;
-  case rofl::openflow::OFPIT_WRITE_ACTIONS: {
-    add_inst_write_actions();
-  } break;
-  case rofl::openflow::OFPIT_APPLY_ACTIONS: {
-    add_inst_apply_actions();
-  } break;
-  case rofl::openflow::OFPIT_CLEAR_ACTIONS: {
-    add_inst_clear_actions();
-  } break;
-  case rofl::openflow::OFPIT_METER: {
-    add_inst_meter();
-  } break;
-  case rofl::openflow::OFPIT_EXPERIMENTER: {
-    add_inst_experimenter();
-  } break;
+  case rofl::openflow::OFPIT_GOTO_TABLE:
+    return add_inst_goto_table();
+  case rofl::openflow::OFPIT_WRITE_METADATA:
+    return add_inst_write_metadata();
+  case rofl::openflow::OFPIT_WRITE_ACTIONS:
+    return add_inst_write_actions();
+  case rofl::openflow::OFPIT_APPLY_ACTIONS:
+    return add_inst_apply_actions();
+  case rofl::openflow::OFPIT_CLEAR_ACTIONS:
+    return add_inst_clear_actions();
+  case rofl::openflow::OFPIT_METER:
+    return add_inst_meter();
+  case rofl::openflow::OFPIT_EXPERIMENTER:
+    return add_inst_experimenter();
   default: {
     if (instmap.find(type) != instmap.end()) {
       delete instmap[type];
     }
     instmap[type] = new cofinstruction(ofp_version, type);
+    return *(instmap[type]);
   }
   }
-  return *dynamic_cast<cofinstruction *>(instmap[type]);
 }
 
 cofinstruction &cofinstructions::set_inst(uint16_t type) {
+  switch (type) {
+  case rofl::openflow::OFPIT_GOTO_TABLE:
+    return set_inst_goto_table();
+  case rofl::openflow::OFPIT_WRITE_METADATA:
+    return set_inst_write_metadata();
+  case rofl::openflow::OFPIT_WRITE_ACTIONS:
+    return set_inst_write_actions();
+  case rofl::openflow::OFPIT_APPLY_ACTIONS:
+    return set_inst_apply_actions();
+  case rofl::openflow::OFPIT_CLEAR_ACTIONS:
+    return set_inst_clear_actions();
+  case rofl::openflow::OFPIT_METER:
+    return set_inst_meter();
+  case rofl::openflow::OFPIT_EXPERIMENTER:
+    return set_inst_experimenter();
+  default: {
+    if (instmap.find(type) == instmap.end()) {
+      instmap[type] = new cofinstruction(ofp_version, type);
+    }
+    return *(instmap[type]);
+  }
+  }
+}
+
+const cofinstruction &cofinstructions::get_inst(uint16_t type) const {
+  if (not has_inst(type)) {
+    throw eInstructionsNotFound()
+        .set_func(__FUNCTION__)
+        .set_file(__FILE__)
+        .set_line(__LINE__);
+  }
+  if (slot_bit(type)) {
+    return *slot(type);
+  }
+  return *(instmap.at(type));
+}
+
+void cofinstructions::drop_inst(uint16_t type) {
   switch (type) {
   case rofl::openflow::OFPIT_GOTO_TABLE: {
-    set_inst_goto_table();
+    drop_inst_goto_table();
   } break;
   case rofl::openflow::OFPIT_WRITE_METADATA: {
-    set_inst_write_metadata();
+    drop_inst_write_metadata();
   } break;
   case rofl::openflow::OFPIT_WRITE_ACTIONS: {
-    set_inst_write_actions();
+    drop_inst_write_actions();
   } break;
   case rofl::openflow::OFPIT_APPLY_ACTIONS: {
-    set_inst_apply_actions();
+    drop_inst_apply_actions();
   } break;
   case rofl::openflow::OFPIT_CLEAR_ACTIONS: {
-    set_inst_clear_actions();
+    drop_inst_clear_actions();
   } break;
   case rofl::openflow::OFPIT_METER: {
-    set_inst_meter();
+    drop_inst_meter();
   } break;
   case rofl::openflow::OFPIT_EXPERIMENTER: {
-    set_inst_experimenter();
+    drop_inst_experimenter();
   } break;
   default: {
     if (instmap.find(type) == instmap.end()) {
-      instmap[type] = new cofinstruction(ofp_version, type);
+      return;
     }
+    delete instmap[type];
+    instmap.erase(type);
   }
   }
-  return *dynamic_cast<cofinstruction *>(instmap[type]);
-}
-
-const cofinstruction &cofinstructions::get_inst(uint16_t type) const {
-  if (instmap.find(type) == instmap.end()) {
-    throw eInstructionsNotFound()
-        .set_func(__FUNCTION__)
-        .set_file(__FILE__)
-        .set_line(__LINE__);
-  }
-  return *(dynamic_cast<const cofinstruction *>(instmap.at(type)));
-}
-
-void cofinstructions::drop_inst(uint16_t type) {
-  if (instmap.find(type) == instmap.end()) {
-    return;
-  }
-  delete instmap[type];
-  instmap.erase(type);
 }
 
 bool cofinstructions::has_inst(uint16_t type) const {
+  if (slot_bit(type)) {
+    return (present & slot_bit(type));
+  }
   return (not(instmap.find(type) == instmap.end()));
 }
 
 cofinstruction_goto_table &cofinstructions::add_inst_goto_table() {
-  if (instmap.find(rofl::openflow::OFPIT_GOTO_TABLE) != instmap.end()) {
-    delete instmap[rofl::openflow::OFPIT_GOTO_TABLE];
-  }
-  instmap[rofl::openflow::OFPIT_GOTO_TABLE] =
-      new cofinstruction_goto_table(ofp_version);
-  return *dynamic_cast<cofinstruction_goto_table *>(
-      instmap[rofl::openflow::OFPIT_GOTO_TABLE]);
+  goto_table = cofinstruction_goto_table(ofp_version);
+  present |= slot_bit(rofl::openflow::OFPIT_GOTO_TABLE);
+  return goto_table;
 }
 
 cofinstruction_goto_table &cofinstructions::set_inst_goto_table() {
-  if (instmap.find(rofl::openflow::OFPIT_GOTO_TABLE) == instmap.end()) {
-    instmap[rofl::openflow::OFPIT_GOTO_TABLE] =
-        new cofinstruction_goto_table(ofp_version);
+  if (not(present & slot_bit(rofl::openflow::OFPIT_GOTO_TABLE))) {
+    return add_inst_goto_table();
   }
-  return *dynamic_cast<cofinstruction_goto_table *>(
-      instmap[rofl::openflow::OFPIT_GOTO_TABLE]);
+  return goto_table;
 }
 
 const cofinstruction_goto_table &cofinstructions::get_inst_goto_table() const {
-  if (instmap.find(rofl::openflow::OFPIT_GOTO_TABLE) == instmap.end()) {
+  if (not(present & slot_bit(rofl::openflow::OFPIT_GOTO_TABLE))) {
     throw eInstructionsNotFound()
         .set_func(__FUNCTION__)
         .set_file(__FILE__)
         .set_line(__LINE__);
   }
-  return *(dynamic_cast<const cofinstruction_goto_table *>(
-      instmap.at(rofl::openflow::OFPIT_GOTO_TABLE)));
+  return goto_table;
 }
 
 void cofinstructions::drop_inst_goto_table() {
-  if (instmap.find(rofl::openflow::OFPIT_GOTO_TABLE) == instmap.end()) {
+  if (not(present & slot_bit(rofl::openflow::OFPIT_GOTO_TABLE))) {
     return;
   }
-  delete instmap[rofl::openflow::OFPIT_GOTO_TABLE];
-  instmap.erase(rofl::openflow::OFPIT_GOTO_TABLE);
+  present &= ~slot_bit(rofl::openflow::OFPIT_GOTO_TABLE);
+  goto_table = cofinstruction_goto_table(ofp_version);
 }
 
 bool cofinstructions::has_inst_goto_table() const {
-  return (not(instmap.find(rofl::openflow::OFPIT_GOTO_TABLE) == instmap.end()));
+  return (present & slot_bit(rofl::openflow::OFPIT_GOTO_TABLE));
 }
 
 cofinstruction_write_metadata &cofinstructions::add_inst_write_metadata() {
-  if (instmap.find(rofl::openflow::OFPIT_WRITE_METADATA) != instmap.end()) {
-    delete instmap[rofl::openflow::OFPIT_WRITE_METADATA];
-  }
-  instmap[rofl::openflow::OFPIT_WRITE_METADATA] =
-      new cofinstruction_write_metadata(ofp_version);
-  return *dynamic_cast<cofinstruction_write_metadata *>(
-      instmap[rofl::openflow::OFPIT_WRITE_METADATA]);
+  write_metadata = cofinstruction_write_metadata(ofp_version);
+  present |= slot_bit(rofl::openflow::OFPIT_WRITE_METADATA);
+  return write_metadata;
 }
 
 cofinstruction_write_metadata &cofinstructions::set_inst_write_metadata() {
-  if (instmap.find(rofl::openflow::OFPIT_WRITE_METADATA) == instmap.end()) {
-    instmap[rofl::openflow::OFPIT_WRITE_METADATA] =
-        new cofinstruction_write_metadata(ofp_version);
+  if (not(present & slot_bit(rofl::openflow::OFPIT_WRITE_METADATA))) {
+    return add_inst_write_metadata();
   }
-  return *dynamic_cast<cofinstruction_write_metadata *>(
-      instmap[rofl::openflow::OFPIT_WRITE_METADATA]);
+  return write_metadata;
 }
 
 const cofinstruction_write_metadata &
 cofinstructions::get_inst_write_metadata() const {
-  if (instmap.find(rofl::openflow::OFPIT_WRITE_METADATA) == instmap.end()) {
+  if (not(present & slot_bit(rofl::openflow::OFPIT_WRITE_METADATA))) {
     throw eInstructionsNotFound()
         .set_func(__FUNCTION__)
         .set_file(__FILE__)
         .set_line(__LINE__);
   }
-  return *(dynamic_cast<const cofinstruction_write_metadata *>(
-      instmap.at(rofl::openflow::OFPIT_WRITE_METADATA)));
+  return write_metadata;
 }
 
 void cofinstructions::drop_inst_write_metadata() {
-  if (instmap.find(rofl::openflow::OFPIT_WRITE_METADATA) == instmap.end()) {
+  if (not(present & slot_bit(rofl::openflow::OFPIT_WRITE_METADATA))) {
     return;
   }
-  delete instmap[rofl::openflow::OFPIT_WRITE_METADATA];
-  instmap.erase(rofl::openflow::OFPIT_WRITE_METADATA);
+  present &= ~slot_bit(rofl::openflow::OFPIT_WRITE_METADATA);
+  write_metadata = cofinstruction_write_metadata(ofp_version);
 }
 
 bool cofinstructions::has_inst_write_metadata() const {
-  return (
-      not(instmap.find(rofl::openflow::OFPIT_WRITE_METADATA) == instmap.end()));
+  return (present & slot_bit(rofl::openflow::OFPIT_WRITE_METADATA));
 }
 
 cofinstruction_write_actions &cofinstructions::add_inst_write_actions() {
-  if (instmap.find(rofl::openflow::OFPIT_WRITE_ACTIONS) != instmap.end()) {
-    delete instmap[rofl::openflow::OFPIT_WRITE_ACTIONS];
-  }
-  instmap[rofl::openflow::OFPIT_WRITE_ACTIONS] =
-      new cofinstruction_write_actions(ofp_version);
-  return *dynamic_cast<cofinstruction_write_actions *>(
-      instmap[rofl::openflow::OFPIT_WRITE_ACTIONS]);
+  write_actions = cofinstruction_write_actions(ofp_version);
+  present |= slot_bit(rofl::openflow::OFPIT_WRITE_ACTIONS);
+  return write_actions;
 }
 
 cofinstruction_write_actions &cofinstructions::set_inst_write_actions() {
-  if (instmap.find(rofl::openflow::OFPIT_WRITE_ACTIONS) == instmap.end()) {
-    instmap[rofl::openflow::OFPIT_WRITE_ACTIONS] =
-        new cofinstruction_write_actions(ofp_version);
+  if (not(present & slot_bit(rofl::openflow::OFPIT_WRITE_ACTIONS))) {
+    return add_inst_write_actions();
   }
-  return *dynamic_cast<cofinstruction_write_actions *>(
-      instmap[rofl::openflow::OFPIT_WRITE_ACTIONS]);
+  return write_actions;
 }
 
 const cofinstruction_write_actions &
 cofinstructions::get_inst_write_actions() const {
-  if (instmap.find(rofl::openflow::OFPIT_WRITE_ACTIONS) == instmap.end()) {
+  if (not(present & slot_bit(rofl::openflow::OFPIT_WRITE_ACTIONS))) {
     throw eInstructionsNotFound()
         .set_func(__FUNCTION__)
         .set_file(__FILE__)
         .set_line(__LINE__);
   }
-  return *(dynamic_cast<const cofinstruction_write_actions *>(
-      instmap.at(rofl::openflow::OFPIT_WRITE_ACTIONS)));
+  return write_actions;
 }
 
 void cofinstructions::drop_inst_write_actions() {
-  if (instmap.find(rofl::openflow::OFPIT_WRITE_ACTIONS) == instmap.end()) {
+  if (not(present & slot_bit(rofl::openflow::OFPIT_WRITE_ACTIONS))) {
     return;
   }
-  delete instmap[rofl::openflow::OFPIT_WRITE_ACTIONS];
-  instmap.erase(rofl::openflow::OFPIT_WRITE_ACTIONS);
+  present &= ~slot_bit(rofl::openflow::OFPIT_WRITE_ACTIONS);
+  write_actions = cofinstruction_write_actions(ofp_version);
 }
 
 bool cofinstructions::has_inst_write_actions() const {
-  return (
-      not(instmap.find(rofl::openflow::OFPIT_WRITE_ACTIONS) == instmap.end()));
+  return (present & slot_bit(rofl::openflow::OFPIT_WRITE_ACTIONS));
 }
 
 cofinstruction_apply_actions &cofinstructions::add_inst_apply_actions() {
-  if (instmap.find(rofl::openflow::OFPIT_APPLY_ACTIONS) != instmap.end()) {
-    delete instmap[rofl::openflow::OFPIT_APPLY_ACTIONS];
-  }
-  instmap[rofl::openflow::OFPIT_APPLY_ACTIONS] =
-      new cofinstruction_apply_actions(ofp_version);
-  return *dynamic_cast<cofinstruction_apply_actions *>(
-      instmap[rofl::openflow::OFPIT_APPLY_ACTIONS]);
+  apply_actions = cofinstruction_apply_actions(ofp_version);
+  present |= slot_bit(rofl::openflow::OFPIT_APPLY_ACTIONS);
+  return apply_actions;
 }
 
 cofinstruction_apply_actions &cofinstructions::set_inst_apply_actions() {
-  if (instmap.find(rofl::openflow::OFPIT_APPLY_ACTIONS) == instmap.end()) {
-    instmap[rofl::openflow::OFPIT_APPLY_ACTIONS] =
-        new cofinstruction_apply_actions(ofp_version);
+  if (not(present & slot_bit(rofl::openflow::OFPIT_APPLY_ACTIONS))) {
+    return add_inst_apply_actions();
   }
-  return *dynamic_cast<cofinstruction_apply_actions *>(
-      instmap[rofl::openflow::OFPIT_APPLY_ACTIONS]);
+  return apply_actions;
 }
 
 const cofinstruction_apply_actions &
 cofinstructions::get_inst_apply_actions() const {
-  if (instmap.find(rofl::openflow::OFPIT_APPLY_ACTIONS) == instmap.end()) {
+  if (not(present & slot_bit(rofl::openflow::OFPIT_APPLY_ACTIONS))) {
     throw eInstructionsNotFound()
         .set_func(__FUNCTION__)
         .set_file(__FILE__)
         .set_line(__LINE__);
   }
-  return *(dynamic_cast<const cofinstruction_apply_actions *>(
-      instmap.at(rofl::openflow::OFPIT_APPLY_ACTIONS)));
+  return apply_actions;
 }
 
 void cofinstructions::drop_inst_apply_actions() {
-  if (instmap.find(rofl::openflow::OFPIT_APPLY_ACTIONS) == instmap.end()) {
+  if (not(present & slot_bit(rofl::openflow::OFPIT_APPLY_ACTIONS))) {
     return;
   }
-  delete instmap[rofl::openflow::OFPIT_APPLY_ACTIONS];
-  instmap.erase(rofl::openflow::OFPIT_APPLY_ACTIONS);
+  present &= ~slot_bit(rofl::openflow::OFPIT_APPLY_ACTIONS);
+  apply_actions = cofinstruction_apply_actions(ofp_version);
 }
 
 bool cofinstructions::has_inst_apply_actions() const {
-  return (
-      not(instmap.find(rofl::openflow::OFPIT_APPLY_ACTIONS) == instmap.end()));
+  return (present & slot_bit(rofl::openflow::OFPIT_APPLY_ACTIONS));
 }
 
 cofinstruction_clear_actions &cofinstructions::add_inst_clear_actions() {
-  if (instmap.find(rofl::openflow::OFPIT_CLEAR_ACTIONS) != instmap.end()) {
-    delete instmap[rofl::openflow::OFPIT_CLEAR_ACTIONS];
-  }
-  instmap[rofl::openflow::OFPIT_CLEAR_ACTIONS] =
-      new cofinstruction_clear_actions(ofp_version);
-  return *dynamic_cast<cofinstruction_clear_actions *>(
-      instmap[rofl::openflow::OFPIT_CLEAR_ACTIONS]);
+  clear_actions = cofinstruction_clear_actions(ofp_version);
+  present |= slot_bit(rofl::openflow::OFPIT_CLEAR_ACTIONS);
+  return clear_actions;
 }
 
 cofinstruction_clear_actions &cofinstructions::set_inst_clear_actions() {
-  if (instmap.find(rofl::openflow::OFPIT_CLEAR_ACTIONS) == instmap.end()) {
-    instmap[rofl::openflow::OFPIT_CLEAR_ACTIONS] =
-        new cofinstruction_clear_actions(ofp_version);
+  if (not(present & slot_bit(rofl::openflow::OFPIT_CLEAR_ACTIONS))) {
+    return add_inst_clear_actions();
   }
-  return *dynamic_cast<cofinstruction_clear_actions *>(
-      instmap[rofl::openflow::OFPIT_CLEAR_ACTIONS]);
+  return clear_actions;
 }
 
 const cofinstruction_clear_actions &
 cofinstructions::get_inst_clear_actions() const {
-  if (instmap.find(rofl::openflow::OFPIT_CLEAR_ACTIONS) == instmap.end()) {
+  if (not(present & slot_bit(rofl::openflow::OFPIT_CLEAR_ACTIONS))) {
     throw eInstructionsNotFound()
         .set_func(__FUNCTION__)
         .set_file(__FILE__)
         .set_line(__LINE__);
   }
-  return *(dynamic_cast<const cofinstruction_clear_actions *>(
-      instmap.at(rofl::openflow::OFPIT_CLEAR_ACTIONS)));
+  return clear_actions;
 }
 
 void cofinstructions::drop_inst_clear_actions() {
-  if (instmap.find(rofl::openflow::OFPIT_CLEAR_ACTIONS) == instmap.end()) {
+  if (not(present & slot_bit(rofl::openflow::OFPIT_CLEAR_ACTIONS))) {
     return;
   }
-  delete instmap[rofl::openflow::OFPIT_CLEAR_ACTIONS];
-  instmap.erase(rofl::openflow::OFPIT_CLEAR_ACTIONS);
+  present &= ~slot_bit(rofl::openflow::OFPIT_CLEAR_ACTIONS);
+  clear_actions = cofinstruction_clear_actions(ofp_version);
 }
 
 bool cofinstructions::has_inst_clear_actions() const {
-  return (
-      not(instmap.find(rofl::openflow::OFPIT_CLEAR_ACTIONS) == instmap.end()));
+  return (present & slot_bit(rofl::openflow::OFPIT_CLEAR_ACTIONS));
 }
 
 cofinstruction_experimenter &cofinstructions::add_inst_experimenter() {
-  if (instmap.find(rofl::openflow::OFPIT_EXPERIMENTER) != instmap.end()) {
-    delete instmap[rofl::openflow::OFPIT_EXPERIMENTER];
-  }
-  instmap[rofl::openflow::OFPIT_EXPERIMENTER] =
-      new cofinstruction_experimenter(ofp_version);
-  return *dynamic_cast<cofinstruction_experimenter *>(
-      instmap[rofl::openflow::OFPIT_EXPERIMENTER]);
+  experimenter = cofinstruction_experimenter(ofp_version);
+  present |= slot_bit(rofl::openflow::OFPIT_EXPERIMENTER);
+  return experimenter;
 }
 
 cofinstruction_experimenter &cofinstructions::set_inst_experimenter() {
-  if (instmap.find(rofl::openflow::OFPIT_EXPERIMENTER) == instmap.end()) {
-    instmap[rofl::openflow::OFPIT_EXPERIMENTER] =
-        new cofinstruction_experimenter(ofp_version);
+  if (not(present & slot_bit(rofl::openflow::OFPIT_EXPERIMENTER))) {
+    return add_inst_experimenter();
   }
-  return *dynamic_cast<cofinstruction_experimenter *>(
-      instmap[rofl::openflow::OFPIT_EXPERIMENTER]);
+  return experimenter;
 }
 
 const cofinstruction_experimenter &
 cofinstructions::get_inst_experimenter() const {
-  if (instmap.find(rofl::openflow::OFPIT_EXPERIMENTER) == instmap.end()) {
+  if (not(present & slot_bit(rofl::openflow::OFPIT_EXPERIMENTER))) {
     throw eInstructionsNotFound()
         .set_func(__FUNCTION__)
         .set_file(__FILE__)
         .set_line(__LINE__);
   }
-  return *(dynamic_cast<const cofinstruction_experimenter *>(
-      instmap.at(rofl::openflow::OFPIT_EXPERIMENTER)));
+  return experimenter;
 }
 
 void cofinstructions::drop_inst_experimenter() {
-  if (instmap.find(rofl::openflow::OFPIT_EXPERIMENTER) == instmap.end()) {
+  if (not(present & slot_bit(rofl::openflow::OFPIT_EXPERIMENTER))) {
     return;
   }
-  delete instmap[rofl::openflow::OFPIT_EXPERIMENTER];
-  instmap.erase(rofl::openflow::OFPIT_EXPERIMENTER);
+  present &= ~slot_bit(rofl::openflow::OFPIT_EXPERIMENTER);
+  experimenter = cofinstruction_experimenter(ofp_version);
 }
 
 bool cofinstructions::has_inst_experimenter() const {
-  return (
-      not(instmap.find(rofl::openflow::OFPIT_EXPERIMENTER) == instmap.end()));
+  return (present & slot_bit(rofl::openflow::OFPIT_EXPERIMENTER));
 }
 
 cofinstruction_meter &cofinstructions::add_inst_meter() {
-  if (instmap.find(rofl::openflow::OFPIT_METER) != instmap.end()) {
-    delete instmap[rofl::openflow::OFPIT_METER];
-  }
-  instmap[rofl::openflow::OFPIT_METER] = new cofinstruction_meter(ofp_version);
-  return *dynamic_cast<cofinstruction_meter *>(
-      instmap[rofl::openflow::OFPIT_METER]);
+  meter = cofinstruction_meter(ofp_version);
+  present |= slot_bit(rofl::openflow::OFPIT_METER);
+  return meter;
 }
 
 cofinstruction_meter &cofinstructions::set_inst_meter() {
-  if (instmap.find(rofl::openflow::OFPIT_METER) == instmap.end()) {
-    instmap[rofl::openflow::OFPIT_METER] =
-        new cofinstruction_meter(ofp_version);
+  if (not(present & slot_bit(rofl::openflow::OFPIT_METER))) {
+    return add_inst_meter();
   }
-  return *dynamic_cast<cofinstruction_meter *>(
-      instmap[rofl::openflow::OFPIT_METER]);
+  return meter;
 }
 
 const cofinstruction_meter &cofinstructions::get_inst_meter() const {
-  if (instmap.find(rofl::openflow::OFPIT_METER) == instmap.end()) {
+  if (not(present & slot_bit(rofl::openflow::OFPIT_METER))) {
     throw eInstructionsNotFound()
         .set_func(__FUNCTION__)
         .set_file(__FILE__)
         .set_line(__LINE__);
   }
-  return *(dynamic_cast<const cofinstruction_meter *>(
-      instmap.at(rofl::openflow::OFPIT_METER)));
+  return meter;
 }
 
 void cofinstructions::drop_inst_meter() {
-  if (instmap.find(rofl::openflow::OFPIT_METER) == instmap.end()) {
+  if (not(present & slot_bit(rofl::openflow::OFPIT_METER))) {
     return;
   }
-  delete instmap[rofl::openflow::OFPIT_METER];
-  instmap.erase(rofl::openflow::OFPIT_METER);
+  present &= ~slot_bit(rofl::openflow::OFPIT_METER);
+  meter = cofinstruction_meter(ofp_version);
 }
 
 bool cofinstructions::has_inst_meter() const {
-  return (not(instmap.find(rofl::openflow::OFPIT_METER) == instmap.end()));
+  return (present & slot_bit(rofl::openflow::OFPIT_METER));
 }
 
 size_t cofinstructions::length() const {
   size_t inlen = 0;
 
+  for (uint16_t type = rofl::openflow::OFPIT_GOTO_TABLE;
+       type <= rofl::openflow::OFPIT_METER; type++) {
+    if (present & slot_bit(type)) {
+      inlen += slot(type)->length();
+    }
+  }
   for (std::map<uint16_t, cofinstruction *>::const_iterator it =
            instmap.begin();
        it != instmap.end(); ++it) {
     inlen += it->second->length();
   }
+  if (present & slot_bit(rofl::openflow::OFPIT_EXPERIMENTER)) {
+    inlen += experimenter.length();
+  }
   return inlen;
 }
 
@@ -494,12 +549,25 @@ void cofinstructions::pack(uint8_t *buf, size_t buflen) {
         .set_file(__FILE__)
         .set_line(__LINE__);
 
+  /* same order as sorted by type */
+  for (uint16_t type = rofl::openflow::OFPIT_GOTO_TABLE;
+       type <= rofl::openflow::OFPIT_METER; type++) {
+    if (present & slot_bit(type)) {
+      cofinstruction &inst = *slot(type);
+      size_t len = inst.length();
+      inst.pack(buf, len);
+      buf += len;
+    }
+  }
   for (std::map<uint16_t, cofinstruction *>::iterator it = instmap.begin();
        it != instmap.end(); ++it) {
     cofinstruction &inst = *(it->second);
     inst.pack(buf, inst.length());
     buf += inst.length();
   }
+  if (present & slot_bit(rofl::openflow::OFPIT_EXPERIMENTER)) {
+    experimenter.pack(buf, experimenter.length());
+  }
 }
 
 void cofinstructions::unpack(uint8_t *buf, size_t buflen) {
@@ -569,9 +637,18 @@ void cofinstructions::unpack(uint8_t *buf, size_t buflen) {
 }
 
 void cofinstructions::check_prerequisites() const {
+  for (uint16_t type = rofl::openflow::OFPIT_GOTO_TABLE;
+       type <= rofl::openflow::OFPIT_METER; type++) {
+    if (present & slot_bit(type)) {
+      slot(type)->check_prerequisites();
+    }
+  }
   for (std::map<uint16_t, cofinstruction *>::const_iterator it =
            instmap.begin();
        it != instmap.end(); ++it) {
     it->second->check_prerequisites();
   }
+  if (present & slot_bit(rofl::openflow::OFPIT_EXPERIMENTER)) {
+    experimenter.check_prerequisites();
+  }
 }
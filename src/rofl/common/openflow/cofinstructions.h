@@ -76,6 +76,13 @@ public:
    */
   void set_version(uint8_t ofp_version) {
     this->ofp_version = ofp_version;
+    goto_table.set_version(ofp_version);
+    write_metadata.set_version(ofp_version);
+    write_actions.set_version(ofp_version);
+    apply_actions.set_version(ofp_version);
+    clear_actions.set_version(ofp_version);
+    meter.set_version(ofp_version);
+    experimenter.set_version(ofp_version);
     for (std::map<uint16_t, cofinstruction *>::iterator it = instmap.begin();
          it != instmap.end(); ++it) {
       it->second->set_version(ofp_version);
@@ -88,16 +95,10 @@ public:
   uint8_t get_version() const { return ofp_version; };
 
   /**
-   *
-   */
-  std::map<uint16_t, cofinstruction *> &set_instructions() { return instmap; };
-
-  /**
-   *
+   * @brief	Returns map of all instructions, the instructions remain owned
+   * by this instance
    */
-  const std::map<uint16_t, cofinstruction *> &get_instructions() const {
-    return instmap;
-  };
+  std::map<uint16_t, cofinstruction *> get_instructions() const;
 
 public:
   /**
@@ -235,9 +236,11 @@ public:
                                   cofinstructions const &inlist) {
     os << "<cofintructions ofp-version:" << (int)inlist.ofp_version << " >"
        << std::endl;
+    std::map<uint16_t, cofinstruction *> instructions =
+        inlist.get_instructions();
     for (std::map<uint16_t, cofinstruction *>::const_iterator it =
-             inlist.instmap.begin();
-         it != inlist.instmap.end(); ++it) {
+             instructions.begin();
+         it != instructions.end(); ++it) {
 
       switch (it->second->get_type()) {
       case openflow::OFPIT_GOTO_TABLE:
@@ -269,8 +272,55 @@ public:
     return os;
   };
 
+private:
+  /**
+   * @brief	Returns presence bit of instruction type, 0 for types without
+   * a slot
+   */
+  static uint8_t slot_bit(uint16_t type) {
+    switch (type) {
+    case rofl::openflow::OFPIT_GOTO_TABLE:
+    case rofl::openflow::OFPIT_WRITE_METADATA:
+    case rofl::openflow::OFPIT_WRITE_ACTIONS:
+    case rofl::openflow::OFPIT_APPLY_ACTIONS:
+    case rofl::openflow::OFPIT_CLEAR_ACTIONS:
+    case rofl::openflow::OFPIT_METER:
+      return (1 << type);
+    case rofl::openflow::OFPIT_EXPERIMENTER:
+      return (1 << 7);
+    default:
+      return 0;
+    }
+  };
+
+  /**
+   * @brief	Returns slot of instruction type or NULL
+   */
+  cofinstruction *slot(uint16_t type);
+
+  /**
+   *
+   */
+  const cofinstruction *slot(uint16_t type) const {
+    return const_cast<cofinstructions *>(this)->slot(type);
+  };
+
 private:
   uint8_t ofp_version;
+
+  // one slot per instruction type, OpenFlow allows one instance of each
+  cofinstruction_goto_table goto_table;
+  cofinstruction_write_metadata write_metadata;
+  cofinstruction_write_actions write_actions;
+  cofinstruction_apply_actions apply_actions;
+  cofinstruction_clear_actions clear_actions;
+  cofinstruction_meter meter;
+  cofinstruction_experimenter experimenter;
+
+  // bitmap of slots in use, see slot_bit()
+  uint8_t present;
+
+  // instructions of unknown type
   std::map<uint16_t, cofinstruction *> instmap;
 };
 
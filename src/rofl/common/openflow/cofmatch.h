@@ -122,6 +122,16 @@ public:
    */
   uint16_t get_type() const { return type; };
 
+  /**
+   * @brief	Enables lazy decoding of OXM TLVs, see coxmatches::set_lazy()
+   */
+  void set_lazy(bool lazy = true) { matches.set_lazy(lazy); };
+
+  /**
+   *
+   */
+  bool get_lazy() const { return matches.get_lazy(); };
+
   /**
    *
    */
@@ -15,30 +15,102 @@
 
 using namespace rofl::openflow;
 
-coxmatches::coxmatches() {}
+namespace {
+
+/* payload length of OpenFlow basic fields without mask, by field */
+const uint8_t ofb_payload_length[] = {
+    OXM_TLV_BASIC_IN_PORT & 0xff,
+    OXM_TLV_BASIC_IN_PHY_PORT & 0xff,
+    OXM_TLV_BASIC_METADATA & 0xff,
+    OXM_TLV_BASIC_ETH_DST & 0xff,
+    OXM_TLV_BASIC_ETH_SRC & 0xff,
+    OXM_TLV_BASIC_ETH_TYPE & 0xff,
+    OXM_TLV_BASIC_VLAN_VID & 0xff,
+    OXM_TLV_BASIC_VLAN_PCP & 0xff,
+    OXM_TLV_BASIC_IP_DSCP & 0xff,
+    OXM_TLV_BASIC_IP_ECN & 0xff,
+    OXM_TLV_BASIC_IP_PROTO & 0xff,
+    OXM_TLV_BASIC_IPV4_SRC & 0xff,
+    OXM_TLV_BASIC_IPV4_DST & 0xff,
+    OXM_TLV_BASIC_TCP_SRC & 0xff,
+    OXM_TLV_BASIC_TCP_DST & 0xff,
+    OXM_TLV_BASIC_UDP_SRC & 0xff,
+    OXM_TLV_BASIC_UDP_DST & 0xff,
+    OXM_TLV_BASIC_SCTP_SRC & 0xff,
+    OXM_TLV_BASIC_SCTP_DST & 0xff,
+    OXM_TLV_BASIC_ICMPV4_TYPE & 0xff,
+    OXM_TLV_BASIC_ICMPV4_CODE & 0xff,
+    OXM_TLV_BASIC_ARP_OP & 0xff,
+    OXM_TLV_BASIC_ARP_SPA & 0xff,
+    OXM_TLV_BASIC_ARP_TPA & 0xff,
+    OXM_TLV_BASIC_ARP_SHA & 0xff,
+    OXM_TLV_BASIC_ARP_THA & 0xff,
+    OXM_TLV_BASIC_IPV6_SRC & 0xff,
+    OXM_TLV_BASIC_IPV6_DST & 0xff,
+    OXM_TLV_BASIC_IPV6_FLABEL & 0xff,
+    OXM_TLV_BASIC_ICMPV6_TYPE & 0xff,
+    OXM_TLV_BASIC_ICMPV6_CODE & 0xff,
+    OXM_TLV_BASIC_IPV6_ND_TARGET & 0xff,
+    OXM_TLV_BASIC_IPV6_ND_SLL & 0xff,
+    OXM_TLV_BASIC_IPV6_ND_TLL & 0xff,
+    OXM_TLV_BASIC_MPLS_LABEL & 0xff,
+    OXM_TLV_BASIC_MPLS_TC & 0xff,
+    OXM_TLV_BASIC_MPLS_BOS & 0xff,
+    OXM_TLV_BASIC_PBB_ISID & 0xff,
+    OXM_TLV_BASIC_TUNNEL_ID & 0xff,
+    OXM_TLV_BASIC_IPV6_EXTHDR & 0xff,
+};
+static_assert(sizeof(ofb_payload_length) ==
+                  rofl::openflow::OFPXMT_OFB_IPV6_EXTHDR + 1,
+              "ofb_payload_length must cover all OpenFlow basic fields");
+
+}; // namespace
+
+coxmatches::coxmatches()
+    : entries(inline_entries), num_entries(0),
+      max_entries(OXM_INLINE_ENTRIES), blocks_used(0), lazy(false),
+      pending(false), indexed(false), verbatim(true), rawlen(0),
+      wirelen(0) {}
 
 coxmatches::~coxmatches() { clear(); }
 
-coxmatches::coxmatches(coxmatches const &oxmlist) { *this = oxmlist; }
+coxmatches::coxmatches(coxmatches const &oxmlist)
+    : entries(inline_entries), num_entries(0),
+      max_entries(OXM_INLINE_ENTRIES), blocks_used(0), lazy(false),
+      pending(false), indexed(false), verbatim(true), rawlen(0),
+      wirelen(0) {
+  *this = oxmlist;
+}
 
 coxmatches &coxmatches::operator=(coxmatches const &oxms) {
   if (this == &oxms)
     return *this;
   clear();
+  lazy = oxms.lazy;
+  if (not oxms.raw.empty()) {
+    /* copy raw TLVs, they are decoded on demand in this instance */
+    AcquireReadWriteLock lock(rwlock);
+    raw = oxms.raw;
+    pending = true;
+    wirelen = oxms.wirelen.load();
+    return *this;
+  }
   copy_matches(oxms);
   return *this;
 }
 
 bool coxmatches::operator==(coxmatches const &oxms) const {
-  if (matches.size() != oxms.matches.size()) {
+  decode();
+  oxms.decode();
+  if (num_entries != oxms.num_entries) {
     return false;
   }
-  for (std::map<uint64_t, coxmatch *>::const_iterator it = matches.begin();
-       it != matches.end(); ++it) {
-    if (oxms.matches.find(it->first) == oxms.matches.end()) {
+  /* entries are sorted by type on both sides */
+  for (size_t i = 0; i < num_entries; i++) {
+    if (entries[i].oxm_type != oxms.entries[i].oxm_type) {
       return false;
     }
-    if (*it->second != *oxms.matches.at(it->first)) {
+    if (*entries[i].oxm != *oxms.entries[i].oxm) {
       return false;
     }
   }
@@ -48,6 +120,19 @@ bool coxmatches::operator==(coxmatches const &oxms) const {
 void coxmatches::unpack(uint8_t *buf, size_t buflen) {
   clear();
 
+  AcquireReadWriteLock lock(rwlock);
+
+  if (lazy) {
+    if (buflen > 0) {
+      raw.assign(buf, buflen);
+      pending = true;
+      /* TLV framing is validated here, decoding fields is deferred */
+      AcquireReadWriteLock rlock(rawlock);
+      build_index();
+    }
+    return;
+  }
+
   while (true) {
 
     if (buflen < sizeof(struct openflow::ofp_oxm_hdr)) {
@@ -57,190 +142,44 @@ void coxmatches::unpack(uint8_t *buf, size_t buflen) {
 
     struct openflow::ofp_oxm_hdr *hdr = (struct openflow::ofp_oxm_hdr *)buf;
 
-    switch (be16toh(hdr->oxm_class)) {
-    case rofl::openflow::OFPXMC_OPENFLOW_BASIC: {
+    struct rofl::openflow::ofp_oxm_tlv_hdr *oxm =
+        (struct rofl::openflow::ofp_oxm_tlv_hdr *)buf;
 
-      if (buflen < sizeof(struct openflow::ofp_oxm_hdr)) {
-        throw eOxmBadLen("coxmatches::unpack() buflen too short");
-      }
+    uint64_t oxm_type = OXM_ROFL_TYPE(be32toh(oxm->oxm_id));
 
-      struct rofl::openflow::ofp_oxm_tlv_hdr *oxm =
-          (struct rofl::openflow::ofp_oxm_tlv_hdr *)buf;
-
-      uint64_t oxm_type = OXM_ROFL_TYPE(be32toh(oxm->oxm_id));
-
-      switch (oxm_type) {
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IN_PORT): {
-        add_ofb_in_port().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IN_PHY_PORT): {
-        add_ofb_in_phy_port().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_METADATA): {
-        add_ofb_metadata().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_DST): {
-        add_ofb_eth_dst().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_SRC): {
-        add_ofb_eth_src().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_TYPE): {
-        add_ofb_eth_type().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_VID): {
-        add_ofb_vlan_vid().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_PCP): {
-        add_ofb_vlan_pcp().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_DSCP): {
-        add_ofb_ip_dscp().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_ECN): {
-        add_ofb_ip_ecn().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_PROTO): {
-        add_ofb_ip_proto().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_SRC): {
-        add_ofb_ipv4_src().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_DST): {
-        add_ofb_ipv4_dst().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TCP_SRC): {
-        add_ofb_tcp_src().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TCP_DST): {
-        add_ofb_tcp_dst().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_UDP_SRC): {
-        add_ofb_udp_src().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_UDP_DST): {
-        add_ofb_udp_dst().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_SCTP_SRC): {
-        add_ofb_sctp_src().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_SCTP_DST): {
-        add_ofb_sctp_dst().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV4_TYPE): {
-        add_ofb_icmpv4_type().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV4_CODE): {
-        add_ofb_icmpv4_code().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_OP): {
-        add_ofb_arp_opcode().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SPA): {
-        add_ofb_arp_spa().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_TPA): {
-        add_ofb_arp_tpa().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SHA): {
-        add_ofb_arp_sha().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_THA): {
-        add_ofb_arp_tha().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_SRC): {
-        add_ofb_ipv6_src().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_DST): {
-        add_ofb_ipv6_dst().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_FLABEL): {
-        add_ofb_ipv6_flabel().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV6_TYPE): {
-        add_ofb_icmpv6_type().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV6_CODE): {
-        add_ofb_icmpv6_code().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TARGET): {
-        add_ofb_ipv6_nd_target().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_SLL): {
-        add_ofb_ipv6_nd_sll().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TLL): {
-        add_ofb_ipv6_nd_tll().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_LABEL): {
-        add_ofb_mpls_label().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_TC): {
-        add_ofb_mpls_tc().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_BOS): {
-        add_ofb_mpls_bos().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_PBB_ISID): {
-        add_ofb_pbb_isid().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TUNNEL_ID): {
-        add_ofb_mpls_bos().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_EXTHDR): {
-        add_ofb_ipv6_exthdr().unpack(buf, buflen);
-      } break;
-      default: {};
-      }
-
-    } break;
+    switch (be16toh(hdr->oxm_class)) {
+    case rofl::openflow::OFPXMC_OPENFLOW_BASIC:
+      break;
     case rofl::openflow::OFPXMC_EXPERIMENTER: {
 
       if (buflen < sizeof(struct openflow::ofp_oxm_experimenter_header)) {
         throw eOxmBadLen("coxmatches::unpack() buflen too short");
       }
 
-      struct rofl::openflow::ofp_oxm_experimenter_header *oxm =
+      struct rofl::openflow::ofp_oxm_experimenter_header *exp =
           (struct rofl::openflow::ofp_oxm_experimenter_header *)buf;
 
-      uint64_t oxm_type = ((uint64_t)be32toh(oxm->experimenter)) << 32;
-
-      struct rofl::openflow::ofp_oxm_tlv_hdr *hdr =
-          (struct rofl::openflow::ofp_oxm_tlv_hdr *)buf;
-      oxm_type |= OXM_ROFL_TYPE(be32toh(hdr->oxm_id));
-
-      uint32_t exp_id = be32toh(oxm->experimenter);
-      uint32_t oxm_id = be32toh(hdr->oxm_id);
-
-      switch (oxm_type) {
-      case OXM_ROFL_OFX_TYPE(
-          rofl::openflow::experimental::OXM_TLV_EXPR_NW_SRC): {
-        add_ofx_nw_src().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFX_TYPE(
-          rofl::openflow::experimental::OXM_TLV_EXPR_NW_DST): {
-        add_ofx_nw_dst().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFX_TYPE(
-          rofl::openflow::experimental::OXM_TLV_EXPR_NW_PROTO): {
-        add_ofx_nw_proto().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFX_TYPE(
-          rofl::openflow::experimental::OXM_TLV_EXPR_NW_TOS): {
-        add_ofx_nw_tos().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFX_TYPE(
-          rofl::openflow::experimental::OXM_TLV_EXPR_TP_SRC): {
-        add_ofx_tp_src().unpack(buf, buflen);
-      } break;
-      case OXM_ROFL_OFX_TYPE(
-          rofl::openflow::experimental::OXM_TLV_EXPR_TP_DST): {
-        add_ofx_tp_dst().unpack(buf, buflen);
-      } break;
-      default: { add_exp_match(exp_id, oxm_id).unpack(buf, buflen); };
-      }
+      oxm_type |= ((uint64_t)be32toh(exp->experimenter)) << 32;
 
     } break;
+    default: { oxm_type = 0; };
+    }
+
+    if (oxm_type != 0) {
+      erase_match(oxm_type);
+      reserve_match();
+    }
+
+    coxmatch *match = (oxm_type != 0) ? new_match(oxm_type) : NULL;
+
+    if (NULL != match) {
+      try {
+        match->unpack(buf, buflen);
+      } catch (...) {
+        destroy_match(match);
+        throw;
+      }
+      insert_match(oxm_type, match);
     }
 
     if (buflen >= (sizeof(struct openflow::ofp_oxm_hdr) + hdr->oxm_length)) {
@@ -256,28 +195,72 @@ void coxmatches::pack(uint8_t *buf, size_t buflen) {
   if (buflen < length()) {
     throw eBadMatchBadLen("eBadMatchBadLen", __FILE__, __FUNCTION__, __LINE__);
   }
-  for (std::map<uint64_t, coxmatch *>::iterator jt = matches.begin();
-       jt != matches.end(); ++jt) {
 
-    coxmatch *match = (matches[jt->first]);
+  if (not raw.empty()) {
+    AcquireReadWriteLock rlock(rawlock);
+    build_index();
+    if (verbatim) {
+      memcpy(buf, raw.somem(), rawlen);
+    } else {
+      for (std::vector<oxm_slot>::const_iterator it = index.begin();
+           it != index.end(); ++it) {
+        memcpy(buf, raw.somem() + it->offset, it->length);
+        buf += it->length;
+      }
+    }
+    return;
+  }
+
+  for (size_t i = 0; i < num_entries; i++) {
+
+    coxmatch *match = entries[i].oxm;
+
+    /* a match modified after length() was cached must not overrun buf */
+    size_t len = match->length();
+    if (len > buflen) {
+      wirelen = 0;
+      throw eBadMatchBadLen("eBadMatchBadLen", __FILE__, __FUNCTION__,
+                            __LINE__);
+    }
 
-    match->pack(buf, match->length());
+    match->pack(buf, len);
 
-    buf += match->length();
+    buf += len;
+    buflen -= len;
   }
 }
 
 size_t coxmatches::length() const {
-  size_t len = 0;
-  for (std::map<uint64_t, coxmatch *>::const_iterator it = matches.begin();
-       it != matches.end(); ++it) {
-    len += it->second->length();
+  size_t len = wirelen;
+  if (len > 0) {
+    return len;
+  }
+
+  if (not raw.empty()) {
+    AcquireReadWriteLock rlock(rawlock);
+    build_index();
+    if (verbatim) {
+      len = rawlen;
+    } else {
+      for (std::vector<oxm_slot>::const_iterator it = index.begin();
+           it != index.end(); ++it) {
+        len += it->length;
+      }
+    }
+    return (wirelen = len);
   }
-  return len;
+
+  for (size_t i = 0; i < num_entries; i++) {
+    len += entries[i].oxm->length();
+  }
+  return (wirelen = len);
 }
 
 bool coxmatches::contains(coxmatches const &oxms,
                           bool strict /* = false (default) */) {
+  decode();
+  oxms.decode();
+
   /*
    * strict:
    * all elemens in *this and oxl must be identical (number of and value of
@@ -291,23 +274,22 @@ bool coxmatches::contains(coxmatches const &oxms,
   if (strict) {
     // strict: # of elems for an ofm_class must be the same in oxl for the
     // specific ofm_class
-    if (matches.size() != oxms.matches.size()) {
+    if (num_entries != oxms.num_entries) {
       return false;
     }
   } else /* non-strict*/ {
     // non-strict: # of elems for a class must be larger (or equal) the number
     // of elements in oxl
-    if (matches.size() > oxms.matches.size()) {
+    if (num_entries > oxms.num_entries) {
       return false;
     }
   }
 
   // strict: check all TLVs for specific class in oxl.matches => must exist and
   // have same value
-  for (std::map<uint64_t, coxmatch *>::iterator jt = matches.begin();
-       jt != matches.end(); ++jt) {
+  for (size_t i = 0; i < num_entries; i++) {
 
-    coxmatch *lmatch = (jt->second);
+    coxmatch *lmatch = entries[i].oxm;
 
     // keep in mind: match.get_oxm_id() & 0xfffffe00 == jt->first
 
@@ -315,11 +297,11 @@ bool coxmatches::contains(coxmatches const &oxms,
     uint64_t id =
         (__UINT64_C(0xfffffe00) & lmatch->get_oxm_id()) << 32 |
         0 /*(lmatch->is_experimenter() ? lmatch->get_oxm_exp_id() : 0)*/;
-    if (oxms.matches.find(id) == oxms.matches.end()) {
+    if (NULL == oxms.find_match(id)) {
       return false;
     }
 
-    coxmatch const *rmatch = (oxms.matches.find(jt->first)->second);
+    coxmatch const *rmatch = oxms.find_match(entries[i].oxm_type);
 
     // strict: both OXM TLVs must have identical values
     if (*lmatch != *rmatch) {
@@ -332,24 +314,26 @@ bool coxmatches::contains(coxmatches const &oxms,
 
 bool coxmatches::is_part_of(coxmatches const &oxms, uint16_t &exact_hits,
                             uint16_t &wildcard_hits, uint16_t &missed) {
+  decode();
+  oxms.decode();
+
   bool result = true;
 
-  for (std::map<uint64_t, coxmatch *>::const_iterator jt = oxms.matches.begin();
-       jt != oxms.matches.end(); ++jt) {
+  for (size_t i = 0; i < oxms.num_entries; i++) {
 
-    coxmatch const *rmatch = (jt->second);
+    coxmatch const *rmatch = oxms.entries[i].oxm;
 
     // keep in mind: match.get_oxm_id() & 0xfffffe00 == jt->first
 
     uint64_t id =
         (__UINT64_C(0xfffffe00) & rmatch->get_oxm_id()) << 32 |
         0 /*(rmatch->is_experimenter() ? rmatch->get_oxm_exp_id() : 0)*/;
-    if (matches.find(id) == matches.end()) {
+    if (NULL == find_match(id)) {
       wildcard_hits++;
       continue;
     }
 
-    if (*matches[jt->first] != *rmatch) {
+    if (*find_match(oxms.entries[i].oxm_type) != *rmatch) {
       missed++;
       result = false;
       continue;
@@ -363,157 +347,421 @@ bool coxmatches::is_part_of(coxmatches const &oxms, uint16_t &exact_hits,
 
 void coxmatches::copy_matches(const coxmatches &oxmatches) {
   clear();
-  std::vector<uint64_t> ids = oxmatches.get_ids();
-  for (std::vector<uint64_t>::const_iterator it = ids.begin(); it != ids.end();
-       ++it) {
-    switch (*it) {
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IN_PORT): {
-      add_ofb_in_port() = oxmatches.get_ofb_in_port();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IN_PHY_PORT): {
-      add_ofb_in_phy_port() = oxmatches.get_ofb_in_phy_port();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_METADATA): {
-      add_ofb_metadata() = oxmatches.get_ofb_metadata();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_DST): {
-      add_ofb_eth_dst() = oxmatches.get_ofb_eth_dst();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_SRC): {
-      add_ofb_eth_src() = oxmatches.get_ofb_eth_src();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_TYPE): {
-      add_ofb_eth_type() = oxmatches.get_ofb_eth_type();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_VID): {
-      add_ofb_vlan_vid() = oxmatches.get_ofb_vlan_vid();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_PCP): {
-      add_ofb_vlan_pcp() = oxmatches.get_ofb_vlan_pcp();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_DSCP): {
-      add_ofb_ip_dscp() = oxmatches.get_ofb_ip_dscp();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_ECN): {
-      add_ofb_ip_ecn() = oxmatches.get_ofb_ip_ecn();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_PROTO): {
-      add_ofb_ip_proto() = oxmatches.get_ofb_ip_proto();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_SRC): {
-      add_ofb_ipv4_src() = oxmatches.get_ofb_ipv4_src();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_DST): {
-      add_ofb_ipv4_dst() = oxmatches.get_ofb_ipv4_dst();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TCP_SRC): {
-      add_ofb_tcp_src() = oxmatches.get_ofb_tcp_src();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TCP_DST): {
-      add_ofb_tcp_dst() = oxmatches.get_ofb_tcp_dst();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_UDP_SRC): {
-      add_ofb_udp_src() = oxmatches.get_ofb_udp_src();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_UDP_DST): {
-      add_ofb_udp_dst() = oxmatches.get_ofb_udp_dst();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_SCTP_SRC): {
-      add_ofb_sctp_src() = oxmatches.get_ofb_sctp_src();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_SCTP_DST): {
-      add_ofb_sctp_dst() = oxmatches.get_ofb_sctp_dst();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV4_TYPE): {
-      add_ofb_icmpv4_type() = oxmatches.get_ofb_icmpv4_type();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV4_CODE): {
-      add_ofb_icmpv4_code() = oxmatches.get_ofb_icmpv4_code();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_OP): {
-      add_ofb_arp_opcode() = oxmatches.get_ofb_arp_opcode();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SPA): {
-      add_ofb_arp_spa() = oxmatches.get_ofb_arp_spa();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_TPA): {
-      add_ofb_arp_tpa() = oxmatches.get_ofb_arp_tpa();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SHA): {
-      add_ofb_arp_sha() = oxmatches.get_ofb_arp_sha();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_THA): {
-      add_ofb_arp_tha() = oxmatches.get_ofb_arp_tha();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_SRC): {
-      add_ofb_ipv6_src() = oxmatches.get_ofb_ipv6_src();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_DST): {
-      add_ofb_ipv6_dst() = oxmatches.get_ofb_ipv6_dst();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_FLABEL): {
-      add_ofb_ipv6_flabel() = oxmatches.get_ofb_ipv6_flabel();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV6_TYPE): {
-      add_ofb_icmpv6_type() = oxmatches.get_ofb_icmpv6_type();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV6_CODE): {
-      add_ofb_icmpv6_code() = oxmatches.get_ofb_icmpv6_code();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TARGET): {
-      add_ofb_ipv6_nd_target() = oxmatches.get_ofb_ipv6_nd_target();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_SLL): {
-      add_ofb_ipv6_nd_sll() = oxmatches.get_ofb_ipv6_nd_sll();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TLL): {
-      add_ofb_ipv6_nd_tll() = oxmatches.get_ofb_ipv6_nd_tll();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_LABEL): {
-      add_ofb_mpls_label() = oxmatches.get_ofb_mpls_label();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_TC): {
-      add_ofb_mpls_tc() = oxmatches.get_ofb_mpls_tc();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_BOS): {
-      add_ofb_mpls_bos() = oxmatches.get_ofb_mpls_bos();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_PBB_ISID): {
-      add_ofb_pbb_isid() = oxmatches.get_ofb_pbb_isid();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TUNNEL_ID): {
-      add_ofb_tunnel_id() = oxmatches.get_ofb_tunnel_id();
-    } break;
-    case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_EXTHDR): {
-      add_ofb_ipv6_exthdr() = oxmatches.get_ofb_ipv6_exthdr();
-    } break;
-    case OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_NW_SRC): {
-      add_ofx_nw_src() = oxmatches.get_ofx_nw_src();
-    } break;
-    case OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_NW_DST): {
-      add_ofx_nw_dst() = oxmatches.get_ofx_nw_dst();
-    } break;
-    case OXM_ROFL_OFX_TYPE(
-        rofl::openflow::experimental::OXM_TLV_EXPR_NW_PROTO): {
-      add_ofx_nw_proto() = oxmatches.get_ofx_nw_proto();
-    } break;
-    case OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_NW_TOS): {
-      add_ofx_nw_tos() = oxmatches.get_ofx_nw_tos();
-    } break;
-    case OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_TP_SRC): {
-      add_ofx_tp_src() = oxmatches.get_ofx_tp_src();
+  oxmatches.decode();
+  AcquireReadWriteLock lock(rwlock);
+  for (size_t i = 0; i < oxmatches.num_entries; i++) {
+    reserve_match();
+    coxmatch *match =
+        new_match(oxmatches.entries[i].oxm_type, oxmatches.entries[i].oxm);
+    if (NULL == match)
+      continue;
+    insert_match(oxmatches.entries[i].oxm_type, match);
+  }
+}
+
+std::map<uint64_t, coxmatch *> coxmatches::get_matches() const {
+  AcquireReadLock lock(rwlock);
+  decode();
+  std::map<uint64_t, coxmatch *> oxms;
+  for (size_t i = 0; i < num_entries; i++) {
+    oxms[entries[i].oxm_type] = entries[i].oxm;
+  }
+  return oxms;
+}
+
+void coxmatches::clear() {
+  AcquireReadWriteLock lock(rwlock);
+  wirelen = 0;
+  for (size_t i = 0; i < num_entries; i++) {
+    destroy_match(entries[i].oxm);
+  }
+  num_entries = 0;
+  if (entries != inline_entries) {
+    delete[] entries;
+    entries = inline_entries;
+    max_entries = OXM_INLINE_ENTRIES;
+  }
+  drop_raw();
+}
+
+coxmatch *coxmatches::find_match(uint64_t oxm_type) const {
+  oxm_entry key;
+  key.oxm_type = oxm_type;
+  oxm_entry *it = std::lower_bound(entries, entries + num_entries, key);
+  if ((it == entries + num_entries) || (it->oxm_type != oxm_type)) {
+    return NULL;
+  }
+  return it->oxm;
+}
+
+bool coxmatches::erase_match(uint64_t oxm_type) const {
+  oxm_entry key;
+  key.oxm_type = oxm_type;
+  oxm_entry *it = std::lower_bound(entries, entries + num_entries, key);
+  if ((it == entries + num_entries) || (it->oxm_type != oxm_type)) {
+    return false;
+  }
+  destroy_match(it->oxm);
+  std::copy(it + 1, entries + num_entries, it);
+  num_entries--;
+  return true;
+}
+
+void coxmatches::insert_match(uint64_t oxm_type, coxmatch *oxm) const {
+  oxm_entry key;
+  key.oxm_type = oxm_type;
+  oxm_entry *it = std::lower_bound(entries, entries + num_entries, key);
+  std::copy_backward(it, entries + num_entries, entries + num_entries + 1);
+  it->oxm_type = oxm_type;
+  it->oxm = oxm;
+  num_entries++;
+}
+
+void coxmatches::reserve_match() const {
+  if (num_entries < max_entries)
+    return;
+  oxm_entry *mem = new oxm_entry[2 * max_entries];
+  std::copy(entries, entries + num_entries, mem);
+  if (entries != inline_entries) {
+    delete[] entries;
+  }
+  entries = mem;
+  max_entries *= 2;
+}
+
+void *coxmatches::alloc_match(size_t size) const {
+  if (size <= OXM_BLOCK_SIZE) {
+    for (size_t i = 0; i < OXM_INLINE_BLOCKS; i++) {
+      if (blocks_used & (1U << i))
+        continue;
+      blocks_used |= (1U << i);
+      return &blocks[i];
+    }
+  }
+  return ::operator new(size);
+}
+
+void coxmatches::free_match(void *mem) const {
+  if ((mem >= (void *)&blocks[0]) &&
+      (mem < (void *)&blocks[OXM_INLINE_BLOCKS])) {
+    blocks_used &= ~(1U << ((oxm_block *)mem - &blocks[0]));
+    return;
+  }
+  ::operator delete(mem);
+}
+
+void coxmatches::destroy_match(coxmatch *oxm) const {
+  oxm->~coxmatch();
+  free_match(oxm);
+}
+
+coxmatch *coxmatches::new_match(uint64_t oxm_type,
+                                const coxmatch *orig) const {
+  switch (oxm_type) {
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IN_PORT):
+    return construct_from<coxmatch_ofb_in_port>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IN_PHY_PORT):
+    return construct_from<coxmatch_ofb_in_phy_port>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_METADATA):
+    return construct_from<coxmatch_ofb_metadata>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_DST):
+    return construct_from<coxmatch_ofb_eth_dst>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_SRC):
+    return construct_from<coxmatch_ofb_eth_src>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_TYPE):
+    return construct_from<coxmatch_ofb_eth_type>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_VID):
+    return construct_from<coxmatch_ofb_vlan_vid>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_PCP):
+    return construct_from<coxmatch_ofb_vlan_pcp>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_DSCP):
+    return construct_from<coxmatch_ofb_ip_dscp>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_ECN):
+    return construct_from<coxmatch_ofb_ip_ecn>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_PROTO):
+    return construct_from<coxmatch_ofb_ip_proto>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_SRC):
+    return construct_from<coxmatch_ofb_ipv4_src>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_DST):
+    return construct_from<coxmatch_ofb_ipv4_dst>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TCP_SRC):
+    return construct_from<coxmatch_ofb_tcp_src>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TCP_DST):
+    return construct_from<coxmatch_ofb_tcp_dst>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_UDP_SRC):
+    return construct_from<coxmatch_ofb_udp_src>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_UDP_DST):
+    return construct_from<coxmatch_ofb_udp_dst>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_SCTP_SRC):
+    return construct_from<coxmatch_ofb_sctp_src>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_SCTP_DST):
+    return construct_from<coxmatch_ofb_sctp_dst>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV4_TYPE):
+    return construct_from<coxmatch_ofb_icmpv4_type>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV4_CODE):
+    return construct_from<coxmatch_ofb_icmpv4_code>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_OP):
+    return construct_from<coxmatch_ofb_arp_opcode>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SPA):
+    return construct_from<coxmatch_ofb_arp_spa>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_TPA):
+    return construct_from<coxmatch_ofb_arp_tpa>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SHA):
+    return construct_from<coxmatch_ofb_arp_sha>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_THA):
+    return construct_from<coxmatch_ofb_arp_tha>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_SRC):
+    return construct_from<coxmatch_ofb_ipv6_src>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_DST):
+    return construct_from<coxmatch_ofb_ipv6_dst>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_FLABEL):
+    return construct_from<coxmatch_ofb_ipv6_flabel>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV6_TYPE):
+    return construct_from<coxmatch_ofb_icmpv6_type>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV6_CODE):
+    return construct_from<coxmatch_ofb_icmpv6_code>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TARGET):
+    return construct_from<coxmatch_ofb_ipv6_nd_target>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_SLL):
+    return construct_from<coxmatch_ofb_ipv6_nd_sll>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TLL):
+    return construct_from<coxmatch_ofb_ipv6_nd_tll>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_LABEL):
+    return construct_from<coxmatch_ofb_mpls_label>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_TC):
+    return construct_from<coxmatch_ofb_mpls_tc>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_BOS):
+    return construct_from<coxmatch_ofb_mpls_bos>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_PBB_ISID):
+    return construct_from<coxmatch_ofb_pbb_isid>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TUNNEL_ID):
+    return construct_from<coxmatch_ofb_tunnel_id>(orig);
+  case OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_EXTHDR):
+    return construct_from<coxmatch_ofb_ipv6_exthdr>(orig);
+  case OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_NW_SRC):
+    return construct_from<coxmatch_ofx_nw_src>(orig);
+  case OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_NW_DST):
+    return construct_from<coxmatch_ofx_nw_dst>(orig);
+  case OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_NW_PROTO):
+    return construct_from<coxmatch_ofx_nw_proto>(orig);
+  case OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_NW_TOS):
+    return construct_from<coxmatch_ofx_nw_tos>(orig);
+  case OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_TP_SRC):
+    return construct_from<coxmatch_ofx_tp_src>(orig);
+  case OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_TP_DST):
+    return construct_from<coxmatch_ofx_tp_dst>(orig);
+  default: {
+    if (OXM_ROFL_CLASS(oxm_type) ==
+        ((uint64_t)rofl::openflow::OFPXMC_EXPERIMENTER << 16)) {
+      if (NULL != orig) {
+        return construct_from<coxmatch_exp>(orig);
+      }
+      uint32_t exp_id = (oxm_type & 0xffffffff00000000) >> 32;
+      uint32_t oxm_id = (oxm_type & 0x00000000fffffe00) >> 0;
+      return construct<coxmatch_exp>(oxm_id, exp_id); // yes, this order!
+    }
+  };
+  }
+  return NULL;
+}
+
+void coxmatches::build_index() const {
+  if (indexed)
+    return;
+
+  index.clear();
+  verbatim = true;
+  rawlen = 0;
+
+  uint8_t *buf = raw.somem();
+  size_t buflen = raw.length();
+
+  while (buflen - rawlen >= sizeof(struct openflow::ofp_oxm_hdr)) {
+
+    struct rofl::openflow::ofp_oxm_tlv_hdr *oxm =
+        (struct rofl::openflow::ofp_oxm_tlv_hdr *)(buf + rawlen);
+
+    if (0 == oxm->oxm_id) {
+      break; // padding bytes found
+    }
+
+    struct openflow::ofp_oxm_hdr *hdr =
+        (struct openflow::ofp_oxm_hdr *)(buf + rawlen);
+
+    oxm_slot slot;
+    slot.oxm_type = OXM_ROFL_TYPE(be32toh(oxm->oxm_id));
+    slot.offset = rawlen;
+    slot.length = sizeof(struct openflow::ofp_oxm_hdr) + hdr->oxm_length;
+
+    bool supported = false;
+
+    switch (be16toh(hdr->oxm_class)) {
+    case rofl::openflow::OFPXMC_OPENFLOW_BASIC: {
+      uint64_t field = OXM_ROFL_FIELD(slot.oxm_type) >> 9;
+      supported =
+          (field <= (uint64_t)rofl::openflow::OFPXMT_OFB_IPV6_EXTHDR);
+      if (not supported)
+        break;
+      /* a field shorter than its type would fail when decoded */
+      size_t payload = ofb_payload_length[field];
+      if (be32toh(oxm->oxm_id) & 0x100) {
+        payload *= 2; // value and mask
+      }
+      if (hdr->oxm_length < payload) {
+        throw eOxmBadLen("coxmatches::build_index() oxm_length too short");
+      }
     } break;
-    case OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_TP_DST): {
-      add_ofx_tp_dst() = oxmatches.get_ofx_tp_dst();
+    case rofl::openflow::OFPXMC_EXPERIMENTER: {
+      if (buflen - rawlen <
+          sizeof(struct openflow::ofp_oxm_experimenter_header)) {
+        throw eOxmBadLen("coxmatches::build_index() buflen too short");
+      }
+      struct rofl::openflow::ofp_oxm_experimenter_header *exp =
+          (struct rofl::openflow::ofp_oxm_experimenter_header *)(buf + rawlen);
+      slot.oxm_type |= ((uint64_t)be32toh(exp->experimenter)) << 32;
+      supported = true;
     } break;
-    default: {
-      if (OXM_ROFL_CLASS(*it) ==
-          ((uint64_t)rofl::openflow::OFPXMC_EXPERIMENTER << 16)) {
-        uint32_t exp_id = (*it & 0xffffffff00000000) >> 32;
-        uint32_t oxm_id = (*it & 0x00000000fffffe00) >> 0;
-        add_exp_match(exp_id, oxm_id) = oxmatches.get_exp_match(exp_id, oxm_id);
+    }
+
+    if (buflen - rawlen < slot.length) {
+      if (supported) {
+        throw eOxmBadLen("coxmatches::build_index() buflen too short");
       }
-    };
+      verbatim = false;
+      break;
+    }
+
+    if (supported) {
+      index.push_back(slot);
+    } else {
+      verbatim = false;
+    }
+
+    rawlen += slot.length;
+  }
+
+  /* sort by type, the last TLV of a type wins as in eager mode */
+  std::stable_sort(index.begin(), index.end());
+  std::vector<oxm_slot> slots;
+  for (std::vector<oxm_slot>::const_iterator it = index.begin();
+       it != index.end(); ++it) {
+    if ((not slots.empty()) && (slots.back().oxm_type == it->oxm_type)) {
+      slots.back() = *it;
+      verbatim = false;
+    } else {
+      slots.push_back(*it);
     }
   }
+  index.swap(slots);
+
+  indexed = true;
+}
+
+const coxmatch &coxmatches::get_undecoded(uint64_t oxm_type) const {
+  AcquireReadWriteLock lock(rawlock);
+
+  if (not pending) {
+    /* decoded entirely meanwhile */
+    const coxmatch *match = find_match(oxm_type);
+    if (NULL == match) {
+      throw eOxmInval("coxmatches::get_undecoded() not found");
+    }
+    return *match;
+  }
+
+  if (decoded.find(oxm_type) != decoded.end()) {
+    return *decoded.at(oxm_type);
+  }
+
+  build_index();
+
+  oxm_slot key;
+  key.oxm_type = oxm_type;
+  std::vector<oxm_slot>::const_iterator it =
+      std::lower_bound(index.begin(), index.end(), key);
+  if ((it == index.end()) || (it->oxm_type != oxm_type)) {
+    throw eOxmInval("coxmatches::get_undecoded() not found");
+  }
+
+  coxmatch *match = new_match(oxm_type);
+  try {
+    match->unpack(raw.somem() + it->offset, it->length);
+  } catch (...) {
+    destroy_match(match);
+    throw;
+  }
+  decoded[oxm_type] = match;
+  return *match;
+}
+
+bool coxmatches::has_undecoded(uint64_t oxm_type) const {
+  AcquireReadWriteLock lock(rawlock);
+  build_index();
+  oxm_slot key;
+  key.oxm_type = oxm_type;
+  return std::binary_search(index.begin(), index.end(), key);
+}
+
+std::vector<uint64_t> coxmatches::undecoded_ids() const {
+  AcquireReadWriteLock lock(rawlock);
+  build_index();
+  std::vector<uint64_t> ids;
+  for (std::vector<oxm_slot>::const_iterator it = index.begin();
+       it != index.end(); ++it) {
+    ids.push_back(it->oxm_type);
+  }
+  return ids;
+}
+
+void coxmatches::decode() const {
+  AcquireReadWriteLock lock(rawlock);
+
+  if (not pending)
+    return;
+
+  build_index();
+
+  for (std::vector<oxm_slot>::const_iterator it = index.begin();
+       it != index.end(); ++it) {
+    if (NULL != find_match(it->oxm_type)) {
+      continue;
+    }
+    reserve_match();
+    if (decoded.find(it->oxm_type) != decoded.end()) {
+      insert_match(it->oxm_type, decoded[it->oxm_type]);
+      decoded.erase(it->oxm_type);
+      continue;
+    }
+    coxmatch *match = new_match(it->oxm_type);
+    try {
+      match->unpack(raw.somem() + it->offset, it->length);
+    } catch (...) {
+      destroy_match(match);
+      throw;
+    }
+    insert_match(it->oxm_type, match);
+  }
+
+  pending = false;
+}
+
+void coxmatches::materialize() {
+  if (raw.empty())
+    return;
+  decode();
+  drop_raw();
+}
+
+void coxmatches::drop_raw() {
+  for (std::map<uint64_t, coxmatch *>::iterator it = decoded.begin();
+       it != decoded.end(); ++it) {
+    destroy_match(it->second);
+  }
+  decoded.clear();
+  index.clear();
+  indexed = false;
+  verbatim = true;
+  rawlen = 0;
+  raw.resize(0);
+  pending = false;
 }
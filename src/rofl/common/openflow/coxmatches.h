@@ -19,6 +19,9 @@
 #include <vector>
 
 #include <algorithm>
+#include <atomic>
+#include <new>
+#include <utility>
 
 #include "rofl/common/cmemory.h"
 #include "rofl/common/exception.hpp"
@@ -90,19 +93,30 @@ public:
 
 public:
   /**
+   * @brief	Enables lazy decoding of OXM TLVs in unpack()
    *
+   * In lazy mode unpack() keeps the raw TLVs. Typed OXM objects are created
+   * on first access to a single TLV, all TLVs are decoded on the first
+   * modification. Until then, pack() re-emits the raw TLVs unchanged.
+   * Malformed TLVs are reported on first access rather than by unpack().
    */
-  void copy_matches(const coxmatches &oxmatches);
+  void set_lazy(bool lazy = true) { this->lazy = lazy; };
 
   /**
    *
    */
-  std::map<uint64_t, coxmatch *> &set_matches() { return matches; }
+  bool get_lazy() const { return lazy; };
 
+public:
   /**
    *
    */
-  const std::map<uint64_t, coxmatch *> &get_matches() const { return matches; }
+  void copy_matches(const coxmatches &oxmatches);
+
+  /**
+   * @brief	Returns map of all OXMs, the OXMs remain owned by this instance
+   */
+  std::map<uint64_t, coxmatch *> get_matches() const;
 
   /**
    *
@@ -119,9 +133,10 @@ public:
   std::vector<uint64_t> get_ids() const {
     std::vector<uint64_t> ids;
     AcquireReadLock lock(rwlock);
-    for (std::map<uint64_t, coxmatch *>::const_iterator it = matches.begin();
-         it != matches.end(); ++it) {
-      ids.push_back(it->first);
+    if (undecoded())
+      return undecoded_ids();
+    for (size_t i = 0; i < num_entries; i++) {
+      ids.push_back(entries[i].oxm_type);
     }
     return ids;
   };
@@ -129,14 +144,7 @@ public:
   /**
    *
    */
-  void clear() {
-    AcquireReadWriteLock lock(rwlock);
-    for (std::map<uint64_t, coxmatch *>::iterator it = matches.begin();
-         it != matches.end(); ++it) {
-      delete it->second;
-    }
-    matches.clear();
-  };
+  void clear();
 
 public:
   /**
@@ -144,14 +152,8 @@ public:
    */
   coxmatch_ofb_in_port &add_ofb_in_port(uint32_t in_port = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IN_PORT)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IN_PORT)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IN_PORT)] =
-        new coxmatch_ofb_in_port(in_port);
-    return dynamic_cast<coxmatch_ofb_in_port &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IN_PORT)]);
+    return add_match<coxmatch_ofb_in_port>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IN_PORT), in_port);
   };
 
   /**
@@ -159,13 +161,8 @@ public:
    */
   coxmatch_ofb_in_port &set_ofb_in_port() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IN_PORT)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IN_PORT)] =
-          new coxmatch_ofb_in_port();
-    }
-    return dynamic_cast<coxmatch_ofb_in_port &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IN_PORT)]);
+    return set_match<coxmatch_ofb_in_port>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IN_PORT));
   };
 
   /**
@@ -173,12 +170,8 @@ public:
    */
   const coxmatch_ofb_in_port &get_ofb_in_port() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IN_PORT)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_in_port() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_in_port &>(
-        *matches.at(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IN_PORT)));
+    return get_match<coxmatch_ofb_in_port>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IN_PORT));
   };
 
   /**
@@ -186,13 +179,7 @@ public:
    */
   bool drop_ofb_in_port() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IN_PORT)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IN_PORT)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IN_PORT));
-    return true;
+    return drop_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IN_PORT));
   };
 
   /**
@@ -200,8 +187,7 @@ public:
    */
   bool has_ofb_in_port() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFB_TYPE(
-                    rofl::openflow::OXM_TLV_BASIC_IN_PORT)) == matches.end()));
+    return has_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IN_PORT));
   };
 
 public:
@@ -210,15 +196,9 @@ public:
    */
   coxmatch_ofb_in_phy_port &add_ofb_in_phy_port(uint32_t in_phy_port = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IN_PHY_PORT)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(
-          rofl::openflow::OXM_TLV_BASIC_IN_PHY_PORT)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IN_PHY_PORT)] =
-        new coxmatch_ofb_in_phy_port(in_phy_port);
-    return dynamic_cast<coxmatch_ofb_in_phy_port &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IN_PHY_PORT)]);
+    return add_match<coxmatch_ofb_in_phy_port>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IN_PHY_PORT),
+        in_phy_port);
   };
 
   /**
@@ -226,13 +206,8 @@ public:
    */
   coxmatch_ofb_in_phy_port &set_ofb_in_phy_port() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IN_PHY_PORT)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IN_PHY_PORT)] =
-          new coxmatch_ofb_in_phy_port();
-    }
-    return dynamic_cast<coxmatch_ofb_in_phy_port &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IN_PHY_PORT)]);
+    return set_match<coxmatch_ofb_in_phy_port>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IN_PHY_PORT));
   };
 
   /**
@@ -240,12 +215,8 @@ public:
    */
   const coxmatch_ofb_in_phy_port &get_ofb_in_phy_port() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IN_PHY_PORT)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_in_phy_port() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_in_phy_port &>(*matches.at(
-        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IN_PHY_PORT)));
+    return get_match<coxmatch_ofb_in_phy_port>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IN_PHY_PORT));
   };
 
   /**
@@ -253,14 +224,8 @@ public:
    */
   bool drop_ofb_in_phy_port() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IN_PHY_PORT)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(
-        rofl::openflow::OXM_TLV_BASIC_IN_PHY_PORT)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IN_PHY_PORT));
-    return true;
+    return drop_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IN_PHY_PORT));
   };
 
   /**
@@ -268,9 +233,8 @@ public:
    */
   bool has_ofb_in_phy_port() const {
     AcquireReadLock lock(rwlock);
-    return (
-        not(matches.find(OXM_ROFL_OFB_TYPE(
-                rofl::openflow::OXM_TLV_BASIC_IN_PHY_PORT)) == matches.end()));
+    return has_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IN_PHY_PORT));
   };
 
 public:
@@ -279,14 +243,8 @@ public:
    */
   coxmatch_ofb_metadata &add_ofb_metadata(uint64_t metadata = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_METADATA)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_METADATA)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_METADATA)] =
-        new coxmatch_ofb_metadata(metadata);
-    return dynamic_cast<coxmatch_ofb_metadata &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_METADATA)]);
+    return add_match<coxmatch_ofb_metadata>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_METADATA), metadata);
   };
 
   /**
@@ -294,14 +252,9 @@ public:
    */
   coxmatch_ofb_metadata &add_ofb_metadata(uint64_t metadata, uint64_t mask) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_METADATA)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_METADATA)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_METADATA)] =
-        new coxmatch_ofb_metadata(metadata, mask);
-    return dynamic_cast<coxmatch_ofb_metadata &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_METADATA)]);
+    return add_match<coxmatch_ofb_metadata>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_METADATA),
+        metadata, mask);
   };
 
   /**
@@ -309,13 +262,8 @@ public:
    */
   coxmatch_ofb_metadata &set_ofb_metadata() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_METADATA)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_METADATA)] =
-          new coxmatch_ofb_metadata();
-    }
-    return dynamic_cast<coxmatch_ofb_metadata &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_METADATA)]);
+    return set_match<coxmatch_ofb_metadata>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_METADATA));
   };
 
   /**
@@ -323,12 +271,8 @@ public:
    */
   const coxmatch_ofb_metadata &get_ofb_metadata() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_METADATA)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_metadata() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_metadata &>(
-        *matches.at(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_METADATA)));
+    return get_match<coxmatch_ofb_metadata>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_METADATA));
   };
 
   /**
@@ -336,13 +280,8 @@ public:
    */
   bool drop_ofb_metadata() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_METADATA)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_METADATA)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_METADATA));
-    return true;
+    return drop_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_METADATA));
   };
 
   /**
@@ -350,8 +289,7 @@ public:
    */
   bool has_ofb_metadata() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFB_TYPE(
-                    rofl::openflow::OXM_TLV_BASIC_METADATA)) == matches.end()));
+    return has_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_METADATA));
   };
 
 public:
@@ -361,14 +299,8 @@ public:
   coxmatch_ofb_eth_dst &
   add_ofb_eth_dst(const rofl::caddress_ll &eth_dst = rofl::caddress_ll()) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ETH_DST)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_DST)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_DST)] =
-        new coxmatch_ofb_eth_dst(eth_dst);
-    return dynamic_cast<coxmatch_ofb_eth_dst &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_DST)]);
+    return add_match<coxmatch_ofb_eth_dst>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_DST), eth_dst);
   };
 
   /**
@@ -377,14 +309,9 @@ public:
   coxmatch_ofb_eth_dst &add_ofb_eth_dst(const rofl::caddress_ll &eth_dst,
                                         const rofl::caddress_ll &mask) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ETH_DST)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_DST)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_DST)] =
-        new coxmatch_ofb_eth_dst(eth_dst, mask);
-    return dynamic_cast<coxmatch_ofb_eth_dst &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_DST)]);
+    return add_match<coxmatch_ofb_eth_dst>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_DST),
+        eth_dst, mask);
   };
 
   /**
@@ -392,13 +319,8 @@ public:
    */
   coxmatch_ofb_eth_dst &set_ofb_eth_dst() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ETH_DST)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_DST)] =
-          new coxmatch_ofb_eth_dst();
-    }
-    return dynamic_cast<coxmatch_ofb_eth_dst &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_DST)]);
+    return set_match<coxmatch_ofb_eth_dst>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_DST));
   };
 
   /**
@@ -406,12 +328,8 @@ public:
    */
   const coxmatch_ofb_eth_dst &get_ofb_eth_dst() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ETH_DST)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_eth_dst() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_eth_dst &>(
-        *matches.at(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_DST)));
+    return get_match<coxmatch_ofb_eth_dst>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_DST));
   };
 
   /**
@@ -419,13 +337,7 @@ public:
    */
   bool drop_ofb_eth_dst() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ETH_DST)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_DST)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_DST));
-    return true;
+    return drop_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_DST));
   };
 
   /**
@@ -433,8 +345,7 @@ public:
    */
   bool has_ofb_eth_dst() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFB_TYPE(
-                    rofl::openflow::OXM_TLV_BASIC_ETH_DST)) == matches.end()));
+    return has_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_DST));
   };
 
 public:
@@ -444,14 +355,8 @@ public:
   coxmatch_ofb_eth_src &
   add_ofb_eth_src(const rofl::caddress_ll &eth_src = rofl::caddress_ll()) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ETH_SRC)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_SRC)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_SRC)] =
-        new coxmatch_ofb_eth_src(eth_src);
-    return dynamic_cast<coxmatch_ofb_eth_src &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_SRC)]);
+    return add_match<coxmatch_ofb_eth_src>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_SRC), eth_src);
   };
 
   /**
@@ -460,14 +365,9 @@ public:
   coxmatch_ofb_eth_src &add_ofb_eth_src(const rofl::caddress_ll &eth_src,
                                         const rofl::caddress_ll &mask) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ETH_SRC)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_SRC)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_SRC)] =
-        new coxmatch_ofb_eth_src(eth_src, mask);
-    return dynamic_cast<coxmatch_ofb_eth_src &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_SRC)]);
+    return add_match<coxmatch_ofb_eth_src>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_SRC),
+        eth_src, mask);
   };
 
   /**
@@ -475,13 +375,8 @@ public:
    */
   coxmatch_ofb_eth_src &set_ofb_eth_src() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ETH_SRC)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_SRC)] =
-          new coxmatch_ofb_eth_src();
-    }
-    return dynamic_cast<coxmatch_ofb_eth_src &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_SRC)]);
+    return set_match<coxmatch_ofb_eth_src>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_SRC));
   };
 
   /**
@@ -489,12 +384,8 @@ public:
    */
   const coxmatch_ofb_eth_src &get_ofb_eth_src() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ETH_SRC)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_eth_src() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_eth_src &>(
-        *matches.at(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_SRC)));
+    return get_match<coxmatch_ofb_eth_src>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_SRC));
   };
 
   /**
@@ -502,13 +393,7 @@ public:
    */
   bool drop_ofb_eth_src() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ETH_SRC)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_SRC)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_SRC));
-    return true;
+    return drop_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_SRC));
   };
 
   /**
@@ -516,8 +401,7 @@ public:
    */
   bool has_ofb_eth_src() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFB_TYPE(
-                    rofl::openflow::OXM_TLV_BASIC_ETH_SRC)) == matches.end()));
+    return has_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_SRC));
   };
 
 public:
@@ -526,14 +410,8 @@ public:
    */
   coxmatch_ofb_eth_type &add_ofb_eth_type(uint16_t eth_type = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ETH_TYPE)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_TYPE)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_TYPE)] =
-        new coxmatch_ofb_eth_type(eth_type);
-    return dynamic_cast<coxmatch_ofb_eth_type &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_TYPE)]);
+    return add_match<coxmatch_ofb_eth_type>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_TYPE), eth_type);
   };
 
   /**
@@ -541,13 +419,8 @@ public:
    */
   coxmatch_ofb_eth_type &set_ofb_eth_type() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ETH_TYPE)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_TYPE)] =
-          new coxmatch_ofb_eth_type();
-    }
-    return dynamic_cast<coxmatch_ofb_eth_type &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_TYPE)]);
+    return set_match<coxmatch_ofb_eth_type>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_TYPE));
   };
 
   /**
@@ -555,12 +428,8 @@ public:
    */
   const coxmatch_ofb_eth_type &get_ofb_eth_type() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ETH_TYPE)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_eth_type() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_eth_type &>(
-        *matches.at(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_TYPE)));
+    return get_match<coxmatch_ofb_eth_type>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_TYPE));
   };
 
   /**
@@ -568,13 +437,8 @@ public:
    */
   bool drop_ofb_eth_type() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ETH_TYPE)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_TYPE)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_TYPE));
-    return true;
+    return drop_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_TYPE));
   };
 
   /**
@@ -582,8 +446,7 @@ public:
    */
   bool has_ofb_eth_type() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFB_TYPE(
-                    rofl::openflow::OXM_TLV_BASIC_ETH_TYPE)) == matches.end()));
+    return has_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ETH_TYPE));
   };
 
 public:
@@ -592,14 +455,8 @@ public:
    */
   coxmatch_ofb_vlan_vid &add_ofb_vlan_vid(uint16_t vlan_vid = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_VLAN_VID)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_VID)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_VID)] =
-        new coxmatch_ofb_vlan_vid(vlan_vid);
-    return dynamic_cast<coxmatch_ofb_vlan_vid &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_VID)]);
+    return add_match<coxmatch_ofb_vlan_vid>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_VID), vlan_vid);
   };
 
   /**
@@ -607,14 +464,9 @@ public:
    */
   coxmatch_ofb_vlan_vid &add_ofb_vlan_vid(uint16_t vlan_vid, uint16_t mask) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_VLAN_VID)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_VID)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_VID)] =
-        new coxmatch_ofb_vlan_vid(vlan_vid, mask);
-    return dynamic_cast<coxmatch_ofb_vlan_vid &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_VID)]);
+    return add_match<coxmatch_ofb_vlan_vid>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_VID),
+        vlan_vid, mask);
   };
 
   /**
@@ -622,13 +474,8 @@ public:
    */
   coxmatch_ofb_vlan_vid &set_ofb_vlan_vid() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_VLAN_VID)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_VID)] =
-          new coxmatch_ofb_vlan_vid();
-    }
-    return dynamic_cast<coxmatch_ofb_vlan_vid &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_VID)]);
+    return set_match<coxmatch_ofb_vlan_vid>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_VID));
   };
 
   /**
@@ -636,12 +483,8 @@ public:
    */
   const coxmatch_ofb_vlan_vid &get_ofb_vlan_vid() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_VLAN_VID)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_vlan_vid() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_vlan_vid &>(
-        *matches.at(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_VID)));
+    return get_match<coxmatch_ofb_vlan_vid>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_VID));
   };
 
   /**
@@ -649,13 +492,8 @@ public:
    */
   bool drop_ofb_vlan_vid() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_VLAN_VID)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_VID)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_VID));
-    return true;
+    return drop_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_VID));
   };
 
   /**
@@ -663,8 +501,7 @@ public:
    */
   bool has_ofb_vlan_vid() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFB_TYPE(
-                    rofl::openflow::OXM_TLV_BASIC_VLAN_VID)) == matches.end()));
+    return has_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_VID));
   };
 
 public:
@@ -673,14 +510,8 @@ public:
    */
   coxmatch_ofb_vlan_pcp &add_ofb_vlan_pcp(uint8_t vlan_pcp = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_VLAN_PCP)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_PCP)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_PCP)] =
-        new coxmatch_ofb_vlan_pcp(vlan_pcp);
-    return dynamic_cast<coxmatch_ofb_vlan_pcp &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_PCP)]);
+    return add_match<coxmatch_ofb_vlan_pcp>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_PCP), vlan_pcp);
   };
 
   /**
@@ -688,13 +519,8 @@ public:
    */
   coxmatch_ofb_vlan_pcp &set_ofb_vlan_pcp() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_VLAN_PCP)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_PCP)] =
-          new coxmatch_ofb_vlan_pcp();
-    }
-    return dynamic_cast<coxmatch_ofb_vlan_pcp &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_PCP)]);
+    return set_match<coxmatch_ofb_vlan_pcp>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_PCP));
   };
 
   /**
@@ -702,12 +528,8 @@ public:
    */
   const coxmatch_ofb_vlan_pcp &get_ofb_vlan_pcp() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_VLAN_PCP)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_vlan_pcp() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_vlan_pcp &>(
-        *matches.at(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_PCP)));
+    return get_match<coxmatch_ofb_vlan_pcp>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_PCP));
   };
 
   /**
@@ -715,13 +537,8 @@ public:
    */
   bool drop_ofb_vlan_pcp() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_VLAN_PCP)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_PCP)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_PCP));
-    return true;
+    return drop_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_PCP));
   };
 
   /**
@@ -729,8 +546,7 @@ public:
    */
   bool has_ofb_vlan_pcp() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFB_TYPE(
-                    rofl::openflow::OXM_TLV_BASIC_VLAN_PCP)) == matches.end()));
+    return has_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_VLAN_PCP));
   };
 
 public:
@@ -739,14 +555,8 @@ public:
    */
   coxmatch_ofb_ip_dscp &add_ofb_ip_dscp(uint8_t ip_dscp = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IP_DSCP)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_DSCP)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_DSCP)] =
-        new coxmatch_ofb_ip_dscp(ip_dscp);
-    return dynamic_cast<coxmatch_ofb_ip_dscp &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_DSCP)]);
+    return add_match<coxmatch_ofb_ip_dscp>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_DSCP), ip_dscp);
   };
 
   /**
@@ -754,13 +564,8 @@ public:
    */
   coxmatch_ofb_ip_dscp &set_ofb_ip_dscp() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IP_DSCP)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_DSCP)] =
-          new coxmatch_ofb_ip_dscp();
-    }
-    return dynamic_cast<coxmatch_ofb_ip_dscp &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_DSCP)]);
+    return set_match<coxmatch_ofb_ip_dscp>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_DSCP));
   };
 
   /**
@@ -768,12 +573,8 @@ public:
    */
   const coxmatch_ofb_ip_dscp &get_ofb_ip_dscp() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IP_DSCP)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_ip_dscp() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_ip_dscp &>(
-        *matches.at(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_DSCP)));
+    return get_match<coxmatch_ofb_ip_dscp>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_DSCP));
   };
 
   /**
@@ -781,13 +582,7 @@ public:
    */
   bool drop_ofb_ip_dscp() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IP_DSCP)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_DSCP)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_DSCP));
-    return true;
+    return drop_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_DSCP));
   };
 
   /**
@@ -795,8 +590,7 @@ public:
    */
   bool has_ofb_ip_dscp() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFB_TYPE(
-                    rofl::openflow::OXM_TLV_BASIC_IP_DSCP)) == matches.end()));
+    return has_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_DSCP));
   };
 
 public:
@@ -805,14 +599,8 @@ public:
    */
   coxmatch_ofb_ip_ecn &add_ofb_ip_ecn(uint8_t ip_ecn = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_ECN)) !=
-        matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_ECN)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_ECN)] =
-        new coxmatch_ofb_ip_ecn(ip_ecn);
-    return dynamic_cast<coxmatch_ofb_ip_ecn &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_ECN)]);
+    return add_match<coxmatch_ofb_ip_ecn>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_ECN), ip_ecn);
   };
 
   /**
@@ -820,13 +608,8 @@ public:
    */
   coxmatch_ofb_ip_ecn &set_ofb_ip_ecn() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_ECN)) ==
-        matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_ECN)] =
-          new coxmatch_ofb_ip_ecn();
-    }
-    return dynamic_cast<coxmatch_ofb_ip_ecn &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_ECN)]);
+    return set_match<coxmatch_ofb_ip_ecn>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_ECN));
   };
 
   /**
@@ -834,12 +617,8 @@ public:
    */
   const coxmatch_ofb_ip_ecn &get_ofb_ip_ecn() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_ECN)) ==
-        matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_ip_ecn() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_ip_ecn &>(
-        *matches.at(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_ECN)));
+    return get_match<coxmatch_ofb_ip_ecn>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_ECN));
   };
 
   /**
@@ -847,13 +626,7 @@ public:
    */
   bool drop_ofb_ip_ecn() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_ECN)) ==
-        matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_ECN)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_ECN));
-    return true;
+    return drop_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_ECN));
   };
 
   /**
@@ -861,8 +634,7 @@ public:
    */
   bool has_ofb_ip_ecn() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFB_TYPE(
-                    rofl::openflow::OXM_TLV_BASIC_IP_ECN)) == matches.end()));
+    return has_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_ECN));
   };
 
 public:
@@ -871,14 +643,8 @@ public:
    */
   coxmatch_ofb_ip_proto &add_ofb_ip_proto(uint8_t ip_proto = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IP_PROTO)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_PROTO)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_PROTO)] =
-        new coxmatch_ofb_ip_proto(ip_proto);
-    return dynamic_cast<coxmatch_ofb_ip_proto &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_PROTO)]);
+    return add_match<coxmatch_ofb_ip_proto>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_PROTO), ip_proto);
   };
 
   /**
@@ -886,13 +652,8 @@ public:
    */
   coxmatch_ofb_ip_proto &set_ofb_ip_proto() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IP_PROTO)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_PROTO)] =
-          new coxmatch_ofb_ip_proto();
-    }
-    return dynamic_cast<coxmatch_ofb_ip_proto &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_PROTO)]);
+    return set_match<coxmatch_ofb_ip_proto>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_PROTO));
   };
 
   /**
@@ -900,12 +661,8 @@ public:
    */
   const coxmatch_ofb_ip_proto &get_ofb_ip_proto() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IP_PROTO)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_ip_proto() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_ip_proto &>(
-        *matches.at(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_PROTO)));
+    return get_match<coxmatch_ofb_ip_proto>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_PROTO));
   };
 
   /**
@@ -913,13 +670,8 @@ public:
    */
   bool drop_ofb_ip_proto() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IP_PROTO)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_PROTO)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_PROTO));
-    return true;
+    return drop_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_PROTO));
   };
 
   /**
@@ -927,8 +679,7 @@ public:
    */
   bool has_ofb_ip_proto() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFB_TYPE(
-                    rofl::openflow::OXM_TLV_BASIC_IP_PROTO)) == matches.end()));
+    return has_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IP_PROTO));
   };
 
 public:
@@ -938,14 +689,8 @@ public:
   coxmatch_ofb_ipv4_src &
   add_ofb_ipv4_src(const rofl::caddress_in4 &addr = rofl::caddress_in4()) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV4_SRC)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_SRC)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_SRC)] =
-        new coxmatch_ofb_ipv4_src(addr);
-    return dynamic_cast<coxmatch_ofb_ipv4_src &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_SRC)]);
+    return add_match<coxmatch_ofb_ipv4_src>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_SRC), addr);
   };
 
   /**
@@ -954,14 +699,8 @@ public:
   coxmatch_ofb_ipv4_src &add_ofb_ipv4_src(const rofl::caddress_in4 &addr,
                                           const rofl::caddress_in4 &mask) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV4_SRC)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_SRC)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_SRC)] =
-        new coxmatch_ofb_ipv4_src(addr, mask);
-    return dynamic_cast<coxmatch_ofb_ipv4_src &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_SRC)]);
+    return add_match<coxmatch_ofb_ipv4_src>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_SRC), addr, mask);
   };
 
   /**
@@ -969,13 +708,8 @@ public:
    */
   coxmatch_ofb_ipv4_src &set_ofb_ipv4_src() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV4_SRC)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_SRC)] =
-          new coxmatch_ofb_ipv4_src();
-    }
-    return dynamic_cast<coxmatch_ofb_ipv4_src &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_SRC)]);
+    return set_match<coxmatch_ofb_ipv4_src>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_SRC));
   };
 
   /**
@@ -983,12 +717,8 @@ public:
    */
   const coxmatch_ofb_ipv4_src &get_ofb_ipv4_src() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV4_SRC)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_ipv4_src() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_ipv4_src &>(
-        *matches.at(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_SRC)));
+    return get_match<coxmatch_ofb_ipv4_src>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_SRC));
   };
 
   /**
@@ -996,13 +726,8 @@ public:
    */
   bool drop_ofb_ipv4_src() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV4_SRC)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_SRC)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_SRC));
-    return true;
+    return drop_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_SRC));
   };
 
   /**
@@ -1010,8 +735,7 @@ public:
    */
   bool has_ofb_ipv4_src() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFB_TYPE(
-                    rofl::openflow::OXM_TLV_BASIC_IPV4_SRC)) == matches.end()));
+    return has_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_SRC));
   };
 
 public:
@@ -1021,14 +745,8 @@ public:
   coxmatch_ofb_ipv4_dst &
   add_ofb_ipv4_dst(const rofl::caddress_in4 &addr = rofl::caddress_in4()) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV4_DST)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_DST)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_DST)] =
-        new coxmatch_ofb_ipv4_dst(addr);
-    return dynamic_cast<coxmatch_ofb_ipv4_dst &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_DST)]);
+    return add_match<coxmatch_ofb_ipv4_dst>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_DST), addr);
   };
 
   /**
@@ -1037,14 +755,8 @@ public:
   coxmatch_ofb_ipv4_dst &add_ofb_ipv4_dst(const rofl::caddress_in4 &addr,
                                           const rofl::caddress_in4 &mask) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV4_DST)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_DST)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_DST)] =
-        new coxmatch_ofb_ipv4_dst(addr, mask);
-    return dynamic_cast<coxmatch_ofb_ipv4_dst &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_DST)]);
+    return add_match<coxmatch_ofb_ipv4_dst>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_DST), addr, mask);
   };
 
   /**
@@ -1052,13 +764,8 @@ public:
    */
   coxmatch_ofb_ipv4_dst &set_ofb_ipv4_dst() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV4_DST)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_DST)] =
-          new coxmatch_ofb_ipv4_dst();
-    }
-    return dynamic_cast<coxmatch_ofb_ipv4_dst &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_DST)]);
+    return set_match<coxmatch_ofb_ipv4_dst>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_DST));
   };
 
   /**
@@ -1066,12 +773,8 @@ public:
    */
   const coxmatch_ofb_ipv4_dst &get_ofb_ipv4_dst() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV4_DST)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_ipv4_dst() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_ipv4_dst &>(
-        *matches.at(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_DST)));
+    return get_match<coxmatch_ofb_ipv4_dst>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_DST));
   };
 
   /**
@@ -1079,13 +782,8 @@ public:
    */
   bool drop_ofb_ipv4_dst() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV4_DST)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_DST)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_DST));
-    return true;
+    return drop_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_DST));
   };
 
   /**
@@ -1093,8 +791,7 @@ public:
    */
   bool has_ofb_ipv4_dst() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFB_TYPE(
-                    rofl::openflow::OXM_TLV_BASIC_IPV4_DST)) == matches.end()));
+    return has_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV4_DST));
   };
 
 public:
@@ -1104,14 +801,8 @@ public:
   coxmatch_ofb_ipv6_src &
   add_ofb_ipv6_src(const rofl::caddress_in6 &addr = rofl::caddress_in6()) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_SRC)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_SRC)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_SRC)] =
-        new coxmatch_ofb_ipv6_src(addr);
-    return dynamic_cast<coxmatch_ofb_ipv6_src &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_SRC)]);
+    return add_match<coxmatch_ofb_ipv6_src>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_SRC), addr);
   };
 
   /**
@@ -1120,14 +811,8 @@ public:
   coxmatch_ofb_ipv6_src &add_ofb_ipv6_src(const rofl::caddress_in6 &addr,
                                           const rofl::caddress_in6 &mask) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_SRC)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_SRC)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_SRC)] =
-        new coxmatch_ofb_ipv6_src(addr, mask);
-    return dynamic_cast<coxmatch_ofb_ipv6_src &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_SRC)]);
+    return add_match<coxmatch_ofb_ipv6_src>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_SRC), addr, mask);
   };
 
   /**
@@ -1135,13 +820,8 @@ public:
    */
   coxmatch_ofb_ipv6_src &set_ofb_ipv6_src() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_SRC)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_SRC)] =
-          new coxmatch_ofb_ipv6_src();
-    }
-    return dynamic_cast<coxmatch_ofb_ipv6_src &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_SRC)]);
+    return set_match<coxmatch_ofb_ipv6_src>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_SRC));
   };
 
   /**
@@ -1149,12 +829,8 @@ public:
    */
   const coxmatch_ofb_ipv6_src &get_ofb_ipv6_src() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_SRC)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_ipv6_src() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_ipv6_src &>(
-        *matches.at(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_SRC)));
+    return get_match<coxmatch_ofb_ipv6_src>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_SRC));
   };
 
   /**
@@ -1162,13 +838,8 @@ public:
    */
   bool drop_ofb_ipv6_src() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_SRC)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_SRC)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_SRC));
-    return true;
+    return drop_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_SRC));
   };
 
   /**
@@ -1176,8 +847,7 @@ public:
    */
   bool has_ofb_ipv6_src() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFB_TYPE(
-                    rofl::openflow::OXM_TLV_BASIC_IPV6_SRC)) == matches.end()));
+    return has_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_SRC));
   };
 
 public:
@@ -1187,14 +857,8 @@ public:
   coxmatch_ofb_ipv6_dst &
   add_ofb_ipv6_dst(const rofl::caddress_in6 &addr = rofl::caddress_in6()) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_DST)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_DST)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_DST)] =
-        new coxmatch_ofb_ipv6_dst(addr);
-    return dynamic_cast<coxmatch_ofb_ipv6_dst &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_DST)]);
+    return add_match<coxmatch_ofb_ipv6_dst>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_DST), addr);
   };
 
   /**
@@ -1203,14 +867,8 @@ public:
   coxmatch_ofb_ipv6_dst &add_ofb_ipv6_dst(const rofl::caddress_in6 &addr,
                                           const rofl::caddress_in6 &mask) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_DST)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_DST)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_DST)] =
-        new coxmatch_ofb_ipv6_dst(addr, mask);
-    return dynamic_cast<coxmatch_ofb_ipv6_dst &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_DST)]);
+    return add_match<coxmatch_ofb_ipv6_dst>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_DST), addr, mask);
   };
 
   /**
@@ -1218,13 +876,8 @@ public:
    */
   coxmatch_ofb_ipv6_dst &set_ofb_ipv6_dst() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_DST)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_DST)] =
-          new coxmatch_ofb_ipv6_dst();
-    }
-    return dynamic_cast<coxmatch_ofb_ipv6_dst &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_DST)]);
+    return set_match<coxmatch_ofb_ipv6_dst>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_DST));
   };
 
   /**
@@ -1232,12 +885,8 @@ public:
    */
   const coxmatch_ofb_ipv6_dst &get_ofb_ipv6_dst() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_DST)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_ipv6_dst() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_ipv6_dst &>(
-        *matches.at(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_DST)));
+    return get_match<coxmatch_ofb_ipv6_dst>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_DST));
   };
 
   /**
@@ -1245,13 +894,8 @@ public:
    */
   bool drop_ofb_ipv6_dst() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_DST)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_DST)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_DST));
-    return true;
+    return drop_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_DST));
   };
 
   /**
@@ -1259,8 +903,7 @@ public:
    */
   bool has_ofb_ipv6_dst() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFB_TYPE(
-                    rofl::openflow::OXM_TLV_BASIC_IPV6_DST)) == matches.end()));
+    return has_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_DST));
   };
 
 public:
@@ -1269,14 +912,8 @@ public:
    */
   coxmatch_ofb_tcp_src &add_ofb_tcp_src(uint16_t tcp_src = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_TCP_SRC)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TCP_SRC)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TCP_SRC)] =
-        new coxmatch_ofb_tcp_src(tcp_src);
-    return dynamic_cast<coxmatch_ofb_tcp_src &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TCP_SRC)]);
+    return add_match<coxmatch_ofb_tcp_src>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TCP_SRC), tcp_src);
   };
 
   /**
@@ -1284,13 +921,8 @@ public:
    */
   coxmatch_ofb_tcp_src &set_ofb_tcp_src() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_TCP_SRC)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TCP_SRC)] =
-          new coxmatch_ofb_tcp_src();
-    }
-    return dynamic_cast<coxmatch_ofb_tcp_src &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TCP_SRC)]);
+    return set_match<coxmatch_ofb_tcp_src>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TCP_SRC));
   };
 
   /**
@@ -1298,12 +930,8 @@ public:
    */
   const coxmatch_ofb_tcp_src &get_ofb_tcp_src() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_TCP_SRC)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_tcp_src() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_tcp_src &>(
-        *matches.at(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TCP_SRC)));
+    return get_match<coxmatch_ofb_tcp_src>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TCP_SRC));
   };
 
   /**
@@ -1311,13 +939,7 @@ public:
    */
   bool drop_ofb_tcp_src() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_TCP_SRC)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TCP_SRC)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TCP_SRC));
-    return true;
+    return drop_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TCP_SRC));
   };
 
   /**
@@ -1325,8 +947,7 @@ public:
    */
   bool has_ofb_tcp_src() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFB_TYPE(
-                    rofl::openflow::OXM_TLV_BASIC_TCP_SRC)) == matches.end()));
+    return has_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TCP_SRC));
   };
 
 public:
@@ -1335,14 +956,8 @@ public:
    */
   coxmatch_ofb_tcp_dst &add_ofb_tcp_dst(uint16_t tcp_dst = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_TCP_DST)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TCP_DST)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TCP_DST)] =
-        new coxmatch_ofb_tcp_dst(tcp_dst);
-    return dynamic_cast<coxmatch_ofb_tcp_dst &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TCP_DST)]);
+    return add_match<coxmatch_ofb_tcp_dst>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TCP_DST), tcp_dst);
   };
 
   /**
@@ -1350,13 +965,8 @@ public:
    */
   coxmatch_ofb_tcp_dst &set_ofb_tcp_dst() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_TCP_DST)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TCP_DST)] =
-          new coxmatch_ofb_tcp_dst();
-    }
-    return dynamic_cast<coxmatch_ofb_tcp_dst &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TCP_DST)]);
+    return set_match<coxmatch_ofb_tcp_dst>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TCP_DST));
   };
 
   /**
@@ -1364,12 +974,8 @@ public:
    */
   const coxmatch_ofb_tcp_dst &get_ofb_tcp_dst() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_TCP_DST)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_tcp_dst() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_tcp_dst &>(
-        *matches.at(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TCP_DST)));
+    return get_match<coxmatch_ofb_tcp_dst>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TCP_DST));
   };
 
   /**
@@ -1377,13 +983,7 @@ public:
    */
   bool drop_ofb_tcp_dst() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_TCP_DST)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TCP_DST)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TCP_DST));
-    return true;
+    return drop_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TCP_DST));
   };
 
   /**
@@ -1391,8 +991,7 @@ public:
    */
   bool has_ofb_tcp_dst() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFB_TYPE(
-                    rofl::openflow::OXM_TLV_BASIC_TCP_DST)) == matches.end()));
+    return has_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TCP_DST));
   };
 
 public:
@@ -1401,14 +1000,8 @@ public:
    */
   coxmatch_ofb_udp_src &add_ofb_udp_src(uint16_t udp_src = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_UDP_SRC)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_UDP_SRC)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_UDP_SRC)] =
-        new coxmatch_ofb_udp_src(udp_src);
-    return dynamic_cast<coxmatch_ofb_udp_src &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_UDP_SRC)]);
+    return add_match<coxmatch_ofb_udp_src>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_UDP_SRC), udp_src);
   };
 
   /**
@@ -1416,13 +1009,8 @@ public:
    */
   coxmatch_ofb_udp_src &set_ofb_udp_src() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_UDP_SRC)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_UDP_SRC)] =
-          new coxmatch_ofb_udp_src();
-    }
-    return dynamic_cast<coxmatch_ofb_udp_src &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_UDP_SRC)]);
+    return set_match<coxmatch_ofb_udp_src>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_UDP_SRC));
   };
 
   /**
@@ -1430,12 +1018,8 @@ public:
    */
   const coxmatch_ofb_udp_src &get_ofb_udp_src() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_UDP_SRC)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_udp_src() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_udp_src &>(
-        *matches.at(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_UDP_SRC)));
+    return get_match<coxmatch_ofb_udp_src>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_UDP_SRC));
   };
 
   /**
@@ -1443,13 +1027,7 @@ public:
    */
   bool drop_ofb_udp_src() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_UDP_SRC)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_UDP_SRC)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_UDP_SRC));
-    return true;
+    return drop_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_UDP_SRC));
   };
 
   /**
@@ -1457,8 +1035,7 @@ public:
    */
   bool has_ofb_udp_src() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFB_TYPE(
-                    rofl::openflow::OXM_TLV_BASIC_UDP_SRC)) == matches.end()));
+    return has_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_UDP_SRC));
   };
 
 public:
@@ -1467,14 +1044,8 @@ public:
    */
   coxmatch_ofb_udp_dst &add_ofb_udp_dst(uint16_t udp_dst = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_UDP_DST)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_UDP_DST)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_UDP_DST)] =
-        new coxmatch_ofb_udp_dst(udp_dst);
-    return dynamic_cast<coxmatch_ofb_udp_dst &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_UDP_DST)]);
+    return add_match<coxmatch_ofb_udp_dst>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_UDP_DST), udp_dst);
   };
 
   /**
@@ -1482,13 +1053,8 @@ public:
    */
   coxmatch_ofb_udp_dst &set_ofb_udp_dst() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_UDP_DST)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_UDP_DST)] =
-          new coxmatch_ofb_udp_dst();
-    }
-    return dynamic_cast<coxmatch_ofb_udp_dst &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_UDP_DST)]);
+    return set_match<coxmatch_ofb_udp_dst>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_UDP_DST));
   };
 
   /**
@@ -1496,12 +1062,8 @@ public:
    */
   const coxmatch_ofb_udp_dst &get_ofb_udp_dst() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_UDP_DST)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_udp_dst() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_udp_dst &>(
-        *matches.at(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_UDP_DST)));
+    return get_match<coxmatch_ofb_udp_dst>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_UDP_DST));
   };
 
   /**
@@ -1509,13 +1071,7 @@ public:
    */
   bool drop_ofb_udp_dst() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_UDP_DST)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_UDP_DST)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_UDP_DST));
-    return true;
+    return drop_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_UDP_DST));
   };
 
   /**
@@ -1523,8 +1079,7 @@ public:
    */
   bool has_ofb_udp_dst() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFB_TYPE(
-                    rofl::openflow::OXM_TLV_BASIC_UDP_DST)) == matches.end()));
+    return has_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_UDP_DST));
   };
 
 public:
@@ -1533,14 +1088,8 @@ public:
    */
   coxmatch_ofb_sctp_src &add_ofb_sctp_src(uint16_t sctp_src = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_SCTP_SRC)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_SCTP_SRC)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_SCTP_SRC)] =
-        new coxmatch_ofb_sctp_src(sctp_src);
-    return dynamic_cast<coxmatch_ofb_sctp_src &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_SCTP_SRC)]);
+    return add_match<coxmatch_ofb_sctp_src>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_SCTP_SRC), sctp_src);
   };
 
   /**
@@ -1548,13 +1097,8 @@ public:
    */
   coxmatch_ofb_sctp_src &set_ofb_sctp_src() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_SCTP_SRC)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_SCTP_SRC)] =
-          new coxmatch_ofb_sctp_src();
-    }
-    return dynamic_cast<coxmatch_ofb_sctp_src &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_SCTP_SRC)]);
+    return set_match<coxmatch_ofb_sctp_src>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_SCTP_SRC));
   };
 
   /**
@@ -1562,12 +1106,8 @@ public:
    */
   const coxmatch_ofb_sctp_src &get_ofb_sctp_src() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_SCTP_SRC)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_sctp_src() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_sctp_src &>(
-        *matches.at(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_SCTP_SRC)));
+    return get_match<coxmatch_ofb_sctp_src>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_SCTP_SRC));
   };
 
   /**
@@ -1575,13 +1115,8 @@ public:
    */
   bool drop_ofb_sctp_src() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_SCTP_SRC)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_SCTP_SRC)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_SCTP_SRC));
-    return true;
+    return drop_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_SCTP_SRC));
   };
 
   /**
@@ -1589,8 +1124,7 @@ public:
    */
   bool has_ofb_sctp_src() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFB_TYPE(
-                    rofl::openflow::OXM_TLV_BASIC_SCTP_SRC)) == matches.end()));
+    return has_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_SCTP_SRC));
   };
 
 public:
@@ -1599,14 +1133,8 @@ public:
    */
   coxmatch_ofb_sctp_dst &add_ofb_sctp_dst(uint16_t sctp_dst = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_SCTP_DST)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_SCTP_DST)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_SCTP_DST)] =
-        new coxmatch_ofb_sctp_dst(sctp_dst);
-    return dynamic_cast<coxmatch_ofb_sctp_dst &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_SCTP_DST)]);
+    return add_match<coxmatch_ofb_sctp_dst>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_SCTP_DST), sctp_dst);
   };
 
   /**
@@ -1614,13 +1142,8 @@ public:
    */
   coxmatch_ofb_sctp_dst &set_ofb_sctp_dst() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_SCTP_DST)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_SCTP_DST)] =
-          new coxmatch_ofb_sctp_dst();
-    }
-    return dynamic_cast<coxmatch_ofb_sctp_dst &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_SCTP_DST)]);
+    return set_match<coxmatch_ofb_sctp_dst>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_SCTP_DST));
   };
 
   /**
@@ -1628,12 +1151,8 @@ public:
    */
   const coxmatch_ofb_sctp_dst &get_ofb_sctp_dst() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_SCTP_DST)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_sctp_dst() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_sctp_dst &>(
-        *matches.at(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_SCTP_DST)));
+    return get_match<coxmatch_ofb_sctp_dst>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_SCTP_DST));
   };
 
   /**
@@ -1641,13 +1160,8 @@ public:
    */
   bool drop_ofb_sctp_dst() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_SCTP_DST)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_SCTP_DST)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_SCTP_DST));
-    return true;
+    return drop_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_SCTP_DST));
   };
 
   /**
@@ -1655,8 +1169,7 @@ public:
    */
   bool has_ofb_sctp_dst() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFB_TYPE(
-                    rofl::openflow::OXM_TLV_BASIC_SCTP_DST)) == matches.end()));
+    return has_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_SCTP_DST));
   };
 
 public:
@@ -1665,15 +1178,9 @@ public:
    */
   coxmatch_ofb_icmpv4_type &add_ofb_icmpv4_type(uint8_t icmpv4_type = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ICMPV4_TYPE)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(
-          rofl::openflow::OXM_TLV_BASIC_ICMPV4_TYPE)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV4_TYPE)] =
-        new coxmatch_ofb_icmpv4_type(icmpv4_type);
-    return dynamic_cast<coxmatch_ofb_icmpv4_type &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV4_TYPE)]);
+    return add_match<coxmatch_ofb_icmpv4_type>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV4_TYPE),
+        icmpv4_type);
   };
 
   /**
@@ -1681,13 +1188,8 @@ public:
    */
   coxmatch_ofb_icmpv4_type &set_ofb_icmpv4_type() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ICMPV4_TYPE)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV4_TYPE)] =
-          new coxmatch_ofb_icmpv4_type();
-    }
-    return dynamic_cast<coxmatch_ofb_icmpv4_type &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV4_TYPE)]);
+    return set_match<coxmatch_ofb_icmpv4_type>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV4_TYPE));
   };
 
   /**
@@ -1695,12 +1197,8 @@ public:
    */
   const coxmatch_ofb_icmpv4_type &get_ofb_icmpv4_type() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ICMPV4_TYPE)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_icmpv4_type() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_icmpv4_type &>(*matches.at(
-        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV4_TYPE)));
+    return get_match<coxmatch_ofb_icmpv4_type>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV4_TYPE));
   };
 
   /**
@@ -1708,14 +1206,8 @@ public:
    */
   bool drop_ofb_icmpv4_type() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ICMPV4_TYPE)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(
-        rofl::openflow::OXM_TLV_BASIC_ICMPV4_TYPE)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV4_TYPE));
-    return true;
+    return drop_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV4_TYPE));
   };
 
   /**
@@ -1723,9 +1215,8 @@ public:
    */
   bool has_ofb_icmpv4_type() const {
     AcquireReadLock lock(rwlock);
-    return (
-        not(matches.find(OXM_ROFL_OFB_TYPE(
-                rofl::openflow::OXM_TLV_BASIC_ICMPV4_TYPE)) == matches.end()));
+    return has_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV4_TYPE));
   };
 
 public:
@@ -1734,15 +1225,9 @@ public:
    */
   coxmatch_ofb_icmpv4_code &add_ofb_icmpv4_code(uint8_t icmpv4_code = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ICMPV4_CODE)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(
-          rofl::openflow::OXM_TLV_BASIC_ICMPV4_CODE)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV4_CODE)] =
-        new coxmatch_ofb_icmpv4_code(icmpv4_code);
-    return dynamic_cast<coxmatch_ofb_icmpv4_code &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV4_CODE)]);
+    return add_match<coxmatch_ofb_icmpv4_code>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV4_CODE),
+        icmpv4_code);
   };
 
   /**
@@ -1750,13 +1235,8 @@ public:
    */
   coxmatch_ofb_icmpv4_code &set_ofb_icmpv4_code() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ICMPV4_CODE)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV4_CODE)] =
-          new coxmatch_ofb_icmpv4_code();
-    }
-    return dynamic_cast<coxmatch_ofb_icmpv4_code &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV4_CODE)]);
+    return set_match<coxmatch_ofb_icmpv4_code>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV4_CODE));
   };
 
   /**
@@ -1764,12 +1244,8 @@ public:
    */
   const coxmatch_ofb_icmpv4_code &get_ofb_icmpv4_code() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ICMPV4_CODE)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_icmpv4_code() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_icmpv4_code &>(*matches.at(
-        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV4_CODE)));
+    return get_match<coxmatch_ofb_icmpv4_code>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV4_CODE));
   };
 
   /**
@@ -1777,14 +1253,8 @@ public:
    */
   bool drop_ofb_icmpv4_code() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ICMPV4_CODE)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(
-        rofl::openflow::OXM_TLV_BASIC_ICMPV4_CODE)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV4_CODE));
-    return true;
+    return drop_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV4_CODE));
   };
 
   /**
@@ -1792,9 +1262,8 @@ public:
    */
   bool has_ofb_icmpv4_code() const {
     AcquireReadLock lock(rwlock);
-    return (
-        not(matches.find(OXM_ROFL_OFB_TYPE(
-                rofl::openflow::OXM_TLV_BASIC_ICMPV4_CODE)) == matches.end()));
+    return has_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV4_CODE));
   };
 
 public:
@@ -1803,14 +1272,8 @@ public:
    */
   coxmatch_ofb_arp_opcode &add_ofb_arp_opcode(uint16_t arp_opcode = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_OP)) !=
-        matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_OP)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_OP)] =
-        new coxmatch_ofb_arp_opcode(arp_opcode);
-    return dynamic_cast<coxmatch_ofb_arp_opcode &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_OP)]);
+    return add_match<coxmatch_ofb_arp_opcode>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_OP), arp_opcode);
   };
 
   /**
@@ -1818,13 +1281,8 @@ public:
    */
   coxmatch_ofb_arp_opcode &set_ofb_arp_opcode() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_OP)) ==
-        matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_OP)] =
-          new coxmatch_ofb_arp_opcode();
-    }
-    return dynamic_cast<coxmatch_ofb_arp_opcode &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_OP)]);
+    return set_match<coxmatch_ofb_arp_opcode>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_OP));
   };
 
   /**
@@ -1832,12 +1290,8 @@ public:
    */
   const coxmatch_ofb_arp_opcode &get_ofb_arp_opcode() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_OP)) ==
-        matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_arp_opcode() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_arp_opcode &>(
-        *matches.at(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_OP)));
+    return get_match<coxmatch_ofb_arp_opcode>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_OP));
   };
 
   /**
@@ -1845,13 +1299,7 @@ public:
    */
   bool drop_ofb_arp_opcode() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_OP)) ==
-        matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_OP)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_OP));
-    return true;
+    return drop_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_OP));
   };
 
   /**
@@ -1859,8 +1307,7 @@ public:
    */
   bool has_ofb_arp_opcode() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFB_TYPE(
-                    rofl::openflow::OXM_TLV_BASIC_ARP_OP)) == matches.end()));
+    return has_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_OP));
   };
 
 public:
@@ -1869,14 +1316,8 @@ public:
    */
   coxmatch_ofb_arp_spa &add_ofb_arp_spa(uint32_t arp_spa = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ARP_SPA)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SPA)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SPA)] =
-        new coxmatch_ofb_arp_spa(arp_spa);
-    return dynamic_cast<coxmatch_ofb_arp_spa &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SPA)]);
+    return add_match<coxmatch_ofb_arp_spa>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SPA), arp_spa);
   };
 
   /**
@@ -1884,14 +1325,9 @@ public:
    */
   coxmatch_ofb_arp_spa &add_ofb_arp_spa(uint32_t arp_spa, uint32_t mask) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ARP_SPA)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SPA)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SPA)] =
-        new coxmatch_ofb_arp_spa(arp_spa, mask);
-    return dynamic_cast<coxmatch_ofb_arp_spa &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SPA)]);
+    return add_match<coxmatch_ofb_arp_spa>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SPA),
+        arp_spa, mask);
   };
 
   /**
@@ -1899,13 +1335,8 @@ public:
    */
   coxmatch_ofb_arp_spa &set_ofb_arp_spa() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ARP_SPA)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SPA)] =
-          new coxmatch_ofb_arp_spa();
-    }
-    return dynamic_cast<coxmatch_ofb_arp_spa &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SPA)]);
+    return set_match<coxmatch_ofb_arp_spa>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SPA));
   };
 
   /**
@@ -1913,12 +1344,8 @@ public:
    */
   const coxmatch_ofb_arp_spa &get_ofb_arp_spa() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ARP_SPA)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_arp_spa() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_arp_spa &>(
-        *matches.at(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SPA)));
+    return get_match<coxmatch_ofb_arp_spa>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SPA));
   };
 
   /**
@@ -1926,13 +1353,7 @@ public:
    */
   bool drop_ofb_arp_spa() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ARP_SPA)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SPA)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SPA));
-    return true;
+    return drop_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SPA));
   };
 
   /**
@@ -1940,8 +1361,7 @@ public:
    */
   bool has_ofb_arp_spa() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFB_TYPE(
-                    rofl::openflow::OXM_TLV_BASIC_ARP_SPA)) == matches.end()));
+    return has_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SPA));
   };
 
 public:
@@ -1950,14 +1370,8 @@ public:
    */
   coxmatch_ofb_arp_tpa &add_ofb_arp_tpa(uint32_t arp_tpa = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ARP_TPA)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_TPA)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_TPA)] =
-        new coxmatch_ofb_arp_tpa(arp_tpa);
-    return dynamic_cast<coxmatch_ofb_arp_tpa &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_TPA)]);
+    return add_match<coxmatch_ofb_arp_tpa>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_TPA), arp_tpa);
   };
 
   /**
@@ -1965,14 +1379,9 @@ public:
    */
   coxmatch_ofb_arp_tpa &add_ofb_arp_tpa(uint32_t arp_tpa, uint32_t mask) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ARP_TPA)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_TPA)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_TPA)] =
-        new coxmatch_ofb_arp_tpa(arp_tpa, mask);
-    return dynamic_cast<coxmatch_ofb_arp_tpa &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_TPA)]);
+    return add_match<coxmatch_ofb_arp_tpa>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_TPA),
+        arp_tpa, mask);
   };
 
   /**
@@ -1980,13 +1389,8 @@ public:
    */
   coxmatch_ofb_arp_tpa &set_ofb_arp_tpa() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ARP_TPA)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_TPA)] =
-          new coxmatch_ofb_arp_tpa();
-    }
-    return dynamic_cast<coxmatch_ofb_arp_tpa &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_TPA)]);
+    return set_match<coxmatch_ofb_arp_tpa>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_TPA));
   };
 
   /**
@@ -1994,12 +1398,8 @@ public:
    */
   const coxmatch_ofb_arp_tpa &get_ofb_arp_tpa() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ARP_TPA)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_arp_tpa() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_arp_tpa &>(
-        *matches.at(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_TPA)));
+    return get_match<coxmatch_ofb_arp_tpa>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_TPA));
   };
 
   /**
@@ -2007,13 +1407,7 @@ public:
    */
   bool drop_ofb_arp_tpa() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ARP_TPA)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_TPA)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_TPA));
-    return true;
+    return drop_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_TPA));
   };
 
   /**
@@ -2021,8 +1415,7 @@ public:
    */
   bool has_ofb_arp_tpa() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFB_TYPE(
-                    rofl::openflow::OXM_TLV_BASIC_ARP_TPA)) == matches.end()));
+    return has_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_TPA));
   };
 
 public:
@@ -2031,14 +1424,8 @@ public:
    */
   coxmatch_ofb_arp_sha &add_ofb_arp_sha(const rofl::caddress_ll &arp_sha = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ARP_SHA)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SHA)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SHA)] =
-        new coxmatch_ofb_arp_sha(arp_sha);
-    return dynamic_cast<coxmatch_ofb_arp_sha &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SHA)]);
+    return add_match<coxmatch_ofb_arp_sha>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SHA), arp_sha);
   };
 
   /**
@@ -2047,14 +1434,9 @@ public:
   coxmatch_ofb_arp_sha &add_ofb_arp_sha(const rofl::caddress_ll &arp_sha,
                                         const rofl::caddress_ll &mask) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ARP_SHA)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SHA)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SHA)] =
-        new coxmatch_ofb_arp_sha(arp_sha, mask);
-    return dynamic_cast<coxmatch_ofb_arp_sha &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SHA)]);
+    return add_match<coxmatch_ofb_arp_sha>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SHA),
+        arp_sha, mask);
   };
 
   /**
@@ -2062,13 +1444,8 @@ public:
    */
   coxmatch_ofb_arp_sha &set_ofb_arp_sha() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ARP_SHA)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SHA)] =
-          new coxmatch_ofb_arp_sha();
-    }
-    return dynamic_cast<coxmatch_ofb_arp_sha &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SHA)]);
+    return set_match<coxmatch_ofb_arp_sha>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SHA));
   };
 
   /**
@@ -2076,12 +1453,8 @@ public:
    */
   const coxmatch_ofb_arp_sha &get_ofb_arp_sha() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ARP_SHA)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_arp_sha() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_arp_sha &>(
-        *matches.at(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SHA)));
+    return get_match<coxmatch_ofb_arp_sha>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SHA));
   };
 
   /**
@@ -2089,13 +1462,7 @@ public:
    */
   bool drop_ofb_arp_sha() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ARP_SHA)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SHA)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SHA));
-    return true;
+    return drop_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SHA));
   };
 
   /**
@@ -2103,8 +1470,7 @@ public:
    */
   bool has_ofb_arp_sha() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFB_TYPE(
-                    rofl::openflow::OXM_TLV_BASIC_ARP_SHA)) == matches.end()));
+    return has_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_SHA));
   };
 
 public:
@@ -2113,14 +1479,8 @@ public:
    */
   coxmatch_ofb_arp_tha &add_ofb_arp_tha(const rofl::caddress_ll &arp_tha = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ARP_THA)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_THA)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_THA)] =
-        new coxmatch_ofb_arp_tha(arp_tha);
-    return dynamic_cast<coxmatch_ofb_arp_tha &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_THA)]);
+    return add_match<coxmatch_ofb_arp_tha>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_THA), arp_tha);
   };
 
   /**
@@ -2129,14 +1489,9 @@ public:
   coxmatch_ofb_arp_tha &add_ofb_arp_tha(const rofl::caddress_ll &arp_tha,
                                         const rofl::caddress_ll &mask) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ARP_THA)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_THA)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_THA)] =
-        new coxmatch_ofb_arp_tha(arp_tha, mask);
-    return dynamic_cast<coxmatch_ofb_arp_tha &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_THA)]);
+    return add_match<coxmatch_ofb_arp_tha>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_THA),
+        arp_tha, mask);
   };
 
   /**
@@ -2144,13 +1499,8 @@ public:
    */
   coxmatch_ofb_arp_tha &set_ofb_arp_tha() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ARP_THA)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_THA)] =
-          new coxmatch_ofb_arp_tha();
-    }
-    return dynamic_cast<coxmatch_ofb_arp_tha &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_THA)]);
+    return set_match<coxmatch_ofb_arp_tha>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_THA));
   };
 
   /**
@@ -2158,12 +1508,8 @@ public:
    */
   const coxmatch_ofb_arp_tha &get_ofb_arp_tha() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ARP_THA)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_arp_tha() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_arp_tha &>(
-        *matches.at(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_THA)));
+    return get_match<coxmatch_ofb_arp_tha>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_THA));
   };
 
   /**
@@ -2171,13 +1517,7 @@ public:
    */
   bool drop_ofb_arp_tha() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ARP_THA)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_THA)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_THA));
-    return true;
+    return drop_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_THA));
   };
 
   /**
@@ -2185,8 +1525,7 @@ public:
    */
   bool has_ofb_arp_tha() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFB_TYPE(
-                    rofl::openflow::OXM_TLV_BASIC_ARP_THA)) == matches.end()));
+    return has_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ARP_THA));
   };
 
 public:
@@ -2195,15 +1534,9 @@ public:
    */
   coxmatch_ofb_ipv6_flabel &add_ofb_ipv6_flabel(uint32_t ipv6_flabel = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_FLABEL)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(
-          rofl::openflow::OXM_TLV_BASIC_IPV6_FLABEL)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_FLABEL)] =
-        new coxmatch_ofb_ipv6_flabel(ipv6_flabel);
-    return dynamic_cast<coxmatch_ofb_ipv6_flabel &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_FLABEL)]);
+    return add_match<coxmatch_ofb_ipv6_flabel>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_FLABEL),
+        ipv6_flabel);
   };
 
   /**
@@ -2212,15 +1545,9 @@ public:
   coxmatch_ofb_ipv6_flabel &add_ofb_ipv6_flabel(uint32_t ipv6_flabel,
                                                 uint32_t mask) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_FLABEL)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(
-          rofl::openflow::OXM_TLV_BASIC_IPV6_FLABEL)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_FLABEL)] =
-        new coxmatch_ofb_ipv6_flabel(ipv6_flabel, mask);
-    return dynamic_cast<coxmatch_ofb_ipv6_flabel &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_FLABEL)]);
+    return add_match<coxmatch_ofb_ipv6_flabel>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_FLABEL),
+        ipv6_flabel, mask);
   };
 
   /**
@@ -2228,13 +1555,8 @@ public:
    */
   coxmatch_ofb_ipv6_flabel &set_ofb_ipv6_flabel() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_FLABEL)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_FLABEL)] =
-          new coxmatch_ofb_ipv6_flabel();
-    }
-    return dynamic_cast<coxmatch_ofb_ipv6_flabel &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_FLABEL)]);
+    return set_match<coxmatch_ofb_ipv6_flabel>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_FLABEL));
   };
 
   /**
@@ -2242,12 +1564,8 @@ public:
    */
   const coxmatch_ofb_ipv6_flabel &get_ofb_ipv6_flabel() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_FLABEL)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_ipv6_flabel() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_ipv6_flabel &>(*matches.at(
-        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_FLABEL)));
+    return get_match<coxmatch_ofb_ipv6_flabel>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_FLABEL));
   };
 
   /**
@@ -2255,14 +1573,8 @@ public:
    */
   bool drop_ofb_ipv6_flabel() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_FLABEL)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(
-        rofl::openflow::OXM_TLV_BASIC_IPV6_FLABEL)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_FLABEL));
-    return true;
+    return drop_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_FLABEL));
   };
 
   /**
@@ -2270,9 +1582,8 @@ public:
    */
   bool has_ofb_ipv6_flabel() const {
     AcquireReadLock lock(rwlock);
-    return (
-        not(matches.find(OXM_ROFL_OFB_TYPE(
-                rofl::openflow::OXM_TLV_BASIC_IPV6_FLABEL)) == matches.end()));
+    return has_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_FLABEL));
   };
 
 public:
@@ -2281,15 +1592,9 @@ public:
    */
   coxmatch_ofb_icmpv6_type &add_ofb_icmpv6_type(uint8_t icmpv6_type = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ICMPV6_TYPE)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(
-          rofl::openflow::OXM_TLV_BASIC_ICMPV6_TYPE)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV6_TYPE)] =
-        new coxmatch_ofb_icmpv6_type(icmpv6_type);
-    return dynamic_cast<coxmatch_ofb_icmpv6_type &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV6_TYPE)]);
+    return add_match<coxmatch_ofb_icmpv6_type>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV6_TYPE),
+        icmpv6_type);
   };
 
   /**
@@ -2297,13 +1602,8 @@ public:
    */
   coxmatch_ofb_icmpv6_type &set_ofb_icmpv6_type() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ICMPV6_TYPE)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV6_TYPE)] =
-          new coxmatch_ofb_icmpv6_type();
-    }
-    return dynamic_cast<coxmatch_ofb_icmpv6_type &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV6_TYPE)]);
+    return set_match<coxmatch_ofb_icmpv6_type>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV6_TYPE));
   };
 
   /**
@@ -2311,12 +1611,8 @@ public:
    */
   const coxmatch_ofb_icmpv6_type &get_ofb_icmpv6_type() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ICMPV6_TYPE)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_icmpv6_type() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_icmpv6_type &>(*matches.at(
-        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV6_TYPE)));
+    return get_match<coxmatch_ofb_icmpv6_type>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV6_TYPE));
   };
 
   /**
@@ -2324,14 +1620,8 @@ public:
    */
   bool drop_ofb_icmpv6_type() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ICMPV6_TYPE)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(
-        rofl::openflow::OXM_TLV_BASIC_ICMPV6_TYPE)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV6_TYPE));
-    return true;
+    return drop_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV6_TYPE));
   };
 
   /**
@@ -2339,9 +1629,8 @@ public:
    */
   bool has_ofb_icmpv6_type() const {
     AcquireReadLock lock(rwlock);
-    return (
-        not(matches.find(OXM_ROFL_OFB_TYPE(
-                rofl::openflow::OXM_TLV_BASIC_ICMPV6_TYPE)) == matches.end()));
+    return has_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV6_TYPE));
   };
 
 public:
@@ -2350,15 +1639,9 @@ public:
    */
   coxmatch_ofb_icmpv6_code &add_ofb_icmpv6_code(uint8_t icmpv6_code = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ICMPV6_CODE)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(
-          rofl::openflow::OXM_TLV_BASIC_ICMPV6_CODE)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV6_CODE)] =
-        new coxmatch_ofb_icmpv6_code(icmpv6_code);
-    return dynamic_cast<coxmatch_ofb_icmpv6_code &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV6_CODE)]);
+    return add_match<coxmatch_ofb_icmpv6_code>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV6_CODE),
+        icmpv6_code);
   };
 
   /**
@@ -2366,13 +1649,8 @@ public:
    */
   coxmatch_ofb_icmpv6_code &set_ofb_icmpv6_code() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ICMPV6_CODE)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV6_CODE)] =
-          new coxmatch_ofb_icmpv6_code();
-    }
-    return dynamic_cast<coxmatch_ofb_icmpv6_code &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV6_CODE)]);
+    return set_match<coxmatch_ofb_icmpv6_code>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV6_CODE));
   };
 
   /**
@@ -2380,12 +1658,8 @@ public:
    */
   const coxmatch_ofb_icmpv6_code &get_ofb_icmpv6_code() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ICMPV6_CODE)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_icmpv6_code() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_icmpv6_code &>(*matches.at(
-        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV6_CODE)));
+    return get_match<coxmatch_ofb_icmpv6_code>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV6_CODE));
   };
 
   /**
@@ -2393,14 +1667,8 @@ public:
    */
   bool drop_ofb_icmpv6_code() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_ICMPV6_CODE)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(
-        rofl::openflow::OXM_TLV_BASIC_ICMPV6_CODE)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV6_CODE));
-    return true;
+    return drop_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV6_CODE));
   };
 
   /**
@@ -2408,9 +1676,8 @@ public:
    */
   bool has_ofb_icmpv6_code() const {
     AcquireReadLock lock(rwlock);
-    return (
-        not(matches.find(OXM_ROFL_OFB_TYPE(
-                rofl::openflow::OXM_TLV_BASIC_ICMPV6_CODE)) == matches.end()));
+    return has_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_ICMPV6_CODE));
   };
 
 public:
@@ -2420,16 +1687,9 @@ public:
   coxmatch_ofb_ipv6_nd_target &add_ofb_ipv6_nd_target(
       const rofl::caddress_in6 &ipv6_nd_target = rofl::caddress_in6()) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TARGET)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(
-          rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TARGET)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TARGET)] =
-        new coxmatch_ofb_ipv6_nd_target(ipv6_nd_target);
-    return dynamic_cast<coxmatch_ofb_ipv6_nd_target &>(
-        *matches[OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TARGET)]);
+    return add_match<coxmatch_ofb_ipv6_nd_target>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TARGET),
+        ipv6_nd_target);
   };
 
   /**
@@ -2437,14 +1697,8 @@ public:
    */
   coxmatch_ofb_ipv6_nd_target &set_ofb_ipv6_nd_target() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TARGET)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TARGET)] =
-          new coxmatch_ofb_ipv6_nd_target();
-    }
-    return dynamic_cast<coxmatch_ofb_ipv6_nd_target &>(
-        *matches[OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TARGET)]);
+    return set_match<coxmatch_ofb_ipv6_nd_target>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TARGET));
   };
 
   /**
@@ -2452,12 +1706,8 @@ public:
    */
   const coxmatch_ofb_ipv6_nd_target &get_ofb_ipv6_nd_target() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TARGET)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_ipv6_nd_target() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_ipv6_nd_target &>(*matches.at(
-        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TARGET)));
+    return get_match<coxmatch_ofb_ipv6_nd_target>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TARGET));
   };
 
   /**
@@ -2465,15 +1715,8 @@ public:
    */
   bool drop_ofb_ipv6_nd_target() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TARGET)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(
-        rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TARGET)];
-    matches.erase(
+    return drop_match(
         OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TARGET));
-    return true;
   };
 
   /**
@@ -2481,9 +1724,8 @@ public:
    */
   bool has_ofb_ipv6_nd_target() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFB_TYPE(
-                    rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TARGET)) ==
-                matches.end()));
+    return has_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TARGET));
   };
 
 public:
@@ -2493,15 +1735,9 @@ public:
   coxmatch_ofb_ipv6_nd_sll &
   add_ofb_ipv6_nd_sll(const rofl::caddress_ll &ipv6_nd_sll = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_ND_SLL)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(
-          rofl::openflow::OXM_TLV_BASIC_IPV6_ND_SLL)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_SLL)] =
-        new coxmatch_ofb_ipv6_nd_sll(ipv6_nd_sll);
-    return dynamic_cast<coxmatch_ofb_ipv6_nd_sll &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_SLL)]);
+    return add_match<coxmatch_ofb_ipv6_nd_sll>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_SLL),
+        ipv6_nd_sll);
   };
 
   /**
@@ -2509,13 +1745,8 @@ public:
    */
   coxmatch_ofb_ipv6_nd_sll &set_ofb_ipv6_nd_sll() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_ND_SLL)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_SLL)] =
-          new coxmatch_ofb_ipv6_nd_sll();
-    }
-    return dynamic_cast<coxmatch_ofb_ipv6_nd_sll &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_SLL)]);
+    return set_match<coxmatch_ofb_ipv6_nd_sll>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_SLL));
   };
 
   /**
@@ -2523,12 +1754,8 @@ public:
    */
   const coxmatch_ofb_ipv6_nd_sll &get_ofb_ipv6_nd_sll() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_ND_SLL)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_ipv6_nd_sll() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_ipv6_nd_sll &>(*matches.at(
-        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_SLL)));
+    return get_match<coxmatch_ofb_ipv6_nd_sll>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_SLL));
   };
 
   /**
@@ -2536,14 +1763,8 @@ public:
    */
   bool drop_ofb_ipv6_nd_sll() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_ND_SLL)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(
-        rofl::openflow::OXM_TLV_BASIC_IPV6_ND_SLL)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_SLL));
-    return true;
+    return drop_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_SLL));
   };
 
   /**
@@ -2551,9 +1772,8 @@ public:
    */
   bool has_ofb_ipv6_nd_sll() const {
     AcquireReadLock lock(rwlock);
-    return (
-        not(matches.find(OXM_ROFL_OFB_TYPE(
-                rofl::openflow::OXM_TLV_BASIC_IPV6_ND_SLL)) == matches.end()));
+    return has_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_SLL));
   };
 
 public:
@@ -2563,15 +1783,9 @@ public:
   coxmatch_ofb_ipv6_nd_tll &
   add_ofb_ipv6_nd_tll(const rofl::caddress_ll &ipv6_nd_tll = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TLL)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(
-          rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TLL)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TLL)] =
-        new coxmatch_ofb_ipv6_nd_tll(ipv6_nd_tll);
-    return dynamic_cast<coxmatch_ofb_ipv6_nd_tll &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TLL)]);
+    return add_match<coxmatch_ofb_ipv6_nd_tll>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TLL),
+        ipv6_nd_tll);
   };
 
   /**
@@ -2579,13 +1793,8 @@ public:
    */
   coxmatch_ofb_ipv6_nd_tll &set_ofb_ipv6_nd_tll() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TLL)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TLL)] =
-          new coxmatch_ofb_ipv6_nd_tll();
-    }
-    return dynamic_cast<coxmatch_ofb_ipv6_nd_tll &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TLL)]);
+    return set_match<coxmatch_ofb_ipv6_nd_tll>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TLL));
   };
 
   /**
@@ -2593,12 +1802,8 @@ public:
    */
   const coxmatch_ofb_ipv6_nd_tll &get_ofb_ipv6_nd_tll() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TLL)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_ipv6_nd_tll() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_ipv6_nd_tll &>(*matches.at(
-        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TLL)));
+    return get_match<coxmatch_ofb_ipv6_nd_tll>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TLL));
   };
 
   /**
@@ -2606,14 +1811,8 @@ public:
    */
   bool drop_ofb_ipv6_nd_tll() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TLL)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(
-        rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TLL)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TLL));
-    return true;
+    return drop_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TLL));
   };
 
   /**
@@ -2621,9 +1820,8 @@ public:
    */
   bool has_ofb_ipv6_nd_tll() const {
     AcquireReadLock lock(rwlock);
-    return (
-        not(matches.find(OXM_ROFL_OFB_TYPE(
-                rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TLL)) == matches.end()));
+    return has_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_ND_TLL));
   };
 
 public:
@@ -2632,15 +1830,9 @@ public:
    */
   coxmatch_ofb_mpls_label &add_ofb_mpls_label(uint32_t mpls_label = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_MPLS_LABEL)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(
-          rofl::openflow::OXM_TLV_BASIC_MPLS_LABEL)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_LABEL)] =
-        new coxmatch_ofb_mpls_label(mpls_label);
-    return dynamic_cast<coxmatch_ofb_mpls_label &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_LABEL)]);
+    return add_match<coxmatch_ofb_mpls_label>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_LABEL),
+        mpls_label);
   };
 
   /**
@@ -2648,13 +1840,8 @@ public:
    */
   coxmatch_ofb_mpls_label &set_ofb_mpls_label() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_MPLS_LABEL)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_LABEL)] =
-          new coxmatch_ofb_mpls_label();
-    }
-    return dynamic_cast<coxmatch_ofb_mpls_label &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_LABEL)]);
+    return set_match<coxmatch_ofb_mpls_label>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_LABEL));
   };
 
   /**
@@ -2662,12 +1849,8 @@ public:
    */
   const coxmatch_ofb_mpls_label &get_ofb_mpls_label() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_MPLS_LABEL)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_mpls_label() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_mpls_label &>(*matches.at(
-        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_LABEL)));
+    return get_match<coxmatch_ofb_mpls_label>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_LABEL));
   };
 
   /**
@@ -2675,13 +1858,8 @@ public:
    */
   bool drop_ofb_mpls_label() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_MPLS_LABEL)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_LABEL)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_LABEL));
-    return true;
+    return drop_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_LABEL));
   };
 
   /**
@@ -2689,9 +1867,8 @@ public:
    */
   bool has_ofb_mpls_label() const {
     AcquireReadLock lock(rwlock);
-    return (
-        not(matches.find(OXM_ROFL_OFB_TYPE(
-                rofl::openflow::OXM_TLV_BASIC_MPLS_LABEL)) == matches.end()));
+    return has_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_LABEL));
   };
 
 public:
@@ -2700,14 +1877,8 @@ public:
    */
   coxmatch_ofb_mpls_tc &add_ofb_mpls_tc(uint8_t mpls_tc = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_MPLS_TC)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_TC)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_TC)] =
-        new coxmatch_ofb_mpls_tc(mpls_tc);
-    return dynamic_cast<coxmatch_ofb_mpls_tc &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_TC)]);
+    return add_match<coxmatch_ofb_mpls_tc>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_TC), mpls_tc);
   };
 
   /**
@@ -2715,13 +1886,8 @@ public:
    */
   coxmatch_ofb_mpls_tc &set_ofb_mpls_tc() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_MPLS_TC)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_TC)] =
-          new coxmatch_ofb_mpls_tc();
-    }
-    return dynamic_cast<coxmatch_ofb_mpls_tc &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_TC)]);
+    return set_match<coxmatch_ofb_mpls_tc>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_TC));
   };
 
   /**
@@ -2729,12 +1895,8 @@ public:
    */
   const coxmatch_ofb_mpls_tc &get_ofb_mpls_tc() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_MPLS_TC)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_mpls_tc() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_mpls_tc &>(
-        *matches.at(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_TC)));
+    return get_match<coxmatch_ofb_mpls_tc>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_TC));
   };
 
   /**
@@ -2742,13 +1904,7 @@ public:
    */
   bool drop_ofb_mpls_tc() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_MPLS_TC)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_TC)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_TC));
-    return true;
+    return drop_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_TC));
   };
 
   /**
@@ -2756,8 +1912,7 @@ public:
    */
   bool has_ofb_mpls_tc() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFB_TYPE(
-                    rofl::openflow::OXM_TLV_BASIC_MPLS_TC)) == matches.end()));
+    return has_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_TC));
   };
 
 public:
@@ -2766,14 +1921,8 @@ public:
    */
   coxmatch_ofb_mpls_bos &add_ofb_mpls_bos(uint8_t mpls_bos = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_MPLS_BOS)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_BOS)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_BOS)] =
-        new coxmatch_ofb_mpls_bos(mpls_bos);
-    return dynamic_cast<coxmatch_ofb_mpls_bos &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_BOS)]);
+    return add_match<coxmatch_ofb_mpls_bos>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_BOS), mpls_bos);
   };
 
   /**
@@ -2781,13 +1930,8 @@ public:
    */
   coxmatch_ofb_mpls_bos &set_ofb_mpls_bos() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_MPLS_BOS)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_BOS)] =
-          new coxmatch_ofb_mpls_bos();
-    }
-    return dynamic_cast<coxmatch_ofb_mpls_bos &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_BOS)]);
+    return set_match<coxmatch_ofb_mpls_bos>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_BOS));
   };
 
   /**
@@ -2795,12 +1939,8 @@ public:
    */
   const coxmatch_ofb_mpls_bos &get_ofb_mpls_bos() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_MPLS_BOS)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_mpls_bos() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_mpls_bos &>(
-        *matches.at(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_BOS)));
+    return get_match<coxmatch_ofb_mpls_bos>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_BOS));
   };
 
   /**
@@ -2808,13 +1948,8 @@ public:
    */
   bool drop_ofb_mpls_bos() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_MPLS_BOS)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_BOS)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_BOS));
-    return true;
+    return drop_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_BOS));
   };
 
   /**
@@ -2822,8 +1957,7 @@ public:
    */
   bool has_ofb_mpls_bos() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFB_TYPE(
-                    rofl::openflow::OXM_TLV_BASIC_MPLS_BOS)) == matches.end()));
+    return has_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_MPLS_BOS));
   };
 
 public:
@@ -2832,15 +1966,8 @@ public:
    */
   coxmatch_ofb_tunnel_id &add_ofb_tunnel_id(uint64_t tunnel_id = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_TUNNEL_ID)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(
-          rofl::openflow::OXM_TLV_BASIC_TUNNEL_ID)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TUNNEL_ID)] =
-        new coxmatch_ofb_tunnel_id(tunnel_id);
-    return dynamic_cast<coxmatch_ofb_tunnel_id &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TUNNEL_ID)]);
+    return add_match<coxmatch_ofb_tunnel_id>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TUNNEL_ID), tunnel_id);
   };
 
   /**
@@ -2848,15 +1975,9 @@ public:
    */
   coxmatch_ofb_tunnel_id &add_ofb_tunnel_id(uint64_t tunnel_id, uint64_t mask) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_TUNNEL_ID)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(
-          rofl::openflow::OXM_TLV_BASIC_TUNNEL_ID)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TUNNEL_ID)] =
-        new coxmatch_ofb_tunnel_id(tunnel_id, mask);
-    return dynamic_cast<coxmatch_ofb_tunnel_id &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TUNNEL_ID)]);
+    return add_match<coxmatch_ofb_tunnel_id>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TUNNEL_ID),
+        tunnel_id, mask);
   };
 
   /**
@@ -2864,13 +1985,8 @@ public:
    */
   coxmatch_ofb_tunnel_id &set_ofb_tunnel_id() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_TUNNEL_ID)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TUNNEL_ID)] =
-          new coxmatch_ofb_tunnel_id();
-    }
-    return dynamic_cast<coxmatch_ofb_tunnel_id &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TUNNEL_ID)]);
+    return set_match<coxmatch_ofb_tunnel_id>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TUNNEL_ID));
   };
 
   /**
@@ -2878,12 +1994,8 @@ public:
    */
   const coxmatch_ofb_tunnel_id &get_ofb_tunnel_id() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_TUNNEL_ID)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_tunnel_id() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_tunnel_id &>(*matches.at(
-        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TUNNEL_ID)));
+    return get_match<coxmatch_ofb_tunnel_id>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TUNNEL_ID));
   };
 
   /**
@@ -2891,13 +2003,8 @@ public:
    */
   bool drop_ofb_tunnel_id() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_TUNNEL_ID)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TUNNEL_ID)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TUNNEL_ID));
-    return true;
+    return drop_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TUNNEL_ID));
   };
 
   /**
@@ -2905,9 +2012,8 @@ public:
    */
   bool has_ofb_tunnel_id() const {
     AcquireReadLock lock(rwlock);
-    return (
-        not(matches.find(OXM_ROFL_OFB_TYPE(
-                rofl::openflow::OXM_TLV_BASIC_TUNNEL_ID)) == matches.end()));
+    return has_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_TUNNEL_ID));
   };
 
 public:
@@ -2916,14 +2022,8 @@ public:
    */
   coxmatch_ofb_pbb_isid &add_ofb_pbb_isid(uint32_t pbb_isid = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_PBB_ISID)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_PBB_ISID)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_PBB_ISID)] =
-        new coxmatch_ofb_pbb_isid(pbb_isid);
-    return dynamic_cast<coxmatch_ofb_pbb_isid &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_PBB_ISID)]);
+    return add_match<coxmatch_ofb_pbb_isid>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_PBB_ISID), pbb_isid);
   };
 
   /**
@@ -2931,14 +2031,9 @@ public:
    */
   coxmatch_ofb_pbb_isid &add_ofb_pbb_isid(uint32_t pbb_isid, uint32_t mask) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_PBB_ISID)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_PBB_ISID)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_PBB_ISID)] =
-        new coxmatch_ofb_pbb_isid(pbb_isid, mask);
-    return dynamic_cast<coxmatch_ofb_pbb_isid &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_PBB_ISID)]);
+    return add_match<coxmatch_ofb_pbb_isid>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_PBB_ISID),
+        pbb_isid, mask);
   };
 
   /**
@@ -2946,13 +2041,8 @@ public:
    */
   coxmatch_ofb_pbb_isid &set_ofb_pbb_isid() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_PBB_ISID)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_PBB_ISID)] =
-          new coxmatch_ofb_pbb_isid();
-    }
-    return dynamic_cast<coxmatch_ofb_pbb_isid &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_PBB_ISID)]);
+    return set_match<coxmatch_ofb_pbb_isid>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_PBB_ISID));
   };
 
   /**
@@ -2960,12 +2050,8 @@ public:
    */
   const coxmatch_ofb_pbb_isid &get_ofb_pbb_isid() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_PBB_ISID)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_pbb_isid() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_pbb_isid &>(
-        *matches.at(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_PBB_ISID)));
+    return get_match<coxmatch_ofb_pbb_isid>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_PBB_ISID));
   };
 
   /**
@@ -2973,13 +2059,8 @@ public:
    */
   bool drop_ofb_pbb_isid() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_PBB_ISID)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_PBB_ISID)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_PBB_ISID));
-    return true;
+    return drop_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_PBB_ISID));
   };
 
   /**
@@ -2987,8 +2068,7 @@ public:
    */
   bool has_ofb_pbb_isid() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFB_TYPE(
-                    rofl::openflow::OXM_TLV_BASIC_PBB_ISID)) == matches.end()));
+    return has_match(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_PBB_ISID));
   };
 
 public:
@@ -2997,15 +2077,9 @@ public:
    */
   coxmatch_ofb_ipv6_exthdr &add_ofb_ipv6_exthdr(uint16_t ipv6_exthdr = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_EXTHDR)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(
-          rofl::openflow::OXM_TLV_BASIC_IPV6_EXTHDR)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_EXTHDR)] =
-        new coxmatch_ofb_ipv6_exthdr(ipv6_exthdr);
-    return dynamic_cast<coxmatch_ofb_ipv6_exthdr &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_EXTHDR)]);
+    return add_match<coxmatch_ofb_ipv6_exthdr>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_EXTHDR),
+        ipv6_exthdr);
   };
 
   /**
@@ -3014,15 +2088,9 @@ public:
   coxmatch_ofb_ipv6_exthdr &add_ofb_ipv6_exthdr(uint16_t ipv6_exthdr,
                                                 uint16_t mask) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_EXTHDR)) != matches.end()) {
-      delete matches[OXM_ROFL_OFB_TYPE(
-          rofl::openflow::OXM_TLV_BASIC_IPV6_EXTHDR)];
-    }
-    matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_EXTHDR)] =
-        new coxmatch_ofb_ipv6_exthdr(ipv6_exthdr, mask);
-    return dynamic_cast<coxmatch_ofb_ipv6_exthdr &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_EXTHDR)]);
+    return add_match<coxmatch_ofb_ipv6_exthdr>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_EXTHDR),
+        ipv6_exthdr, mask);
   };
 
   /**
@@ -3030,13 +2098,8 @@ public:
    */
   coxmatch_ofb_ipv6_exthdr &set_ofb_ipv6_exthdr() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_EXTHDR)) == matches.end()) {
-      matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_EXTHDR)] =
-          new coxmatch_ofb_ipv6_exthdr();
-    }
-    return dynamic_cast<coxmatch_ofb_ipv6_exthdr &>(
-        *matches[OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_EXTHDR)]);
+    return set_match<coxmatch_ofb_ipv6_exthdr>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_EXTHDR));
   };
 
   /**
@@ -3044,12 +2107,8 @@ public:
    */
   const coxmatch_ofb_ipv6_exthdr &get_ofb_ipv6_exthdr() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_EXTHDR)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_ofb_ipv6_exthdr() not found");
-    }
-    return dynamic_cast<const coxmatch_ofb_ipv6_exthdr &>(*matches.at(
-        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_EXTHDR)));
+    return get_match<coxmatch_ofb_ipv6_exthdr>(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_EXTHDR));
   };
 
   /**
@@ -3057,14 +2116,8 @@ public:
    */
   bool drop_ofb_ipv6_exthdr() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFB_TYPE(
-            rofl::openflow::OXM_TLV_BASIC_IPV6_EXTHDR)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFB_TYPE(
-        rofl::openflow::OXM_TLV_BASIC_IPV6_EXTHDR)];
-    matches.erase(OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_EXTHDR));
-    return true;
+    return drop_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_EXTHDR));
   };
 
   /**
@@ -3072,9 +2125,8 @@ public:
    */
   bool has_ofb_ipv6_exthdr() const {
     AcquireReadLock lock(rwlock);
-    return (
-        not(matches.find(OXM_ROFL_OFB_TYPE(
-                rofl::openflow::OXM_TLV_BASIC_IPV6_EXTHDR)) == matches.end()));
+    return has_match(
+        OXM_ROFL_OFB_TYPE(rofl::openflow::OXM_TLV_BASIC_IPV6_EXTHDR));
   };
 
 public:
@@ -3083,17 +2135,9 @@ public:
    */
   coxmatch_ofx_nw_proto &add_ofx_nw_proto(uint8_t nw_proto = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFX_TYPE(
-            rofl::openflow::experimental::OXM_TLV_EXPR_NW_PROTO)) !=
-        matches.end()) {
-      delete matches[OXM_ROFL_OFX_TYPE(
-          rofl::openflow::experimental::OXM_TLV_EXPR_NW_PROTO)];
-    }
-    matches[OXM_ROFL_OFX_TYPE(
-        rofl::openflow::experimental::OXM_TLV_EXPR_NW_PROTO)] =
-        new coxmatch_ofx_nw_proto(nw_proto);
-    return dynamic_cast<coxmatch_ofx_nw_proto &>(*matches[OXM_ROFL_OFX_TYPE(
-        rofl::openflow::experimental::OXM_TLV_EXPR_NW_PROTO)]);
+    return add_match<coxmatch_ofx_nw_proto>(
+        OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_NW_PROTO),
+        nw_proto);
   };
 
   /**
@@ -3101,15 +2145,8 @@ public:
    */
   coxmatch_ofx_nw_proto &set_ofx_nw_proto() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFX_TYPE(
-            rofl::openflow::experimental::OXM_TLV_EXPR_NW_PROTO)) ==
-        matches.end()) {
-      matches[OXM_ROFL_OFX_TYPE(
-          rofl::openflow::experimental::OXM_TLV_EXPR_NW_PROTO)] =
-          new coxmatch_ofx_nw_proto();
-    }
-    return dynamic_cast<coxmatch_ofx_nw_proto &>(*matches[OXM_ROFL_OFX_TYPE(
-        rofl::openflow::experimental::OXM_TLV_EXPR_NW_PROTO)]);
+    return set_match<coxmatch_ofx_nw_proto>(
+        OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_NW_PROTO));
   };
 
   /**
@@ -3117,14 +2154,8 @@ public:
    */
   const coxmatch_ofx_nw_proto &get_ofx_nw_proto() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFX_TYPE(
-            rofl::openflow::experimental::OXM_TLV_EXPR_NW_PROTO)) ==
-        matches.end()) {
-      throw eOxmInval("coxmatches::get_ofx_nw_proto() not found");
-    }
-    return dynamic_cast<const coxmatch_ofx_nw_proto &>(
-        *matches.at(OXM_ROFL_OFX_TYPE(
-            rofl::openflow::experimental::OXM_TLV_EXPR_NW_PROTO)));
+    return get_match<coxmatch_ofx_nw_proto>(
+        OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_NW_PROTO));
   };
 
   /**
@@ -3132,16 +2163,8 @@ public:
    */
   bool drop_ofx_nw_proto() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFX_TYPE(
-            rofl::openflow::experimental::OXM_TLV_EXPR_NW_PROTO)) ==
-        matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFX_TYPE(
-        rofl::openflow::experimental::OXM_TLV_EXPR_NW_PROTO)];
-    matches.erase(
+    return drop_match(
         OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_NW_PROTO));
-    return true;
   };
 
   /**
@@ -3149,9 +2172,8 @@ public:
    */
   bool has_ofx_nw_proto() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFX_TYPE(
-                    rofl::openflow::experimental::OXM_TLV_EXPR_NW_PROTO)) ==
-                matches.end()));
+    return has_match(
+        OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_NW_PROTO));
   };
 
 public:
@@ -3162,17 +2184,9 @@ public:
   add_ofx_nw_src(const rofl::caddress_in4 &nw_src = rofl::caddress_in4(),
                  const rofl::caddress_in4 &mask = rofl::caddress_in4()) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFX_TYPE(
-            rofl::openflow::experimental::OXM_TLV_EXPR_NW_SRC)) !=
-        matches.end()) {
-      delete matches[OXM_ROFL_OFX_TYPE(
-          rofl::openflow::experimental::OXM_TLV_EXPR_NW_SRC)];
-    }
-    matches[OXM_ROFL_OFX_TYPE(
-        rofl::openflow::experimental::OXM_TLV_EXPR_NW_SRC)] =
-        new coxmatch_ofx_nw_src(nw_src, mask);
-    return dynamic_cast<coxmatch_ofx_nw_src &>(*matches[OXM_ROFL_OFX_TYPE(
-        rofl::openflow::experimental::OXM_TLV_EXPR_NW_SRC)]);
+    return add_match<coxmatch_ofx_nw_src>(
+        OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_NW_SRC),
+        nw_src, mask);
   };
 
   /**
@@ -3180,15 +2194,8 @@ public:
    */
   coxmatch_ofx_nw_src &set_ofx_nw_src() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFX_TYPE(
-            rofl::openflow::experimental::OXM_TLV_EXPR_NW_SRC)) ==
-        matches.end()) {
-      matches[OXM_ROFL_OFX_TYPE(
-          rofl::openflow::experimental::OXM_TLV_EXPR_NW_SRC)] =
-          new coxmatch_ofx_nw_src();
-    }
-    return dynamic_cast<coxmatch_ofx_nw_src &>(*matches[OXM_ROFL_OFX_TYPE(
-        rofl::openflow::experimental::OXM_TLV_EXPR_NW_SRC)]);
+    return set_match<coxmatch_ofx_nw_src>(
+        OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_NW_SRC));
   };
 
   /**
@@ -3196,13 +2203,8 @@ public:
    */
   const coxmatch_ofx_nw_src &get_ofx_nw_src() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFX_TYPE(
-            rofl::openflow::experimental::OXM_TLV_EXPR_NW_SRC)) ==
-        matches.end()) {
-      throw eOxmInval("coxmatches::get_ofx_nw_src() not found");
-    }
-    return dynamic_cast<const coxmatch_ofx_nw_src &>(*matches.at(
-        OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_NW_SRC)));
+    return get_match<coxmatch_ofx_nw_src>(
+        OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_NW_SRC));
   };
 
   /**
@@ -3210,16 +2212,8 @@ public:
    */
   bool drop_ofx_nw_src() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFX_TYPE(
-            rofl::openflow::experimental::OXM_TLV_EXPR_NW_SRC)) ==
-        matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFX_TYPE(
-        rofl::openflow::experimental::OXM_TLV_EXPR_NW_SRC)];
-    matches.erase(
+    return drop_match(
         OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_NW_SRC));
-    return true;
   };
 
   /**
@@ -3227,9 +2221,8 @@ public:
    */
   bool has_ofx_nw_src() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFX_TYPE(
-                    rofl::openflow::experimental::OXM_TLV_EXPR_NW_SRC)) ==
-                matches.end()));
+    return has_match(
+        OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_NW_SRC));
   };
 
 public:
@@ -3240,17 +2233,9 @@ public:
   add_ofx_nw_dst(const rofl::caddress_in4 &nw_dst = rofl::caddress_in4(),
                  const rofl::caddress_in4 &mask = rofl::caddress_in4()) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFX_TYPE(
-            rofl::openflow::experimental::OXM_TLV_EXPR_NW_DST)) !=
-        matches.end()) {
-      delete matches[OXM_ROFL_OFX_TYPE(
-          rofl::openflow::experimental::OXM_TLV_EXPR_NW_DST)];
-    }
-    matches[OXM_ROFL_OFX_TYPE(
-        rofl::openflow::experimental::OXM_TLV_EXPR_NW_DST)] =
-        new coxmatch_ofx_nw_dst(nw_dst, mask);
-    return dynamic_cast<coxmatch_ofx_nw_dst &>(*matches[OXM_ROFL_OFX_TYPE(
-        rofl::openflow::experimental::OXM_TLV_EXPR_NW_DST)]);
+    return add_match<coxmatch_ofx_nw_dst>(
+        OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_NW_DST),
+        nw_dst, mask);
   };
 
   /**
@@ -3258,15 +2243,8 @@ public:
    */
   coxmatch_ofx_nw_dst &set_ofx_nw_dst() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFX_TYPE(
-            rofl::openflow::experimental::OXM_TLV_EXPR_NW_DST)) ==
-        matches.end()) {
-      matches[OXM_ROFL_OFX_TYPE(
-          rofl::openflow::experimental::OXM_TLV_EXPR_NW_DST)] =
-          new coxmatch_ofx_nw_dst();
-    }
-    return dynamic_cast<coxmatch_ofx_nw_dst &>(*matches[OXM_ROFL_OFX_TYPE(
-        rofl::openflow::experimental::OXM_TLV_EXPR_NW_DST)]);
+    return set_match<coxmatch_ofx_nw_dst>(
+        OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_NW_DST));
   };
 
   /**
@@ -3274,13 +2252,8 @@ public:
    */
   const coxmatch_ofx_nw_dst &get_ofx_nw_dst() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFX_TYPE(
-            rofl::openflow::experimental::OXM_TLV_EXPR_NW_DST)) ==
-        matches.end()) {
-      throw eOxmInval("coxmatches::get_ofx_nw_dst() not found");
-    }
-    return dynamic_cast<const coxmatch_ofx_nw_dst &>(*matches.at(
-        OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_NW_DST)));
+    return get_match<coxmatch_ofx_nw_dst>(
+        OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_NW_DST));
   };
 
   /**
@@ -3288,16 +2261,8 @@ public:
    */
   bool drop_ofx_nw_dst() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFX_TYPE(
-            rofl::openflow::experimental::OXM_TLV_EXPR_NW_DST)) ==
-        matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFX_TYPE(
-        rofl::openflow::experimental::OXM_TLV_EXPR_NW_DST)];
-    matches.erase(
+    return drop_match(
         OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_NW_DST));
-    return true;
   };
 
   /**
@@ -3305,9 +2270,8 @@ public:
    */
   bool has_ofx_nw_dst() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFX_TYPE(
-                    rofl::openflow::experimental::OXM_TLV_EXPR_NW_DST)) ==
-                matches.end()));
+    return has_match(
+        OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_NW_DST));
   };
 
 public:
@@ -3316,17 +2280,9 @@ public:
    */
   coxmatch_ofx_nw_tos &add_ofx_nw_tos(uint8_t nw_tos = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFX_TYPE(
-            rofl::openflow::experimental::OXM_TLV_EXPR_NW_TOS)) !=
-        matches.end()) {
-      delete matches[OXM_ROFL_OFX_TYPE(
-          rofl::openflow::experimental::OXM_TLV_EXPR_NW_TOS)];
-    }
-    matches[OXM_ROFL_OFX_TYPE(
-        rofl::openflow::experimental::OXM_TLV_EXPR_NW_TOS)] =
-        new coxmatch_ofx_nw_tos(nw_tos);
-    return dynamic_cast<coxmatch_ofx_nw_tos &>(*matches[OXM_ROFL_OFX_TYPE(
-        rofl::openflow::experimental::OXM_TLV_EXPR_NW_TOS)]);
+    return add_match<coxmatch_ofx_nw_tos>(
+        OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_NW_TOS),
+        nw_tos);
   };
 
   /**
@@ -3334,15 +2290,8 @@ public:
    */
   coxmatch_ofx_nw_tos &set_ofx_nw_tos() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFX_TYPE(
-            rofl::openflow::experimental::OXM_TLV_EXPR_NW_TOS)) ==
-        matches.end()) {
-      matches[OXM_ROFL_OFX_TYPE(
-          rofl::openflow::experimental::OXM_TLV_EXPR_NW_TOS)] =
-          new coxmatch_ofx_nw_tos();
-    }
-    return dynamic_cast<coxmatch_ofx_nw_tos &>(*matches[OXM_ROFL_OFX_TYPE(
-        rofl::openflow::experimental::OXM_TLV_EXPR_NW_TOS)]);
+    return set_match<coxmatch_ofx_nw_tos>(
+        OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_NW_TOS));
   };
 
   /**
@@ -3350,13 +2299,8 @@ public:
    */
   const coxmatch_ofx_nw_tos &get_ofx_nw_tos() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFX_TYPE(
-            rofl::openflow::experimental::OXM_TLV_EXPR_NW_TOS)) ==
-        matches.end()) {
-      throw eOxmInval("coxmatches::get_ofx_nw_tos() not found");
-    }
-    return dynamic_cast<const coxmatch_ofx_nw_tos &>(*matches.at(
-        OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_NW_TOS)));
+    return get_match<coxmatch_ofx_nw_tos>(
+        OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_NW_TOS));
   };
 
   /**
@@ -3364,16 +2308,8 @@ public:
    */
   bool drop_ofx_nw_tos() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFX_TYPE(
-            rofl::openflow::experimental::OXM_TLV_EXPR_NW_TOS)) ==
-        matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFX_TYPE(
-        rofl::openflow::experimental::OXM_TLV_EXPR_NW_TOS)];
-    matches.erase(
+    return drop_match(
         OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_NW_TOS));
-    return true;
   };
 
   /**
@@ -3381,9 +2317,8 @@ public:
    */
   bool has_ofx_nw_tos() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFX_TYPE(
-                    rofl::openflow::experimental::OXM_TLV_EXPR_NW_TOS)) ==
-                matches.end()));
+    return has_match(
+        OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_NW_TOS));
   };
 
 public:
@@ -3392,17 +2327,9 @@ public:
    */
   coxmatch_ofx_tp_src &add_ofx_tp_src(uint16_t tp_src = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFX_TYPE(
-            rofl::openflow::experimental::OXM_TLV_EXPR_TP_SRC)) !=
-        matches.end()) {
-      delete matches[OXM_ROFL_OFX_TYPE(
-          rofl::openflow::experimental::OXM_TLV_EXPR_TP_SRC)];
-    }
-    matches[OXM_ROFL_OFX_TYPE(
-        rofl::openflow::experimental::OXM_TLV_EXPR_TP_SRC)] =
-        new coxmatch_ofx_tp_src(tp_src);
-    return dynamic_cast<coxmatch_ofx_tp_src &>(*matches[OXM_ROFL_OFX_TYPE(
-        rofl::openflow::experimental::OXM_TLV_EXPR_TP_SRC)]);
+    return add_match<coxmatch_ofx_tp_src>(
+        OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_TP_SRC),
+        tp_src);
   };
 
   /**
@@ -3410,15 +2337,8 @@ public:
    */
   coxmatch_ofx_tp_src &set_ofx_tp_src() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFX_TYPE(
-            rofl::openflow::experimental::OXM_TLV_EXPR_TP_SRC)) ==
-        matches.end()) {
-      matches[OXM_ROFL_OFX_TYPE(
-          rofl::openflow::experimental::OXM_TLV_EXPR_TP_SRC)] =
-          new coxmatch_ofx_tp_src();
-    }
-    return dynamic_cast<coxmatch_ofx_tp_src &>(*matches[OXM_ROFL_OFX_TYPE(
-        rofl::openflow::experimental::OXM_TLV_EXPR_TP_SRC)]);
+    return set_match<coxmatch_ofx_tp_src>(
+        OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_TP_SRC));
   };
 
   /**
@@ -3426,13 +2346,8 @@ public:
    */
   const coxmatch_ofx_tp_src &get_ofx_tp_src() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFX_TYPE(
-            rofl::openflow::experimental::OXM_TLV_EXPR_TP_SRC)) ==
-        matches.end()) {
-      throw eOxmInval("coxmatches::get_ofx_tp_src() not found");
-    }
-    return dynamic_cast<const coxmatch_ofx_tp_src &>(*matches.at(
-        OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_TP_SRC)));
+    return get_match<coxmatch_ofx_tp_src>(
+        OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_TP_SRC));
   };
 
   /**
@@ -3440,16 +2355,8 @@ public:
    */
   bool drop_ofx_tp_src() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFX_TYPE(
-            rofl::openflow::experimental::OXM_TLV_EXPR_TP_SRC)) ==
-        matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFX_TYPE(
-        rofl::openflow::experimental::OXM_TLV_EXPR_TP_SRC)];
-    matches.erase(
+    return drop_match(
         OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_TP_SRC));
-    return true;
   };
 
   /**
@@ -3457,9 +2364,8 @@ public:
    */
   bool has_ofx_tp_src() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFX_TYPE(
-                    rofl::openflow::experimental::OXM_TLV_EXPR_TP_SRC)) ==
-                matches.end()));
+    return has_match(
+        OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_TP_SRC));
   };
 
 public:
@@ -3468,17 +2374,9 @@ public:
    */
   coxmatch_ofx_tp_dst &add_ofx_tp_dst(uint16_t tp_dst = 0) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFX_TYPE(
-            rofl::openflow::experimental::OXM_TLV_EXPR_TP_DST)) !=
-        matches.end()) {
-      delete matches[OXM_ROFL_OFX_TYPE(
-          rofl::openflow::experimental::OXM_TLV_EXPR_TP_DST)];
-    }
-    matches[OXM_ROFL_OFX_TYPE(
-        rofl::openflow::experimental::OXM_TLV_EXPR_TP_DST)] =
-        new coxmatch_ofx_tp_dst(tp_dst);
-    return dynamic_cast<coxmatch_ofx_tp_dst &>(*matches[OXM_ROFL_OFX_TYPE(
-        rofl::openflow::experimental::OXM_TLV_EXPR_TP_DST)]);
+    return add_match<coxmatch_ofx_tp_dst>(
+        OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_TP_DST),
+        tp_dst);
   };
 
   /**
@@ -3486,15 +2384,8 @@ public:
    */
   coxmatch_ofx_tp_dst &set_ofx_tp_dst() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFX_TYPE(
-            rofl::openflow::experimental::OXM_TLV_EXPR_TP_DST)) ==
-        matches.end()) {
-      matches[OXM_ROFL_OFX_TYPE(
-          rofl::openflow::experimental::OXM_TLV_EXPR_TP_DST)] =
-          new coxmatch_ofx_tp_dst();
-    }
-    return dynamic_cast<coxmatch_ofx_tp_dst &>(*matches[OXM_ROFL_OFX_TYPE(
-        rofl::openflow::experimental::OXM_TLV_EXPR_TP_DST)]);
+    return set_match<coxmatch_ofx_tp_dst>(
+        OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_TP_DST));
   };
 
   /**
@@ -3502,13 +2393,8 @@ public:
    */
   const coxmatch_ofx_tp_dst &get_ofx_tp_dst() const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFX_TYPE(
-            rofl::openflow::experimental::OXM_TLV_EXPR_TP_DST)) ==
-        matches.end()) {
-      throw eOxmInval("coxmatches::get_ofx_tp_dst() not found");
-    }
-    return dynamic_cast<const coxmatch_ofx_tp_dst &>(*matches.at(
-        OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_TP_DST)));
+    return get_match<coxmatch_ofx_tp_dst>(
+        OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_TP_DST));
   };
 
   /**
@@ -3516,16 +2402,8 @@ public:
    */
   bool drop_ofx_tp_dst() {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_ROFL_OFX_TYPE(
-            rofl::openflow::experimental::OXM_TLV_EXPR_TP_DST)) ==
-        matches.end()) {
-      return false;
-    }
-    delete matches[OXM_ROFL_OFX_TYPE(
-        rofl::openflow::experimental::OXM_TLV_EXPR_TP_DST)];
-    matches.erase(
+    return drop_match(
         OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_TP_DST));
-    return true;
   };
 
   /**
@@ -3533,9 +2411,8 @@ public:
    */
   bool has_ofx_tp_dst() const {
     AcquireReadLock lock(rwlock);
-    return (not(matches.find(OXM_ROFL_OFX_TYPE(
-                    rofl::openflow::experimental::OXM_TLV_EXPR_TP_DST)) ==
-                matches.end()));
+    return has_match(
+        OXM_ROFL_OFX_TYPE(rofl::openflow::experimental::OXM_TLV_EXPR_TP_DST));
   };
 
 public:
@@ -3544,13 +2421,8 @@ public:
    */
   coxmatch_exp &add_exp_match(uint32_t exp_id, uint32_t oxm_id) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_EXPR_OFX_TYPE(exp_id, oxm_id)) != matches.end()) {
-      delete matches[OXM_EXPR_OFX_TYPE(exp_id, oxm_id)];
-    }
-    matches[OXM_EXPR_OFX_TYPE(exp_id, oxm_id)] =
-        new coxmatch_exp(oxm_id, exp_id); // yes, this order!
-    return dynamic_cast<coxmatch_exp &>(
-        *matches[OXM_EXPR_OFX_TYPE(exp_id, oxm_id)]);
+    return add_match<coxmatch_exp>(OXM_EXPR_OFX_TYPE(exp_id, oxm_id), oxm_id,
+                                   exp_id); // yes, this order!
   };
 
   /**
@@ -3558,12 +2430,8 @@ public:
    */
   coxmatch_exp &set_exp_match(uint32_t exp_id, uint32_t oxm_id) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_EXPR_OFX_TYPE(exp_id, oxm_id)) == matches.end()) {
-      matches[OXM_EXPR_OFX_TYPE(exp_id, oxm_id)] =
-          new coxmatch_exp(oxm_id, exp_id); // yes, this order!
-    }
-    return dynamic_cast<coxmatch_exp &>(
-        *matches[OXM_EXPR_OFX_TYPE(exp_id, oxm_id)]);
+    return set_match<coxmatch_exp>(OXM_EXPR_OFX_TYPE(exp_id, oxm_id), oxm_id,
+                                   exp_id); // yes, this order!
   };
 
   /**
@@ -3571,11 +2439,7 @@ public:
    */
   const coxmatch_exp &get_exp_match(uint32_t exp_id, uint32_t oxm_id) const {
     AcquireReadLock lock(rwlock);
-    if (matches.find(OXM_EXPR_OFX_TYPE(exp_id, oxm_id)) == matches.end()) {
-      throw eOxmInval("coxmatches::get_exp_match() not found");
-    }
-    return dynamic_cast<const coxmatch_exp &>(
-        *matches.at(OXM_EXPR_OFX_TYPE(exp_id, oxm_id)));
+    return get_match<coxmatch_exp>(OXM_EXPR_OFX_TYPE(exp_id, oxm_id));
   };
 
   /**
@@ -3583,12 +2447,7 @@ public:
    */
   bool drop_exp_match(uint32_t exp_id, uint32_t oxm_id) {
     AcquireReadWriteLock lock(rwlock);
-    if (matches.find(OXM_EXPR_OFX_TYPE(exp_id, oxm_id)) == matches.end()) {
-      return false;
-    }
-    delete matches[OXM_EXPR_OFX_TYPE(exp_id, oxm_id)];
-    matches.erase(OXM_EXPR_OFX_TYPE(exp_id, oxm_id));
-    return true;
+    return drop_match(OXM_EXPR_OFX_TYPE(exp_id, oxm_id));
   };
 
   /**
@@ -3596,17 +2455,15 @@ public:
    */
   bool has_exp_match(uint32_t exp_id, uint32_t oxm_id) const {
     AcquireReadLock lock(rwlock);
-    return (
-        not(matches.find(OXM_EXPR_OFX_TYPE(exp_id, oxm_id)) == matches.end()));
+    return has_match(OXM_EXPR_OFX_TYPE(exp_id, oxm_id));
   };
 
 public:
   friend std::ostream &operator<<(std::ostream &os,
                                   coxmatches const &oxmatches) {
-    os << "<coxmatches #matches:" << oxmatches.matches.size() << " >"
-       << std::endl;
-
     std::vector<uint64_t> ids = oxmatches.get_ids();
+
+    os << "<coxmatches #matches:" << ids.size() << " >" << std::endl;
     for (std::vector<uint64_t>::const_iterator it = ids.begin();
          it != ids.end(); ++it) {
       os << "<id: 0x" << std::hex << (unsigned long long)*it << std::dec << " >"
@@ -3768,9 +2625,254 @@ public:
   };
 
 private:
+  /**
+   * @brief	Returns OXM for type or NULL, caller must hold rwlock
+   */
+  coxmatch *find_match(uint64_t oxm_type) const;
+
+  /**
+   * @brief	Replaces OXM for type by a new instance of T
+   */
+  template <class T, class... Args>
+  T &add_match(uint64_t oxm_type, Args &&... args) {
+    materialize();
+    wirelen = 0;
+    erase_match(oxm_type);
+    reserve_match();
+    T *oxm = construct<T>(std::forward<Args>(args)...);
+    insert_match(oxm_type, oxm);
+    return *oxm;
+  };
+
+  /**
+   * @brief	Returns OXM for type, a new instance of T is added if missing
+   */
+  template <class T, class... Args>
+  T &set_match(uint64_t oxm_type, Args &&... args) {
+    materialize();
+    wirelen = 0;
+    coxmatch *oxm = find_match(oxm_type);
+    if (NULL == oxm) {
+      reserve_match();
+      oxm = construct<T>(std::forward<Args>(args)...);
+      insert_match(oxm_type, oxm);
+    }
+    return dynamic_cast<T &>(*oxm);
+  };
+
+  /**
+   * @throws eOxmInval no OXM for type
+   */
+  template <class T> const T &get_match(uint64_t oxm_type) const {
+    if (undecoded())
+      return dynamic_cast<const T &>(get_undecoded(oxm_type));
+    const coxmatch *oxm = find_match(oxm_type);
+    if (NULL == oxm) {
+      throw eOxmInval("coxmatches::get_match() not found");
+    }
+    return dynamic_cast<const T &>(*oxm);
+  };
+
+  /**
+   *
+   */
+  bool drop_match(uint64_t oxm_type) {
+    materialize();
+    wirelen = 0;
+    return erase_match(oxm_type);
+  };
+
+  /**
+   *
+   */
+  bool has_match(uint64_t oxm_type) const {
+    if (undecoded())
+      return has_undecoded(oxm_type);
+    return (NULL != find_match(oxm_type));
+  };
+
+  /**
+   * @brief	Removes and destroys OXM for type
+   */
+  bool erase_match(uint64_t oxm_type) const;
+
+  /**
+   * @brief	Inserts OXM in sorted entries, reserve_match() must be called
+   * before and no OXM for type may exist
+   */
+  void insert_match(uint64_t oxm_type, coxmatch *oxm) const;
+
+  /**
+   * @brief	Ensures space for one more entry
+   */
+  void reserve_match() const;
+
+  /**
+   * @brief	Returns storage for an OXM object, an inline block if possible
+   */
+  void *alloc_match(size_t size) const;
+
+  /**
+   *
+   */
+  void free_match(void *mem) const;
+
+  /**
+   *
+   */
+  void destroy_match(coxmatch *oxm) const;
+
+  /**
+   *
+   */
+  template <class T, class... Args> T *construct(Args &&... args) const {
+    void *mem = alloc_match(sizeof(T));
+    try {
+      return new (mem) T(std::forward<Args>(args)...);
+    } catch (...) {
+      free_match(mem);
+      throw;
+    }
+  };
+
+  /**
+   *
+   */
+  template <class T> T *construct_from(const coxmatch *orig) const {
+    if (NULL == orig)
+      return construct<T>();
+    return construct<T>(dynamic_cast<const T &>(*orig));
+  };
+
+  /**
+   * @brief	Returns new OXM object for type, a copy of orig if given,
+   * or NULL for unsupported types
+   */
+  coxmatch *new_match(uint64_t oxm_type, const coxmatch *orig = NULL) const;
+
+private:
+  /**
+   * @brief	Returns true while raw TLVs have not been decoded entirely
+   */
+  bool undecoded() const { return pending; };
+
+  /**
+   * @brief	Returns TLV of given type from raw TLVs, decoded on demand
+   *
+   * @throws eOxmInval no TLV of this type
+   */
+  const coxmatch &get_undecoded(uint64_t oxm_type) const;
+
+  /**
+   *
+   */
+  bool has_undecoded(uint64_t oxm_type) const;
+
+  /**
+   *
+   */
+  std::vector<uint64_t> undecoded_ids() const;
+
+  /**
+   * @brief	Decodes all raw TLVs into entries, raw TLVs remain valid
+   */
+  void decode() const;
+
+  /**
+   * @brief	Decodes all raw TLVs and drops them, called before modification
+   */
+  void materialize();
+
+  /**
+   *
+   */
+  void drop_raw();
+
+  /**
+   * @brief	Builds offset index of raw TLVs, caller must hold rawlock
+   */
+  void build_index() const;
+
+private:
+  // entries stored inline, a typical 5-tuple match fits
+  static const size_t OXM_INLINE_ENTRIES = 8;
+
+  // inline storage blocks for OXM objects
+  static const size_t OXM_INLINE_BLOCKS = 8;
+
+  // block size, fits all basic OFB OXMs except IPv6 addresses
+  static const size_t OXM_BLOCK_SIZE = 32;
+
+  struct oxm_entry {
+    uint64_t oxm_type;
+    coxmatch *oxm;
+
+    bool operator<(const oxm_entry &entry) const {
+      return (oxm_type < entry.oxm_type);
+    };
+  };
+
+  struct oxm_block {
+    uint64_t data[OXM_BLOCK_SIZE / sizeof(uint64_t)];
+  };
+
+  struct oxm_slot {
+    uint64_t oxm_type;
+    uint16_t offset;
+    uint16_t length;
+
+    bool operator<(const oxm_slot &slot) const {
+      return (oxm_type < slot.oxm_type);
+    };
+  };
+
   mutable rofl::crwlock rwlock;
 
-  std::map<uint64_t, coxmatch *> matches;
+  // OXMs sorted by oxm_type, points to inline_entries or a heap array
+  mutable oxm_entry *entries;
+
+  // number of OXMs
+  mutable size_t num_entries;
+
+  // capacity of entries
+  mutable size_t max_entries;
+
+  mutable oxm_entry inline_entries[OXM_INLINE_ENTRIES];
+
+  mutable oxm_block blocks[OXM_INLINE_BLOCKS];
+
+  // bitmap of blocks in use
+  mutable uint32_t blocks_used;
+
+  // lazy mode
+  bool lazy;
+
+  // raw TLVs from unpack() in lazy mode, valid until first modification
+  rofl::cmemory raw;
+
+  // raw TLVs not yet decoded into entries entirely
+  mutable std::atomic<bool> pending;
+
+  // protects index and decoded
+  mutable rofl::crwlock rawlock;
+
+  // offset index of raw TLVs, sorted by oxm_type, built on first access
+  mutable std::vector<oxm_slot> index;
+
+  // index has been built
+  mutable bool indexed;
+
+  // raw TLVs may be re-emitted as is (no duplicates or unsupported TLVs)
+  mutable bool verbatim;
+
+  // length of raw TLVs without trailing padding
+  mutable size_t rawlen;
+
+  // TLVs decoded individually from raw TLVs
+  mutable std::map<uint64_t, coxmatch *> decoded;
+
+  // cached result of length(), 0 if stale, reset by all non-const methods
+  mutable std::atomic<size_t> wirelen;
 };
 
 }; // end of namespace openflow
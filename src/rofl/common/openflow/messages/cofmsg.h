@@ -17,6 +17,83 @@ namespace openflow {
  *
  */
 class cofmsg {
+public:
+  /**
+   * @brief	Identifies the concrete message class
+   *
+   * Set by the constructors of each message class and never copied by
+   * assignment, see cofmsg_dispatch for the mapping from wire format.
+   */
+  enum msg_tag_t {
+    MSG_TAG_UNKNOWN = 0,
+    MSG_TAG_HELLO,
+    MSG_TAG_ERROR,
+    MSG_TAG_ECHO_REQUEST,
+    MSG_TAG_ECHO_REPLY,
+    MSG_TAG_EXPERIMENTER,
+    MSG_TAG_FEATURES_REQUEST,
+    MSG_TAG_FEATURES_REPLY,
+    MSG_TAG_GET_CONFIG_REQUEST,
+    MSG_TAG_GET_CONFIG_REPLY,
+    MSG_TAG_SET_CONFIG,
+    MSG_TAG_PACKET_IN,
+    MSG_TAG_FLOW_REMOVED,
+    MSG_TAG_PORT_STATUS,
+    MSG_TAG_PACKET_OUT,
+    MSG_TAG_FLOW_MOD,
+    MSG_TAG_GROUP_MOD,
+    MSG_TAG_PORT_MOD,
+    MSG_TAG_TABLE_MOD,
+    MSG_TAG_STATS_REQUEST,
+    MSG_TAG_DESC_STATS_REQUEST,
+    MSG_TAG_FLOW_STATS_REQUEST,
+    MSG_TAG_AGGR_STATS_REQUEST,
+    MSG_TAG_TABLE_STATS_REQUEST,
+    MSG_TAG_PORT_STATS_REQUEST,
+    MSG_TAG_QUEUE_STATS_REQUEST,
+    MSG_TAG_GROUP_STATS_REQUEST,
+    MSG_TAG_GROUP_DESC_STATS_REQUEST,
+    MSG_TAG_GROUP_FEATURES_STATS_REQUEST,
+    MSG_TAG_METER_STATS_REQUEST,
+    MSG_TAG_METER_CONFIG_STATS_REQUEST,
+    MSG_TAG_METER_FEATURES_STATS_REQUEST,
+    MSG_TAG_TABLE_FEATURES_STATS_REQUEST,
+    MSG_TAG_PORT_DESC_STATS_REQUEST,
+    MSG_TAG_EXPERIMENTER_STATS_REQUEST,
+    MSG_TAG_STATS_REPLY,
+    MSG_TAG_DESC_STATS_REPLY,
+    MSG_TAG_FLOW_STATS_REPLY,
+    MSG_TAG_AGGR_STATS_REPLY,
+    MSG_TAG_TABLE_STATS_REPLY,
+    MSG_TAG_PORT_STATS_REPLY,
+    MSG_TAG_QUEUE_STATS_REPLY,
+    MSG_TAG_GROUP_STATS_REPLY,
+    MSG_TAG_GROUP_DESC_STATS_REPLY,
+    MSG_TAG_GROUP_FEATURES_STATS_REPLY,
+    MSG_TAG_METER_STATS_REPLY,
+    MSG_TAG_METER_CONFIG_STATS_REPLY,
+    MSG_TAG_METER_FEATURES_STATS_REPLY,
+    MSG_TAG_TABLE_FEATURES_STATS_REPLY,
+    MSG_TAG_PORT_DESC_STATS_REPLY,
+    MSG_TAG_EXPERIMENTER_STATS_REPLY,
+    MSG_TAG_BARRIER_REQUEST,
+    MSG_TAG_BARRIER_REPLY,
+    MSG_TAG_QUEUE_GET_CONFIG_REQUEST,
+    MSG_TAG_QUEUE_GET_CONFIG_REPLY,
+    MSG_TAG_ROLE_REQUEST,
+    MSG_TAG_ROLE_REPLY,
+    MSG_TAG_GET_ASYNC_CONFIG_REQUEST,
+    MSG_TAG_GET_ASYNC_CONFIG_REPLY,
+    MSG_TAG_SET_ASYNC_CONFIG,
+    MSG_TAG_METER_MOD,
+    MSG_TAG_MAX,
+  };
+
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_UNKNOWN;
+
 public:
   /**
    *
@@ -28,19 +105,20 @@ public:
    */
   cofmsg()
       : version(0), type(0), len(sizeof(struct rofl::openflow::ofp_header)),
-        xid(0){};
+        xid(0), tag(MSG_TAG){};
 
   /**
    *
    */
   cofmsg(uint8_t version, uint8_t type, uint32_t xid)
       : version(version), type(type),
-        len(sizeof(struct rofl::openflow::ofp_header)), xid(xid){};
+        len(sizeof(struct rofl::openflow::ofp_header)), xid(xid),
+        tag(MSG_TAG){};
 
   /**
    *
    */
-  cofmsg(const cofmsg &msg) { *this = msg; };
+  cofmsg(const cofmsg &msg) : tag(MSG_TAG) { *this = msg; };
 
   /**
    *
@@ -109,6 +187,17 @@ public:
    */
   void set_xid(uint32_t xid) { this->xid = xid; };
 
+  /**
+   *
+   */
+  msg_tag_t get_tag() const { return tag; };
+
+protected:
+  /**
+   *
+   */
+  void set_tag(msg_tag_t tag) { this->tag = tag; };
+
 public:
   friend std::ostream &operator<<(std::ostream &os, cofmsg const &msg) {
     os << "<cofmsg version: " << (int)msg.get_version() << " type: " << std::dec
@@ -152,6 +241,7 @@ private:
   uint8_t type;
   uint16_t len;
   uint32_t xid;
+  msg_tag_t tag;
 };
 
 }; // end of namespace openflow
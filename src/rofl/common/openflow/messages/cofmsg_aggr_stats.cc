@@ -14,6 +14,7 @@ cofmsg_aggr_stats_request::cofmsg_aggr_stats_request(
     : cofmsg_stats_request(version, xid, rofl::openflow::OFPMP_AGGREGATE,
                            stats_flags),
       aggr_stats(aggr_stats) {
+  set_tag(MSG_TAG);
   this->aggr_stats.set_version(version);
 
   switch (version) {
@@ -28,6 +29,7 @@ cofmsg_aggr_stats_request::cofmsg_aggr_stats_request(
 
 cofmsg_aggr_stats_request::cofmsg_aggr_stats_request(
     const cofmsg_aggr_stats_request &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
@@ -131,6 +133,7 @@ cofmsg_aggr_stats_reply::cofmsg_aggr_stats_reply(
     : cofmsg_stats_reply(version, xid, rofl::openflow::OFPMP_AGGREGATE,
                          stats_flags),
       aggr_stats(aggr_stats) {
+  set_tag(MSG_TAG);
   this->aggr_stats.set_version(version);
 
   switch (version) {
@@ -145,6 +148,7 @@ cofmsg_aggr_stats_reply::cofmsg_aggr_stats_reply(
 
 cofmsg_aggr_stats_reply::cofmsg_aggr_stats_reply(
     const cofmsg_aggr_stats_reply &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
@@ -23,6 +23,12 @@ namespace openflow {
  *
  */
 class cofmsg_aggr_stats_request : public cofmsg_stats_request {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_AGGR_STATS_REQUEST;
+
 public:
   /**
    *
@@ -97,6 +103,12 @@ private:
  *
  */
 class cofmsg_aggr_stats_reply : public cofmsg_stats_reply {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_AGGR_STATS_REPLY;
+
 public:
   /**
    *
@@ -10,10 +10,13 @@ cofmsg_get_async_config_request::~cofmsg_get_async_config_request() {}
 
 cofmsg_get_async_config_request::cofmsg_get_async_config_request(
     uint8_t version, uint32_t xid)
-    : cofmsg(version, rofl::openflow::OFPT_GET_ASYNC_REQUEST, xid) {}
+    : cofmsg(version, rofl::openflow::OFPT_GET_ASYNC_REQUEST, xid) {
+  set_tag(MSG_TAG);
+}
 
 cofmsg_get_async_config_request::cofmsg_get_async_config_request(
     const cofmsg_get_async_config_request &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
@@ -75,11 +78,13 @@ cofmsg_get_async_config_reply::cofmsg_get_async_config_reply(
     const rofl::openflow::cofasync_config &async_config)
     : cofmsg(version, rofl::openflow::OFPT_GET_ASYNC_REPLY, xid),
       async_config(async_config) {
+  set_tag(MSG_TAG);
   this->async_config.set_version(version);
 }
 
 cofmsg_get_async_config_reply::cofmsg_get_async_config_reply(
     const cofmsg_get_async_config_reply &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
@@ -159,11 +164,13 @@ cofmsg_set_async_config::cofmsg_set_async_config(
     const rofl::openflow::cofasync_config &async_config)
     : cofmsg(version, rofl::openflow::OFPT_SET_ASYNC, xid),
       async_config(async_config) {
+  set_tag(MSG_TAG);
   this->async_config.set_version(version);
 }
 
 cofmsg_set_async_config::cofmsg_set_async_config(
     const cofmsg_set_async_config &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
@@ -23,6 +23,12 @@ namespace openflow {
  *
  */
 class cofmsg_get_async_config_request : public cofmsg {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_GET_ASYNC_CONFIG_REQUEST;
+
 public:
   /**
    *
@@ -80,6 +86,12 @@ public:
  *
  */
 class cofmsg_get_async_config_reply : public cofmsg {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_GET_ASYNC_CONFIG_REPLY;
+
 public:
   /**
    *
@@ -158,6 +170,12 @@ private:
  *
  */
 class cofmsg_set_async_config : public cofmsg {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_SET_ASYNC_CONFIG;
+
 public:
   /**
    *
@@ -2,6 +2,13 @@
 
 using namespace rofl::openflow;
 
+/*static*/ rofl::cmempool
+    cofmsg_barrier_request::pool("cofmsg_barrier_request",
+                                 sizeof(cofmsg_barrier_request));
+/*static*/ rofl::cmempool
+    cofmsg_barrier_reply::pool("cofmsg_barrier_reply",
+                               sizeof(cofmsg_barrier_reply));
+
 size_t cofmsg_barrier_request::length() const {
   return (cofmsg::length() + body.memlen());
 }
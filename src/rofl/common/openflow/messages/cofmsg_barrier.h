@@ -9,6 +9,7 @@
 #define COFMSG_BARRIER_H_ 1
 
 #include "rofl/common/cmemory.h"
+#include "rofl/common/cmempool.hpp"
 #include "rofl/common/openflow/messages/cofmsg.h"
 
 namespace rofl {
@@ -18,6 +19,25 @@ namespace openflow {
  *
  */
 class cofmsg_barrier_request : public cofmsg {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_BARRIER_REQUEST;
+
+public:
+  /**
+   * @brief	Allocates instances from a per-thread slab pool
+   */
+  static void *operator new(size_t size) { return pool.allocate(size); };
+
+  /**
+   * @brief	Returns instances to the per-thread slab pool
+   */
+  static void operator delete(void *mem, size_t size) {
+    pool.release(mem, size);
+  };
+
 public:
   /**
    *
@@ -30,6 +50,7 @@ public:
   cofmsg_barrier_request(uint8_t version = 0, uint32_t xid = 0,
                          uint8_t *data = 0, size_t datalen = 0)
       : cofmsg(version, datalen, xid), body(data, datalen) {
+    set_tag(MSG_TAG);
     switch (get_version()) {
     case rofl::openflow10::OFP_VERSION: {
       set_type(rofl::openflow10::OFPT_BARRIER_REQUEST /* =18 */);
@@ -41,7 +62,10 @@ public:
   /**
    *
    */
-  cofmsg_barrier_request(const cofmsg_barrier_request &msg) { *this = msg; };
+  cofmsg_barrier_request(const cofmsg_barrier_request &msg) {
+    set_tag(MSG_TAG);
+    *this = msg;
+  };
 
   /**
    *
@@ -99,12 +123,33 @@ public:
 
 private:
   rofl::cmemory body;
+
+  static rofl::cmempool pool;
 };
 
 /**
  *
  */
 class cofmsg_barrier_reply : public cofmsg {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_BARRIER_REPLY;
+
+public:
+  /**
+   * @brief	Allocates instances from a per-thread slab pool
+   */
+  static void *operator new(size_t size) { return pool.allocate(size); };
+
+  /**
+   * @brief	Returns instances to the per-thread slab pool
+   */
+  static void operator delete(void *mem, size_t size) {
+    pool.release(mem, size);
+  };
+
 public:
   /**
    *
@@ -117,6 +162,7 @@ public:
   cofmsg_barrier_reply(uint8_t version = 0, uint32_t xid = 0, uint8_t *data = 0,
                        size_t datalen = 0)
       : cofmsg(version, datalen, xid), body(data, datalen) {
+    set_tag(MSG_TAG);
     switch (get_version()) {
     case rofl::openflow10::OFP_VERSION: {
       set_type(rofl::openflow10::OFPT_BARRIER_REPLY /* =19 */);
@@ -128,7 +174,10 @@ public:
   /**
    *
    */
-  cofmsg_barrier_reply(const cofmsg_barrier_reply &msg) { *this = msg; };
+  cofmsg_barrier_reply(const cofmsg_barrier_reply &msg) {
+    set_tag(MSG_TAG);
+    *this = msg;
+  };
 
   /**
    *
@@ -186,6 +235,8 @@ public:
 
 private:
   rofl::cmemory body;
+
+  static rofl::cmempool pool;
 };
 
 } // end of namespace openflow
@@ -17,6 +17,12 @@ namespace openflow {
  *
  */
 class cofmsg_get_config_request : public cofmsg {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_GET_CONFIG_REQUEST;
+
 public:
   /**
    *
@@ -27,12 +33,15 @@ public:
    *
    */
   cofmsg_get_config_request(uint8_t version = 0, uint32_t xid = 0)
-      : cofmsg(version, rofl::openflow::OFPT_GET_CONFIG_REQUEST, xid){};
+      : cofmsg(version, rofl::openflow::OFPT_GET_CONFIG_REQUEST, xid) {
+    set_tag(MSG_TAG);
+  };
 
   /**
    *
    */
   cofmsg_get_config_request(const cofmsg_get_config_request &msg) {
+    set_tag(MSG_TAG);
     *this = msg;
   };
 
@@ -66,6 +75,12 @@ public:
  *
  */
 class cofmsg_get_config_reply : public cofmsg {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_GET_CONFIG_REPLY;
+
 public:
   /**
    *
@@ -78,12 +93,17 @@ public:
   cofmsg_get_config_reply(uint8_t version = 0, uint32_t xid = 0,
                           uint16_t flags = 0, uint16_t miss_send_len = 0)
       : cofmsg(version, rofl::openflow::OFPT_GET_CONFIG_REPLY, xid),
-        flags(flags), miss_send_len(miss_send_len){};
+        flags(flags), miss_send_len(miss_send_len) {
+    set_tag(MSG_TAG);
+  };
 
   /**
    *
    */
-  cofmsg_get_config_reply(const cofmsg_get_config_reply &msg) { *this = msg; };
+  cofmsg_get_config_reply(const cofmsg_get_config_reply &msg) {
+    set_tag(MSG_TAG);
+    *this = msg;
+  };
 
   /**
    *
@@ -199,6 +219,12 @@ private:
  *
  */
 class cofmsg_set_config : public cofmsg {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_SET_CONFIG;
+
 public:
   /**
    *
@@ -211,12 +237,17 @@ public:
   cofmsg_set_config(uint8_t version = 0, uint32_t xid = 0, uint16_t flags = 0,
                     uint16_t miss_send_len = 0)
       : cofmsg(version, rofl::openflow::OFPT_SET_CONFIG, xid), flags(flags),
-        miss_send_len(miss_send_len){};
+        miss_send_len(miss_send_len) {
+    set_tag(MSG_TAG);
+  };
 
   /**
    *
    */
-  cofmsg_set_config(const cofmsg_set_config &msg) { *this = msg; };
+  cofmsg_set_config(const cofmsg_set_config &msg) {
+    set_tag(MSG_TAG);
+    *this = msg;
+  };
 
   /**
    *
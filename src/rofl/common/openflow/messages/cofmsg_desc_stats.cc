@@ -13,6 +13,7 @@ cofmsg_desc_stats_request::cofmsg_desc_stats_request(uint8_t version,
                                                      uint16_t stats_flags)
     : cofmsg_stats_request(version, xid, rofl::openflow::OFPMP_DESC,
                            stats_flags) {
+  set_tag(MSG_TAG);
   switch (version) {
   case rofl::openflow10::OFP_VERSION: {
     set_stats_type(rofl::openflow10::OFPST_DESC);
@@ -25,6 +26,7 @@ cofmsg_desc_stats_request::cofmsg_desc_stats_request(uint8_t version,
 
 cofmsg_desc_stats_request::cofmsg_desc_stats_request(
     const cofmsg_desc_stats_request &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
@@ -92,6 +94,7 @@ cofmsg_desc_stats_reply::cofmsg_desc_stats_reply(
     const cofdesc_stats_reply &desc_stats)
     : cofmsg_stats_reply(version, xid, rofl::openflow::OFPMP_DESC, stats_flags),
       desc_stats(desc_stats) {
+  set_tag(MSG_TAG);
   this->desc_stats.set_version(version);
 
   switch (version) {
@@ -106,6 +109,7 @@ cofmsg_desc_stats_reply::cofmsg_desc_stats_reply(
 
 cofmsg_desc_stats_reply::cofmsg_desc_stats_reply(
     const cofmsg_desc_stats_reply &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
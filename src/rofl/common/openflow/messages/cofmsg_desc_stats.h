@@ -23,6 +23,12 @@ namespace openflow {
  *
  */
 class cofmsg_desc_stats_request : public cofmsg_stats_request {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_DESC_STATS_REQUEST;
+
 public:
   /**
    *
@@ -80,6 +86,12 @@ public:
  *
  */
 class cofmsg_desc_stats_reply : public cofmsg_stats_reply {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_DESC_STATS_REPLY;
+
 public:
   /**
    *
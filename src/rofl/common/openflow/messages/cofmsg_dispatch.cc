@@ -0,0 +1,423 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/*
+ * cofmsg_dispatch.cc
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "rofl/common/openflow/messages/cofmsg_dispatch.h"
+
+#include "rofl/common/openflow/messages/cofmsg_aggr_stats.h"
+#include "rofl/common/openflow/messages/cofmsg_async_config.h"
+#include "rofl/common/openflow/messages/cofmsg_barrier.h"
+#include "rofl/common/openflow/messages/cofmsg_config.h"
+#include "rofl/common/openflow/messages/cofmsg_desc_stats.h"
+#include "rofl/common/openflow/messages/cofmsg_echo.h"
+#include "rofl/common/openflow/messages/cofmsg_error.h"
+#include "rofl/common/openflow/messages/cofmsg_experimenter.h"
+#include "rofl/common/openflow/messages/cofmsg_experimenter_stats.h"
+#include "rofl/common/openflow/messages/cofmsg_features.h"
+#include "rofl/common/openflow/messages/cofmsg_flow_mod.h"
+#include "rofl/common/openflow/messages/cofmsg_flow_removed.h"
+#include "rofl/common/openflow/messages/cofmsg_flow_stats.h"
+#include "rofl/common/openflow/messages/cofmsg_group_desc_stats.h"
+#include "rofl/common/openflow/messages/cofmsg_group_features_stats.h"
+#include "rofl/common/openflow/messages/cofmsg_group_mod.h"
+#include "rofl/common/openflow/messages/cofmsg_group_stats.h"
+#include "rofl/common/openflow/messages/cofmsg_hello.h"
+#include "rofl/common/openflow/messages/cofmsg_meter_config_stats.h"
+#include "rofl/common/openflow/messages/cofmsg_meter_features_stats.h"
+#include "rofl/common/openflow/messages/cofmsg_meter_mod.h"
+#include "rofl/common/openflow/messages/cofmsg_meter_stats.h"
+#include "rofl/common/openflow/messages/cofmsg_packet_in.h"
+#include "rofl/common/openflow/messages/cofmsg_packet_out.h"
+#include "rofl/common/openflow/messages/cofmsg_port_desc_stats.h"
+#include "rofl/common/openflow/messages/cofmsg_port_mod.h"
+#include "rofl/common/openflow/messages/cofmsg_port_stats.h"
+#include "rofl/common/openflow/messages/cofmsg_port_status.h"
+#include "rofl/common/openflow/messages/cofmsg_queue_get_config.h"
+#include "rofl/common/openflow/messages/cofmsg_queue_stats.h"
+#include "rofl/common/openflow/messages/cofmsg_role.h"
+#include "rofl/common/openflow/messages/cofmsg_stats.h"
+#include "rofl/common/openflow/messages/cofmsg_table_features_stats.h"
+#include "rofl/common/openflow/messages/cofmsg_table_mod.h"
+#include "rofl/common/openflow/messages/cofmsg_table_stats.h"
+
+using namespace rofl::openflow;
+
+namespace {
+
+typedef cofmsg *(*create_fn)();
+typedef cofmsg *(*clone_fn)(const cofmsg &);
+typedef bool (*merge_fn)(cofmsg &, const cofmsg &);
+
+struct msg_ops {
+  cofmsg::msg_tag_t tag;
+  create_fn create;
+  clone_fn clone;
+  merge_fn merge;
+};
+
+template <typename T> cofmsg *create_msg() { return new T(); }
+
+template <typename T> cofmsg *clone_msg(const cofmsg &msg) {
+  return new T(static_cast<const T &>(msg));
+}
+
+template <typename T, typename A, A &(T::*set)(), const A &(T::*get)() const>
+bool merge_msg(cofmsg &msg, const cofmsg &fragment) {
+  (static_cast<T &>(msg).*set)() += (static_cast<const T &>(fragment).*get)();
+  return true;
+}
+
+template <typename T> constexpr msg_ops make_ops(merge_fn merge = nullptr) {
+  return {T::MSG_TAG, &create_msg<T>, &clone_msg<T>, merge};
+}
+
+/* indexed by cofmsg::msg_tag_t */
+constexpr msg_ops ops[] = {
+    make_ops<cofmsg>(),
+    make_ops<cofmsg_hello>(),
+    make_ops<cofmsg_error>(),
+    make_ops<cofmsg_echo_request>(),
+    make_ops<cofmsg_echo_reply>(),
+    make_ops<cofmsg_experimenter>(),
+    make_ops<cofmsg_features_request>(),
+    make_ops<cofmsg_features_reply>(),
+    make_ops<cofmsg_get_config_request>(),
+    make_ops<cofmsg_get_config_reply>(),
+    make_ops<cofmsg_set_config>(),
+    make_ops<cofmsg_packet_in>(),
+    make_ops<cofmsg_flow_removed>(),
+    make_ops<cofmsg_port_status>(),
+    make_ops<cofmsg_packet_out>(),
+    make_ops<cofmsg_flow_mod>(),
+    make_ops<cofmsg_group_mod>(),
+    make_ops<cofmsg_port_mod>(),
+    make_ops<cofmsg_table_mod>(),
+    make_ops<cofmsg_stats_request>(),
+    make_ops<cofmsg_desc_stats_request>(),
+    make_ops<cofmsg_flow_stats_request>(),
+    make_ops<cofmsg_aggr_stats_request>(),
+    make_ops<cofmsg_table_stats_request>(),
+    make_ops<cofmsg_port_stats_request>(),
+    make_ops<cofmsg_queue_stats_request>(),
+    make_ops<cofmsg_group_stats_request>(),
+    make_ops<cofmsg_group_desc_stats_request>(),
+    make_ops<cofmsg_group_features_stats_request>(),
+    make_ops<cofmsg_meter_stats_request>(),
+    make_ops<cofmsg_meter_config_stats_request>(),
+    make_ops<cofmsg_meter_features_stats_request>(),
+    make_ops<cofmsg_table_features_stats_request>(
+        &merge_msg<cofmsg_table_features_stats_request, coftables,
+                   &cofmsg_table_features_stats_request::set_tables,
+                   &cofmsg_table_features_stats_request::get_tables>),
+    make_ops<cofmsg_port_desc_stats_request>(),
+    make_ops<cofmsg_experimenter_stats_request>(),
+    make_ops<cofmsg_stats_reply>(),
+    make_ops<cofmsg_desc_stats_reply>(),
+    make_ops<cofmsg_flow_stats_reply>(
+        &merge_msg<cofmsg_flow_stats_reply, cofflowstatsarray,
+                   &cofmsg_flow_stats_reply::set_flow_stats_array,
+                   &cofmsg_flow_stats_reply::get_flow_stats_array>),
+    make_ops<cofmsg_aggr_stats_reply>(),
+    make_ops<cofmsg_table_stats_reply>(
+        &merge_msg<cofmsg_table_stats_reply, coftablestatsarray,
+                   &cofmsg_table_stats_reply::set_table_stats_array,
+                   &cofmsg_table_stats_reply::get_table_stats_array>),
+    make_ops<cofmsg_port_stats_reply>(
+        &merge_msg<cofmsg_port_stats_reply, cofportstatsarray,
+                   &cofmsg_port_stats_reply::set_port_stats_array,
+                   &cofmsg_port_stats_reply::get_port_stats_array>),
+    make_ops<cofmsg_queue_stats_reply>(
+        &merge_msg<cofmsg_queue_stats_reply, cofqueuestatsarray,
+                   &cofmsg_queue_stats_reply::set_queue_stats_array,
+                   &cofmsg_queue_stats_reply::get_queue_stats_array>),
+    make_ops<cofmsg_group_stats_reply>(
+        &merge_msg<cofmsg_group_stats_reply, cofgroupstatsarray,
+                   &cofmsg_group_stats_reply::set_group_stats_array,
+                   &cofmsg_group_stats_reply::get_group_stats_array>),
+    make_ops<cofmsg_group_desc_stats_reply>(
+        &merge_msg<cofmsg_group_desc_stats_reply, cofgroupdescstatsarray,
+                   &cofmsg_group_desc_stats_reply::set_group_desc_stats_array,
+                   &cofmsg_group_desc_stats_reply::get_group_desc_stats_array>),
+    make_ops<cofmsg_group_features_stats_reply>(),
+    make_ops<cofmsg_meter_stats_reply>(
+        &merge_msg<cofmsg_meter_stats_reply, cofmeterstatsarray,
+                   &cofmsg_meter_stats_reply::set_meter_stats_array,
+                   &cofmsg_meter_stats_reply::get_meter_stats_array>),
+    make_ops<cofmsg_meter_config_stats_reply>(
+        &merge_msg<cofmsg_meter_config_stats_reply, cofmeterconfigarray,
+                   &cofmsg_meter_config_stats_reply::set_meter_config_array,
+                   &cofmsg_meter_config_stats_reply::get_meter_config_array>),
+    make_ops<cofmsg_meter_features_stats_reply>(),
+    make_ops<cofmsg_table_features_stats_reply>(
+        &merge_msg<cofmsg_table_features_stats_reply, coftables,
+                   &cofmsg_table_features_stats_reply::set_tables,
+                   &cofmsg_table_features_stats_reply::get_tables>),
+    make_ops<cofmsg_port_desc_stats_reply>(
+        &merge_msg<cofmsg_port_desc_stats_reply, cofports,
+                   &cofmsg_port_desc_stats_reply::set_ports,
+                   &cofmsg_port_desc_stats_reply::get_ports>),
+    make_ops<cofmsg_experimenter_stats_reply>(),
+    make_ops<cofmsg_barrier_request>(),
+    make_ops<cofmsg_barrier_reply>(),
+    make_ops<cofmsg_queue_get_config_request>(),
+    make_ops<cofmsg_queue_get_config_reply>(),
+    make_ops<cofmsg_role_request>(),
+    make_ops<cofmsg_role_reply>(),
+    make_ops<cofmsg_get_async_config_request>(),
+    make_ops<cofmsg_get_async_config_reply>(),
+    make_ops<cofmsg_set_async_config>(),
+    make_ops<cofmsg_meter_mod>(),
+};
+
+static_assert(sizeof(ops) / sizeof(ops[0]) == cofmsg::MSG_TAG_MAX,
+              "ops table does not cover all message tags");
+
+constexpr bool ops_ordered(unsigned int i) {
+  return (i == cofmsg::MSG_TAG_MAX) ||
+         ((ops[i].tag == i) && ops_ordered(i + 1));
+}
+
+static_assert(ops_ordered(0), "ops table not indexed by message tag");
+
+/* stats types are contiguous from 0 in all versions and map onto
+ * MSG_TAG_DESC_STATS_REQUEST ..., experimenter is handled separately */
+static_assert(cofmsg::MSG_TAG_PORT_DESC_STATS_REQUEST -
+                      cofmsg::MSG_TAG_DESC_STATS_REQUEST ==
+                  rofl::openflow13::OFPMP_PORT_DESC,
+              "stats request tags out of order");
+static_assert(cofmsg::MSG_TAG_STATS_REPLY - cofmsg::MSG_TAG_STATS_REQUEST ==
+                  cofmsg::MSG_TAG_EXPERIMENTER_STATS_REPLY -
+                      cofmsg::MSG_TAG_EXPERIMENTER_STATS_REQUEST,
+              "stats reply tags out of order");
+
+const cofmsg::msg_tag_t of10_types[] = {
+    cofmsg::MSG_TAG_HELLO,
+    cofmsg::MSG_TAG_ERROR,
+    cofmsg::MSG_TAG_ECHO_REQUEST,
+    cofmsg::MSG_TAG_ECHO_REPLY,
+    cofmsg::MSG_TAG_EXPERIMENTER,
+    cofmsg::MSG_TAG_FEATURES_REQUEST,
+    cofmsg::MSG_TAG_FEATURES_REPLY,
+    cofmsg::MSG_TAG_GET_CONFIG_REQUEST,
+    cofmsg::MSG_TAG_GET_CONFIG_REPLY,
+    cofmsg::MSG_TAG_SET_CONFIG,
+    cofmsg::MSG_TAG_PACKET_IN,
+    cofmsg::MSG_TAG_FLOW_REMOVED,
+    cofmsg::MSG_TAG_PORT_STATUS,
+    cofmsg::MSG_TAG_PACKET_OUT,
+    cofmsg::MSG_TAG_FLOW_MOD,
+    cofmsg::MSG_TAG_PORT_MOD,
+    cofmsg::MSG_TAG_STATS_REQUEST,
+    cofmsg::MSG_TAG_STATS_REPLY,
+    cofmsg::MSG_TAG_BARRIER_REQUEST,
+    cofmsg::MSG_TAG_BARRIER_REPLY,
+    cofmsg::MSG_TAG_QUEUE_GET_CONFIG_REQUEST,
+    cofmsg::MSG_TAG_QUEUE_GET_CONFIG_REPLY,
+};
+
+static_assert(sizeof(of10_types) / sizeof(of10_types[0]) ==
+                  rofl::openflow10::OFPT_QUEUE_GET_CONFIG_REPLY + 1,
+              "OFP 1.0 type table size mismatch");
+
+/* OFP 1.2 and 1.3 differ in Meter-Mod only */
+const cofmsg::msg_tag_t of13_types[] = {
+    cofmsg::MSG_TAG_HELLO,
+    cofmsg::MSG_TAG_ERROR,
+    cofmsg::MSG_TAG_ECHO_REQUEST,
+    cofmsg::MSG_TAG_ECHO_REPLY,
+    cofmsg::MSG_TAG_EXPERIMENTER,
+    cofmsg::MSG_TAG_FEATURES_REQUEST,
+    cofmsg::MSG_TAG_FEATURES_REPLY,
+    cofmsg::MSG_TAG_GET_CONFIG_REQUEST,
+    cofmsg::MSG_TAG_GET_CONFIG_REPLY,
+    cofmsg::MSG_TAG_SET_CONFIG,
+    cofmsg::MSG_TAG_PACKET_IN,
+    cofmsg::MSG_TAG_FLOW_REMOVED,
+    cofmsg::MSG_TAG_PORT_STATUS,
+    cofmsg::MSG_TAG_PACKET_OUT,
+    cofmsg::MSG_TAG_FLOW_MOD,
+    cofmsg::MSG_TAG_GROUP_MOD,
+    cofmsg::MSG_TAG_PORT_MOD,
+    cofmsg::MSG_TAG_TABLE_MOD,
+    cofmsg::MSG_TAG_STATS_REQUEST,
+    cofmsg::MSG_TAG_STATS_REPLY,
+    cofmsg::MSG_TAG_BARRIER_REQUEST,
+    cofmsg::MSG_TAG_BARRIER_REPLY,
+    cofmsg::MSG_TAG_QUEUE_GET_CONFIG_REQUEST,
+    cofmsg::MSG_TAG_QUEUE_GET_CONFIG_REPLY,
+    cofmsg::MSG_TAG_ROLE_REQUEST,
+    cofmsg::MSG_TAG_ROLE_REPLY,
+    cofmsg::MSG_TAG_GET_ASYNC_CONFIG_REQUEST,
+    cofmsg::MSG_TAG_GET_ASYNC_CONFIG_REPLY,
+    cofmsg::MSG_TAG_SET_ASYNC_CONFIG,
+    cofmsg::MSG_TAG_METER_MOD,
+};
+
+static_assert(sizeof(of13_types) / sizeof(of13_types[0]) ==
+                  rofl::openflow13::OFPT_METER_MOD + 1,
+              "OFP 1.3 type table size mismatch");
+
+struct version_table {
+  const cofmsg::msg_tag_t *types;
+  unsigned int num_types;
+  uint16_t num_stats_types;
+  size_t stats_request_len;
+  size_t stats_reply_len;
+};
+
+const version_table of10_table = {
+    of10_types, sizeof(of10_types) / sizeof(of10_types[0]),
+    rofl::openflow10::OFPST_QUEUE + 1,
+    sizeof(struct rofl::openflow10::ofp_stats_request),
+    sizeof(struct rofl::openflow10::ofp_stats_reply)};
+
+const version_table of12_table = {
+    of13_types, rofl::openflow12::OFPT_SET_ASYNC + 1,
+    rofl::openflow12::OFPST_GROUP_FEATURES + 1,
+    sizeof(struct rofl::openflow12::ofp_stats_request),
+    sizeof(struct rofl::openflow12::ofp_stats_reply)};
+
+const version_table of13_table = {
+    of13_types, sizeof(of13_types) / sizeof(of13_types[0]),
+    rofl::openflow13::OFPMP_PORT_DESC + 1,
+    sizeof(struct rofl::openflow13::ofp_multipart_request),
+    sizeof(struct rofl::openflow13::ofp_multipart_reply)};
+
+const version_table &get_version_table(uint8_t version) {
+  switch (version) {
+  case rofl::openflow10::OFP_VERSION:
+    return of10_table;
+  case rofl::openflow12::OFP_VERSION:
+    return of12_table;
+  case rofl::openflow13::OFP_VERSION:
+    return of13_table;
+  default: {
+    throw rofl::eBadRequestBadVersion("eBadRequestBadVersion", __FILE__,
+                                      __FUNCTION__, __LINE__);
+  };
+  }
+}
+
+cofmsg::msg_tag_t get_type_tag(const version_table &vt, uint8_t type) {
+  if (type >= vt.num_types) {
+    throw rofl::eBadRequestBadType("eBadRequestBadType", __FILE__,
+                                   __FUNCTION__, __LINE__);
+  }
+  return vt.types[type];
+}
+
+cofmsg::msg_tag_t get_stats_tag(const version_table &vt,
+                                cofmsg::msg_tag_t tag, uint16_t stats_type) {
+  /* OFPST_VENDOR, OFPST_EXPERIMENTER and OFPMP_EXPERIMENTER */
+  const uint16_t experimenter = 0xffff;
+
+  unsigned int offset = 0;
+  if (stats_type < vt.num_stats_types) {
+    offset = cofmsg::MSG_TAG_DESC_STATS_REQUEST + stats_type;
+  } else if (stats_type == experimenter) {
+    offset = cofmsg::MSG_TAG_EXPERIMENTER_STATS_REQUEST;
+  } else {
+    throw rofl::eBadRequestBadStat("eBadRequestBadStat", __FILE__,
+                                   __FUNCTION__, __LINE__);
+  }
+  offset -= cofmsg::MSG_TAG_STATS_REQUEST;
+  return (cofmsg::msg_tag_t)(tag + offset);
+}
+
+}; // end of anonymous namespace
+
+cofmsg::msg_tag_t cofmsg_dispatch::lookup(uint8_t version, uint8_t type,
+                                          uint16_t stats_type) {
+  const version_table &vt = get_version_table(version);
+  cofmsg::msg_tag_t tag = get_type_tag(vt, type);
+  if ((cofmsg::MSG_TAG_STATS_REQUEST == tag) ||
+      (cofmsg::MSG_TAG_STATS_REPLY == tag)) {
+    tag = get_stats_tag(vt, tag, stats_type);
+  }
+  return tag;
+}
+
+cofmsg *cofmsg_dispatch::parse(uint8_t *buf, size_t buflen) {
+  if (buflen < sizeof(struct rofl::openflow::ofp_header)) {
+    throw eBadRequestBadLen("eBadRequestBadLen", __FILE__, __FUNCTION__,
+                            __LINE__);
+  }
+  struct rofl::openflow::ofp_header *hdr =
+      (struct rofl::openflow::ofp_header *)buf;
+
+  const version_table &vt = get_version_table(hdr->version);
+  cofmsg::msg_tag_t tag = get_type_tag(vt, hdr->type);
+
+  if ((cofmsg::MSG_TAG_STATS_REQUEST == tag) ||
+      (cofmsg::MSG_TAG_STATS_REPLY == tag)) {
+    size_t minlen = (cofmsg::MSG_TAG_STATS_REQUEST == tag)
+                        ? vt.stats_request_len
+                        : vt.stats_reply_len;
+    if (buflen < minlen) {
+      throw eBadRequestBadLen("eBadRequestBadLen", __FILE__, __FUNCTION__,
+                              __LINE__);
+    }
+    /* stats type follows the common header in all versions */
+    uint16_t stats_type = be16toh(
+        *(uint16_t *)(buf + sizeof(struct rofl::openflow::ofp_header)));
+    tag = get_stats_tag(vt, tag, stats_type);
+  }
+
+  cofmsg *msg = ops[tag].create();
+  try {
+    msg->unpack(buf, buflen);
+  } catch (...) {
+    delete msg;
+    throw;
+  }
+  return msg;
+}
+
+cofmsg *cofmsg_dispatch::create(cofmsg::msg_tag_t tag) {
+  if (tag >= cofmsg::MSG_TAG_MAX) {
+    throw eInvalid("cofmsg_dispatch::create() invalid tag", __FILE__,
+                   __FUNCTION__, __LINE__);
+  }
+  return ops[tag].create();
+}
+
+cofmsg *cofmsg_dispatch::clone(const cofmsg &msg) {
+  return ops[msg.get_tag()].clone(msg);
+}
+
+bool cofmsg_dispatch::merge(cofmsg &msg, const cofmsg &fragment) {
+  if ((msg.get_tag() != fragment.get_tag()) ||
+      (nullptr == ops[msg.get_tag()].merge)) {
+    return false;
+  }
+  return ops[msg.get_tag()].merge(msg, fragment);
+}
+
+uint16_t cofmsg_dispatch::get_stats_type(const cofmsg &msg) {
+  if (is_stats_request(msg.get_tag()))
+    return static_cast<const cofmsg_stats_request &>(msg).get_stats_type();
+  if (is_stats_reply(msg.get_tag()))
+    return static_cast<const cofmsg_stats_reply &>(msg).get_stats_type();
+  return 0;
+}
+
+uint16_t cofmsg_dispatch::get_stats_flags(const cofmsg &msg) {
+  if (is_stats_request(msg.get_tag()))
+    return static_cast<const cofmsg_stats_request &>(msg).get_stats_flags();
+  if (is_stats_reply(msg.get_tag()))
+    return static_cast<const cofmsg_stats_reply &>(msg).get_stats_flags();
+  return 0;
+}
+
+void cofmsg_dispatch::set_stats_flags(cofmsg &msg, uint16_t flags) {
+  if (is_stats_request(msg.get_tag()))
+    static_cast<cofmsg_stats_request &>(msg).set_stats_flags(flags);
+  else if (is_stats_reply(msg.get_tag()))
+    static_cast<cofmsg_stats_reply &>(msg).set_stats_flags(flags);
+}
@@ -0,0 +1,151 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/*
+ * cofmsg_dispatch.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef COFMSG_DISPATCH_H_
+#define COFMSG_DISPATCH_H_ 1
+
+#include <inttypes.h>
+
+#include "rofl/common/openflow/messages/cofmsg.h"
+#include "rofl/common/openflow/openflow_rofl_exceptions.h"
+
+namespace rofl {
+namespace openflow {
+
+/**
+ * @brief	Table driven message dispatch based on cofmsg::msg_tag_t
+ *
+ * Maps (version, type, stats type) of a received message to its tag and
+ * provides create, clone and merge operations per tag without RTTI.
+ */
+class cofmsg_dispatch {
+public:
+  /**
+   * @brief	Returns the tag for a message type
+   *
+   * @throws eBadRequestBadVersion unsupported version
+   * @throws eBadRequestBadType unknown message type
+   * @throws eBadRequestBadStat unknown stats type
+   */
+  static cofmsg::msg_tag_t lookup(uint8_t version, uint8_t type,
+                                  uint16_t stats_type = 0);
+
+  /**
+   * @brief	Allocates and unpacks the message stored in buf
+   *
+   * @throws eBadRequestBadLen buffer too short for header or stats header
+   */
+  static cofmsg *parse(uint8_t *buf, size_t buflen);
+
+  /**
+   * @brief	Allocates an empty message for tag
+   */
+  static cofmsg *create(cofmsg::msg_tag_t tag);
+
+  /**
+   * @brief	Allocates a copy of msg with its dynamic type
+   */
+  static cofmsg *clone(const cofmsg &msg);
+
+  /**
+   * @brief	Appends the body of a multipart fragment to msg
+   *
+   * @return false if messages of this tag cannot be merged
+   */
+  static bool merge(cofmsg &msg, const cofmsg &fragment);
+
+  /**
+   * @brief	Returns true for Stats/Multipart-Request messages
+   */
+  static bool is_stats_request(cofmsg::msg_tag_t tag) {
+    return (tag >= cofmsg::MSG_TAG_STATS_REQUEST) &&
+           (tag <= cofmsg::MSG_TAG_EXPERIMENTER_STATS_REQUEST);
+  };
+
+  /**
+   * @brief	Returns true for Stats/Multipart-Reply messages
+   */
+  static bool is_stats_reply(cofmsg::msg_tag_t tag) {
+    return (tag >= cofmsg::MSG_TAG_STATS_REPLY) &&
+           (tag <= cofmsg::MSG_TAG_EXPERIMENTER_STATS_REPLY);
+  };
+
+  /**
+   * @brief	Returns true if tag denotes base or a class derived from base
+   */
+  static bool is_a(cofmsg::msg_tag_t tag, cofmsg::msg_tag_t base) {
+    switch (base) {
+    case cofmsg::MSG_TAG_UNKNOWN:
+      return true;
+    case cofmsg::MSG_TAG_STATS_REQUEST:
+      return is_stats_request(tag);
+    case cofmsg::MSG_TAG_STATS_REPLY:
+      return is_stats_reply(tag);
+    default:
+      return (tag == base);
+    }
+  };
+
+  /**
+   * @brief	Returns the stats type of a Stats/Multipart message or 0
+   */
+  static uint16_t get_stats_type(const cofmsg &msg);
+
+  /**
+   * @brief	Returns the stats flags of a Stats/Multipart message or 0
+   */
+  static uint16_t get_stats_flags(const cofmsg &msg);
+
+  /**
+   * @brief	Sets the stats flags of a Stats/Multipart message
+   */
+  static void set_stats_flags(cofmsg &msg, uint16_t flags);
+};
+
+/**
+ * @brief	Checked downcast based on the message tag
+ *
+ * @return NULL if msg is not a T
+ */
+template <typename T> T *cofmsg_cast(cofmsg *msg) {
+  if ((NULL == msg) || !cofmsg_dispatch::is_a(msg->get_tag(), T::MSG_TAG))
+    return NULL;
+  return static_cast<T *>(msg);
+}
+
+template <typename T> const T *cofmsg_cast(const cofmsg *msg) {
+  if ((NULL == msg) || !cofmsg_dispatch::is_a(msg->get_tag(), T::MSG_TAG))
+    return NULL;
+  return static_cast<const T *>(msg);
+}
+
+/**
+ * @brief	Checked downcast based on the message tag
+ *
+ * @throws eBadRequestBadType msg is not a T
+ */
+template <typename T> T &cofmsg_cast(cofmsg &msg) {
+  if (!cofmsg_dispatch::is_a(msg.get_tag(), T::MSG_TAG))
+    throw eBadRequestBadType("cofmsg_cast() message type mismatch", __FILE__,
+                             __FUNCTION__, __LINE__);
+  return static_cast<T &>(msg);
+}
+
+template <typename T> const T &cofmsg_cast(const cofmsg &msg) {
+  if (!cofmsg_dispatch::is_a(msg.get_tag(), T::MSG_TAG))
+    throw eBadRequestBadType("cofmsg_cast() message type mismatch", __FILE__,
+                             __FUNCTION__, __LINE__);
+  return static_cast<const T &>(msg);
+}
+
+}; // end of namespace openflow
+}; // end of namespace rofl
+
+#endif /* COFMSG_DISPATCH_H_ */
@@ -2,6 +2,12 @@
 
 using namespace rofl::openflow;
 
+/*static*/ rofl::cmempool
+    cofmsg_echo_request::pool("cofmsg_echo_request",
+                              sizeof(cofmsg_echo_request));
+/*static*/ rofl::cmempool
+    cofmsg_echo_reply::pool("cofmsg_echo_reply", sizeof(cofmsg_echo_reply));
+
 size_t cofmsg_echo_request::length() const {
   return (cofmsg::length() + body.memlen());
 }
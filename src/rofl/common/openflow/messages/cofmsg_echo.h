@@ -9,6 +9,7 @@
 #define COFMSG_ECHO_H_ 1
 
 #include "rofl/common/cmemory.h"
+#include "rofl/common/cmempool.hpp"
 #include "rofl/common/openflow/messages/cofmsg.h"
 
 namespace rofl {
@@ -18,6 +19,25 @@ namespace openflow {
  *
  */
 class cofmsg_echo_request : public cofmsg {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_ECHO_REQUEST;
+
+public:
+  /**
+   * @brief	Allocates instances from a per-thread slab pool
+   */
+  static void *operator new(size_t size) { return pool.allocate(size); };
+
+  /**
+   * @brief	Returns instances to the per-thread slab pool
+   */
+  static void operator delete(void *mem, size_t size) {
+    pool.release(mem, size);
+  };
+
 public:
   /**
    *
@@ -30,12 +50,17 @@ public:
   cofmsg_echo_request(uint8_t version = 0, uint32_t xid = 0, uint8_t *data = 0,
                       size_t datalen = 0)
       : cofmsg(version, rofl::openflow::OFPT_ECHO_REQUEST, xid),
-        body(data, datalen){};
+        body(data, datalen) {
+    set_tag(MSG_TAG);
+  };
 
   /**
    *
    */
-  cofmsg_echo_request(const cofmsg_echo_request &msg) { *this = msg; };
+  cofmsg_echo_request(const cofmsg_echo_request &msg) {
+    set_tag(MSG_TAG);
+    *this = msg;
+  };
 
   /**
    *
@@ -92,12 +117,33 @@ public:
 
 private:
   rofl::cmemory body;
+
+  static rofl::cmempool pool;
 };
 
 /**
  *
  */
 class cofmsg_echo_reply : public cofmsg {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_ECHO_REPLY;
+
+public:
+  /**
+   * @brief	Allocates instances from a per-thread slab pool
+   */
+  static void *operator new(size_t size) { return pool.allocate(size); };
+
+  /**
+   * @brief	Returns instances to the per-thread slab pool
+   */
+  static void operator delete(void *mem, size_t size) {
+    pool.release(mem, size);
+  };
+
 public:
   /**
    *
@@ -110,12 +156,17 @@ public:
   cofmsg_echo_reply(uint8_t version = 0, uint32_t xid = 0, uint8_t *data = 0,
                     size_t datalen = 0)
       : cofmsg(version, rofl::openflow::OFPT_ECHO_REPLY, xid),
-        body(data, datalen){};
+        body(data, datalen) {
+    set_tag(MSG_TAG);
+  };
 
   /**
    *
    */
-  cofmsg_echo_reply(const cofmsg_echo_reply &msg) { *this = msg; };
+  cofmsg_echo_reply(const cofmsg_echo_reply &msg) {
+    set_tag(MSG_TAG);
+    *this = msg;
+  };
 
   /**
    *
@@ -172,6 +223,8 @@ public:
 
 private:
   rofl::cmemory body;
+
+  static rofl::cmempool pool;
 };
 
 } // end of namespace openflow
@@ -20,6 +20,12 @@ namespace openflow {
  *
  */
 class cofmsg_error : public cofmsg {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_ERROR;
+
 public:
   /**
    *
@@ -32,12 +38,17 @@ public:
   cofmsg_error(uint8_t version = 0, uint32_t xid = 0, uint16_t err_type = 0,
                uint16_t err_code = 0, uint8_t *data = 0, size_t datalen = 0)
       : cofmsg(version, rofl::openflow::OFPT_ERROR, xid), err_type(err_type),
-        err_code(err_code), body(data, datalen){};
+        err_code(err_code), body(data, datalen) {
+    set_tag(MSG_TAG);
+  };
 
   /**
    *
    */
-  cofmsg_error(const cofmsg_error &msg) { *this = msg; };
+  cofmsg_error(const cofmsg_error &msg) {
+    set_tag(MSG_TAG);
+    *this = msg;
+  };
 
   /**
    *
@@ -18,6 +18,12 @@ namespace openflow {
  *
  */
 class cofmsg_experimenter : public cofmsg {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_EXPERIMENTER;
+
 public:
   /**
    *
@@ -31,12 +37,17 @@ public:
                       uint32_t exp_id = 0, uint32_t exp_type = 0,
                       uint8_t *data = (uint8_t *)0, size_t datalen = 0)
       : cofmsg(version, rofl::openflow::OFPT_EXPERIMENTER, xid), exp_id(exp_id),
-        exp_type(exp_type), body(data, datalen){};
+        exp_type(exp_type), body(data, datalen) {
+    set_tag(MSG_TAG);
+  };
 
   /**
    *
    */
-  cofmsg_experimenter(const cofmsg_experimenter &msg) { *this = msg; };
+  cofmsg_experimenter(const cofmsg_experimenter &msg) {
+    set_tag(MSG_TAG);
+    *this = msg;
+  };
 
   /**
    *
@@ -14,6 +14,7 @@ cofmsg_experimenter_stats_request::cofmsg_experimenter_stats_request(
     : cofmsg_stats_request(version, xid, rofl::openflow::OFPMP_EXPERIMENTER,
                            stats_flags),
       exp_id(exp_id), exp_type(exp_type), exp_body(body) {
+  set_tag(MSG_TAG);
   switch (version) {
   case rofl::openflow10::OFP_VERSION: {
     set_stats_type(rofl::openflow10::OFPST_VENDOR);
@@ -24,6 +25,7 @@ cofmsg_experimenter_stats_request::cofmsg_experimenter_stats_request(
 
 cofmsg_experimenter_stats_request::cofmsg_experimenter_stats_request(
     const cofmsg_experimenter_stats_request &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
@@ -163,6 +165,7 @@ cofmsg_experimenter_stats_reply::cofmsg_experimenter_stats_reply(
     : cofmsg_stats_reply(version, xid, rofl::openflow::OFPMP_EXPERIMENTER,
                          stats_flags),
       exp_id(exp_id), exp_type(exp_type), exp_body(body) {
+  set_tag(MSG_TAG);
   switch (version) {
   case rofl::openflow10::OFP_VERSION: {
     set_stats_type(rofl::openflow10::OFPST_VENDOR);
@@ -173,6 +176,7 @@ cofmsg_experimenter_stats_reply::cofmsg_experimenter_stats_reply(
 
 cofmsg_experimenter_stats_reply::cofmsg_experimenter_stats_reply(
     const cofmsg_experimenter_stats_reply &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
@@ -23,6 +23,12 @@ namespace openflow {
  *
  */
 class cofmsg_experimenter_stats_request : public cofmsg_stats_request {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_EXPERIMENTER_STATS_REQUEST;
+
 public:
   /**
    *
@@ -134,6 +140,12 @@ private:
  *
  */
 class cofmsg_experimenter_stats_reply : public cofmsg_stats_reply {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_EXPERIMENTER_STATS_REPLY;
+
 public:
   /**
    *
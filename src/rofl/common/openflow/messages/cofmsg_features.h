@@ -20,6 +20,12 @@ namespace openflow {
  *
  */
 class cofmsg_features_request : public cofmsg {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_FEATURES_REQUEST;
+
 public:
   /**
    *
@@ -30,12 +36,17 @@ public:
    *
    */
   cofmsg_features_request(uint8_t version = 0, uint32_t xid = 0)
-      : cofmsg(version, rofl::openflow::OFPT_FEATURES_REQUEST, xid){};
+      : cofmsg(version, rofl::openflow::OFPT_FEATURES_REQUEST, xid) {
+    set_tag(MSG_TAG);
+  };
 
   /**
    *
    */
-  cofmsg_features_request(const cofmsg_features_request &msg) { *this = msg; };
+  cofmsg_features_request(const cofmsg_features_request &msg) {
+    set_tag(MSG_TAG);
+    *this = msg;
+  };
 
   /**
    *
@@ -66,6 +77,12 @@ public:
  *
  */
 class cofmsg_features_reply : public cofmsg {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_FEATURES_REPLY;
+
 public:
   /**
    *
@@ -85,13 +102,17 @@ public:
       : cofmsg(version, rofl::openflow::OFPT_FEATURES_REPLY, xid), dpid(dpid),
         n_buffers(n_buffers), n_tables(n_tables), auxid(auxid),
         capabilities(capabilities), actions(actions_bitmap), ports(ports) {
+    set_tag(MSG_TAG);
     this->ports.set_version(version);
   };
 
   /**
    *
    */
-  cofmsg_features_reply(const cofmsg_features_reply &msg) { *this = msg; };
+  cofmsg_features_reply(const cofmsg_features_reply &msg) {
+    set_tag(MSG_TAG);
+    *this = msg;
+  };
 
   /**
    *
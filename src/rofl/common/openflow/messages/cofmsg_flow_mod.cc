@@ -2,15 +2,22 @@
 
 using namespace rofl::openflow;
 
+/*static*/ rofl::cmempool
+    cofmsg_flow_mod::pool("cofmsg_flow_mod", sizeof(cofmsg_flow_mod));
+
 cofmsg_flow_mod::~cofmsg_flow_mod() {}
 
 cofmsg_flow_mod::cofmsg_flow_mod(uint8_t version, uint32_t xid,
                                  const rofl::openflow::cofflowmod &flowmod)
     : cofmsg(version, rofl::openflow::OFPT_FLOW_MOD, xid), flowmod(flowmod) {
+  set_tag(MSG_TAG);
   this->flowmod.set_version(version);
 }
 
-cofmsg_flow_mod::cofmsg_flow_mod(const cofmsg_flow_mod &msg) { *this = msg; }
+cofmsg_flow_mod::cofmsg_flow_mod(const cofmsg_flow_mod &msg) {
+  set_tag(MSG_TAG);
+  *this = msg;
+}
 
 cofmsg_flow_mod &cofmsg_flow_mod::operator=(const cofmsg_flow_mod &msg) {
   if (this == &msg)
@@ -8,6 +8,7 @@
 #ifndef COFMSG_FLOW_MOD_H_
 #define COFMSG_FLOW_MOD_H_ 1
 
+#include "rofl/common/cmempool.hpp"
 #include "rofl/common/openflow/cofflowmod.h"
 #include "rofl/common/openflow/messages/cofmsg.h"
 
@@ -18,6 +19,25 @@ namespace openflow {
  *
  */
 class cofmsg_flow_mod : public cofmsg {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_FLOW_MOD;
+
+public:
+  /**
+   * @brief	Allocates instances from a per-thread slab pool
+   */
+  static void *operator new(size_t size) { return pool.allocate(size); };
+
+  /**
+   * @brief	Returns instances to the per-thread slab pool
+   */
+  static void operator delete(void *mem, size_t size) {
+    pool.release(mem, size);
+  };
+
 public:
   /**
    *
@@ -90,6 +110,8 @@ public:
 
 private:
   rofl::openflow::cofflowmod flowmod;
+
+  static rofl::cmempool pool;
 };
 
 } // end of namespace openflow
@@ -2,6 +2,10 @@
 
 using namespace rofl::openflow;
 
+/*static*/ rofl::cmempool
+    cofmsg_flow_removed::pool("cofmsg_flow_removed",
+                              sizeof(cofmsg_flow_removed));
+
 /*static*/ const size_t cofmsg_flow_removed::OFP10_FLOW_REMOVED_STATIC_HDR_LEN =
     sizeof(struct rofl::openflow10::ofp_flow_removed);
 /*static*/ const size_t cofmsg_flow_removed::OFP13_FLOW_REMOVED_STATIC_HDR_LEN =
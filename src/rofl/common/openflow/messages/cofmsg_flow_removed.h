@@ -9,6 +9,7 @@
 #define COFMSG_FLOW_REMOVED_H_ 1
 
 #include "cofmsg.h"
+#include "rofl/common/cmempool.hpp"
 #include "rofl/common/openflow/cofmatch.h"
 
 namespace rofl {
@@ -18,6 +19,25 @@ namespace openflow {
  *
  */
 class cofmsg_flow_removed : public cofmsg {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_FLOW_REMOVED;
+
+public:
+  /**
+   * @brief	Allocates instances from a per-thread slab pool
+   */
+  static void *operator new(size_t size) { return pool.allocate(size); };
+
+  /**
+   * @brief	Returns instances to the per-thread slab pool
+   */
+  static void operator delete(void *mem, size_t size) {
+    pool.release(mem, size);
+  };
+
 public:
   /**
    *
@@ -39,13 +59,17 @@ public:
         duration_sec(duration_sec), duration_nsec(duration_nsec),
         idle_timeout(idle_timeout), hard_timeout(hard_timeout),
         packet_count(packet_count), byte_count(byte_count), match(match) {
+    set_tag(MSG_TAG);
     this->match.set_version(version);
   };
 
   /**
    *
    */
-  cofmsg_flow_removed(const cofmsg_flow_removed &msg) { *this = msg; };
+  cofmsg_flow_removed(const cofmsg_flow_removed &msg) {
+    set_tag(MSG_TAG);
+    *this = msg;
+  };
 
   /**
    *
@@ -317,6 +341,8 @@ private:
   uint64_t packet_count;
   uint64_t byte_count;
   rofl::openflow::cofmatch match;
+
+  static rofl::cmempool pool;
 };
 
 } // end of namespace openflow
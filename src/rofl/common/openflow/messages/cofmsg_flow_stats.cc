@@ -14,11 +14,13 @@ cofmsg_flow_stats_request::cofmsg_flow_stats_request(
     : cofmsg_stats_request(version, xid, rofl::openflow::OFPMP_FLOW,
                            stats_flags),
       flow_stats(flow_stats) {
+  set_tag(MSG_TAG);
   this->flow_stats.set_version(version);
 }
 
 cofmsg_flow_stats_request::cofmsg_flow_stats_request(
     const cofmsg_flow_stats_request &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
@@ -121,11 +123,13 @@ cofmsg_flow_stats_reply::cofmsg_flow_stats_reply(
     const rofl::openflow::cofflowstatsarray &flowstatsarray)
     : cofmsg_stats_reply(version, xid, rofl::openflow::OFPMP_FLOW, flags),
       flowstatsarray(flowstatsarray) {
+  set_tag(MSG_TAG);
   this->flowstatsarray.set_version(version);
 }
 
 cofmsg_flow_stats_reply::cofmsg_flow_stats_reply(
     const cofmsg_flow_stats_reply &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
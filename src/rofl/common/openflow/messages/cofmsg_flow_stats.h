@@ -24,6 +24,12 @@ namespace openflow {
  *
  */
 class cofmsg_flow_stats_request : public cofmsg_stats_request {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_FLOW_STATS_REQUEST;
+
 public:
   /**
    *
@@ -99,6 +105,12 @@ private:
  *
  */
 class cofmsg_flow_stats_reply : public cofmsg_stats_reply {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_FLOW_STATS_REPLY;
+
 public:
   /**
    *
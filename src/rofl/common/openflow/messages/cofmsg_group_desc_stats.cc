@@ -11,10 +11,13 @@ cofmsg_group_desc_stats_request::~cofmsg_group_desc_stats_request() {}
 cofmsg_group_desc_stats_request::cofmsg_group_desc_stats_request(
     uint8_t of_version, uint32_t xid, uint16_t flags)
     : cofmsg_stats_request(of_version, xid, rofl::openflow::OFPMP_GROUP_DESC,
-                           flags) {}
+                           flags) {
+  set_tag(MSG_TAG);
+}
 
 cofmsg_group_desc_stats_request::cofmsg_group_desc_stats_request(
     const cofmsg_group_desc_stats_request &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
@@ -73,11 +76,13 @@ cofmsg_group_desc_stats_reply::cofmsg_group_desc_stats_reply(
     const rofl::openflow::cofgroupdescstatsarray &groupdescstatsarray)
     : cofmsg_stats_reply(version, xid, rofl::openflow::OFPMP_GROUP_DESC, flags),
       groupdescstatsarray(groupdescstatsarray) {
+  set_tag(MSG_TAG);
   this->groupdescstatsarray.set_version(version);
 }
 
 cofmsg_group_desc_stats_reply::cofmsg_group_desc_stats_reply(
     const cofmsg_group_desc_stats_reply &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
@@ -11,10 +11,13 @@ cofmsg_group_features_stats_request::~cofmsg_group_features_stats_request() {}
 cofmsg_group_features_stats_request::cofmsg_group_features_stats_request(
     uint8_t version, uint32_t xid, uint16_t flags)
     : cofmsg_stats_request(version, xid, rofl::openflow::OFPMP_GROUP_FEATURES,
-                           flags) {}
+                           flags) {
+  set_tag(MSG_TAG);
+}
 
 cofmsg_group_features_stats_request::cofmsg_group_features_stats_request(
     const cofmsg_group_features_stats_request &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
@@ -74,11 +77,13 @@ cofmsg_group_features_stats_reply::cofmsg_group_features_stats_reply(
     : cofmsg_stats_reply(version, xid, rofl::openflow::OFPMP_GROUP_FEATURES,
                          stats_flags),
       group_features_stats(group_features_stats) {
+  set_tag(MSG_TAG);
   this->group_features_stats.set_version(version);
 }
 
 cofmsg_group_features_stats_reply::cofmsg_group_features_stats_reply(
     const cofmsg_group_features_stats_reply &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
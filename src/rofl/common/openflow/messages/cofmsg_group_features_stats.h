@@ -23,6 +23,12 @@ namespace openflow {
  *
  */
 class cofmsg_group_features_stats_request : public cofmsg_stats_request {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_GROUP_FEATURES_STATS_REQUEST;
+
 public:
   /**
    *
@@ -83,6 +89,12 @@ public:
  *
  */
 class cofmsg_group_features_stats_reply : public cofmsg_stats_reply {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_GROUP_FEATURES_STATS_REPLY;
+
 public:
   /**
    *
@@ -18,6 +18,12 @@ namespace openflow {
  *
  */
 class cofmsg_group_mod : public cofmsg {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_GROUP_MOD;
+
 public:
   /**
    *
@@ -33,13 +39,17 @@ public:
                        rofl::openflow::cofgroupmod())
       : cofmsg(version, rofl::openflow12::OFPT_GROUP_MOD, xid),
         groupmod(groupmod) {
+    set_tag(MSG_TAG);
     this->groupmod.set_version(version);
   };
 
   /**
    *
    */
-  cofmsg_group_mod(const cofmsg_group_mod &msg) { *this = msg; };
+  cofmsg_group_mod(const cofmsg_group_mod &msg) {
+    set_tag(MSG_TAG);
+    *this = msg;
+  };
 
   /**
    *
@@ -14,11 +14,13 @@ cofmsg_group_stats_request::cofmsg_group_stats_request(
     : cofmsg_stats_request(version, xid, rofl::openflow::OFPMP_GROUP,
                            stats_flags),
       group_stats(group_stats) {
+  set_tag(MSG_TAG);
   this->group_stats.set_version(version);
 }
 
 cofmsg_group_stats_request::cofmsg_group_stats_request(
     const cofmsg_group_stats_request &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
@@ -100,11 +102,13 @@ cofmsg_group_stats_reply::cofmsg_group_stats_reply(
     : cofmsg_stats_reply(version, xid, rofl::openflow::OFPMP_GROUP,
                          stats_flags),
       groupstatsarray(groupstatsarray) {
+  set_tag(MSG_TAG);
   this->groupstatsarray.set_version(version);
 }
 
 cofmsg_group_stats_reply::cofmsg_group_stats_reply(
     const cofmsg_group_stats_reply &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
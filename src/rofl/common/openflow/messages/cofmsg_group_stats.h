@@ -24,6 +24,12 @@ namespace openflow {
  *
  */
 class cofmsg_group_stats_request : public cofmsg_stats_request {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_GROUP_STATS_REQUEST;
+
 public:
   /**
    *
@@ -103,6 +109,12 @@ private:
  *
  */
 class cofmsg_group_stats_reply : public cofmsg_stats_reply {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_GROUP_STATS_REPLY;
+
 public:
   /**
    *
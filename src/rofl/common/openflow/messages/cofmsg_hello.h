@@ -18,6 +18,12 @@ namespace openflow {
  *
  */
 class cofmsg_hello : public cofmsg {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_HELLO;
+
 public:
   /**
    *
@@ -32,12 +38,17 @@ public:
                const rofl::openflow::cofhelloelems &helloelems =
                    rofl::openflow::cofhelloelems())
       : cofmsg(version, rofl::openflow::OFPT_HELLO, xid),
-        helloelems(helloelems){};
+        helloelems(helloelems) {
+    set_tag(MSG_TAG);
+  };
 
   /**
    *
    */
-  cofmsg_hello(const cofmsg_hello &msg) { *this = msg; };
+  cofmsg_hello(const cofmsg_hello &msg) {
+    set_tag(MSG_TAG);
+    *this = msg;
+  };
 
   /**
    *
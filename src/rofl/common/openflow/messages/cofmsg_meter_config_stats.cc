@@ -13,6 +13,7 @@ cofmsg_meter_config_stats_request::cofmsg_meter_config_stats_request(
     : cofmsg_stats_request(version, xid, rofl::openflow::OFPMP_METER_CONFIG,
                            stats_flags),
       meter_config(version) {
+  set_tag(MSG_TAG);
   meter_config.set_meter_id(meter_id);
 }
 
@@ -22,11 +23,13 @@ cofmsg_meter_config_stats_request::cofmsg_meter_config_stats_request(
     : cofmsg_stats_request(version, xid, rofl::openflow::OFPMP_METER_CONFIG,
                            stats_flags),
       meter_config(meter_config) {
+  set_tag(MSG_TAG);
   this->meter_config.set_version(version);
 }
 
 cofmsg_meter_config_stats_request::cofmsg_meter_config_stats_request(
     const cofmsg_meter_config_stats_request &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
@@ -109,11 +112,13 @@ cofmsg_meter_config_stats_reply::cofmsg_meter_config_stats_reply(
     : cofmsg_stats_reply(version, xid, rofl::openflow::OFPMP_METER_CONFIG,
                          stats_flags),
       array(array) {
+  set_tag(MSG_TAG);
   this->array.set_version(version);
 }
 
 cofmsg_meter_config_stats_reply::cofmsg_meter_config_stats_reply(
     const cofmsg_meter_config_stats_reply &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
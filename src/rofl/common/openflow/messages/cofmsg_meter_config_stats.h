@@ -25,6 +25,12 @@ namespace openflow {
  *
  */
 class cofmsg_meter_config_stats_request : public cofmsg_stats_request {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_METER_CONFIG_STATS_REQUEST;
+
 public:
   /**
    *
@@ -112,6 +118,12 @@ private:
  *
  */
 class cofmsg_meter_config_stats_reply : public cofmsg_stats_reply {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_METER_CONFIG_STATS_REPLY;
+
 public:
   /**
    *
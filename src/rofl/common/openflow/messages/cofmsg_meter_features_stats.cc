@@ -11,10 +11,13 @@ cofmsg_meter_features_stats_request::~cofmsg_meter_features_stats_request() {}
 cofmsg_meter_features_stats_request::cofmsg_meter_features_stats_request(
     uint8_t version, uint32_t xid, uint16_t stats_flags)
     : cofmsg_stats_request(version, xid, rofl::openflow::OFPMP_METER_FEATURES,
-                           stats_flags) {}
+                           stats_flags) {
+  set_tag(MSG_TAG);
+}
 
 cofmsg_meter_features_stats_request::cofmsg_meter_features_stats_request(
     const cofmsg_meter_features_stats_request &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
@@ -74,11 +77,13 @@ cofmsg_meter_features_stats_reply::cofmsg_meter_features_stats_reply(
     : cofmsg_stats_reply(version, xid, rofl::openflow::OFPMP_METER_FEATURES,
                          stats_flags),
       meter_features(meter_features) {
+  set_tag(MSG_TAG);
   this->meter_features.set_version(version);
 }
 
 cofmsg_meter_features_stats_reply::cofmsg_meter_features_stats_reply(
     const cofmsg_meter_features_stats_reply &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
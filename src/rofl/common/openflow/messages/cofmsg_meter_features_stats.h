@@ -26,6 +26,12 @@ namespace openflow {
  *
  */
 class cofmsg_meter_features_stats_request : public cofmsg_stats_request {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_METER_FEATURES_STATS_REQUEST;
+
 public:
   /**
    *
@@ -86,6 +92,12 @@ public:
  *
  */
 class cofmsg_meter_features_stats_reply : public cofmsg_stats_reply {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_METER_FEATURES_STATS_REPLY;
+
 public:
   /**
    *
@@ -13,10 +13,14 @@ cofmsg_meter_mod::cofmsg_meter_mod(
     uint32_t meter_id, const rofl::openflow::cofmeter_bands &meter_bands)
     : cofmsg(version, rofl::openflow::OFPT_METER_MOD, xid), command(command),
       flags(flags), meter_id(meter_id), meter_bands(meter_bands) {
+  set_tag(MSG_TAG);
   this->meter_bands.set_version(version);
 }
 
-cofmsg_meter_mod::cofmsg_meter_mod(const cofmsg_meter_mod &msg) { *this = msg; }
+cofmsg_meter_mod::cofmsg_meter_mod(const cofmsg_meter_mod &msg) {
+  set_tag(MSG_TAG);
+  *this = msg;
+}
 
 cofmsg_meter_mod &cofmsg_meter_mod::operator=(const cofmsg_meter_mod &msg) {
   if (this == &msg)
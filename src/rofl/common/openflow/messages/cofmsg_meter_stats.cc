@@ -14,6 +14,7 @@ cofmsg_meter_stats_request::cofmsg_meter_stats_request(uint8_t version,
                                                        uint32_t meter_id)
     : cofmsg_stats_request(version, xid, rofl::openflow::OFPMP_METER,
                            stats_flags) {
+  set_tag(MSG_TAG);
   meter_stats.set_version(version);
   meter_stats.set_meter_id(meter_id);
 }
@@ -24,11 +25,13 @@ cofmsg_meter_stats_request::cofmsg_meter_stats_request(
     : cofmsg_stats_request(version, xid, rofl::openflow::OFPMP_METER,
                            stats_flags),
       meter_stats(meter_stats) {
+  set_tag(MSG_TAG);
   this->meter_stats.set_version(version);
 }
 
 cofmsg_meter_stats_request::cofmsg_meter_stats_request(
     const cofmsg_meter_stats_request &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
@@ -109,11 +112,13 @@ cofmsg_meter_stats_reply::cofmsg_meter_stats_reply(
     : cofmsg_stats_reply(version, xid, rofl::openflow::OFPMP_METER,
                          stats_flags),
       meterstatsarray(meterstatsarray) {
+  set_tag(MSG_TAG);
   this->meterstatsarray.set_version(version);
 }
 
 cofmsg_meter_stats_reply::cofmsg_meter_stats_reply(
     const cofmsg_meter_stats_reply &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
@@ -26,6 +26,12 @@ namespace openflow {
  *
  */
 class cofmsg_meter_stats_request : public cofmsg_stats_request {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_METER_STATS_REQUEST;
+
 public:
   /**
    *
@@ -111,6 +117,12 @@ private:
  *
  */
 class cofmsg_meter_stats_reply : public cofmsg_stats_reply {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_METER_STATS_REPLY;
+
 public:
   /**
    *
@@ -2,6 +2,9 @@
 
 using namespace rofl::openflow;
 
+/*static*/ rofl::cmempool
+    cofmsg_packet_in::pool("cofmsg_packet_in", sizeof(cofmsg_packet_in));
+
 /*static*/
 const size_t rofl::openflow::cofmsg_packet_in::OFP10_PACKET_IN_STATIC_HDR_LEN =
     (sizeof(struct rofl::openflow10::ofp_packet_in) - 2); /* =18 */
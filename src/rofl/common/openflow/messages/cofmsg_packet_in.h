@@ -8,6 +8,7 @@
 #ifndef COFMSG_PACKET_IN_H_
 #define COFMSG_PACKET_IN_H_ 1
 
+#include "rofl/common/cmempool.hpp"
 #include "rofl/common/cpacket.h"
 #include "rofl/common/openflow/cofmatch.h"
 #include "rofl/common/openflow/messages/cofmsg.h"
@@ -19,6 +20,25 @@ namespace openflow {
  *
  */
 class cofmsg_packet_in : public cofmsg {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_PACKET_IN;
+
+public:
+  /**
+   * @brief	Allocates instances from a per-thread slab pool
+   */
+  static void *operator new(size_t size) { return pool.allocate(size); };
+
+  /**
+   * @brief	Returns instances to the per-thread slab pool
+   */
+  static void operator delete(void *mem, size_t size) {
+    pool.release(mem, size);
+  };
+
 public:
   /**
    *
@@ -38,13 +58,18 @@ public:
         buffer_id(buffer_id), total_len(total_len), in_port(in_port),
         reason(reason), table_id(table_id), cookie(cookie), match(match),
         packet(data, datalen) {
+    set_tag(MSG_TAG);
     this->match.set_version(version);
+    this->match.set_lazy();
   };
 
   /**
    *
    */
-  cofmsg_packet_in(const cofmsg_packet_in &msg) { *this = msg; };
+  cofmsg_packet_in(const cofmsg_packet_in &msg) {
+    set_tag(MSG_TAG);
+    *this = msg;
+  };
 
   /**
    *
@@ -273,6 +298,8 @@ private:
   static const size_t OFP10_PACKET_IN_STATIC_HDR_LEN;
   static const size_t OFP12_PACKET_IN_STATIC_HDR_LEN;
   static const size_t OFP13_PACKET_IN_STATIC_HDR_LEN;
+
+  static rofl::cmempool pool;
 };
 
 } // end of namespace openflow
@@ -2,6 +2,9 @@
 
 using namespace rofl::openflow;
 
+/*static*/ rofl::cmempool
+    cofmsg_packet_out::pool("cofmsg_packet_out", sizeof(cofmsg_packet_out));
+
 size_t cofmsg_packet_out::length() const {
   switch (get_version()) {
   case rofl::openflow10::OFP_VERSION: {
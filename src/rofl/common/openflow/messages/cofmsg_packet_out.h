@@ -8,6 +8,7 @@
 #ifndef COFMSG_PACKET_OUT_H_
 #define COFMSG_PACKET_OUT_H_ 1
 
+#include "rofl/common/cmempool.hpp"
 #include "rofl/common/cpacket.h"
 #include "rofl/common/openflow/cofactions.h"
 #include "rofl/common/openflow/messages/cofmsg.h"
@@ -19,6 +20,25 @@ namespace openflow {
  *
  */
 class cofmsg_packet_out : public cofmsg {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_PACKET_OUT;
+
+public:
+  /**
+   * @brief	Allocates instances from a per-thread slab pool
+   */
+  static void *operator new(size_t size) { return pool.allocate(size); };
+
+  /**
+   * @brief	Returns instances to the per-thread slab pool
+   */
+  static void operator delete(void *mem, size_t size) {
+    pool.release(mem, size);
+  };
+
 public:
   /**
    *
@@ -35,12 +55,17 @@ public:
       uint8_t *data = (uint8_t *)0, size_t datalen = 0)
       : cofmsg(version, rofl::openflow::OFPT_PACKET_OUT, xid),
         buffer_id(buffer_id), in_port(in_port), actions(actions),
-        packet(data, datalen){};
+        packet(data, datalen) {
+    set_tag(MSG_TAG);
+  };
 
   /**
    *
    */
-  cofmsg_packet_out(const cofmsg_packet_out &msg) { *this = msg; };
+  cofmsg_packet_out(const cofmsg_packet_out &msg) {
+    set_tag(MSG_TAG);
+    *this = msg;
+  };
 
   /**
    *
@@ -142,6 +167,8 @@ private:
   uint32_t in_port;
   rofl::openflow::cofactions actions;
   rofl::cpacket packet;
+
+  static rofl::cmempool pool;
 };
 
 } // end of namespace openflow
@@ -11,10 +11,13 @@ cofmsg_port_desc_stats_request::~cofmsg_port_desc_stats_request() {}
 cofmsg_port_desc_stats_request::cofmsg_port_desc_stats_request(
     uint8_t version, uint32_t xid, uint16_t stats_flags)
     : cofmsg_stats_request(version, xid, rofl::openflow::OFPMP_PORT_DESC,
-                           stats_flags) {}
+                           stats_flags) {
+  set_tag(MSG_TAG);
+}
 
 cofmsg_port_desc_stats_request::cofmsg_port_desc_stats_request(
     const cofmsg_port_desc_stats_request &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
@@ -78,11 +81,13 @@ cofmsg_port_desc_stats_reply::cofmsg_port_desc_stats_reply(
     : cofmsg_stats_reply(version, xid, rofl::openflow::OFPMP_PORT_DESC,
                          stats_flags),
       ports(ports) {
+  set_tag(MSG_TAG);
   this->ports.set_version(version);
 }
 
 cofmsg_port_desc_stats_reply::cofmsg_port_desc_stats_reply(
     const cofmsg_port_desc_stats_reply &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
@@ -23,6 +23,12 @@ namespace openflow {
  *
  */
 class cofmsg_port_desc_stats_request : public cofmsg_stats_request {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_PORT_DESC_STATS_REQUEST;
+
 public:
   /**
    *
@@ -82,6 +88,12 @@ public:
  *
  */
 class cofmsg_port_desc_stats_reply : public cofmsg_stats_reply {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_PORT_DESC_STATS_REPLY;
+
 public:
   /**
    *
@@ -15,6 +15,7 @@ cofmsg_port_mod::cofmsg_port_mod(uint8_t version, uint32_t xid, uint32_t portno,
     : cofmsg(version, rofl::openflow::OFPT_PORT_MOD /*=16*/, xid),
       portno(portno), lladdr(lladdr), config(config), mask(mask),
       advertise(advertise) {
+  set_tag(MSG_TAG);
   switch (version) {
   case openflow10::OFP_VERSION: {
     set_type(rofl::openflow10::OFPT_PORT_MOD /*=15*/);
@@ -24,7 +25,10 @@ cofmsg_port_mod::cofmsg_port_mod(uint8_t version, uint32_t xid, uint32_t portno,
   }
 }
 
-cofmsg_port_mod::cofmsg_port_mod(const cofmsg_port_mod &msg) { *this = msg; }
+cofmsg_port_mod::cofmsg_port_mod(const cofmsg_port_mod &msg) {
+  set_tag(MSG_TAG);
+  *this = msg;
+}
 
 cofmsg_port_mod &cofmsg_port_mod::operator=(const cofmsg_port_mod &msg) {
   if (this == &msg)
@@ -23,6 +23,12 @@ namespace openflow {
  *
  */
 class cofmsg_port_mod : public cofmsg {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_PORT_MOD;
+
 public:
   /**
    *
@@ -14,11 +14,13 @@ cofmsg_port_stats_request::cofmsg_port_stats_request(
     : cofmsg_stats_request(version, xid, rofl::openflow::OFPMP_PORT_STATS,
                            flags),
       port_stats(port_stats) {
+  set_tag(MSG_TAG);
   this->port_stats.set_version(version);
 }
 
 cofmsg_port_stats_request::cofmsg_port_stats_request(
     const cofmsg_port_stats_request &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
@@ -128,11 +130,13 @@ cofmsg_port_stats_reply::cofmsg_port_stats_reply(
     : cofmsg_stats_reply(version, xid, rofl::openflow::OFPMP_PORT_STATS,
                          stats_flags),
       portstatsarray(portstatsarray) {
+  set_tag(MSG_TAG);
   this->portstatsarray.set_version(version);
 }
 
 cofmsg_port_stats_reply::cofmsg_port_stats_reply(
     const cofmsg_port_stats_reply &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
@@ -23,6 +23,12 @@ namespace openflow {
  *
  */
 class cofmsg_port_stats_request : public cofmsg_stats_request {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_PORT_STATS_REQUEST;
+
 public:
   /**
    *
@@ -102,6 +108,12 @@ private:
  *
  */
 class cofmsg_port_stats_reply : public cofmsg_stats_reply {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_PORT_STATS_REPLY;
+
 public:
   /**
    *
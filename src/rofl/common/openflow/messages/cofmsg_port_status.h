@@ -18,6 +18,12 @@ namespace openflow {
  *
  */
 class cofmsg_port_status : public cofmsg {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_PORT_STATUS;
+
 public:
   /**
    *
@@ -33,13 +39,17 @@ public:
       const rofl::openflow::cofport &port = rofl::openflow::cofport())
       : cofmsg(version, rofl::openflow::OFPT_PORT_STATUS, xid), reason(reason),
         port(port) {
+    set_tag(MSG_TAG);
     this->port.set_version(version);
   };
 
   /**
    *
    */
-  cofmsg_port_status(const cofmsg_port_status &msg) { *this = msg; };
+  cofmsg_port_status(const cofmsg_port_status &msg) {
+    set_tag(MSG_TAG);
+    *this = msg;
+  };
 
   /**
    *
@@ -13,6 +13,7 @@ cofmsg_queue_get_config_request::cofmsg_queue_get_config_request(
     : cofmsg(version, rofl::openflow::OFPT_QUEUE_GET_CONFIG_REQUEST /*=22*/,
              xid),
       portno(portno) {
+  set_tag(MSG_TAG);
   switch (version) {
   case rofl::openflow10::OFP_VERSION: {
     set_type(rofl::openflow10::OFPT_QUEUE_GET_CONFIG_REQUEST); /*=20*/
@@ -24,6 +25,7 @@ cofmsg_queue_get_config_request::cofmsg_queue_get_config_request(
 
 cofmsg_queue_get_config_request::cofmsg_queue_get_config_request(
     const cofmsg_queue_get_config_request &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
@@ -119,6 +121,7 @@ cofmsg_queue_get_config_reply::cofmsg_queue_get_config_reply(
     const rofl::openflow::cofpacket_queues &queues)
     : cofmsg(version, rofl::openflow::OFPT_QUEUE_GET_CONFIG_REPLY /*=23*/, xid),
       portno(portno), queues(queues) {
+  set_tag(MSG_TAG);
   switch (version) {
   case rofl::openflow10::OFP_VERSION: {
     set_type(rofl::openflow10::OFPT_QUEUE_GET_CONFIG_REPLY); /*=21*/
@@ -130,6 +133,7 @@ cofmsg_queue_get_config_reply::cofmsg_queue_get_config_reply(
 
 cofmsg_queue_get_config_reply::cofmsg_queue_get_config_reply(
     const cofmsg_queue_get_config_reply &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
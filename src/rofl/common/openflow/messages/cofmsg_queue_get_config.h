@@ -24,6 +24,12 @@ namespace openflow {
  *
  */
 class cofmsg_queue_get_config_request : public cofmsg {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_QUEUE_GET_CONFIG_REQUEST;
+
 public:
   /**
    *
@@ -99,6 +105,12 @@ private:
  *
  */
 class cofmsg_queue_get_config_reply : public cofmsg {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_QUEUE_GET_CONFIG_REPLY;
+
 public:
   /**
    *
@@ -14,11 +14,13 @@ cofmsg_queue_stats_request::cofmsg_queue_stats_request(
     : cofmsg_stats_request(version, xid, rofl::openflow::OFPMP_QUEUE,
                            stats_flags),
       queue_stats(queue_stats) {
+  set_tag(MSG_TAG);
   this->queue_stats.set_version(version);
 }
 
 cofmsg_queue_stats_request::cofmsg_queue_stats_request(
     const cofmsg_queue_stats_request &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
@@ -128,11 +130,13 @@ cofmsg_queue_stats_reply::cofmsg_queue_stats_reply(
     : cofmsg_stats_reply(version, xid, rofl::openflow::OFPMP_QUEUE,
                          stats_flags),
       queuestatsarray(queuestatsarray) {
+  set_tag(MSG_TAG);
   this->queuestatsarray.set_version(version);
 }
 
 cofmsg_queue_stats_reply::cofmsg_queue_stats_reply(
     const cofmsg_queue_stats_reply &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
@@ -11,10 +11,12 @@ cofmsg_role_request::~cofmsg_role_request() {}
 cofmsg_role_request::cofmsg_role_request(uint8_t version, uint32_t xid,
                                          const rofl::openflow::cofrole &role)
     : cofmsg(version, rofl::openflow::OFPT_ROLE_REQUEST, xid), role(role) {
+  set_tag(MSG_TAG);
   this->role.set_version(version);
 }
 
 cofmsg_role_request::cofmsg_role_request(const cofmsg_role_request &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
@@ -93,10 +95,12 @@ cofmsg_role_reply::~cofmsg_role_reply() {}
 cofmsg_role_reply::cofmsg_role_reply(uint8_t version, uint32_t xid,
                                      const rofl::openflow::cofrole &role)
     : cofmsg(version, rofl::openflow::OFPT_ROLE_REPLY, xid), role(role) {
+  set_tag(MSG_TAG);
   this->role.set_version(version);
 }
 
 cofmsg_role_reply::cofmsg_role_reply(const cofmsg_role_reply &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
@@ -23,6 +23,12 @@ namespace openflow {
  *
  */
 class cofmsg_role_request : public cofmsg {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_ROLE_REQUEST;
+
 public:
   /**
    *
@@ -97,6 +103,12 @@ private:
  *
  */
 class cofmsg_role_reply : public cofmsg {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_ROLE_REPLY;
+
 public:
   /**
    *
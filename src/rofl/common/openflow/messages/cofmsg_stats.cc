@@ -13,6 +13,7 @@ cofmsg_stats_request::cofmsg_stats_request(uint8_t version, uint32_t xid,
                                            uint16_t stats_flags)
     : cofmsg(version, rofl::openflow13::OFPT_MULTIPART_REQUEST, xid),
       stats_type(stats_type), stats_flags(stats_flags) {
+  set_tag(MSG_TAG);
   switch (version) {
   case rofl::openflow10::OFP_VERSION: {
     set_type(rofl::openflow10::OFPT_STATS_REQUEST);
@@ -24,6 +25,7 @@ cofmsg_stats_request::cofmsg_stats_request(uint8_t version, uint32_t xid,
 }
 
 cofmsg_stats_request::cofmsg_stats_request(const cofmsg_stats_request &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
@@ -117,6 +119,7 @@ cofmsg_stats_reply::cofmsg_stats_reply(uint8_t version, uint32_t xid,
                                        uint16_t stats_flags)
     : cofmsg(version, rofl::openflow::OFPT_MULTIPART_REPLY, xid),
       stats_type(stats_type), stats_flags(stats_flags) {
+  set_tag(MSG_TAG);
   switch (version) {
   case rofl::openflow10::OFP_VERSION: {
     set_type(rofl::openflow10::OFPT_STATS_REPLY);
@@ -128,6 +131,7 @@ cofmsg_stats_reply::cofmsg_stats_reply(uint8_t version, uint32_t xid,
 }
 
 cofmsg_stats_reply::cofmsg_stats_reply(const cofmsg_stats_reply &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
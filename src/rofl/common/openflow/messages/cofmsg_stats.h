@@ -19,6 +19,12 @@ namespace rofl {
 namespace openflow {
 
 class cofmsg_stats_request : public cofmsg {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_STATS_REQUEST;
+
 public:
   /**
    *
@@ -121,6 +127,12 @@ private:
 };
 
 class cofmsg_stats_reply : public cofmsg {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_STATS_REPLY;
+
 public:
   /**
    *
@@ -14,11 +14,13 @@ cofmsg_table_features_stats_request::cofmsg_table_features_stats_request(
     : cofmsg_stats_request(version, xid, rofl::openflow::OFPMP_TABLE_FEATURES,
                            stats_flags),
       tables(tables) {
+  set_tag(MSG_TAG);
   this->tables.set_version(version);
 }
 
 cofmsg_table_features_stats_request::cofmsg_table_features_stats_request(
     const cofmsg_table_features_stats_request &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
@@ -102,11 +104,13 @@ cofmsg_table_features_stats_reply::cofmsg_table_features_stats_reply(
     : cofmsg_stats_reply(version, xid, rofl::openflow::OFPMP_TABLE_FEATURES,
                          stats_flags),
       tables(tables) {
+  set_tag(MSG_TAG);
   this->tables.set_version(version);
 }
 
 cofmsg_table_features_stats_reply::cofmsg_table_features_stats_reply(
     const cofmsg_table_features_stats_reply &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
@@ -23,6 +23,12 @@ namespace openflow {
  *
  */
 class cofmsg_table_features_stats_request : public cofmsg_stats_request {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_TABLE_FEATURES_STATS_REQUEST;
+
 public:
   /**
    *
@@ -99,6 +105,12 @@ private:
  *
  */
 class cofmsg_table_features_stats_reply : public cofmsg_stats_reply {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_TABLE_FEATURES_STATS_REPLY;
+
 public:
   /**
    *
@@ -11,9 +11,14 @@ cofmsg_table_mod::~cofmsg_table_mod() {}
 cofmsg_table_mod::cofmsg_table_mod(uint8_t version, uint32_t xid,
                                    uint8_t table_id, uint32_t config)
     : cofmsg(version, rofl::openflow::OFPT_TABLE_MOD, xid), table_id(table_id),
-      config(config) {}
+      config(config) {
+  set_tag(MSG_TAG);
+}
 
-cofmsg_table_mod::cofmsg_table_mod(const cofmsg_table_mod &msg) { *this = msg; }
+cofmsg_table_mod::cofmsg_table_mod(const cofmsg_table_mod &msg) {
+  set_tag(MSG_TAG);
+  *this = msg;
+}
 
 cofmsg_table_mod &cofmsg_table_mod::operator=(const cofmsg_table_mod &msg) {
   if (this == &msg)
@@ -22,6 +22,12 @@ namespace openflow {
  *
  */
 class cofmsg_table_mod : public cofmsg {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_TABLE_MOD;
+
 public:
   /**
    *
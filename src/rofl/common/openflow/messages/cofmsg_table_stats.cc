@@ -12,10 +12,13 @@ cofmsg_table_stats_request::cofmsg_table_stats_request(uint8_t version,
                                                        uint32_t xid,
                                                        uint16_t stats_flags)
     : cofmsg_stats_request(version, xid, rofl::openflow::OFPMP_TABLE,
-                           stats_flags) {}
+                           stats_flags) {
+  set_tag(MSG_TAG);
+}
 
 cofmsg_table_stats_request::cofmsg_table_stats_request(
     const cofmsg_table_stats_request &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
@@ -90,11 +93,13 @@ cofmsg_table_stats_reply::cofmsg_table_stats_reply(
     const rofl::openflow::coftablestatsarray &tablestatsarray)
     : cofmsg_stats_reply(version, xid, rofl::openflow::OFPMP_TABLE, flags),
       tablestatsarray(tablestatsarray) {
+  set_tag(MSG_TAG);
   this->tablestatsarray.set_version(version);
 }
 
 cofmsg_table_stats_reply::cofmsg_table_stats_reply(
     const cofmsg_table_stats_reply &msg) {
+  set_tag(MSG_TAG);
   *this = msg;
 }
 
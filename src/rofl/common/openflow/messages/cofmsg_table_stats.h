@@ -24,6 +24,12 @@ namespace openflow {
  *
  */
 class cofmsg_table_stats_request : public cofmsg_stats_request {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_TABLE_STATS_REQUEST;
+
 public:
   /**
    *
@@ -82,6 +88,12 @@ public:
  *
  */
 class cofmsg_table_stats_reply : public cofmsg_stats_reply {
+public:
+  /**
+   *
+   */
+  static const msg_tag_t MSG_TAG = MSG_TAG_TABLE_STATS_REPLY;
+
 public:
   /**
    *
@@ -0,0 +1,362 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/*
+ * cofmsg_view.cc
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "rofl/common/openflow/messages/cofmsg_view.h"
+
+using namespace rofl::openflow;
+
+cofmsg_view::cofmsg_view(std::shared_ptr<rofl::cmemory> mem, size_t offset,
+                         size_t buflen)
+    : mem(mem), buf(mem->somem() + offset), buflen(buflen) {
+  if ((offset + buflen > mem->length()) ||
+      (buflen < sizeof(struct rofl::openflow::ofp_header)) ||
+      (get_length() != buflen))
+    throw eBadRequestBadLen("eBadRequestBadLen", __FILE__, __FUNCTION__,
+                            __LINE__);
+}
+
+cofmsg_packet_in_view::cofmsg_packet_in_view(const cofmsg_view &view)
+    : cofmsg_view(view) {
+  if (get_type() != rofl::openflow::OFPT_PACKET_IN)
+    throw eBadRequestBadType("eBadRequestBadType", __FILE__, __FUNCTION__,
+                             __LINE__);
+
+  switch (get_version()) {
+  case rofl::openflow10::OFP_VERSION: {
+    if (buflen < (size_t)rofl::openflow10::OFP_PACKET_IN_STATIC_HDR_LEN)
+      throw eBadRequestBadLen("eBadRequestBadLen", __FILE__, __FUNCTION__,
+                              __LINE__);
+  } break;
+  case rofl::openflow12::OFP_VERSION: {
+    if (buflen < sizeof(struct rofl::openflow12::ofp_packet_in))
+      throw eBadRequestBadLen("eBadRequestBadLen", __FILE__, __FUNCTION__,
+                              __LINE__);
+    if (data_offset() > buflen)
+      throw eBadRequestBadLen("eBadRequestBadLen", __FILE__, __FUNCTION__,
+                              __LINE__);
+  } break;
+  case rofl::openflow13::OFP_VERSION: {
+    if (buflen < sizeof(struct rofl::openflow13::ofp_packet_in))
+      throw eBadRequestBadLen("eBadRequestBadLen", __FILE__, __FUNCTION__,
+                              __LINE__);
+    if (data_offset() > buflen)
+      throw eBadRequestBadLen("eBadRequestBadLen", __FILE__, __FUNCTION__,
+                              __LINE__);
+  } break;
+  default: {
+    throw eBadRequestBadVersion("eBadRequestBadVersion", __FILE__,
+                                __FUNCTION__, __LINE__);
+  };
+  }
+}
+
+uint32_t cofmsg_packet_in_view::get_buffer_id() const {
+  /* buffer_id and total_len share offsets in all versions */
+  return be32toh(((struct rofl::openflow13::ofp_packet_in *)buf)->buffer_id);
+}
+
+uint16_t cofmsg_packet_in_view::get_total_len() const {
+  return be16toh(((struct rofl::openflow13::ofp_packet_in *)buf)->total_len);
+}
+
+uint8_t cofmsg_packet_in_view::get_reason() const {
+  switch (get_version()) {
+  case rofl::openflow10::OFP_VERSION: {
+    return ((struct rofl::openflow10::ofp_packet_in *)buf)->reason;
+  } break;
+  default: { return ((struct rofl::openflow13::ofp_packet_in *)buf)->reason; };
+  }
+}
+
+uint8_t cofmsg_packet_in_view::get_table_id() const {
+  switch (get_version()) {
+  case rofl::openflow10::OFP_VERSION: {
+    return 0;
+  } break;
+  default: {
+    return ((struct rofl::openflow13::ofp_packet_in *)buf)->table_id;
+  };
+  }
+}
+
+uint64_t cofmsg_packet_in_view::get_cookie() const {
+  switch (get_version()) {
+  case rofl::openflow13::OFP_VERSION: {
+    return be64toh(((struct rofl::openflow13::ofp_packet_in *)buf)->cookie);
+  } break;
+  default: { return 0; };
+  }
+}
+
+uint32_t cofmsg_packet_in_view::get_in_port() const {
+  if (rofl::openflow10::OFP_VERSION == get_version()) {
+    return be16toh(((struct rofl::openflow10::ofp_packet_in *)buf)->in_port);
+  }
+
+  /* walk along OXM TLVs up to in-port */
+  struct rofl::openflow13::ofp_match *match =
+      (struct rofl::openflow13::ofp_match *)(buf + match_offset());
+  size_t offset = 2 * sizeof(uint16_t);
+  size_t matchlen = be16toh(match->length);
+  while (offset + sizeof(uint32_t) <= matchlen) {
+    uint32_t oxm = be32toh(*(uint32_t *)((uint8_t *)match + offset));
+    size_t oxmlen = sizeof(uint32_t) + (oxm & 0xff);
+    if (offset + oxmlen > matchlen)
+      break;
+    if (rofl::openflow::OXM_TLV_BASIC_IN_PORT == oxm) {
+      return be32toh(*(uint32_t *)((uint8_t *)match + offset + sizeof(oxm)));
+    }
+    offset += oxmlen;
+  }
+  throw eOxmNotFound("cofmsg_packet_in_view::get_in_port() not found");
+}
+
+rofl::openflow::cofmatch cofmsg_packet_in_view::get_match() const {
+  rofl::openflow::cofmatch match;
+  match.set_version(get_version());
+  match.set_lazy();
+  switch (get_version()) {
+  case rofl::openflow10::OFP_VERSION: {
+    match.set_in_port(get_in_port());
+  } break;
+  default: {
+    struct rofl::openflow13::ofp_match *hdr =
+        (struct rofl::openflow13::ofp_match *)(buf + match_offset());
+    match.unpack((uint8_t *)hdr, be16toh(hdr->length));
+  };
+  }
+  return match;
+}
+
+const uint8_t *cofmsg_packet_in_view::get_data() const {
+  return buf + data_offset();
+}
+
+size_t cofmsg_packet_in_view::get_datalen() const {
+  return buflen - data_offset();
+}
+
+cofmsg_packet_in *cofmsg_packet_in_view::materialize() const {
+  cofmsg_packet_in *msg = new cofmsg_packet_in();
+  try {
+    msg->unpack(buf, buflen);
+  } catch (...) {
+    delete msg;
+    throw;
+  }
+  return msg;
+}
+
+size_t cofmsg_packet_in_view::match_offset() const {
+  switch (get_version()) {
+  case rofl::openflow12::OFP_VERSION: {
+    return rofl::openflow12::OFP_PACKET_IN_STATIC_HDR_LEN;
+  } break;
+  default: { return rofl::openflow13::OFP_PACKET_IN_STATIC_HDR_LEN; };
+  }
+}
+
+size_t cofmsg_packet_in_view::data_offset() const {
+  switch (get_version()) {
+  case rofl::openflow10::OFP_VERSION: {
+    return rofl::openflow10::OFP_PACKET_IN_STATIC_HDR_LEN;
+  } break;
+  default: {
+    struct rofl::openflow13::ofp_match *match =
+        (struct rofl::openflow13::ofp_match *)(buf + match_offset());
+    /* match padded to multiple of 8 bytes, followed by 2 bytes padding */
+    size_t matchlen = (be16toh(match->length) + 7) & ~7;
+    return match_offset() + matchlen + 2;
+  };
+  }
+}
+
+cofmsg_flow_removed_view::cofmsg_flow_removed_view(const cofmsg_view &view)
+    : cofmsg_view(view) {
+  if (get_type() != rofl::openflow::OFPT_FLOW_REMOVED)
+    throw eBadRequestBadType("eBadRequestBadType", __FILE__, __FUNCTION__,
+                             __LINE__);
+
+  switch (get_version()) {
+  case rofl::openflow10::OFP_VERSION: {
+    if (buflen < sizeof(struct rofl::openflow10::ofp_flow_removed))
+      throw eBadRequestBadLen("eBadRequestBadLen", __FILE__, __FUNCTION__,
+                              __LINE__);
+  } break;
+  case rofl::openflow12::OFP_VERSION:
+  case rofl::openflow13::OFP_VERSION: {
+    struct rofl::openflow13::ofp_flow_removed *hdr =
+        (struct rofl::openflow13::ofp_flow_removed *)buf;
+    if (buflen < sizeof(struct rofl::openflow13::ofp_flow_removed))
+      throw eBadRequestBadLen("eBadRequestBadLen", __FILE__, __FUNCTION__,
+                              __LINE__);
+    if (be16toh(hdr->match.length) >
+        buflen - offsetof(struct rofl::openflow13::ofp_flow_removed, match))
+      throw eBadRequestBadLen("eBadRequestBadLen", __FILE__, __FUNCTION__,
+                              __LINE__);
+  } break;
+  default: {
+    throw eBadRequestBadVersion("eBadRequestBadVersion", __FILE__,
+                                __FUNCTION__, __LINE__);
+  };
+  }
+}
+
+uint64_t cofmsg_flow_removed_view::get_cookie() const {
+  switch (get_version()) {
+  case rofl::openflow10::OFP_VERSION: {
+    return be64toh(((struct rofl::openflow10::ofp_flow_removed *)buf)->cookie);
+  } break;
+  default: {
+    return be64toh(((struct rofl::openflow13::ofp_flow_removed *)buf)->cookie);
+  };
+  }
+}
+
+uint16_t cofmsg_flow_removed_view::get_priority() const {
+  switch (get_version()) {
+  case rofl::openflow10::OFP_VERSION: {
+    return be16toh(
+        ((struct rofl::openflow10::ofp_flow_removed *)buf)->priority);
+  } break;
+  default: {
+    return be16toh(
+        ((struct rofl::openflow13::ofp_flow_removed *)buf)->priority);
+  };
+  }
+}
+
+uint8_t cofmsg_flow_removed_view::get_reason() const {
+  switch (get_version()) {
+  case rofl::openflow10::OFP_VERSION: {
+    return ((struct rofl::openflow10::ofp_flow_removed *)buf)->reason;
+  } break;
+  default: {
+    return ((struct rofl::openflow13::ofp_flow_removed *)buf)->reason;
+  };
+  }
+}
+
+uint8_t cofmsg_flow_removed_view::get_table_id() const {
+  switch (get_version()) {
+  case rofl::openflow10::OFP_VERSION: {
+    return 0;
+  } break;
+  default: {
+    return ((struct rofl::openflow13::ofp_flow_removed *)buf)->table_id;
+  };
+  }
+}
+
+uint32_t cofmsg_flow_removed_view::get_duration_sec() const {
+  switch (get_version()) {
+  case rofl::openflow10::OFP_VERSION: {
+    return be32toh(
+        ((struct rofl::openflow10::ofp_flow_removed *)buf)->duration_sec);
+  } break;
+  default: {
+    return be32toh(
+        ((struct rofl::openflow13::ofp_flow_removed *)buf)->duration_sec);
+  };
+  }
+}
+
+uint32_t cofmsg_flow_removed_view::get_duration_nsec() const {
+  switch (get_version()) {
+  case rofl::openflow10::OFP_VERSION: {
+    return be32toh(
+        ((struct rofl::openflow10::ofp_flow_removed *)buf)->duration_nsec);
+  } break;
+  default: {
+    return be32toh(
+        ((struct rofl::openflow13::ofp_flow_removed *)buf)->duration_nsec);
+  };
+  }
+}
+
+uint16_t cofmsg_flow_removed_view::get_idle_timeout() const {
+  switch (get_version()) {
+  case rofl::openflow10::OFP_VERSION: {
+    return be16toh(
+        ((struct rofl::openflow10::ofp_flow_removed *)buf)->idle_timeout);
+  } break;
+  default: {
+    return be16toh(
+        ((struct rofl::openflow13::ofp_flow_removed *)buf)->idle_timeout);
+  };
+  }
+}
+
+uint16_t cofmsg_flow_removed_view::get_hard_timeout() const {
+  switch (get_version()) {
+  case rofl::openflow10::OFP_VERSION: {
+    return 0;
+  } break;
+  default: {
+    return be16toh(
+        ((struct rofl::openflow13::ofp_flow_removed *)buf)->hard_timeout);
+  };
+  }
+}
+
+uint64_t cofmsg_flow_removed_view::get_packet_count() const {
+  switch (get_version()) {
+  case rofl::openflow10::OFP_VERSION: {
+    return be64toh(
+        ((struct rofl::openflow10::ofp_flow_removed *)buf)->packet_count);
+  } break;
+  default: {
+    return be64toh(
+        ((struct rofl::openflow13::ofp_flow_removed *)buf)->packet_count);
+  };
+  }
+}
+
+uint64_t cofmsg_flow_removed_view::get_byte_count() const {
+  switch (get_version()) {
+  case rofl::openflow10::OFP_VERSION: {
+    return be64toh(
+        ((struct rofl::openflow10::ofp_flow_removed *)buf)->byte_count);
+  } break;
+  default: {
+    return be64toh(
+        ((struct rofl::openflow13::ofp_flow_removed *)buf)->byte_count);
+  };
+  }
+}
+
+rofl::openflow::cofmatch cofmsg_flow_removed_view::get_match() const {
+  rofl::openflow::cofmatch match;
+  match.set_version(get_version());
+  switch (get_version()) {
+  case rofl::openflow10::OFP_VERSION: {
+    match.unpack(
+        (uint8_t *)&(((struct rofl::openflow10::ofp_flow_removed *)buf)->match),
+        sizeof(struct rofl::openflow10::ofp_match));
+  } break;
+  default: {
+    struct rofl::openflow13::ofp_flow_removed *hdr =
+        (struct rofl::openflow13::ofp_flow_removed *)buf;
+    match.unpack((uint8_t *)&(hdr->match), be16toh(hdr->match.length));
+  };
+  }
+  return match;
+}
+
+cofmsg_flow_removed *cofmsg_flow_removed_view::materialize() const {
+  cofmsg_flow_removed *msg = new cofmsg_flow_removed();
+  try {
+    msg->unpack(buf, buflen);
+  } catch (...) {
+    delete msg;
+    throw;
+  }
+  return msg;
+}
@@ -0,0 +1,271 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/*
+ * cofmsg_view.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef COFMSG_VIEW_H_
+#define COFMSG_VIEW_H_ 1
+
+#include <memory>
+
+#include "rofl/common/cmemory.h"
+#include "rofl/common/openflow/cofmatch.h"
+#include "rofl/common/openflow/messages/cofmsg_flow_removed.h"
+#include "rofl/common/openflow/messages/cofmsg_packet_in.h"
+
+namespace rofl {
+namespace openflow {
+
+/**
+ * @brief	Read-only view of a received OpenFlow message
+ *
+ * A view refers to a message within a shared receive buffer without
+ * copying it. The buffer is kept alive by all copies of the view, so a
+ * view may be stored beyond the receive callback. Only the common header
+ * is validated on construction, typed views decode fields on demand.
+ */
+class cofmsg_view {
+public:
+  /**
+   *
+   */
+  virtual ~cofmsg_view(){};
+
+  /**
+   * @brief	Creates a view of message at offset in mem
+   *
+   * @throws eBadRequestBadLen message exceeds mem or length field mismatch
+   */
+  cofmsg_view(std::shared_ptr<rofl::cmemory> mem, size_t offset,
+              size_t buflen);
+
+  /**
+   *
+   */
+  cofmsg_view(const cofmsg_view &view) { *this = view; };
+
+  /**
+   *
+   */
+  cofmsg_view &operator=(const cofmsg_view &view) {
+    if (this == &view)
+      return *this;
+    mem = view.mem;
+    buf = view.buf;
+    buflen = view.buflen;
+    return *this;
+  };
+
+public:
+  /**
+   *
+   */
+  uint8_t get_version() const { return header()->version; };
+
+  /**
+   *
+   */
+  uint8_t get_type() const { return header()->type; };
+
+  /**
+   *
+   */
+  uint16_t get_length() const { return be16toh(header()->length); };
+
+  /**
+   *
+   */
+  uint32_t get_xid() const { return be32toh(header()->xid); };
+
+  /**
+   * @brief	Returns start of message in receive buffer
+   */
+  const uint8_t *somem() const { return buf; };
+
+  /**
+   * @brief	Returns length of message in receive buffer
+   */
+  size_t length() const { return buflen; };
+
+protected:
+  const struct rofl::openflow::ofp_header *header() const {
+    return (const struct rofl::openflow::ofp_header *)buf;
+  };
+
+public:
+  friend std::ostream &operator<<(std::ostream &os, cofmsg_view const &view) {
+    os << "<cofmsg_view version: " << (int)view.get_version()
+       << " type: " << (int)view.get_type()
+       << " length: " << (int)view.get_length() << " xid: 0x" << std::hex
+       << (unsigned int)view.get_xid() << std::dec << " >" << std::endl;
+    return os;
+  };
+
+protected:
+  std::shared_ptr<rofl::cmemory> mem;
+  uint8_t *buf;
+  size_t buflen;
+};
+
+/**
+ * @brief	Read-only view of a Packet-In message
+ */
+class cofmsg_packet_in_view : public cofmsg_view {
+public:
+  /**
+   *
+   */
+  virtual ~cofmsg_packet_in_view(){};
+
+  /**
+   * @throws eBadRequestBadType view does not refer to a Packet-In
+   * @throws eBadRequestBadLen message too short
+   */
+  cofmsg_packet_in_view(const cofmsg_view &view);
+
+public:
+  /**
+   *
+   */
+  uint32_t get_buffer_id() const;
+
+  /**
+   *
+   */
+  uint16_t get_total_len() const;
+
+  /**
+   *
+   */
+  uint8_t get_reason() const;
+
+  /**
+   * @brief	Returns table id (since OFP 1.2)
+   */
+  uint8_t get_table_id() const;
+
+  /**
+   * @brief	Returns cookie (since OFP 1.3)
+   */
+  uint64_t get_cookie() const;
+
+  /**
+   * @brief	Returns in-port, OXM list is scanned without decoding it
+   *
+   * @throws eOxmNotFound no in-port in match (OFP 1.2 and beyond)
+   */
+  uint32_t get_in_port() const;
+
+  /**
+   * @brief	Returns decoded match
+   */
+  rofl::openflow::cofmatch get_match() const;
+
+  /**
+   * @brief	Returns start of packet data in receive buffer
+   */
+  const uint8_t *get_data() const;
+
+  /**
+   * @brief	Returns length of packet data
+   */
+  size_t get_datalen() const;
+
+  /**
+   * @brief	Returns a fully parsed copy of message, owned by caller
+   */
+  cofmsg_packet_in *materialize() const;
+
+private:
+  size_t match_offset() const;
+
+  size_t data_offset() const;
+};
+
+/**
+ * @brief	Read-only view of a Flow-Removed message
+ */
+class cofmsg_flow_removed_view : public cofmsg_view {
+public:
+  /**
+   *
+   */
+  virtual ~cofmsg_flow_removed_view(){};
+
+  /**
+   * @throws eBadRequestBadType view does not refer to a Flow-Removed
+   * @throws eBadRequestBadLen message too short
+   */
+  cofmsg_flow_removed_view(const cofmsg_view &view);
+
+public:
+  /**
+   *
+   */
+  uint64_t get_cookie() const;
+
+  /**
+   *
+   */
+  uint16_t get_priority() const;
+
+  /**
+   *
+   */
+  uint8_t get_reason() const;
+
+  /**
+   * @brief	Returns table id (since OFP 1.2)
+   */
+  uint8_t get_table_id() const;
+
+  /**
+   *
+   */
+  uint32_t get_duration_sec() const;
+
+  /**
+   *
+   */
+  uint32_t get_duration_nsec() const;
+
+  /**
+   *
+   */
+  uint16_t get_idle_timeout() const;
+
+  /**
+   * @brief	Returns hard timeout (since OFP 1.2)
+   */
+  uint16_t get_hard_timeout() const;
+
+  /**
+   *
+   */
+  uint64_t get_packet_count() const;
+
+  /**
+   *
+   */
+  uint64_t get_byte_count() const;
+
+  /**
+   * @brief	Returns decoded match
+   */
+  rofl::openflow::cofmatch get_match() const;
+
+  /**
+   * @brief	Returns a fully parsed copy of message, owned by caller
+   */
+  cofmsg_flow_removed *materialize() const;
+};
+
+}; // end of namespace openflow
+}; // end of namespace rofl
+
+#endif /* COFMSG_VIEW_H_ */
@@ -0,0 +1,233 @@
+/*
+ * cmempooltest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <string.h>
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "cmempooltest.hpp"
+
+#include "rofl/common/cmemory.h"
+#include "rofl/common/ctimespec.hpp"
+#include "rofl/common/openflow/messages/cofmsg_packet_in.h"
+
+CPPUNIT_TEST_SUITE_REGISTRATION(cmempooltest);
+
+namespace {
+
+class cofmsg_packet_in_ext : public rofl::openflow::cofmsg_packet_in {
+public:
+  cofmsg_packet_in_ext(uint8_t version)
+      : rofl::openflow::cofmsg_packet_in(version) {
+    memset(pad, 0, sizeof(pad));
+  };
+  uint8_t pad[512];
+};
+
+double seconds(const rofl::ctimespec &delta) {
+  return delta.get_tspec().tv_sec + delta.get_tspec().tv_nsec / 1e9;
+}
+
+}; // end of anonymous namespace
+
+void cmempooltest::setUp() {}
+
+void cmempooltest::tearDown() {}
+
+void cmempooltest::testAllocate() {
+  rofl::cmempool pool("test_allocate", 100, 4);
+  CPPUNIT_ASSERT(pool.get_block_size() >= 100);
+  CPPUNIT_ASSERT(pool.get_block_size() % alignof(max_align_t) == 0);
+
+  void *a = pool.allocate(100);
+  pool.release(a, 100);
+  void *b = pool.allocate(50);
+  CPPUNIT_ASSERT(a == b);
+
+  void *c = pool.allocate(pool.get_block_size() + 1);
+  pool.release(c, pool.get_block_size() + 1);
+
+  rofl::cmempool_stats stats = pool.get_stats();
+  CPPUNIT_ASSERT(stats.get_hits() == 1);
+  CPPUNIT_ASSERT(stats.get_misses() == 1);
+  CPPUNIT_ASSERT(stats.get_oversized() == 1);
+  CPPUNIT_ASSERT(stats.get_releases() == 1);
+  CPPUNIT_ASSERT(stats.get_cached() == 0);
+  CPPUNIT_ASSERT(stats.get_hit_rate() == 0.5);
+  CPPUNIT_ASSERT(stats.get_footprint() == pool.get_block_size());
+
+  pool.release(b, 50);
+  pool.release(nullptr, 50);
+  stats = pool.get_stats();
+  CPPUNIT_ASSERT(stats.get_cached() == 1);
+  CPPUNIT_ASSERT(stats.get_footprint() == pool.get_block_size());
+
+  std::map<std::string, rofl::cmempool_stats> all =
+      rofl::cmempool::get_all_stats();
+  CPPUNIT_ASSERT(all.find("test_allocate") != all.end());
+  CPPUNIT_ASSERT(all["test_allocate"].get_hits() == 1);
+}
+
+void cmempooltest::testMaxCached() {
+  rofl::cmempool pool("test_max_cached", 64, 2);
+
+  std::vector<void *> blocks;
+  for (unsigned int i = 0; i < 4; i++) {
+    blocks.push_back(pool.allocate(64));
+  }
+  for (auto mem : blocks) {
+    pool.release(mem, 64);
+  }
+
+  rofl::cmempool_stats stats = pool.get_stats();
+  CPPUNIT_ASSERT(stats.get_misses() == 4);
+  CPPUNIT_ASSERT(stats.get_releases() == 2);
+  CPPUNIT_ASSERT(stats.get_drops() == 2);
+  CPPUNIT_ASSERT(stats.get_cached() == 2);
+  CPPUNIT_ASSERT(stats.get_footprint() == 2 * pool.get_block_size());
+}
+
+void cmempooltest::testThreads() {
+  rofl::cmempool pool("test_threads", 256);
+
+  std::vector<void *> blocks;
+  for (unsigned int i = 0; i < 8; i++) {
+    blocks.push_back(pool.allocate(256));
+  }
+
+  /* blocks released by another thread are cached there and freed on exit */
+  std::thread thread([&]() {
+    for (auto mem : blocks) {
+      pool.release(mem, 256);
+    }
+    CPPUNIT_ASSERT(pool.get_stats().get_cached() == 8);
+  });
+  thread.join();
+
+  rofl::cmempool_stats stats = pool.get_stats();
+  CPPUNIT_ASSERT(stats.get_misses() == 8);
+  CPPUNIT_ASSERT(stats.get_releases() == 8);
+  CPPUNIT_ASSERT(stats.get_drops() == 8);
+  CPPUNIT_ASSERT(stats.get_cached() == 0);
+  CPPUNIT_ASSERT(stats.get_footprint() == 0);
+}
+
+void cmempooltest::testMessages() {
+  uint8_t version = rofl::openflow13::OFP_VERSION;
+  uint8_t data[1500];
+  memset(data, 0xa5, sizeof(data));
+
+  rofl::cmempool_stats before =
+      rofl::cmempool::get_all_stats()["cofmsg_packet_in"];
+
+  for (unsigned int i = 0; i < 16; i++) {
+    rofl::openflow::cofmsg *msg = new rofl::openflow::cofmsg_packet_in(
+        version, i, 0, sizeof(data), 0, 0, 0, 0,
+        rofl::openflow::cofmatch(version), data, sizeof(data));
+    CPPUNIT_ASSERT(msg->get_xid() == i);
+    delete msg;
+  }
+
+  rofl::cmempool_stats after =
+      rofl::cmempool::get_all_stats()["cofmsg_packet_in"];
+  CPPUNIT_ASSERT(after.get_misses() - before.get_misses() <= 1);
+  CPPUNIT_ASSERT(after.get_hits() - before.get_hits() >= 15);
+
+  /* derived classes larger than the block size bypass the pool */
+  rofl::openflow::cofmsg *msg = new cofmsg_packet_in_ext(version);
+  delete msg;
+  rofl::cmempool_stats ext =
+      rofl::cmempool::get_all_stats()["cofmsg_packet_in"];
+  CPPUNIT_ASSERT(ext.get_oversized() == after.get_oversized() + 1);
+  CPPUNIT_ASSERT(ext.get_misses() == after.get_misses());
+}
+
+void cmempooltest::testMemory() {
+  rofl::cmemory mem(100);
+  for (unsigned int i = 0; i < mem.length(); i++) {
+    mem[i] = i;
+  }
+
+  /* move to larger size classes and beyond */
+  size_t sizes[] = {120, 1000, 4000, 20000, 8000, 60, 0, 300};
+  size_t valid = 100;
+  for (auto size : sizes) {
+    mem.resize(size);
+    CPPUNIT_ASSERT(mem.length() == size);
+    valid = (size < valid) ? size : valid;
+    for (unsigned int i = 0; i < valid; i++) {
+      CPPUNIT_ASSERT(mem[i] == (uint8_t)i);
+    }
+    for (unsigned int i = valid; i < size; i++) {
+      CPPUNIT_ASSERT(mem[i] == 0);
+    }
+  }
+
+  rofl::cmemory copy(mem);
+  copy.insert((unsigned int)0, 10000);
+  CPPUNIT_ASSERT(copy.length() == 10300);
+  copy.remove((unsigned int)0, 10000);
+  CPPUNIT_ASSERT(copy == mem);
+
+  rofl::cmempool_stats before =
+      rofl::cmempool::get_all_stats()["cmemory_2048"];
+  for (unsigned int i = 0; i < 16; i++) {
+    rofl::cmemory buf(1500);
+    CPPUNIT_ASSERT(buf[1499] == 0);
+    buf[1499] = 0xff;
+  }
+  rofl::cmempool_stats after = rofl::cmempool::get_all_stats()["cmemory_2048"];
+  CPPUNIT_ASSERT(after.get_hits() - before.get_hits() >= 15);
+}
+
+void cmempooltest::testBenchmark() {
+  const unsigned int count = 200000;
+  uint8_t version = rofl::openflow13::OFP_VERSION;
+  uint8_t data[1500];
+  memset(data, 0xa5, sizeof(data));
+  rofl::openflow::cofmatch match(version);
+  match.set_in_port(1);
+
+  rofl::ctimespec start = rofl::ctimespec::now();
+  for (unsigned int i = 0; i < count; i++) {
+    rofl::openflow::cofmsg *msg = new rofl::openflow::cofmsg_packet_in(
+        version, i, 0, sizeof(data), 0, 0, 0, 0, match, data, sizeof(data));
+    delete msg;
+  }
+  rofl::ctimespec delta = rofl::ctimespec::now() - start;
+  std::cerr << "packet-in lifecycle: " << (seconds(delta) * 1e9 / count)
+            << " ns/msg" << std::endl;
+
+  rofl::cmempool pool("test_benchmark", 2048);
+  start = rofl::ctimespec::now();
+  for (unsigned int i = 0; i < count; i++) {
+    void *mem = pool.allocate(2048);
+    *(volatile uint8_t *)mem = i;
+    pool.release(mem, 2048);
+  }
+  delta = rofl::ctimespec::now() - start;
+  std::cerr << "pool allocate/release: " << (seconds(delta) * 1e9 / count)
+            << " ns" << std::endl;
+
+  start = rofl::ctimespec::now();
+  for (unsigned int i = 0; i < count; i++) {
+    void *mem = ::operator new(2048);
+    *(volatile uint8_t *)mem = i;
+    ::operator delete(mem);
+  }
+  delta = rofl::ctimespec::now() - start;
+  std::cerr << "operator new/delete: " << (seconds(delta) * 1e9 / count)
+            << " ns" << std::endl;
+
+  std::map<std::string, rofl::cmempool_stats> all =
+      rofl::cmempool::get_all_stats();
+  for (auto name : {"cofmsg_packet_in", "cmemory_2048"}) {
+    std::cerr << name << ": " << all[name] << std::endl;
+    CPPUNIT_ASSERT(all[name].get_hit_rate() > 0.99);
+  }
+}
@@ -0,0 +1,38 @@
+/*
+ * cmempooltest.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef TEST_SRC_ROFL_COMMON_CMEMPOOL_TEST_HPP_
+#define TEST_SRC_ROFL_COMMON_CMEMPOOL_TEST_HPP_
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "rofl/common/cmempool.hpp"
+
+class cmempooltest : public CppUnit::TestFixture {
+  CPPUNIT_TEST_SUITE(cmempooltest);
+  CPPUNIT_TEST(testAllocate);
+  CPPUNIT_TEST(testMaxCached);
+  CPPUNIT_TEST(testThreads);
+  CPPUNIT_TEST(testMessages);
+  CPPUNIT_TEST(testMemory);
+  CPPUNIT_TEST(testBenchmark);
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void setUp();
+  void tearDown();
+
+public:
+  void testAllocate();
+  void testMaxCached();
+  void testThreads();
+  void testMessages();
+  void testMemory();
+  void testBenchmark();
+};
+
+#endif /* TEST_SRC_ROFL_COMMON_CMEMPOOL_TEST_HPP_ */
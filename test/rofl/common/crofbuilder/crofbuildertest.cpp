@@ -0,0 +1,459 @@
+/*
+ * crofbuildertest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <stdlib.h>
+
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include "crofbuildertest.hpp"
+#include "rofl/common/openflow/messages/cofmsg_barrier.h"
+#include "rofl/common/openflow/messages/cofmsg_flow_mod.h"
+#include "rofl/common/openflow/messages/cofmsg_packet_in.h"
+#include "rofl/common/openflow/messages/cofmsg_packet_out.h"
+
+using namespace rofl::openflow;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(crofbuildertest);
+
+void crofbuildertest::setUp() {}
+
+void crofbuildertest::tearDown() {}
+
+void crofbuildertest::compare(rofl::crofframe *frame,
+                              rofl::openflow::cofmsg &msg) {
+  rofl::cmemory mem(msg.length());
+  msg.pack(mem.somem(), mem.length());
+
+  if ((frame->length() != mem.length()) ||
+      (memcmp(frame->somem(), mem.somem(), mem.length()) != 0)) {
+    rofl::cmemory wire((uint8_t *)frame->somem(), frame->length());
+    std::cerr << ">>> builder <<<" << std::endl << wire;
+    std::cerr << ">>> cofmsg <<<" << std::endl << mem;
+  }
+  CPPUNIT_ASSERT(frame->length() == mem.length());
+  CPPUNIT_ASSERT(memcmp(frame->somem(), mem.somem(), mem.length()) == 0);
+  delete frame;
+}
+
+void crofbuildertest::testFlowMod() {
+  uint8_t versions[] = {rofl::openflow12::OFP_VERSION,
+                        rofl::openflow13::OFP_VERSION};
+  uint32_t xid = 0xa1a2a3a4;
+
+  for (auto version : versions) {
+    rofl::cmacaddr eth_dst("00:11:22:33:44:55");
+
+    rofl::openflow::cofflowmod flowmod(version);
+    flowmod.set_command(rofl::openflow13::OFPFC_ADD);
+    flowmod.set_table_id(1);
+    flowmod.set_cookie(0x1112131415161718);
+    flowmod.set_idle_timeout(0x2122);
+    flowmod.set_hard_timeout(0x3132);
+    flowmod.set_priority(0x4142);
+    flowmod.set_flags(0x0001);
+    flowmod.set_match().set_in_port(1);
+    flowmod.set_match().set_eth_dst(eth_dst);
+    flowmod.set_match().set_eth_type(0x0800);
+    flowmod.set_instructions().set_inst_goto_table().set_table_id(2);
+    flowmod.set_instructions()
+        .set_inst_apply_actions()
+        .set_actions()
+        .add_action_output(rofl::cindex(0))
+        .set_port_no(3);
+    flowmod.set_instructions()
+        .set_inst_apply_actions()
+        .set_actions()
+        .add_action_output(rofl::cindex(1))
+        .set_port_no(4);
+    rofl::openflow::cofmsg_flow_mod msg(version, xid, flowmod);
+
+    rofl::crofframe *frame =
+        rofl::crofbuilder_flow_mod(nullptr, rofl::cauxid(0), version, xid)
+            .command(rofl::openflow13::OFPFC_ADD)
+            .table(1)
+            .cookie(0x1112131415161718)
+            .idle_timeout(0x2122)
+            .hard_timeout(0x3132)
+            .priority(0x4142)
+            .flags(0x0001)
+            .match_in_port(1)
+            .match_eth_dst(eth_dst)
+            .match_eth_type(0x0800)
+            .goto_table(2)
+            .apply_output(3)
+            .apply_output(4)
+            .release();
+
+    compare(frame, msg);
+  }
+
+  /* empty match and generic OXM and action */
+  rofl::openflow::cofflowmod flowmod(rofl::openflow13::OFP_VERSION);
+  flowmod.set_match().set_ip_proto(17);
+  flowmod.set_instructions()
+      .set_inst_write_actions()
+      .set_actions()
+      .add_action_group(rofl::cindex(0))
+      .set_group_id(7);
+  rofl::openflow::cofmsg_flow_mod msg(rofl::openflow13::OFP_VERSION, xid,
+                                      flowmod);
+
+  rofl::crofframe *frame =
+      rofl::crofbuilder_flow_mod(nullptr, rofl::cauxid(0),
+                                 rofl::openflow13::OFP_VERSION, xid)
+          .match(rofl::openflow::coxmatch_ofb_ip_proto(17))
+          .write_action(rofl::openflow::cofaction_group(
+              rofl::openflow13::OFP_VERSION, 7))
+          .release();
+
+  compare(frame, msg);
+}
+
+void crofbuildertest::testPacketOut() {
+  uint32_t xid = 0xa1a2a3a4;
+  uint8_t data[64];
+  for (unsigned int i = 0; i < sizeof(data); i++)
+    data[i] = i;
+
+  rofl::openflow::cofactions actions(rofl::openflow13::OFP_VERSION);
+  actions.add_action_output(rofl::cindex(0)).set_port_no(5);
+  rofl::openflow::cofmsg_packet_out msg(
+      rofl::openflow13::OFP_VERSION, xid, rofl::openflow13::OFP_NO_BUFFER, 2,
+      actions, data, sizeof(data));
+
+  rofl::crofframe *frame =
+      rofl::crofbuilder_packet_out(nullptr, rofl::cauxid(0),
+                                   rofl::openflow13::OFP_VERSION, xid)
+          .in_port(2)
+          .output(5)
+          .data(data, sizeof(data))
+          .release();
+
+  compare(frame, msg);
+}
+
+void crofbuildertest::testPacketIn() {
+  uint8_t versions[] = {rofl::openflow12::OFP_VERSION,
+                        rofl::openflow13::OFP_VERSION};
+  uint32_t xid = 0xa1a2a3a4;
+  uint8_t data[60];
+  for (unsigned int i = 0; i < sizeof(data); i++)
+    data[i] = i;
+
+  for (auto version : versions) {
+    rofl::openflow::cofmatch match(version);
+    match.set_in_port(6);
+    rofl::openflow::cofmsg_packet_in msg(
+        version, xid, 0x51525354, sizeof(data),
+        rofl::openflow13::OFPR_NO_MATCH, 3, 0x1112131415161718, 0, match,
+        data, sizeof(data));
+
+    rofl::crofframe *frame =
+        rofl::crofbuilder_packet_in(nullptr, rofl::cauxid(0), version, xid)
+            .buffer_id(0x51525354)
+            .total_len(sizeof(data))
+            .reason(rofl::openflow13::OFPR_NO_MATCH)
+            .table(3)
+            .cookie(0x1112131415161718)
+            .match_in_port(6)
+            .data(data, sizeof(data))
+            .release();
+
+    compare(frame, msg);
+  }
+}
+
+void crofbuildertest::testBarrier() {
+  uint8_t versions[] = {rofl::openflow10::OFP_VERSION,
+                        rofl::openflow12::OFP_VERSION,
+                        rofl::openflow13::OFP_VERSION};
+  uint32_t xid = 0xa1a2a3a4;
+
+  for (auto version : versions) {
+    rofl::openflow::cofmsg_barrier_request request(version, xid);
+    compare(rofl::crofbuilder_barrier_request(nullptr, rofl::cauxid(0),
+                                              version, xid, rofl::ctimespec())
+                .release(),
+            request);
+
+    rofl::openflow::cofmsg_barrier_reply reply(version, xid);
+    compare(rofl::crofbuilder_barrier_reply(nullptr, rofl::cauxid(0), version,
+                                            xid)
+                .release(),
+            reply);
+  }
+}
+
+void crofbuildertest::testInvalid() {
+  try {
+    rofl::crofbuilder_flow_mod(nullptr, rofl::cauxid(0),
+                               rofl::openflow10::OFP_VERSION, 1);
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::eBadVersion &e) {
+  }
+
+  try {
+    rofl::crofbuilder_flow_mod(nullptr, rofl::cauxid(0),
+                               rofl::openflow13::OFP_VERSION, 1)
+        .goto_table(1)
+        .match_in_port(1);
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::eRofBuilderInvalid &e) {
+  }
+
+  try {
+    rofl::crofbuilder_packet_out(nullptr, rofl::cauxid(0),
+                                 rofl::openflow13::OFP_VERSION, 1)
+        .data(nullptr, 0)
+        .output(1);
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::eRofBuilderInvalid &e) {
+  }
+
+  /* no channel */
+  rofl::crofbuilder_barrier_reply builder(nullptr, rofl::cauxid(0),
+                                          rofl::openflow13::OFP_VERSION, 1);
+  try {
+    builder.commit();
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::eRofConnNotConnected &e) {
+  }
+
+  /* frame was consumed by commit() */
+  try {
+    builder.release();
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::eRofBuilderInvalid &e) {
+  }
+
+  /* filtered messages are dropped silently */
+  rofl::crofbuilder_barrier_reply ignored(nullptr, rofl::cauxid(0),
+                                          rofl::openflow13::OFP_VERSION, 1);
+  ignored.set_ignored();
+  CPPUNIT_ASSERT(ignored.commit() == rofl::crofsock::MSG_IGNORED);
+}
+
+static rofl::openflow::cofflowmod
+template_flow_mod(const rofl::caddress_ll &eth_src,
+                  const rofl::caddress_ll &eth_dst, uint32_t port_no,
+                  uint64_t cookie) {
+  rofl::openflow::cofflowmod flowmod(rofl::openflow13::OFP_VERSION);
+  flowmod.set_command(rofl::openflow13::OFPFC_ADD);
+  flowmod.set_table_id(0);
+  flowmod.set_priority(0x8000);
+  flowmod.set_idle_timeout(15);
+  flowmod.set_cookie(cookie);
+  flowmod.set_match().set_eth_src(eth_src);
+  flowmod.set_match().set_eth_dst(eth_dst);
+  flowmod.set_instructions()
+      .set_inst_apply_actions()
+      .set_actions()
+      .add_action_output(rofl::cindex(0))
+      .set_port_no(port_no);
+  return flowmod;
+}
+
+void crofbuildertest::testTemplate() {
+  rofl::caddress_ll any("00:00:00:00:00:00");
+  rofl::caddress_ll eth_src("00:11:22:33:44:55");
+  rofl::caddress_ll eth_dst("00:a1:a2:a3:a4:a5");
+  uint32_t xid = 0xa1a2a3a4;
+
+  /* Flow-Mod */
+  rofl::croftemplate flowmod_tmpl(rofl::openflow13::OFP_VERSION,
+                                  template_flow_mod(any, any, 0, 0));
+  rofl::croftemplate::field src =
+      flowmod_tmpl.field_oxm(rofl::openflow::OXM_TLV_BASIC_ETH_SRC);
+  rofl::croftemplate::field dst =
+      flowmod_tmpl.field_oxm(rofl::openflow::OXM_TLV_BASIC_ETH_DST);
+  rofl::croftemplate::field port = flowmod_tmpl.field_output_port();
+  rofl::croftemplate::field cookie = flowmod_tmpl.field_cookie();
+
+  rofl::openflow::cofmsg_flow_mod flowmod_msg(
+      rofl::openflow13::OFP_VERSION, xid,
+      template_flow_mod(eth_src, eth_dst, 7, 0x1112131415161718));
+  compare(rofl::crofbuilder_template(nullptr, rofl::cauxid(0),
+                                     rofl::openflow13::OFP_VERSION, xid,
+                                     flowmod_tmpl)
+              .set(src, eth_src)
+              .set(dst, eth_dst)
+              .set(port, 7)
+              .set(cookie, 0x1112131415161718)
+              .release(),
+          flowmod_msg);
+
+  /* 48 bit integer */
+  compare(rofl::crofbuilder_template(nullptr, rofl::cauxid(0),
+                                     rofl::openflow13::OFP_VERSION, xid,
+                                     flowmod_tmpl)
+              .set(src, 0x001122334455)
+              .set(dst, eth_dst)
+              .set(port, 7)
+              .set(cookie, 0x1112131415161718)
+              .release(),
+          flowmod_msg);
+
+  /* Packet-Out */
+  uint8_t data[64];
+  for (unsigned int i = 0; i < sizeof(data); i++)
+    data[i] = i;
+
+  rofl::openflow::cofactions actions(rofl::openflow13::OFP_VERSION);
+  actions.add_action_output(rofl::cindex(0))
+      .set_port_no(rofl::openflow13::OFPP_FLOOD);
+  actions.add_action_output(rofl::cindex(1)).set_port_no(0);
+  rofl::croftemplate packet_out_tmpl(rofl::openflow13::OFP_VERSION,
+                                     rofl::openflow13::OFP_NO_BUFFER, 0,
+                                     actions);
+
+  actions.set_action_output(rofl::cindex(1)).set_port_no(9);
+  rofl::openflow::cofmsg_packet_out packet_out_msg(
+      rofl::openflow13::OFP_VERSION, xid, 0x51525354, 2, actions, data,
+      sizeof(data));
+  compare(rofl::crofbuilder_template(nullptr, rofl::cauxid(0),
+                                     rofl::openflow13::OFP_VERSION, xid,
+                                     packet_out_tmpl)
+              .set(packet_out_tmpl.field_buffer_id(), 0x51525354)
+              .set(packet_out_tmpl.field_in_port(), 2)
+              .set(packet_out_tmpl.field_output_port(1), 9)
+              .data(data, sizeof(data))
+              .release(),
+          packet_out_msg);
+
+  /* invalid use */
+  try {
+    rofl::croftemplate(rofl::openflow10::OFP_VERSION,
+                       rofl::openflow::cofflowmod(
+                           rofl::openflow10::OFP_VERSION));
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::eBadVersion &e) {
+  }
+
+  try {
+    flowmod_tmpl.field_oxm(rofl::openflow::OXM_TLV_BASIC_VLAN_VID);
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::eRofTemplateNotFound &e) {
+  }
+
+  try {
+    flowmod_tmpl.field_output_port(1);
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::eRofTemplateNotFound &e) {
+  }
+
+  try {
+    flowmod_tmpl.field_in_port();
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::eRofTemplateNotFound &e) {
+  }
+
+  try {
+    packet_out_tmpl.field_cookie();
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::eRofTemplateNotFound &e) {
+  }
+
+  try {
+    rofl::crofbuilder_template(nullptr, rofl::cauxid(0),
+                               rofl::openflow12::OFP_VERSION, xid,
+                               flowmod_tmpl);
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::eBadVersion &e) {
+  }
+
+  rofl::crofbuilder_template builder(nullptr, rofl::cauxid(0),
+                                     rofl::openflow13::OFP_VERSION, xid,
+                                     flowmod_tmpl);
+  try {
+    builder.data(data, sizeof(data));
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::eRofBuilderInvalid &e) {
+  }
+
+  try {
+    builder.set(port, eth_src);
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::eRofBuilderInvalid &e) {
+  }
+}
+
+void crofbuildertest::testBenchmark() {
+  const unsigned int count = 100000;
+  uint32_t xid = 0;
+  rofl::cmacaddr eth_dst("00:11:22:33:44:55");
+
+  rofl::ctimespec start = rofl::ctimespec::now();
+  for (unsigned int i = 0; i < count; i++) {
+    rofl::openflow::cofflowmod flowmod(rofl::openflow13::OFP_VERSION);
+    flowmod.set_table_id(0);
+    flowmod.set_priority(10);
+    flowmod.set_match().set_eth_dst(eth_dst);
+    flowmod.set_instructions()
+        .set_inst_apply_actions()
+        .set_actions()
+        .add_action_output(rofl::cindex(0))
+        .set_port_no(3);
+    rofl::openflow::cofmsg_flow_mod *msg =
+        new rofl::openflow::cofmsg_flow_mod(rofl::openflow13::OFP_VERSION,
+                                            xid++, flowmod);
+    rofl::cmemory mem(msg->length());
+    msg->pack(mem.somem(), mem.length());
+    delete msg;
+  }
+  rofl::ctimespec middle = rofl::ctimespec::now();
+  for (unsigned int i = 0; i < count; i++) {
+    delete rofl::crofbuilder_flow_mod(nullptr, rofl::cauxid(0),
+                                      rofl::openflow13::OFP_VERSION, xid++)
+        .table(0)
+        .priority(10)
+        .match_eth_dst(eth_dst)
+        .apply_output(3)
+        .release();
+  }
+  rofl::ctimespec stop = rofl::ctimespec::now();
+
+  rofl::caddress_ll any("00:00:00:00:00:00");
+  rofl::croftemplate tmpl(rofl::openflow13::OFP_VERSION,
+                          template_flow_mod(any, any, 0, 0));
+  rofl::croftemplate::field src =
+      tmpl.field_oxm(rofl::openflow::OXM_TLV_BASIC_ETH_SRC);
+  rofl::croftemplate::field dst =
+      tmpl.field_oxm(rofl::openflow::OXM_TLV_BASIC_ETH_DST);
+  rofl::croftemplate::field port = tmpl.field_output_port();
+  rofl::croftemplate::field cookie = tmpl.field_cookie();
+
+  rofl::ctimespec tmpl_start = rofl::ctimespec::now();
+  for (unsigned int i = 0; i < count; i++) {
+    delete rofl::crofbuilder_template(nullptr, rofl::cauxid(0),
+                                      rofl::openflow13::OFP_VERSION, xid++,
+                                      tmpl)
+        .set(src, eth_dst)
+        .set(dst, eth_dst)
+        .set(port, 3)
+        .set(cookie, i)
+        .release();
+  }
+  rofl::ctimespec tmpl_stop = rofl::ctimespec::now();
+
+  rofl::ctimespec delta = middle - start;
+  double secs = delta.get_tspec().tv_sec + delta.get_tspec().tv_nsec / 1e9;
+  std::cerr << "packed " << count << " flow-mods via cofmsg in " << secs
+            << "s (" << (unsigned long)(count / secs) << " flow-mods/s)"
+            << std::endl;
+
+  delta = stop - middle;
+  secs = delta.get_tspec().tv_sec + delta.get_tspec().tv_nsec / 1e9;
+  std::cerr << "built " << count << " flow-mods via crofbuilder in " << secs
+            << "s (" << (unsigned long)(count / secs) << " flow-mods/s)"
+            << std::endl;
+
+  delta = tmpl_stop - tmpl_start;
+  secs = delta.get_tspec().tv_sec + delta.get_tspec().tv_nsec / 1e9;
+  std::cerr << "patched " << count << " flow-mods via croftemplate in "
+            << secs << "s (" << (unsigned long)(count / secs)
+            << " flow-mods/s)" << std::endl;
+}
@@ -0,0 +1,45 @@
+/*
+ * crofbuildertest.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef TEST_SRC_ROFL_COMMON_CROFBUILDERTEST_HPP_
+#define TEST_SRC_ROFL_COMMON_CROFBUILDERTEST_HPP_
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "rofl/common/crofbuilder.hpp"
+#include "rofl/common/croftemplate.hpp"
+#include "rofl/common/openflow/messages/cofmsg.h"
+
+class crofbuildertest : public CppUnit::TestFixture {
+  CPPUNIT_TEST_SUITE(crofbuildertest);
+  CPPUNIT_TEST(testFlowMod);
+  CPPUNIT_TEST(testPacketOut);
+  CPPUNIT_TEST(testPacketIn);
+  CPPUNIT_TEST(testBarrier);
+  CPPUNIT_TEST(testInvalid);
+  CPPUNIT_TEST(testTemplate);
+  CPPUNIT_TEST(testBenchmark);
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void setUp();
+  void tearDown();
+
+public:
+  void testFlowMod();
+  void testPacketOut();
+  void testPacketIn();
+  void testBarrier();
+  void testInvalid();
+  void testTemplate();
+  void testBenchmark();
+
+private:
+  void compare(rofl::crofframe *frame, rofl::openflow::cofmsg &msg);
+};
+
+#endif /* TEST_SRC_ROFL_COMMON_CROFBUILDERTEST_HPP_ */
@@ -6,6 +6,7 @@
  */
 
 #include <stdlib.h>
+#include <unistd.h>
 
 #include <cppunit/extensions/TestFactoryRegistry.h>
 #include <cppunit/ui/text/TestRunner.h>
@@ -37,27 +38,7 @@ void crofconntest::test() {
     slisten = new rofl::crofsock(this);
     sclient = new rofl::crofconn(this);
 
-    listening_port = 0;
-
-    /* try to find idle port for test */
-    bool lookup_idle_port = true;
-    while (lookup_idle_port) {
-      do {
-        listening_port = rand.uint16();
-      } while ((listening_port < 10000) || (listening_port > 49000));
-      try {
-        std::cerr << "trying listening port=" << (int)listening_port
-                  << std::endl;
-        baddr =
-            rofl::csockaddr(rofl::caddress_in4("127.0.0.1"), listening_port);
-        /* try to bind address first */
-        slisten->set_baddr(baddr).listen();
-        std::cerr << "binding to " << baddr.str() << std::endl;
-        lookup_idle_port = false;
-      } catch (rofl::eSysCall &e) {
-        /* port in use, try another one */
-      }
-    }
+    start_listening();
 
     /* create new crofconn instance and connect to peer */
     versionbitmap_dpt.add_ofp_version(rofl::openflow10::OFP_VERSION);
@@ -106,6 +87,96 @@ void crofconntest::test() {
   }
 }
 
+void crofconntest::test_recv_view() {
+  test_mode = TEST_MODE_VIEW;
+  num_of_packets = 2048;
+  srv_pkts_rcvd = 0;
+  cli_pkts_sent = 0;
+  xid_client = 0;
+  view_counter = 0;
+  xid_last_rcvd = 0;
+  rcvd_out_of_order = false;
+  sserver = nullptr;
+
+  slisten = new rofl::crofsock(this);
+  sclient = new rofl::crofconn(this);
+
+  start_listening();
+
+  versionbitmap_dpt.add_ofp_version(rofl::openflow13::OFP_VERSION);
+  sclient->set_raddr(baddr).tcp_connect(
+      versionbitmap_dpt, rofl::crofconn::MODE_DATAPATH, /*reconnect=*/false);
+
+  for (int i = 0; i < 500; i++) {
+    if ((nullptr != sserver) && sserver->is_established() &&
+        sclient->is_established())
+      break;
+    usleep(10000);
+  }
+  CPPUNIT_ASSERT(sserver != nullptr);
+  CPPUNIT_ASSERT(sserver->is_established());
+  CPPUNIT_ASSERT(sclient->is_established());
+
+  /* every other Packet-In is declined as view and parsed by crofconn */
+  while (cli_pkts_sent < num_of_packets) {
+    if (sclient->send_message(new rofl::openflow::cofmsg_packet_in(
+            rofl::openflow13::OFP_VERSION, xid_client + 1)) ==
+        rofl::crofsock::MSG_QUEUEING_FAILED_QUEUE_FULL) {
+      usleep(1000);
+      continue;
+    }
+    xid_client++;
+    cli_pkts_sent++;
+  }
+
+  for (int i = 0; i < 1000; i++) {
+    if (srv_pkts_rcvd >= num_of_packets)
+      break;
+    usleep(10000);
+  }
+
+  std::cerr << "rcvd: " << srv_pkts_rcvd << " views: " << view_counter
+            << " throttled: " << sserver->get_rx_throttle_episodes()
+            << std::endl;
+
+  CPPUNIT_ASSERT(srv_pkts_rcvd == num_of_packets);
+  CPPUNIT_ASSERT(view_counter == num_of_packets);
+  CPPUNIT_ASSERT(not rcvd_out_of_order);
+  /* views count against the rxqueues' watermarks */
+  CPPUNIT_ASSERT(sserver->get_rx_throttle_episodes() > 0);
+
+  slisten->close();
+  sclient->close();
+  sserver->close();
+
+  delete slisten;
+  delete sclient;
+  delete sserver;
+}
+
+void crofconntest::start_listening() {
+  listening_port = 0;
+
+  /* try to find idle port for test */
+  bool lookup_idle_port = true;
+  while (lookup_idle_port) {
+    do {
+      listening_port = rand.uint16();
+    } while ((listening_port < 10000) || (listening_port > 49000));
+    try {
+      std::cerr << "trying listening port=" << (int)listening_port
+                << std::endl;
+      baddr = rofl::csockaddr(rofl::caddress_in4("127.0.0.1"), listening_port);
+      /* try to bind address first */
+      slisten->set_baddr(baddr).listen();
+      std::cerr << "binding to " << baddr.str() << std::endl;
+      lookup_idle_port = false;
+    } catch (rofl::eSysCall &e) {
+      /* port in use, try another one */
+    }
+  }
+}
+
 void crofconntest::handle_listen(rofl::crofsock &socket) {
 
   for (auto sd : socket.accept()) {
@@ -122,6 +193,17 @@ void crofconntest::handle_listen(rofl::crofsock &socket) {
       sserver->tcp_accept(sd, versionbitmap_ctl,
                           rofl::crofconn::MODE_CONTROLLER);
 
+    } break;
+    case TEST_MODE_VIEW: {
+      versionbitmap_ctl.add_ofp_version(rofl::openflow13::OFP_VERSION);
+
+      rofl::crofconn *conn = new rofl::crofconn(this);
+      conn->set_rx_view(rofl::openflow13::OFPT_PACKET_IN);
+      conn->set_rxqueue_watermarks(rofl::crofconn::QUEUE_PKT, 1024, 256);
+      conn->tcp_accept(sd, versionbitmap_ctl,
+                       rofl::crofconn::MODE_CONTROLLER);
+      sserver = conn;
+
     } break;
     default: {};
     }
@@ -132,6 +214,10 @@ void crofconntest::handle_established(rofl::crofconn &conn,
                                       uint8_t ofp_version) {
   std::cerr << "crofconntest::handle_established()" << std::endl;
 
+  if (TEST_MODE_TCP != test_mode) {
+    return;
+  }
+
   if (&conn == sserver) {
     std::cerr << "[Ss], ";
     send_packet_out(ofp_version);
@@ -207,6 +293,12 @@ void crofconntest::handle_recv(rofl::crofconn &conn,
     conn.send_message(msg);
   } break;
   case rofl::openflow::OFPT_PACKET_IN: {
+    if (TEST_MODE_VIEW == test_mode) {
+      /* declined views only */
+      CPPUNIT_ASSERT(pmsg->get_xid() % 2);
+      packet_in_rcvd(pmsg->get_xid());
+      break;
+    }
     srv_pkts_rcvd++;
     // std::cerr << "RECV(Packet-In): s:" << srv_pkts_rcvd << "(" <<
     // cli_pkts_sent << "), ";
@@ -230,6 +322,27 @@ void crofconntest::handle_recv(rofl::crofconn &conn,
   delete pmsg;
 }
 
+bool crofconntest::handle_recv_view(rofl::crofconn &conn,
+                                    const rofl::openflow::cofmsg_view &view) {
+  CPPUNIT_ASSERT(view.get_type() == rofl::openflow13::OFPT_PACKET_IN);
+  view_counter++;
+  if (view.get_xid() % 2) {
+    return false;
+  }
+  /* slow consumer */
+  usleep(50);
+  packet_in_rcvd(view.get_xid());
+  return true;
+}
+
+void crofconntest::packet_in_rcvd(uint32_t xid) {
+  if (xid != xid_last_rcvd + 1) {
+    rcvd_out_of_order = true;
+  }
+  xid_last_rcvd = xid;
+  srv_pkts_rcvd++;
+}
+
 void crofconntest::send_packet_in(uint8_t version) {
   sclient->send_message(
       new rofl::openflow::cofmsg_packet_in(version, ++xid_client));
@@ -20,6 +20,7 @@ class crofconntest : public CppUnit::TestFixture,
                      public rofl::crofsock_env {
   CPPUNIT_TEST_SUITE(crofconntest);
   CPPUNIT_TEST(test);
+  CPPUNIT_TEST(test_recv_view);
   CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -29,6 +30,8 @@ public:
 public:
   void test();
 
+  void test_recv_view();
+
 private:
   virtual void handle_listen(rofl::crofsock &socket);
 
@@ -78,6 +81,9 @@ private:
 
   virtual void handle_recv(rofl::crofconn &conn, rofl::openflow::cofmsg *msg);
 
+  virtual bool handle_recv_view(rofl::crofconn &conn,
+                                const rofl::openflow::cofmsg_view &view);
+
   virtual void congestion_occurred_indication(rofl::crofconn &conn);
 
   virtual void handle_transaction_timeout(rofl::crofconn &conn, uint32_t xid,
@@ -85,6 +91,10 @@ private:
                                           uint16_t sub_type = 0){};
 
 private:
+  void start_listening();
+
+  void packet_in_rcvd(uint32_t xid);
+
   void send_packet_in(uint8_t version);
 
   void send_packet_out(uint8_t version);
@@ -92,6 +102,7 @@ private:
 private:
   enum crofconn_test_mode_t {
     TEST_MODE_TCP = 1,
+    TEST_MODE_VIEW = 2,
   };
 
   rofl::openflow::cofhello_elem_versionbitmap versionbitmap_ctl;
@@ -120,6 +131,10 @@ private:
   int srv_pkts_sent;
   int cli_pkts_rcvd;
   int cli_pkts_sent;
+
+  int view_counter;
+  uint32_t xid_last_rcvd;
+  bool rcvd_out_of_order;
 };
 
 #endif /* TEST_SRC_ROFL_COMMON_OPENFLOW_MESSAGES_COFMSGAGGRSTATS_TEST_HPP_ */
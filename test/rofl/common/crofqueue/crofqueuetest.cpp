@@ -7,15 +7,99 @@
 
 #include <stdlib.h>
 
+#include <atomic>
+#include <list>
+#include <thread>
+#include <vector>
+
 #include <cppunit/extensions/TestFactoryRegistry.h>
 #include <cppunit/ui/text/TestRunner.h>
 
 #include "crofqueuetest.hpp"
 
+#include "rofl/common/ctimespec.hpp"
+
 using namespace rofl::openflow;
 
 CPPUNIT_TEST_SUITE_REGISTRATION(crofqueuetest);
 
+namespace {
+
+/* previous crofqueue implementation as reference for the benchmark */
+class clistqueue {
+public:
+  clistqueue() : queue_max_size(128){};
+  bool empty() const {
+    rofl::AcquireReadLock rwlock(queue_lock);
+    return queue.empty();
+  };
+  size_t capacity() const {
+    rofl::AcquireReadLock rwlock(queue_lock);
+    return (queue.size() < queue_max_size) ? (queue_max_size - queue.size())
+                                           : 0;
+  };
+  size_t store(rofl::openflow::cofmsg *msg, bool enforce = false) {
+    rofl::AcquireReadWriteLock rwlock(queue_lock);
+    if ((not enforce) && (queue.size() >= queue_max_size)) {
+      throw rofl::eRofQueueFull("clistqueue::store()");
+    }
+    queue.push_back(msg);
+    return queue.size();
+  };
+  rofl::openflow::cofmsg *retrieve() {
+    rofl::AcquireReadWriteLock rwlock(queue_lock);
+    if (queue.empty()) {
+      return nullptr;
+    }
+    rofl::openflow::cofmsg *msg = queue.front();
+    queue.pop_front();
+    return msg;
+  };
+
+private:
+  std::list<rofl::openflow::cofmsg *> queue;
+  mutable rofl::crwlock queue_lock;
+  size_t queue_max_size;
+};
+
+double seconds(const rofl::ctimespec &delta) {
+  return delta.get_tspec().tv_sec + delta.get_tspec().tv_nsec / 1e9;
+}
+
+template <typename Q>
+double contended(unsigned int count, rofl::openflow::cofmsg *msg) {
+  const unsigned int num_producers = 4;
+  Q queue;
+  rofl::ctimespec start = rofl::ctimespec::now();
+  std::thread consumer([&]() {
+    for (unsigned int i = 0; i < count;) {
+      if (queue.retrieve() != nullptr) {
+        i++;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  });
+  std::vector<std::thread> producers;
+  for (unsigned int p = 0; p < num_producers; p++) {
+    producers.push_back(std::thread([&]() {
+      for (unsigned int i = 0; i < count / num_producers; i++) {
+        while (0 == queue.capacity()) {
+          std::this_thread::yield();
+        }
+        queue.store(msg, true);
+      }
+    }));
+  }
+  for (auto &producer : producers) {
+    producer.join();
+  }
+  consumer.join();
+  return seconds(rofl::ctimespec::now() - start);
+}
+
+}; // end of anonymous namespace
+
 void crofqueuetest::setUp() {}
 
 void crofqueuetest::tearDown() {}
@@ -91,3 +175,324 @@ void crofqueuetest::test2() {
   CPPUNIT_ASSERT(queue.size() == 0);
   CPPUNIT_ASSERT(queue.empty());
 }
+
+void crofqueuetest::testFrames() {
+  uint32_t xid = 0xa1a2a3a4;
+  rofl::crofqueue queue;
+
+  queue.set_queue_max_size(4);
+
+  for (unsigned int i = 0; i < 4; i++) {
+    if (i % 2) {
+      rofl::crofframe *frame = new rofl::crofframe();
+      frame->append(sizeof(struct rofl::openflow::ofp_header));
+      struct rofl::openflow::ofp_header *hdr =
+          (struct rofl::openflow::ofp_header *)frame->at(0);
+      hdr->version = rofl::openflow13::OFP_VERSION;
+      hdr->type = rofl::openflow13::OFPT_BARRIER_REQUEST;
+      hdr->length = htobe16(sizeof(struct rofl::openflow::ofp_header));
+      hdr->xid = htobe32(xid++);
+      queue.store(frame);
+    } else {
+      queue.store(new rofl::openflow::cofmsg(
+          rofl::openflow13::OFP_VERSION, rofl::openflow13::OFPT_HELLO, xid++));
+    }
+  }
+
+  rofl::crofframe *frame = new rofl::crofframe();
+  try {
+    queue.store(frame);
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::eRofQueueFull &e) {
+    delete frame;
+  }
+
+  /* frames and messages are retrieved in order of insertion */
+  xid = 0xa1a2a3a4;
+  for (unsigned int i = 0; i < 4; i++) {
+    rofl::openflow::cofmsg *msg = nullptr;
+    rofl::crofframe *frame = nullptr;
+    CPPUNIT_ASSERT(queue.retrieve(msg, frame));
+    if (i % 2) {
+      CPPUNIT_ASSERT(msg == nullptr);
+      CPPUNIT_ASSERT(frame != nullptr);
+      CPPUNIT_ASSERT(frame->get_xid() == xid++);
+      delete frame;
+    } else {
+      CPPUNIT_ASSERT(msg != nullptr);
+      CPPUNIT_ASSERT(frame == nullptr);
+      CPPUNIT_ASSERT(msg->get_xid() == xid++);
+      delete msg;
+    }
+  }
+
+  rofl::openflow::cofmsg *msg = nullptr;
+  CPPUNIT_ASSERT(not queue.retrieve(msg, frame));
+  CPPUNIT_ASSERT(queue.empty());
+}
+
+void crofqueuetest::testRing() {
+  rofl::cring_queue<unsigned int> ring(5);
+  CPPUNIT_ASSERT(ring.capacity() == 8);
+  CPPUNIT_ASSERT(ring.empty());
+
+  unsigned int value = 0;
+  CPPUNIT_ASSERT(not ring.pop(value));
+  CPPUNIT_ASSERT(not ring.peek(value));
+
+  /* wrap around several times */
+  for (unsigned int round = 0; round < 4; round++) {
+    for (unsigned int i = 0; i < ring.capacity(); i++) {
+      CPPUNIT_ASSERT(ring.push(round * 100 + i));
+    }
+    CPPUNIT_ASSERT(not ring.push(0));
+    CPPUNIT_ASSERT(ring.peek(value));
+    CPPUNIT_ASSERT(value == round * 100);
+    for (unsigned int i = 0; i < ring.capacity(); i++) {
+      CPPUNIT_ASSERT(ring.pop(value));
+      CPPUNIT_ASSERT(value == round * 100 + i);
+    }
+    CPPUNIT_ASSERT(ring.empty());
+  }
+}
+
+void crofqueuetest::testOverflow() {
+  uint32_t xid = 0;
+  rofl::crofqueue queue(4);
+
+  queue.set_queue_max_size(2);
+  for (unsigned int i = 0; i < 16; i++) {
+    queue.store(new rofl::openflow::cofmsg(rofl::openflow13::OFP_VERSION,
+                                           rofl::openflow13::OFPT_HELLO, xid++),
+                true);
+    CPPUNIT_ASSERT(queue.size() == i + 1);
+  }
+  CPPUNIT_ASSERT(queue.capacity() == 0);
+
+  /* spilled entries follow the ring's entries */
+  CPPUNIT_ASSERT(queue.front()->get_xid() == 0);
+  for (unsigned int i = 0; i < 10; i++) {
+    rofl::openflow::cofmsg *msg = queue.retrieve();
+    CPPUNIT_ASSERT(msg != nullptr);
+    CPPUNIT_ASSERT(msg->get_xid() == i);
+    delete msg;
+  }
+
+  /* stores continue behind the overflow list until it is drained */
+  queue.store(new rofl::openflow::cofmsg(rofl::openflow13::OFP_VERSION,
+                                         rofl::openflow13::OFPT_HELLO, xid++),
+              true);
+  for (unsigned int i = 10; i < 17; i++) {
+    rofl::openflow::cofmsg *msg = queue.retrieve();
+    CPPUNIT_ASSERT(msg != nullptr);
+    CPPUNIT_ASSERT(msg->get_xid() == i);
+    delete msg;
+  }
+  CPPUNIT_ASSERT(queue.empty());
+  CPPUNIT_ASSERT(queue.retrieve() == nullptr);
+
+  queue.store(new rofl::openflow::cofmsg(rofl::openflow13::OFP_VERSION,
+                                         rofl::openflow13::OFPT_HELLO, xid++));
+  queue.store(new rofl::openflow::cofmsg(rofl::openflow13::OFP_VERSION,
+                                         rofl::openflow13::OFPT_HELLO, xid++));
+  CPPUNIT_ASSERT(queue.size() == 2);
+  queue.clear();
+  CPPUNIT_ASSERT(queue.empty());
+}
+
+void crofqueuetest::testBytes() {
+  uint32_t xid = 0;
+  rofl::crofqueue queue;
+
+  /* an empty Hello is a bare header: 8 bytes */
+  queue.set_queue_max_bytes(24);
+  queue.set_watermarks(16, 8);
+  CPPUNIT_ASSERT(queue.bytes() == 0);
+  CPPUNIT_ASSERT(not queue.is_above_high_watermark());
+  CPPUNIT_ASSERT(queue.is_below_low_watermark());
+
+  queue.store(new rofl::openflow::cofmsg(rofl::openflow13::OFP_VERSION,
+                                         rofl::openflow13::OFPT_HELLO, xid++));
+  CPPUNIT_ASSERT(queue.bytes() == 8);
+  CPPUNIT_ASSERT(queue.is_below_low_watermark());
+
+  queue.store(new rofl::openflow::cofmsg(rofl::openflow13::OFP_VERSION,
+                                         rofl::openflow13::OFPT_HELLO, xid++));
+  CPPUNIT_ASSERT(queue.bytes() == 16);
+  CPPUNIT_ASSERT(queue.is_above_high_watermark());
+  CPPUNIT_ASSERT(not queue.is_below_low_watermark());
+
+  queue.store(new rofl::openflow::cofmsg(rofl::openflow13::OFP_VERSION,
+                                         rofl::openflow13::OFPT_HELLO, xid++));
+
+  /* byte budget exhausted, unless enforced */
+  rofl::openflow::cofmsg *msg = new rofl::openflow::cofmsg(
+      rofl::openflow13::OFP_VERSION, rofl::openflow13::OFPT_HELLO, xid++);
+  try {
+    queue.store(msg);
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::eRofQueueFull &e) {
+  }
+  CPPUNIT_ASSERT(queue.bytes() == 24);
+  CPPUNIT_ASSERT(queue.size() == 3);
+  queue.store(msg, true);
+  CPPUNIT_ASSERT(queue.bytes() == 32);
+
+  /* hysteresis: between low and high watermark */
+  delete queue.retrieve();
+  delete queue.retrieve();
+  CPPUNIT_ASSERT(queue.bytes() == 16);
+  CPPUNIT_ASSERT(queue.is_above_high_watermark());
+  delete queue.retrieve();
+  CPPUNIT_ASSERT(not queue.is_above_high_watermark());
+  CPPUNIT_ASSERT(queue.is_below_low_watermark());
+
+  queue.clear();
+  CPPUNIT_ASSERT(queue.bytes() == 0);
+
+  /* frames are accounted with their length */
+  rofl::crofframe *frame = new rofl::crofframe();
+  frame->append(20);
+  queue.store(frame);
+  CPPUNIT_ASSERT(queue.bytes() == 20);
+  queue.clear();
+
+  try {
+    queue.set_watermarks(8, 16);
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::eRofQueueInvalid &e) {
+  }
+}
+
+void crofqueuetest::testDeadline() {
+  uint32_t xid = 0;
+  rofl::crofqueue queue(2);
+
+  /* deadlines travel with their entries through ring and overflow list */
+  queue.set_queue_max_size(1);
+  for (unsigned int i = 0; i < 4; i++) {
+    queue.store(new rofl::openflow::cofmsg(rofl::openflow13::OFP_VERSION,
+                                           rofl::openflow13::OFPT_HELLO, xid++),
+                true, 1000 * i);
+  }
+  rofl::crofframe *frame = new rofl::crofframe();
+  frame->append(8);
+  queue.store(frame, true, 5000);
+
+  for (unsigned int i = 0; i < 4; i++) {
+    rofl::openflow::cofmsg *msg = nullptr;
+    uint64_t stamp = 1, deadline = 1;
+    CPPUNIT_ASSERT(queue.retrieve(msg, frame, stamp, deadline));
+    CPPUNIT_ASSERT(msg != nullptr);
+    CPPUNIT_ASSERT(frame == nullptr);
+    CPPUNIT_ASSERT(msg->get_xid() == i);
+    CPPUNIT_ASSERT(stamp == 0);
+    CPPUNIT_ASSERT(deadline == 1000 * i);
+    delete msg;
+  }
+
+  rofl::openflow::cofmsg *msg = nullptr;
+  uint64_t stamp = 0, deadline = 0;
+  CPPUNIT_ASSERT(queue.retrieve(msg, frame, stamp, deadline));
+  CPPUNIT_ASSERT(msg == nullptr);
+  CPPUNIT_ASSERT(frame != nullptr);
+  CPPUNIT_ASSERT(deadline == 5000);
+  delete frame;
+
+  CPPUNIT_ASSERT(queue.empty());
+  CPPUNIT_ASSERT(not queue.retrieve(msg, frame, stamp, deadline));
+}
+
+void crofqueuetest::testConcurrent() {
+  const unsigned int num_producers = 4;
+  const unsigned int count = 20000;
+  rofl::crofqueue queue(64);
+  queue.set_queue_max_size(64);
+
+  std::atomic<bool> done(false);
+  std::vector<uint32_t> next(num_producers, 0);
+  unsigned int received = 0;
+  bool in_order = true;
+
+  std::thread consumer([&]() {
+    while ((not done) || (not queue.empty())) {
+      rofl::openflow::cofmsg *msg = queue.retrieve();
+      if (nullptr == msg) {
+        std::this_thread::yield();
+        continue;
+      }
+      /* xid: producer in upper byte, sequence number below */
+      uint32_t producer = msg->get_xid() >> 24;
+      uint32_t seq = msg->get_xid() & 0x00ffffff;
+      in_order = in_order && (seq == next[producer]);
+      next[producer] = seq + 1;
+      received++;
+      delete msg;
+    }
+  });
+
+  std::vector<std::thread> producers;
+  for (unsigned int p = 0; p < num_producers; p++) {
+    producers.push_back(std::thread([&, p]() {
+      for (unsigned int i = 0; i < count; i++) {
+        rofl::openflow::cofmsg *msg = new rofl::openflow::cofmsg(
+            rofl::openflow13::OFP_VERSION, rofl::openflow13::OFPT_HELLO,
+            (p << 24) | i);
+        /* every 16th message enforced, spills over when the ring is full */
+        while (true) {
+          try {
+            queue.store(msg, (0 == (i % 16)));
+            break;
+          } catch (rofl::eRofQueueFull &e) {
+            std::this_thread::yield();
+          }
+        }
+      }
+    }));
+  }
+  for (auto &producer : producers) {
+    producer.join();
+  }
+  done = true;
+  consumer.join();
+
+  CPPUNIT_ASSERT(in_order);
+  CPPUNIT_ASSERT(received == num_producers * count);
+  CPPUNIT_ASSERT(queue.empty());
+}
+
+void crofqueuetest::testBenchmark() {
+  const unsigned int count = 1000000;
+  rofl::openflow::cofmsg msg(rofl::openflow13::OFP_VERSION,
+                             rofl::openflow13::OFPT_HELLO, 0);
+
+  /* uncontended: store and retrieve within a single thread */
+  rofl::crofqueue queue;
+  clistqueue reference;
+  rofl::ctimespec start = rofl::ctimespec::now();
+  for (unsigned int i = 0; i < count; i++) {
+    queue.store(&msg);
+    queue.capacity();
+    if (queue.empty() || (queue.retrieve() != &msg))
+      CPPUNIT_ASSERT(false);
+  }
+  rofl::ctimespec middle = rofl::ctimespec::now();
+  for (unsigned int i = 0; i < count; i++) {
+    reference.store(&msg);
+    reference.capacity();
+    if (reference.empty() || (reference.retrieve() != &msg))
+      CPPUNIT_ASSERT(false);
+  }
+  rofl::ctimespec stop = rofl::ctimespec::now();
+  std::cerr << "uncontended: crofqueue "
+            << (seconds(middle - start) * 1e9 / count) << " ns/msg, list+rwlock "
+            << (seconds(stop - middle) * 1e9 / count) << " ns/msg"
+            << std::endl;
+
+  /* contended: four producers, one consumer */
+  double ring_secs = contended<rofl::crofqueue>(count, &msg);
+  double list_secs = contended<clistqueue>(count, &msg);
+  std::cerr << "contended: crofqueue " << (ring_secs * 1e9 / count)
+            << " ns/msg, list+rwlock " << (list_secs * 1e9 / count)
+            << " ns/msg" << std::endl;
+}
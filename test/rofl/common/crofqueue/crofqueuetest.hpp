@@ -11,12 +11,20 @@
 #include <cppunit/TestFixture.h>
 #include <cppunit/extensions/HelperMacros.h>
 
+#include "rofl/common/cring_queue.hpp"
 #include "rofl/common/crofqueue.h"
 
 class crofqueuetest : public CppUnit::TestFixture {
   CPPUNIT_TEST_SUITE(crofqueuetest);
   CPPUNIT_TEST(test1);
   CPPUNIT_TEST(test2);
+  CPPUNIT_TEST(testFrames);
+  CPPUNIT_TEST(testRing);
+  CPPUNIT_TEST(testOverflow);
+  CPPUNIT_TEST(testBytes);
+  CPPUNIT_TEST(testDeadline);
+  CPPUNIT_TEST(testConcurrent);
+  CPPUNIT_TEST(testBenchmark);
   CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -26,6 +34,13 @@ public:
 public:
   void test1();
   void test2();
+  void testFrames();
+  void testRing();
+  void testOverflow();
+  void testBytes();
+  void testDeadline();
+  void testConcurrent();
+  void testBenchmark();
 };
 
 #endif /* TEST_SRC_ROFL_COMMON_OPENFLOW_MESSAGES_COFMSGAGGRSTATS_TEST_HPP_ */
@@ -5,17 +5,32 @@
  *      Author: andi
  */
 
+#include <sstream>
 #include <stdlib.h>
+#include <thread>
+#include <vector>
 
 #include <cppunit/extensions/TestFactoryRegistry.h>
 #include <cppunit/ui/text/TestRunner.h>
 
 #include "crofsocktest.hpp"
+#include "rofl/common/crofbuilder.hpp"
+#include "rofl/common/cthread_pool.hpp"
 
 using namespace rofl::openflow;
 
 CPPUNIT_TEST_SUITE_REGISTRATION(crofsocktest);
 
+namespace {
+
+std::string shm_path() {
+  std::stringstream sstr;
+  sstr << "/tmp/crofsocktest." << getpid() << ".sock";
+  return sstr.str();
+}
+
+}; // namespace
+
 void crofsocktest::setUp() { baddr = rofl::csockaddr(AF_INET, "0.0.0.0", 0); }
 
 void crofsocktest::tearDown() {}
@@ -85,6 +100,705 @@ void crofsocktest::test() {
   }
 }
 
+void crofsocktest::test_flowmod_burst() {
+  const unsigned int num_msgs = 200000;
+
+  test_mode = TEST_MODE_BENCH;
+
+  /* plain tcp peer, measures the transmit path only */
+  int lsd = socket(AF_INET, SOCK_STREAM, 0);
+  CPPUNIT_ASSERT(lsd >= 0);
+  struct sockaddr_in sin;
+  memset(&sin, 0, sizeof(sin));
+  sin.sin_family = AF_INET;
+  sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  socklen_t sinlen = sizeof(sin);
+  CPPUNIT_ASSERT(bind(lsd, (struct sockaddr *)&sin, sizeof(sin)) == 0);
+  CPPUNIT_ASSERT(listen(lsd, 1) == 0);
+  CPPUNIT_ASSERT(getsockname(lsd, (struct sockaddr *)&sin, &sinlen) == 0);
+
+  sclient = new rofl::crofsock(this);
+  sclient->set_txqueue_max_size(num_msgs);
+  sclient->set_raddr(rofl::csockaddr(rofl::caddress_in4("127.0.0.1"),
+                                     ntohs(sin.sin_port)))
+      .tcp_connect(false);
+
+  int asd = accept(lsd, NULL, NULL);
+  CPPUNIT_ASSERT(asd >= 0);
+  close(lsd);
+
+  unsigned int wait = 50;
+  while ((--wait > 0) && (not sclient->is_established())) {
+    usleep(100000);
+  }
+  CPPUNIT_ASSERT(wait > 0);
+
+  /* build messages in advance, timing covers queueing and transmission,
+   * every fourth flow-mod is a wire-format frame */
+  std::vector<cofmsg_flow_mod *> msgs;
+  std::vector<rofl::crofframe *> frames;
+  msgs.reserve(num_msgs);
+  frames.reserve(num_msgs);
+  for (unsigned int i = 0; i < num_msgs; i++) {
+    if (i % 4 == 3) {
+      msgs.push_back(nullptr);
+      frames.push_back(
+          rofl::crofbuilder_flow_mod(nullptr, rofl::cauxid(0),
+                                     rofl::openflow13::OFP_VERSION, i)
+              .table(1)
+              .priority(0x8000)
+              .cookie(i)
+              .release());
+      continue;
+    }
+    rofl::openflow::cofflowmod flowmod(rofl::openflow13::OFP_VERSION);
+    flowmod.set_table_id(1).set_priority(0x8000).set_cookie(i);
+    msgs.push_back(
+        new cofmsg_flow_mod(rofl::openflow13::OFP_VERSION, i, flowmod));
+    frames.push_back(nullptr);
+  }
+
+  /* receive and check framing and order of messages */
+  unsigned int num_rcvd = 0;
+  bool ordered = true;
+  std::thread receiver([&]() {
+    std::vector<uint8_t> buf(1 << 20);
+    size_t len = 0;
+    while (num_rcvd < num_msgs) {
+      ssize_t rc = recv(asd, buf.data() + len, buf.size() - len, 0);
+      if (rc <= 0)
+        return;
+      len += rc;
+      size_t offset = 0;
+      while (len - offset >= sizeof(struct rofl::openflow::ofp_header)) {
+        struct rofl::openflow::ofp_header *hdr =
+            (struct rofl::openflow::ofp_header *)(buf.data() + offset);
+        size_t msglen = be16toh(hdr->length);
+        if (len - offset < msglen)
+          break;
+        if ((be32toh(hdr->xid) != num_rcvd) ||
+            (hdr->type != rofl::openflow13::OFPT_FLOW_MOD))
+          ordered = false;
+        num_rcvd++;
+        offset += msglen;
+      }
+      memmove(buf.data(), buf.data() + offset, len - offset);
+      len -= offset;
+    }
+  });
+
+  rofl::ctimespec start(rofl::ctimespec::now());
+  for (unsigned int i = 0; i < num_msgs; i++) {
+    if (nullptr != frames[i]) {
+      CPPUNIT_ASSERT(sclient->send_frame(frames[i]) <
+                     rofl::crofsock::MSG_QUEUEING_FAILED_QUEUE_FULL);
+    } else {
+      CPPUNIT_ASSERT(sclient->send_message(msgs[i]) <
+                     rofl::crofsock::MSG_QUEUEING_FAILED_QUEUE_FULL);
+    }
+  }
+  receiver.join();
+  rofl::ctimespec delta = rofl::ctimespec::now() - start;
+
+  CPPUNIT_ASSERT(num_rcvd == num_msgs);
+  CPPUNIT_ASSERT(ordered);
+
+  double secs = delta.get_tspec().tv_sec + delta.get_tspec().tv_nsec / 1e9;
+  std::cerr << "sent " << num_msgs << " flow-mods in " << secs << "s ("
+            << (unsigned long)(num_msgs / secs) << " flow-mods/s)"
+            << std::endl;
+
+  sclient->close();
+  close(asd);
+  delete sclient;
+}
+
+void crofsocktest::test_recv_burst() {
+  const unsigned int num_msgs = 200000;
+
+  test_mode = TEST_MODE_RECV;
+  recv_counter = 0;
+  recv_ordered = true;
+
+  /* plain tcp peer, sends header-only barrier requests */
+  int lsd = socket(AF_INET, SOCK_STREAM, 0);
+  CPPUNIT_ASSERT(lsd >= 0);
+  struct sockaddr_in sin;
+  memset(&sin, 0, sizeof(sin));
+  sin.sin_family = AF_INET;
+  sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  socklen_t sinlen = sizeof(sin);
+  CPPUNIT_ASSERT(bind(lsd, (struct sockaddr *)&sin, sizeof(sin)) == 0);
+  CPPUNIT_ASSERT(listen(lsd, 1) == 0);
+  CPPUNIT_ASSERT(getsockname(lsd, (struct sockaddr *)&sin, &sinlen) == 0);
+
+  int csd = socket(AF_INET, SOCK_STREAM, 0);
+  CPPUNIT_ASSERT(csd >= 0);
+  CPPUNIT_ASSERT(connect(csd, (struct sockaddr *)&sin, sizeof(sin)) == 0);
+  int asd = accept(lsd, NULL, NULL);
+  CPPUNIT_ASSERT(asd >= 0);
+  close(lsd);
+
+  sserver = new rofl::crofsock(this);
+  sserver->tcp_accept(asd);
+
+  std::vector<uint8_t> buf(num_msgs *
+                           sizeof(struct rofl::openflow::ofp_header));
+  for (unsigned int i = 0; i < num_msgs; i++) {
+    struct rofl::openflow::ofp_header *hdr =
+        (struct rofl::openflow::ofp_header *)(buf.data() + i * sizeof(*hdr));
+    hdr->version = rofl::openflow13::OFP_VERSION;
+    hdr->type = rofl::openflow13::OFPT_BARRIER_REQUEST;
+    hdr->length = htobe16(sizeof(*hdr));
+    hdr->xid = htobe32(i);
+  }
+
+  rofl::ctimespec start(rofl::ctimespec::now());
+
+  /* odd chunk sizes split messages and headers across reads */
+  size_t offset = 0;
+  size_t chunk = 1;
+  while (offset < buf.size()) {
+    size_t len = std::min(chunk, buf.size() - offset);
+    ssize_t rc = send(csd, buf.data() + offset, len, MSG_NOSIGNAL);
+    CPPUNIT_ASSERT(rc > 0);
+    offset += rc;
+    chunk = (chunk * 7 + 3) % 40000 + 1;
+  }
+
+  unsigned int wait = 10000;
+  while ((--wait > 0) && (recv_counter < num_msgs)) {
+    usleep(1000);
+  }
+  rofl::ctimespec delta = rofl::ctimespec::now() - start;
+
+  CPPUNIT_ASSERT(recv_counter == num_msgs);
+  CPPUNIT_ASSERT(recv_ordered);
+
+  double secs = delta.get_tspec().tv_sec + delta.get_tspec().tv_nsec / 1e9;
+  std::cerr << "received " << num_msgs << " barrier requests in " << secs
+            << "s (" << (unsigned long)(num_msgs / secs) << " msgs/s)"
+            << std::endl;
+
+  close(csd);
+  sserver->close();
+  delete sserver;
+}
+
+void crofsocktest::test_recv_view() {
+  const unsigned int num_msgs = 4000;
+
+  test_mode = TEST_MODE_VIEW;
+  recv_counter = 0;
+  view_counter = 0;
+  kept_view = nullptr;
+
+  int lsd = socket(AF_INET, SOCK_STREAM, 0);
+  CPPUNIT_ASSERT(lsd >= 0);
+  struct sockaddr_in sin;
+  memset(&sin, 0, sizeof(sin));
+  sin.sin_family = AF_INET;
+  sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  socklen_t sinlen = sizeof(sin);
+  CPPUNIT_ASSERT(bind(lsd, (struct sockaddr *)&sin, sizeof(sin)) == 0);
+  CPPUNIT_ASSERT(listen(lsd, 1) == 0);
+  CPPUNIT_ASSERT(getsockname(lsd, (struct sockaddr *)&sin, &sinlen) == 0);
+
+  int csd = socket(AF_INET, SOCK_STREAM, 0);
+  CPPUNIT_ASSERT(csd >= 0);
+  CPPUNIT_ASSERT(connect(csd, (struct sockaddr *)&sin, sizeof(sin)) == 0);
+  int asd = accept(lsd, NULL, NULL);
+  CPPUNIT_ASSERT(asd >= 0);
+  close(lsd);
+
+  sserver = new rofl::crofsock(this);
+  sserver->set_rx_view(rofl::openflow13::OFPT_PACKET_IN);
+  CPPUNIT_ASSERT(sserver->get_rx_view(rofl::openflow13::OFPT_PACKET_IN));
+  CPPUNIT_ASSERT(not sserver->get_rx_view(rofl::openflow13::OFPT_HELLO));
+  sserver->tcp_accept(asd);
+
+  /* packet-ins exceeding rxbuffer, each followed by a barrier request */
+  uint8_t data[128];
+  memset(data, 0xa5, sizeof(data));
+  rofl::openflow::cofmatch match(rofl::openflow13::OFP_VERSION);
+  match.set_in_port(1);
+  for (unsigned int i = 0; i < num_msgs; i++) {
+    cofmsg_packet_in msg(rofl::openflow13::OFP_VERSION, i, 0, sizeof(data), 0,
+                         0, 0, 0, match, data, sizeof(data));
+    cofmsg_barrier_request barrier(rofl::openflow13::OFP_VERSION, i);
+    rofl::cmemory mem(msg.length() + barrier.length());
+    msg.pack(mem.somem(), msg.length());
+    barrier.pack(mem.somem() + msg.length(), barrier.length());
+    CPPUNIT_ASSERT(send(csd, mem.somem(), mem.length(), MSG_NOSIGNAL) ==
+                   (ssize_t)mem.length());
+  }
+
+  unsigned int wait = 10000;
+  while ((--wait > 0) && (recv_counter < num_msgs * 3 / 2)) {
+    usleep(1000);
+  }
+
+  /* odd packet-ins declined and parsed, barriers always parsed */
+  CPPUNIT_ASSERT(view_counter == num_msgs);
+  CPPUNIT_ASSERT(recv_counter == num_msgs * 3 / 2);
+
+  /* first view survived reuse of rxbuffer */
+  CPPUNIT_ASSERT(kept_view != nullptr);
+  rofl::openflow::cofmsg_packet_in_view pin(*kept_view);
+  CPPUNIT_ASSERT(pin.get_xid() == 0);
+  CPPUNIT_ASSERT(pin.get_in_port() == 1);
+  CPPUNIT_ASSERT(pin.get_datalen() == sizeof(data));
+  CPPUNIT_ASSERT(memcmp(pin.get_data(), data, sizeof(data)) == 0);
+  delete kept_view;
+
+  close(csd);
+  sserver->close();
+  delete sserver;
+}
+
+void crofsocktest::wait_established() {
+  unsigned int wait = 5000;
+  while ((--wait > 0) &&
+         (not(sclient->is_established() && (nullptr != sserver) &&
+              sserver->is_established()))) {
+    usleep(1000);
+  }
+  CPPUNIT_ASSERT(wait > 0);
+}
+
+void crofsocktest::test_reconnect_pending() {
+  const unsigned int num_msgs = 20000;
+  const uint32_t stale_xid = 0x80000000;
+
+  test_mode = TEST_MODE_RECV;
+  recv_counter = 0;
+  recv_ordered = true;
+  congestion_counter = 0;
+
+  int lsd = socket(AF_INET, SOCK_STREAM, 0);
+  CPPUNIT_ASSERT(lsd >= 0);
+  struct sockaddr_in sin;
+  memset(&sin, 0, sizeof(sin));
+  sin.sin_family = AF_INET;
+  sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  socklen_t sinlen = sizeof(sin);
+  CPPUNIT_ASSERT(bind(lsd, (struct sockaddr *)&sin, sizeof(sin)) == 0);
+  CPPUNIT_ASSERT(listen(lsd, 2) == 0);
+  CPPUNIT_ASSERT(getsockname(lsd, (struct sockaddr *)&sin, &sinlen) == 0);
+
+  /* a strict class fills the txbuffer within a single round */
+  sclient = new rofl::crofsock(this);
+  sclient->set_txqueue_max_size(num_msgs);
+  sclient->set_txclass(rofl::crofsock::QUEUE_PKT, 0, true);
+  sclient->set_raddr(rofl::csockaddr(rofl::caddress_in4("127.0.0.1"),
+                                     ntohs(sin.sin_port)));
+
+  /* first connection with a stalled receiver */
+  sserver = nullptr;
+  sclient->tcp_connect(false);
+  int asd = accept(lsd, NULL, NULL);
+  CPPUNIT_ASSERT(asd >= 0);
+  rofl::crofsock *server = new rofl::crofsock(this);
+  server->rx_disable();
+  server->tcp_accept(asd);
+  sserver = server;
+  wait_established();
+
+  /* fill socket and txbuffer until a retrieved message does not fit anymore
+   */
+  uint8_t data[1024];
+  memset(data, 0, sizeof(data));
+  for (unsigned int i = 0; i < num_msgs; i++) {
+    CPPUNIT_ASSERT(sclient->send_message(new cofmsg_packet_out(
+                       rofl::openflow13::OFP_VERSION, stale_xid + i,
+                       rofl::openflow::OFP_NO_BUFFER,
+                       rofl::openflow::OFPP_CONTROLLER,
+                       rofl::openflow::cofactions(rofl::openflow13::OFP_VERSION),
+                       data, sizeof(data))) <
+                   rofl::crofsock::MSG_QUEUEING_FAILED_QUEUE_FULL);
+  }
+  unsigned int wait = 5000;
+  while ((--wait > 0) && (0 == congestion_counter)) {
+    usleep(1000);
+  }
+  CPPUNIT_ASSERT(congestion_counter > 0);
+
+  sclient->close();
+  sserver->close();
+  delete sserver;
+  CPPUNIT_ASSERT(0 == recv_counter);
+
+  /* second connection must not see anything from the first one */
+  sserver = nullptr;
+  sclient->tcp_connect(false);
+  asd = accept(lsd, NULL, NULL);
+  CPPUNIT_ASSERT(asd >= 0);
+  server = new rofl::crofsock(this);
+  server->tcp_accept(asd);
+  sserver = server;
+  wait_established();
+
+  for (unsigned int i = 0; i < 10; i++) {
+    CPPUNIT_ASSERT(sclient->send_message(new cofmsg_barrier_request(
+                       rofl::openflow13::OFP_VERSION, i)) <
+                   rofl::crofsock::MSG_QUEUEING_FAILED_QUEUE_FULL);
+  }
+  wait = 5000;
+  while ((--wait > 0) && (recv_counter < 10)) {
+    usleep(1000);
+  }
+  CPPUNIT_ASSERT(recv_counter == 10);
+  CPPUNIT_ASSERT(recv_ordered);
+
+  sclient->close();
+  sserver->close();
+  close(lsd);
+  delete sclient;
+  delete sserver;
+}
+
+void crofsocktest::test_watermark_resume() {
+  const unsigned int num_rounds = 500;
+
+  test_mode = TEST_MODE_RECV;
+  recv_counter = 0;
+  recv_ordered = true;
+  congestion_counter = 0;
+  solved_counter = 0;
+
+  int lsd = socket(AF_INET, SOCK_STREAM, 0);
+  CPPUNIT_ASSERT(lsd >= 0);
+  struct sockaddr_in sin;
+  memset(&sin, 0, sizeof(sin));
+  sin.sin_family = AF_INET;
+  sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  socklen_t sinlen = sizeof(sin);
+  CPPUNIT_ASSERT(bind(lsd, (struct sockaddr *)&sin, sizeof(sin)) == 0);
+  CPPUNIT_ASSERT(listen(lsd, 1) == 0);
+  CPPUNIT_ASSERT(getsockname(lsd, (struct sockaddr *)&sin, &sinlen) == 0);
+
+  /* the socket stays writable, only the high watermark indicates
+   * congestion */
+  sserver = nullptr;
+  sclient = new rofl::crofsock(this);
+  sclient->set_txqueue_watermarks(rofl::crofsock::QUEUE_FLOW, 512, 128);
+  sclient
+      ->set_raddr(rofl::csockaddr(rofl::caddress_in4("127.0.0.1"),
+                                  ntohs(sin.sin_port)))
+      .tcp_connect(false);
+  int asd = accept(lsd, NULL, NULL);
+  CPPUNIT_ASSERT(asd >= 0);
+  close(lsd);
+  rofl::crofsock *server = new rofl::crofsock(this);
+  server->tcp_accept(asd);
+  sserver = server;
+  wait_established();
+
+  /* an application pausing on congestion must be resumed each time */
+  uint32_t xid = 0;
+  for (unsigned int round = 0; round < num_rounds; round++) {
+    unsigned int solved = solved_counter;
+    rofl::crofsock::msg_result_t result;
+    do {
+      result = sclient->send_message(
+          new cofmsg_barrier_request(rofl::openflow13::OFP_VERSION, xid++));
+      CPPUNIT_ASSERT(result < rofl::crofsock::MSG_QUEUEING_FAILED_QUEUE_FULL);
+    } while (rofl::crofsock::MSG_QUEUED == result);
+
+    unsigned int wait = 2000;
+    while ((--wait > 0) && (solved_counter == solved)) {
+      usleep(1000);
+    }
+    CPPUNIT_ASSERT(solved_counter > solved);
+  }
+
+  unsigned int wait = 5000;
+  while ((--wait > 0) && (recv_counter < xid)) {
+    usleep(1000);
+  }
+  CPPUNIT_ASSERT(recv_counter == xid);
+  CPPUNIT_ASSERT(recv_ordered);
+
+  sclient->close();
+  sserver->close();
+  delete sclient;
+  delete sserver;
+}
+
+void crofsocktest::test_shm() {
+  const unsigned int num_msgs = 20000;
+
+  test_mode = TEST_MODE_SHM;
+  recv_counter = 0;
+  recv_ordered = true;
+  congestion_counter = 0;
+  solved_counter = 0;
+  sserver = nullptr;
+
+  std::string path = shm_path();
+  slisten = new rofl::crofsock(this);
+  slisten->set_baddr(rofl::csockaddr(AF_UNIX, path, 0)).listen();
+
+  /* a small ring fills up quickly */
+  sclient = new rofl::crofsock(this);
+  sclient->set_shm_ring_size(4096).set_txqueue_max_size(num_msgs);
+  sclient->set_raddr(rofl::csockaddr(AF_UNIX, path, 0)).shm_connect(false);
+  wait_established();
+
+  CPPUNIT_ASSERT(sclient->is_shm());
+  CPPUNIT_ASSERT(sserver->is_shm());
+  CPPUNIT_ASSERT(sclient->get_raddr().str() == "unix:" + path);
+
+  /* stalled receiver: the ring fills up and congestion is indicated */
+  sserver->rx_disable();
+  for (unsigned int i = 0; i < num_msgs; i++) {
+    CPPUNIT_ASSERT(sclient->send_message(new cofmsg_barrier_request(
+                       rofl::openflow13::OFP_VERSION, i)) <
+                   rofl::crofsock::MSG_QUEUEING_FAILED_QUEUE_FULL);
+  }
+  unsigned int wait = 5000;
+  while ((--wait > 0) && (0 == congestion_counter)) {
+    usleep(1000);
+  }
+  CPPUNIT_ASSERT(congestion_counter > 0);
+  CPPUNIT_ASSERT(sclient->is_congested());
+  CPPUNIT_ASSERT(0 == recv_counter);
+
+  /* draining the ring solves congestion */
+  sserver->rx_enable();
+  wait = 10000;
+  while ((--wait > 0) && ((recv_counter < num_msgs) || (0 == solved_counter))) {
+    usleep(1000);
+  }
+  CPPUNIT_ASSERT(recv_counter == num_msgs);
+  CPPUNIT_ASSERT(recv_ordered);
+  CPPUNIT_ASSERT(solved_counter > 0);
+
+  /* closing the unix domain socket shuts down the peer */
+  sclient->close();
+  wait = 5000;
+  while ((--wait > 0) && sserver->is_established()) {
+    usleep(1000);
+  }
+  CPPUNIT_ASSERT(not sserver->is_established());
+
+  slisten->close();
+  sserver->close();
+  delete slisten;
+  delete sclient;
+  delete sserver;
+  unlink(path.c_str());
+}
+
+void crofsocktest::test_shm_bench() {
+  const unsigned int num_msgs = 200000;
+  double rate[2];
+
+  /* the same crofsock pair over loopback tcp and over shared memory */
+  for (unsigned int shm = 0; shm < 2; shm++) {
+    test_mode = TEST_MODE_SHM;
+    recv_counter = 0;
+    recv_ordered = true;
+    sserver = nullptr;
+    slisten = nullptr;
+
+    std::string path = shm_path();
+    sclient = new rofl::crofsock(this);
+    sclient->set_txqueue_max_size(num_msgs);
+
+    if (shm) {
+      slisten = new rofl::crofsock(this);
+      slisten->set_baddr(rofl::csockaddr(AF_UNIX, path, 0)).listen();
+      sclient->set_raddr(rofl::csockaddr(AF_UNIX, path, 0)).shm_connect(false);
+    } else {
+      int lsd = socket(AF_INET, SOCK_STREAM, 0);
+      CPPUNIT_ASSERT(lsd >= 0);
+      struct sockaddr_in sin;
+      memset(&sin, 0, sizeof(sin));
+      sin.sin_family = AF_INET;
+      sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+      socklen_t sinlen = sizeof(sin);
+      CPPUNIT_ASSERT(bind(lsd, (struct sockaddr *)&sin, sizeof(sin)) == 0);
+      CPPUNIT_ASSERT(listen(lsd, 1) == 0);
+      CPPUNIT_ASSERT(getsockname(lsd, (struct sockaddr *)&sin, &sinlen) == 0);
+
+      sclient
+          ->set_raddr(rofl::csockaddr(rofl::caddress_in4("127.0.0.1"),
+                                      ntohs(sin.sin_port)))
+          .tcp_connect(false);
+
+      int asd = accept(lsd, NULL, NULL);
+      CPPUNIT_ASSERT(asd >= 0);
+      close(lsd);
+
+      rofl::crofsock *server = new rofl::crofsock(this);
+      server->tcp_accept(asd);
+      sserver = server;
+    }
+    wait_established();
+
+    std::vector<cofmsg_flow_mod *> msgs;
+    msgs.reserve(num_msgs);
+    for (unsigned int i = 0; i < num_msgs; i++) {
+      rofl::openflow::cofflowmod flowmod(rofl::openflow13::OFP_VERSION);
+      flowmod.set_table_id(1).set_priority(0x8000).set_cookie(i);
+      msgs.push_back(
+          new cofmsg_flow_mod(rofl::openflow13::OFP_VERSION, i, flowmod));
+    }
+
+    /* timing covers queueing, transmission, reception and parsing */
+    rofl::ctimespec start(rofl::ctimespec::now());
+    for (unsigned int i = 0; i < num_msgs; i++) {
+      CPPUNIT_ASSERT(sclient->send_message(msgs[i]) <
+                     rofl::crofsock::MSG_QUEUEING_FAILED_QUEUE_FULL);
+    }
+    unsigned int wait = 30000;
+    while ((--wait > 0) && (recv_counter < num_msgs)) {
+      usleep(100);
+    }
+    rofl::ctimespec delta = rofl::ctimespec::now() - start;
+
+    CPPUNIT_ASSERT(recv_counter == num_msgs);
+    CPPUNIT_ASSERT(recv_ordered);
+
+    double secs = delta.get_tspec().tv_sec + delta.get_tspec().tv_nsec / 1e9;
+    rate[shm] = num_msgs / secs;
+    std::cerr << (shm ? "shared memory: " : "loopback tcp: ") << num_msgs
+              << " flow-mods in " << secs << "s ("
+              << (unsigned long)rate[shm] << " flow-mods/s)" << std::endl;
+
+    sclient->close();
+    sserver->close();
+    if (slisten) {
+      slisten->close();
+      delete slisten;
+    }
+    delete sclient;
+    delete sserver;
+    unlink(path.c_str());
+  }
+
+  std::cerr << "shared memory vs. loopback tcp: " << rate[1] / rate[0] << "x"
+            << std::endl;
+}
+
+void crofsocktest::test_uring() {
+  const unsigned int num_msgs = 200000;
+
+  test_mode = TEST_MODE_RECV;
+  recv_counter = 0;
+  recv_ordered = true;
+
+  rofl::cthread_pool pool(1, "crofsock_uring", rofl::ENGINE_IO_URING);
+
+  int lsd = socket(AF_INET, SOCK_STREAM, 0);
+  CPPUNIT_ASSERT(lsd >= 0);
+  struct sockaddr_in sin;
+  memset(&sin, 0, sizeof(sin));
+  sin.sin_family = AF_INET;
+  sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  socklen_t sinlen = sizeof(sin);
+  CPPUNIT_ASSERT(bind(lsd, (struct sockaddr *)&sin, sizeof(sin)) == 0);
+  CPPUNIT_ASSERT(listen(lsd, 1) == 0);
+  CPPUNIT_ASSERT(getsockname(lsd, (struct sockaddr *)&sin, &sinlen) == 0);
+
+  int csd = socket(AF_INET, SOCK_STREAM, 0);
+  CPPUNIT_ASSERT(csd >= 0);
+  CPPUNIT_ASSERT(connect(csd, (struct sockaddr *)&sin, sizeof(sin)) == 0);
+  int asd = accept(lsd, NULL, NULL);
+  CPPUNIT_ASSERT(asd >= 0);
+  close(lsd);
+
+  sserver = new rofl::crofsock(this, &pool);
+  sserver->tcp_accept(asd);
+
+  /* plain tcp sockets on an io_uring reactor bypass read events */
+  CPPUNIT_ASSERT(sserver->is_uring() ==
+                 (pool.get_engine() == rofl::ENGINE_IO_URING));
+
+  std::vector<uint8_t> buf(num_msgs *
+                           sizeof(struct rofl::openflow::ofp_header));
+  for (unsigned int i = 0; i < num_msgs; i++) {
+    struct rofl::openflow::ofp_header *hdr =
+        (struct rofl::openflow::ofp_header *)(buf.data() + i * sizeof(*hdr));
+    hdr->version = rofl::openflow13::OFP_VERSION;
+    hdr->type = rofl::openflow13::OFPT_BARRIER_REQUEST;
+    hdr->length = htobe16(sizeof(*hdr));
+    hdr->xid = htobe32(i);
+  }
+
+  /* odd chunk sizes split messages across completions, data received
+   * while reception is disabled is kept */
+  size_t offset = 0;
+  size_t chunk = 1;
+  bool paused = false;
+  while (offset < buf.size()) {
+    if ((not paused) && (offset >= buf.size() / 2)) {
+      sserver->rx_disable();
+      CPPUNIT_ASSERT(send(csd, buf.data() + offset, 65536, MSG_NOSIGNAL) ==
+                     65536);
+      offset += 65536;
+      usleep(50000);
+      sserver->rx_enable();
+      paused = true;
+    }
+    size_t len = std::min(chunk, buf.size() - offset);
+    ssize_t rc = send(csd, buf.data() + offset, len, MSG_NOSIGNAL);
+    CPPUNIT_ASSERT(rc > 0);
+    offset += rc;
+    chunk = (chunk * 7 + 3) % 40000 + 1;
+  }
+
+  unsigned int wait = 10000;
+  while ((--wait > 0) && (recv_counter < num_msgs)) {
+    usleep(1000);
+  }
+  CPPUNIT_ASSERT(recv_counter == num_msgs);
+  CPPUNIT_ASSERT(recv_ordered);
+
+  /* messages sent by chains of linked sends arrive in order */
+  std::atomic_uint sent_ordered(0);
+  std::thread reader([csd, num_msgs, &sent_ordered]() {
+    std::vector<uint8_t> rbuf(num_msgs *
+                              sizeof(struct rofl::openflow::ofp_header));
+    size_t rlen = 0;
+    while (rlen < rbuf.size()) {
+      ssize_t rc = recv(csd, rbuf.data() + rlen, rbuf.size() - rlen, 0);
+      if (rc <= 0)
+        return;
+      rlen += rc;
+    }
+    unsigned int ordered = 0;
+    for (unsigned int i = 0; i < num_msgs; i++) {
+      struct rofl::openflow::ofp_header *hdr =
+          (struct rofl::openflow::ofp_header *)(rbuf.data() +
+                                                i * sizeof(*hdr));
+      if ((hdr->type == rofl::openflow13::OFPT_BARRIER_REQUEST) &&
+          (be32toh(hdr->xid) == i))
+        ordered++;
+    }
+    sent_ordered = ordered;
+  });
+
+  for (uint32_t xid = 0; xid < num_msgs;) {
+    rofl::crofsock::msg_result_t result = sserver->send_message(
+        new cofmsg_barrier_request(rofl::openflow13::OFP_VERSION, xid));
+    CPPUNIT_ASSERT(result !=
+                   rofl::crofsock::MSG_QUEUEING_FAILED_NOT_ESTABLISHED);
+    if (result <= rofl::crofsock::MSG_QUEUED_CONGESTION) {
+      xid++;
+    } else {
+      usleep(100);
+    }
+  }
+  reader.join();
+  CPPUNIT_ASSERT(sent_ordered == num_msgs);
+
+  close(csd);
+  sserver->close();
+  delete sserver;
+}
+
 void crofsocktest::test_tls() {
   try {
     test_mode = TEST_MODE_TLS;
@@ -163,6 +877,9 @@ void crofsocktest::handle_listen(rofl::crofsock &socket) {
           .set_tls_keyfile("../../../../../tools/xca/server.key.pem")
           .tls_accept(sd);
     } break;
+    case TEST_MODE_SHM: {
+      sserver->shm_accept(sd);
+    } break;
     default: {};
     }
   }
@@ -238,14 +955,35 @@ void crofsocktest::handle_closed(rofl::crofsock &socket) {
 
 void crofsocktest::congestion_solved_indication(rofl::crofsock &socket) {
   std::cerr << "handle send" << std::endl;
+  solved_counter++;
 }
 
 void crofsocktest::congestion_occurred_indication(rofl::crofsock &socket) {
   std::cerr << "congestion indication" << std::endl;
+  congestion_counter++;
 }
 
 void crofsocktest::handle_recv(rofl::crofsock &socket,
                                rofl::openflow::cofmsg *msg) {
+  if (TEST_MODE_VIEW == test_mode) {
+    /* declined packet-ins and barrier requests */
+    if ((msg->get_type() == rofl::openflow13::OFPT_BARRIER_REQUEST) ||
+        ((msg->get_type() == rofl::openflow13::OFPT_PACKET_IN) &&
+         (msg->get_xid() % 2)))
+      recv_counter++;
+    delete msg;
+    return;
+  }
+
+  if ((TEST_MODE_RECV == test_mode) || (TEST_MODE_SHM == test_mode)) {
+    /* messages arrive in order of sending */
+    if (msg->get_xid() != recv_counter)
+      recv_ordered = false;
+    recv_counter++;
+    delete msg;
+    return;
+  }
+
   if (&socket == sserver) {
     std::cerr << "sserver => handle recv " << std::endl << *msg;
     delete msg;
@@ -285,6 +1023,17 @@ void crofsocktest::handle_recv(rofl::crofsock &socket,
   }
 }
 
+bool crofsocktest::handle_recv_view(rofl::crofsock &socket,
+                                    const rofl::openflow::cofmsg_view &view) {
+  CPPUNIT_ASSERT(view.get_type() == rofl::openflow13::OFPT_PACKET_IN);
+  view_counter++;
+  if (view.get_xid() == 0) {
+    kept_view = new rofl::openflow::cofmsg_view(view);
+  }
+  /* even xids are consumed */
+  return ((view.get_xid() % 2) == 0);
+}
+
 void crofsocktest::handle_tls_connect_failed(rofl::crofsock &socket) {
   std::cerr << "handle tls connect failed" << std::endl;
 }
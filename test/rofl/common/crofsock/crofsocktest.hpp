@@ -18,6 +18,14 @@
 class crofsocktest : public CppUnit::TestFixture, public rofl::crofsock_env {
   CPPUNIT_TEST_SUITE(crofsocktest);
   CPPUNIT_TEST(test);
+  CPPUNIT_TEST(test_flowmod_burst);
+  CPPUNIT_TEST(test_recv_burst);
+  CPPUNIT_TEST(test_recv_view);
+  CPPUNIT_TEST(test_reconnect_pending);
+  CPPUNIT_TEST(test_watermark_resume);
+  CPPUNIT_TEST(test_shm);
+  CPPUNIT_TEST(test_shm_bench);
+  CPPUNIT_TEST(test_uring);
   //	CPPUNIT_TEST( test_tls );
   CPPUNIT_TEST_SUITE_END();
 
@@ -28,8 +36,18 @@ public:
 public:
   void test();
   void test_tls();
+  void test_flowmod_burst();
+  void test_recv_burst();
+  void test_recv_view();
+  void test_reconnect_pending();
+  void test_watermark_resume();
+  void test_shm();
+  void test_shm_bench();
+  void test_uring();
 
 private:
+  void wait_established();
+
   virtual void handle_listen(rofl::crofsock &socket);
 
   virtual void handle_tcp_connect_refused(rofl::crofsock &socket);
@@ -58,12 +76,19 @@ private:
 
   virtual void handle_recv(rofl::crofsock &socket, rofl::openflow::cofmsg *msg);
 
+  virtual bool handle_recv_view(rofl::crofsock &socket,
+                                const rofl::openflow::cofmsg_view &view);
+
   virtual void congestion_occurred_indication(rofl::crofsock &socket);
 
 private:
   enum crofsock_test_mode_t {
     TEST_MODE_TCP = 1,
     TEST_MODE_TLS = 2,
+    TEST_MODE_BENCH = 3,
+    TEST_MODE_RECV = 4,
+    TEST_MODE_VIEW = 5,
+    TEST_MODE_SHM = 6,
   };
 
   enum crofsock_test_mode_t test_mode;
@@ -72,6 +97,12 @@ private:
   int msg_counter;
   std::atomic_int server_msg_counter;
   int client_msg_counter;
+  std::atomic_uint recv_counter;
+  std::atomic_bool recv_ordered;
+  std::atomic_uint view_counter;
+  std::atomic_uint congestion_counter;
+  std::atomic_uint solved_counter;
+  rofl::openflow::cofmsg_view *kept_view;
   rofl::crandom rand;
   uint16_t listening_port;
   rofl::csockaddr baddr;
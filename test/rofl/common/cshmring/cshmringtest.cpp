@@ -0,0 +1,199 @@
+/*
+ * cshmringtest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "cshmringtest.hpp"
+
+CPPUNIT_TEST_SUITE_REGISTRATION(cshmringtest);
+
+namespace {
+
+/* creates a ring and attaches a peer via a pair of unix domain sockets */
+void connect(std::unique_ptr<rofl::cshmring> &a,
+             std::unique_ptr<rofl::cshmring> &b, size_t ring_size) {
+  int sv[2];
+  CPPUNIT_ASSERT(::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, sv) ==
+                 0);
+
+  /* nothing handed over yet */
+  CPPUNIT_ASSERT(rofl::cshmring::attach(sv[1]) == nullptr);
+
+  a.reset(new rofl::cshmring(ring_size));
+  a->send_fds(sv[0]);
+  b.reset(rofl::cshmring::attach(sv[1]));
+  CPPUNIT_ASSERT(b != nullptr);
+  CPPUNIT_ASSERT(b->get_ring_size() == ring_size);
+
+  ::close(sv[0]);
+  ::close(sv[1]);
+}
+
+bool readable(int fd, int timeout_ms = 0) {
+  struct pollfd pfd;
+  pfd.fd = fd;
+  pfd.events = POLLIN;
+  pfd.revents = 0;
+  return (::poll(&pfd, 1, timeout_ms) == 1) && (pfd.revents & POLLIN);
+}
+
+}; // namespace
+
+void cshmringtest::setUp() {}
+
+void cshmringtest::tearDown() {}
+
+void cshmringtest::testAttach() {
+  std::unique_ptr<rofl::cshmring> a, b;
+  connect(a, b, 4096);
+
+  /* both directions */
+  uint8_t buf[16];
+  CPPUNIT_ASSERT(a->write((const uint8_t *)"ping", 4) == 4);
+  CPPUNIT_ASSERT(b->rx_bytes() == 4);
+  CPPUNIT_ASSERT(b->read(buf, sizeof(buf)) == 4);
+  CPPUNIT_ASSERT(memcmp(buf, "ping", 4) == 0);
+
+  CPPUNIT_ASSERT(b->write((const uint8_t *)"pong", 4) == 4);
+  CPPUNIT_ASSERT(a->read(buf, sizeof(buf)) == 4);
+  CPPUNIT_ASSERT(memcmp(buf, "pong", 4) == 0);
+  CPPUNIT_ASSERT(a->read(buf, sizeof(buf)) == 0);
+  CPPUNIT_ASSERT(b->read(buf, sizeof(buf)) == 0);
+
+  /* invalid ring sizes */
+  try {
+    rofl::cshmring ring(4097);
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::eInvalid &e) {
+  }
+
+  /* a closed peer socket is reported */
+  int sv[2];
+  CPPUNIT_ASSERT(::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, sv) ==
+                 0);
+  ::close(sv[0]);
+  try {
+    rofl::cshmring::attach(sv[1]);
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::eInvalid &e) {
+  }
+  ::close(sv[1]);
+}
+
+void cshmringtest::testWrap() {
+  std::unique_ptr<rofl::cshmring> a, b;
+  connect(a, b, 4096);
+
+  /* odd chunk sizes move the indices across the end of the ring */
+  std::vector<uint8_t> out(1000), in(1000);
+  uint8_t seq = 0;
+  for (unsigned int i = 0; i < 100; i++) {
+    for (auto &c : out) {
+      c = seq++;
+    }
+    CPPUNIT_ASSERT(a->write(out.data(), out.size()) == out.size());
+    CPPUNIT_ASSERT(b->read(in.data(), in.size()) == in.size());
+    CPPUNIT_ASSERT(in == out);
+  }
+
+  /* partial writes when the ring is full */
+  std::vector<uint8_t> big(8192, 0x5a);
+  CPPUNIT_ASSERT(a->write(big.data(), big.size()) == 4096);
+  CPPUNIT_ASSERT(a->tx_space() == 0);
+  CPPUNIT_ASSERT(a->write(big.data(), big.size()) == 0);
+  CPPUNIT_ASSERT(b->read(big.data(), 100) == 100);
+  CPPUNIT_ASSERT(a->tx_space() == 100);
+  CPPUNIT_ASSERT(b->read(big.data(), big.size()) == 3996);
+}
+
+void cshmringtest::testDoorbells() {
+  std::unique_ptr<rofl::cshmring> a, b;
+  connect(a, b, 4096);
+
+  uint8_t buf[4096];
+
+  /* a busy stream does not ring */
+  CPPUNIT_ASSERT(a->write(buf, 10) == 10);
+  CPPUNIT_ASSERT(not readable(b->get_rx_fd()));
+
+  /* an empty read announces waiting, the next write rings */
+  CPPUNIT_ASSERT(b->read(buf, sizeof(buf)) == 10);
+  CPPUNIT_ASSERT(b->read(buf, sizeof(buf)) == 0);
+  CPPUNIT_ASSERT(a->write(buf, 10) == 10);
+  CPPUNIT_ASSERT(readable(b->get_rx_fd()));
+  rofl::cshmring::clear_fd(b->get_rx_fd());
+  CPPUNIT_ASSERT(not readable(b->get_rx_fd()));
+  CPPUNIT_ASSERT(b->read(buf, sizeof(buf)) == 10);
+
+  /* a full ring announces waiting, the next read rings */
+  CPPUNIT_ASSERT(a->write(buf, sizeof(buf)) == 4096);
+  CPPUNIT_ASSERT(a->write(buf, sizeof(buf)) == 0);
+  CPPUNIT_ASSERT(not readable(a->get_tx_fd()));
+  CPPUNIT_ASSERT(b->read(buf, 1) == 1);
+  CPPUNIT_ASSERT(readable(a->get_tx_fd()));
+  rofl::cshmring::clear_fd(a->get_tx_fd());
+  CPPUNIT_ASSERT(b->read(buf, 1) == 1);
+  CPPUNIT_ASSERT(not readable(a->get_tx_fd()));
+}
+
+void cshmringtest::testConcurrent() {
+  std::unique_ptr<rofl::cshmring> a, b;
+  connect(a, b, 65536);
+
+  const size_t total = 64 << 20;
+
+  /* producer and consumer sleep on their doorbells only */
+  std::thread producer([&]() {
+    std::vector<uint8_t> buf(1500);
+    size_t sent = 0;
+    uint8_t seq = 0;
+    while (sent < total) {
+      size_t len = std::min(buf.size(), total - sent);
+      for (size_t i = 0; i < len; i++) {
+        buf[i] = seq + i;
+      }
+      size_t off = 0;
+      while (off < len) {
+        size_t n = a->write(buf.data() + off, len - off);
+        if (0 == n) {
+          readable(a->get_tx_fd(), 100);
+          rofl::cshmring::clear_fd(a->get_tx_fd());
+          continue;
+        }
+        off += n;
+      }
+      seq += len;
+      sent += len;
+    }
+  });
+
+  std::vector<uint8_t> buf(4096);
+  size_t rcvd = 0;
+  uint8_t seq = 0;
+  bool in_order = true;
+  while (rcvd < total) {
+    size_t n = b->read(buf.data(), buf.size());
+    if (0 == n) {
+      readable(b->get_rx_fd(), 100);
+      rofl::cshmring::clear_fd(b->get_rx_fd());
+      continue;
+    }
+    for (size_t i = 0; i < n; i++) {
+      in_order = in_order && (buf[i] == seq++);
+    }
+    rcvd += n;
+  }
+  producer.join();
+
+  CPPUNIT_ASSERT(in_order);
+  CPPUNIT_ASSERT(b->rx_bytes() == 0);
+}
@@ -0,0 +1,34 @@
+/*
+ * cshmringtest.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef TEST_SRC_ROFL_COMMON_CSHMRING_TEST_HPP_
+#define TEST_SRC_ROFL_COMMON_CSHMRING_TEST_HPP_
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "rofl/common/cshmring.hpp"
+
+class cshmringtest : public CppUnit::TestFixture {
+  CPPUNIT_TEST_SUITE(cshmringtest);
+  CPPUNIT_TEST(testAttach);
+  CPPUNIT_TEST(testWrap);
+  CPPUNIT_TEST(testDoorbells);
+  CPPUNIT_TEST(testConcurrent);
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void setUp();
+  void tearDown();
+
+public:
+  void testAttach();
+  void testWrap();
+  void testDoorbells();
+  void testConcurrent();
+};
+
+#endif /* TEST_SRC_ROFL_COMMON_CSHMRING_TEST_HPP_ */
@@ -1,4 +1,6 @@
 #include <stdlib.h>
+#include <thread>
+#include <vector>
 
 #include <cppunit/extensions/TestFactoryRegistry.h>
 #include <cppunit/ui/text/TestRunner.h>
@@ -26,6 +28,167 @@ void cthread_test::test1() {
   CPPUNIT_ASSERT(keep_running > 0);
 }
 
+void cthread_test::test_rearm() {
+  const unsigned int num_timers = 1000;
+  const unsigned int num_rearms = 1000000;
+
+  /* re-arm timers like crofconn's lifecheck timer, none of them expires */
+  rofl::ctimespec start(rofl::ctimespec::now());
+  for (unsigned int i = 0; i < num_rearms; i++) {
+    object->thread.add_timer(2 + (i % num_timers),
+                             rofl::ctimespec().expire_in(60));
+    if ((i % 7) == 0)
+      object->thread.drop_timer(2 + (i % num_timers));
+  }
+  rofl::ctimespec delta = rofl::ctimespec::now() - start;
+
+  double secs = delta.get_tspec().tv_sec + delta.get_tspec().tv_nsec / 1e9;
+  std::cerr << "re-armed " << num_rearms << " timers in " << secs << "s ("
+            << (unsigned long)(num_rearms / secs) << " re-arms/s)"
+            << std::endl;
+
+  /* timers dropped in their last round are not pending anymore */
+  for (unsigned int i = 0; i < num_timers; i++) {
+    bool pending = ((num_rearms - num_timers + i) % 7) != 0;
+    CPPUNIT_ASSERT(object->thread.has_timer(2 + i) == pending);
+    CPPUNIT_ASSERT(object->thread.drop_timer(2 + i) == pending);
+  }
+  CPPUNIT_ASSERT(not object->error);
+}
+
+void cthread_test::test_high_resolution() {
+  unsigned int keep_running = 50;
+
+  object->thread.set_high_resolution(true);
+
+  /* 100 timers with 250us period, each one within the first millisecond */
+  object->thread.add_timer(TIMER_ID_HIGH_RESOLUTION,
+                           rofl::ctimespec().expire_in(0, 250000));
+
+  while ((--keep_running > 0) && (object->cnt_hr < 100)) {
+    usleep(100000);
+  }
+  CPPUNIT_ASSERT(keep_running > 0);
+
+  rofl::ctimer_stats stats = object->thread.get_timer_stats();
+  std::cerr << stats;
+  CPPUNIT_ASSERT(stats.get_num_expired() >= 100);
+  CPPUNIT_ASSERT(stats.get_avg_lateness() < 1000000);
+
+  object->thread.set_high_resolution(false);
+  CPPUNIT_ASSERT(not object->error);
+}
+
+void cthread_test::test_post() {
+  const unsigned int num_producers = 4;
+  const unsigned int num_posts = 250000;
+  std::vector<unsigned int> last(num_producers, 0);
+  std::atomic_uint cnt(0);
+  bool ordered = true;
+
+  rofl::ctimespec start(rofl::ctimespec::now());
+  std::vector<std::thread> producers;
+  for (unsigned int p = 0; p < num_producers; p++) {
+    producers.push_back(std::thread([&, p]() {
+      for (unsigned int i = 1; i <= num_posts; i++) {
+        /* tasks are executed by worker thread only, no locking required */
+        object->thread.post([&, p, i]() {
+          if (last[p] + 1 != i)
+            ordered = false;
+          last[p] = i;
+          cnt++;
+        });
+      }
+    }));
+  }
+  for (auto &producer : producers) {
+    producer.join();
+  }
+
+  unsigned int keep_running = 100;
+  while ((--keep_running > 0) && (cnt < num_producers * num_posts)) {
+    usleep(100000);
+  }
+  rofl::ctimespec delta = rofl::ctimespec::now() - start;
+
+  double secs = delta.get_tspec().tv_sec + delta.get_tspec().tv_nsec / 1e9;
+  std::cerr << "executed " << cnt << " posted tasks in " << secs << "s ("
+            << (unsigned long)(cnt / secs) << " tasks/s)" << std::endl;
+  CPPUNIT_ASSERT(keep_running > 0);
+  CPPUNIT_ASSERT(ordered);
+
+  /* tasks posted to a stopped cthread are executed after restart */
+  object->thread.stop();
+  object->thread.post([&]() { cnt++; });
+  usleep(100000);
+  CPPUNIT_ASSERT(cnt == num_producers * num_posts);
+  object->thread.start();
+  keep_running = 50;
+  while ((--keep_running > 0) && (cnt < num_producers * num_posts + 1)) {
+    usleep(100000);
+  }
+  CPPUNIT_ASSERT(keep_running > 0);
+}
+
+void cthread_test::test_instrumentation() {
+  /* relative error of histogram buckets is below 12.5% */
+  rofl::chistogram h;
+  for (uint64_t v = 1; v <= 1000; v++) {
+    h.add(v);
+  }
+  CPPUNIT_ASSERT(h.get_count() == 1000);
+  CPPUNIT_ASSERT(h.get_min() == 1);
+  CPPUNIT_ASSERT(h.get_max() == 1000);
+  CPPUNIT_ASSERT(h.get_mean() == 500);
+  CPPUNIT_ASSERT(h.get_percentile(50.0) >= 500);
+  CPPUNIT_ASSERT(h.get_percentile(50.0) <= 500 + 500 / 8);
+  CPPUNIT_ASSERT(h.get_percentile(100.0) == 1000);
+  for (uint64_t v = 1; v < ((uint64_t)1 << 40); v = 3 * v + 1) {
+    uint64_t upper = rofl::chistogram::upper(rofl::chistogram::index(v));
+    CPPUNIT_ASSERT((upper >= v) && (upper - v <= v / 8));
+  }
+  CPPUNIT_ASSERT(rofl::chistogram::index(UINT64_MAX) ==
+                 rofl::chistogram::BUCKETS - 1);
+
+  /* metrics are recorded only on request */
+  CPPUNIT_ASSERT(object->thread.get_loop_stats().get_iteration().get_count() ==
+                 0);
+  object->thread.set_instrumentation(true);
+
+  std::atomic_uint cnt(0);
+  object->thread.post([&]() { cnt++; });
+  object->thread.wakeup();
+  object->thread.add_timer(TIMER_ID_BLOCKING,
+                           rofl::ctimespec().expire_in(0, 1000000));
+
+  unsigned int keep_running = 50;
+  while ((--keep_running > 0) && (object->cnt_blocking == 0)) {
+    usleep(100000);
+  }
+  CPPUNIT_ASSERT(keep_running > 0);
+  CPPUNIT_ASSERT(cnt == 1);
+
+  rofl::cloop_stats stats = object->thread.get_loop_stats();
+  std::cerr << stats;
+  CPPUNIT_ASSERT(stats.get_iteration().get_count() > 0);
+  CPPUNIT_ASSERT(stats.get_events().get_count() > 0);
+  CPPUNIT_ASSERT(stats.get_lateness().get_count() >= 1);
+  CPPUNIT_ASSERT(
+      stats.get_callback(rofl::cloop_stats::CALLBACK_TASK).get_count() == 1);
+  CPPUNIT_ASSERT(
+      stats.get_callback(rofl::cloop_stats::CALLBACK_WAKEUP).get_count() >= 1);
+
+  /* blocking callback shows up in callback and loop iteration times */
+  const rofl::chistogram &timeouts =
+      stats.get_callback(rofl::cloop_stats::CALLBACK_TIMEOUT);
+  CPPUNIT_ASSERT(timeouts.get_count() >= 1);
+  CPPUNIT_ASSERT(timeouts.get_max() >= 20000000);
+  CPPUNIT_ASSERT(stats.get_iteration().get_max() >= 20000000);
+
+  object->thread.set_instrumentation(false);
+  CPPUNIT_ASSERT(not object->error);
+}
+
 void cthread_test::cobject::handle_timeout(rofl::cthread &thread,
                                            uint32_t timer_id) {
   switch (timer_id) {
@@ -39,6 +202,15 @@ void cthread_test::cobject::handle_timeout(rofl::cthread &thread,
   case 1: {
     error = true;
   } break;
+  case TIMER_ID_BLOCKING: {
+    usleep(20000);
+    cnt_blocking++;
+  } break;
+  case TIMER_ID_HIGH_RESOLUTION: {
+    if (++cnt_hr < 100)
+      thread.add_timer(TIMER_ID_HIGH_RESOLUTION,
+                       rofl::ctimespec().expire_in(0, 250000));
+  } break;
   default: {};
   }
 };
@@ -6,9 +6,18 @@ class cthread_test : public CppUnit::TestFixture {
 
   CPPUNIT_TEST_SUITE(cthread_test);
   CPPUNIT_TEST(test1);
+  CPPUNIT_TEST(test_rearm);
+  CPPUNIT_TEST(test_high_resolution);
+  CPPUNIT_TEST(test_post);
+  CPPUNIT_TEST(test_instrumentation);
   CPPUNIT_TEST_SUITE_END();
 
 private:
+  enum cthread_test_timer_t {
+    TIMER_ID_HIGH_RESOLUTION = 0x10000,
+    TIMER_ID_BLOCKING = 0x10001,
+  };
+
   class cobject : public rofl::cthread_env {
   public:
     /**
@@ -19,7 +28,10 @@ private:
     /**
      *
      */
-    cobject() : thread(this), cnt(0), error(false) { thread.start(); };
+    cobject()
+        : thread(this), cnt(0), cnt_hr(0), cnt_blocking(0), error(false) {
+      thread.start();
+    };
 
   protected:
     virtual void handle_wakeup(rofl::cthread &thread){};
@@ -32,6 +44,10 @@ private:
 
     unsigned int cnt;
 
+    std::atomic_uint cnt_hr;
+
+    std::atomic_uint cnt_blocking;
+
     bool error;
   };
 
@@ -43,4 +59,8 @@ public:
   void tearDown();
 
   void test1();
+  void test_rearm();
+  void test_high_resolution();
+  void test_post();
+  void test_instrumentation();
 };
@@ -0,0 +1,407 @@
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <vector>
+
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include "cthread_pool_test.h"
+
+CPPUNIT_TEST_SUITE_REGISTRATION(cthread_pool_test);
+
+void cthread_pool_test::setUp() { pool = new rofl::cthread_pool(2); }
+
+void cthread_pool_test::tearDown() { delete pool; }
+
+void cthread_pool_test::test_timers() {
+  const unsigned int num_objects = 16;
+  std::vector<cobject *> objects;
+
+  CPPUNIT_ASSERT(pool->size() == 2);
+
+  for (unsigned int i = 0; i < num_objects; i++) {
+    objects.push_back(new cobject(pool));
+    objects.back()->thread.add_timer(0, rofl::ctimespec().expire_in(0, 10000));
+  }
+
+  /* objects are spread evenly across all reactor threads */
+  CPPUNIT_ASSERT(pool->get_num_threads(0) == num_objects / 2);
+  CPPUNIT_ASSERT(pool->get_num_threads(1) == num_objects / 2);
+
+  unsigned int keep_running = 60;
+  bool done = false;
+  while ((--keep_running > 0) && (not done)) {
+    done = true;
+    for (auto object : objects) {
+      CPPUNIT_ASSERT(not object->error);
+      if (object->num_timeouts < 10)
+        done = false;
+    }
+    sleep(1);
+  }
+  CPPUNIT_ASSERT(keep_running > 0);
+
+  for (auto object : objects) {
+    CPPUNIT_ASSERT(object->thread.get_thread_id() ==
+                   pool->get_thread_id(object->thread.get_reactor()));
+    delete object;
+  }
+
+  CPPUNIT_ASSERT(pool->get_num_threads(0) == 0);
+  CPPUNIT_ASSERT(pool->get_num_threads(1) == 0);
+}
+
+void cthread_pool_test::test_events() {
+  int sds[2];
+  CPPUNIT_ASSERT(socketpair(AF_UNIX, SOCK_STREAM, 0, sds) == 0);
+  CPPUNIT_ASSERT(fcntl(sds[0], F_SETFL, O_NONBLOCK) == 0);
+
+  /* reader and writer share socket sds[0] on the same reactor thread */
+  cobject *reader = new cobject(pool);
+  cobject *writer = new cobject(pool, reader->thread.get_reactor());
+  CPPUNIT_ASSERT(reader->thread.get_thread_id() ==
+                 writer->thread.get_thread_id());
+
+  reader->thread.add_read_fd(sds[0]);
+  writer->thread.add_write_fd(sds[0]);
+
+  for (unsigned int i = 0; i < 10; i++) {
+    char c = 'a';
+    CPPUNIT_ASSERT(write(sds[1], &c, sizeof(c)) == sizeof(c));
+    reader->thread.wakeup();
+    usleep(10000);
+  }
+
+  unsigned int keep_running = 10;
+  while ((--keep_running > 0) &&
+         ((reader->num_reads < 10) || (reader->num_wakeups < 1) ||
+          (writer->num_writes < 1))) {
+    sleep(1);
+  }
+  CPPUNIT_ASSERT(keep_running > 0);
+  CPPUNIT_ASSERT(not reader->error);
+  CPPUNIT_ASSERT(not writer->error);
+  CPPUNIT_ASSERT(reader->num_writes == 0);
+  CPPUNIT_ASSERT(writer->num_reads == 0);
+
+  /* dropping the writer must not affect the reader */
+  delete writer;
+
+  char c = 'b';
+  unsigned int num_reads = reader->num_reads;
+  CPPUNIT_ASSERT(write(sds[1], &c, sizeof(c)) == sizeof(c));
+  keep_running = 10;
+  while ((--keep_running > 0) && (reader->num_reads == num_reads)) {
+    sleep(1);
+  }
+  CPPUNIT_ASSERT(keep_running > 0);
+
+  delete reader;
+
+  close(sds[0]);
+  close(sds[1]);
+}
+
+void cthread_pool_test::test_stop() {
+  cobject *object = new cobject(pool, 0);
+  cobject *peer = new cobject(pool, 0);
+
+  /* block reactor thread in callback, stop must wait for its end */
+  object->delay = 2;
+  object->thread.wakeup();
+  sleep(1);
+
+  time_t start = time(NULL);
+  object->thread.stop();
+  CPPUNIT_ASSERT(time(NULL) - start >= 1);
+  CPPUNIT_ASSERT(object->num_wakeups == 1);
+
+  /* reactor thread keeps running for other cthreads */
+  peer->thread.wakeup();
+  unsigned int keep_running = 10;
+  while ((--keep_running > 0) && (peer->num_wakeups == 0)) {
+    sleep(1);
+  }
+  CPPUNIT_ASSERT(keep_running > 0);
+
+  /* stopped cthread receives no further events */
+  object->thread.wakeup();
+  object->thread.add_timer(0, rofl::ctimespec().expire_in(0, 10000));
+  sleep(1);
+  CPPUNIT_ASSERT(object->num_wakeups == 1);
+  CPPUNIT_ASSERT(object->num_timeouts == 0);
+
+  delete object;
+  delete peer;
+}
+
+void cthread_pool_test::test_io_uring() {
+  delete pool;
+  pool = new rofl::cthread_pool(2, "rofl_reactor", rofl::ENGINE_IO_URING);
+
+  /* falls back to epoll without io_uring support */
+  if (rofl::cio_uring::is_supported()) {
+    CPPUNIT_ASSERT(pool->get_engine() == rofl::ENGINE_IO_URING);
+  } else {
+    CPPUNIT_ASSERT(pool->get_engine() == rofl::ENGINE_EPOLL);
+  }
+
+  test_timers();
+  test_events();
+  test_stop();
+}
+
+void cthread_pool_test::test_affinity() {
+  rofl::cthread_affinity affinity(rofl::AFFINITY_ROUND_ROBIN, "2-4,7");
+  CPPUNIT_ASSERT(affinity.get_cpus().size() == 4);
+  CPPUNIT_ASSERT(affinity.get_cpu(0) == 2);
+  CPPUNIT_ASSERT(affinity.get_cpu(3) == 7);
+  CPPUNIT_ASSERT(affinity.get_cpu(5) == 3);
+  const char *invalid[] = {"1-", "3-1", "x", "1,2y"};
+  for (auto cpulist : invalid) {
+    bool thrown = false;
+    try {
+      affinity.set_cpus(cpulist);
+    } catch (rofl::eAffinityInval &e) {
+      thrown = true;
+    }
+    CPPUNIT_ASSERT(thrown);
+  }
+  CPPUNIT_ASSERT(affinity.get_cpus().size() == 4);
+  CPPUNIT_ASSERT(rofl::cthread_affinity().get_cpu(0) == -1);
+
+  /* round robin over all cpus available to this process */
+  cpu_set_t cpuset;
+  CPU_ZERO(&cpuset);
+  CPPUNIT_ASSERT(sched_getaffinity(0, sizeof(cpuset), &cpuset) == 0);
+  int cpu = rofl::cthread_affinity(rofl::AFFINITY_RX_QUEUE).get_cpu(0);
+  CPPUNIT_ASSERT((cpu >= 0) && CPU_ISSET(cpu, &cpuset));
+
+  delete pool;
+  std::vector<unsigned int> cpus(1, cpu);
+  pool = new rofl::cthread_pool(
+      2, "rofl_reactor", rofl::ENGINE_EPOLL,
+      rofl::cthread_affinity(rofl::AFFINITY_RX_QUEUE, cpus));
+
+  /* reactor threads are pinned before running any callback */
+  for (int reactor = 0; reactor < 2; reactor++) {
+    CPPUNIT_ASSERT(pool->get_cpu(reactor) == cpu);
+    cpu_set_t pinned;
+    CPU_ZERO(&pinned);
+    CPPUNIT_ASSERT(pthread_getaffinity_np(pool->get_thread_id(reactor),
+                                          sizeof(pinned), &pinned) == 0);
+    CPPUNIT_ASSERT(CPU_COUNT(&pinned) == 1);
+    CPPUNIT_ASSERT(CPU_ISSET(cpu, &pinned));
+  }
+
+  /* accepted sockets are placed next to their RX queue */
+  int lsd = socket(AF_INET, SOCK_STREAM, 0);
+  struct sockaddr_in sin;
+  memset(&sin, 0, sizeof(sin));
+  sin.sin_family = AF_INET;
+  sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  socklen_t sinlen = sizeof(sin);
+  CPPUNIT_ASSERT(bind(lsd, (struct sockaddr *)&sin, sizeof(sin)) == 0);
+  CPPUNIT_ASSERT(listen(lsd, 1) == 0);
+  CPPUNIT_ASSERT(getsockname(lsd, (struct sockaddr *)&sin, &sinlen) == 0);
+  int csd = socket(AF_INET, SOCK_STREAM, 0);
+  CPPUNIT_ASSERT(connect(csd, (struct sockaddr *)&sin, sizeof(sin)) == 0);
+  int asd = accept(lsd, NULL, NULL);
+  CPPUNIT_ASSERT(asd >= 0);
+  int reactor = pool->select_reactor(asd);
+  CPPUNIT_ASSERT((reactor >= -1) && (reactor < 2));
+  close(asd);
+  close(csd);
+  close(lsd);
+
+  /* binding memory is best effort */
+  std::vector<uint8_t> buf(65536);
+  rofl::cthread_affinity::bind_memory(buf.data(), buf.size(),
+                                      pool->get_numa_node(0));
+
+  test_timers();
+}
+
+void cthread_pool_test::test_benchmark() {
+  const unsigned int num_conns = 1000;
+  const unsigned int rounds = 100;
+
+  /* two sockets per connection */
+  struct rlimit rlim;
+  CPPUNIT_ASSERT(getrlimit(RLIMIT_NOFILE, &rlim) == 0);
+  if (rlim.rlim_cur < 2 * num_conns + 64) {
+    rlim.rlim_cur = rlim.rlim_max;
+    setrlimit(RLIMIT_NOFILE, &rlim);
+  }
+
+  double epoll_rate = run_pingpong(rofl::ENGINE_EPOLL, num_conns, rounds);
+  std::cerr << "epoll: " << num_conns << " connections, "
+            << (unsigned long)epoll_rate << " round trips/s" << std::endl;
+
+  double uring_rate = run_pingpong(rofl::ENGINE_IO_URING, num_conns, rounds);
+  std::cerr << "io_uring: " << num_conns << " connections, "
+            << (unsigned long)uring_rate << " round trips/s" << std::endl;
+}
+
+void cthread_pool_test::test_busy_poll() {
+  unsigned int num_conns = 16;
+  unsigned int rounds = 1000;
+
+  double rate = run_pingpong(rofl::ENGINE_EPOLL, num_conns, rounds, 50);
+  std::cerr << "epoll (busy poll on reactor 0): " << num_conns
+            << " connections, " << (unsigned long)rate << " round trips/s"
+            << std::endl;
+}
+
+double cthread_pool_test::run_pingpong(rofl::cthread_engine_t engine,
+                                       unsigned int num_conns,
+                                       unsigned int rounds,
+                                       unsigned int busy_poll) {
+  rofl::cthread_pool bench_pool(2, "rofl_bench", engine);
+
+  /* busy polling on a subset of reactor threads only */
+  bench_pool.set_busy_poll(0, busy_poll);
+  CPPUNIT_ASSERT(bench_pool.get_busy_poll(0) == busy_poll);
+  CPPUNIT_ASSERT(bench_pool.get_busy_poll(1) == 0);
+
+  /* tcp connections over loopback */
+  int lsd = socket(AF_INET, SOCK_STREAM, 0);
+  CPPUNIT_ASSERT(lsd >= 0);
+  struct sockaddr_in sin;
+  memset(&sin, 0, sizeof(sin));
+  sin.sin_family = AF_INET;
+  sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  socklen_t sinlen = sizeof(sin);
+  CPPUNIT_ASSERT(bind(lsd, (struct sockaddr *)&sin, sizeof(sin)) == 0);
+  CPPUNIT_ASSERT(listen(lsd, num_conns) == 0);
+  CPPUNIT_ASSERT(getsockname(lsd, (struct sockaddr *)&sin, &sinlen) == 0);
+
+  std::vector<cpingpong *> peers;
+  std::vector<cpingpong *> initiators;
+  for (unsigned int i = 0; i < num_conns; i++) {
+    int sds[2];
+    sds[0] = socket(AF_INET, SOCK_STREAM, 0);
+    CPPUNIT_ASSERT(sds[0] >= 0);
+    CPPUNIT_ASSERT(connect(sds[0], (struct sockaddr *)&sin, sizeof(sin)) == 0);
+    sds[1] = accept(lsd, NULL, NULL);
+    CPPUNIT_ASSERT(sds[1] >= 0);
+    for (unsigned int j = 0; j < 2; j++) {
+      int one = 1;
+      setsockopt(sds[j], IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+      CPPUNIT_ASSERT(fcntl(sds[j], F_SETFL, O_NONBLOCK) == 0);
+    }
+    initiators.push_back(new cpingpong(&bench_pool, sds[0], rounds));
+    peers.push_back(new cpingpong(&bench_pool, sds[1], rounds));
+  }
+  close(lsd);
+
+  rofl::ctimespec start(rofl::ctimespec::now());
+  for (auto initiator : initiators) {
+    initiator->ping();
+  }
+
+  unsigned int keep_running = 600;
+  bool done = false;
+  while ((--keep_running > 0) && (not done)) {
+    done = true;
+    for (auto initiator : initiators) {
+      if (initiator->num_rounds < rounds) {
+        done = false;
+        break;
+      }
+    }
+    if (not done)
+      usleep(10000);
+  }
+  rofl::ctimespec delta = rofl::ctimespec::now() - start;
+  CPPUNIT_ASSERT(keep_running > 0);
+
+  if (busy_poll) {
+    CPPUNIT_ASSERT(bench_pool.get_num_busy_polls(0) > 0);
+    CPPUNIT_ASSERT(bench_pool.get_num_busy_poll_hits(0) > 0);
+  }
+  CPPUNIT_ASSERT(bench_pool.get_num_busy_polls(1) == 0);
+
+  for (auto peer : initiators) {
+    int fd = peer->fd;
+    delete peer;
+    close(fd);
+  }
+  for (auto peer : peers) {
+    int fd = peer->fd;
+    delete peer;
+    close(fd);
+  }
+
+  double secs = delta.get_tspec().tv_sec + delta.get_tspec().tv_nsec / 1e9;
+  return (num_conns * rounds) / secs;
+}
+
+void cthread_pool_test::cpingpong::ping() {
+  char buf[MSG_LEN];
+  memset(buf, 0, sizeof(buf));
+  CPPUNIT_ASSERT(write(fd, buf, sizeof(buf)) == sizeof(buf));
+}
+
+void cthread_pool_test::cpingpong::handle_read_event(rofl::cthread &thread,
+                                                     int fd) {
+  char buf[MSG_LEN];
+  ssize_t rc;
+  while ((rc = read(fd, buf, MSG_LEN - rxlen)) > 0) {
+    rxlen += rc;
+    if (rxlen < MSG_LEN)
+      continue;
+    rxlen = 0;
+    /* echo message until all rounds are done */
+    if (++num_rounds <= rounds) {
+      if (write(fd, buf, MSG_LEN) != MSG_LEN)
+        return;
+    }
+  }
+}
+
+void cthread_pool_test::cobject::check_thread(rofl::cthread &thread) {
+  if (thread.get_thread_id() != pthread_self())
+    error = true;
+}
+
+void cthread_pool_test::cobject::handle_wakeup(rofl::cthread &thread) {
+  check_thread(thread);
+  num_wakeups++;
+  if (delay)
+    sleep(delay);
+}
+
+void cthread_pool_test::cobject::handle_timeout(rofl::cthread &thread,
+                                                uint32_t timer_id) {
+  check_thread(thread);
+  switch (timer_id) {
+  case 0: {
+    num_timeouts++;
+    /* reschedule timer 0 */
+    thread.add_timer(0, rofl::ctimespec().expire_in(0, 10000000));
+  } break;
+  default: {};
+  }
+}
+
+void cthread_pool_test::cobject::handle_read_event(rofl::cthread &thread,
+                                                   int fd) {
+  check_thread(thread);
+  char buf[64];
+  ssize_t rc;
+  while ((rc = read(fd, buf, sizeof(buf))) > 0)
+    num_reads += rc;
+}
+
+void cthread_pool_test::cobject::handle_write_event(rofl::cthread &thread,
+                                                    int fd) {
+  check_thread(thread);
+  num_writes++;
+}
@@ -0,0 +1,125 @@
+#include "rofl/common/cthread.hpp"
+#include "rofl/common/cthread_pool.hpp"
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+class cthread_pool_test : public CppUnit::TestFixture {
+
+  CPPUNIT_TEST_SUITE(cthread_pool_test);
+  CPPUNIT_TEST(test_timers);
+  CPPUNIT_TEST(test_events);
+  CPPUNIT_TEST(test_stop);
+  CPPUNIT_TEST(test_io_uring);
+  CPPUNIT_TEST(test_busy_poll);
+  CPPUNIT_TEST(test_affinity);
+  CPPUNIT_TEST(test_benchmark);
+  CPPUNIT_TEST_SUITE_END();
+
+private:
+  class cobject : public rofl::cthread_env {
+  public:
+    /**
+     *
+     */
+    virtual ~cobject() { thread.stop(); };
+
+    /**
+     *
+     */
+    cobject(rofl::cthread_pool *pool, int reactor = -1)
+        : thread(this, pool, reactor), num_timeouts(0), num_wakeups(0),
+          num_reads(0), num_writes(0), delay(0), error(false) {
+      thread.start();
+    };
+
+  protected:
+    virtual void handle_wakeup(rofl::cthread &thread);
+    virtual void handle_timeout(rofl::cthread &thread, uint32_t timer_id);
+    virtual void handle_read_event(rofl::cthread &thread, int fd);
+    virtual void handle_write_event(rofl::cthread &thread, int fd);
+
+  private:
+    void check_thread(rofl::cthread &thread);
+
+  public:
+    rofl::cthread thread;
+
+    std::atomic_uint num_timeouts;
+    std::atomic_uint num_wakeups;
+    std::atomic_uint num_reads; // bytes read
+    std::atomic_uint num_writes;
+
+    // time spent in handle_wakeup (seconds)
+    unsigned int delay;
+
+    std::atomic_bool error;
+  };
+
+private:
+  /**
+   * @brief	Echoes fixed size messages over a connection for n rounds
+   */
+  class cpingpong : public rofl::cthread_env {
+  public:
+    static const unsigned int MSG_LEN = 64;
+
+    /**
+     *
+     */
+    virtual ~cpingpong() { thread.stop(); };
+
+    /**
+     *
+     */
+    cpingpong(rofl::cthread_pool *pool, int fd, unsigned int rounds)
+        : thread(this, pool), fd(fd), rounds(rounds), num_rounds(0),
+          rxlen(0) {
+      thread.start();
+      thread.add_read_fd(fd);
+    };
+
+    /**
+     * @brief	Sends first message
+     */
+    void ping();
+
+  protected:
+    virtual void handle_wakeup(rofl::cthread &thread){};
+    virtual void handle_timeout(rofl::cthread &thread, uint32_t timer_id){};
+    virtual void handle_read_event(rofl::cthread &thread, int fd);
+    virtual void handle_write_event(rofl::cthread &thread, int fd){};
+
+  public:
+    rofl::cthread thread;
+
+    int fd;
+
+    unsigned int rounds;
+
+    std::atomic_uint num_rounds;
+
+    // bytes received of current message
+    unsigned int rxlen;
+  };
+
+  /**
+   * @brief	Returns round trips per second for n connections
+   */
+  double run_pingpong(rofl::cthread_engine_t engine, unsigned int num_conns,
+                      unsigned int rounds, unsigned int busy_poll = 0);
+
+private:
+  rofl::cthread_pool *pool;
+
+public:
+  void setUp();
+  void tearDown();
+
+  void test_timers();
+  void test_events();
+  void test_stop();
+  void test_io_uring();
+  void test_busy_poll();
+  void test_affinity();
+  void test_benchmark();
+};
@@ -0,0 +1,175 @@
+#include <stdlib.h>
+#include <vector>
+
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include "ctimer_wheel_test.h"
+
+CPPUNIT_TEST_SUITE_REGISTRATION(ctimer_wheel_test);
+
+void ctimer_wheel_test::setUp() {}
+
+void ctimer_wheel_test::tearDown() {}
+
+unsigned int ctimer_wheel_test::advance(rofl::ctimer_wheel &wheel,
+                                        uint64_t tick) {
+  unsigned int n = 0;
+  wheel.advance(tick);
+  cnode *node;
+  while ((node = static_cast<cnode *>(wheel.pop())) != nullptr) {
+    node->fired = tick;
+    n++;
+  }
+  return n;
+}
+
+void ctimer_wheel_test::test_expiration() {
+  rofl::ctimer_wheel wheel(1000);
+  cnode nodes[4];
+  uint64_t ticks[4] = {1001, 1255, 1256, 70000};
+
+  for (unsigned int i = 0; i < 4; i++) {
+    wheel.add(&nodes[i], ticks[i]);
+  }
+  CPPUNIT_ASSERT(wheel.size() == 4);
+
+  uint64_t next = 0;
+  CPPUNIT_ASSERT(wheel.next_tick(next));
+  CPPUNIT_ASSERT(next == 1001);
+
+  /* nothing expires before its tick */
+  CPPUNIT_ASSERT(advance(wheel, 1000) == 0);
+  CPPUNIT_ASSERT(advance(wheel, 1001) == 1);
+  CPPUNIT_ASSERT(nodes[0].fired == 1001);
+  CPPUNIT_ASSERT(not nodes[0].is_linked());
+
+  /* jumping over several ticks collects all expired timers */
+  CPPUNIT_ASSERT(advance(wheel, 2000) == 2);
+  CPPUNIT_ASSERT(advance(wheel, 69999) == 0);
+  CPPUNIT_ASSERT(advance(wheel, 70000) == 1);
+  CPPUNIT_ASSERT(wheel.empty());
+  CPPUNIT_ASSERT(not wheel.next_tick(next));
+
+  /* timers in the past expire immediately */
+  wheel.add(&nodes[0], 10);
+  CPPUNIT_ASSERT(wheel.next_tick(next));
+  CPPUNIT_ASSERT(next == wheel.get_tick());
+  CPPUNIT_ASSERT(advance(wheel, 70000) == 1);
+}
+
+void ctimer_wheel_test::test_rearm() {
+  rofl::ctimer_wheel wheel(0);
+  cnode node;
+
+  for (uint64_t tick = 1; tick < 100000; tick += 7) {
+    /* re-arm timer before it expires */
+    wheel.add(&node, tick + 5000);
+    CPPUNIT_ASSERT(advance(wheel, tick) == 0);
+  }
+  CPPUNIT_ASSERT(wheel.size() == 1);
+
+  wheel.del(&node);
+  CPPUNIT_ASSERT(wheel.empty());
+  CPPUNIT_ASSERT(not node.is_linked());
+  CPPUNIT_ASSERT(advance(wheel, 1000000) == 0);
+
+  /* removing an unlinked node is harmless */
+  wheel.del(&node);
+  CPPUNIT_ASSERT(wheel.empty());
+}
+
+void ctimer_wheel_test::test_random() {
+  const unsigned int num_nodes = 2000;
+  std::vector<cnode> nodes(num_nodes);
+  uint64_t start = 123456789;
+  rofl::ctimer_wheel wheel(start);
+
+  srand(1);
+  for (auto &node : nodes) {
+    switch (rand() % 3) {
+    case 0:
+      node.expiry = start + 1 + rand() % 300;
+      break;
+    case 1:
+      node.expiry = start + 1 + rand() % 100000;
+      break;
+    default:
+      node.expiry = start + 1 + rand() % 50000000;
+      break;
+    }
+    wheel.add(&node, node.expiry);
+  }
+
+  /* advance in irregular steps, every timer fires on the first advance
+   * covering its expiration tick */
+  uint64_t tick = start;
+  unsigned int fired = 0;
+  while (not wheel.empty()) {
+    uint64_t prev = tick;
+    tick += 1 + rand() % 5000;
+    fired += advance(wheel, tick);
+    for (auto &node : nodes) {
+      if (node.fired == tick) {
+        CPPUNIT_ASSERT(node.expiry > prev);
+        CPPUNIT_ASSERT(node.expiry <= tick);
+      } else if (node.fired == 0) {
+        CPPUNIT_ASSERT(node.expiry > tick);
+      }
+    }
+  }
+  CPPUNIT_ASSERT(fired == num_nodes);
+}
+
+void ctimer_wheel_test::test_overflow() {
+  rofl::ctimer_wheel wheel(5);
+  cnode node;
+
+  /* beyond range of highest level */
+  uint64_t tick = ((uint64_t)1 << 33) + 17;
+  wheel.add(&node, tick);
+
+  uint64_t next = 0;
+  CPPUNIT_ASSERT(wheel.next_tick(next));
+  CPPUNIT_ASSERT(next < tick);
+
+  CPPUNIT_ASSERT(advance(wheel, tick - 1) == 0);
+  CPPUNIT_ASSERT(advance(wheel, tick) == 1);
+  CPPUNIT_ASSERT(node.fired == tick);
+}
+
+void ctimer_wheel_test::test_resolution() {
+  rofl::ctimer_wheel wheel(1000);
+  cnode nodes[3];
+
+  /* 1ms, 300ms and 2h in millisecond ticks */
+  wheel.add(&nodes[0], 1001);
+  wheel.add(&nodes[1], 1300);
+  wheel.add(&nodes[2], 1000 + 7200000);
+
+  /* switch to microsecond ticks */
+  wheel.set_resolution(1000);
+  CPPUNIT_ASSERT(wheel.get_resolution() == 1000);
+  CPPUNIT_ASSERT(wheel.get_tick() == 1000000);
+  CPPUNIT_ASSERT(wheel.size() == 3);
+
+  uint64_t next = 0;
+  CPPUNIT_ASSERT(wheel.next_tick(next));
+  CPPUNIT_ASSERT(next <= 1001000);
+  CPPUNIT_ASSERT(advance(wheel, 1000999) == 0);
+  CPPUNIT_ASSERT(advance(wheel, 1001000) == 1);
+  CPPUNIT_ASSERT(advance(wheel, 1299999) == 0);
+  CPPUNIT_ASSERT(advance(wheel, 1300000) == 1);
+
+  /* back to millisecond ticks, deadlines are rounded up */
+  wheel.add(&nodes[0], 1300001);
+  wheel.set_resolution(rofl::ctimer_wheel::RESOLUTION_DEFAULT);
+  CPPUNIT_ASSERT(wheel.get_tick() == 1300);
+  CPPUNIT_ASSERT(advance(wheel, 1300) == 0);
+  CPPUNIT_ASSERT(advance(wheel, 1301) == 1);
+  CPPUNIT_ASSERT(nodes[0].fired == 1301);
+
+  CPPUNIT_ASSERT(advance(wheel, 1000 + 7199999) == 0);
+  CPPUNIT_ASSERT(advance(wheel, 1000 + 7200000) == 1);
+  CPPUNIT_ASSERT(wheel.empty());
+}
@@ -0,0 +1,35 @@
+#include "rofl/common/ctimer_wheel.hpp"
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+class ctimer_wheel_test : public CppUnit::TestFixture {
+
+  CPPUNIT_TEST_SUITE(ctimer_wheel_test);
+  CPPUNIT_TEST(test_expiration);
+  CPPUNIT_TEST(test_rearm);
+  CPPUNIT_TEST(test_random);
+  CPPUNIT_TEST(test_overflow);
+  CPPUNIT_TEST(test_resolution);
+  CPPUNIT_TEST_SUITE_END();
+
+private:
+  class cnode : public rofl::ctimer_node {
+  public:
+    cnode() : expiry(0), fired(0){};
+    uint64_t expiry;
+    uint64_t fired;
+  };
+
+  /* advances wheel to tick and marks all expired nodes */
+  unsigned int advance(rofl::ctimer_wheel &wheel, uint64_t tick);
+
+public:
+  void setUp();
+  void tearDown();
+
+  void test_expiration();
+  void test_rearm();
+  void test_random();
+  void test_overflow();
+  void test_resolution();
+};
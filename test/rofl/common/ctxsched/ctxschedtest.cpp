@@ -0,0 +1,192 @@
+/*
+ * ctxschedtest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <vector>
+
+#include "ctxschedtest.hpp"
+
+CPPUNIT_TEST_SUITE_REGISTRATION(ctxschedtest);
+
+namespace {
+
+void store(std::deque<rofl::crofqueue> &txqueues, unsigned int txclass,
+           size_t len, unsigned int count = 1) {
+  txqueues[txclass].set_queue_max_size(4096);
+  for (unsigned int i = 0; i < count; i++) {
+    rofl::crofframe *frame = new rofl::crofframe();
+    frame->append(len);
+    txqueues[txclass].store(frame);
+  }
+}
+
+/* runs rounds like crofsock::send_from_queue(), stops after limit bytes,
+ * returns bytes sent per class */
+std::vector<size_t> run(rofl::ctxsched &sched,
+                        std::deque<rofl::crofqueue> &txqueues, size_t limit,
+                        std::vector<unsigned int> *order = nullptr) {
+  std::vector<size_t> sent(txqueues.size(), 0);
+  size_t total = 0;
+  unsigned int rounds = 0;
+  while ((total < limit) && (rounds++ < 1000)) {
+    int txclass;
+    while ((total < limit) && ((txclass = sched.select(txqueues)) >= 0)) {
+      rofl::openflow::cofmsg *msg = nullptr;
+      rofl::crofframe *frame = nullptr;
+      CPPUNIT_ASSERT(txqueues[txclass].retrieve(msg, frame));
+      CPPUNIT_ASSERT(frame != nullptr);
+      sched.charge(txclass, frame->length());
+      sent[txclass] += frame->length();
+      total += frame->length();
+      if (order)
+        order->push_back(txclass);
+      delete frame;
+    }
+  }
+  return sent;
+}
+
+}; // end of anonymous namespace
+
+void ctxschedtest::setUp() {}
+
+void ctxschedtest::tearDown() {}
+
+void ctxschedtest::testStrict() {
+  std::deque<rofl::crofqueue> txqueues(4);
+  rofl::ctxsched_drr sched(4, 1024);
+  sched.set_class(0, 0, true);
+  CPPUNIT_ASSERT(sched.get_strict(0));
+
+  CPPUNIT_ASSERT(sched.select(txqueues) == -1);
+
+  store(txqueues, 1, 100, 4);
+  store(txqueues, 0, 8, 2);
+
+  /* strict class first, regardless of the round */
+  std::vector<unsigned int> order;
+  run(sched, txqueues, 416, &order);
+  CPPUNIT_ASSERT(order.size() == 6);
+  CPPUNIT_ASSERT(order[0] == 0);
+  CPPUNIT_ASSERT(order[1] == 0);
+  for (unsigned int i = 2; i < 6; i++) {
+    CPPUNIT_ASSERT(order[i] == 1);
+  }
+
+  /* strict class is served in the middle of a round */
+  store(txqueues, 1, 100, 4);
+  CPPUNIT_ASSERT(sched.select(txqueues) == 1);
+  store(txqueues, 0, 8, 1);
+  CPPUNIT_ASSERT(sched.select(txqueues) == 0);
+  for (auto &txqueue : txqueues) {
+    txqueue.clear();
+  }
+}
+
+void ctxschedtest::testFairness() {
+  std::deque<rofl::crofqueue> txqueues(4);
+  rofl::ctxsched_drr sched(4, 4096);
+
+  /* large multipart replies vs. small packet-outs with equal quanta */
+  store(txqueues, 2, 4000, 100);
+  store(txqueues, 3, 24, 3000);
+
+  std::vector<size_t> sent = run(sched, txqueues, 64000);
+  size_t total = sent[2] + sent[3];
+  CPPUNIT_ASSERT(total >= 64000);
+  /* each class gets half of the bytes within one max message size */
+  CPPUNIT_ASSERT(sent[2] + 4000 >= sent[3]);
+  CPPUNIT_ASSERT(sent[3] + 4000 >= sent[2]);
+
+  for (auto &txqueue : txqueues) {
+    txqueue.clear();
+  }
+}
+
+void ctxschedtest::testQuantum() {
+  std::deque<rofl::crofqueue> txqueues(6);
+  rofl::ctxsched_drr sched(6, 1000);
+
+  /* application class 4 for bulk flow installs below class 5 */
+  sched.set_class(4, 500, false);
+  sched.set_class(5, 3000, false);
+  CPPUNIT_ASSERT(sched.get_quantum(4) == 500);
+  CPPUNIT_ASSERT(sched.get_quantum(5) == 3000);
+
+  store(txqueues, 4, 100, 500);
+  store(txqueues, 5, 100, 500);
+
+  std::vector<size_t> sent = run(sched, txqueues, 35000);
+  CPPUNIT_ASSERT(sent[4] * 5 <= sent[5] + 1000);
+  CPPUNIT_ASSERT(sent[4] * 7 >= sent[5]);
+
+  /* messages larger than the quantum are sent after some rounds */
+  txqueues[4].clear();
+  txqueues[5].clear();
+  store(txqueues, 4, 2000, 1);
+  sent = run(sched, txqueues, 2000);
+  CPPUNIT_ASSERT(sent[4] == 2000);
+  CPPUNIT_ASSERT(txqueues[4].empty());
+}
+
+void ctxschedtest::testIdle() {
+  std::deque<rofl::crofqueue> txqueues(2);
+  rofl::ctxsched_drr sched(2, 1000);
+
+  /* deficit remains while the next message does not fit */
+  store(txqueues, 0, 1500, 1);
+  CPPUNIT_ASSERT(sched.select(txqueues) == -1);
+  CPPUNIT_ASSERT(sched.get_deficit(0) == 1000);
+
+  /* an idle class loses its deficit */
+  txqueues[0].clear();
+  CPPUNIT_ASSERT(sched.select(txqueues) == -1);
+  CPPUNIT_ASSERT(sched.get_deficit(0) == 0);
+
+  store(txqueues, 0, 600, 2);
+  CPPUNIT_ASSERT(sched.select(txqueues) == 0);
+  rofl::openflow::cofmsg *msg = nullptr;
+  rofl::crofframe *frame = nullptr;
+  CPPUNIT_ASSERT(txqueues[0].retrieve(msg, frame));
+  sched.charge(0, frame->length());
+  delete frame;
+  CPPUNIT_ASSERT(sched.get_deficit(0) == 400);
+  CPPUNIT_ASSERT(sched.select(txqueues) == -1);
+  CPPUNIT_ASSERT(sched.select(txqueues) == 0);
+  txqueues[0].clear();
+}
+
+void ctxschedtest::testStats() {
+  rofl::ctxclass_stats stats;
+  CPPUNIT_ASSERT(stats.get_packets() == 0);
+
+  stats.add(100, 1000);
+  stats.add(300, 3000);
+  CPPUNIT_ASSERT(stats.get_packets() == 2);
+  CPPUNIT_ASSERT(stats.get_bytes() == 400);
+  CPPUNIT_ASSERT(stats.get_delay().get_count() == 2);
+  CPPUNIT_ASSERT(stats.get_delay().get_max() == 3000);
+
+  rofl::ctxclass_stats sum;
+  sum += stats;
+  sum += stats;
+  CPPUNIT_ASSERT(sum.get_packets() == 4);
+  CPPUNIT_ASSERT(sum.get_bytes() == 800);
+
+  /* timestamps of queued entries */
+  rofl::crofqueue queue;
+  queue.set_timestamps(true);
+  queue.store(new rofl::crofframe());
+  rofl::openflow::cofmsg *msg = nullptr;
+  rofl::crofframe *frame = nullptr;
+  uint64_t stamp = 0;
+  CPPUNIT_ASSERT(queue.retrieve(msg, frame, stamp));
+  CPPUNIT_ASSERT(stamp != 0);
+  delete frame;
+
+  sum.clear();
+  CPPUNIT_ASSERT(sum.get_packets() == 0);
+  CPPUNIT_ASSERT(sum.get_delay().get_count() == 0);
+}
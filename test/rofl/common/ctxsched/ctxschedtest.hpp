@@ -0,0 +1,36 @@
+/*
+ * ctxschedtest.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef TEST_SRC_ROFL_COMMON_CTXSCHED_TEST_HPP_
+#define TEST_SRC_ROFL_COMMON_CTXSCHED_TEST_HPP_
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "rofl/common/ctxsched.hpp"
+
+class ctxschedtest : public CppUnit::TestFixture {
+  CPPUNIT_TEST_SUITE(ctxschedtest);
+  CPPUNIT_TEST(testStrict);
+  CPPUNIT_TEST(testFairness);
+  CPPUNIT_TEST(testQuantum);
+  CPPUNIT_TEST(testIdle);
+  CPPUNIT_TEST(testStats);
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void setUp();
+  void tearDown();
+
+public:
+  void testStrict();
+  void testFairness();
+  void testQuantum();
+  void testIdle();
+  void testStats();
+};
+
+#endif /* TEST_SRC_ROFL_COMMON_CTXSCHED_TEST_HPP_ */
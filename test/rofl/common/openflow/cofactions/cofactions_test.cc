@@ -4,6 +4,7 @@
 #include <cppunit/ui/text/TestRunner.h>
 
 #include "cofactions_test.h"
+#include "rofl/common/ctimespec.hpp"
 
 CPPUNIT_TEST_SUITE_REGISTRATION(cofactions_test);
 
@@ -46,3 +47,165 @@ void cofactions_test::testActions() {
 
   // std::cerr << "clone:" << std::endl << clone;
 }
+
+void cofactions_test::testOrder() {
+  rofl::openflow::cofactions actions(rofl::openflow13::OFP_VERSION);
+
+  /* inserted out of order, exceeds inline entries */
+  for (unsigned int i = 8; i > 0; i--) {
+    actions.add_action_output(rofl::cindex(2 * i)).set_port_no(i);
+  }
+  actions.add_action_set_field(rofl::cindex(5))
+      .set_oxm(rofl::openflow::coxmatch_ofb_eth_type(0x0800));
+  actions.add_action_push_vlan(rofl::cindex(0)).set_eth_type(0x8100);
+  CPPUNIT_ASSERT(actions.size() == 10);
+  CPPUNIT_ASSERT(actions.count_action_output() == 8);
+
+  std::list<uint32_t> ports = actions.actions_output_ports();
+  uint32_t port_no = 0;
+  for (std::list<uint32_t>::iterator it = ports.begin(); it != ports.end();
+       ++it) {
+    CPPUNIT_ASSERT(*it == ++port_no);
+  }
+
+  std::map<rofl::cindex, unsigned int> index = actions.get_actions_index();
+  CPPUNIT_ASSERT(index.size() == 10);
+  CPPUNIT_ASSERT(index[rofl::cindex(5)] == rofl::openflow::OFPAT_SET_FIELD);
+
+  /* replacing an action changes its type */
+  actions.add_action_group(rofl::cindex(4)).set_group_id(7);
+  CPPUNIT_ASSERT(actions.size() == 10);
+  CPPUNIT_ASSERT(not actions.has_action_output(rofl::cindex(4)));
+  CPPUNIT_ASSERT(actions.get_action_group(rofl::cindex(4)).get_group_id() ==
+                 7);
+
+  try {
+    actions.get_action_output(rofl::cindex(5));
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::openflow::eActionNotFound &e) {
+  }
+
+  try {
+    actions.drop_action_output(rofl::cindex(3));
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::openflow::eActionInvalType &e) {
+  }
+  CPPUNIT_ASSERT(not actions.has_action(rofl::cindex(3)));
+
+  rofl::openflow::cofactions copy(actions);
+  CPPUNIT_ASSERT(copy.size() == actions.size());
+
+  rofl::cmemory packed(actions.length());
+  actions.pack(packed.somem(), packed.memlen());
+  rofl::cmemory test(copy.length());
+  copy.pack(test.somem(), test.memlen());
+  CPPUNIT_ASSERT(packed == test);
+
+  rofl::openflow::cofactions clone(rofl::openflow13::OFP_VERSION);
+  clone.unpack(packed.somem(), packed.memlen());
+  CPPUNIT_ASSERT(clone.size() == 10);
+  CPPUNIT_ASSERT(clone.has_action_push_vlan(rofl::cindex(0)));
+  CPPUNIT_ASSERT(clone.has_action_group(rofl::cindex(2)));
+
+  actions.drop_action_set_field(rofl::cindex(5));
+  actions.drop_action_push_vlan(rofl::cindex(0));
+  CPPUNIT_ASSERT(actions.size() == 8);
+  CPPUNIT_ASSERT(actions.length() == 7 * 16 + 8);
+
+  actions.clear();
+  CPPUNIT_ASSERT(actions.empty());
+  actions = copy;
+  CPPUNIT_ASSERT(actions.length() == packed.length());
+}
+
+void cofactions_test::testLength() {
+  rofl::openflow::cofactions actions(rofl::openflow13::OFP_VERSION);
+  CPPUNIT_ASSERT(actions.length() == 0);
+
+  actions.add_action_output(rofl::cindex(0)).set_port_no(1);
+  CPPUNIT_ASSERT(actions.length() == 16);
+  actions.set_action_output(rofl::cindex(1)).set_port_no(2);
+  CPPUNIT_ASSERT(actions.length() == 32);
+  actions.add_action_set_field(rofl::cindex(2))
+      .set_oxm(rofl::openflow::coxmatch_ofb_eth_type(0x0800));
+  CPPUNIT_ASSERT(actions.length() == 48);
+
+  rofl::openflow::cofactions copy(actions);
+  CPPUNIT_ASSERT(copy.length() == 48);
+  copy.drop_action_set_field(rofl::cindex(2));
+  CPPUNIT_ASSERT(copy.length() == 32);
+  CPPUNIT_ASSERT(actions.length() == 48);
+
+  /* action lengths depend on the OpenFlow version */
+  copy.set_version(rofl::openflow10::OFP_VERSION);
+  CPPUNIT_ASSERT(copy.length() == 16);
+
+  copy.clear();
+  CPPUNIT_ASSERT(copy.length() == 0);
+
+  /* a reference modified after length() leaves a stale cached length,
+   * pack() must not overrun a buffer sized by it */
+  rofl::openflow::cofactions grown(rofl::openflow13::OFP_VERSION);
+  rofl::openflow::cofaction_set_field &set_field =
+      grown.add_action_set_field(rofl::cindex(0));
+  set_field.set_oxm(rofl::openflow::coxmatch_ofb_eth_type(0x0800));
+  rofl::cmemory buf(grown.length());
+  CPPUNIT_ASSERT(buf.memlen() == 16);
+  set_field.set_oxm(
+      rofl::openflow::coxmatch_ofb_ipv6_dst(rofl::caddress_in6("fe80::1")));
+  try {
+    grown.pack(buf.somem(), buf.memlen());
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::eInvalid &e) {
+  }
+  CPPUNIT_ASSERT(grown.length() == 24);
+}
+
+void cofactions_test::testBenchmark() {
+  const unsigned int rounds = 200000;
+
+  /* typical packet-out/flow-mod action list */
+  rofl::openflow::cofactions actions(rofl::openflow13::OFP_VERSION);
+  rofl::cmemory mem(64);
+
+  rofl::ctimespec start(rofl::ctimespec::now());
+  for (unsigned int i = 0; i < rounds; i++) {
+    actions.clear();
+    actions.add_action_push_vlan(rofl::cindex(0)).set_eth_type(0x8100);
+    actions.add_action_set_field(rofl::cindex(1))
+        .set_oxm(rofl::openflow::coxmatch_ofb_vlan_vid(
+            rofl::openflow::OFPVID_PRESENT | 10));
+    actions.add_action_set_queue(rofl::cindex(2)).set_queue_id(1);
+    actions.add_action_output(rofl::cindex(3)).set_port_no(i);
+  }
+  rofl::ctimespec delta = rofl::ctimespec::now() - start;
+  double build_secs =
+      delta.get_tspec().tv_sec + delta.get_tspec().tv_nsec / 1e9;
+
+  CPPUNIT_ASSERT(actions.length() == 48);
+
+  unsigned int num_actions = 0;
+  start = rofl::ctimespec::now();
+  for (unsigned int i = 0; i < rounds; i++) {
+    rofl::openflow::cofactions copy(actions);
+    num_actions += copy.size();
+  }
+  delta = rofl::ctimespec::now() - start;
+  double copy_secs =
+      delta.get_tspec().tv_sec + delta.get_tspec().tv_nsec / 1e9;
+
+  start = rofl::ctimespec::now();
+  for (unsigned int i = 0; i < rounds; i++) {
+    actions.pack(mem.somem(), actions.length());
+  }
+  delta = rofl::ctimespec::now() - start;
+  double pack_secs =
+      delta.get_tspec().tv_sec + delta.get_tspec().tv_nsec / 1e9;
+
+  CPPUNIT_ASSERT(num_actions == 4 * rounds);
+
+  std::cerr << "4 actions, " << rounds << " rounds: build "
+            << (unsigned long)(rounds / build_secs) << "/s, copy "
+            << (unsigned long)(rounds / copy_secs) << "/s, pack "
+            << (unsigned long)(rounds / pack_secs) << "/s" << std::endl;
+}
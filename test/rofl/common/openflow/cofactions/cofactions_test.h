@@ -8,6 +8,9 @@ class cofactions_test : public CppUnit::TestFixture {
 
   CPPUNIT_TEST_SUITE(cofactions_test);
   CPPUNIT_TEST(testActions);
+  CPPUNIT_TEST(testOrder);
+  CPPUNIT_TEST(testLength);
+  CPPUNIT_TEST(testBenchmark);
   CPPUNIT_TEST_SUITE_END();
 
 private:
@@ -16,4 +19,7 @@ public:
   void tearDown();
 
   void testActions();
+  void testOrder();
+  void testLength();
+  void testBenchmark();
 };
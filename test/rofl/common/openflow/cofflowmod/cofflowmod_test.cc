@@ -4,6 +4,7 @@
 #include <cppunit/ui/text/TestRunner.h>
 
 #include "cofflowmod_test.h"
+#include "rofl/common/ctimespec.hpp"
 
 CPPUNIT_TEST_SUITE_REGISTRATION(cofflowmod_test);
 
@@ -167,3 +168,105 @@ void cofflowmod_test::testFlowMod13() {
       clone.get_instructions().get_inst_goto_table().get_table_id() ==
       (table_id + 1));
 }
+
+void cofflowmod_test::testInstructions() {
+  rofl::openflow::cofinstructions instructions(rofl::openflow13::OFP_VERSION);
+
+  /* added in reverse order, packed sorted by type */
+  instructions.add_inst_meter().set_meter_id(3);
+  instructions.add_inst_apply_actions()
+      .set_actions()
+      .add_action_output(rofl::cindex(0))
+      .set_port_no(1);
+  instructions.add_inst_goto_table().set_table_id(2);
+  CPPUNIT_ASSERT(instructions.get_instructions().size() == 3);
+  CPPUNIT_ASSERT(instructions.has_inst(rofl::openflow::OFPIT_METER));
+  CPPUNIT_ASSERT(not instructions.has_inst_write_actions());
+
+  rofl::cmemory packed(instructions.length());
+  instructions.pack(packed.somem(), packed.memlen());
+  CPPUNIT_ASSERT(packed.length() == 8 + 24 + 8);
+  CPPUNIT_ASSERT(be16toh(*(uint16_t *)(packed.somem() + 0)) ==
+                 rofl::openflow::OFPIT_GOTO_TABLE);
+  CPPUNIT_ASSERT(be16toh(*(uint16_t *)(packed.somem() + 8)) ==
+                 rofl::openflow::OFPIT_APPLY_ACTIONS);
+  CPPUNIT_ASSERT(be16toh(*(uint16_t *)(packed.somem() + 32)) ==
+                 rofl::openflow::OFPIT_METER);
+
+  /* re-adding an instruction resets it */
+  instructions.add_inst_apply_actions();
+  CPPUNIT_ASSERT(instructions.get_inst_apply_actions().get_actions().empty());
+
+  rofl::openflow::cofinstructions clone(instructions);
+  CPPUNIT_ASSERT(clone == instructions);
+  CPPUNIT_ASSERT(clone.get_inst_meter().get_meter_id() == 3);
+
+  clone.drop_inst_meter();
+  CPPUNIT_ASSERT(not clone.has_inst_meter());
+  try {
+    clone.get_inst_meter();
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::exception &e) {
+  }
+  CPPUNIT_ASSERT(not(clone == instructions));
+
+  clone.unpack(packed.somem(), packed.memlen());
+  CPPUNIT_ASSERT(clone.get_instructions().size() == 3);
+  CPPUNIT_ASSERT(clone.get_inst_apply_actions().get_actions().size() == 1);
+  CPPUNIT_ASSERT(clone.get_inst_goto_table().get_table_id() == 2);
+
+  clone.clear();
+  CPPUNIT_ASSERT(clone.get_instructions().empty());
+  CPPUNIT_ASSERT(clone.length() == 0);
+}
+
+void cofflowmod_test::testBenchmark() {
+  const unsigned int rounds = 100000;
+
+  /* typical flow-mod: 5-tuple match, apply-actions and goto-table */
+  rofl::openflow::cofflowmod flowmod(rofl::openflow13::OFP_VERSION);
+  flowmod.set_match().set_in_port(1);
+  flowmod.set_match().set_eth_type(0x0800);
+  flowmod.set_match().set_ip_proto(6);
+  flowmod.set_match().set_ipv4_src(rofl::caddress_in4("10.0.0.1"));
+  flowmod.set_match().set_ipv4_dst(rofl::caddress_in4("10.0.0.2"));
+  flowmod.set_match().set_tcp_src(1024);
+  flowmod.set_match().set_tcp_dst(80);
+  flowmod.set_instructions()
+      .set_inst_apply_actions()
+      .set_actions()
+      .add_action_set_queue(rofl::cindex(0))
+      .set_queue_id(1);
+  flowmod.set_instructions()
+      .set_inst_apply_actions()
+      .set_actions()
+      .add_action_output(rofl::cindex(1))
+      .set_port_no(2);
+  flowmod.set_instructions().set_inst_goto_table().set_table_id(1);
+
+  rofl::cmemory mem(flowmod.length());
+  size_t len = 0;
+
+  rofl::ctimespec start(rofl::ctimespec::now());
+  for (unsigned int i = 0; i < rounds; i++) {
+    rofl::openflow::cofflowmod copy(flowmod);
+    len += copy.get_instructions().length();
+  }
+  rofl::ctimespec delta = rofl::ctimespec::now() - start;
+  double copy_secs =
+      delta.get_tspec().tv_sec + delta.get_tspec().tv_nsec / 1e9;
+
+  start = rofl::ctimespec::now();
+  for (unsigned int i = 0; i < rounds; i++) {
+    flowmod.pack(mem.somem(), mem.memlen());
+  }
+  delta = rofl::ctimespec::now() - start;
+  double pack_secs =
+      delta.get_tspec().tv_sec + delta.get_tspec().tv_nsec / 1e9;
+
+  CPPUNIT_ASSERT(len == rounds * flowmod.get_instructions().length());
+
+  std::cerr << "flow-mod, " << rounds << " rounds: copy "
+            << (unsigned long)(rounds / copy_secs) << "/s, pack "
+            << (unsigned long)(rounds / pack_secs) << "/s" << std::endl;
+}
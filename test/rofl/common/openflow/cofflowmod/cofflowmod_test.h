@@ -9,6 +9,8 @@ class cofflowmod_test : public CppUnit::TestFixture {
   CPPUNIT_TEST_SUITE(cofflowmod_test);
   CPPUNIT_TEST(testFlowMod10);
   CPPUNIT_TEST(testFlowMod13);
+  CPPUNIT_TEST(testInstructions);
+  CPPUNIT_TEST(testBenchmark);
   CPPUNIT_TEST_SUITE_END();
 
 private:
@@ -18,4 +20,6 @@ public:
 
   void testFlowMod10();
   void testFlowMod13();
+  void testInstructions();
+  void testBenchmark();
 };
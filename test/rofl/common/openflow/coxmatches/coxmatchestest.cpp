@@ -11,6 +11,7 @@
 #include <cppunit/ui/text/TestRunner.h>
 
 #include "coxmatchestest.hpp"
+#include "rofl/common/ctimespec.hpp"
 
 using namespace rofl::openflow;
 
@@ -430,3 +431,310 @@ void coxmatchestest::testExp() {
   CPPUNIT_ASSERT(clone.get_exp_match(exp_id, oxm_id2).get_value() == u17value);
   CPPUNIT_ASSERT(clone.get_exp_match(exp_id, oxm_id2).get_mask() == u17mask);
 }
+
+static void fill_lazy_tlvs(rofl::cmemory &mem) {
+  mem.resize(28);
+  // UDP_SRC
+  mem[0] = 0x80;
+  mem[1] = 0x00;
+  mem[2] = 0x1e; // (UDP_SRC == 15) << 1, has-mask == 0
+  mem[3] = 0x02;
+  mem[4] = 0x11;
+  mem[5] = 0x12;
+  // IN_PORT
+  mem[6] = 0x80;
+  mem[7] = 0x00;
+  mem[8] = 0x00; // (IN_PORT == 0) << 1, has-mask == 0
+  mem[9] = 0x04;
+  mem[10] = 0x00;
+  mem[11] = 0x00;
+  mem[12] = 0x00;
+  mem[13] = 0x07;
+  // ETH_DST
+  mem[14] = 0x80;
+  mem[15] = 0x00;
+  mem[16] = 0x06; // (ETH_DST == 3) << 1, has-mask == 0
+  mem[17] = 0x06;
+  mem[18] = 0xb1;
+  mem[19] = 0xb2;
+  mem[20] = 0xb3;
+  mem[21] = 0xb4;
+  mem[22] = 0xb5;
+  mem[23] = 0xb6;
+  // padding
+  mem[24] = 0x00;
+  mem[25] = 0x00;
+  mem[26] = 0x00;
+  mem[27] = 0x00;
+}
+
+void coxmatchestest::testLazyUnPack() {
+  rofl::cmemory mem;
+  fill_lazy_tlvs(mem);
+
+  rofl::openflow::coxmatches lazy;
+  lazy.set_lazy();
+  lazy.unpack(mem.somem(), mem.memlen());
+
+  rofl::openflow::coxmatches eager;
+  eager.unpack(mem.somem(), mem.memlen());
+
+  CPPUNIT_ASSERT(lazy.get_lazy());
+  CPPUNIT_ASSERT(lazy.length() == 24);
+  CPPUNIT_ASSERT(lazy.has_ofb_in_port());
+  CPPUNIT_ASSERT(not lazy.has_ofb_in_phy_port());
+  CPPUNIT_ASSERT(lazy.get_ofb_in_port().get_u32value() == 7);
+  CPPUNIT_ASSERT(lazy.get_ids() == eager.get_ids());
+
+  try {
+    lazy.get_ofb_tcp_src();
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::openflow::eOxmInval &e) {
+  }
+
+  /* unmodified: raw TLVs are re-emitted in their original order */
+  rofl::cmemory packed(lazy.length());
+  lazy.pack(packed.somem(), packed.memlen());
+  CPPUNIT_ASSERT(packed == rofl::cmemory(mem.somem(), 24));
+
+  /* copies keep the raw TLVs */
+  rofl::openflow::coxmatches copy(lazy);
+  CPPUNIT_ASSERT(copy.get_ofb_udp_src().get_u16value() == 0x1112);
+  CPPUNIT_ASSERT(copy == eager);
+  CPPUNIT_ASSERT(lazy == eager);
+  lazy.pack(packed.somem(), packed.memlen());
+  CPPUNIT_ASSERT(packed == rofl::cmemory(mem.somem(), 24));
+
+  /* malformed TLVs are rejected by unpack(), not by a later accessor */
+  rofl::cmemory truncated(mem.somem(), 20);
+  try {
+    rofl::openflow::coxmatches bad;
+    bad.set_lazy();
+    bad.unpack(truncated.somem(), truncated.memlen());
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::openflow::eOxmBadLen &e) {
+  }
+
+  rofl::cmemory short_field(mem);
+  short_field[9] = 0x02; // IN_PORT with a 2 byte payload
+  try {
+    rofl::openflow::coxmatches bad;
+    bad.set_lazy();
+    bad.unpack(short_field.somem(), short_field.memlen());
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::openflow::eOxmBadLen &e) {
+  }
+}
+
+void coxmatchestest::testLazyModify() {
+  rofl::cmemory mem;
+  fill_lazy_tlvs(mem);
+
+  rofl::openflow::coxmatches lazy;
+  lazy.set_lazy();
+  lazy.unpack(mem.somem(), mem.memlen());
+
+  /* reference obtained before modification remains valid */
+  const rofl::openflow::coxmatch_ofb_in_port &in_port = lazy.get_ofb_in_port();
+
+  lazy.set_ofb_udp_src().set_u16value(0x2122);
+  lazy.drop_ofb_eth_dst();
+
+  CPPUNIT_ASSERT(in_port.get_u32value() == 7);
+  CPPUNIT_ASSERT(lazy.get_matches().size() == 2);
+  CPPUNIT_ASSERT(lazy.length() == 14);
+
+  rofl::openflow::coxmatches eager;
+  eager.add_ofb_in_port(7);
+  eager.add_ofb_udp_src(0x2122);
+
+  rofl::cmemory packed(lazy.length());
+  lazy.pack(packed.somem(), packed.memlen());
+  rofl::cmemory test(eager.length());
+  eager.pack(test.somem(), test.memlen());
+  CPPUNIT_ASSERT(packed == test);
+
+  /* duplicate TLVs: last one wins as in eager mode */
+  rofl::cmemory dup(12);
+  for (unsigned int i = 0; i < 2; i++) {
+    dup[6 * i + 0] = 0x80;
+    dup[6 * i + 1] = 0x00;
+    dup[6 * i + 2] = 0x1e;
+    dup[6 * i + 3] = 0x02;
+    dup[6 * i + 4] = 0x31;
+    dup[6 * i + 5] = 0x30 + i;
+  }
+  lazy.unpack(dup.somem(), dup.memlen());
+  CPPUNIT_ASSERT(lazy.length() == 6);
+  CPPUNIT_ASSERT(lazy.get_ofb_udp_src().get_u16value() == 0x3131);
+  packed.resize(lazy.length());
+  lazy.pack(packed.somem(), packed.memlen());
+  CPPUNIT_ASSERT(packed == rofl::cmemory(dup.somem() + 6, 6));
+}
+
+void coxmatchestest::testManyMatches() {
+  /* exceeds inline entries and blocks, includes OXMs larger than a block */
+  rofl::openflow::coxmatches matches;
+  matches.add_ofb_tcp_dst(80);
+  matches.add_ofb_ipv6_src(rofl::caddress_in6("fe80::1"));
+  matches.add_ofb_in_port(1);
+  matches.add_ofb_eth_type(0x86dd);
+  matches.add_ofb_ipv6_dst(rofl::caddress_in6("fe80::2"));
+  matches.add_ofb_ip_proto(6);
+  matches.add_ofb_vlan_vid(0x1001);
+  matches.add_ofb_metadata(0x0102030405060708ULL);
+  matches.add_ofb_tcp_src(1024);
+  matches.add_ofb_eth_dst(rofl::cmacaddr("b1:b2:b3:b4:b5:b6"));
+  matches.add_ofb_eth_src(rofl::cmacaddr("c1:c2:c3:c4:c5:c6"));
+  matches.add_ofb_ip_dscp(0x0a);
+
+  /* reference remains valid while entries grow */
+  const rofl::openflow::coxmatch_ofb_tcp_dst &tcp_dst =
+      matches.get_ofb_tcp_dst();
+  matches.add_ofb_vlan_pcp(3);
+  matches.add_ofb_ip_ecn(1);
+  CPPUNIT_ASSERT(tcp_dst.get_u16value() == 80);
+  CPPUNIT_ASSERT(matches.get_matches().size() == 14);
+
+  /* ids are sorted by type */
+  std::vector<uint64_t> ids = matches.get_ids();
+  CPPUNIT_ASSERT(ids.size() == 14);
+  for (unsigned int i = 1; i < ids.size(); i++) {
+    CPPUNIT_ASSERT(ids[i - 1] < ids[i]);
+  }
+
+  rofl::openflow::coxmatches copy(matches);
+  CPPUNIT_ASSERT(copy == matches);
+  CPPUNIT_ASSERT(copy.get_ofb_ipv6_dst().get_u128value() ==
+                 rofl::caddress_in6("fe80::2"));
+
+  rofl::cmemory mem(matches.length());
+  matches.pack(mem.somem(), mem.memlen());
+  rofl::openflow::coxmatches clone;
+  clone.unpack(mem.somem(), mem.memlen());
+  CPPUNIT_ASSERT(clone == matches);
+
+  for (unsigned int i = 0; i < 4; i++) {
+    clone.drop_ofb_ipv6_src();
+    clone.drop_ofb_metadata();
+    clone.add_ofb_ipv6_src(rofl::caddress_in6("fe80::3"));
+    clone.add_ofb_metadata(i);
+  }
+  CPPUNIT_ASSERT(clone.get_matches().size() == 14);
+  CPPUNIT_ASSERT(clone.get_ofb_metadata().get_u64value() == 3);
+  CPPUNIT_ASSERT(clone.get_ofb_ipv6_src().get_u128value() ==
+                 rofl::caddress_in6("fe80::3"));
+  CPPUNIT_ASSERT(clone.length() == matches.length());
+
+  clone.clear();
+  CPPUNIT_ASSERT(clone.get_matches().size() == 0);
+  clone = copy;
+  CPPUNIT_ASSERT(clone == matches);
+}
+
+void coxmatchestest::testLength() {
+  rofl::openflow::coxmatches matches;
+  CPPUNIT_ASSERT(matches.length() == 0);
+
+  matches.add_ofb_eth_type(0x0800);
+  CPPUNIT_ASSERT(matches.length() == 6);
+  matches.add_ofb_ipv4_dst(rofl::caddress_in4("10.0.0.1"));
+  CPPUNIT_ASSERT(matches.length() == 14);
+
+  /* a mask set via the returned reference invalidates the cached length */
+  matches.set_ofb_ipv4_dst().set_u32mask(0xffffff00);
+  CPPUNIT_ASSERT(matches.length() == 18);
+
+  rofl::cmemory packed(matches.length());
+  matches.pack(packed.somem(), packed.memlen());
+
+  rofl::openflow::coxmatches clone(matches);
+  CPPUNIT_ASSERT(clone.length() == 18);
+  clone.drop_ofb_eth_type();
+  CPPUNIT_ASSERT(clone.length() == 12);
+  CPPUNIT_ASSERT(matches.length() == 18);
+
+  clone.set_lazy();
+  clone.unpack(packed.somem(), packed.memlen());
+  CPPUNIT_ASSERT(clone.length() == 18);
+  clone.add_ofb_ip_proto(6);
+  CPPUNIT_ASSERT(clone.length() == 23);
+
+  clone.clear();
+  CPPUNIT_ASSERT(clone.length() == 0);
+
+  /* a reference modified after length() leaves a stale cached length,
+   * pack() must not overrun a buffer sized by it */
+  rofl::openflow::coxmatches grown;
+  rofl::openflow::coxmatch_ofb_ipv4_dst &dst =
+      grown.add_ofb_ipv4_dst(rofl::caddress_in4("10.0.0.1"));
+  rofl::cmemory buf(grown.length());
+  dst.set_u32mask(0xffffff00);
+  try {
+    grown.pack(buf.somem(), buf.memlen());
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::eBadMatchBadLen &e) {
+  }
+  CPPUNIT_ASSERT(grown.length() == 12);
+}
+
+void coxmatchestest::testBenchmark() {
+  const unsigned int rounds = 200000;
+
+  /* typical 5-tuple match */
+  rofl::openflow::coxmatches matches;
+  matches.add_ofb_in_port(1);
+  matches.add_ofb_eth_type(0x0800);
+  matches.add_ofb_ip_proto(6);
+  matches.add_ofb_ipv4_src(rofl::caddress_in4("10.0.0.1"));
+  matches.add_ofb_ipv4_dst(rofl::caddress_in4("10.0.0.2"));
+  matches.add_ofb_tcp_src(1024);
+  matches.add_ofb_tcp_dst(80);
+
+  rofl::cmemory mem(matches.length());
+  unsigned int hits = 0;
+
+  rofl::ctimespec start(rofl::ctimespec::now());
+  for (unsigned int i = 0; i < rounds; i++) {
+    rofl::openflow::coxmatches copy(matches);
+    hits += copy.get_matches().empty() ? 0 : 1;
+  }
+  rofl::ctimespec delta = rofl::ctimespec::now() - start;
+  double copy_secs =
+      delta.get_tspec().tv_sec + delta.get_tspec().tv_nsec / 1e9;
+
+  rofl::openflow::coxmatches other(matches);
+  start = rofl::ctimespec::now();
+  for (unsigned int i = 0; i < rounds; i++) {
+    hits += (matches == other) ? 1 : 0;
+  }
+  delta = rofl::ctimespec::now() - start;
+  double compare_secs =
+      delta.get_tspec().tv_sec + delta.get_tspec().tv_nsec / 1e9;
+
+  start = rofl::ctimespec::now();
+  for (unsigned int i = 0; i < rounds; i++) {
+    matches.pack(mem.somem(), mem.memlen());
+  }
+  delta = rofl::ctimespec::now() - start;
+  double pack_secs =
+      delta.get_tspec().tv_sec + delta.get_tspec().tv_nsec / 1e9;
+
+  rofl::openflow::coxmatches clone;
+  start = rofl::ctimespec::now();
+  for (unsigned int i = 0; i < rounds; i++) {
+    clone.unpack(mem.somem(), mem.memlen());
+  }
+  delta = rofl::ctimespec::now() - start;
+  double unpack_secs =
+      delta.get_tspec().tv_sec + delta.get_tspec().tv_nsec / 1e9;
+
+  CPPUNIT_ASSERT(hits == 2 * rounds);
+  CPPUNIT_ASSERT(clone == matches);
+
+  std::cerr << "5-tuple match, " << rounds << " rounds: copy "
+            << (unsigned long)(rounds / copy_secs) << "/s, compare "
+            << (unsigned long)(rounds / compare_secs) << "/s, pack "
+            << (unsigned long)(rounds / pack_secs) << "/s, unpack "
+            << (unsigned long)(rounds / unpack_secs) << "/s" << std::endl;
+}
@@ -27,6 +27,11 @@ class coxmatchestest : public CppUnit::TestFixture {
   CPPUNIT_TEST(testNonStrictMatching);
   CPPUNIT_TEST(testOxmVlanVidUnpack);
   CPPUNIT_TEST(testExp);
+  CPPUNIT_TEST(testLazyUnPack);
+  CPPUNIT_TEST(testLazyModify);
+  CPPUNIT_TEST(testManyMatches);
+  CPPUNIT_TEST(testLength);
+  CPPUNIT_TEST(testBenchmark);
   CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -47,6 +52,13 @@ public:
   void testOxmVlanVidUnpack();
 
   void testExp();
+
+  void testLazyUnPack();
+  void testLazyModify();
+
+  void testManyMatches();
+  void testLength();
+  void testBenchmark();
 };
 
 #endif /* TEST_SRC_ROFL_COMMON_OPENFLOW_COXMATCH_TEST_HPP_ */
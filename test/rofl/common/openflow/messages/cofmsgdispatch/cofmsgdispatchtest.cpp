@@ -0,0 +1,248 @@
+/*
+ * cofmsgdispatchtest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <stdlib.h>
+
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include "cofmsgdispatchtest.hpp"
+
+#include "rofl/common/ctimespec.hpp"
+#include "rofl/common/openflow/messages/cofmsg_echo.h"
+#include "rofl/common/openflow/messages/cofmsg_error.h"
+#include "rofl/common/openflow/messages/cofmsg_flow_mod.h"
+#include "rofl/common/openflow/messages/cofmsg_flow_stats.h"
+#include "rofl/common/openflow/messages/cofmsg_packet_in.h"
+#include "rofl/common/openflow/messages/cofmsg_port_desc_stats.h"
+
+using namespace rofl::openflow;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(cofmsgdispatchtest);
+
+void cofmsgdispatchtest::setUp() {}
+
+void cofmsgdispatchtest::tearDown() {}
+
+void cofmsgdispatchtest::testTags() {
+  for (unsigned int i = cofmsg::MSG_TAG_HELLO; i < cofmsg::MSG_TAG_MAX; i++) {
+    cofmsg::msg_tag_t tag = (cofmsg::msg_tag_t)i;
+
+    cofmsg *msg = cofmsg_dispatch::create(tag);
+    CPPUNIT_ASSERT(msg->get_tag() == tag);
+
+    cofmsg *clone = cofmsg_dispatch::clone(*msg);
+    CPPUNIT_ASSERT(clone->get_tag() == tag);
+
+    delete clone;
+    delete msg;
+  }
+
+  cofmsg_error_bad_request_bad_type error(rofl::openflow13::OFP_VERSION, 0);
+  CPPUNIT_ASSERT(error.get_tag() == cofmsg::MSG_TAG_ERROR);
+
+  /* assignment keeps the tag of the destination */
+  cofmsg base;
+  base = cofmsg_echo_request(rofl::openflow13::OFP_VERSION, 1);
+  CPPUNIT_ASSERT(base.get_tag() == cofmsg::MSG_TAG_UNKNOWN);
+}
+
+void cofmsgdispatchtest::testLookup() {
+  CPPUNIT_ASSERT(cofmsg_dispatch::lookup(rofl::openflow10::OFP_VERSION,
+                                         rofl::openflow10::OFPT_PORT_MOD) ==
+                 cofmsg::MSG_TAG_PORT_MOD);
+  CPPUNIT_ASSERT(cofmsg_dispatch::lookup(rofl::openflow12::OFP_VERSION,
+                                         rofl::openflow12::OFPT_PORT_MOD) ==
+                 cofmsg::MSG_TAG_PORT_MOD);
+  CPPUNIT_ASSERT(cofmsg_dispatch::lookup(rofl::openflow13::OFP_VERSION,
+                                         rofl::openflow13::OFPT_METER_MOD) ==
+                 cofmsg::MSG_TAG_METER_MOD);
+
+  CPPUNIT_ASSERT(cofmsg_dispatch::lookup(rofl::openflow10::OFP_VERSION,
+                                         rofl::openflow10::OFPT_STATS_REPLY,
+                                         rofl::openflow10::OFPST_QUEUE) ==
+                 cofmsg::MSG_TAG_QUEUE_STATS_REPLY);
+  CPPUNIT_ASSERT(cofmsg_dispatch::lookup(rofl::openflow10::OFP_VERSION,
+                                         rofl::openflow10::OFPT_STATS_REQUEST,
+                                         rofl::openflow10::OFPST_VENDOR) ==
+                 cofmsg::MSG_TAG_EXPERIMENTER_STATS_REQUEST);
+  CPPUNIT_ASSERT(cofmsg_dispatch::lookup(
+                     rofl::openflow12::OFP_VERSION,
+                     rofl::openflow12::OFPT_STATS_REQUEST,
+                     rofl::openflow12::OFPST_GROUP_FEATURES) ==
+                 cofmsg::MSG_TAG_GROUP_FEATURES_STATS_REQUEST);
+  CPPUNIT_ASSERT(cofmsg_dispatch::lookup(
+                     rofl::openflow13::OFP_VERSION,
+                     rofl::openflow13::OFPT_MULTIPART_REPLY,
+                     rofl::openflow13::OFPMP_PORT_DESC) ==
+                 cofmsg::MSG_TAG_PORT_DESC_STATS_REPLY);
+  CPPUNIT_ASSERT(cofmsg_dispatch::lookup(
+                     rofl::openflow13::OFP_VERSION,
+                     rofl::openflow13::OFPT_MULTIPART_REPLY,
+                     rofl::openflow13::OFPMP_EXPERIMENTER) ==
+                 cofmsg::MSG_TAG_EXPERIMENTER_STATS_REPLY);
+
+  try {
+    cofmsg_dispatch::lookup(0x07, 0);
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::eBadRequestBadVersion &e) {
+  }
+  try {
+    cofmsg_dispatch::lookup(rofl::openflow10::OFP_VERSION,
+                            rofl::openflow10::OFPT_QUEUE_GET_CONFIG_REPLY + 1);
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::eBadRequestBadType &e) {
+  }
+  try {
+    cofmsg_dispatch::lookup(rofl::openflow12::OFP_VERSION,
+                            rofl::openflow12::OFPT_METER_MOD);
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::eBadRequestBadType &e) {
+  }
+  try {
+    cofmsg_dispatch::lookup(rofl::openflow10::OFP_VERSION,
+                            rofl::openflow10::OFPT_STATS_REQUEST,
+                            rofl::openflow12::OFPST_GROUP);
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::eBadRequestBadStat &e) {
+  }
+  try {
+    cofmsg_dispatch::lookup(rofl::openflow13::OFP_VERSION,
+                            rofl::openflow13::OFPT_MULTIPART_REQUEST,
+                            rofl::openflow13::OFPMP_PORT_DESC + 1);
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::eBadRequestBadStat &e) {
+  }
+}
+
+void cofmsgdispatchtest::testParse() {
+  cofmsg_flow_stats_request request(rofl::openflow13::OFP_VERSION, 0xa1a2a3a4);
+  rofl::cmemory mem(request.length());
+  request.pack(mem.somem(), mem.length());
+
+  cofmsg *msg = cofmsg_dispatch::parse(mem.somem(), mem.length());
+  CPPUNIT_ASSERT(msg->get_tag() == cofmsg::MSG_TAG_FLOW_STATS_REQUEST);
+  CPPUNIT_ASSERT(msg->get_xid() == 0xa1a2a3a4);
+  CPPUNIT_ASSERT(cofmsg_dispatch::get_stats_type(*msg) ==
+                 rofl::openflow13::OFPMP_FLOW);
+  delete msg;
+
+  /* stats header truncated */
+  try {
+    cofmsg_dispatch::parse(mem.somem(),
+                           sizeof(struct rofl::openflow::ofp_header));
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::eBadRequestBadLen &e) {
+  }
+  try {
+    cofmsg_dispatch::parse(mem.somem(), 4);
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::eBadRequestBadLen &e) {
+  }
+}
+
+void cofmsgdispatchtest::testCast() {
+  cofmsg_port_desc_stats_reply reply(rofl::openflow13::OFP_VERSION);
+  cofmsg *msg = &reply;
+
+  CPPUNIT_ASSERT(cofmsg_cast<cofmsg_port_desc_stats_reply>(msg) == &reply);
+  CPPUNIT_ASSERT(cofmsg_cast<cofmsg_stats_reply>(msg) == &reply);
+  CPPUNIT_ASSERT(cofmsg_cast<cofmsg>(msg) == &reply);
+  CPPUNIT_ASSERT(cofmsg_cast<cofmsg_stats_request>(msg) == NULL);
+  CPPUNIT_ASSERT(cofmsg_cast<cofmsg_echo_request>(msg) == NULL);
+  CPPUNIT_ASSERT(cofmsg_cast<cofmsg_echo_request>((cofmsg *)NULL) == NULL);
+
+  try {
+    cofmsg_cast<cofmsg_flow_stats_reply>(*msg);
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::eBadRequestBadType &e) {
+  }
+}
+
+void cofmsgdispatchtest::testMerge() {
+  uint8_t version = rofl::openflow13::OFP_VERSION;
+
+  cofports ports1(version);
+  cofports ports2(version);
+  for (unsigned int i = 0; i < 4; i++) {
+    ports1.add_port(i);
+    ports2.add_port(i + 4);
+  }
+
+  cofmsg_port_desc_stats_reply reply(version, 1, 0, ports1);
+  cofmsg_port_desc_stats_reply fragment(version, 1, 0, ports2);
+
+  CPPUNIT_ASSERT(cofmsg_dispatch::merge(reply, fragment));
+  CPPUNIT_ASSERT(reply.get_ports().size() == 8);
+
+  /* no array body */
+  cofmsg_echo_request echo(version, 1);
+  CPPUNIT_ASSERT(not cofmsg_dispatch::merge(echo, echo));
+  CPPUNIT_ASSERT(not cofmsg_dispatch::merge(reply, echo));
+}
+
+void cofmsgdispatchtest::testBenchmark() {
+  const unsigned int count = 100000;
+  uint8_t version = rofl::openflow13::OFP_VERSION;
+  uint8_t data[64];
+  memset(data, 0, sizeof(data));
+
+  cofports ports(version);
+  for (unsigned int i = 0; i < 4; i++) {
+    ports.add_port(i).set_hwaddr(rofl::caddress_ll("01:02:03:04:05:06"));
+  }
+  cofflowmod flowmod(version);
+  flowmod.set_match().set_eth_dst(rofl::caddress_ll("00:11:22:33:44:55"));
+
+  std::vector<cofmsg *> msgs;
+  msgs.push_back(new cofmsg_echo_request(version, 1, data, 8));
+  msgs.push_back(new cofmsg_packet_in(version, 2, 0, sizeof(data), 0, 0, 0, 0,
+                                      cofmatch(version), data, sizeof(data)));
+  msgs.push_back(new cofmsg_flow_mod(version, 3, flowmod));
+  msgs.push_back(new cofmsg_port_desc_stats_reply(version, 4, 0, ports));
+
+  std::vector<rofl::cmemory *> mems;
+  for (auto msg : msgs) {
+    mems.push_back(new rofl::cmemory(msg->length()));
+    msg->pack(mems.back()->somem(), mems.back()->length());
+    delete msg;
+  }
+
+  unsigned int tags = 0;
+  rofl::ctimespec start = rofl::ctimespec::now();
+  for (unsigned int i = 0; i < count; i++) {
+    for (auto mem : mems) {
+      struct rofl::openflow::ofp_header *hdr =
+          (struct rofl::openflow::ofp_header *)mem->somem();
+      tags += cofmsg_dispatch::lookup(hdr->version, hdr->type,
+                                      be16toh(*(uint16_t *)(hdr + 1)));
+    }
+  }
+  rofl::ctimespec middle = rofl::ctimespec::now();
+  for (unsigned int i = 0; i < count; i++) {
+    for (auto mem : mems) {
+      delete cofmsg_dispatch::parse(mem->somem(), mem->length());
+    }
+  }
+  rofl::ctimespec stop = rofl::ctimespec::now();
+
+  for (auto mem : mems) {
+    delete mem;
+  }
+  CPPUNIT_ASSERT(tags != 0);
+
+  unsigned long total = (unsigned long)count * mems.size();
+
+  rofl::ctimespec delta = middle - start;
+  double secs = delta.get_tspec().tv_sec + delta.get_tspec().tv_nsec / 1e9;
+  std::cerr << "dispatched " << total << " messages in " << secs << "s ("
+            << (secs * 1e9 / total) << " ns/msg)" << std::endl;
+
+  delta = stop - middle;
+  secs = delta.get_tspec().tv_sec + delta.get_tspec().tv_nsec / 1e9;
+  std::cerr << "parsed " << total << " messages in " << secs << "s ("
+            << (secs * 1e9 / total) << " ns/msg)" << std::endl;
+}
@@ -0,0 +1,39 @@
+/*
+ * cofmsgdispatchtest.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef TEST_SRC_ROFL_COMMON_OPENFLOW_MESSAGES_COFMSGDISPATCH_TEST_HPP_
+#define TEST_SRC_ROFL_COMMON_OPENFLOW_MESSAGES_COFMSGDISPATCH_TEST_HPP_
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "rofl/common/cmemory.h"
+#include "rofl/common/openflow/messages/cofmsg_dispatch.h"
+
+class cofmsgdispatchtest : public CppUnit::TestFixture {
+  CPPUNIT_TEST_SUITE(cofmsgdispatchtest);
+  CPPUNIT_TEST(testTags);
+  CPPUNIT_TEST(testLookup);
+  CPPUNIT_TEST(testParse);
+  CPPUNIT_TEST(testCast);
+  CPPUNIT_TEST(testMerge);
+  CPPUNIT_TEST(testBenchmark);
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void setUp();
+  void tearDown();
+
+public:
+  void testTags();
+  void testLookup();
+  void testParse();
+  void testCast();
+  void testMerge();
+  void testBenchmark();
+};
+
+#endif /* TEST_SRC_ROFL_COMMON_OPENFLOW_MESSAGES_COFMSGDISPATCH_TEST_HPP_ */
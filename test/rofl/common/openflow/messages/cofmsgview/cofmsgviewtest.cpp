@@ -0,0 +1,193 @@
+/*
+ * cofmsgviewtest.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <stdlib.h>
+
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+
+#include "cofmsgviewtest.hpp"
+
+using namespace rofl::openflow;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(cofmsgviewtest);
+
+void cofmsgviewtest::setUp() {}
+
+void cofmsgviewtest::tearDown() {}
+
+void cofmsgviewtest::testPacketInView10() {
+  testPacketInView(rofl::openflow10::OFP_VERSION, 0xa1a2a3a4);
+}
+
+void cofmsgviewtest::testPacketInView12() {
+  testPacketInView(rofl::openflow12::OFP_VERSION, 0xa1a2a3a4);
+}
+
+void cofmsgviewtest::testPacketInView13() {
+  testPacketInView(rofl::openflow13::OFP_VERSION, 0xa1a2a3a4);
+}
+
+void cofmsgviewtest::testPacketInView(uint8_t version, uint32_t xid) {
+  uint32_t buffer_id = 0x31323334;
+  uint16_t total_len = 0x4142;
+  uint8_t reason = 0x51;
+  uint8_t table_id = 0x61;
+  uint64_t cookie = 0x7172737475767778;
+  uint16_t in_port = 0x8182;
+  rofl::openflow::cofmatch match(version);
+  if (version > rofl::openflow10::OFP_VERSION) {
+    match.set_eth_type(0x0800);
+    match.set_in_port(in_port);
+    match.set_eth_dst(rofl::caddress_ll("ff:ff:ff:ff:ff:ff"));
+  }
+  rofl::cpacket packet(128);
+  for (unsigned int i = 0; i < packet.length(); i++) {
+    packet.soframe()[i] = i;
+  }
+  rofl::openflow::cofmsg_packet_in msg1(
+      version, xid, buffer_id, total_len, reason, table_id, cookie, in_port,
+      match, packet.soframe(), packet.length());
+
+  /* message behind another one in a receive buffer */
+  size_t offset = 64;
+  std::shared_ptr<rofl::cmemory> mem(
+      new rofl::cmemory(offset + msg1.length()));
+  msg1.pack(mem->somem() + offset, msg1.length());
+
+  cofmsg_view view(mem, offset, msg1.length());
+  CPPUNIT_ASSERT(view.get_version() == version);
+  CPPUNIT_ASSERT(view.get_type() == rofl::openflow::OFPT_PACKET_IN);
+  CPPUNIT_ASSERT(view.get_length() == msg1.length());
+  CPPUNIT_ASSERT(view.get_xid() == xid);
+
+  cofmsg_packet_in_view pin(view);
+  CPPUNIT_ASSERT(pin.get_buffer_id() == buffer_id);
+  CPPUNIT_ASSERT(pin.get_total_len() == total_len);
+  CPPUNIT_ASSERT(pin.get_reason() == reason);
+  CPPUNIT_ASSERT(pin.get_in_port() == in_port);
+  if (version > rofl::openflow10::OFP_VERSION) {
+    CPPUNIT_ASSERT(pin.get_table_id() == table_id);
+    CPPUNIT_ASSERT(pin.get_match().get_eth_dst() == match.get_eth_dst());
+    CPPUNIT_ASSERT(pin.get_match().get_eth_type() == match.get_eth_type());
+  }
+  if (version > rofl::openflow12::OFP_VERSION) {
+    CPPUNIT_ASSERT(pin.get_cookie() == cookie);
+  }
+
+  /* packet data is not copied */
+  CPPUNIT_ASSERT(pin.get_datalen() == packet.length());
+  CPPUNIT_ASSERT(pin.get_data() >= mem->somem() + offset);
+  CPPUNIT_ASSERT(pin.get_data() < mem->somem() + mem->length());
+  CPPUNIT_ASSERT(memcmp(pin.get_data(), packet.soframe(), packet.length()) ==
+                 0);
+
+  cofmsg_packet_in *msg2 = pin.materialize();
+  CPPUNIT_ASSERT(msg2->get_xid() == xid);
+  CPPUNIT_ASSERT(msg2->get_buffer_id() == buffer_id);
+  CPPUNIT_ASSERT(msg2->get_packet() == packet);
+  delete msg2;
+}
+
+void cofmsgviewtest::testFlowRemovedView10() {
+  testFlowRemovedView(rofl::openflow10::OFP_VERSION, 0xa1a2a3a4);
+}
+
+void cofmsgviewtest::testFlowRemovedView13() {
+  testFlowRemovedView(rofl::openflow13::OFP_VERSION, 0xa1a2a3a4);
+}
+
+void cofmsgviewtest::testFlowRemovedView(uint8_t version, uint32_t xid) {
+  uint64_t cookie = 0x1112131415161718;
+  uint16_t priority = 0x2122;
+  uint8_t reason = 0x31;
+  uint8_t table_id = 0x41;
+  uint32_t duration_sec = 0x51525354;
+  uint32_t duration_nsec = 0x61626364;
+  uint16_t idle_timeout = 0x7172;
+  uint16_t hard_timeout = 0x8182;
+  uint64_t packet_count = 0x9192939495969798;
+  uint64_t byte_count = 0xa1a2a3a4a5a6a7a8;
+  rofl::openflow::cofmatch match(version);
+  match.set_eth_type(0x0800);
+  match.set_eth_dst(rofl::caddress_ll("ff:ff:ff:ff:ff:ff"));
+  rofl::openflow::cofmsg_flow_removed msg1(
+      version, xid, cookie, priority, reason, table_id, duration_sec,
+      duration_nsec, idle_timeout, hard_timeout, packet_count, byte_count,
+      match);
+
+  std::shared_ptr<rofl::cmemory> mem(new rofl::cmemory(msg1.length()));
+  msg1.pack(mem->somem(), mem->length());
+
+  cofmsg_flow_removed_view frm(cofmsg_view(mem, 0, mem->length()));
+  CPPUNIT_ASSERT(frm.get_xid() == xid);
+  CPPUNIT_ASSERT(frm.get_cookie() == cookie);
+  CPPUNIT_ASSERT(frm.get_priority() == priority);
+  CPPUNIT_ASSERT(frm.get_reason() == reason);
+  CPPUNIT_ASSERT(frm.get_duration_sec() == duration_sec);
+  CPPUNIT_ASSERT(frm.get_duration_nsec() == duration_nsec);
+  CPPUNIT_ASSERT(frm.get_idle_timeout() == idle_timeout);
+  CPPUNIT_ASSERT(frm.get_packet_count() == packet_count);
+  CPPUNIT_ASSERT(frm.get_byte_count() == byte_count);
+  CPPUNIT_ASSERT(frm.get_match().get_eth_type() == match.get_eth_type());
+  CPPUNIT_ASSERT(frm.get_match().get_eth_dst() == match.get_eth_dst());
+  if (version > rofl::openflow10::OFP_VERSION) {
+    CPPUNIT_ASSERT(frm.get_table_id() == table_id);
+    CPPUNIT_ASSERT(frm.get_hard_timeout() == hard_timeout);
+  }
+
+  cofmsg_flow_removed *msg2 = frm.materialize();
+  CPPUNIT_ASSERT(msg2->get_cookie() == cookie);
+  CPPUNIT_ASSERT(msg2->get_byte_count() == byte_count);
+  delete msg2;
+}
+
+void cofmsgviewtest::testViewLifetime() {
+  rofl::openflow::cofmsg_packet_in msg1(rofl::openflow13::OFP_VERSION,
+                                        0xb1b2b3b4);
+  std::shared_ptr<rofl::cmemory> mem(new rofl::cmemory(msg1.length()));
+  msg1.pack(mem->somem(), mem->length());
+
+  cofmsg_view view(mem, 0, mem->length());
+  CPPUNIT_ASSERT(mem.use_count() == 2);
+
+  /* copies share the receive buffer */
+  cofmsg_packet_in_view pin(view);
+  CPPUNIT_ASSERT(mem.use_count() == 3);
+
+  /* receive buffer is released by its last view */
+  mem.reset();
+  CPPUNIT_ASSERT(pin.get_xid() == 0xb1b2b3b4);
+  CPPUNIT_ASSERT(view.get_type() == rofl::openflow::OFPT_PACKET_IN);
+}
+
+void cofmsgviewtest::testViewInvalid() {
+  rofl::openflow::cofmsg_flow_removed msg1(rofl::openflow13::OFP_VERSION,
+                                           0xc1c2c3c4);
+  std::shared_ptr<rofl::cmemory> mem(new rofl::cmemory(msg1.length()));
+  msg1.pack(mem->somem(), mem->length());
+
+  /* length field does not match */
+  try {
+    cofmsg_view view(mem, 0, mem->length() - 8);
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::eBadRequestBadLen &e) {
+  }
+
+  /* exceeds buffer */
+  try {
+    cofmsg_view view(mem, 8, mem->length());
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::eBadRequestBadLen &e) {
+  }
+
+  /* wrong message type */
+  try {
+    cofmsg_packet_in_view pin(cofmsg_view(mem, 0, mem->length()));
+    CPPUNIT_ASSERT(false);
+  } catch (rofl::eBadRequestBadType &e) {
+  }
+}
@@ -0,0 +1,45 @@
+/*
+ * cofmsgviewtest.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef TEST_SRC_ROFL_COMMON_OPENFLOW_MESSAGES_COFMSGVIEW_TEST_HPP_
+#define TEST_SRC_ROFL_COMMON_OPENFLOW_MESSAGES_COFMSGVIEW_TEST_HPP_
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "rofl/common/cmemory.h"
+#include "rofl/common/openflow/messages/cofmsg_view.h"
+
+class cofmsgviewtest : public CppUnit::TestFixture {
+  CPPUNIT_TEST_SUITE(cofmsgviewtest);
+  CPPUNIT_TEST(testPacketInView10);
+  CPPUNIT_TEST(testPacketInView12);
+  CPPUNIT_TEST(testPacketInView13);
+  CPPUNIT_TEST(testFlowRemovedView10);
+  CPPUNIT_TEST(testFlowRemovedView13);
+  CPPUNIT_TEST(testViewLifetime);
+  CPPUNIT_TEST(testViewInvalid);
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void setUp();
+  void tearDown();
+
+public:
+  void testPacketInView10();
+  void testPacketInView12();
+  void testPacketInView13();
+  void testFlowRemovedView10();
+  void testFlowRemovedView13();
+  void testViewLifetime();
+  void testViewInvalid();
+
+private:
+  void testPacketInView(uint8_t version, uint32_t xid);
+  void testFlowRemovedView(uint8_t version, uint32_t xid);
+};
+
+#endif /* TEST_SRC_ROFL_COMMON_OPENFLOW_MESSAGES_COFMSGVIEW_TEST_HPP_ */